@@ -0,0 +1,31 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Benchmark Commandlet. Replays recorded response bodies through the response
+// reader, UPlayFabJsonObject::DecodeJson, FPlayFabError::decodeError and every generated
+// model decoder and one pass reader, and times every generated factory building and serializing its request.
+// Needs no title or network. Reports ns/op, allocations/op and bytes/op, and compares them
+// with a stored baseline:
+//
+//   UE4Editor-Cmd <Project> -run=PlayFabBenchmark [-fixtures=<dir>] [-baseline=<file>]
+//       [-writebaseline] [-iterations=<n>] [-filter=<substring>] [-tolerance=<fraction>]
+//
+// Fixtures are response bodies named after their endpoint, e.g. <dir>/Client/GetCatalogItems.json,
+// as written by the PlayFab.RecordFixtures console command. Decoders without a fixture are
+// run against an empty successful response. The commandlet returns 1 if any benchmark is
+// slower than the baseline by more than the tolerance, or allocates more.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Commandlets/Commandlet.h"
+#include "PlayFabBenchmarkCommandlet.generated.h"
+
+UCLASS()
+class UPlayFabBenchmarkCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UPlayFabBenchmarkCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+};
@@ -0,0 +1,122 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Client Load Test. A headless commandlet that plays as many virtual players at once
+// through the client API, each with its own session context. Every player logs in, fetches
+// its combined info, then loops: statistics updates, a purchase and PlayStream events,
+// separated by think time. By default it starts the stand-in server and plays against it:
+//
+//   UE4Editor-Cmd <Project> -run=PlayFabClientLoadTest [-players=1000] [-rampup=10]
+//       [-duration=60] [-think=1.0] [-statsupdates=2] [-events=1] [-item=<ItemId>]
+//       [-currency=GO] [-price=0] [-maxinflight=<n>] [-gcinterval=10]
+//       [-port=7780] [-script=<stand-in script>] [-url=<server url instead of the stand-in>]
+//
+// Reports throughput, latency percentiles per step, memory per session and GC time.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Commandlets/Commandlet.h"
+#include "PlayFabClientAPI.h"
+#include "PlayFabMetrics.h"
+#include "PlayFabClientLoadTest.generated.h"
+
+class UPlayFabClientLoadTestCommandlet;
+
+/** One virtual player, stepping through the flow as its calls complete */
+UCLASS()
+class UPlayFabClientLoadTestPlayer : public UObject
+{
+    GENERATED_BODY()
+
+public:
+    enum class EStep : uint8
+    {
+        Login,
+        CombinedInfo,
+        Statistics,
+        Purchase,
+        Event,
+        Think,
+    };
+
+    static const int32 CallStepCount = (int32)EStep::Event + 1;
+
+    void Begin(UPlayFabClientLoadTestCommandlet* InDriver, int32 InIndex, const FString& RunId);
+
+    /** Start the next cycle once the think time is over. Returns true if it did */
+    bool TickThink(double Now);
+
+    UFUNCTION()
+        void OnLoggedIn(FClientLoginResult result, UObject* customData);
+    UFUNCTION()
+        void OnCombinedInfo(FClientGetPlayerCombinedInfoResult result, UObject* customData);
+    UFUNCTION()
+        void OnStatisticsUpdated(FClientUpdatePlayerStatisticsResult result, UObject* customData);
+    UFUNCTION()
+        void OnPurchased(FClientPurchaseItemResult result, UObject* customData);
+    UFUNCTION()
+        void OnEventWritten(FClientWriteEventResponse result, UObject* customData);
+    UFUNCTION()
+        void OnError(FPlayFabError error, UObject* customData);
+
+private:
+    /** Make the call for Step, or start thinking */
+    void Run(EStep NextStep);
+
+    /** Record the call that just finished and move on to the step after it */
+    void Finish(bool bSucceeded);
+
+    void Send(UPlayFabClientAPI* Call);
+
+    UPlayFabClientLoadTestCommandlet* Driver;
+    TSharedPtr<FPlayFabSessionContext, ESPMode::ThreadSafe> Session;
+    FString CustomId;
+    FRandomStream Random;
+    EStep Step;
+    int32 StepRepeat;
+    double CallStartTime;
+    double ThinkUntil;
+};
+
+UCLASS()
+class UPlayFabClientLoadTestCommandlet : public UCommandlet
+{
+    GENERATED_BODY()
+
+public:
+    UPlayFabClientLoadTestCommandlet();
+
+    virtual int32 Main(const FString& Params) override;
+
+    /** Called by the players as calls complete */
+    void RecordCall(UPlayFabClientLoadTestPlayer::EStep Step, double Seconds, bool bSucceeded);
+
+    /** The flow, read from the command line */
+    float ThinkSeconds;
+    int32 StatisticsUpdates;
+    int32 Events;
+    FString ItemId;
+    FString Currency;
+    int32 Price;
+
+private:
+    struct FStepResults
+    {
+        FPlayFabHistogram Latency;
+        int32 Succeeded = 0;
+        int32 Failed = 0;
+        int32 SucceededAfterRampUp = 0;
+    };
+
+    /** Pump the http module, tickers and game thread tasks, as the engine loop would */
+    static void TickEngine(float DeltaTime);
+
+    void Report(double RampUpSeconds, double SteadySeconds, int32 PlayerCount, int64 MemoryPerSession) const;
+
+    UPROPERTY()
+        TArray<UPlayFabClientLoadTestPlayer*> Players;
+
+    FStepResults Steps[UPlayFabClientLoadTestPlayer::CallStepCount];
+    bool bRampedUp;
+
+    FPlayFabHistogram GarbageCollectionMicros;
+};
@@ -6,6 +6,7 @@
 #include "PlayFabPrivatePCH.h"
 
 const FString IPlayFab::PlayFabURL(TEXT(".playfabapi.com"));
+IPlayFab* IPlayFab::LoadedModule = nullptr;
 
 class FPlayFab : public IPlayFab
 {
@@ -17,11 +18,39 @@ class FPlayFab : public IPlayFab
         UPlayFabJsonValue::StaticClass();
 
         UPlayFabClientAPI::StaticClass();
+
+        LoadedModule = this;
+
+        FPlayFabTracer::Startup();
+        FPlayFabMetrics::Startup();
+        FPlayFabManagerPool::Startup();
+        FPlayFabRequestDispatcher::Startup();
+
+        // Point the SDK somewhere other than the live title, e.g. for load tests
+        FString ServerUrl;
+        if (FParse::Value(FCommandLine::Get(), TEXT("PlayFabUrl="), ServerUrl))
+        {
+            setServerUrl(ServerUrl);
+        }
+        int32 StandInPort = 0;
+        if (FParse::Value(FCommandLine::Get(), TEXT("PlayFabStandIn="), StandInPort))
+        {
+            FString StandInScript;
+            FParse::Value(FCommandLine::Get(), TEXT("PlayFabStandInScript="), StandInScript);
+            FPlayFabStandInServer::Start(StandInPort, StandInScript);
+        }
     }
 
     virtual void ShutdownModule() override
     {
-
+        FPlayFabStandInServer::Shutdown();
+        FPlayFabRequestDispatcher::Shutdown();
+        FPlayFabManagerPool::Shutdown();
+        FPlayFabMetrics::Shutdown();
+        FPlayFabTracer::Shutdown();
+        FPlayFabCatalogIndex::Shutdown();
+
+        LoadedModule = nullptr;
     }
 
 };
@@ -6,6 +6,7 @@
 
 #include "PlayFabPrivatePCH.h"
 #include "PlayFabEnums.h"
+#include "PlayFabRequestWriter.h"
 #include "PlayFabClientAPI.h"
 
 UPlayFabClientAPI::UPlayFabClientAPI(const FObjectInitializer& ObjectInitializer)
@@ -16,6 +17,16 @@ UPlayFabClientAPI::UPlayFabClientAPI(const FObjectInitializer& ObjectInitializer
 void UPlayFabClientAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+UPlayFabJsonObject* UPlayFabClientAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr)
+    {
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabClientAPI::GetResponseObject()
@@ -67,28 +78,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPhotonAuthenticationToken(FClientGetPho
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPhotonAuthenticationToken = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPhotonAuthenticationToken);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPhotonAuthenticationToken";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PhotonApplicationId.IsEmpty() || request.PhotonApplicationId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PhotonApplicationId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PhotonApplicationId"), request.PhotonApplicationId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PhotonApplicationId", request.PhotonApplicationId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -106,10 +114,10 @@ void UPlayFabClientAPI::HelperGetPhotonAuthenticationToken(FPlayFabBaseModel res
     }
     else
     {
-        FClientGetPhotonAuthenticationTokenResult result = UPlayFabClientModelDecoder::decodeGetPhotonAuthenticationTokenResultResponse(response.responseData);
-        if (OnSuccessGetPhotonAuthenticationToken.IsBound())
+        FClientGetPhotonAuthenticationTokenResult result = UPlayFabClientModelDecoder::readGetPhotonAuthenticationTokenResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPhotonAuthenticationToken.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPhotonAuthenticationToken(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -121,29 +129,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitlePublicKey(FClientGetTitlePublicKey
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTitlePublicKey = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetTitlePublicKey);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetTitlePublicKey";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.TitleSharedSecret.IsEmpty() || request.TitleSharedSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TitleSharedSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TitleSharedSecret"), request.TitleSharedSecret);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("TitleSharedSecret", request.TitleSharedSecret);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -161,10 +167,10 @@ void UPlayFabClientAPI::HelperGetTitlePublicKey(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientGetTitlePublicKeyResult result = UPlayFabClientModelDecoder::decodeGetTitlePublicKeyResultResponse(response.responseData);
-        if (OnSuccessGetTitlePublicKey.IsBound())
+        FClientGetTitlePublicKeyResult result = UPlayFabClientModelDecoder::readGetTitlePublicKeyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTitlePublicKey.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTitlePublicKey(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -176,29 +182,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetWindowsHelloChallenge(FClientGetWindows
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetWindowsHelloChallenge = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetWindowsHelloChallenge);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetWindowsHelloChallenge";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.PublicKeyHint.IsEmpty() || request.PublicKeyHint == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKeyHint"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKeyHint"), request.PublicKeyHint);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("PublicKeyHint", request.PublicKeyHint);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -216,10 +219,10 @@ void UPlayFabClientAPI::HelperGetWindowsHelloChallenge(FPlayFabBaseModel respons
     }
     else
     {
-        FClientGetWindowsHelloChallengeResponse result = UPlayFabClientModelDecoder::decodeGetWindowsHelloChallengeResponseResponse(response.responseData);
-        if (OnSuccessGetWindowsHelloChallenge.IsBound())
+        FClientGetWindowsHelloChallengeResponse result = UPlayFabClientModelDecoder::readGetWindowsHelloChallengeResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetWindowsHelloChallenge.Execute(result, mCustomData);
+            FDelegateOnSuccessGetWindowsHelloChallenge(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -231,52 +234,33 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithAndroidDeviceID(FClientLoginWithA
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithAndroidDeviceID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithAndroidDeviceID);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LoginWithAndroidDeviceID";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.AndroidDeviceId.IsEmpty() || request.AndroidDeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDeviceId"), request.AndroidDeviceId);
-    }
-    if (request.OS.IsEmpty() || request.OS == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OS"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OS"), request.OS);
-    }
-    if (request.AndroidDevice.IsEmpty() || request.AndroidDevice == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDevice"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDevice"), request.AndroidDevice);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AndroidDeviceId", request.AndroidDeviceId);
+    Writer.WriteString("OS", request.OS);
+    Writer.WriteString("AndroidDevice", request.AndroidDevice);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -294,10 +278,14 @@ void UPlayFabClientAPI::HelperLoginWithAndroidDeviceID(FPlayFabBaseModel respons
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithAndroidDeviceID.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithAndroidDeviceID.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithAndroidDeviceID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -309,42 +297,31 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithCustomID(FClientLoginWithCustomID
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithCustomID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithCustomID);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LoginWithCustomID";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.CustomId.IsEmpty() || request.CustomId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomId"), request.CustomId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CustomId", request.CustomId);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -362,10 +339,14 @@ void UPlayFabClientAPI::HelperLoginWithCustomID(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithCustomID.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithCustomID.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithCustomID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -377,36 +358,29 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithEmailAddress(FClientLoginWithEmai
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithEmailAddress = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithEmailAddress);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LoginWithEmailAddress";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("Email", request.Email);
+    Writer.WriteString("Password", request.Password);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -424,10 +398,14 @@ void UPlayFabClientAPI::HelperLoginWithEmailAddress(FPlayFabBaseModel response,
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithEmailAddress.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessLoginWithEmailAddress.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessLoginWithEmailAddress(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -439,42 +417,31 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithFacebook(FClientLoginWithFacebook
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithFacebook = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithFacebook);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LoginWithFacebook";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AccessToken", request.AccessToken);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -492,10 +459,14 @@ void UPlayFabClientAPI::HelperLoginWithFacebook(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithFacebook.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithFacebook.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithFacebook(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -507,42 +478,31 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithGameCenter(FClientLoginWithGameCe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithGameCenter = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithGameCenter);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LoginWithGameCenter";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayerId.IsEmpty() || request.PlayerId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerId"), request.PlayerId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayerId", request.PlayerId);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -560,10 +520,14 @@ void UPlayFabClientAPI::HelperLoginWithGameCenter(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithGameCenter.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessLoginWithGameCenter.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessLoginWithGameCenter(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -575,42 +539,31 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithGoogleAccount(FClientLoginWithGoo
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithGoogleAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithGoogleAccount);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LoginWithGoogleAccount";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.ServerAuthCode.IsEmpty() || request.ServerAuthCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerAuthCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerAuthCode"), request.ServerAuthCode);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ServerAuthCode", request.ServerAuthCode);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -628,10 +581,14 @@ void UPlayFabClientAPI::HelperLoginWithGoogleAccount(FPlayFabBaseModel response,
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithGoogleAccount.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithGoogleAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithGoogleAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -643,52 +600,33 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithIOSDeviceID(FClientLoginWithIOSDe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithIOSDeviceID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithIOSDeviceID);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LoginWithIOSDeviceID";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.DeviceId.IsEmpty() || request.DeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceId"), request.DeviceId);
-    }
-    if (request.OS.IsEmpty() || request.OS == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OS"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OS"), request.OS);
-    }
-    if (request.DeviceModel.IsEmpty() || request.DeviceModel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceModel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceModel"), request.DeviceModel);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("DeviceId", request.DeviceId);
+    Writer.WriteString("OS", request.OS);
+    Writer.WriteString("DeviceModel", request.DeviceModel);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -706,10 +644,14 @@ void UPlayFabClientAPI::HelperLoginWithIOSDeviceID(FPlayFabBaseModel response, U
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithIOSDeviceID.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithIOSDeviceID.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithIOSDeviceID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -721,47 +663,32 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithKongregate(FClientLoginWithKongre
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithKongregate = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithKongregate);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LoginWithKongregate";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.KongregateId.IsEmpty() || request.KongregateId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KongregateId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("KongregateId"), request.KongregateId);
-    }
-    if (request.AuthTicket.IsEmpty() || request.AuthTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AuthTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AuthTicket"), request.AuthTicket);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("KongregateId", request.KongregateId);
+    Writer.WriteString("AuthTicket", request.AuthTicket);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -779,10 +706,14 @@ void UPlayFabClientAPI::HelperLoginWithKongregate(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithKongregate.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithKongregate.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithKongregate(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -794,36 +725,29 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithPlayFab(FClientLoginWithPlayFabRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithPlayFab = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithPlayFab);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LoginWithPlayFab";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("Username", request.Username);
+    Writer.WriteString("Password", request.Password);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -841,10 +765,14 @@ void UPlayFabClientAPI::HelperLoginWithPlayFab(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithPlayFab.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithPlayFab.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithPlayFab(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -856,42 +784,31 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithSteam(FClientLoginWithSteamReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithSteam = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithSteam);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LoginWithSteam";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.SteamTicket.IsEmpty() || request.SteamTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SteamTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SteamTicket"), request.SteamTicket);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SteamTicket", request.SteamTicket);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -909,10 +826,14 @@ void UPlayFabClientAPI::HelperLoginWithSteam(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithSteam.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessLoginWithSteam.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessLoginWithSteam(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -924,42 +845,31 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithTwitch(FClientLoginWithTwitchRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithTwitch = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithTwitch);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LoginWithTwitch";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AccessToken", request.AccessToken);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -977,10 +887,14 @@ void UPlayFabClientAPI::HelperLoginWithTwitch(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithTwitch.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithTwitch.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithTwitch(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -992,36 +906,29 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithWindowsHello(FClientLoginWithWind
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithWindowsHello = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithWindowsHello);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LoginWithWindowsHello";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.ChallengeSignature.IsEmpty() || request.ChallengeSignature == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ChallengeSignature"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ChallengeSignature"), request.ChallengeSignature);
-    }
-    if (request.PublicKeyHint.IsEmpty() || request.PublicKeyHint == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKeyHint"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKeyHint"), request.PublicKeyHint);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("ChallengeSignature", request.ChallengeSignature);
+    Writer.WriteString("PublicKeyHint", request.PublicKeyHint);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1039,10 +946,14 @@ void UPlayFabClientAPI::HelperLoginWithWindowsHello(FPlayFabBaseModel response,
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithWindowsHello.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithWindowsHello.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithWindowsHello(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1054,56 +965,32 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterPlayFabUser(FClientRegisterPlayFab
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRegisterPlayFabUser = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRegisterPlayFabUser);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/RegisterPlayFabUser";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("RequireBothUsernameAndEmail"), request.RequireBothUsernameAndEmail);
-    if (request.DisplayName.IsEmpty() || request.DisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DisplayName"), request.DisplayName);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Username", request.Username);
+    Writer.WriteString("Email", request.Email);
+    Writer.WriteString("Password", request.Password);
+    Writer.WriteBool("RequireBothUsernameAndEmail", request.RequireBothUsernameAndEmail);
+    Writer.WriteString("DisplayName", request.DisplayName);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1121,10 +1008,14 @@ void UPlayFabClientAPI::HelperRegisterPlayFabUser(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientRegisterPlayFabUserResult result = UPlayFabClientModelDecoder::decodeRegisterPlayFabUserResultResponse(response.responseData);
-        if (OnSuccessRegisterPlayFabUser.IsBound())
+        FClientRegisterPlayFabUserResult result = UPlayFabClientModelDecoder::readRegisterPlayFabUserResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessRegisterPlayFabUser.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillRegisterPlayFabUserResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessRegisterPlayFabUser(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1136,51 +1027,31 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterWithWindowsHello(FClientRegisterWi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRegisterWithWindowsHello = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRegisterWithWindowsHello);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/RegisterWithWindowsHello";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.UserName.IsEmpty() || request.UserName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("UserName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("UserName"), request.UserName);
-    }
-    if (request.PublicKey.IsEmpty() || request.PublicKey == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKey"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKey"), request.PublicKey);
-    }
-    if (request.DeviceName.IsEmpty() || request.DeviceName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceName"), request.DeviceName);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("UserName", request.UserName);
+    Writer.WriteString("PublicKey", request.PublicKey);
+    Writer.WriteString("DeviceName", request.DeviceName);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1198,10 +1069,14 @@ void UPlayFabClientAPI::HelperRegisterWithWindowsHello(FPlayFabBaseModel respons
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessRegisterWithWindowsHello.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessRegisterWithWindowsHello.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessRegisterWithWindowsHello(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1213,33 +1088,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::SetPlayerSecret(FClientSetPlayerSecretRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetPlayerSecret = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperSetPlayerSecret);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/SetPlayerSecret";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1257,10 +1125,10 @@ void UPlayFabClientAPI::HelperSetPlayerSecret(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientSetPlayerSecretResult result = UPlayFabClientModelDecoder::decodeSetPlayerSecretResultResponse(response.responseData);
-        if (OnSuccessSetPlayerSecret.IsBound())
+        FClientSetPlayerSecretResult result = UPlayFabClientModelDecoder::readSetPlayerSecretResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetPlayerSecret.Execute(result, mCustomData);
+            FDelegateOnSuccessSetPlayerSecret(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1276,24 +1144,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddGenericID(FClientAddGenericIDRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddGenericID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAddGenericID);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/AddGenericID";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.GenericId != nullptr) OutRestJsonObj->SetObjectField(TEXT("GenericId"), request.GenericId);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("GenericId", request.GenericId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1311,10 +1179,10 @@ void UPlayFabClientAPI::HelperAddGenericID(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientAddGenericIDResult result = UPlayFabClientModelDecoder::decodeAddGenericIDResultResponse(response.responseData);
-        if (OnSuccessAddGenericID.IsBound())
+        FClientAddGenericIDResult result = UPlayFabClientModelDecoder::readAddGenericIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddGenericID.Execute(result, mCustomData);
+            FDelegateOnSuccessAddGenericID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1326,38 +1194,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddUsernamePassword(FClientAddUsernamePass
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddUsernamePassword = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAddUsernamePassword);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/AddUsernamePassword";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Username", request.Username);
+    Writer.WriteString("Email", request.Email);
+    Writer.WriteString("Password", request.Password);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1375,10 +1231,10 @@ void UPlayFabClientAPI::HelperAddUsernamePassword(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientAddUsernamePasswordResult result = UPlayFabClientModelDecoder::decodeAddUsernamePasswordResultResponse(response.responseData);
-        if (OnSuccessAddUsernamePassword.IsBound())
+        FClientAddUsernamePasswordResult result = UPlayFabClientModelDecoder::readAddUsernamePasswordResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddUsernamePassword.Execute(result, mCustomData);
+            FDelegateOnSuccessAddUsernamePassword(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1390,43 +1246,29 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAccountInfo(FClientGetAccountInfoReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetAccountInfo = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetAccountInfo);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetAccountInfo";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.TitleDisplayName.IsEmpty() || request.TitleDisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TitleDisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TitleDisplayName"), request.TitleDisplayName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("Username", request.Username);
+    Writer.WriteString("Email", request.Email);
+    Writer.WriteString("TitleDisplayName", request.TitleDisplayName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1444,10 +1286,14 @@ void UPlayFabClientAPI::HelperGetAccountInfo(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientGetAccountInfoResult result = UPlayFabClientModelDecoder::decodeGetAccountInfoResultResponse(response.responseData);
-        if (OnSuccessGetAccountInfo.IsBound())
+        FClientGetAccountInfoResult result = UPlayFabClientModelDecoder::readGetAccountInfoResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetAccountInfoResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetAccountInfo.Execute(result, mCustomData);
+            FDelegateOnSuccessGetAccountInfo(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1459,29 +1305,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerCombinedInfo(FClientGetPlayerComb
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerCombinedInfo = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerCombinedInfo);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayerCombinedInfo";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1499,10 +1343,14 @@ void UPlayFabClientAPI::HelperGetPlayerCombinedInfo(FPlayFabBaseModel response,
     }
     else
     {
-        FClientGetPlayerCombinedInfoResult result = UPlayFabClientModelDecoder::decodeGetPlayerCombinedInfoResultResponse(response.responseData);
-        if (OnSuccessGetPlayerCombinedInfo.IsBound())
+        FClientGetPlayerCombinedInfoResult result = UPlayFabClientModelDecoder::readGetPlayerCombinedInfoResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayerCombinedInfoResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerCombinedInfo.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerCombinedInfo(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1514,29 +1362,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerProfile(FClientGetPlayerProfileRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerProfile = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerProfile);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayerProfile";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1554,10 +1400,14 @@ void UPlayFabClientAPI::HelperGetPlayerProfile(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientGetPlayerProfileResult result = UPlayFabClientModelDecoder::decodeGetPlayerProfileResultResponse(response.responseData);
-        if (OnSuccessGetPlayerProfile.IsBound())
+        FClientGetPlayerProfileResult result = UPlayFabClientModelDecoder::readGetPlayerProfileResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayerProfileResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerProfile.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerProfile(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1569,31 +1419,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(FClientGetPla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromFacebookIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromFacebookIDs);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromFacebookIDs";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.FacebookIDs.IsEmpty() || request.FacebookIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FacebookIDs"));
-    } else {
-        TArray<FString> FacebookIDsArray;
-        FString(request.FacebookIDs).ParseIntoArray(FacebookIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("FacebookIDs"), FacebookIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("FacebookIDs", request.FacebookIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1611,10 +1456,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromFacebookIDs(FPlayFabBaseModel res
     }
     else
     {
-        FClientGetPlayFabIDsFromFacebookIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromFacebookIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromFacebookIDs.IsBound())
+        FClientGetPlayFabIDsFromFacebookIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromFacebookIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromFacebookIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromFacebookIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromFacebookIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1626,31 +1475,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(FClientGetP
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromGameCenterIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromGameCenterIDs);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromGameCenterIDs";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.GameCenterIDs.IsEmpty() || request.GameCenterIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameCenterIDs"));
-    } else {
-        TArray<FString> GameCenterIDsArray;
-        FString(request.GameCenterIDs).ParseIntoArray(GameCenterIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("GameCenterIDs"), GameCenterIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("GameCenterIDs", request.GameCenterIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1668,10 +1512,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromGameCenterIDs(FPlayFabBaseModel r
     }
     else
     {
-        FClientGetPlayFabIDsFromGameCenterIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGameCenterIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromGameCenterIDs.IsBound())
+        FClientGetPlayFabIDsFromGameCenterIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromGameCenterIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromGameCenterIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromGameCenterIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromGameCenterIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1683,28 +1531,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(FClientGetPlay
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromGenericIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromGenericIDs);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromGenericIDs";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.GenericIDs.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("GenericIDs"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("GenericIDs"), request.GenericIDs);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("GenericIDs", request.GenericIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1722,10 +1568,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromGenericIDs(FPlayFabBaseModel resp
     }
     else
     {
-        FClientGetPlayFabIDsFromGenericIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGenericIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromGenericIDs.IsBound())
+        FClientGetPlayFabIDsFromGenericIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromGenericIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromGenericIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromGenericIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromGenericIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1737,31 +1587,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(FClientGetPlayF
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromGoogleIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromGoogleIDs);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromGoogleIDs";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.GoogleIDs.IsEmpty() || request.GoogleIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GoogleIDs"));
-    } else {
-        TArray<FString> GoogleIDsArray;
-        FString(request.GoogleIDs).ParseIntoArray(GoogleIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("GoogleIDs"), GoogleIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("GoogleIDs", request.GoogleIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1779,10 +1624,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromGoogleIDs(FPlayFabBaseModel respo
     }
     else
     {
-        FClientGetPlayFabIDsFromGoogleIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGoogleIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromGoogleIDs.IsBound())
+        FClientGetPlayFabIDsFromGoogleIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromGoogleIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromGoogleIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromGoogleIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromGoogleIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1794,31 +1643,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(FClientGetP
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromKongregateIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromKongregateIDs);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromKongregateIDs";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.KongregateIDs.IsEmpty() || request.KongregateIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KongregateIDs"));
-    } else {
-        TArray<FString> KongregateIDsArray;
-        FString(request.KongregateIDs).ParseIntoArray(KongregateIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KongregateIDs"), KongregateIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("KongregateIDs", request.KongregateIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1836,10 +1680,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromKongregateIDs(FPlayFabBaseModel r
     }
     else
     {
-        FClientGetPlayFabIDsFromKongregateIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromKongregateIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromKongregateIDs.IsBound())
+        FClientGetPlayFabIDsFromKongregateIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromKongregateIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromKongregateIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromKongregateIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromKongregateIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1851,31 +1699,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(FClientGetPlayFa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromSteamIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromSteamIDs);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromSteamIDs";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.SteamStringIDs.IsEmpty() || request.SteamStringIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SteamStringIDs"));
-    } else {
-        TArray<FString> SteamStringIDsArray;
-        FString(request.SteamStringIDs).ParseIntoArray(SteamStringIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("SteamStringIDs"), SteamStringIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("SteamStringIDs", request.SteamStringIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1893,10 +1736,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromSteamIDs(FPlayFabBaseModel respon
     }
     else
     {
-        FClientGetPlayFabIDsFromSteamIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromSteamIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromSteamIDs.IsBound())
+        FClientGetPlayFabIDsFromSteamIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromSteamIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromSteamIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromSteamIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromSteamIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1908,31 +1755,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(FClientGetPlayF
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromTwitchIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromTwitchIDs);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromTwitchIDs";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.TwitchIds.IsEmpty() || request.TwitchIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TwitchIds"));
-    } else {
-        TArray<FString> TwitchIdsArray;
-        FString(request.TwitchIds).ParseIntoArray(TwitchIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("TwitchIds"), TwitchIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("TwitchIds", request.TwitchIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1950,10 +1792,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromTwitchIDs(FPlayFabBaseModel respo
     }
     else
     {
-        FClientGetPlayFabIDsFromTwitchIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromTwitchIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromTwitchIDs.IsBound())
+        FClientGetPlayFabIDsFromTwitchIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromTwitchIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromTwitchIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromTwitchIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromTwitchIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1965,39 +1811,28 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkAndroidDeviceID(FClientLinkAndroidDevi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkAndroidDeviceID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkAndroidDeviceID);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LinkAndroidDeviceID";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.AndroidDeviceId.IsEmpty() || request.AndroidDeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDeviceId"), request.AndroidDeviceId);
-    }
-    if (request.OS.IsEmpty() || request.OS == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OS"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OS"), request.OS);
-    }
-    if (request.AndroidDevice.IsEmpty() || request.AndroidDevice == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDevice"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDevice"), request.AndroidDevice);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AndroidDeviceId", request.AndroidDeviceId);
+    Writer.WriteString("OS", request.OS);
+    Writer.WriteString("AndroidDevice", request.AndroidDevice);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2015,10 +1850,10 @@ void UPlayFabClientAPI::HelperLinkAndroidDeviceID(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientLinkAndroidDeviceIDResult result = UPlayFabClientModelDecoder::decodeLinkAndroidDeviceIDResultResponse(response.responseData);
-        if (OnSuccessLinkAndroidDeviceID.IsBound())
+        FClientLinkAndroidDeviceIDResult result = UPlayFabClientModelDecoder::readLinkAndroidDeviceIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkAndroidDeviceID.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkAndroidDeviceID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2030,29 +1865,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkCustomID(FClientLinkCustomIDRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkCustomID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkCustomID);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LinkCustomID";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.CustomId.IsEmpty() || request.CustomId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomId"), request.CustomId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CustomId", request.CustomId);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2070,10 +1902,10 @@ void UPlayFabClientAPI::HelperLinkCustomID(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientLinkCustomIDResult result = UPlayFabClientModelDecoder::decodeLinkCustomIDResultResponse(response.responseData);
-        if (OnSuccessLinkCustomID.IsBound())
+        FClientLinkCustomIDResult result = UPlayFabClientModelDecoder::readLinkCustomIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkCustomID.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkCustomID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2085,29 +1917,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkFacebookAccount(FClientLinkFacebookAcc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkFacebookAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkFacebookAccount);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LinkFacebookAccount";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AccessToken", request.AccessToken);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2125,10 +1954,10 @@ void UPlayFabClientAPI::HelperLinkFacebookAccount(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientLinkFacebookAccountResult result = UPlayFabClientModelDecoder::decodeLinkFacebookAccountResultResponse(response.responseData);
-        if (OnSuccessLinkFacebookAccount.IsBound())
+        FClientLinkFacebookAccountResult result = UPlayFabClientModelDecoder::readLinkFacebookAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkFacebookAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkFacebookAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2140,29 +1969,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkGameCenterAccount(FClientLinkGameCente
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkGameCenterAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkGameCenterAccount);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LinkGameCenterAccount";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.GameCenterId.IsEmpty() || request.GameCenterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameCenterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameCenterId"), request.GameCenterId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("GameCenterId", request.GameCenterId);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2180,10 +2006,10 @@ void UPlayFabClientAPI::HelperLinkGameCenterAccount(FPlayFabBaseModel response,
     }
     else
     {
-        FClientLinkGameCenterAccountResult result = UPlayFabClientModelDecoder::decodeLinkGameCenterAccountResultResponse(response.responseData);
-        if (OnSuccessLinkGameCenterAccount.IsBound())
+        FClientLinkGameCenterAccountResult result = UPlayFabClientModelDecoder::readLinkGameCenterAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkGameCenterAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkGameCenterAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2195,29 +2021,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkGoogleAccount(FClientLinkGoogleAccount
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkGoogleAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkGoogleAccount);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LinkGoogleAccount";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.ServerAuthCode.IsEmpty() || request.ServerAuthCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerAuthCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerAuthCode"), request.ServerAuthCode);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ServerAuthCode", request.ServerAuthCode);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2235,10 +2058,10 @@ void UPlayFabClientAPI::HelperLinkGoogleAccount(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientLinkGoogleAccountResult result = UPlayFabClientModelDecoder::decodeLinkGoogleAccountResultResponse(response.responseData);
-        if (OnSuccessLinkGoogleAccount.IsBound())
+        FClientLinkGoogleAccountResult result = UPlayFabClientModelDecoder::readLinkGoogleAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkGoogleAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkGoogleAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2250,39 +2073,28 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkIOSDeviceID(FClientLinkIOSDeviceIDRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkIOSDeviceID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkIOSDeviceID);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LinkIOSDeviceID";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.DeviceId.IsEmpty() || request.DeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceId"), request.DeviceId);
-    }
-    if (request.OS.IsEmpty() || request.OS == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OS"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OS"), request.OS);
-    }
-    if (request.DeviceModel.IsEmpty() || request.DeviceModel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceModel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceModel"), request.DeviceModel);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("DeviceId", request.DeviceId);
+    Writer.WriteString("OS", request.OS);
+    Writer.WriteString("DeviceModel", request.DeviceModel);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2300,10 +2112,10 @@ void UPlayFabClientAPI::HelperLinkIOSDeviceID(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientLinkIOSDeviceIDResult result = UPlayFabClientModelDecoder::decodeLinkIOSDeviceIDResultResponse(response.responseData);
-        if (OnSuccessLinkIOSDeviceID.IsBound())
+        FClientLinkIOSDeviceIDResult result = UPlayFabClientModelDecoder::readLinkIOSDeviceIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkIOSDeviceID.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkIOSDeviceID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2315,34 +2127,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkKongregate(FClientLinkKongregateAccoun
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkKongregate = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkKongregate);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LinkKongregate";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.KongregateId.IsEmpty() || request.KongregateId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KongregateId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("KongregateId"), request.KongregateId);
-    }
-    if (request.AuthTicket.IsEmpty() || request.AuthTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AuthTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AuthTicket"), request.AuthTicket);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("KongregateId", request.KongregateId);
+    Writer.WriteString("AuthTicket", request.AuthTicket);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2360,10 +2165,10 @@ void UPlayFabClientAPI::HelperLinkKongregate(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientLinkKongregateAccountResult result = UPlayFabClientModelDecoder::decodeLinkKongregateAccountResultResponse(response.responseData);
-        if (OnSuccessLinkKongregate.IsBound())
+        FClientLinkKongregateAccountResult result = UPlayFabClientModelDecoder::readLinkKongregateAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkKongregate.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkKongregate(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2375,29 +2180,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkSteamAccount(FClientLinkSteamAccountRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkSteamAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkSteamAccount);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LinkSteamAccount";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.SteamTicket.IsEmpty() || request.SteamTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SteamTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SteamTicket"), request.SteamTicket);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SteamTicket", request.SteamTicket);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2415,10 +2217,10 @@ void UPlayFabClientAPI::HelperLinkSteamAccount(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientLinkSteamAccountResult result = UPlayFabClientModelDecoder::decodeLinkSteamAccountResultResponse(response.responseData);
-        if (OnSuccessLinkSteamAccount.IsBound())
+        FClientLinkSteamAccountResult result = UPlayFabClientModelDecoder::readLinkSteamAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkSteamAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkSteamAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2430,29 +2232,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkTwitch(FClientLinkTwitchAccountRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkTwitch = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkTwitch);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LinkTwitch";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AccessToken", request.AccessToken);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2470,10 +2269,10 @@ void UPlayFabClientAPI::HelperLinkTwitch(FPlayFabBaseModel response, UObject* cu
     }
     else
     {
-        FClientLinkTwitchAccountResult result = UPlayFabClientModelDecoder::decodeLinkTwitchAccountResultResponse(response.responseData);
-        if (OnSuccessLinkTwitch.IsBound())
+        FClientLinkTwitchAccountResult result = UPlayFabClientModelDecoder::readLinkTwitchAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkTwitch.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkTwitch(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2485,39 +2284,28 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkWindowsHello(FClientLinkWindowsHelloAc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkWindowsHello = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkWindowsHello);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/LinkWindowsHello";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.UserName.IsEmpty() || request.UserName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("UserName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("UserName"), request.UserName);
-    }
-    if (request.PublicKey.IsEmpty() || request.PublicKey == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKey"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKey"), request.PublicKey);
-    }
-    if (request.DeviceName.IsEmpty() || request.DeviceName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceName"), request.DeviceName);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("UserName", request.UserName);
+    Writer.WriteString("PublicKey", request.PublicKey);
+    Writer.WriteString("DeviceName", request.DeviceName);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2535,10 +2323,10 @@ void UPlayFabClientAPI::HelperLinkWindowsHello(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientLinkWindowsHelloAccountResponse result = UPlayFabClientModelDecoder::decodeLinkWindowsHelloAccountResponseResponse(response.responseData);
-        if (OnSuccessLinkWindowsHello.IsBound())
+        FClientLinkWindowsHelloAccountResponse result = UPlayFabClientModelDecoder::readLinkWindowsHelloAccountResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkWindowsHello.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkWindowsHello(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2550,24 +2338,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveGenericID(FClientRemoveGenericIDRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRemoveGenericID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRemoveGenericID);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/RemoveGenericID";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.GenericId != nullptr) OutRestJsonObj->SetObjectField(TEXT("GenericId"), request.GenericId);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("GenericId", request.GenericId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2585,10 +2373,10 @@ void UPlayFabClientAPI::HelperRemoveGenericID(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientRemoveGenericIDResult result = UPlayFabClientModelDecoder::decodeRemoveGenericIDResultResponse(response.responseData);
-        if (OnSuccessRemoveGenericID.IsBound())
+        FClientRemoveGenericIDResult result = UPlayFabClientModelDecoder::readRemoveGenericIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRemoveGenericID.Execute(result, mCustomData);
+            FDelegateOnSuccessRemoveGenericID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2600,33 +2388,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::ReportPlayer(FClientReportPlayerClientRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessReportPlayer = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperReportPlayer);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/ReportPlayer";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.ReporteeId.IsEmpty() || request.ReporteeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReporteeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReporteeId"), request.ReporteeId);
-    }
-    if (request.Comment.IsEmpty() || request.Comment == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Comment"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Comment"), request.Comment);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ReporteeId", request.ReporteeId);
+    Writer.WriteString("Comment", request.Comment);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2644,10 +2424,10 @@ void UPlayFabClientAPI::HelperReportPlayer(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientReportPlayerClientResult result = UPlayFabClientModelDecoder::decodeReportPlayerClientResultResponse(response.responseData);
-        if (OnSuccessReportPlayer.IsBound())
+        FClientReportPlayerClientResult result = UPlayFabClientModelDecoder::readReportPlayerClientResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessReportPlayer.Execute(result, mCustomData);
+            FDelegateOnSuccessReportPlayer(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2659,29 +2439,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::SendAccountRecoveryEmail(FClientSendAccoun
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSendAccountRecoveryEmail = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperSendAccountRecoveryEmail);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/SendAccountRecoveryEmail";
     manager->useSessionTicket = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Email", request.Email);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2699,10 +2475,10 @@ void UPlayFabClientAPI::HelperSendAccountRecoveryEmail(FPlayFabBaseModel respons
     }
     else
     {
-        FClientSendAccountRecoveryEmailResult result = UPlayFabClientModelDecoder::decodeSendAccountRecoveryEmailResultResponse(response.responseData);
-        if (OnSuccessSendAccountRecoveryEmail.IsBound())
+        FClientSendAccountRecoveryEmailResult result = UPlayFabClientModelDecoder::readSendAccountRecoveryEmailResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSendAccountRecoveryEmail.Execute(result, mCustomData);
+            FDelegateOnSuccessSendAccountRecoveryEmail(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2714,28 +2490,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkAndroidDeviceID(FClientUnlinkAndroid
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkAndroidDeviceID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkAndroidDeviceID);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UnlinkAndroidDeviceID";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.AndroidDeviceId.IsEmpty() || request.AndroidDeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDeviceId"), request.AndroidDeviceId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AndroidDeviceId", request.AndroidDeviceId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2753,10 +2526,10 @@ void UPlayFabClientAPI::HelperUnlinkAndroidDeviceID(FPlayFabBaseModel response,
     }
     else
     {
-        FClientUnlinkAndroidDeviceIDResult result = UPlayFabClientModelDecoder::decodeUnlinkAndroidDeviceIDResultResponse(response.responseData);
-        if (OnSuccessUnlinkAndroidDeviceID.IsBound())
+        FClientUnlinkAndroidDeviceIDResult result = UPlayFabClientModelDecoder::readUnlinkAndroidDeviceIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkAndroidDeviceID.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkAndroidDeviceID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2768,28 +2541,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkCustomID(FClientUnlinkCustomIDReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkCustomID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkCustomID);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UnlinkCustomID";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.CustomId.IsEmpty() || request.CustomId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomId"), request.CustomId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CustomId", request.CustomId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2807,10 +2577,10 @@ void UPlayFabClientAPI::HelperUnlinkCustomID(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientUnlinkCustomIDResult result = UPlayFabClientModelDecoder::decodeUnlinkCustomIDResultResponse(response.responseData);
-        if (OnSuccessUnlinkCustomID.IsBound())
+        FClientUnlinkCustomIDResult result = UPlayFabClientModelDecoder::readUnlinkCustomIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkCustomID.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkCustomID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2822,23 +2592,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkFacebookAccount(FClientUnlinkFaceboo
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkFacebookAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkFacebookAccount);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UnlinkFacebookAccount";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2856,10 +2627,10 @@ void UPlayFabClientAPI::HelperUnlinkFacebookAccount(FPlayFabBaseModel response,
     }
     else
     {
-        FClientUnlinkFacebookAccountResult result = UPlayFabClientModelDecoder::decodeUnlinkFacebookAccountResultResponse(response.responseData);
-        if (OnSuccessUnlinkFacebookAccount.IsBound())
+        FClientUnlinkFacebookAccountResult result = UPlayFabClientModelDecoder::readUnlinkFacebookAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkFacebookAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkFacebookAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2871,23 +2642,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkGameCenterAccount(FClientUnlinkGameC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkGameCenterAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkGameCenterAccount);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UnlinkGameCenterAccount";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2905,10 +2677,10 @@ void UPlayFabClientAPI::HelperUnlinkGameCenterAccount(FPlayFabBaseModel response
     }
     else
     {
-        FClientUnlinkGameCenterAccountResult result = UPlayFabClientModelDecoder::decodeUnlinkGameCenterAccountResultResponse(response.responseData);
-        if (OnSuccessUnlinkGameCenterAccount.IsBound())
+        FClientUnlinkGameCenterAccountResult result = UPlayFabClientModelDecoder::readUnlinkGameCenterAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkGameCenterAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkGameCenterAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2920,23 +2692,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkGoogleAccount(FClientUnlinkGoogleAcc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkGoogleAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkGoogleAccount);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UnlinkGoogleAccount";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2954,10 +2727,10 @@ void UPlayFabClientAPI::HelperUnlinkGoogleAccount(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientUnlinkGoogleAccountResult result = UPlayFabClientModelDecoder::decodeUnlinkGoogleAccountResultResponse(response.responseData);
-        if (OnSuccessUnlinkGoogleAccount.IsBound())
+        FClientUnlinkGoogleAccountResult result = UPlayFabClientModelDecoder::readUnlinkGoogleAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkGoogleAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkGoogleAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2969,28 +2742,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkIOSDeviceID(FClientUnlinkIOSDeviceID
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkIOSDeviceID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkIOSDeviceID);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UnlinkIOSDeviceID";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.DeviceId.IsEmpty() || request.DeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceId"), request.DeviceId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("DeviceId", request.DeviceId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3008,10 +2778,10 @@ void UPlayFabClientAPI::HelperUnlinkIOSDeviceID(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientUnlinkIOSDeviceIDResult result = UPlayFabClientModelDecoder::decodeUnlinkIOSDeviceIDResultResponse(response.responseData);
-        if (OnSuccessUnlinkIOSDeviceID.IsBound())
+        FClientUnlinkIOSDeviceIDResult result = UPlayFabClientModelDecoder::readUnlinkIOSDeviceIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkIOSDeviceID.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkIOSDeviceID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3023,23 +2793,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkKongregate(FClientUnlinkKongregateAc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkKongregate = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkKongregate);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UnlinkKongregate";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3057,10 +2828,10 @@ void UPlayFabClientAPI::HelperUnlinkKongregate(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientUnlinkKongregateAccountResult result = UPlayFabClientModelDecoder::decodeUnlinkKongregateAccountResultResponse(response.responseData);
-        if (OnSuccessUnlinkKongregate.IsBound())
+        FClientUnlinkKongregateAccountResult result = UPlayFabClientModelDecoder::readUnlinkKongregateAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkKongregate.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkKongregate(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3072,23 +2843,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkSteamAccount(FClientUnlinkSteamAccou
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkSteamAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkSteamAccount);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UnlinkSteamAccount";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3106,10 +2878,10 @@ void UPlayFabClientAPI::HelperUnlinkSteamAccount(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FClientUnlinkSteamAccountResult result = UPlayFabClientModelDecoder::decodeUnlinkSteamAccountResultResponse(response.responseData);
-        if (OnSuccessUnlinkSteamAccount.IsBound())
+        FClientUnlinkSteamAccountResult result = UPlayFabClientModelDecoder::readUnlinkSteamAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkSteamAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkSteamAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3121,23 +2893,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkTwitch(FClientUnlinkTwitchAccountReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkTwitch = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkTwitch);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UnlinkTwitch";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3155,10 +2928,10 @@ void UPlayFabClientAPI::HelperUnlinkTwitch(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientUnlinkTwitchAccountResult result = UPlayFabClientModelDecoder::decodeUnlinkTwitchAccountResultResponse(response.responseData);
-        if (OnSuccessUnlinkTwitch.IsBound())
+        FClientUnlinkTwitchAccountResult result = UPlayFabClientModelDecoder::readUnlinkTwitchAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkTwitch.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkTwitch(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3170,28 +2943,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkWindowsHello(FClientUnlinkWindowsHel
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkWindowsHello = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkWindowsHello);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UnlinkWindowsHello";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PublicKeyHint.IsEmpty() || request.PublicKeyHint == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKeyHint"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKeyHint"), request.PublicKeyHint);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PublicKeyHint", request.PublicKeyHint);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3209,10 +2979,10 @@ void UPlayFabClientAPI::HelperUnlinkWindowsHello(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FClientUnlinkWindowsHelloAccountResponse result = UPlayFabClientModelDecoder::decodeUnlinkWindowsHelloAccountResponseResponse(response.responseData);
-        if (OnSuccessUnlinkWindowsHello.IsBound())
+        FClientUnlinkWindowsHelloAccountResponse result = UPlayFabClientModelDecoder::readUnlinkWindowsHelloAccountResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkWindowsHello.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkWindowsHello(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3224,28 +2994,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateAvatarUrl(FClientUpdateAvatarUrlRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateAvatarUrl = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateAvatarUrl);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UpdateAvatarUrl";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.ImageUrl.IsEmpty() || request.ImageUrl == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ImageUrl"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ImageUrl"), request.ImageUrl);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ImageUrl", request.ImageUrl);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3263,10 +3029,10 @@ void UPlayFabClientAPI::HelperUpdateAvatarUrl(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientEmptyResult result = UPlayFabClientModelDecoder::decodeEmptyResultResponse(response.responseData);
-        if (OnSuccessUpdateAvatarUrl.IsBound())
+        FClientEmptyResult result = UPlayFabClientModelDecoder::readEmptyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateAvatarUrl.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateAvatarUrl(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3278,28 +3044,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserTitleDisplayName(FClientUpdateUs
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserTitleDisplayName = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateUserTitleDisplayName);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UpdateUserTitleDisplayName";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.DisplayName.IsEmpty() || request.DisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DisplayName"), request.DisplayName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("DisplayName", request.DisplayName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3317,10 +3079,10 @@ void UPlayFabClientAPI::HelperUpdateUserTitleDisplayName(FPlayFabBaseModel respo
     }
     else
     {
-        FClientUpdateUserTitleDisplayNameResult result = UPlayFabClientModelDecoder::decodeUpdateUserTitleDisplayNameResultResponse(response.responseData);
-        if (OnSuccessUpdateUserTitleDisplayName.IsBound())
+        FClientUpdateUserTitleDisplayNameResult result = UPlayFabClientModelDecoder::readUpdateUserTitleDisplayNameResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserTitleDisplayName.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserTitleDisplayName(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3336,35 +3098,33 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendLeaderboard(FClientGetFriendLeade
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetFriendLeaderboard = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetFriendLeaderboard);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetFriendLeaderboard";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("StartPosition", request.StartPosition);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteBool("IncludeSteamFriends", request.IncludeSteamFriends);
+    Writer.WriteBool("IncludeFacebookFriends", request.IncludeFacebookFriends);
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteBool("UseSpecificVersion", request.UseSpecificVersion);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3382,10 +3142,14 @@ void UPlayFabClientAPI::HelperGetFriendLeaderboard(FPlayFabBaseModel response, U
     }
     else
     {
-        FClientGetLeaderboardResult result = UPlayFabClientModelDecoder::decodeGetLeaderboardResultResponse(response.responseData);
-        if (OnSuccessGetFriendLeaderboard.IsBound())
+        FClientGetLeaderboardResult result = UPlayFabClientModelDecoder::readGetLeaderboardResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetLeaderboardResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetFriendLeaderboard.Execute(result, mCustomData);
+            FDelegateOnSuccessGetFriendLeaderboard(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3397,39 +3161,33 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(FClientGe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetFriendLeaderboardAroundPlayer = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetFriendLeaderboardAroundPlayer);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetFriendLeaderboardAroundPlayer";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteBool("IncludeSteamFriends", request.IncludeSteamFriends);
+    Writer.WriteBool("IncludeFacebookFriends", request.IncludeFacebookFriends);
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteBool("UseSpecificVersion", request.UseSpecificVersion);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3447,10 +3205,14 @@ void UPlayFabClientAPI::HelperGetFriendLeaderboardAroundPlayer(FPlayFabBaseModel
     }
     else
     {
-        FClientGetFriendLeaderboardAroundPlayerResult result = UPlayFabClientModelDecoder::decodeGetFriendLeaderboardAroundPlayerResultResponse(response.responseData);
-        if (OnSuccessGetFriendLeaderboardAroundPlayer.IsBound())
+        FClientGetFriendLeaderboardAroundPlayerResult result = UPlayFabClientModelDecoder::readGetFriendLeaderboardAroundPlayerResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetFriendLeaderboardAroundPlayerResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetFriendLeaderboardAroundPlayer.Execute(result, mCustomData);
+            FDelegateOnSuccessGetFriendLeaderboardAroundPlayer(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3462,33 +3224,31 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboard(FClientGetLeaderboardReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetLeaderboard = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetLeaderboard);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetLeaderboard";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("StartPosition", request.StartPosition);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteBool("UseSpecificVersion", request.UseSpecificVersion);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3506,10 +3266,14 @@ void UPlayFabClientAPI::HelperGetLeaderboard(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientGetLeaderboardResult result = UPlayFabClientModelDecoder::decodeGetLeaderboardResultResponse(response.responseData);
-        if (OnSuccessGetLeaderboard.IsBound())
+        FClientGetLeaderboardResult result = UPlayFabClientModelDecoder::readGetLeaderboardResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetLeaderboardResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetLeaderboard.Execute(result, mCustomData);
+            FDelegateOnSuccessGetLeaderboard(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3521,37 +3285,31 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardAroundPlayer(FClientGetLeade
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetLeaderboardAroundPlayer = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetLeaderboardAroundPlayer);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetLeaderboardAroundPlayer";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteBool("UseSpecificVersion", request.UseSpecificVersion);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3569,10 +3327,14 @@ void UPlayFabClientAPI::HelperGetLeaderboardAroundPlayer(FPlayFabBaseModel respo
     }
     else
     {
-        FClientGetLeaderboardAroundPlayerResult result = UPlayFabClientModelDecoder::decodeGetLeaderboardAroundPlayerResultResponse(response.responseData);
-        if (OnSuccessGetLeaderboardAroundPlayer.IsBound())
+        FClientGetLeaderboardAroundPlayerResult result = UPlayFabClientModelDecoder::readGetLeaderboardAroundPlayerResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetLeaderboardAroundPlayer.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetLeaderboardAroundPlayerResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetLeaderboardAroundPlayer(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3584,36 +3346,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerStatistics(FClientGetPlayerStatis
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerStatistics);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayerStatistics";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.StatisticNames.IsEmpty() || request.StatisticNames == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticNames"));
-    } else {
-        TArray<FString> StatisticNamesArray;
-        FString(request.StatisticNames).ParseIntoArray(StatisticNamesArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("StatisticNames"), StatisticNamesArray);
-    }
-    if (request.StatisticNameVersions.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticNameVersions"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("StatisticNameVersions"), request.StatisticNameVersions);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("StatisticNames", request.StatisticNames);
+    Writer.WriteObjectArray("StatisticNameVersions", request.StatisticNameVersions);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3631,10 +3384,14 @@ void UPlayFabClientAPI::HelperGetPlayerStatistics(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientGetPlayerStatisticsResult result = UPlayFabClientModelDecoder::decodeGetPlayerStatisticsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerStatistics.IsBound())
+        FClientGetPlayerStatisticsResult result = UPlayFabClientModelDecoder::readGetPlayerStatisticsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayerStatisticsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3646,28 +3403,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerStatisticVersions(FClientGetPlaye
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerStatisticVersions = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerStatisticVersions);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayerStatisticVersions";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3685,10 +3440,14 @@ void UPlayFabClientAPI::HelperGetPlayerStatisticVersions(FPlayFabBaseModel respo
     }
     else
     {
-        FClientGetPlayerStatisticVersionsResult result = UPlayFabClientModelDecoder::decodeGetPlayerStatisticVersionsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerStatisticVersions.IsBound())
+        FClientGetPlayerStatisticVersionsResult result = UPlayFabClientModelDecoder::readGetPlayerStatisticVersionsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayerStatisticVersionsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerStatisticVersions.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerStatisticVersions(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3700,37 +3459,28 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserData(FClientGetUserDataRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetUserData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetUserData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3748,10 +3498,14 @@ void UPlayFabClientAPI::HelperGetUserData(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FClientGetUserDataResult result = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserData.IsBound())
+        FClientGetUserDataResult result = UPlayFabClientModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3763,37 +3517,28 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserPublisherData(FClientGetUserDataReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetUserPublisherData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetUserPublisherData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3811,10 +3556,14 @@ void UPlayFabClientAPI::HelperGetUserPublisherData(FPlayFabBaseModel response, U
     }
     else
     {
-        FClientGetUserDataResult result = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserPublisherData.IsBound())
+        FClientGetUserDataResult result = UPlayFabClientModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserPublisherData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3826,37 +3575,28 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserPublisherReadOnlyData(FClientGetUse
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserPublisherReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetUserPublisherReadOnlyData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetUserPublisherReadOnlyData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3874,10 +3614,14 @@ void UPlayFabClientAPI::HelperGetUserPublisherReadOnlyData(FPlayFabBaseModel res
     }
     else
     {
-        FClientGetUserDataResult result = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserPublisherReadOnlyData.IsBound())
+        FClientGetUserDataResult result = UPlayFabClientModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetUserPublisherReadOnlyData.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetUserPublisherReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3889,37 +3633,28 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserReadOnlyData(FClientGetUserDataRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetUserReadOnlyData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetUserReadOnlyData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3937,10 +3672,14 @@ void UPlayFabClientAPI::HelperGetUserReadOnlyData(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientGetUserDataResult result = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserReadOnlyData.IsBound())
+        FClientGetUserDataResult result = UPlayFabClientModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserReadOnlyData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3952,28 +3691,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdatePlayerStatistics(FClientUpdatePlayer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdatePlayerStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdatePlayerStatistics);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UpdatePlayerStatistics";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Statistics.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Statistics"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Statistics"), request.Statistics);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("Statistics", request.Statistics);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3991,10 +3726,10 @@ void UPlayFabClientAPI::HelperUpdatePlayerStatistics(FPlayFabBaseModel response,
     }
     else
     {
-        FClientUpdatePlayerStatisticsResult result = UPlayFabClientModelDecoder::decodeUpdatePlayerStatisticsResultResponse(response.responseData);
-        if (OnSuccessUpdatePlayerStatistics.IsBound())
+        FClientUpdatePlayerStatisticsResult result = UPlayFabClientModelDecoder::readUpdatePlayerStatisticsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdatePlayerStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdatePlayerStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4006,35 +3741,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserData(FClientUpdateUserDataReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateUserData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UpdateUserData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4052,10 +3779,10 @@ void UPlayFabClientAPI::HelperUpdateUserData(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientUpdateUserDataResult result = UPlayFabClientModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserData.IsBound())
+        FClientUpdateUserDataResult result = UPlayFabClientModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4067,35 +3794,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserPublisherData(FClientUpdateUserD
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateUserPublisherData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UpdateUserPublisherData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4113,10 +3832,10 @@ void UPlayFabClientAPI::HelperUpdateUserPublisherData(FPlayFabBaseModel response
     }
     else
     {
-        FClientUpdateUserDataResult result = UPlayFabClientModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserPublisherData.IsBound())
+        FClientUpdateUserDataResult result = UPlayFabClientModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserPublisherData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4132,28 +3851,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCatalogItems(FClientGetCatalogItemsRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCatalogItems = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCatalogItems);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetCatalogItems";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4171,10 +3888,14 @@ void UPlayFabClientAPI::HelperGetCatalogItems(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientGetCatalogItemsResult result = UPlayFabClientModelDecoder::decodeGetCatalogItemsResultResponse(response.responseData);
-        if (OnSuccessGetCatalogItems.IsBound())
+        FClientGetCatalogItemsResult result = UPlayFabClientModelDecoder::readGetCatalogItemsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetCatalogItemsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCatalogItems.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCatalogItems(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4186,31 +3907,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPublisherData(FClientGetPublisherDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPublisherData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPublisherData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4228,10 +3944,14 @@ void UPlayFabClientAPI::HelperGetPublisherData(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientGetPublisherDataResult result = UPlayFabClientModelDecoder::decodeGetPublisherDataResultResponse(response.responseData);
-        if (OnSuccessGetPublisherData.IsBound())
+        FClientGetPublisherDataResult result = UPlayFabClientModelDecoder::readGetPublisherDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetPublisherData.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetPublisherDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4243,33 +3963,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetStoreItems(FClientGetStoreItemsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetStoreItems = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetStoreItems);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetStoreItems";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("StoreId", request.StoreId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4287,10 +4001,14 @@ void UPlayFabClientAPI::HelperGetStoreItems(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientGetStoreItemsResult result = UPlayFabClientModelDecoder::decodeGetStoreItemsResultResponse(response.responseData);
-        if (OnSuccessGetStoreItems.IsBound())
+        FClientGetStoreItemsResult result = UPlayFabClientModelDecoder::readGetStoreItemsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetStoreItems.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetStoreItemsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetStoreItems(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4302,23 +4020,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTime(FClientGetTimeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTime = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetTime);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetTime";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4336,10 +4056,10 @@ void UPlayFabClientAPI::HelperGetTime(FPlayFabBaseModel response, UObject* custo
     }
     else
     {
-        FClientGetTimeResult result = UPlayFabClientModelDecoder::decodeGetTimeResultResponse(response.responseData);
-        if (OnSuccessGetTime.IsBound())
+        FClientGetTimeResult result = UPlayFabClientModelDecoder::readGetTimeResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTime.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTime(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4351,31 +4071,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitleData(FClientGetTitleDataRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTitleData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetTitleData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetTitleData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4393,10 +4108,14 @@ void UPlayFabClientAPI::HelperGetTitleData(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientGetTitleDataResult result = UPlayFabClientModelDecoder::decodeGetTitleDataResultResponse(response.responseData);
-        if (OnSuccessGetTitleData.IsBound())
+        FClientGetTitleDataResult result = UPlayFabClientModelDecoder::readGetTitleDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetTitleDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTitleData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTitleData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4408,24 +4127,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitleNews(FClientGetTitleNewsRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTitleNews = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetTitleNews);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetTitleNews";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Count"), request.Count);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteNumber("Count", request.Count);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4443,10 +4164,14 @@ void UPlayFabClientAPI::HelperGetTitleNews(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientGetTitleNewsResult result = UPlayFabClientModelDecoder::decodeGetTitleNewsResultResponse(response.responseData);
-        if (OnSuccessGetTitleNews.IsBound())
+        FClientGetTitleNewsResult result = UPlayFabClientModelDecoder::readGetTitleNewsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetTitleNewsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTitleNews.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTitleNews(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4462,29 +4187,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddUserVirtualCurrency(FClientAddUserVirtu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddUserVirtualCurrency = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAddUserVirtualCurrency);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/AddUserVirtualCurrency";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("VirtualCurrency", request.VirtualCurrency);
+    Writer.WriteNumber("Amount", request.Amount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4502,10 +4223,10 @@ void UPlayFabClientAPI::HelperAddUserVirtualCurrency(FPlayFabBaseModel response,
     }
     else
     {
-        FClientModifyUserVirtualCurrencyResult result = UPlayFabClientModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
-        if (OnSuccessAddUserVirtualCurrency.IsBound())
+        FClientModifyUserVirtualCurrencyResult result = UPlayFabClientModelDecoder::readModifyUserVirtualCurrencyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddUserVirtualCurrency.Execute(result, mCustomData);
+            FDelegateOnSuccessAddUserVirtualCurrency(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4517,28 +4238,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConfirmPurchase(FClientConfirmPurchaseRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessConfirmPurchase = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperConfirmPurchase);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/ConfirmPurchase";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("OrderId", request.OrderId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4556,10 +4273,14 @@ void UPlayFabClientAPI::HelperConfirmPurchase(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientConfirmPurchaseResult result = UPlayFabClientModelDecoder::decodeConfirmPurchaseResultResponse(response.responseData);
-        if (OnSuccessConfirmPurchase.IsBound())
+        FClientConfirmPurchaseResult result = UPlayFabClientModelDecoder::readConfirmPurchaseResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillConfirmPurchaseResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessConfirmPurchase.Execute(result, mCustomData);
+            FDelegateOnSuccessConfirmPurchase(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4571,34 +4292,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumeItem(FClientConsumeItemRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessConsumeItem = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperConsumeItem);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/ConsumeItem";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("ConsumeCount"), request.ConsumeCount);
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ItemInstanceId", request.ItemInstanceId);
+    Writer.WriteNumber("ConsumeCount", request.ConsumeCount);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4616,10 +4329,10 @@ void UPlayFabClientAPI::HelperConsumeItem(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FClientConsumeItemResult result = UPlayFabClientModelDecoder::decodeConsumeItemResultResponse(response.responseData);
-        if (OnSuccessConsumeItem.IsBound())
+        FClientConsumeItemResult result = UPlayFabClientModelDecoder::readConsumeItemResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessConsumeItem.Execute(result, mCustomData);
+            FDelegateOnSuccessConsumeItem(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4631,33 +4344,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterInventory(FClientGetCharacterI
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterInventory = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCharacterInventory);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetCharacterInventory";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4675,10 +4382,14 @@ void UPlayFabClientAPI::HelperGetCharacterInventory(FPlayFabBaseModel response,
     }
     else
     {
-        FClientGetCharacterInventoryResult result = UPlayFabClientModelDecoder::decodeGetCharacterInventoryResultResponse(response.responseData);
-        if (OnSuccessGetCharacterInventory.IsBound())
+        FClientGetCharacterInventoryResult result = UPlayFabClientModelDecoder::readGetCharacterInventoryResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetCharacterInventoryResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCharacterInventory.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCharacterInventory(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4690,28 +4401,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPurchase(FClientGetPurchaseRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPurchase = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPurchase);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPurchase";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("OrderId", request.OrderId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4729,10 +4438,10 @@ void UPlayFabClientAPI::HelperGetPurchase(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FClientGetPurchaseResult result = UPlayFabClientModelDecoder::decodeGetPurchaseResultResponse(response.responseData);
-        if (OnSuccessGetPurchase.IsBound())
+        FClientGetPurchaseResult result = UPlayFabClientModelDecoder::readGetPurchaseResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPurchase.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPurchase(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4744,23 +4453,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserInventory(FClientGetUserInventoryRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserInventory = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetUserInventory);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetUserInventory";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4778,10 +4489,14 @@ void UPlayFabClientAPI::HelperGetUserInventory(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientGetUserInventoryResult result = UPlayFabClientModelDecoder::decodeGetUserInventoryResultResponse(response.responseData);
-        if (OnSuccessGetUserInventory.IsBound())
+        FClientGetUserInventoryResult result = UPlayFabClientModelDecoder::readGetUserInventoryResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetUserInventory.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetUserInventoryResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetUserInventory(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4793,43 +4508,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::PayForPurchase(FClientPayForPurchaseReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessPayForPurchase = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperPayForPurchase);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/PayForPurchase";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
-    if (request.ProviderName.IsEmpty() || request.ProviderName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ProviderName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ProviderName"), request.ProviderName);
-    }
-    if (request.Currency.IsEmpty() || request.Currency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Currency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Currency"), request.Currency);
-    }
-    if (request.ProviderTransactionId.IsEmpty() || request.ProviderTransactionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ProviderTransactionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ProviderTransactionId"), request.ProviderTransactionId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("OrderId", request.OrderId);
+    Writer.WriteString("ProviderName", request.ProviderName);
+    Writer.WriteString("Currency", request.Currency);
+    Writer.WriteString("ProviderTransactionId", request.ProviderTransactionId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4847,10 +4546,14 @@ void UPlayFabClientAPI::HelperPayForPurchase(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientPayForPurchaseResult result = UPlayFabClientModelDecoder::decodePayForPurchaseResultResponse(response.responseData);
-        if (OnSuccessPayForPurchase.IsBound())
+        FClientPayForPurchaseResult result = UPlayFabClientModelDecoder::readPayForPurchaseResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessPayForPurchase.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillPayForPurchaseResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessPayForPurchase(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4862,49 +4565,29 @@ UPlayFabClientAPI* UPlayFabClientAPI::PurchaseItem(FClientPurchaseItemRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessPurchaseItem = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperPurchaseItem);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/PurchaseItem";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.ItemId.IsEmpty() || request.ItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemId"), request.ItemId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Price"), request.Price);
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ItemId", request.ItemId);
+    Writer.WriteString("VirtualCurrency", request.VirtualCurrency);
+    Writer.WriteNumber("Price", request.Price);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("StoreId", request.StoreId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4922,10 +4605,14 @@ void UPlayFabClientAPI::HelperPurchaseItem(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientPurchaseItemResult result = UPlayFabClientModelDecoder::decodePurchaseItemResultResponse(response.responseData);
-        if (OnSuccessPurchaseItem.IsBound())
+        FClientPurchaseItemResult result = UPlayFabClientModelDecoder::readPurchaseItemResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillPurchaseItemResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessPurchaseItem.Execute(result, mCustomData);
+            FDelegateOnSuccessPurchaseItem(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4937,38 +4624,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::RedeemCoupon(FClientRedeemCouponRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRedeemCoupon = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRedeemCoupon);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/RedeemCoupon";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.CouponCode.IsEmpty() || request.CouponCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CouponCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CouponCode"), request.CouponCode);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CouponCode", request.CouponCode);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4986,10 +4661,14 @@ void UPlayFabClientAPI::HelperRedeemCoupon(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientRedeemCouponResult result = UPlayFabClientModelDecoder::decodeRedeemCouponResultResponse(response.responseData);
-        if (OnSuccessRedeemCoupon.IsBound())
+        FClientRedeemCouponResult result = UPlayFabClientModelDecoder::readRedeemCouponResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessRedeemCoupon.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillRedeemCouponResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessRedeemCoupon(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5001,38 +4680,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::StartPurchase(FClientStartPurchaseRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessStartPurchase = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperStartPurchase);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/StartPurchase";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
-    if (request.Items.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Items"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Items"), request.Items);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("StoreId", request.StoreId);
+    Writer.WriteObjectArray("Items", request.Items);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5050,10 +4717,14 @@ void UPlayFabClientAPI::HelperStartPurchase(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientStartPurchaseResult result = UPlayFabClientModelDecoder::decodeStartPurchaseResultResponse(response.responseData);
-        if (OnSuccessStartPurchase.IsBound())
+        FClientStartPurchaseResult result = UPlayFabClientModelDecoder::readStartPurchaseResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessStartPurchase.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillStartPurchaseResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessStartPurchase(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5065,29 +4736,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::SubtractUserVirtualCurrency(FClientSubtrac
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSubtractUserVirtualCurrency = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperSubtractUserVirtualCurrency);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/SubtractUserVirtualCurrency";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("VirtualCurrency", request.VirtualCurrency);
+    Writer.WriteNumber("Amount", request.Amount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5105,10 +4772,10 @@ void UPlayFabClientAPI::HelperSubtractUserVirtualCurrency(FPlayFabBaseModel resp
     }
     else
     {
-        FClientModifyUserVirtualCurrencyResult result = UPlayFabClientModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
-        if (OnSuccessSubtractUserVirtualCurrency.IsBound())
+        FClientModifyUserVirtualCurrencyResult result = UPlayFabClientModelDecoder::readModifyUserVirtualCurrencyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSubtractUserVirtualCurrency.Execute(result, mCustomData);
+            FDelegateOnSuccessSubtractUserVirtualCurrency(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5120,43 +4787,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlockContainerInstance(FClientUnlockConta
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlockContainerInstance = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlockContainerInstance);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UnlockContainerInstance";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ContainerItemInstanceId.IsEmpty() || request.ContainerItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContainerItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContainerItemInstanceId"), request.ContainerItemInstanceId);
-    }
-    if (request.KeyItemInstanceId.IsEmpty() || request.KeyItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeyItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("KeyItemInstanceId"), request.KeyItemInstanceId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("ContainerItemInstanceId", request.ContainerItemInstanceId);
+    Writer.WriteString("KeyItemInstanceId", request.KeyItemInstanceId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5174,10 +4825,14 @@ void UPlayFabClientAPI::HelperUnlockContainerInstance(FPlayFabBaseModel response
     }
     else
     {
-        FClientUnlockContainerItemResult result = UPlayFabClientModelDecoder::decodeUnlockContainerItemResultResponse(response.responseData);
-        if (OnSuccessUnlockContainerInstance.IsBound())
+        FClientUnlockContainerItemResult result = UPlayFabClientModelDecoder::readUnlockContainerItemResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessUnlockContainerInstance.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillUnlockContainerItemResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessUnlockContainerInstance(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5189,38 +4844,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlockContainerItem(FClientUnlockContainer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlockContainerItem = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlockContainerItem);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UnlockContainerItem";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.ContainerItemId.IsEmpty() || request.ContainerItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContainerItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContainerItemId"), request.ContainerItemId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ContainerItemId", request.ContainerItemId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5238,10 +4881,14 @@ void UPlayFabClientAPI::HelperUnlockContainerItem(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientUnlockContainerItemResult result = UPlayFabClientModelDecoder::decodeUnlockContainerItemResultResponse(response.responseData);
-        if (OnSuccessUnlockContainerItem.IsBound())
+        FClientUnlockContainerItemResult result = UPlayFabClientModelDecoder::readUnlockContainerItemResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillUnlockContainerItemResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlockContainerItem.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlockContainerItem(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5257,43 +4904,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddFriend(FClientAddFriendRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddFriend = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAddFriend);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/AddFriend";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-    if (request.FriendUsername.IsEmpty() || request.FriendUsername == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendUsername"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendUsername"), request.FriendUsername);
-    }
-    if (request.FriendEmail.IsEmpty() || request.FriendEmail == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendEmail"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendEmail"), request.FriendEmail);
-    }
-    if (request.FriendTitleDisplayName.IsEmpty() || request.FriendTitleDisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendTitleDisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendTitleDisplayName"), request.FriendTitleDisplayName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("FriendPlayFabId", request.FriendPlayFabId);
+    Writer.WriteString("FriendUsername", request.FriendUsername);
+    Writer.WriteString("FriendEmail", request.FriendEmail);
+    Writer.WriteString("FriendTitleDisplayName", request.FriendTitleDisplayName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5311,10 +4942,10 @@ void UPlayFabClientAPI::HelperAddFriend(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FClientAddFriendResult result = UPlayFabClientModelDecoder::decodeAddFriendResultResponse(response.responseData);
-        if (OnSuccessAddFriend.IsBound())
+        FClientAddFriendResult result = UPlayFabClientModelDecoder::readAddFriendResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddFriend.Execute(result, mCustomData);
+            FDelegateOnSuccessAddFriend(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5326,25 +4957,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendsList(FClientGetFriendsListReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetFriendsList = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetFriendsList);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetFriendsList";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteBool("IncludeSteamFriends", request.IncludeSteamFriends);
+    Writer.WriteBool("IncludeFacebookFriends", request.IncludeFacebookFriends);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5362,10 +4995,14 @@ void UPlayFabClientAPI::HelperGetFriendsList(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientGetFriendsListResult result = UPlayFabClientModelDecoder::decodeGetFriendsListResultResponse(response.responseData);
-        if (OnSuccessGetFriendsList.IsBound())
+        FClientGetFriendsListResult result = UPlayFabClientModelDecoder::readGetFriendsListResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetFriendsListResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetFriendsList.Execute(result, mCustomData);
+            FDelegateOnSuccessGetFriendsList(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5377,28 +5014,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveFriend(FClientRemoveFriendRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRemoveFriend = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRemoveFriend);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/RemoveFriend";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("FriendPlayFabId", request.FriendPlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5416,10 +5049,10 @@ void UPlayFabClientAPI::HelperRemoveFriend(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientRemoveFriendResult result = UPlayFabClientModelDecoder::decodeRemoveFriendResultResponse(response.responseData);
-        if (OnSuccessRemoveFriend.IsBound())
+        FClientRemoveFriendResult result = UPlayFabClientModelDecoder::readRemoveFriendResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRemoveFriend.Execute(result, mCustomData);
+            FDelegateOnSuccessRemoveFriend(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5431,36 +5064,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::SetFriendTags(FClientSetFriendTagsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetFriendTags = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperSetFriendTags);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/SetFriendTags";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Tags.IsEmpty() || request.Tags == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Tags"));
-    } else {
-        TArray<FString> TagsArray;
-        FString(request.Tags).ParseIntoArray(TagsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Tags"), TagsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("FriendPlayFabId", request.FriendPlayFabId);
+    Writer.WriteStringList("Tags", request.Tags);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5478,10 +5101,10 @@ void UPlayFabClientAPI::HelperSetFriendTags(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientSetFriendTagsResult result = UPlayFabClientModelDecoder::decodeSetFriendTagsResultResponse(response.responseData);
-        if (OnSuccessSetFriendTags.IsBound())
+        FClientSetFriendTagsResult result = UPlayFabClientModelDecoder::readSetFriendTagsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetFriendTags.Execute(result, mCustomData);
+            FDelegateOnSuccessSetFriendTags(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5497,42 +5120,30 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCurrentGames(FClientCurrentGamesRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCurrentGames = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCurrentGames);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetCurrentGames";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    FString temp_Region;
-    if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.TagFilter != nullptr) OutRestJsonObj->SetObjectField(TEXT("TagFilter"), request.TagFilter);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteEnum("Region", GetEnumName(request.Region));
+    Writer.WriteString("BuildVersion", request.BuildVersion);
+    Writer.WriteString("GameMode", request.GameMode);
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteObject("TagFilter", request.TagFilter);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5550,10 +5161,14 @@ void UPlayFabClientAPI::HelperGetCurrentGames(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientCurrentGamesResult result = UPlayFabClientModelDecoder::decodeCurrentGamesResultResponse(response.responseData);
-        if (OnSuccessGetCurrentGames.IsBound())
+        FClientCurrentGamesResult result = UPlayFabClientModelDecoder::readCurrentGamesResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillCurrentGamesResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCurrentGames.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCurrentGames(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5565,29 +5180,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetGameServerRegions(FClientGameServerRegi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetGameServerRegions = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetGameServerRegions);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetGameServerRegions";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildVersion", request.BuildVersion);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5605,10 +5218,14 @@ void UPlayFabClientAPI::HelperGetGameServerRegions(FPlayFabBaseModel response, U
     }
     else
     {
-        FClientGameServerRegionsResult result = UPlayFabClientModelDecoder::decodeGameServerRegionsResultResponse(response.responseData);
-        if (OnSuccessGetGameServerRegions.IsBound())
+        FClientGameServerRegionsResult result = UPlayFabClientModelDecoder::readGameServerRegionsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGameServerRegionsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetGameServerRegions.Execute(result, mCustomData);
+            FDelegateOnSuccessGetGameServerRegions(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5620,53 +5237,31 @@ UPlayFabClientAPI* UPlayFabClientAPI::Matchmake(FClientMatchmakeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessMatchmake = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperMatchmake);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/Matchmake";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    FString temp_Region;
-    if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("StartNewIfNoneFound"), request.StartNewIfNoneFound);
-    if (request.TagFilter != nullptr) OutRestJsonObj->SetObjectField(TEXT("TagFilter"), request.TagFilter);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildVersion", request.BuildVersion);
+    Writer.WriteEnum("Region", GetEnumName(request.Region));
+    Writer.WriteString("GameMode", request.GameMode);
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteBool("StartNewIfNoneFound", request.StartNewIfNoneFound);
+    Writer.WriteObject("TagFilter", request.TagFilter);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5684,10 +5279,10 @@ void UPlayFabClientAPI::HelperMatchmake(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FClientMatchmakeResult result = UPlayFabClientModelDecoder::decodeMatchmakeResultResponse(response.responseData);
-        if (OnSuccessMatchmake.IsBound())
+        FClientMatchmakeResult result = UPlayFabClientModelDecoder::readMatchmakeResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessMatchmake.Execute(result, mCustomData);
+            FDelegateOnSuccessMatchmake(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5699,51 +5294,29 @@ UPlayFabClientAPI* UPlayFabClientAPI::StartGame(FClientStartGameRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessStartGame = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperStartGame);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/StartGame";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    FString temp_Region;
-    if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomCommandLineData.IsEmpty() || request.CustomCommandLineData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomCommandLineData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomCommandLineData"), request.CustomCommandLineData);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildVersion", request.BuildVersion);
+    Writer.WriteEnum("Region", GetEnumName(request.Region));
+    Writer.WriteString("GameMode", request.GameMode);
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("CustomCommandLineData", request.CustomCommandLineData);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5761,10 +5334,10 @@ void UPlayFabClientAPI::HelperStartGame(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FClientStartGameResult result = UPlayFabClientModelDecoder::decodeStartGameResultResponse(response.responseData);
-        if (OnSuccessStartGame.IsBound())
+        FClientStartGameResult result = UPlayFabClientModelDecoder::readStartGameResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessStartGame.Execute(result, mCustomData);
+            FDelegateOnSuccessStartGame(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5780,39 +5353,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::WriteCharacterEvent(FClientWriteClientChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessWriteCharacterEvent = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperWriteCharacterEvent);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/WriteCharacterEvent";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("EventName", request.EventName);
+    Writer.WriteString("Timestamp", request.Timestamp);
+    Writer.WriteObject("Body", request.Body);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5830,10 +5391,10 @@ void UPlayFabClientAPI::HelperWriteCharacterEvent(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientWriteEventResponse result = UPlayFabClientModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        if (OnSuccessWriteCharacterEvent.IsBound())
+        FClientWriteEventResponse result = UPlayFabClientModelDecoder::readWriteEventResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessWriteCharacterEvent.Execute(result, mCustomData);
+            FDelegateOnSuccessWriteCharacterEvent(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5845,34 +5406,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::WritePlayerEvent(FClientWriteClientPlayerE
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessWritePlayerEvent = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperWritePlayerEvent);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/WritePlayerEvent";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("EventName", request.EventName);
+    Writer.WriteString("Timestamp", request.Timestamp);
+    Writer.WriteObject("Body", request.Body);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5890,10 +5443,10 @@ void UPlayFabClientAPI::HelperWritePlayerEvent(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientWriteEventResponse result = UPlayFabClientModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        if (OnSuccessWritePlayerEvent.IsBound())
+        FClientWriteEventResponse result = UPlayFabClientModelDecoder::readWriteEventResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessWritePlayerEvent.Execute(result, mCustomData);
+            FDelegateOnSuccessWritePlayerEvent(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5905,34 +5458,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::WriteTitleEvent(FClientWriteTitleEventRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessWriteTitleEvent = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperWriteTitleEvent);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/WriteTitleEvent";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("EventName", request.EventName);
+    Writer.WriteString("Timestamp", request.Timestamp);
+    Writer.WriteObject("Body", request.Body);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5950,10 +5495,10 @@ void UPlayFabClientAPI::HelperWriteTitleEvent(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientWriteEventResponse result = UPlayFabClientModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        if (OnSuccessWriteTitleEvent.IsBound())
+        FClientWriteEventResponse result = UPlayFabClientModelDecoder::readWriteEventResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessWriteTitleEvent.Execute(result, mCustomData);
+            FDelegateOnSuccessWriteTitleEvent(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5969,36 +5514,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddSharedGroupMembers(FClientAddSharedGrou
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddSharedGroupMembers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAddSharedGroupMembers);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/AddSharedGroupMembers";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-    // Check to see if string is empty
-    if (request.PlayFabIds.IsEmpty() || request.PlayFabIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIds"));
-    } else {
-        TArray<FString> PlayFabIdsArray;
-        FString(request.PlayFabIds).ParseIntoArray(PlayFabIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIds"), PlayFabIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteStringList("PlayFabIds", request.PlayFabIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6016,10 +5550,10 @@ void UPlayFabClientAPI::HelperAddSharedGroupMembers(FPlayFabBaseModel response,
     }
     else
     {
-        FClientAddSharedGroupMembersResult result = UPlayFabClientModelDecoder::decodeAddSharedGroupMembersResultResponse(response.responseData);
-        if (OnSuccessAddSharedGroupMembers.IsBound())
+        FClientAddSharedGroupMembersResult result = UPlayFabClientModelDecoder::readAddSharedGroupMembersResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddSharedGroupMembers.Execute(result, mCustomData);
+            FDelegateOnSuccessAddSharedGroupMembers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6031,28 +5565,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::CreateSharedGroup(FClientCreateSharedGroup
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessCreateSharedGroup = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperCreateSharedGroup);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/CreateSharedGroup";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6070,10 +5600,10 @@ void UPlayFabClientAPI::HelperCreateSharedGroup(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientCreateSharedGroupResult result = UPlayFabClientModelDecoder::decodeCreateSharedGroupResultResponse(response.responseData);
-        if (OnSuccessCreateSharedGroup.IsBound())
+        FClientCreateSharedGroupResult result = UPlayFabClientModelDecoder::readCreateSharedGroupResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessCreateSharedGroup.Execute(result, mCustomData);
+            FDelegateOnSuccessCreateSharedGroup(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6085,37 +5615,28 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetSharedGroupData(FClientGetSharedGroupDa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetSharedGroupData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetSharedGroupData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetSharedGroupData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("GetMembers"), request.GetMembers);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteBool("GetMembers", request.GetMembers);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6133,10 +5654,14 @@ void UPlayFabClientAPI::HelperGetSharedGroupData(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FClientGetSharedGroupDataResult result = UPlayFabClientModelDecoder::decodeGetSharedGroupDataResultResponse(response.responseData);
-        if (OnSuccessGetSharedGroupData.IsBound())
+        FClientGetSharedGroupDataResult result = UPlayFabClientModelDecoder::readGetSharedGroupDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetSharedGroupDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetSharedGroupData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetSharedGroupData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6148,36 +5673,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveSharedGroupMembers(FClientRemoveShar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRemoveSharedGroupMembers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRemoveSharedGroupMembers);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/RemoveSharedGroupMembers";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-    // Check to see if string is empty
-    if (request.PlayFabIds.IsEmpty() || request.PlayFabIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIds"));
-    } else {
-        TArray<FString> PlayFabIdsArray;
-        FString(request.PlayFabIds).ParseIntoArray(PlayFabIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIds"), PlayFabIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteStringList("PlayFabIds", request.PlayFabIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6195,10 +5709,10 @@ void UPlayFabClientAPI::HelperRemoveSharedGroupMembers(FPlayFabBaseModel respons
     }
     else
     {
-        FClientRemoveSharedGroupMembersResult result = UPlayFabClientModelDecoder::decodeRemoveSharedGroupMembersResultResponse(response.responseData);
-        if (OnSuccessRemoveSharedGroupMembers.IsBound())
+        FClientRemoveSharedGroupMembersResult result = UPlayFabClientModelDecoder::readRemoveSharedGroupMembersResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRemoveSharedGroupMembers.Execute(result, mCustomData);
+            FDelegateOnSuccessRemoveSharedGroupMembers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6210,40 +5724,28 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateSharedGroupData(FClientUpdateSharedG
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateSharedGroupData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateSharedGroupData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UpdateSharedGroupData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6261,10 +5763,10 @@ void UPlayFabClientAPI::HelperUpdateSharedGroupData(FPlayFabBaseModel response,
     }
     else
     {
-        FClientUpdateSharedGroupDataResult result = UPlayFabClientModelDecoder::decodeUpdateSharedGroupDataResultResponse(response.responseData);
-        if (OnSuccessUpdateSharedGroupData.IsBound())
+        FClientUpdateSharedGroupDataResult result = UPlayFabClientModelDecoder::readUpdateSharedGroupDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateSharedGroupData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateSharedGroupData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6280,34 +5782,28 @@ UPlayFabClientAPI* UPlayFabClientAPI::ExecuteCloudScript(FClientExecuteCloudScri
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessExecuteCloudScript = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperExecuteCloudScript);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/ExecuteCloudScript";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.FunctionName.IsEmpty() || request.FunctionName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FunctionName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FunctionName"), request.FunctionName);
-    }
-    if (request.FunctionParameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("FunctionParameter"), request.FunctionParameter);
-    FString temp_RevisionSelection;
-    if (GetEnumValueToString<ECloudScriptRevisionOption>(TEXT("ECloudScriptRevisionOption"), request.RevisionSelection, temp_RevisionSelection))
-        OutRestJsonObj->SetStringField(TEXT("RevisionSelection"), temp_RevisionSelection);
-    OutRestJsonObj->SetNumberField(TEXT("SpecificRevision"), request.SpecificRevision);
-    OutRestJsonObj->SetBoolField(TEXT("GeneratePlayStreamEvent"), request.GeneratePlayStreamEvent);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("FunctionName", request.FunctionName);
+    Writer.WriteObject("FunctionParameter", request.FunctionParameter);
+    Writer.WriteEnum("RevisionSelection", GetEnumName(request.RevisionSelection));
+    Writer.WriteNumber("SpecificRevision", request.SpecificRevision);
+    Writer.WriteBool("GeneratePlayStreamEvent", request.GeneratePlayStreamEvent);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6325,10 +5821,14 @@ void UPlayFabClientAPI::HelperExecuteCloudScript(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FClientExecuteCloudScriptResult result = UPlayFabClientModelDecoder::decodeExecuteCloudScriptResultResponse(response.responseData);
-        if (OnSuccessExecuteCloudScript.IsBound())
+        FClientExecuteCloudScriptResult result = UPlayFabClientModelDecoder::readExecuteCloudScriptResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessExecuteCloudScript.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillExecuteCloudScriptResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessExecuteCloudScript(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6344,34 +5844,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetContentDownloadUrl(FClientGetContentDow
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetContentDownloadUrl = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetContentDownloadUrl);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetContentDownloadUrl";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.HttpMethod.IsEmpty() || request.HttpMethod == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("HttpMethod"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("HttpMethod"), request.HttpMethod);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ThruCDN"), request.ThruCDN);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Key", request.Key);
+    Writer.WriteString("HttpMethod", request.HttpMethod);
+    Writer.WriteBool("ThruCDN", request.ThruCDN);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6389,10 +5882,10 @@ void UPlayFabClientAPI::HelperGetContentDownloadUrl(FPlayFabBaseModel response,
     }
     else
     {
-        FClientGetContentDownloadUrlResult result = UPlayFabClientModelDecoder::decodeGetContentDownloadUrlResultResponse(response.responseData);
-        if (OnSuccessGetContentDownloadUrl.IsBound())
+        FClientGetContentDownloadUrlResult result = UPlayFabClientModelDecoder::readGetContentDownloadUrlResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetContentDownloadUrl.Execute(result, mCustomData);
+            FDelegateOnSuccessGetContentDownloadUrl(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6408,28 +5901,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAllUsersCharacters(FClientListUsersChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetAllUsersCharacters = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetAllUsersCharacters);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetAllUsersCharacters";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6447,10 +5938,14 @@ void UPlayFabClientAPI::HelperGetAllUsersCharacters(FPlayFabBaseModel response,
     }
     else
     {
-        FClientListUsersCharactersResult result = UPlayFabClientModelDecoder::decodeListUsersCharactersResultResponse(response.responseData);
-        if (OnSuccessGetAllUsersCharacters.IsBound())
+        FClientListUsersCharactersResult result = UPlayFabClientModelDecoder::readListUsersCharactersResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetAllUsersCharacters.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillListUsersCharactersResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetAllUsersCharacters(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6462,35 +5957,29 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterLeaderboard(FClientGetCharacte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterLeaderboard = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCharacterLeaderboard);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetCharacterLeaderboard";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CharacterType.IsEmpty() || request.CharacterType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterType"), request.CharacterType);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterType", request.CharacterType);
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("StartPosition", request.StartPosition);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6508,10 +5997,14 @@ void UPlayFabClientAPI::HelperGetCharacterLeaderboard(FPlayFabBaseModel response
     }
     else
     {
-        FClientGetCharacterLeaderboardResult result = UPlayFabClientModelDecoder::decodeGetCharacterLeaderboardResultResponse(response.responseData);
-        if (OnSuccessGetCharacterLeaderboard.IsBound())
+        FClientGetCharacterLeaderboardResult result = UPlayFabClientModelDecoder::readGetCharacterLeaderboardResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetCharacterLeaderboard.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetCharacterLeaderboardResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetCharacterLeaderboard(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6523,28 +6016,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterStatistics(FClientGetCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCharacterStatistics);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetCharacterStatistics";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6562,10 +6053,14 @@ void UPlayFabClientAPI::HelperGetCharacterStatistics(FPlayFabBaseModel response,
     }
     else
     {
-        FClientGetCharacterStatisticsResult result = UPlayFabClientModelDecoder::decodeGetCharacterStatisticsResultResponse(response.responseData);
-        if (OnSuccessGetCharacterStatistics.IsBound())
+        FClientGetCharacterStatisticsResult result = UPlayFabClientModelDecoder::readGetCharacterStatisticsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetCharacterStatisticsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCharacterStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCharacterStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6577,39 +6072,29 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardAroundCharacter(FClientGetLe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetLeaderboardAroundCharacter = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetLeaderboardAroundCharacter);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetLeaderboardAroundCharacter";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CharacterType.IsEmpty() || request.CharacterType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterType"), request.CharacterType);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("CharacterType", request.CharacterType);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6627,10 +6112,14 @@ void UPlayFabClientAPI::HelperGetLeaderboardAroundCharacter(FPlayFabBaseModel re
     }
     else
     {
-        FClientGetLeaderboardAroundCharacterResult result = UPlayFabClientModelDecoder::decodeGetLeaderboardAroundCharacterResultResponse(response.responseData);
-        if (OnSuccessGetLeaderboardAroundCharacter.IsBound())
+        FClientGetLeaderboardAroundCharacterResult result = UPlayFabClientModelDecoder::readGetLeaderboardAroundCharacterResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetLeaderboardAroundCharacterResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetLeaderboardAroundCharacter.Execute(result, mCustomData);
+            FDelegateOnSuccessGetLeaderboardAroundCharacter(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6642,29 +6131,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardForUserCharacters(FClientGet
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetLeaderboardForUserCharacters = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetLeaderboardForUserCharacters);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetLeaderboardForUserCharacters";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6682,10 +6169,14 @@ void UPlayFabClientAPI::HelperGetLeaderboardForUserCharacters(FPlayFabBaseModel
     }
     else
     {
-        FClientGetLeaderboardForUsersCharactersResult result = UPlayFabClientModelDecoder::decodeGetLeaderboardForUsersCharactersResultResponse(response.responseData);
-        if (OnSuccessGetLeaderboardForUserCharacters.IsBound())
+        FClientGetLeaderboardForUsersCharactersResult result = UPlayFabClientModelDecoder::readGetLeaderboardForUsersCharactersResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetLeaderboardForUsersCharactersResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetLeaderboardForUserCharacters.Execute(result, mCustomData);
+            FDelegateOnSuccessGetLeaderboardForUserCharacters(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6697,38 +6188,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GrantCharacterToUser(FClientGrantCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGrantCharacterToUser = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGrantCharacterToUser);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GrantCharacterToUser";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.ItemId.IsEmpty() || request.ItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemId"), request.ItemId);
-    }
-    if (request.CharacterName.IsEmpty() || request.CharacterName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterName"), request.CharacterName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("ItemId", request.ItemId);
+    Writer.WriteString("CharacterName", request.CharacterName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6746,10 +6225,10 @@ void UPlayFabClientAPI::HelperGrantCharacterToUser(FPlayFabBaseModel response, U
     }
     else
     {
-        FClientGrantCharacterToUserResult result = UPlayFabClientModelDecoder::decodeGrantCharacterToUserResultResponse(response.responseData);
-        if (OnSuccessGrantCharacterToUser.IsBound())
+        FClientGrantCharacterToUserResult result = UPlayFabClientModelDecoder::readGrantCharacterToUserResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGrantCharacterToUser.Execute(result, mCustomData);
+            FDelegateOnSuccessGrantCharacterToUser(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6761,29 +6240,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateCharacterStatistics(FClientUpdateCha
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateCharacterStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateCharacterStatistics);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UpdateCharacterStatistics";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CharacterStatistics != nullptr) OutRestJsonObj->SetObjectField(TEXT("CharacterStatistics"), request.CharacterStatistics);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObject("CharacterStatistics", request.CharacterStatistics);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6801,10 +6276,10 @@ void UPlayFabClientAPI::HelperUpdateCharacterStatistics(FPlayFabBaseModel respon
     }
     else
     {
-        FClientUpdateCharacterStatisticsResult result = UPlayFabClientModelDecoder::decodeUpdateCharacterStatisticsResultResponse(response.responseData);
-        if (OnSuccessUpdateCharacterStatistics.IsBound())
+        FClientUpdateCharacterStatisticsResult result = UPlayFabClientModelDecoder::readUpdateCharacterStatisticsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateCharacterStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateCharacterStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6820,42 +6295,29 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterData(FClientGetCharacterDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCharacterData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetCharacterData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6873,10 +6335,14 @@ void UPlayFabClientAPI::HelperGetCharacterData(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientGetCharacterDataResult result = UPlayFabClientModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
-        if (OnSuccessGetCharacterData.IsBound())
+        FClientGetCharacterDataResult result = UPlayFabClientModelDecoder::readGetCharacterDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetCharacterDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCharacterData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCharacterData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6888,42 +6354,29 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterReadOnlyData(FClientGetCharact
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCharacterReadOnlyData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetCharacterReadOnlyData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6941,10 +6394,14 @@ void UPlayFabClientAPI::HelperGetCharacterReadOnlyData(FPlayFabBaseModel respons
     }
     else
     {
-        FClientGetCharacterDataResult result = UPlayFabClientModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
-        if (OnSuccessGetCharacterReadOnlyData.IsBound())
+        FClientGetCharacterDataResult result = UPlayFabClientModelDecoder::readGetCharacterDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetCharacterDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCharacterReadOnlyData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCharacterReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6956,40 +6413,28 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateCharacterData(FClientUpdateCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateCharacterData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateCharacterData);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/UpdateCharacterData";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7007,10 +6452,10 @@ void UPlayFabClientAPI::HelperUpdateCharacterData(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientUpdateCharacterDataResult result = UPlayFabClientModelDecoder::decodeUpdateCharacterDataResultResponse(response.responseData);
-        if (OnSuccessUpdateCharacterData.IsBound())
+        FClientUpdateCharacterDataResult result = UPlayFabClientModelDecoder::readUpdateCharacterDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateCharacterData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateCharacterData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7026,41 +6471,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::AcceptTrade(FClientAcceptTradeRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAcceptTrade = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAcceptTrade);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/AcceptTrade";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.OfferingPlayerId.IsEmpty() || request.OfferingPlayerId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OfferingPlayerId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OfferingPlayerId"), request.OfferingPlayerId);
-    }
-    if (request.TradeId.IsEmpty() || request.TradeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TradeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TradeId"), request.TradeId);
-    }
-    // Check to see if string is empty
-    if (request.AcceptedInventoryInstanceIds.IsEmpty() || request.AcceptedInventoryInstanceIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AcceptedInventoryInstanceIds"));
-    } else {
-        TArray<FString> AcceptedInventoryInstanceIdsArray;
-        FString(request.AcceptedInventoryInstanceIds).ParseIntoArray(AcceptedInventoryInstanceIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("AcceptedInventoryInstanceIds"), AcceptedInventoryInstanceIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("OfferingPlayerId", request.OfferingPlayerId);
+    Writer.WriteString("TradeId", request.TradeId);
+    Writer.WriteStringList("AcceptedInventoryInstanceIds", request.AcceptedInventoryInstanceIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7078,10 +6508,14 @@ void UPlayFabClientAPI::HelperAcceptTrade(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FClientAcceptTradeResponse result = UPlayFabClientModelDecoder::decodeAcceptTradeResponseResponse(response.responseData);
-        if (OnSuccessAcceptTrade.IsBound())
+        FClientAcceptTradeResponse result = UPlayFabClientModelDecoder::readAcceptTradeResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillAcceptTradeResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAcceptTrade.Execute(result, mCustomData);
+            FDelegateOnSuccessAcceptTrade(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7093,28 +6527,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::CancelTrade(FClientCancelTradeRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessCancelTrade = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperCancelTrade);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/CancelTrade";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.TradeId.IsEmpty() || request.TradeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TradeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TradeId"), request.TradeId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TradeId", request.TradeId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7132,10 +6562,14 @@ void UPlayFabClientAPI::HelperCancelTrade(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FClientCancelTradeResponse result = UPlayFabClientModelDecoder::decodeCancelTradeResponseResponse(response.responseData);
-        if (OnSuccessCancelTrade.IsBound())
+        FClientCancelTradeResponse result = UPlayFabClientModelDecoder::readCancelTradeResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessCancelTrade.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillCancelTradeResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessCancelTrade(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7147,26 +6581,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerTrades(FClientGetPlayerTradesRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerTrades = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerTrades);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayerTrades";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    FString temp_StatusFilter;
-    if (GetEnumValueToString<ETradeStatus>(TEXT("ETradeStatus"), request.StatusFilter, temp_StatusFilter))
-        OutRestJsonObj->SetStringField(TEXT("StatusFilter"), temp_StatusFilter);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteEnum("StatusFilter", GetEnumName(request.StatusFilter));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7184,10 +6618,14 @@ void UPlayFabClientAPI::HelperGetPlayerTrades(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientGetPlayerTradesResponse result = UPlayFabClientModelDecoder::decodeGetPlayerTradesResponseResponse(response.responseData);
-        if (OnSuccessGetPlayerTrades.IsBound())
+        FClientGetPlayerTradesResponse result = UPlayFabClientModelDecoder::readGetPlayerTradesResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetPlayerTrades.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetPlayerTradesResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetPlayerTrades(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7199,33 +6637,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTradeStatus(FClientGetTradeStatusReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTradeStatus = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetTradeStatus);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetTradeStatus";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.OfferingPlayerId.IsEmpty() || request.OfferingPlayerId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OfferingPlayerId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OfferingPlayerId"), request.OfferingPlayerId);
-    }
-    if (request.TradeId.IsEmpty() || request.TradeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TradeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TradeId"), request.TradeId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("OfferingPlayerId", request.OfferingPlayerId);
+    Writer.WriteString("TradeId", request.TradeId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7243,10 +6675,14 @@ void UPlayFabClientAPI::HelperGetTradeStatus(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientGetTradeStatusResponse result = UPlayFabClientModelDecoder::decodeGetTradeStatusResponseResponse(response.responseData);
-        if (OnSuccessGetTradeStatus.IsBound())
+        FClientGetTradeStatusResponse result = UPlayFabClientModelDecoder::readGetTradeStatusResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetTradeStatusResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTradeStatus.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTradeStatus(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7258,47 +6694,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::OpenTrade(FClientOpenTradeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessOpenTrade = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperOpenTrade);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/OpenTrade";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.OfferedInventoryInstanceIds.IsEmpty() || request.OfferedInventoryInstanceIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OfferedInventoryInstanceIds"));
-    } else {
-        TArray<FString> OfferedInventoryInstanceIdsArray;
-        FString(request.OfferedInventoryInstanceIds).ParseIntoArray(OfferedInventoryInstanceIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("OfferedInventoryInstanceIds"), OfferedInventoryInstanceIdsArray);
-    }
-    // Check to see if string is empty
-    if (request.RequestedCatalogItemIds.IsEmpty() || request.RequestedCatalogItemIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RequestedCatalogItemIds"));
-    } else {
-        TArray<FString> RequestedCatalogItemIdsArray;
-        FString(request.RequestedCatalogItemIds).ParseIntoArray(RequestedCatalogItemIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("RequestedCatalogItemIds"), RequestedCatalogItemIdsArray);
-    }
-    // Check to see if string is empty
-    if (request.AllowedPlayerIds.IsEmpty() || request.AllowedPlayerIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AllowedPlayerIds"));
-    } else {
-        TArray<FString> AllowedPlayerIdsArray;
-        FString(request.AllowedPlayerIds).ParseIntoArray(AllowedPlayerIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("AllowedPlayerIds"), AllowedPlayerIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("OfferedInventoryInstanceIds", request.OfferedInventoryInstanceIds);
+    Writer.WriteStringList("RequestedCatalogItemIds", request.RequestedCatalogItemIds);
+    Writer.WriteStringList("AllowedPlayerIds", request.AllowedPlayerIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7316,10 +6731,14 @@ void UPlayFabClientAPI::HelperOpenTrade(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FClientOpenTradeResponse result = UPlayFabClientModelDecoder::decodeOpenTradeResponseResponse(response.responseData);
-        if (OnSuccessOpenTrade.IsBound())
+        FClientOpenTradeResponse result = UPlayFabClientModelDecoder::readOpenTradeResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillOpenTradeResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessOpenTrade.Execute(result, mCustomData);
+            FDelegateOnSuccessOpenTrade(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7335,33 +6754,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::AttributeInstall(FClientAttributeInstallRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAttributeInstall = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAttributeInstall);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/AttributeInstall";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.Idfa.IsEmpty() || request.Idfa == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Idfa"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Idfa"), request.Idfa);
-    }
-    if (request.Adid.IsEmpty() || request.Adid == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Adid"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Adid"), request.Adid);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Idfa", request.Idfa);
+    Writer.WriteString("Adid", request.Adid);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7379,10 +6790,10 @@ void UPlayFabClientAPI::HelperAttributeInstall(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientAttributeInstallResult result = UPlayFabClientModelDecoder::decodeAttributeInstallResultResponse(response.responseData);
-        if (OnSuccessAttributeInstall.IsBound())
+        FClientAttributeInstallResult result = UPlayFabClientModelDecoder::readAttributeInstallResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAttributeInstall.Execute(result, mCustomData);
+            FDelegateOnSuccessAttributeInstall(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7402,23 +6813,25 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerSegments(FClientGetPlayerSegments
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerSegments = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerSegments);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayerSegments";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7436,10 +6849,14 @@ void UPlayFabClientAPI::HelperGetPlayerSegments(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientGetPlayerSegmentsResult result = UPlayFabClientModelDecoder::decodeGetPlayerSegmentsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerSegments.IsBound())
+        FClientGetPlayerSegmentsResult result = UPlayFabClientModelDecoder::readGetPlayerSegmentsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayerSegmentsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerSegments.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerSegments(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7451,33 +6868,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerTags(FClientGetPlayerTagsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerTags = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerTags);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/GetPlayerTags";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Namespace.IsEmpty() || request.Namespace == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Namespace"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Namespace"), request.Namespace);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("Namespace", request.Namespace);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7495,10 +6906,10 @@ void UPlayFabClientAPI::HelperGetPlayerTags(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientGetPlayerTagsResult result = UPlayFabClientModelDecoder::decodeGetPlayerTagsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerTags.IsBound())
+        FClientGetPlayerTagsResult result = UPlayFabClientModelDecoder::readGetPlayerTagsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerTags.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerTags(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7514,34 +6925,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAndroidDevicePushNotificationRegistration = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAndroidDevicePushNotificationRegistration);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/AndroidDevicePushNotificationRegistration";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.DeviceToken.IsEmpty() || request.DeviceToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceToken"), request.DeviceToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("SendPushNotificationConfirmation"), request.SendPushNotificationConfirmation);
-    if (request.ConfirmationMessage.IsEmpty() || request.ConfirmationMessage == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConfirmationMessage"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConfirmationMessage"), request.ConfirmationMessage);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("DeviceToken", request.DeviceToken);
+    Writer.WriteBool("SendPushNotificationConfirmation", request.SendPushNotificationConfirmation);
+    Writer.WriteString("ConfirmationMessage", request.ConfirmationMessage);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7559,10 +6962,10 @@ void UPlayFabClientAPI::HelperAndroidDevicePushNotificationRegistration(FPlayFab
     }
     else
     {
-        FClientAndroidDevicePushNotificationRegistrationResult result = UPlayFabClientModelDecoder::decodeAndroidDevicePushNotificationRegistrationResultResponse(response.responseData);
-        if (OnSuccessAndroidDevicePushNotificationRegistration.IsBound())
+        FClientAndroidDevicePushNotificationRegistrationResult result = UPlayFabClientModelDecoder::readAndroidDevicePushNotificationRegistrationResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAndroidDevicePushNotificationRegistration.Execute(result, mCustomData);
+            FDelegateOnSuccessAndroidDevicePushNotificationRegistration(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7574,34 +6977,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterForIOSPushNotification(FClientRegi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRegisterForIOSPushNotification = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRegisterForIOSPushNotification);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/RegisterForIOSPushNotification";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.DeviceToken.IsEmpty() || request.DeviceToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceToken"), request.DeviceToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("SendPushNotificationConfirmation"), request.SendPushNotificationConfirmation);
-    if (request.ConfirmationMessage.IsEmpty() || request.ConfirmationMessage == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConfirmationMessage"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConfirmationMessage"), request.ConfirmationMessage);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("DeviceToken", request.DeviceToken);
+    Writer.WriteBool("SendPushNotificationConfirmation", request.SendPushNotificationConfirmation);
+    Writer.WriteString("ConfirmationMessage", request.ConfirmationMessage);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7619,10 +7014,10 @@ void UPlayFabClientAPI::HelperRegisterForIOSPushNotification(FPlayFabBaseModel r
     }
     else
     {
-        FClientRegisterForIOSPushNotificationResult result = UPlayFabClientModelDecoder::decodeRegisterForIOSPushNotificationResultResponse(response.responseData);
-        if (OnSuccessRegisterForIOSPushNotification.IsBound())
+        FClientRegisterForIOSPushNotificationResult result = UPlayFabClientModelDecoder::readRegisterForIOSPushNotificationResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRegisterForIOSPushNotification.Execute(result, mCustomData);
+            FDelegateOnSuccessRegisterForIOSPushNotification(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7634,28 +7029,24 @@ UPlayFabClientAPI* UPlayFabClientAPI::RestoreIOSPurchases(FClientRestoreIOSPurch
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRestoreIOSPurchases = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRestoreIOSPurchases);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/RestoreIOSPurchases";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.ReceiptData.IsEmpty() || request.ReceiptData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceiptData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceiptData"), request.ReceiptData);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ReceiptData", request.ReceiptData);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7673,10 +7064,10 @@ void UPlayFabClientAPI::HelperRestoreIOSPurchases(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientRestoreIOSPurchasesResult result = UPlayFabClientModelDecoder::decodeRestoreIOSPurchasesResultResponse(response.responseData);
-        if (OnSuccessRestoreIOSPurchases.IsBound())
+        FClientRestoreIOSPurchasesResult result = UPlayFabClientModelDecoder::readRestoreIOSPurchasesResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRestoreIOSPurchases.Execute(result, mCustomData);
+            FDelegateOnSuccessRestoreIOSPurchases(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7688,44 +7079,28 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateAmazonIAPReceipt(FClientValidateAm
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessValidateAmazonIAPReceipt = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperValidateAmazonIAPReceipt);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/ValidateAmazonIAPReceipt";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.ReceiptId.IsEmpty() || request.ReceiptId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceiptId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceiptId"), request.ReceiptId);
-    }
-    if (request.UserId.IsEmpty() || request.UserId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("UserId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("UserId"), request.UserId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CurrencyCode.IsEmpty() || request.CurrencyCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CurrencyCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CurrencyCode"), request.CurrencyCode);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("PurchasePrice"), request.PurchasePrice);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ReceiptId", request.ReceiptId);
+    Writer.WriteString("UserId", request.UserId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("CurrencyCode", request.CurrencyCode);
+    Writer.WriteNumber("PurchasePrice", request.PurchasePrice);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7743,10 +7118,10 @@ void UPlayFabClientAPI::HelperValidateAmazonIAPReceipt(FPlayFabBaseModel respons
     }
     else
     {
-        FClientValidateAmazonReceiptResult result = UPlayFabClientModelDecoder::decodeValidateAmazonReceiptResultResponse(response.responseData);
-        if (OnSuccessValidateAmazonIAPReceipt.IsBound())
+        FClientValidateAmazonReceiptResult result = UPlayFabClientModelDecoder::readValidateAmazonReceiptResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessValidateAmazonIAPReceipt.Execute(result, mCustomData);
+            FDelegateOnSuccessValidateAmazonIAPReceipt(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7758,39 +7133,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateGooglePlayPurchase(FClientValidate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessValidateGooglePlayPurchase = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperValidateGooglePlayPurchase);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/ValidateGooglePlayPurchase";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.ReceiptJson.IsEmpty() || request.ReceiptJson == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceiptJson"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceiptJson"), request.ReceiptJson);
-    }
-    if (request.Signature.IsEmpty() || request.Signature == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Signature"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Signature"), request.Signature);
-    }
-    if (request.CurrencyCode.IsEmpty() || request.CurrencyCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CurrencyCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CurrencyCode"), request.CurrencyCode);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("PurchasePrice"), request.PurchasePrice);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ReceiptJson", request.ReceiptJson);
+    Writer.WriteString("Signature", request.Signature);
+    Writer.WriteString("CurrencyCode", request.CurrencyCode);
+    Writer.WriteNumber("PurchasePrice", request.PurchasePrice);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7808,10 +7171,10 @@ void UPlayFabClientAPI::HelperValidateGooglePlayPurchase(FPlayFabBaseModel respo
     }
     else
     {
-        FClientValidateGooglePlayPurchaseResult result = UPlayFabClientModelDecoder::decodeValidateGooglePlayPurchaseResultResponse(response.responseData);
-        if (OnSuccessValidateGooglePlayPurchase.IsBound())
+        FClientValidateGooglePlayPurchaseResult result = UPlayFabClientModelDecoder::readValidateGooglePlayPurchaseResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessValidateGooglePlayPurchase.Execute(result, mCustomData);
+            FDelegateOnSuccessValidateGooglePlayPurchase(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7823,34 +7186,26 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateIOSReceipt(FClientValidateIOSRecei
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessValidateIOSReceipt = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperValidateIOSReceipt);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/ValidateIOSReceipt";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.ReceiptData.IsEmpty() || request.ReceiptData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceiptData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceiptData"), request.ReceiptData);
-    }
-    if (request.CurrencyCode.IsEmpty() || request.CurrencyCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CurrencyCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CurrencyCode"), request.CurrencyCode);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("PurchasePrice"), request.PurchasePrice);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ReceiptData", request.ReceiptData);
+    Writer.WriteString("CurrencyCode", request.CurrencyCode);
+    Writer.WriteNumber("PurchasePrice", request.PurchasePrice);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7868,10 +7223,10 @@ void UPlayFabClientAPI::HelperValidateIOSReceipt(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FClientValidateIOSReceiptResult result = UPlayFabClientModelDecoder::decodeValidateIOSReceiptResultResponse(response.responseData);
-        if (OnSuccessValidateIOSReceipt.IsBound())
+        FClientValidateIOSReceiptResult result = UPlayFabClientModelDecoder::readValidateIOSReceiptResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessValidateIOSReceipt.Execute(result, mCustomData);
+            FDelegateOnSuccessValidateIOSReceipt(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7883,39 +7238,27 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateWindowsStoreReceipt(FClientValidat
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessValidateWindowsStoreReceipt = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperValidateWindowsStoreReceipt);
 
     // Setup the request
     manager->PlayFabRequestURL = "/Client/ValidateWindowsStoreReceipt";
     manager->useSessionTicket = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.Receipt.IsEmpty() || request.Receipt == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Receipt"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Receipt"), request.Receipt);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CurrencyCode.IsEmpty() || request.CurrencyCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CurrencyCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CurrencyCode"), request.CurrencyCode);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("PurchasePrice"), request.PurchasePrice);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Receipt", request.Receipt);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("CurrencyCode", request.CurrencyCode);
+    Writer.WriteNumber("PurchasePrice", request.PurchasePrice);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7933,17 +7276,17 @@ void UPlayFabClientAPI::HelperValidateWindowsStoreReceipt(FPlayFabBaseModel resp
     }
     else
     {
-        FClientValidateWindowsReceiptResult result = UPlayFabClientModelDecoder::decodeValidateWindowsReceiptResultResponse(response.responseData);
-        if (OnSuccessValidateWindowsStoreReceipt.IsBound())
+        FClientValidateWindowsReceiptResult result = UPlayFabClientModelDecoder::readValidateWindowsReceiptResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessValidateWindowsStoreReceipt.Execute(result, mCustomData);
+            FDelegateOnSuccessValidateWindowsStoreReceipt(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
 
 
 
-void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed)
 {
     // Be sure that we have no data from previous response
     ResetResponseData();
@@ -7956,6 +7299,7 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
+        ReleaseToPool();
         return;
     }
 
@@ -7972,23 +7316,29 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        // Requests dropped from a full dispatcher queue were never started
+        if (Request->GetStatus() == EHttpRequestStatus::NotStarted)
+        {
+            myResponse.responseError.ErrorName = "Request dropped";
+            myResponse.responseError.ErrorMessage = "The request queue for this priority class was full";
+        }
+
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
+        ReleaseToPool();
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
-
     // Save response code as int32
     ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
-
-    // Decide whether the request was successful
-    bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
+    // The body was inflated, parsed and checked for errors on a worker thread
+    bIsValidJsonResponse = Parsed.bValidJson;
+    if (Parsed.Json.IsValid())
+    {
+        // Edits made through responseData must not reach the response cache, or other callers sharing the json
+        ResponseJsonObj->GetRootObject() = Parsed.bShared ? FPlayFabJsonView(Parsed.Json).CopyJsonObject() : Parsed.Json;
+    }
 
     // Log errors
     if (!bIsValidJsonResponse)
@@ -7996,17 +7346,25 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
     }
 
-    // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
-
-    myResponse.responseError.decodeError(ResponseJsonObj);
+    myResponse.responseError = Parsed.Error;
     myResponse.responseData = ResponseJsonObj;
+    myResponse.responseBody = Parsed.Body;
     IPlayFab* pfSettings = &(IPlayFab::Get());
 
     if (isLoginRequest && !myResponse.responseError.hasError)
     {
-        pfSettings->setSessionTicket(myResponse.responseData->GetObjectField("data")->GetStringField("SessionTicket"));
-        bool needsAttribution = myResponse.responseData->GetObjectField("data")->GetBoolField("SessionTicket");
+        const FPlayFabJsonView LoginData = myResponse.responseData->GetView().GetObjectField("data");
+        const FString SessionTicket = LoginData.GetStringField("SessionTicket");
+        if (SessionContext.IsValid())
+        {
+            SessionContext->SessionTicket = SessionTicket;
+            SessionContext->PlayFabId = LoginData.GetStringField("PlayFabId");
+        }
+        else
+        {
+            pfSettings->setSessionTicket(SessionTicket);
+        }
+        bool needsAttribution = LoginData.GetBoolField("SessionTicket");
         if (needsAttribution && !pfSettings->DisableAdvertising && !pfSettings->AdvertisingIdType.IsEmpty() && !pfSettings->AdvertisingIdValue.IsEmpty())
         {
             FClientAttributeInstallRequest request;
@@ -8019,26 +7377,58 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
                 makeAttrCall = false;
             if (makeAttrCall)
             {
-                // TODO: This request might be getting memory collected before it's complete...
+                // The pool holds the call until its response has been delivered
                 FDelegateOnSuccessAttributeInstall onSuccess;
                 FDelegateOnFailurePlayFabError onFailure;
                 UPlayFabClientAPI* callObj = AttributeInstall(request, onSuccess, onFailure, mCustomData);
+                callObj->SetSessionContext(SessionContext);
                 callObj->Activate();
             }
         }
     }
 
-    // Broadcast the result event
+    // Broadcast the result event, after which the response data is no longer ours to keep
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
+    ReleaseToPool();
 }
 
 void UPlayFabClientAPI::Activate()
+{
+    // From here the dispatcher holds the call, however long it takes
+    FPlayFabManagerPool::Get().MarkActivated(this);
+
+    FPlayFabDispatchInfo DispatchInfo;
+    DispatchInfo.Endpoint = PlayFabRequestURL;
+    DispatchInfo.Priority = requestPriority;
+    DispatchInfo.bIdempotent = isIdempotent;
+    DispatchInfo.bReadOnly = isReadOnly;
+    if (RequestBody.Num() == 0 && RequestJsonObj != nullptr)
+    {
+        // Built as a json tree by the caller rather than streamed by a factory
+        DispatchInfo.Body = RequestJsonObj->GetRootObject();
+    }
+    DispatchInfo.OnResponse = FPlayFabResponseDelegate::CreateUObject(this, &UPlayFabClientAPI::OnProcessRequestComplete);
+
+    // The generated decoders read the body itself, so the tree is only built for the login handling or other listeners
+    DispatchInfo.bNeedsJsonTree = isLoginRequest;
+    for (const UObject* Listener : OnPlayFabResponse.GetAllObjects())
+    {
+        DispatchInfo.bNeedsJsonTree |= Listener != this;
+    }
+
+    // Hand the request to the dispatcher, which sends it as soon as a connection is free
+    FPlayFabRequestDispatcher::Get().Submit(this, BuildHttpRequest(), DispatchInfo);
+}
+
+TSharedRef<IHttpRequest> UPlayFabClientAPI::BuildHttpRequest()
 {
     IPlayFab* pfSettings = &(IPlayFab::Get());
 
+    // Read the title and credentials from one snapshot, so a login completing meanwhile can't mix two sessions
+    const FPlayFabSettings& Settings = pfSettings->GetSettings();
+
     FString RequestUrl;
-    RequestUrl = TEXT("https://") + pfSettings->getGameTitleId() + IPlayFab::PlayFabURL + PlayFabRequestURL;
+    RequestUrl = Settings.GetUrl(PlayFabRequestURL);
 
     TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
     HttpRequest->SetURL(RequestUrl);
@@ -8046,31 +7436,19 @@ void UPlayFabClientAPI::Activate()
 
     // Headers
     if (useSessionTicket)
-        HttpRequest->SetHeader("X-Authentication", pfSettings->getSessionTicket());
+        HttpRequest->SetHeader("X-Authentication", SessionContext.IsValid() ? SessionContext->SessionTicket : Settings.SessionTicket);
     if (useSecretKey)
-        HttpRequest->SetHeader("X-SecretKey", pfSettings->getSecretApiKey());
+        HttpRequest->SetHeader("X-SecretKey", Settings.SecretApiKey);
     HttpRequest->SetHeader("Content-Type", "application/json");
+    HttpRequest->SetHeader("Accept-Encoding", "gzip, deflate");
     HttpRequest->SetHeader(TEXT("X-PlayFabSDK"), pfSettings->VersionString);
     HttpRequest->SetHeader("X-ReportErrorAsSuccess", "true"); // FHttpResponsePtr doesn't provide sufficient information when an error code is returned
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
+    if (RequestBody.Num() > 0)
+        HttpRequest->SetContent(RequestBody);
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
-
-    // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
-
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
-
-    // Bind event
-    HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabClientAPI::OnProcessRequestComplete);
-
-    // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    return HttpRequest;
 }
 
 void UPlayFabClientAPI::ResetResponseData()
@@ -8086,3 +7464,38 @@ void UPlayFabClientAPI::ResetResponseData()
 
     bIsValidJsonResponse = false;
 }
+
+void UPlayFabClientAPI::ReleaseToPool()
+{
+    FPlayFabManagerPool& Pool = FPlayFabManagerPool::Get();
+    if (!Pool.IsEnabled() || FPlayFabManagerPool::IsHeldOutside(this, OnPlayFabResponse, OnSuccess, OnFailure))
+    {
+        // Not reused, so the response is left for whoever still holds this call
+        Pool.Discard(this);
+        return;
+    }
+
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    OnSuccess.Unbind();
+    mCustomData = nullptr;
+
+    PlayFabRequestURL.Empty();
+    useSecretKey = false;
+    useSessionTicket = false;
+    isLoginRequest = false;
+    requestPriority = EPlayFabRequestPriority::Normal;
+    isIdempotent = false;
+    isReadOnly = false;
+    RequestHeaders.Empty();
+    RequestBody.Reset();
+    SessionContext.Reset();
+
+    if (RequestJsonObj != nullptr)
+    {
+        RequestJsonObj->Reset();
+    }
+    ResetResponseData();
+
+    Pool.Release(this);
+}
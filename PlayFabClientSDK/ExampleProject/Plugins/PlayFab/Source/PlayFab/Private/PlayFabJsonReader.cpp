@@ -0,0 +1,710 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab json reader.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabJsonReader.h"
+#include "PlayFabJsonObject.h"
+#include "PlayFabBaseModel.h"
+
+/** Deeper json than this is treated as malformed, so a hostile body can't exhaust the stack */
+static const int32 MaxDepth = 256;
+
+int32 FPlayFabJsonReader::FallbackCount = 0;
+
+static void AppendUTF8(TArray<TCHAR>& Chars, const uint8* Bytes, int32 Count)
+{
+    if (Count <= 0)
+    {
+        return;
+    }
+
+    const int32 Length = FUTF8ToTCHAR_Convert::ConvertedLength((const ANSICHAR*)Bytes, Count);
+    const int32 Start = Chars.AddUninitialized(Length);
+    FUTF8ToTCHAR_Convert::Convert(Chars.GetData() + Start, Length, (const ANSICHAR*)Bytes, Count);
+}
+
+static void AppendCodepoint(TArray<TCHAR>& Chars, uint32 Codepoint)
+{
+    if (sizeof(TCHAR) == 2 && Codepoint >= 0x10000)
+    {
+        Codepoint -= 0x10000;
+        Chars.Add((TCHAR)(0xD800 + (Codepoint >> 10)));
+        Chars.Add((TCHAR)(0xDC00 + (Codepoint & 0x3FF)));
+    }
+    else
+    {
+        Chars.Add((TCHAR)Codepoint);
+    }
+}
+
+static int32 HexValue(uint8 Char)
+{
+    if (Char >= '0' && Char <= '9') return Char - '0';
+    if (Char >= 'a' && Char <= 'f') return Char - 'a' + 10;
+    if (Char >= 'A' && Char <= 'F') return Char - 'A' + 10;
+    return -1;
+}
+
+FPlayFabJsonReader::FPlayFabJsonReader(const uint8* InData, int32 InSize)
+    : Data(InData)
+    , Size(InData != nullptr ? InSize : 0)
+    , Position(0)
+    , Depth(0)
+    , bError(false)
+    , bFirstField(false)
+    , DataDepth(-1)
+{
+}
+
+FPlayFabJsonReader::FPlayFabJsonReader(const TArray<uint8>& InData)
+    : FPlayFabJsonReader(InData.GetData(), InData.Num())
+{
+}
+
+FPlayFabJsonReader::FPlayFabJsonReader(const TArray<uint8>* InData)
+    : FPlayFabJsonReader(InData != nullptr ? InData->GetData() : nullptr, InData != nullptr ? InData->Num() : 0)
+{
+}
+
+void FPlayFabJsonReader::SkipWhitespace()
+{
+    while (Position < Size && (Data[Position] == ' ' || Data[Position] == '\n' || Data[Position] == '\r' || Data[Position] == '\t'))
+    {
+        ++Position;
+    }
+}
+
+uint8 FPlayFabJsonReader::Peek()
+{
+    SkipWhitespace();
+    return Position < Size ? Data[Position] : 0;
+}
+
+bool FPlayFabJsonReader::Consume(uint8 Expected)
+{
+    if (Peek() != Expected)
+    {
+        return false;
+    }
+    ++Position;
+    return true;
+}
+
+bool FPlayFabJsonReader::EnterData()
+{
+    if (!EnterObject())
+    {
+        return false;
+    }
+
+    uint64 Name;
+    while (NextField(Name))
+    {
+        if (Name == Hash("data"))
+        {
+            return EnterObject();
+        }
+        Skip();
+    }
+    return false;
+}
+
+bool FPlayFabJsonReader::EnterData(const UPlayFabJsonObject* Parsed)
+{
+    if (!EnterData())
+    {
+        return false;
+    }
+
+    if (Parsed != nullptr)
+    {
+        ParsedData = Parsed->GetView().GetObjectField(TEXT("data"));
+        DataDepth = Depth;
+    }
+    return true;
+}
+
+bool FPlayFabJsonReader::EnterObject()
+{
+    if (!Consume('{'))
+    {
+        return false;
+    }
+    if (++Depth > MaxDepth)
+    {
+        Fail();
+        return false;
+    }
+    bFirstField = true;
+    return true;
+}
+
+bool FPlayFabJsonReader::EnterArray()
+{
+    if (!Consume('['))
+    {
+        return false;
+    }
+    if (++Depth > MaxDepth)
+    {
+        Fail();
+        return false;
+    }
+    return true;
+}
+
+bool FPlayFabJsonReader::NextElement(bool& bFirst)
+{
+    if (Consume(']'))
+    {
+        --Depth;
+        return false;
+    }
+    if (!bFirst && !Consume(','))
+    {
+        Fail();
+        return false;
+    }
+    bFirst = false;
+    return !bError;
+}
+
+bool FPlayFabJsonReader::NextFieldSeparator()
+{
+    // A nested object always ends with its '}', so the flag is never left set for the object around it
+    const bool bFirst = bFirstField;
+    bFirstField = false;
+    if (Consume('}'))
+    {
+        --Depth;
+        return false;
+    }
+    if (!bFirst && !Consume(','))
+    {
+        Fail();
+        return false;
+    }
+    return !bError;
+}
+
+bool FPlayFabJsonReader::NextField(uint64& OutNameHash)
+{
+    return NextFieldSeparator() && ReadName(OutNameHash, nullptr);
+}
+
+bool FPlayFabJsonReader::NextField(FString& OutName)
+{
+    uint64 NameHash;
+    return NextFieldSeparator() && ReadName(NameHash, &OutName);
+}
+
+bool FPlayFabJsonReader::ReadName(uint64& OutHash, FString* OutName)
+{
+    if (Peek() != '"')
+    {
+        Fail();
+        return false;
+    }
+
+    const int32 Start = ++Position;
+    uint64 NameHash = Hash("");
+    while (Position < Size && Data[Position] != '"' && Data[Position] != '\\')
+    {
+        NameHash = (NameHash ^ Data[Position]) * 1099511628211ull;
+        ++Position;
+    }
+
+    if (Position < Size && Data[Position] == '"')
+    {
+        if (OutName != nullptr)
+        {
+            TArray<TCHAR>& Chars = OutName->GetCharArray();
+            Chars.Reset();
+            AppendUTF8(Chars, Data + Start, Position - Start);
+            if (Chars.Num() > 0)
+            {
+                Chars.Add(TEXT('\0'));
+            }
+        }
+        ++Position;
+    }
+    else
+    {
+        // An escaped name is rare enough to take the slow way. Only plain ascii names can match a generated field
+        Position = Start - 1;
+        FString Name;
+        if (!ReadQuoted(&Name))
+        {
+            return false;
+        }
+        NameHash = Hash("");
+        for (const TCHAR Char : Name.GetCharArray())
+        {
+            if (Char != 0)
+            {
+                NameHash = (NameHash ^ (uint8)Char) * 1099511628211ull;
+            }
+        }
+        if (OutName != nullptr)
+        {
+            *OutName = MoveTemp(Name);
+        }
+    }
+
+    if (!Consume(':'))
+    {
+        Fail();
+        return false;
+    }
+    OutHash = NameHash;
+    return true;
+}
+
+bool FPlayFabJsonReader::ReadQuoted(FString* Out)
+{
+    if (Peek() != '"')
+    {
+        Fail();
+        return false;
+    }
+
+    int32 RunStart = ++Position;
+    TArray<TCHAR>* Chars = Out != nullptr ? &Out->GetCharArray() : nullptr;
+    if (Chars != nullptr)
+    {
+        Chars->Reset();
+    }
+
+    while (Position < Size)
+    {
+        const uint8 Byte = Data[Position];
+        if (Byte == '"')
+        {
+            if (Chars != nullptr)
+            {
+                AppendUTF8(*Chars, Data + RunStart, Position - RunStart);
+                if (Chars->Num() > 0)
+                {
+                    Chars->Add(TEXT('\0'));
+                }
+            }
+            ++Position;
+            return true;
+        }
+        if (Byte != '\\')
+        {
+            ++Position;
+            continue;
+        }
+
+        // Copy the run before the escape, then the escaped character
+        if (Chars != nullptr)
+        {
+            AppendUTF8(*Chars, Data + RunStart, Position - RunStart);
+        }
+        if (Position + 1 >= Size)
+        {
+            break;
+        }
+
+        uint32 Codepoint = 0;
+        const uint8 Escaped = Data[Position + 1];
+        Position += 2;
+        switch (Escaped)
+        {
+        case '"': Codepoint = '"'; break;
+        case '\\': Codepoint = '\\'; break;
+        case '/': Codepoint = '/'; break;
+        case 'b': Codepoint = '\b'; break;
+        case 'f': Codepoint = '\f'; break;
+        case 'n': Codepoint = '\n'; break;
+        case 'r': Codepoint = '\r'; break;
+        case 't': Codepoint = '\t'; break;
+        case 'u':
+        {
+            for (int32 Digit = 0; Digit < 4; ++Digit)
+            {
+                const int32 Value = Position < Size ? HexValue(Data[Position++]) : -1;
+                if (Value < 0)
+                {
+                    Fail();
+                    return false;
+                }
+                Codepoint = (Codepoint << 4) | Value;
+            }
+
+            // Join a surrogate pair into one character, for platforms whose TCHAR is wider than utf-16
+            if (Codepoint >= 0xD800 && Codepoint <= 0xDBFF && Position + 5 < Size && Data[Position] == '\\' && Data[Position + 1] == 'u')
+            {
+                uint32 Low = 0;
+                bool bValid = true;
+                for (int32 Digit = 0; Digit < 4; ++Digit)
+                {
+                    const int32 Value = HexValue(Data[Position + 2 + Digit]);
+                    bValid &= Value >= 0;
+                    Low = (Low << 4) | (uint32)(Value & 0xF);
+                }
+                if (bValid && Low >= 0xDC00 && Low <= 0xDFFF)
+                {
+                    Codepoint = 0x10000 + ((Codepoint - 0xD800) << 10) + (Low - 0xDC00);
+                    Position += 6;
+                }
+            }
+            break;
+        }
+        default:
+            Fail();
+            return false;
+        }
+
+        if (Chars != nullptr)
+        {
+            AppendCodepoint(*Chars, Codepoint);
+        }
+        RunStart = Position;
+    }
+
+    Fail();
+    return false;
+}
+
+bool FPlayFabJsonReader::ReadNumberToken(double& Out)
+{
+    SkipWhitespace();
+    const int32 Start = Position;
+    while (Position < Size)
+    {
+        const uint8 Char = Data[Position];
+        if ((Char >= '0' && Char <= '9') || Char == '-' || Char == '+' || Char == '.' || Char == 'e' || Char == 'E')
+        {
+            ++Position;
+            continue;
+        }
+        break;
+    }
+
+    ANSICHAR Text[64];
+    const int32 Length = Position - Start;
+    if (Length == 0 || Length >= ARRAY_COUNT(Text))
+    {
+        Fail();
+        return false;
+    }
+    FMemory::Memcpy(Text, Data + Start, Length);
+    Text[Length] = 0;
+    Out = FCStringAnsi::Atod(Text);
+    return true;
+}
+
+bool FPlayFabJsonReader::ReadLiteral(const ANSICHAR* Literal, int32 Length)
+{
+    SkipWhitespace();
+    if (Position + Length > Size || FMemory::Memcmp(Data + Position, Literal, Length) != 0)
+    {
+        Fail();
+        return false;
+    }
+    Position += Length;
+    return true;
+}
+
+void FPlayFabJsonReader::ReadString(FString& Out)
+{
+    if (Peek() == '"')
+    {
+        ReadQuoted(&Out);
+    }
+    else
+    {
+        Skip();
+    }
+}
+
+bool FPlayFabJsonReader::ReadRawString(const ANSICHAR*& OutText, int32& OutLength)
+{
+    if (Peek() != '"')
+    {
+        Skip();
+        return false;
+    }
+
+    const int32 Start = Position + 1;
+    for (int32 End = Start; End < Size; ++End)
+    {
+        if (Data[End] == '"')
+        {
+            OutText = (const ANSICHAR*)(Data + Start);
+            OutLength = End - Start;
+            Position = End + 1;
+            return true;
+        }
+        if (Data[End] == '\\')
+        {
+            break;
+        }
+    }
+
+    // Escaped, or unterminated, which ReadQuoted reports
+    ReadQuoted(nullptr);
+    return false;
+}
+
+void FPlayFabJsonReader::ReadNumber(double& Out)
+{
+    const uint8 Next = Peek();
+    if (Next == '-' || (Next >= '0' && Next <= '9'))
+    {
+        ReadNumberToken(Out);
+    }
+    else
+    {
+        Skip();
+    }
+}
+
+void FPlayFabJsonReader::ReadInt(int32& Out)
+{
+    double Number = Out;
+    ReadNumber(Number);
+
+    // Converting a double outside int32's range is undefined, so saturate instead
+    Out = (int32)FMath::Clamp(Number, (double)MIN_int32, (double)MAX_int32);
+}
+
+void FPlayFabJsonReader::ReadBool(bool& Out)
+{
+    const uint8 Next = Peek();
+    if (Next == 't')
+    {
+        Out = ReadLiteral("true", 4) ? true : Out;
+    }
+    else if (Next == 'f')
+    {
+        Out = ReadLiteral("false", 5) ? false : Out;
+    }
+    else
+    {
+        Skip();
+    }
+}
+
+void FPlayFabJsonReader::ReadStringList(FString& Out)
+{
+    if (!EnterArray())
+    {
+        Skip();
+        return;
+    }
+
+    Out.Reset();
+    FString Element;
+    int32 Count = 0;
+    bool bFirst = true;
+    while (NextElement(bFirst))
+    {
+        if (Peek() != '"')
+        {
+            Skip();
+            continue;
+        }
+        if (Count++ > 0)
+        {
+            Out += TEXT(',');
+        }
+        ReadQuoted(&Element);
+        Out += Element;
+    }
+}
+
+void FPlayFabJsonReader::ReadObject(FPlayFabJsonView& Out, const TCHAR* FieldName)
+{
+    if (Peek() != '{')
+    {
+        Skip();
+        return;
+    }
+
+    if (IsInParsedData(FieldName))
+    {
+        // Stepping over the object builds nothing, the view shares the worker's tree
+        Skip();
+        Out = ParsedData.GetObjectField(FieldName);
+        return;
+    }
+
+    TSharedPtr<FJsonObject> Object;
+    if (ReadJsonObject(Object))
+    {
+        Out = FPlayFabJsonView(Object);
+    }
+}
+
+void FPlayFabJsonReader::ReadObjectArray(TArray<FPlayFabJsonView>& Out, const TCHAR* FieldName)
+{
+    if (Peek() == '[' && IsInParsedData(FieldName))
+    {
+        Skip();
+        Out = ParsedData.GetObjectArrayField(FieldName);
+        return;
+    }
+
+    if (!EnterArray())
+    {
+        Skip();
+        return;
+    }
+
+    Out.Reset();
+    bool bFirst = true;
+    while (NextElement(bFirst))
+    {
+        TSharedPtr<FJsonObject> Object;
+        if (Peek() != '{')
+        {
+            Skip();
+        }
+        else if (ReadJsonObject(Object))
+        {
+            Out.Add(FPlayFabJsonView(Object));
+        }
+    }
+}
+
+bool FPlayFabJsonReader::ReadJsonObject(TSharedPtr<FJsonObject>& Out)
+{
+    if (!EnterObject())
+    {
+        return false;
+    }
+
+    Out = MakeShareable(new FJsonObject());
+    FString Name;
+    while (NextField(Name))
+    {
+        TSharedPtr<FJsonValue> Value = ReadValue();
+        if (!Value.IsValid())
+        {
+            return false;
+        }
+        Out->Values.Add(Name, Value);
+    }
+    return !bError;
+}
+
+TSharedPtr<FJsonValue> FPlayFabJsonReader::ReadValue()
+{
+    const uint8 Next = Peek();
+    switch (Next)
+    {
+    case '{':
+    {
+        TSharedPtr<FJsonObject> Object;
+        return ReadJsonObject(Object) ? TSharedPtr<FJsonValue>(new FJsonValueObject(Object)) : TSharedPtr<FJsonValue>();
+    }
+    case '[':
+    {
+        EnterArray();
+        TArray<TSharedPtr<FJsonValue>> Elements;
+        bool bFirst = true;
+        while (NextElement(bFirst))
+        {
+            TSharedPtr<FJsonValue> Element = ReadValue();
+            if (!Element.IsValid())
+            {
+                return nullptr;
+            }
+            Elements.Add(Element);
+        }
+        return !bError ? TSharedPtr<FJsonValue>(new FJsonValueArray(Elements)) : TSharedPtr<FJsonValue>();
+    }
+    case '"':
+    {
+        FString String;
+        return ReadQuoted(&String) ? TSharedPtr<FJsonValue>(new FJsonValueString(String)) : TSharedPtr<FJsonValue>();
+    }
+    case 't':
+        return ReadLiteral("true", 4) ? TSharedPtr<FJsonValue>(new FJsonValueBoolean(true)) : TSharedPtr<FJsonValue>();
+    case 'f':
+        return ReadLiteral("false", 5) ? TSharedPtr<FJsonValue>(new FJsonValueBoolean(false)) : TSharedPtr<FJsonValue>();
+    case 'n':
+        return ReadLiteral("null", 4) ? TSharedPtr<FJsonValue>(new FJsonValueNull()) : TSharedPtr<FJsonValue>();
+    default:
+    {
+        double Number = 0.0;
+        return ReadNumberToken(Number) ? TSharedPtr<FJsonValue>(new FJsonValueNumber(Number)) : TSharedPtr<FJsonValue>();
+    }
+    }
+}
+
+bool FPlayFabJsonReader::IsAtEnd()
+{
+    SkipWhitespace();
+    return !bError && Position == Size;
+}
+
+void FPlayFabJsonReader::ReportFallback(const TCHAR* ResultName) const
+{
+    if (bError)
+    {
+        FPlatformAtomics::InterlockedIncrement(&FallbackCount);
+        UE_LOG(LogPlayFab, Warning, TEXT("Malformed response body, decoding %s from the json tree instead"), ResultName);
+    }
+}
+
+UPlayFabJsonObject* FPlayFabJsonReader::GetFallbackTree(const TCHAR* ResultName, const FPlayFabBaseModel& Response) const
+{
+    ReportFallback(ResultName);
+
+    // The tree is only built up front when something other than the decoder wants it
+    if (Response.responseData != nullptr && Response.responseBody.IsValid() && !Response.responseData->GetRootObject()->HasField(TEXT("data")))
+    {
+        FPlayFabResponseReader::Deserialize(Response.responseBody->GetData(), Response.responseBody->Num(), Response.responseData->GetRootObject());
+    }
+    return Response.responseData;
+}
+
+void FPlayFabJsonReader::Skip()
+{
+    switch (Peek())
+    {
+    case '{':
+    {
+        EnterObject();
+        uint64 Name;
+        while (NextField(Name))
+        {
+            Skip();
+        }
+        break;
+    }
+    case '[':
+    {
+        EnterArray();
+        bool bFirst = true;
+        while (NextElement(bFirst))
+        {
+            Skip();
+        }
+        break;
+    }
+    case '"':
+        ReadQuoted(nullptr);
+        break;
+    case 't':
+        ReadLiteral("true", 4);
+        break;
+    case 'f':
+        ReadLiteral("false", 5);
+        break;
+    case 'n':
+        ReadLiteral("null", 4);
+        break;
+    default:
+    {
+        double Number;
+        ReadNumberToken(Number);
+        break;
+    }
+    }
+}
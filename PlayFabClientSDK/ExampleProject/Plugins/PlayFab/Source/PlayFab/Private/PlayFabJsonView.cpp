@@ -0,0 +1,272 @@
+////////////////////////////////////////////////////////////
+// JSon Views
+// A light handle into a parsed json document, handed out by
+// the response models beside each UPlayFabJsonObject field.
+////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabJsonView.h"
+
+bool FPlayFabJsonObjectFields::bEnabled = true;
+
+typedef TJsonWriterFactory< TCHAR, TCondensedJsonPrintPolicy<TCHAR> > FCondensedJsonStringWriterFactory;
+typedef TJsonWriter< TCHAR, TCondensedJsonPrintPolicy<TCHAR> > FCondensedJsonStringWriter;
+
+static TSharedPtr<FJsonObject> CopyObject(const FJsonObject& Source);
+
+static TSharedPtr<FJsonValue> CopyValue(const TSharedPtr<FJsonValue>& Value)
+{
+    if (!Value.IsValid())
+    {
+        return Value;
+    }
+
+    switch (Value->Type)
+    {
+    case EJson::Object:
+    {
+        const TSharedPtr<FJsonObject>& Object = Value->AsObject();
+        return MakeShareable(new FJsonValueObject(Object.IsValid() ? CopyObject(*Object) : Object));
+    }
+    case EJson::Array:
+    {
+        const TArray<TSharedPtr<FJsonValue>>& Source = Value->AsArray();
+        TArray<TSharedPtr<FJsonValue>> Elements;
+        Elements.Reserve(Source.Num());
+        for (const TSharedPtr<FJsonValue>& Element : Source)
+        {
+            Elements.Add(CopyValue(Element));
+        }
+        return MakeShareable(new FJsonValueArray(Elements));
+    }
+    default:
+        // Strings, numbers, booleans and nulls can't be changed in place, so the copy shares them
+        return Value;
+    }
+}
+
+static TSharedPtr<FJsonObject> CopyObject(const FJsonObject& Source)
+{
+    TSharedPtr<FJsonObject> Copy = MakeShareable(new FJsonObject());
+    Copy->Values.Reserve(Source.Values.Num());
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Pair : Source.Values)
+    {
+        Copy->Values.Add(Pair.Key, CopyValue(Pair.Value));
+    }
+    return Copy;
+}
+
+bool FPlayFabJsonView::HasField(const FString& FieldName) const
+{
+    return Object.IsValid() && Object->HasField(FieldName);
+}
+
+FString FPlayFabJsonView::GetStringField(const FString& FieldName) const
+{
+    FString Value;
+    if (Object.IsValid())
+    {
+        Object->TryGetStringField(FieldName, Value);
+    }
+    return Value;
+}
+
+double FPlayFabJsonView::GetNumberField(const FString& FieldName) const
+{
+    double Value = 0.0;
+    if (Object.IsValid())
+    {
+        Object->TryGetNumberField(FieldName, Value);
+    }
+    return Value;
+}
+
+bool FPlayFabJsonView::GetBoolField(const FString& FieldName) const
+{
+    bool Value = false;
+    if (Object.IsValid())
+    {
+        Object->TryGetBoolField(FieldName, Value);
+    }
+    return Value;
+}
+
+FPlayFabJsonView FPlayFabJsonView::GetObjectField(const FString& FieldName) const
+{
+    const TSharedPtr<FJsonObject>* Value = nullptr;
+    if (Object.IsValid() && Object->TryGetObjectField(FieldName, Value))
+    {
+        return FPlayFabJsonView(*Value);
+    }
+    return FPlayFabJsonView();
+}
+
+FPlayFabJsonArrayView FPlayFabJsonView::GetArrayField(const FString& FieldName) const
+{
+    const TArray<TSharedPtr<FJsonValue>>* Values = nullptr;
+    if (Object.IsValid() && Object->TryGetArrayField(FieldName, Values))
+    {
+        return FPlayFabJsonArrayView(Object, Values);
+    }
+    return FPlayFabJsonArrayView();
+}
+
+TArray<FPlayFabJsonView> FPlayFabJsonView::GetObjectArrayField(const FString& FieldName) const
+{
+    const FPlayFabJsonArrayView Values = GetArrayField(FieldName);
+
+    TArray<FPlayFabJsonView> OutArray;
+    OutArray.Reserve(Values.Num());
+    for (int32 Index = 0; Index < Values.Num(); ++Index)
+    {
+        OutArray.Add(Values.GetObject(Index));
+    }
+    return OutArray;
+}
+
+TArray<FString> FPlayFabJsonView::GetStringArrayField(const FString& FieldName) const
+{
+    const FPlayFabJsonArrayView Values = GetArrayField(FieldName);
+
+    TArray<FString> OutArray;
+    OutArray.Reserve(Values.Num());
+    for (const TSharedPtr<FJsonValue>& Value : Values)
+    {
+        FString String;
+        Value->TryGetString(String);
+        OutArray.Add(MoveTemp(String));
+    }
+    return OutArray;
+}
+
+TSharedPtr<FJsonObject> FPlayFabJsonView::CopyJsonObject() const
+{
+    return Object.IsValid() ? CopyObject(*Object) : nullptr;
+}
+
+UPlayFabJsonObject* FPlayFabJsonView::ToJsonObject() const
+{
+    if (!Object.IsValid())
+    {
+        return nullptr;
+    }
+
+    // The document is shared with the other views of the response, and maybe the response cache
+    TSharedPtr<FJsonObject> Root = CopyJsonObject();
+    UPlayFabJsonObject* OutJsonObj = NewObject<UPlayFabJsonObject>();
+    OutJsonObj->SetRootObject(Root);
+    return OutJsonObj;
+}
+
+UPlayFabJsonObject* FPlayFabJsonView::WrapJsonObject() const
+{
+    if (!Object.IsValid())
+    {
+        return nullptr;
+    }
+
+    TSharedPtr<FJsonObject> Root = Object;
+    UPlayFabJsonObject* OutJsonObj = NewObject<UPlayFabJsonObject>();
+    OutJsonObj->SetRootObject(Root);
+    return OutJsonObj;
+}
+
+TArray<UPlayFabJsonObject*> FPlayFabJsonView::WrapJsonObjects(const TArray<FPlayFabJsonView>& Views)
+{
+    TArray<UPlayFabJsonObject*> OutArray;
+    OutArray.Reserve(Views.Num());
+    for (const FPlayFabJsonView& View : Views)
+    {
+        OutArray.Add(View.WrapJsonObject());
+    }
+    return OutArray;
+}
+
+FPlayFabJsonView FPlayFabJsonArrayView::GetObject(int32 Index) const
+{
+    const TSharedPtr<FJsonObject>* Value = nullptr;
+    if ((*Values)[Index].IsValid() && (*Values)[Index]->TryGetObject(Value))
+    {
+        return FPlayFabJsonView(*Value);
+    }
+    return FPlayFabJsonView();
+}
+
+
+//////////////////////////////////////////////////////////////////////////
+// Blueprint access
+
+bool FPlayFabJsonObjectFields::IsWanted(const FScriptDelegate& OnSuccess)
+{
+    // Only a Blueprint can be wired to the object fields, native code reads the views
+    return bEnabled && FPlayFabManagerPool::IsBlueprintObject(OnSuccess.GetUObject());
+}
+
+UPlayFabJsonObject* UPlayFabJsonViewLibrary::ToJsonObject(const FPlayFabJsonView& View)
+{
+    return View.ToJsonObject();
+}
+
+TArray<UPlayFabJsonObject*> UPlayFabJsonViewLibrary::ToJsonObjectArray(const TArray<FPlayFabJsonView>& Views)
+{
+    TArray<UPlayFabJsonObject*> OutArray;
+    OutArray.Reserve(Views.Num());
+    for (const FPlayFabJsonView& View : Views)
+    {
+        OutArray.Add(View.ToJsonObject());
+    }
+    return OutArray;
+}
+
+bool UPlayFabJsonViewLibrary::IsValidView(const FPlayFabJsonView& View)
+{
+    return View.IsValid();
+}
+
+bool UPlayFabJsonViewLibrary::HasViewField(const FPlayFabJsonView& View, const FString& FieldName)
+{
+    return View.HasField(FieldName);
+}
+
+FString UPlayFabJsonViewLibrary::GetViewStringField(const FPlayFabJsonView& View, const FString& FieldName)
+{
+    return View.GetStringField(FieldName);
+}
+
+float UPlayFabJsonViewLibrary::GetViewNumberField(const FPlayFabJsonView& View, const FString& FieldName)
+{
+    return (float)View.GetNumberField(FieldName);
+}
+
+bool UPlayFabJsonViewLibrary::GetViewBoolField(const FPlayFabJsonView& View, const FString& FieldName)
+{
+    return View.GetBoolField(FieldName);
+}
+
+FPlayFabJsonView UPlayFabJsonViewLibrary::GetViewObjectField(const FPlayFabJsonView& View, const FString& FieldName)
+{
+    return View.GetObjectField(FieldName);
+}
+
+TArray<FPlayFabJsonView> UPlayFabJsonViewLibrary::GetViewObjectArrayField(const FPlayFabJsonView& View, const FString& FieldName)
+{
+    return View.GetObjectArrayField(FieldName);
+}
+
+TArray<FString> UPlayFabJsonViewLibrary::GetViewStringArrayField(const FPlayFabJsonView& View, const FString& FieldName)
+{
+    return View.GetStringArrayField(FieldName);
+}
+
+FString UPlayFabJsonViewLibrary::EncodeViewJson(const FPlayFabJsonView& View)
+{
+    if (!View.IsValid())
+    {
+        return TEXT("");
+    }
+
+    FString OutputString;
+    TSharedRef< FCondensedJsonStringWriter > Writer = FCondensedJsonStringWriterFactory::Create(&OutputString);
+    FJsonSerializer::Serialize(View.GetJsonObject().ToSharedRef(), Writer);
+    return OutputString;
+}
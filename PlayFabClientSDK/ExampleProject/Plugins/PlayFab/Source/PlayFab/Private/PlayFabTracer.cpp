@@ -0,0 +1,150 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab tracer.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabTracer.h"
+#include "PlayFabCompression.h"
+
+FPlayFabTracer* FPlayFabTracer::Instance = nullptr;
+
+static void DumpTraceToLog()
+{
+    if (FPlayFabTracer::IsAvailable())
+    {
+        FPlayFabTracer::Get().Dump(*GLog);
+    }
+}
+
+static FAutoConsoleCommand DumpTraceCommand(
+    TEXT("PlayFab.DumpTrace"),
+    TEXT("Write the recent PlayFab request trace to the log"),
+    FConsoleCommandDelegate::CreateStatic(&DumpTraceToLog));
+
+/** Turn a captured body back into text, inflating it first if it was sent gzipped */
+static FString BodyToString(const TArray<uint8>& Body)
+{
+    TArray<uint8> Inflated;
+    const TArray<uint8>* Text = &Body;
+    if (FPlayFabCompression::IsCompressed(Body.GetData(), Body.Num()) && FPlayFabCompression::Inflate(Body.GetData(), Body.Num(), Inflated))
+    {
+        Text = &Inflated;
+    }
+
+    FUTF8ToTCHAR Converter((const ANSICHAR*)Text->GetData(), Text->Num());
+    return FString(Converter.Length(), Converter.Get());
+}
+
+void FPlayFabTracer::Startup()
+{
+    if (Instance == nullptr)
+    {
+        Instance = new FPlayFabTracer();
+    }
+}
+
+void FPlayFabTracer::Shutdown()
+{
+    delete Instance;
+    Instance = nullptr;
+}
+
+FPlayFabTracer& FPlayFabTracer::Get()
+{
+    check(Instance != nullptr);
+    return *Instance;
+}
+
+FPlayFabTracer::FPlayFabTracer()
+    : NextSequence(0)
+    , NextBodySlot(0)
+    , SampleRate(0.0f)
+{
+    static_assert((RingCapacity & (RingCapacity - 1)) == 0, "RingCapacity must be a power of two");
+    for (FSlot& Slot : Slots)
+    {
+        Slot.Sequence = -1;
+    }
+
+    SystemErrorHandle = FCoreDelegates::OnHandleSystemError.AddRaw(this, &FPlayFabTracer::OnSystemError);
+}
+
+FPlayFabTracer::~FPlayFabTracer()
+{
+    FCoreDelegates::OnHandleSystemError.Remove(SystemErrorHandle);
+}
+
+void FPlayFabTracer::Record(const FPlayFabTraceRecord& InRecord, const TArray<uint8>* RequestBody, const TArray<uint8>* ResponseBody)
+{
+    const int64 Sequence = FPlatformAtomics::InterlockedIncrement(&NextSequence) - 1;
+    FSlot& Slot = Slots[Sequence & (RingCapacity - 1)];
+
+    // Readers skip a slot whose sequence changes while they copy it
+    FPlatformAtomics::InterlockedExchange(&Slot.Sequence, -1);
+    Slot.Record = InRecord;
+    Slot.Record.Sequence = Sequence;
+    Slot.Record.bBodiesCaptured = RequestBody != nullptr || ResponseBody != nullptr;
+    FPlatformAtomics::InterlockedExchange(&Slot.Sequence, Sequence);
+
+    if (Slot.Record.bBodiesCaptured)
+    {
+        FScopeLock Lock(&BodyLock);
+        if (Bodies.Num() < BodyCapacity)
+        {
+            Bodies.AddDefaulted();
+        }
+        FCapturedBodies& Captured = Bodies[NextBodySlot];
+        NextBodySlot = (NextBodySlot + 1) % BodyCapacity;
+
+        Captured.Sequence = Sequence;
+        Captured.Request = RequestBody != nullptr ? *RequestBody : TArray<uint8>();
+        Captured.Response = ResponseBody != nullptr ? *ResponseBody : TArray<uint8>();
+    }
+}
+
+void FPlayFabTracer::Dump(FOutputDevice& Ar) const
+{
+    const int64 End = NextSequence;
+    const int64 Start = FMath::Max<int64>(End - RingCapacity, 0);
+    Ar.Logf(TEXT("PlayFab request trace, %lld records (showing the last %lld):"), End, End - Start);
+
+    for (int64 Sequence = Start; Sequence < End; ++Sequence)
+    {
+        const FSlot& Slot = Slots[Sequence & (RingCapacity - 1)];
+        if (Slot.Sequence != Sequence)
+        {
+            continue;
+        }
+        FPlatformMisc::MemoryBarrier();
+        const FPlayFabTraceRecord Record = Slot.Record;
+        FPlatformMisc::MemoryBarrier();
+        if (Slot.Sequence != Sequence)
+        {
+            continue;
+        }
+
+        Ar.Logf(TEXT("  #%lld %s attempt=%d http=%d error=%d req=%dB resp=%dB queue=%.2fms net=%.2fms decode=%.2fms"),
+            Record.Sequence, ANSI_TO_TCHAR(Record.Endpoint), Record.Attempt, Record.HttpCode, Record.ErrorCode,
+            Record.RequestBytes, Record.ResponseBytes, Record.QueueMs, Record.NetworkMs, Record.DecodeMs);
+
+        if (Record.bBodiesCaptured)
+        {
+            FScopeLock Lock(&BodyLock);
+            for (const FCapturedBodies& Captured : Bodies)
+            {
+                if (Captured.Sequence == Sequence)
+                {
+                    Ar.Logf(TEXT("    Request: %s"), *BodyToString(Captured.Request));
+                    Ar.Logf(TEXT("    Response: %s"), *BodyToString(Captured.Response));
+                    break;
+                }
+            }
+        }
+    }
+}
+
+void FPlayFabTracer::OnSystemError()
+{
+    Dump(*GLog);
+    GLog->Flush();
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Manager Pool. Hands out the UPlayFab*API objects each call is made through and
+// takes them back once the call is finished, so a busy title reuses a few hundred managers
+// instead of creating a new one, and its request json, for every call. A manager is held
+// from the moment its factory returns it until its response has been delivered, so it can't
+// be collected mid-call, and is then reset and kept for the next call of its class. A manager
+// that is never activated stops being held after a few minutes and is left to the GC.
+//
+// Pooling is off by default. A manager is only reused when nothing outside the SDK can have
+// kept it: a call made from a Blueprint, or with a listener on OnPlayFabResponse, is left to
+// the GC instead. C++ callers that turn pooling on must not keep a manager after its
+// callback.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Containers/Ticker.h"
+#include "UObject/GCObject.h"
+
+class PLAYFAB_API FPlayFabManagerPool : public FGCObject
+{
+public:
+    /** Create and destroy the pool, called by the module */
+    static void Startup();
+    static void Shutdown();
+
+    /** Returns the pool, only valid between Startup() and Shutdown() */
+    static FPlayFabManagerPool& Get();
+
+    /** A free manager of ManagerType, or a new one. It is held until it is released or discarded. Game thread only */
+    template<typename ManagerType>
+    ManagerType* Acquire()
+    {
+        return static_cast<ManagerType*>(Acquire(ManagerType::StaticClass()));
+    }
+    UObject* Acquire(UClass* Class);
+
+    /** Note that a manager has been handed to the dispatcher, so it is held however long its call takes */
+    void MarkActivated(UObject* Manager);
+
+    /** Take back a manager whose call is finished. Its owner must already have reset it */
+    void Release(UObject* Manager);
+
+    /** Stop holding a manager without reusing it, leaving it to the GC */
+    void Discard(UObject* Manager);
+
+    /**
+     * True if something outside the SDK may still hold Manager, or the response it delivered, after its callback: a
+     * listener on its response event other than Manager itself, or a success or failure delegate bound to a Blueprint
+     */
+    static bool IsHeldOutside(const UObject* Manager, const FMulticastScriptDelegate& OnResponse, const FScriptDelegate& OnSuccess, const FScriptDelegate& OnFailure);
+
+    /** True if Object is an instance of a Blueprint class */
+    static bool IsBlueprintObject(const UObject* Object);
+
+    /** Reuse managers. Off by default. When off every call gets a new manager, which is still held until it finishes */
+    void SetEnabled(bool bInEnabled);
+    bool IsEnabled() const { return bEnabled; }
+
+    /** How many free managers of each class are kept. Extra ones are left to the GC */
+    void SetMaxFreePerClass(int32 InMaxFreePerClass);
+
+    int32 GetCreatedCount() const { return CreatedCount; }
+    int32 GetReusedCount() const { return ReusedCount; }
+    int32 GetActiveCount() const { return Active.Num(); }
+    int32 GetFreeCount() const;
+
+    /** FGCObject interface */
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+
+private:
+    FPlayFabManagerPool();
+    virtual ~FPlayFabManagerPool();
+
+    /** Drop managers that were acquired long ago and never activated */
+    bool Tick(float DeltaTime);
+
+    static FPlayFabManagerPool* Instance;
+
+    /** Managers in use, with the time they were acquired, or 0 once they have been activated */
+    TMap<UObject*, double> Active;
+
+    TMap<UClass*, TArray<UObject*>> Free;
+
+    bool bEnabled;
+    int32 MaxFreePerClass;
+    int32 CreatedCount;
+    int32 ReusedCount;
+    FDelegateHandle TickHandle;
+};
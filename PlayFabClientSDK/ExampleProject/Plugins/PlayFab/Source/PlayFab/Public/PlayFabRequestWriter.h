@@ -0,0 +1,98 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Request Writer. Serializes a request into the condensed UTF-8 json body sent on the
+// wire. The generated factories stream their request struct straight into the body through
+// FPlayFabJsonWriter, and bodies built as a json tree are written by FPlayFabRequestWriter.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Dom/JsonObject.h"
+
+class UPlayFabJsonObject;
+
+/**
+ * Appends condensed json to a UTF-8 buffer. Keys are ascii literals, copied as they are with
+ * their length known at compile time, so writing a field allocates nothing but the buffer.
+ * Fields follow the generated request rules: empty strings and lists are written as null, and
+ * null json objects are left out. With bOmitNulls, null fields are left out as well
+ */
+class PLAYFAB_API FPlayFabJsonWriter
+{
+public:
+    explicit FPlayFabJsonWriter(TArray<uint8>& InOut, bool bInOmitNulls = false)
+        : Out(InOut)
+        , bOmitNulls(bInOmitNulls)
+        , bNeedComma(false)
+    {
+    }
+
+    void WriteObjectStart();
+    void WriteObjectEnd();
+
+    template<int32 N>
+    void WriteString(const ANSICHAR (&Key)[N], const FString& Value) { WriteStringField(Key, N - 1, Value); }
+
+    template<int32 N>
+    void WriteNumber(const ANSICHAR (&Key)[N], int32 Value) { WriteKey(Key, N - 1); WriteInteger(Value); }
+
+    template<int32 N>
+    void WriteBool(const ANSICHAR (&Key)[N], bool Value) { WriteKey(Key, N - 1); WriteLiteral(Value ? "true" : "false", Value ? 4 : 5); }
+
+    template<int32 N>
+    void WriteObject(const ANSICHAR (&Key)[N], UPlayFabJsonObject* Value) { WriteObjectField(Key, N - 1, Value); }
+
+    template<int32 N>
+    void WriteObjectArray(const ANSICHAR (&Key)[N], const TArray<UPlayFabJsonObject*>& Values) { WriteObjectArrayField(Key, N - 1, Values); }
+
+    /** Write a comma separated string, e.g. "a,b,c", as an array of strings */
+    template<int32 N>
+    void WriteStringList(const ANSICHAR (&Key)[N], const FString& CommaSeparated) { WriteStringListField(Key, N - 1, CommaSeparated); }
+
+    template<int32 N>
+    void WriteNull(const ANSICHAR (&Key)[N]) { WriteNullField(Key, N - 1); }
+
+    /** Write an enum by its json name, from GetEnumName. A value without a name leaves the field out, as the generated code always has */
+    template<int32 N>
+    void WriteEnum(const ANSICHAR (&Key)[N], const ANSICHAR* Name) { WriteEnumField(Key, N - 1, Name); }
+
+    /** Write a json tree as a value, e.g. the whole body */
+    void WriteJsonObject(const FJsonObject& Object);
+
+private:
+    void WriteKey(const ANSICHAR* Key, int32 KeyLength);
+    void WriteStringField(const ANSICHAR* Key, int32 KeyLength, const FString& Value);
+    void WriteObjectField(const ANSICHAR* Key, int32 KeyLength, UPlayFabJsonObject* Value);
+    void WriteObjectArrayField(const ANSICHAR* Key, int32 KeyLength, const TArray<UPlayFabJsonObject*>& Values);
+    void WriteStringListField(const ANSICHAR* Key, int32 KeyLength, const FString& CommaSeparated);
+    void WriteNullField(const ANSICHAR* Key, int32 KeyLength);
+    void WriteEnumField(const ANSICHAR* Key, int32 KeyLength, const ANSICHAR* Name);
+
+    /** Values, each preceded by a comma if it follows another in the same object or array */
+    void BeginValue();
+    void WriteLiteral(const ANSICHAR* Text, int32 Length);
+    void WriteInteger(int64 Value);
+    void WriteDouble(double Value);
+    void WriteQuoted(const TCHAR* Text, int32 Length);
+    void WriteObjectBody(const FJsonObject& Object);
+    void WriteValue(const FJsonValue& Value);
+
+    TArray<uint8>& Out;
+    bool bOmitNulls;
+    bool bNeedComma;
+};
+
+class PLAYFAB_API FPlayFabRequestWriter
+{
+public:
+    /**
+     * Write Object as the UTF-8 json body of a request. Walks the tree by reference without touching any shared
+     * pointer counts, so it may run on a worker thread as long as the game thread doesn't modify the object meanwhile
+     */
+    static void WriteBody(const FJsonObject& Object, TArray<uint8>& OutBody);
+
+    /**
+     * Append a canonical encoding of Object to Out, with object keys sorted, so two bodies that differ only in key
+     * order encode the same. Used to fingerprint requests, it isn't json. Same threading rules as WriteBody
+     */
+    static void WriteCanonical(const FJsonObject& Object, TArray<uint8>& Out);
+};
@@ -0,0 +1,37 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Retry Policy. Decides which failed calls the request dispatcher sends again, and
+// how long it waits first (exponential backoff with full jitter).
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Interfaces/IHttpResponse.h"
+#include "Dom/JsonObject.h"
+
+class PLAYFAB_API FPlayFabRetryPolicy
+{
+public:
+    enum class EOutcome : uint8
+    {
+        Success, // Not a failure, or not one we know how to classify
+        Throttled, // The server turned the call away, so it is always safe to send again
+        Transient, // Transport failure or server error, the call may or may not have been applied
+        Permanent, // Sending it again will fail the same way
+    };
+
+    /** Total attempts per call, including the first one */
+    int32 MaxAttempts = 4;
+
+    /** Backoff before retry N is a random delay in [0, min(MaxDelaySeconds, BaseDelaySeconds * 2^(N-1))] */
+    float BaseDelaySeconds = 0.5f;
+    float MaxDelaySeconds = 20.0f;
+
+    /** Work out what kind of failure a completed call was, given its parsed body and the error code table. Safe to call from any thread */
+    static EOutcome Classify(FHttpResponsePtr Response, bool bWasSuccessful, const FJsonObject* Json);
+
+    /** Should a call that has been attempted Attempts times be sent again? */
+    bool ShouldRetry(EOutcome Outcome, bool bIdempotent, int32 Attempts) const;
+
+    /** Full-jitter delay before the next attempt */
+    float GetBackoffDelay(int32 Attempts) const;
+};
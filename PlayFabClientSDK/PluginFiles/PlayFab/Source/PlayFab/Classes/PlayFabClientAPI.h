@@ -9,6 +9,7 @@
 
 #include "OnlineBlueprintCallProxyBase.h"
 #include "PlayFabBaseModel.h"
+#include "PlayFabRequestTypes.h"
 #include "PlayFabClientModels.h"
 #include "PlayFabClientAPI.generated.h"
 
@@ -25,9 +26,12 @@ public:
     UPROPERTY(BlueprintAssignable)
         FOnPlayFabClientRequestCompleted OnPlayFabResponse;
 
-    /** Set the Request Json object */
+    /** Set the Request Json object, sent in place of the body the factory wrote */
     void SetRequestObject(UPlayFabJsonObject* JsonObject);
 
+    /** Get the Request Json object, created on first use and kept while the manager is pooled */
+    UPlayFabJsonObject* GetRequestObject();
+
     /** Get the Response Json object */
     UPlayFabJsonObject* GetResponseObject();
 
@@ -40,6 +44,13 @@ public:
     /** UOnlineBlueprintCallProxyBase interface */
     virtual void Activate() override;
 
+    /** Clear this call's request, response and delegates and hand it back to the manager pool. Done once the response has been delivered, or call it instead of Activate() to drop a call */
+    UFUNCTION()
+        void ReleaseToPool();
+
+    /** Make this call as the player of Context rather than the global session. Must be set before Activate() */
+    void SetSessionContext(const TSharedPtr<FPlayFabSessionContext, ESPMode::ThreadSafe>& Context) { SessionContext = Context; }
+
     //////////////////////////////////////////////////////////////////////////
     // Generated PlayFab Client API Functions
     //////////////////////////////////////////////////////////////////////////
@@ -1812,149 +1823,26 @@ public:
     bool useSecretKey = false;
     bool useSessionTicket = false;
     bool isLoginRequest = false;
+    EPlayFabRequestPriority requestPriority = EPlayFabRequestPriority::Normal;
+    bool isIdempotent = false;
+    bool isReadOnly = false;
 
     /** Is the response valid JSON? */
     bool bIsValidJsonResponse;
-    FString ResponseContent;
     int32 ResponseCode;
     UObject* mCustomData;
 
     FDelegateOnFailurePlayFabError OnFailure;
-    FDelegateOnSuccessGetPhotonAuthenticationToken OnSuccessGetPhotonAuthenticationToken;
-    FDelegateOnSuccessGetTitlePublicKey OnSuccessGetTitlePublicKey;
-    FDelegateOnSuccessGetWindowsHelloChallenge OnSuccessGetWindowsHelloChallenge;
-    FDelegateOnSuccessLoginWithAndroidDeviceID OnSuccessLoginWithAndroidDeviceID;
-    FDelegateOnSuccessLoginWithCustomID OnSuccessLoginWithCustomID;
-    FDelegateOnSuccessLoginWithEmailAddress OnSuccessLoginWithEmailAddress;
-    FDelegateOnSuccessLoginWithFacebook OnSuccessLoginWithFacebook;
-    FDelegateOnSuccessLoginWithGameCenter OnSuccessLoginWithGameCenter;
-    FDelegateOnSuccessLoginWithGoogleAccount OnSuccessLoginWithGoogleAccount;
-    FDelegateOnSuccessLoginWithIOSDeviceID OnSuccessLoginWithIOSDeviceID;
-    FDelegateOnSuccessLoginWithKongregate OnSuccessLoginWithKongregate;
-    FDelegateOnSuccessLoginWithPlayFab OnSuccessLoginWithPlayFab;
-    FDelegateOnSuccessLoginWithSteam OnSuccessLoginWithSteam;
-    FDelegateOnSuccessLoginWithTwitch OnSuccessLoginWithTwitch;
-    FDelegateOnSuccessLoginWithWindowsHello OnSuccessLoginWithWindowsHello;
-    FDelegateOnSuccessRegisterPlayFabUser OnSuccessRegisterPlayFabUser;
-    FDelegateOnSuccessRegisterWithWindowsHello OnSuccessRegisterWithWindowsHello;
-    FDelegateOnSuccessSetPlayerSecret OnSuccessSetPlayerSecret;
-    FDelegateOnSuccessAddGenericID OnSuccessAddGenericID;
-    FDelegateOnSuccessAddUsernamePassword OnSuccessAddUsernamePassword;
-    FDelegateOnSuccessGetAccountInfo OnSuccessGetAccountInfo;
-    FDelegateOnSuccessGetPlayerCombinedInfo OnSuccessGetPlayerCombinedInfo;
-    FDelegateOnSuccessGetPlayerProfile OnSuccessGetPlayerProfile;
-    FDelegateOnSuccessGetPlayFabIDsFromFacebookIDs OnSuccessGetPlayFabIDsFromFacebookIDs;
-    FDelegateOnSuccessGetPlayFabIDsFromGameCenterIDs OnSuccessGetPlayFabIDsFromGameCenterIDs;
-    FDelegateOnSuccessGetPlayFabIDsFromGenericIDs OnSuccessGetPlayFabIDsFromGenericIDs;
-    FDelegateOnSuccessGetPlayFabIDsFromGoogleIDs OnSuccessGetPlayFabIDsFromGoogleIDs;
-    FDelegateOnSuccessGetPlayFabIDsFromKongregateIDs OnSuccessGetPlayFabIDsFromKongregateIDs;
-    FDelegateOnSuccessGetPlayFabIDsFromSteamIDs OnSuccessGetPlayFabIDsFromSteamIDs;
-    FDelegateOnSuccessGetPlayFabIDsFromTwitchIDs OnSuccessGetPlayFabIDsFromTwitchIDs;
-    FDelegateOnSuccessLinkAndroidDeviceID OnSuccessLinkAndroidDeviceID;
-    FDelegateOnSuccessLinkCustomID OnSuccessLinkCustomID;
-    FDelegateOnSuccessLinkFacebookAccount OnSuccessLinkFacebookAccount;
-    FDelegateOnSuccessLinkGameCenterAccount OnSuccessLinkGameCenterAccount;
-    FDelegateOnSuccessLinkGoogleAccount OnSuccessLinkGoogleAccount;
-    FDelegateOnSuccessLinkIOSDeviceID OnSuccessLinkIOSDeviceID;
-    FDelegateOnSuccessLinkKongregate OnSuccessLinkKongregate;
-    FDelegateOnSuccessLinkSteamAccount OnSuccessLinkSteamAccount;
-    FDelegateOnSuccessLinkTwitch OnSuccessLinkTwitch;
-    FDelegateOnSuccessLinkWindowsHello OnSuccessLinkWindowsHello;
-    FDelegateOnSuccessRemoveGenericID OnSuccessRemoveGenericID;
-    FDelegateOnSuccessReportPlayer OnSuccessReportPlayer;
-    FDelegateOnSuccessSendAccountRecoveryEmail OnSuccessSendAccountRecoveryEmail;
-    FDelegateOnSuccessUnlinkAndroidDeviceID OnSuccessUnlinkAndroidDeviceID;
-    FDelegateOnSuccessUnlinkCustomID OnSuccessUnlinkCustomID;
-    FDelegateOnSuccessUnlinkFacebookAccount OnSuccessUnlinkFacebookAccount;
-    FDelegateOnSuccessUnlinkGameCenterAccount OnSuccessUnlinkGameCenterAccount;
-    FDelegateOnSuccessUnlinkGoogleAccount OnSuccessUnlinkGoogleAccount;
-    FDelegateOnSuccessUnlinkIOSDeviceID OnSuccessUnlinkIOSDeviceID;
-    FDelegateOnSuccessUnlinkKongregate OnSuccessUnlinkKongregate;
-    FDelegateOnSuccessUnlinkSteamAccount OnSuccessUnlinkSteamAccount;
-    FDelegateOnSuccessUnlinkTwitch OnSuccessUnlinkTwitch;
-    FDelegateOnSuccessUnlinkWindowsHello OnSuccessUnlinkWindowsHello;
-    FDelegateOnSuccessUpdateAvatarUrl OnSuccessUpdateAvatarUrl;
-    FDelegateOnSuccessUpdateUserTitleDisplayName OnSuccessUpdateUserTitleDisplayName;
-    FDelegateOnSuccessGetFriendLeaderboard OnSuccessGetFriendLeaderboard;
-    FDelegateOnSuccessGetFriendLeaderboardAroundPlayer OnSuccessGetFriendLeaderboardAroundPlayer;
-    FDelegateOnSuccessGetLeaderboard OnSuccessGetLeaderboard;
-    FDelegateOnSuccessGetLeaderboardAroundPlayer OnSuccessGetLeaderboardAroundPlayer;
-    FDelegateOnSuccessGetPlayerStatistics OnSuccessGetPlayerStatistics;
-    FDelegateOnSuccessGetPlayerStatisticVersions OnSuccessGetPlayerStatisticVersions;
-    FDelegateOnSuccessGetUserData OnSuccessGetUserData;
-    FDelegateOnSuccessGetUserPublisherData OnSuccessGetUserPublisherData;
-    FDelegateOnSuccessGetUserPublisherReadOnlyData OnSuccessGetUserPublisherReadOnlyData;
-    FDelegateOnSuccessGetUserReadOnlyData OnSuccessGetUserReadOnlyData;
-    FDelegateOnSuccessUpdatePlayerStatistics OnSuccessUpdatePlayerStatistics;
-    FDelegateOnSuccessUpdateUserData OnSuccessUpdateUserData;
-    FDelegateOnSuccessUpdateUserPublisherData OnSuccessUpdateUserPublisherData;
-    FDelegateOnSuccessGetCatalogItems OnSuccessGetCatalogItems;
-    FDelegateOnSuccessGetPublisherData OnSuccessGetPublisherData;
-    FDelegateOnSuccessGetStoreItems OnSuccessGetStoreItems;
-    FDelegateOnSuccessGetTime OnSuccessGetTime;
-    FDelegateOnSuccessGetTitleData OnSuccessGetTitleData;
-    FDelegateOnSuccessGetTitleNews OnSuccessGetTitleNews;
-    FDelegateOnSuccessAddUserVirtualCurrency OnSuccessAddUserVirtualCurrency;
-    FDelegateOnSuccessConfirmPurchase OnSuccessConfirmPurchase;
-    FDelegateOnSuccessConsumeItem OnSuccessConsumeItem;
-    FDelegateOnSuccessGetCharacterInventory OnSuccessGetCharacterInventory;
-    FDelegateOnSuccessGetPurchase OnSuccessGetPurchase;
-    FDelegateOnSuccessGetUserInventory OnSuccessGetUserInventory;
-    FDelegateOnSuccessPayForPurchase OnSuccessPayForPurchase;
-    FDelegateOnSuccessPurchaseItem OnSuccessPurchaseItem;
-    FDelegateOnSuccessRedeemCoupon OnSuccessRedeemCoupon;
-    FDelegateOnSuccessStartPurchase OnSuccessStartPurchase;
-    FDelegateOnSuccessSubtractUserVirtualCurrency OnSuccessSubtractUserVirtualCurrency;
-    FDelegateOnSuccessUnlockContainerInstance OnSuccessUnlockContainerInstance;
-    FDelegateOnSuccessUnlockContainerItem OnSuccessUnlockContainerItem;
-    FDelegateOnSuccessAddFriend OnSuccessAddFriend;
-    FDelegateOnSuccessGetFriendsList OnSuccessGetFriendsList;
-    FDelegateOnSuccessRemoveFriend OnSuccessRemoveFriend;
-    FDelegateOnSuccessSetFriendTags OnSuccessSetFriendTags;
-    FDelegateOnSuccessGetCurrentGames OnSuccessGetCurrentGames;
-    FDelegateOnSuccessGetGameServerRegions OnSuccessGetGameServerRegions;
-    FDelegateOnSuccessMatchmake OnSuccessMatchmake;
-    FDelegateOnSuccessStartGame OnSuccessStartGame;
-    FDelegateOnSuccessWriteCharacterEvent OnSuccessWriteCharacterEvent;
-    FDelegateOnSuccessWritePlayerEvent OnSuccessWritePlayerEvent;
-    FDelegateOnSuccessWriteTitleEvent OnSuccessWriteTitleEvent;
-    FDelegateOnSuccessAddSharedGroupMembers OnSuccessAddSharedGroupMembers;
-    FDelegateOnSuccessCreateSharedGroup OnSuccessCreateSharedGroup;
-    FDelegateOnSuccessGetSharedGroupData OnSuccessGetSharedGroupData;
-    FDelegateOnSuccessRemoveSharedGroupMembers OnSuccessRemoveSharedGroupMembers;
-    FDelegateOnSuccessUpdateSharedGroupData OnSuccessUpdateSharedGroupData;
-    FDelegateOnSuccessExecuteCloudScript OnSuccessExecuteCloudScript;
-    FDelegateOnSuccessGetContentDownloadUrl OnSuccessGetContentDownloadUrl;
-    FDelegateOnSuccessGetAllUsersCharacters OnSuccessGetAllUsersCharacters;
-    FDelegateOnSuccessGetCharacterLeaderboard OnSuccessGetCharacterLeaderboard;
-    FDelegateOnSuccessGetCharacterStatistics OnSuccessGetCharacterStatistics;
-    FDelegateOnSuccessGetLeaderboardAroundCharacter OnSuccessGetLeaderboardAroundCharacter;
-    FDelegateOnSuccessGetLeaderboardForUserCharacters OnSuccessGetLeaderboardForUserCharacters;
-    FDelegateOnSuccessGrantCharacterToUser OnSuccessGrantCharacterToUser;
-    FDelegateOnSuccessUpdateCharacterStatistics OnSuccessUpdateCharacterStatistics;
-    FDelegateOnSuccessGetCharacterData OnSuccessGetCharacterData;
-    FDelegateOnSuccessGetCharacterReadOnlyData OnSuccessGetCharacterReadOnlyData;
-    FDelegateOnSuccessUpdateCharacterData OnSuccessUpdateCharacterData;
-    FDelegateOnSuccessAcceptTrade OnSuccessAcceptTrade;
-    FDelegateOnSuccessCancelTrade OnSuccessCancelTrade;
-    FDelegateOnSuccessGetPlayerTrades OnSuccessGetPlayerTrades;
-    FDelegateOnSuccessGetTradeStatus OnSuccessGetTradeStatus;
-    FDelegateOnSuccessOpenTrade OnSuccessOpenTrade;
-    FDelegateOnSuccessAttributeInstall OnSuccessAttributeInstall;
-    FDelegateOnSuccessGetPlayerSegments OnSuccessGetPlayerSegments;
-    FDelegateOnSuccessGetPlayerTags OnSuccessGetPlayerTags;
-    FDelegateOnSuccessAndroidDevicePushNotificationRegistration OnSuccessAndroidDevicePushNotificationRegistration;
-    FDelegateOnSuccessRegisterForIOSPushNotification OnSuccessRegisterForIOSPushNotification;
-    FDelegateOnSuccessRestoreIOSPurchases OnSuccessRestoreIOSPurchases;
-    FDelegateOnSuccessValidateAmazonIAPReceipt OnSuccessValidateAmazonIAPReceipt;
-    FDelegateOnSuccessValidateGooglePlayPurchase OnSuccessValidateGooglePlayPurchase;
-    FDelegateOnSuccessValidateIOSReceipt OnSuccessValidateIOSReceipt;
-    FDelegateOnSuccessValidateWindowsStoreReceipt OnSuccessValidateWindowsStoreReceipt;
+
+    /** The success callback of the one call this manager makes. Its helper executes it as the call's FDelegateOnSuccess type */
+    FScriptDelegate OnSuccess;
 
 private:
-    /** Internal bind function for the IHTTPRequest::OnProcessRequestCompleted() event */
-    void OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
+    /** Internal bind function, called by the request dispatcher once the response has been parsed on a worker thread */
+    void OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed);
 
+    /** Builds the http request for this call. The dispatcher serializes the body */
+    TSharedRef<IHttpRequest> BuildHttpRequest();
 protected:
     /** Internal request data stored as JSON */
     UPROPERTY()
@@ -1966,4 +1854,10 @@ protected:
 
     /** Mapping of header section to values. Used to generate final header string for request */
     TMap<FString, FString> RequestHeaders;
+
+    /** The condensed UTF-8 body the factory streamed the request into. Kept, with its capacity, while the manager is pooled */
+    TArray<uint8> RequestBody;
+
+    /** The player this call is made as, null for the global session */
+    TSharedPtr<FPlayFabSessionContext, ESPMode::ThreadSafe> SessionContext;
 };
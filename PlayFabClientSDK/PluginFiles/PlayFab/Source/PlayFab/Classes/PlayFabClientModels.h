@@ -9,6 +9,7 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "PlayFabEnums.h"
+#include "PlayFabJsonView.h"
 #include "PlayFabClientModels.generated.h"
 
 class UPlayFabJsonObject;
@@ -99,12 +100,18 @@ public:
     /** Settings specific to this user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Authentication Models")
         UPlayFabJsonObject* SettingsForUser = nullptr;
+    /** SettingsForUser, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Authentication Models")
+        FPlayFabJsonView SettingsForUserView;
     /** The time of this user's previous login. If there was no previous login, then it's DateTime.MinValue */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Authentication Models")
         FString LastLoginTime;
     /** Results for requested info. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Authentication Models")
         UPlayFabJsonObject* InfoResultPayload = nullptr;
+    /** InfoResultPayload, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Authentication Models")
+        FPlayFabJsonView InfoResultPayloadView;
 };
 
 USTRUCT(BlueprintType)
@@ -416,6 +423,9 @@ public:
     /** Settings specific to this user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Authentication Models")
         UPlayFabJsonObject* SettingsForUser = nullptr;
+    /** SettingsForUser, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Authentication Models")
+        FPlayFabJsonView SettingsForUserView;
 };
 
 USTRUCT(BlueprintType)
@@ -538,6 +548,9 @@ public:
     /** Account information for the local user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
         UPlayFabJsonObject* AccountInfo = nullptr;
+    /** AccountInfo, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
+        FPlayFabJsonView AccountInfoView;
 };
 
 USTRUCT(BlueprintType)
@@ -564,6 +577,9 @@ public:
     /** Results for requested info. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
         UPlayFabJsonObject* InfoResultPayload = nullptr;
+    /** InfoResultPayload, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
+        FPlayFabJsonView InfoResultPayloadView;
 };
 
 USTRUCT(BlueprintType)
@@ -587,6 +603,9 @@ public:
     /** The profile of the player. This profile is not guaranteed to be up-to-date. For a new player, this profile will not exist. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
         UPlayFabJsonObject* PlayerProfile = nullptr;
+    /** PlayerProfile, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
+        FPlayFabJsonView PlayerProfileView;
 };
 
 USTRUCT(BlueprintType)
@@ -607,6 +626,9 @@ public:
     /** Mapping of Facebook identifiers to PlayFab identifiers. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
         TArray<UPlayFabJsonObject*> Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
+        TArray<FPlayFabJsonView> DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -627,6 +649,9 @@ public:
     /** Mapping of Game Center identifiers to PlayFab identifiers. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
         TArray<UPlayFabJsonObject*> Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
+        TArray<FPlayFabJsonView> DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -647,6 +672,9 @@ public:
     /** Mapping of generic service identifiers to PlayFab identifiers. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
         TArray<UPlayFabJsonObject*> Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
+        TArray<FPlayFabJsonView> DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -667,6 +695,9 @@ public:
     /** Mapping of Google identifiers to PlayFab identifiers. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
         TArray<UPlayFabJsonObject*> Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
+        TArray<FPlayFabJsonView> DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -687,6 +718,9 @@ public:
     /** Mapping of Kongregate identifiers to PlayFab identifiers. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
         TArray<UPlayFabJsonObject*> Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
+        TArray<FPlayFabJsonView> DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -707,6 +741,9 @@ public:
     /** Mapping of Steam identifiers to PlayFab identifiers. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
         TArray<UPlayFabJsonObject*> Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
+        TArray<FPlayFabJsonView> DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -727,6 +764,9 @@ public:
     /** Mapping of Twitch identifiers to PlayFab identifiers. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
         TArray<UPlayFabJsonObject*> Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Account Management Models")
+        TArray<FPlayFabJsonView> DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -1243,6 +1283,9 @@ public:
     /** Ordered listing of users and their positions in the requested leaderboard. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
         TArray<UPlayFabJsonObject*> Leaderboard;
+    /** Leaderboard, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
+        TArray<FPlayFabJsonView> LeaderboardView;
     /** The version of the leaderboard returned. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
         int32 Version;
@@ -1290,6 +1333,9 @@ public:
     /** Ordered listing of users and their positions in the requested leaderboard. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
         TArray<UPlayFabJsonObject*> Leaderboard;
+    /** Leaderboard, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
+        TArray<FPlayFabJsonView> LeaderboardView;
     /** The version of the leaderboard returned. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
         int32 Version;
@@ -1356,6 +1402,9 @@ public:
     /** Ordered listing of users and their positions in the requested leaderboard. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
         TArray<UPlayFabJsonObject*> Leaderboard;
+    /** Leaderboard, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
+        TArray<FPlayFabJsonView> LeaderboardView;
     /** The version of the leaderboard returned. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
         int32 Version;
@@ -1385,6 +1434,9 @@ public:
     /** User statistics for the requested user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
         TArray<UPlayFabJsonObject*> Statistics;
+    /** Statistics, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
+        TArray<FPlayFabJsonView> StatisticsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1405,6 +1457,9 @@ public:
     /** version change history of the statistic */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
         TArray<UPlayFabJsonObject*> StatisticVersions;
+    /** StatisticVersions, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
+        TArray<FPlayFabJsonView> StatisticVersionsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1431,6 +1486,9 @@ public:
     /** User specific data for this title. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
         UPlayFabJsonObject* Data = nullptr;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
+        FPlayFabJsonView DataView;
     /** Indicates the current version of the data that has been set. This is incremented with every set call for that type of data (read-only, internal, etc). This version can be provided in Get calls to find updated data. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Data Management Models")
         int32 DataVersion;
@@ -1502,6 +1560,9 @@ public:
     /** Array of items which can be purchased. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
         TArray<UPlayFabJsonObject*> Catalog;
+    /** Catalog, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
+        TArray<FPlayFabJsonView> CatalogView;
 };
 
 USTRUCT(BlueprintType)
@@ -1522,6 +1583,9 @@ public:
     /** a dictionary object of key / value pairs */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
         UPlayFabJsonObject* Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
+        FPlayFabJsonView DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -1545,6 +1609,9 @@ public:
     /** Array of items which can be purchased from this store. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
         TArray<UPlayFabJsonObject*> Store;
+    /** Store, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
+        TArray<FPlayFabJsonView> StoreView;
     /** How the store was last updated (Admin or a third party). */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
         EPfSourceType Source;
@@ -1557,6 +1624,9 @@ public:
     /** Additional data about the store. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
         UPlayFabJsonObject* MarketingData = nullptr;
+    /** MarketingData, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
+        FPlayFabJsonView MarketingDataView;
 };
 
 USTRUCT(BlueprintType)
@@ -1594,6 +1664,9 @@ public:
     /** a dictionary object of key / value pairs */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
         UPlayFabJsonObject* Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
+        FPlayFabJsonView DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -1614,6 +1687,9 @@ public:
     /** Array of news items. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
         TArray<UPlayFabJsonObject*> News;
+    /** News, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Title-Wide Data Management Models")
+        TArray<FPlayFabJsonView> NewsView;
 };
 
 
@@ -1677,6 +1753,9 @@ public:
     /** Array of items purchased. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         TArray<UPlayFabJsonObject*> Items;
+    /** Items, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        TArray<FPlayFabJsonView> ItemsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1732,12 +1811,21 @@ public:
     /** Array of inventory items belonging to the character. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         TArray<UPlayFabJsonObject*> Inventory;
+    /** Inventory, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        TArray<FPlayFabJsonView> InventoryView;
     /** Array of virtual currency balance(s) belonging to the character. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrency;
+    /** VirtualCurrency, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyView;
     /** Array of remaining times and timestamps for virtual currencies. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrencyRechargeTimes = nullptr;
+    /** VirtualCurrencyRechargeTimes, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyRechargeTimesView;
 };
 
 USTRUCT(BlueprintType)
@@ -1787,12 +1875,21 @@ public:
     /** Array of inventory items belonging to the user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         TArray<UPlayFabJsonObject*> Inventory;
+    /** Inventory, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        TArray<FPlayFabJsonView> InventoryView;
     /** Array of virtual currency balance(s) belonging to the user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrency;
+    /** VirtualCurrency, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyView;
     /** Array of remaining times and timestamps for virtual currencies. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrencyRechargeTimes = nullptr;
+    /** VirtualCurrencyRechargeTimes, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyRechargeTimesView;
 };
 
 USTRUCT(BlueprintType)
@@ -1828,6 +1925,9 @@ public:
     /** Virtual currency cost of the transaction. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         UPlayFabJsonObject* VCAmount;
+    /** VCAmount, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        FPlayFabJsonView VCAmountView;
     /** Real world currency for the transaction. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         FString PurchaseCurrency;
@@ -1846,6 +1946,9 @@ public:
     /** Current virtual currency totals for the user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrency;
+    /** VirtualCurrency, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyView;
     /** A token generated by the provider to authenticate the request (provider-specific). */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         FString ProviderToken;
@@ -1884,6 +1987,9 @@ public:
     /** Details for the items purchased. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         TArray<UPlayFabJsonObject*> Items;
+    /** Items, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        TArray<FPlayFabJsonView> ItemsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1910,6 +2016,9 @@ public:
     /** Items granted to the player as a result of redeeming the coupon. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         TArray<UPlayFabJsonObject*> GrantedItems;
+    /** GrantedItems, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        TArray<FPlayFabJsonView> GrantedItemsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1939,12 +2048,21 @@ public:
     /** Cart items to be purchased. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         TArray<UPlayFabJsonObject*> Contents;
+    /** Contents, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        TArray<FPlayFabJsonView> ContentsView;
     /** Available methods by which the user can pay. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         TArray<UPlayFabJsonObject*> PaymentOptions;
+    /** PaymentOptions, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        TArray<FPlayFabJsonView> PaymentOptionsView;
     /** Current virtual currency totals for the user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrencyBalances;
+    /** VirtualCurrencyBalances, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyBalancesView;
 };
 
 USTRUCT(BlueprintType)
@@ -1993,9 +2111,15 @@ public:
     /** Items granted to the player as a result of unlocking the container. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         TArray<UPlayFabJsonObject*> GrantedItems;
+    /** GrantedItems, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        TArray<FPlayFabJsonView> GrantedItemsView;
     /** Virtual currency granted to the player as a result of unlocking the container. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrency;
+    /** VirtualCurrency, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyView;
 };
 
 USTRUCT(BlueprintType)
@@ -2069,6 +2193,9 @@ public:
     /** Array of friends found. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Friend List Management Models")
         TArray<UPlayFabJsonObject*> Friends;
+    /** Friends, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Friend List Management Models")
+        TArray<FPlayFabJsonView> FriendsView;
 };
 
 USTRUCT(BlueprintType)
@@ -2143,6 +2270,9 @@ public:
     /** array of games found */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Matchmaking Models")
         TArray<UPlayFabJsonObject*> Games;
+    /** Games, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Matchmaking Models")
+        TArray<FPlayFabJsonView> GamesView;
     /** total number of players across all servers */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Matchmaking Models")
         int32 PlayerCount;
@@ -2169,6 +2299,9 @@ public:
     /** array of regions found matching the request parameters */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Matchmaking Models")
         TArray<UPlayFabJsonObject*> Regions;
+    /** Regions, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Matchmaking Models")
+        TArray<FPlayFabJsonView> RegionsView;
 };
 
 USTRUCT(BlueprintType)
@@ -2415,6 +2548,9 @@ public:
     /** Data for the requested keys. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Shared Group Data Models")
         UPlayFabJsonObject* Data = nullptr;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Shared Group Data Models")
+        FPlayFabJsonView DataView;
     /** List of PlayFabId identifiers for the members of this group, if requested. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Shared Group Data Models")
         FString Members;
@@ -2507,12 +2643,18 @@ public:
     /** The object returned from the CloudScript function, if any */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Server-Side Cloud Script Models")
         UPlayFabJsonObject* FunctionResult = nullptr;
+    /** FunctionResult, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Server-Side Cloud Script Models")
+        FPlayFabJsonView FunctionResultView;
     /** Flag indicating if the FunctionResult was too large and was subsequently dropped from this event. This only occurs if the total event size is larger than 350KB. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Server-Side Cloud Script Models")
         bool FunctionResultTooLarge;
     /** Entries logged during the function execution. These include both entries logged in the function code using log.info() and log.error() and error entries for API and HTTP request failures. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Server-Side Cloud Script Models")
         TArray<UPlayFabJsonObject*> Logs;
+    /** Logs, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Server-Side Cloud Script Models")
+        TArray<FPlayFabJsonView> LogsView;
     /** Flag indicating if the logs were too large and were subsequently dropped from this event. This only occurs if the total event size is larger than 350KB after the FunctionResult was removed. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Server-Side Cloud Script Models")
         bool LogsTooLarge;
@@ -2532,6 +2674,9 @@ public:
     /** Information about the error, if any, that occurred during execution */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Server-Side Cloud Script Models")
         UPlayFabJsonObject* Error = nullptr;
+    /** Error, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Server-Side Cloud Script Models")
+        FPlayFabJsonView ErrorView;
 };
 
 
@@ -2588,6 +2733,9 @@ public:
     /** The requested list of characters. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Characters Models")
         TArray<UPlayFabJsonObject*> Characters;
+    /** Characters, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Characters Models")
+        TArray<FPlayFabJsonView> CharactersView;
 };
 
 USTRUCT(BlueprintType)
@@ -2617,6 +2765,9 @@ public:
     /** Ordered list of leaderboard entries. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Characters Models")
         TArray<UPlayFabJsonObject*> Leaderboard;
+    /** Leaderboard, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Characters Models")
+        TArray<FPlayFabJsonView> LeaderboardView;
 };
 
 USTRUCT(BlueprintType)
@@ -2637,6 +2788,9 @@ public:
     /** The requested character statistics. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Characters Models")
         UPlayFabJsonObject* CharacterStatistics;
+    /** CharacterStatistics, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Characters Models")
+        FPlayFabJsonView CharacterStatisticsView;
 };
 
 USTRUCT(BlueprintType)
@@ -2666,6 +2820,9 @@ public:
     /** Ordered list of leaderboard entries. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Characters Models")
         TArray<UPlayFabJsonObject*> Leaderboard;
+    /** Leaderboard, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Characters Models")
+        TArray<FPlayFabJsonView> LeaderboardView;
 };
 
 USTRUCT(BlueprintType)
@@ -2689,6 +2846,9 @@ public:
     /** Ordered list of leaderboard entries. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Characters Models")
         TArray<UPlayFabJsonObject*> Leaderboard;
+    /** Leaderboard, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Characters Models")
+        TArray<FPlayFabJsonView> LeaderboardView;
 };
 
 USTRUCT(BlueprintType)
@@ -2778,6 +2938,9 @@ public:
     /** User specific data for this title. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Character Data Models")
         UPlayFabJsonObject* Data = nullptr;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Character Data Models")
+        FPlayFabJsonView DataView;
     /** Indicates the current version of the data that has been set. This is incremented with every set call for that type of data (read-only, internal, etc). This version can be provided in Get calls to find updated data. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Character Data Models")
         int32 DataVersion;
@@ -2841,6 +3004,9 @@ public:
     /** Details about trade which was just accepted. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Trading Models")
         UPlayFabJsonObject* Trade = nullptr;
+    /** Trade, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Trading Models")
+        FPlayFabJsonView TradeView;
 };
 
 USTRUCT(BlueprintType)
@@ -2861,6 +3027,9 @@ public:
     /** Details about trade which was just canceled. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Trading Models")
         UPlayFabJsonObject* Trade = nullptr;
+    /** Trade, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Trading Models")
+        FPlayFabJsonView TradeView;
 };
 
 USTRUCT(BlueprintType)
@@ -2881,9 +3050,15 @@ public:
     /** The trades for this player which are currently available to be accepted. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Trading Models")
         TArray<UPlayFabJsonObject*> OpenedTrades;
+    /** OpenedTrades, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Trading Models")
+        TArray<FPlayFabJsonView> OpenedTradesView;
     /** History of trades which this player has accepted. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Trading Models")
         TArray<UPlayFabJsonObject*> AcceptedTrades;
+    /** AcceptedTrades, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Trading Models")
+        TArray<FPlayFabJsonView> AcceptedTradesView;
 };
 
 USTRUCT(BlueprintType)
@@ -2907,6 +3082,9 @@ public:
     /** Information about the requested trade. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Trading Models")
         UPlayFabJsonObject* Trade = nullptr;
+    /** Trade, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Trading Models")
+        FPlayFabJsonView TradeView;
 };
 
 USTRUCT(BlueprintType)
@@ -2933,6 +3111,9 @@ public:
     /** The information about the trade that was just opened. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Trading Models")
         UPlayFabJsonObject* Trade = nullptr;
+    /** Trade, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | Trading Models")
+        FPlayFabJsonView TradeView;
 };
 
 
@@ -2985,6 +3166,9 @@ public:
     /** Array of segments the requested player currently belongs to. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | PlayStream Models")
         TArray<UPlayFabJsonObject*> Segments;
+    /** Segments, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Client | PlayStream Models")
+        TArray<FPlayFabJsonView> SegmentsView;
 };
 
 USTRUCT(BlueprintType)
@@ -7,6 +7,7 @@
 //////////////////////////////////////////////////////////////////////////////////////////////
 
 #include "Kismet/BlueprintFunctionLibrary.h"
+#include "PlayFabRequestTypes.h"
 #include "PlayFabUtilities.generated.h"
 
 class UPlayFabJsonObject;
@@ -20,10 +21,158 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
         static void setPlayFabSettings(FString GameTitleId, FString PhotonRealtimeAppId = "", FString PhotonTurnbasedAppId = "", FString PhotonChatAppId = "");
 
+    /** Send every call to this base url, e.g. "http://127.0.0.1:7780", instead of the title's production endpoint. Empty restores the default */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setServerUrl(FString ServerUrl);
+
+    /** Answer calls from a local stand-in server on Port, scripted by ScriptFile if given, and point the SDK at it */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static bool startStandInServer(int32 Port = 7780, FString ScriptFile = "");
+
+    /** Stop the stand-in server and point the SDK back where it was */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void stopStandInServer();
+
+    /** Set how many PlayFab requests may be on the wire at once. Further calls wait in a queue until a connection frees up. */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setMaxConcurrentRequests(int32 MaxInFlight = 8);
+
+    /** Set how many calls of a priority class may wait for a connection, and what happens to new calls once that many are waiting */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setRequestQueuePolicy(EPlayFabRequestPriority Priority, int32 Capacity, EPlayFabQueueOverflowPolicy Overflow);
+
+    /** Override the default priority class of an endpoint, e.g. "/Client/GetLeaderboard" */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setEndpointPriority(const FString& Endpoint, EPlayFabRequestPriority Priority);
+
+    /** Configure retries of failed calls. Throttled calls are always retried, calls that may have reached the server only when they are safe to repeat. */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setRetryPolicy(int32 MaxAttempts = 4, float BaseDelaySeconds = 0.5f, float MaxDelaySeconds = 20.0f);
+
+    /** Hold calls to an endpoint for BaseSeconds when it answers with a throttling error, doubling while it stays throttled, up to MaxSeconds. 0 turns it off */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setThrottlePause(float BaseSeconds = 1.0f, float MaxSeconds = 30.0f);
+
+    /** Returns true while calls to Endpoint, e.g. "/Client/GetLeaderboard", are held because it was throttled, and for how much longer */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Settings")
+        static bool isEndpointPaused(const FString& Endpoint, float& SecondsRemaining);
+
+    /** Hold calls made just after startup until a random point within this many seconds, to spread the logins of many processes started together */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setStartupSpreadWindow(float WindowSeconds);
+
+    /** Gzip request bodies of at least ThresholdBytes on a worker thread before they are sent */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setRequestCompression(bool Enabled = true, int32 ThresholdBytes = 1024);
+
+    /** Returns how many request bodies have been gzipped, and how much upload that saved */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Settings")
+        static void getRequestCompressionStats(int32& CompressedRequests, int32& KilobytesSaved);
+
+    /** Let a read call share the response of an identical one already in flight, instead of sending its own */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setReadDeduplication(bool Enabled = true);
+
+    /** Leave null fields out of request bodies instead of sending them as null. Smaller requests, same meaning to the service */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setOmitNullRequestFields(bool Enabled = true);
+
+    /** Answer repeats of a read-only call to Endpoint, e.g. "/Client/GetTitleData", from a cache for Seconds. 0 stops caching it */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setResponseCacheTtl(const FString& Endpoint, float Seconds = 60.0f);
+
+    /** Set how many kilobytes of responses the cache keeps before dropping the least recently used */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setResponseCacheBudget(int32 Kilobytes = 4096);
+
+    /** Drop every cached response, e.g. after changing title data */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void clearResponseCache();
+
+    /** Returns how many cacheable calls were answered from the cache or sent, and how many responses were evicted */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Settings")
+        static void getResponseCacheStats(int32& Hits, int32& Misses, int32& Evictions);
+
+    /** Index the catalog saved by an earlier run, so it can be queried before it is fetched again. "" is the primary catalog */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Catalog")
+        static bool loadCatalogSnapshot(const FString& CatalogVersion);
+
+    /** Find an item of the last fetched catalog by ItemId. Returns false if there is no such item */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Catalog")
+        static bool findCatalogItem(const FString& CatalogVersion, const FString& ItemId, int32& ItemIndex);
+
+    /** Returns the main fields of a catalog item found by findCatalogItem or one of the catalog queries */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Catalog")
+        static bool getCatalogItemInfo(const FString& CatalogVersion, int32 ItemIndex, FString& ItemId, FString& ItemClass, FString& DisplayName, FString& Description, FString& CustomData);
+
+    /** Returns every item of an ItemClass */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Catalog")
+        static void getCatalogItemsByClass(const FString& CatalogVersion, const FString& ItemClass, TArray<int32>& ItemIndices);
+
+    /** Returns every item with a Tag */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Catalog")
+        static void getCatalogItemsByTag(const FString& CatalogVersion, const FString& Tag, TArray<int32>& ItemIndices);
+
+    /** Returns the price of an item in a virtual currency, false if it isn't sold for it */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Catalog")
+        static bool getCatalogItemPrice(const FString& CatalogVersion, int32 ItemIndex, const FString& Currency, int32& Price);
+
+    /** Set the fraction of calls, 0 to 1, whose request and response bodies are kept in the trace. Failed calls are always kept */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setTraceSampleRate(float SampleRate = 0.0f);
+
+    /** Write the recent request trace to the log */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void dumpRequestTrace();
+
+    /** Returns how long a stage of calls to Endpoint, e.g. "/Client/GetTitleData", took at a percentile. False if it hasn't been called */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Metrics")
+        static bool getEndpointLatency(const FString& Endpoint, EPlayFabCallStage Stage, float Percentile, float& Milliseconds);
+
+    /** Returns how many attempts of calls to Endpoint were made and failed, and their mean request and response sizes */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Metrics")
+        static bool getEndpointCallStats(const FString& Endpoint, int32& Attempts, int32& Errors, float& MeanRequestBytes, float& MeanResponseBytes);
+
+    /** Returns how many calls to Endpoint failed with ErrorCode. Transport failures and dropped calls count as code 0 */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Metrics")
+        static int32 getEndpointErrorCount(const FString& Endpoint, int32 ErrorCode);
+
+    /** Returns every endpoint that has been called */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Metrics")
+        static void getMeasuredEndpoints(TArray<FString>& Endpoints);
+
+    /** Zero every endpoint's metrics */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Metrics")
+        static void resetMetrics();
+
+    /** Write every endpoint's metrics to the log */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Metrics")
+        static void dumpMetrics();
+
+    /** Returns the number of calls waiting for a free connection, and the number currently on the wire */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Settings")
+        static void getPendingCallCounts(int32& Queued, int32& InFlight);
+
+    /** Reuse the objects calls are made through, keeping up to MaxFreePerClass of each API. Off by default. Calls made from Blueprints are never reused */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setManagerPooling(bool Enabled = true, int32 MaxFreePerClass = 256);
+
+    /** Returns how many call objects the pool has created and reused, how many calls are in flight and how many objects are free */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Metrics")
+        static void getManagerPoolStats(int32& Created, int32& Reused, int32& Active, int32& Free);
+
+    /** Fill the Json Object fields of results from the View fields beside them, for graphs made before views. Only done for results passed to a Blueprint. On by default, turn it off once no graph reads them */
+    UFUNCTION(BlueprintCallable, Category = "PlayFab | Settings")
+        static void setJsonObjectFields(bool Enabled = true);
+
     /** Returns the error code text given the error code */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Errors")
         static FString getErrorText(int32 code);
 
+    /** Returns what kind of failure the error code is: retryable, throttled, expired authentication, permanent or a bad request */
+    UFUNCTION(BlueprintPure, Category = "PlayFab | Errors")
+        static EPlayFabErrorCategory getErrorCategory(int32 code);
+
     /** Returns the requested photon application id. */
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Photon | Authentication")
         static FString getPhotonAppId(bool Realtime = false, bool Chat = false, bool Turnbased = false);
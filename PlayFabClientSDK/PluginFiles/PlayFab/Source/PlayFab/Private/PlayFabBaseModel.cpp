@@ -8,23 +8,45 @@
 const int ERROR_DETAILS_INIT_BUFFER_SIZE = 10000;
 
 void FPlayFabError::decodeError(UPlayFabJsonObject* responseData)
+{
+    decodeError(responseData->GetRootObject().Get());
+}
+
+void FPlayFabError::decodeError(const FJsonObject* responseData)
 {
     // Check if we have an error
-    if (!responseData->HasField("code") || int(responseData->GetNumberField("code")) != 200) // We have an error
+    double code = 0;
+    if (responseData == nullptr || !responseData->TryGetNumberField(TEXT("code"), code) || int(code) != 200) // We have an error
     {
         hasError = true;
-        ErrorCode = int(responseData->GetNumberField("errorCode"));
-        ErrorName = responseData->GetStringField("error");
-        ErrorMessage = responseData->GetStringField("errorMessage");
-        if (responseData->HasField("errorDetails"))
+        ErrorCode = 0;
+        ErrorName.Empty();
+        ErrorMessage.Empty();
+        ErrorDetails.Empty(0);
+        if (responseData == nullptr)
+        {
+            return;
+        }
+
+        double errorCode = 0;
+        responseData->TryGetNumberField(TEXT("errorCode"), errorCode);
+        ErrorCode = int(errorCode);
+        responseData->TryGetStringField(TEXT("error"), ErrorName);
+        responseData->TryGetStringField(TEXT("errorMessage"), ErrorMessage);
+
+        const TSharedPtr<FJsonObject>* detailsObj = nullptr;
+        if (responseData->TryGetObjectField(TEXT("errorDetails"), detailsObj))
         {
             ErrorDetails.Empty(ERROR_DETAILS_INIT_BUFFER_SIZE);
-            auto detailsObj = responseData->GetObjectField("errorDetails");
             int count = 0;
-            for (auto detailParamPair = detailsObj->GetRootObject()->Values.CreateConstIterator(); detailParamPair; ++detailParamPair)
+            for (auto detailParamPair = (*detailsObj)->Values.CreateConstIterator(); detailParamPair; ++detailParamPair)
             {
-                auto errorArray = detailParamPair->Value->AsArray();
-                for (auto paramMsg = errorArray.CreateConstIterator(); paramMsg; ++paramMsg)
+                const TArray<TSharedPtr<FJsonValue>>* errorArray = nullptr;
+                if (!detailParamPair->Value->TryGetArray(errorArray))
+                {
+                    continue;
+                }
+                for (auto paramMsg = errorArray->CreateConstIterator(); paramMsg; ++paramMsg)
                 {
                     if (count != 0)
                         ErrorDetails += "\n";
@@ -35,10 +57,6 @@ void FPlayFabError::decodeError(UPlayFabJsonObject* responseData)
                 }
             }
         }
-        else
-        {
-            ErrorDetails.Empty(0);
-        }
     }
     else { hasError = false; }
 }
@@ -0,0 +1,437 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab benchmark commandlet.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabBenchmarkCommandlet.h"
+#include "PlayFabJsonObject.h"
+
+/** The apis that may be compiled into this plugin. Missing ones are skipped */
+static const TCHAR* BenchmarkApis[] = { TEXT("Client"), TEXT("Server"), TEXT("Admin"), TEXT("Matchmaker") };
+
+/** Used for decoders that have no recorded response */
+static const ANSICHAR EmptyFixture[] = "{\"code\":200,\"status\":\"OK\",\"data\":{}}";
+
+/**
+ * Stands in for GMalloc while the benchmarks run and counts the allocations made by the benchmark thread.
+ * Everything is forwarded to the allocator it replaced, so memory allocated before or after is unaffected
+ */
+class FPlayFabCountingMalloc : public FMalloc
+{
+public:
+    explicit FPlayFabCountingMalloc(FMalloc* InInner)
+        : Inner(InInner)
+        , CountedThreadId(FPlatformTLS::GetCurrentThreadId())
+        , bCounting(false)
+        , Allocations(0)
+        , Bytes(0)
+    {
+    }
+
+    void Start()
+    {
+        Allocations = 0;
+        Bytes = 0;
+        bCounting = true;
+    }
+
+    void Stop() { bCounting = false; }
+
+    int64 GetAllocations() const { return Allocations; }
+    int64 GetBytes() const { return Bytes; }
+
+    virtual void* Malloc(SIZE_T Count, uint32 Alignment) override
+    {
+        Record(Count);
+        return Inner->Malloc(Count, Alignment);
+    }
+
+    virtual void* Realloc(void* Original, SIZE_T Count, uint32 Alignment) override
+    {
+        Record(Count);
+        return Inner->Realloc(Original, Count, Alignment);
+    }
+
+    virtual void Free(void* Original) override { Inner->Free(Original); }
+    virtual bool GetAllocationSize(void* Original, SIZE_T& SizeOut) override { return Inner->GetAllocationSize(Original, SizeOut); }
+    virtual void Trim() override { Inner->Trim(); }
+    virtual void SetupTLSCachesOnCurrentThread() override { Inner->SetupTLSCachesOnCurrentThread(); }
+    virtual void ClearAndDisableTLSCachesOnCurrentThread() override { Inner->ClearAndDisableTLSCachesOnCurrentThread(); }
+    virtual bool IsInternallyThreadSafe() const override { return Inner->IsInternallyThreadSafe(); }
+    virtual bool ValidateHeap() override { return Inner->ValidateHeap(); }
+    virtual const TCHAR* GetDescriptiveName() override { return Inner->GetDescriptiveName(); }
+
+    FMalloc* GetInner() const { return Inner; }
+
+private:
+    void Record(SIZE_T Count)
+    {
+        // Engine threads keep allocating while we run, only our own allocations are the benchmark's
+        if (bCounting && FPlatformTLS::GetCurrentThreadId() == CountedThreadId)
+        {
+            ++Allocations;
+            Bytes += Count;
+        }
+    }
+
+    FMalloc* Inner;
+    uint32 CountedThreadId;
+    volatile bool bCounting;
+    int64 Allocations;
+    int64 Bytes;
+};
+
+struct FPlayFabBenchmarkResult
+{
+    double NsPerOp = 0.0;
+    double AllocsPerOp = 0.0;
+    double BytesPerOp = 0.0;
+};
+
+/** Runs the benchmarks and keeps their results in the order they ran */
+class FPlayFabBenchmarkRunner
+{
+public:
+    FPlayFabBenchmarkRunner(FPlayFabCountingMalloc& InCounter, int32 InIterations, const FString& InFilter)
+        : Counter(InCounter)
+        , Iterations(InIterations)
+        , Filter(InFilter)
+    {
+    }
+
+    template<typename OpType>
+    void Run(const FString& Name, OpType Op)
+    {
+        if (!Filter.IsEmpty() && !Name.Contains(Filter))
+        {
+            return;
+        }
+
+        // Warm the per-thread buffers and caches, then collect the garbage the warmup and earlier benchmarks left
+        const int32 WarmupIterations = FMath::Clamp(Iterations / 10, 1, 100);
+        for (int32 Iteration = 0; Iteration < WarmupIterations; ++Iteration)
+        {
+            Op();
+        }
+        CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+        Counter.Start();
+        const uint64 StartCycles = FPlatformTime::Cycles64();
+        for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+        {
+            Op();
+        }
+        const uint64 EndCycles = FPlatformTime::Cycles64();
+        Counter.Stop();
+
+        FPlayFabBenchmarkResult Result;
+        Result.NsPerOp = FPlatformTime::GetSecondsPerCycle64() * (EndCycles - StartCycles) * 1e9 / Iterations;
+        Result.AllocsPerOp = (double)Counter.GetAllocations() / Iterations;
+        Result.BytesPerOp = (double)Counter.GetBytes() / Iterations;
+        Names.Add(Name);
+        Results.Add(Name, Result);
+    }
+
+    TArray<FString> Names;
+    TMap<FString, FPlayFabBenchmarkResult> Results;
+
+private:
+    FPlayFabCountingMalloc& Counter;
+    int32 Iterations;
+    FString Filter;
+};
+
+/** A recorded response, in every form the benchmarked stages take as input */
+struct FPlayFabFixture
+{
+    TArray<uint8> Content;
+    TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Body;
+    FString Text;
+    TSharedPtr<FJsonObject> Json;
+    UPlayFabJsonObject* JsonObject = nullptr;
+};
+
+static bool LoadFixture(const FString& Path, FPlayFabFixture& OutFixture)
+{
+    if (!FFileHelper::LoadFileToArray(OutFixture.Content, *Path, FILEREAD_Silent))
+    {
+        OutFixture.Content.Reset();
+        OutFixture.Content.Append((const uint8*)EmptyFixture, sizeof(EmptyFixture) - 1);
+    }
+
+    int32 BodySize = 0;
+    const uint8* Body = FPlayFabResponseReader::GetBody(OutFixture.Content, BodySize);
+    if (Body == nullptr || !FPlayFabResponseReader::Deserialize(Body, BodySize, OutFixture.Json))
+    {
+        UE_LOG(LogPlayFab, Error, TEXT("Fixture %s is not a json object"), *Path);
+        return false;
+    }
+
+    OutFixture.Body = MakeShareable(new TArray<uint8>(Body, BodySize));
+
+    const FUTF8ToTCHAR Text((const ANSICHAR*)Body, BodySize);
+    OutFixture.Text = FString(Text.Length(), Text.Get());
+
+    OutFixture.JsonObject = NewObject<UPlayFabJsonObject>();
+    OutFixture.JsonObject->AddToRoot();
+    OutFixture.JsonObject->SetRootObject(OutFixture.Json);
+    return true;
+}
+
+/** The struct a factory hands to its success delegate, which is also what its decoder returns */
+static UScriptStruct* GetResultStruct(UFunction* Factory)
+{
+    UDelegateProperty* OnSuccess = FindField<UDelegateProperty>(Factory, TEXT("onSuccess"));
+    if (OnSuccess == nullptr || OnSuccess->SignatureFunction == nullptr)
+    {
+        return nullptr;
+    }
+
+    for (TFieldIterator<UStructProperty> It(OnSuccess->SignatureFunction); It; ++It)
+    {
+        return It->Struct;
+    }
+    return nullptr;
+}
+
+static void BenchmarkApi(FPlayFabBenchmarkRunner& Runner, const TCHAR* Api, const FString& FixtureDirectory)
+{
+    UClass* ApiClass = FindObject<UClass>(ANY_PACKAGE, *FString::Printf(TEXT("PlayFab%sAPI"), Api));
+    UClass* DecoderClass = FindObject<UClass>(ANY_PACKAGE, *FString::Printf(TEXT("PlayFab%sModelDecoder"), Api));
+    if (ApiClass == nullptr || DecoderClass == nullptr)
+    {
+        return;
+    }
+
+    UFunction* ReleaseToPool = ApiClass->FindFunctionByName(TEXT("ReleaseToPool"));
+    UObject* ApiObject = ApiClass->GetDefaultObject();
+    UObject* DecoderObject = DecoderClass->GetDefaultObject();
+
+    // Decoders and one pass readers are matched to calls by the struct they return
+    TMap<UScriptStruct*, UFunction*> DecoderByResult;
+    TMap<UScriptStruct*, UFunction*> ReaderByResult;
+    for (TFieldIterator<UFunction> It(DecoderClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+    {
+        UStructProperty* ReturnProperty = Cast<UStructProperty>(It->GetReturnProperty());
+        if (It->HasAnyFunctionFlags(FUNC_Static) && ReturnProperty != nullptr)
+        {
+            (It->GetName().StartsWith(TEXT("read")) ? ReaderByResult : DecoderByResult).Add(ReturnProperty->Struct, *It);
+        }
+    }
+
+    for (TFieldIterator<UFunction> It(ApiClass, EFieldIteratorFlags::ExcludeSuper); It; ++It)
+    {
+        UFunction* Factory = *It;
+        UObjectProperty* ManagerProperty = Cast<UObjectProperty>(Factory->GetReturnProperty());
+        if (!Factory->HasAnyFunctionFlags(FUNC_Static) || ManagerProperty == nullptr || ManagerProperty->PropertyClass != ApiClass)
+        {
+            continue;
+        }
+
+        const FString Call = FString::Printf(TEXT("%s/%s"), Api, *Factory->GetName());
+        TArray<uint8> FactoryParams;
+        FactoryParams.SetNumZeroed(Factory->ParmsSize);
+
+        // Build the manager, which streams the request into its body. The manager goes back to the pool
+        // afterwards, as it would once its response was delivered
+        Runner.Run(TEXT("Request/") + Call, [&]()
+        {
+            Factory->InitializeStruct(FactoryParams.GetData());
+            ApiObject->ProcessEvent(Factory, FactoryParams.GetData());
+            UObject* Manager = ManagerProperty->GetObjectPropertyValue_InContainer(FactoryParams.GetData());
+            if (ReleaseToPool != nullptr)
+            {
+                Manager->ProcessEvent(ReleaseToPool, nullptr);
+            }
+            Factory->DestroyStruct(FactoryParams.GetData());
+        });
+
+        FPlayFabFixture Fixture;
+        if (!LoadFixture(FixtureDirectory / Call + TEXT(".json"), Fixture))
+        {
+            continue;
+        }
+
+        const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe> Content = MakeShareable(new TArray<uint8>(Fixture.Content));
+        Runner.Run(TEXT("Reader/") + Call, [&Content]()
+        {
+            FPlayFabParsedResponse Parsed;
+            FPlayFabResponseReader::Decode(Content, Parsed);
+        });
+
+        UPlayFabJsonObject* DecodeTarget = NewObject<UPlayFabJsonObject>();
+        DecodeTarget->AddToRoot();
+        Runner.Run(TEXT("DecodeJson/") + Call, [&Fixture, DecodeTarget]()
+        {
+            DecodeTarget->DecodeJson(Fixture.Text);
+        });
+        DecodeTarget->RemoveFromRoot();
+
+        Runner.Run(TEXT("DecodeError/") + Call, [&Fixture]()
+        {
+            FPlayFabError Error;
+            Error.decodeError(Fixture.Json.Get());
+        });
+
+        UScriptStruct* ResultStruct = GetResultStruct(Factory);
+        UFunction* Decoder = ResultStruct != nullptr ? DecoderByResult.FindRef(ResultStruct) : nullptr;
+        UObjectProperty* ResponseProperty = Decoder != nullptr ? FindField<UObjectProperty>(Decoder, TEXT("response")) : nullptr;
+        if (ResponseProperty != nullptr)
+        {
+            TArray<uint8> DecoderParams;
+            DecoderParams.SetNumZeroed(Decoder->ParmsSize);
+            Runner.Run(TEXT("Decoder/") + Call, [&]()
+            {
+                Decoder->InitializeStruct(DecoderParams.GetData());
+                ResponseProperty->SetObjectPropertyValue_InContainer(DecoderParams.GetData(), Fixture.JsonObject);
+                DecoderObject->ProcessEvent(Decoder, DecoderParams.GetData());
+                Decoder->DestroyStruct(DecoderParams.GetData());
+            });
+        }
+
+        UFunction* Reader = ResultStruct != nullptr ? ReaderByResult.FindRef(ResultStruct) : nullptr;
+        UStructProperty* ModelProperty = Reader != nullptr ? FindField<UStructProperty>(Reader, TEXT("response")) : nullptr;
+        if (ModelProperty != nullptr && ModelProperty->Struct == FPlayFabBaseModel::StaticStruct())
+        {
+            TArray<uint8> ReaderParams;
+            ReaderParams.SetNumZeroed(Reader->ParmsSize);
+            Runner.Run(TEXT("Stream/") + Call, [&]()
+            {
+                Reader->InitializeStruct(ReaderParams.GetData());
+                FPlayFabBaseModel* Model = ModelProperty->ContainerPtrToValuePtr<FPlayFabBaseModel>(ReaderParams.GetData());
+                Model->responseData = Fixture.JsonObject;
+                Model->responseBody = Fixture.Body;
+                DecoderObject->ProcessEvent(Reader, ReaderParams.GetData());
+                Reader->DestroyStruct(ReaderParams.GetData());
+            });
+        }
+        Fixture.JsonObject->RemoveFromRoot();
+    }
+}
+
+static bool LoadBaseline(const FString& Path, TMap<FString, FPlayFabBenchmarkResult>& OutBaseline)
+{
+    FString Text;
+    TSharedPtr<FJsonObject> Root;
+    if (!FFileHelper::LoadFileToString(Text, *Path) || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Root) || !Root.IsValid())
+    {
+        return false;
+    }
+
+    const TSharedPtr<FJsonObject>* Benchmarks = nullptr;
+    if (!Root->TryGetObjectField(TEXT("Benchmarks"), Benchmarks))
+    {
+        return false;
+    }
+
+    for (const auto& Entry : (*Benchmarks)->Values)
+    {
+        const TSharedPtr<FJsonObject>& Values = Entry.Value->AsObject();
+        if (Values.IsValid())
+        {
+            FPlayFabBenchmarkResult& Result = OutBaseline.Add(Entry.Key);
+            Result.NsPerOp = Values->GetNumberField(TEXT("NsPerOp"));
+            Result.AllocsPerOp = Values->GetNumberField(TEXT("AllocsPerOp"));
+            Result.BytesPerOp = Values->GetNumberField(TEXT("BytesPerOp"));
+        }
+    }
+    return true;
+}
+
+static bool SaveBaseline(const FString& Path, const FPlayFabBenchmarkRunner& Runner, int32 Iterations)
+{
+    TSharedRef<FJsonObject> Benchmarks = MakeShareable(new FJsonObject());
+    for (const FString& Name : Runner.Names)
+    {
+        const FPlayFabBenchmarkResult& Result = Runner.Results.FindChecked(Name);
+        TSharedRef<FJsonObject> Values = MakeShareable(new FJsonObject());
+        Values->SetNumberField(TEXT("NsPerOp"), Result.NsPerOp);
+        Values->SetNumberField(TEXT("AllocsPerOp"), Result.AllocsPerOp);
+        Values->SetNumberField(TEXT("BytesPerOp"), Result.BytesPerOp);
+        Benchmarks->SetObjectField(Name, Values);
+    }
+
+    TSharedRef<FJsonObject> Root = MakeShareable(new FJsonObject());
+    Root->SetNumberField(TEXT("Iterations"), Iterations);
+    Root->SetObjectField(TEXT("Benchmarks"), Benchmarks);
+
+    FString Text;
+    FJsonSerializer::Serialize(Root, TJsonWriterFactory<>::Create(&Text));
+    return FFileHelper::SaveStringToFile(Text, *Path);
+}
+
+UPlayFabBenchmarkCommandlet::UPlayFabBenchmarkCommandlet()
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+int32 UPlayFabBenchmarkCommandlet::Main(const FString& Params)
+{
+    FString FixtureDirectory = FPaths::GameSavedDir() / TEXT("PlayFab/Fixtures");
+    FString BaselinePath = FPaths::GameSavedDir() / TEXT("PlayFab/BenchmarkBaseline.json");
+    FString Filter;
+    int32 Iterations = 1000;
+    float Tolerance = 0.1f;
+    FParse::Value(*Params, TEXT("fixtures="), FixtureDirectory);
+    FParse::Value(*Params, TEXT("baseline="), BaselinePath);
+    FParse::Value(*Params, TEXT("filter="), Filter);
+    FParse::Value(*Params, TEXT("iterations="), Iterations);
+    FParse::Value(*Params, TEXT("tolerance="), Tolerance);
+    const bool bWriteBaseline = FParse::Param(*Params, TEXT("writebaseline"));
+    Iterations = FMath::Max(Iterations, 1);
+
+    // Never destroyed, other threads may still be inside it after GMalloc is restored
+    static FPlayFabCountingMalloc* Counter = new FPlayFabCountingMalloc(GMalloc);
+    GMalloc = Counter;
+
+    FPlayFabBenchmarkRunner Runner(*Counter, Iterations, Filter);
+    for (const TCHAR* Api : BenchmarkApis)
+    {
+        BenchmarkApi(Runner, Api, FixtureDirectory);
+    }
+
+    GMalloc = Counter->GetInner();
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+
+    TMap<FString, FPlayFabBenchmarkResult> Baseline;
+    const bool bHasBaseline = !bWriteBaseline && LoadBaseline(BaselinePath, Baseline);
+
+    int32 RegressionCount = 0;
+    for (const FString& Name : Runner.Names)
+    {
+        const FPlayFabBenchmarkResult& Result = Runner.Results.FindChecked(Name);
+        const FPlayFabBenchmarkResult* Previous = Baseline.Find(Name);
+        if (Previous == nullptr)
+        {
+            UE_LOG(LogPlayFab, Display, TEXT("%-64s %10.0f ns/op %8.1f allocs/op %10.0f B/op"), *Name, Result.NsPerOp, Result.AllocsPerOp, Result.BytesPerOp);
+            continue;
+        }
+
+        // Allocation counts are deterministic, so any increase is a regression, while time gets the tolerance for noise
+        const bool bRegressed = Result.NsPerOp > Previous->NsPerOp * (1.0f + Tolerance) || Result.AllocsPerOp > Previous->AllocsPerOp + 0.5;
+        RegressionCount += bRegressed ? 1 : 0;
+        const double TimeChange = Previous->NsPerOp > 0.0 ? (Result.NsPerOp / Previous->NsPerOp - 1.0) * 100.0 : 0.0;
+        UE_LOG(LogPlayFab, Display, TEXT("%-64s %10.0f ns/op %8.1f allocs/op %10.0f B/op  %+6.1f%% time %+8.1f allocs%s"),
+            *Name, Result.NsPerOp, Result.AllocsPerOp, Result.BytesPerOp, TimeChange, Result.AllocsPerOp - Previous->AllocsPerOp, bRegressed ? TEXT("  REGRESSED") : TEXT(""));
+    }
+
+    if (bWriteBaseline)
+    {
+        if (!SaveBaseline(BaselinePath, Runner, Iterations))
+        {
+            UE_LOG(LogPlayFab, Error, TEXT("Failed to write benchmark baseline %s"), *BaselinePath);
+            return 1;
+        }
+        UE_LOG(LogPlayFab, Display, TEXT("Wrote %d benchmarks to %s"), Runner.Names.Num(), *BaselinePath);
+    }
+    else if (!bHasBaseline)
+    {
+        UE_LOG(LogPlayFab, Display, TEXT("No baseline at %s, run with -writebaseline to store one"), *BaselinePath);
+    }
+
+    UE_LOG(LogPlayFab, Display, TEXT("%d benchmarks, %d regressed"), Runner.Names.Num(), RegressionCount);
+    return RegressionCount > 0 ? 1 : 0;
+}
@@ -0,0 +1,386 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab client load test.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabClientLoadTest.h"
+#include "PlayFabJsonReader.h"
+#include "PlayFabJsonObject.h"
+
+static const TCHAR* StepNames[UPlayFabClientLoadTestPlayer::CallStepCount] = { TEXT("Login"), TEXT("GetPlayerCombinedInfo"), TEXT("UpdatePlayerStatistics"), TEXT("PurchaseItem"), TEXT("WritePlayerEvent") };
+
+void UPlayFabClientLoadTestPlayer::Begin(UPlayFabClientLoadTestCommandlet* InDriver, int32 InIndex, const FString& RunId)
+{
+    Driver = InDriver;
+    Session = MakeShareable(new FPlayFabSessionContext());
+    CustomId = FString::Printf(TEXT("LoadTest-%s-%d"), *RunId, InIndex);
+    Random.Initialize(InIndex);
+    Run(EStep::Login);
+}
+
+bool UPlayFabClientLoadTestPlayer::TickThink(double Now)
+{
+    if (Step != EStep::Think || Now < ThinkUntil)
+    {
+        return false;
+    }
+
+    // A player whose login failed tries again, everyone else starts a new cycle
+    Run(Session->SessionTicket.IsEmpty() ? EStep::Login : EStep::Statistics);
+    return true;
+}
+
+void UPlayFabClientLoadTestPlayer::Run(EStep NextStep)
+{
+    if (NextStep != Step)
+    {
+        StepRepeat = 0;
+    }
+    Step = NextStep;
+    CallStartTime = FPlatformTime::Seconds();
+
+    FDelegateOnFailurePlayFabError OnFailure;
+    OnFailure.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UPlayFabClientLoadTestPlayer, OnError));
+
+    switch (Step)
+    {
+    case EStep::Login:
+    {
+        FClientLoginWithCustomIDRequest Request;
+        Request.CustomId = CustomId;
+        Request.CreateAccount = true;
+        UPlayFabClientAPI::FDelegateOnSuccessLoginWithCustomID OnSuccess;
+        OnSuccess.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UPlayFabClientLoadTestPlayer, OnLoggedIn));
+        Send(UPlayFabClientAPI::LoginWithCustomID(Request, OnSuccess, OnFailure, nullptr));
+        break;
+    }
+    case EStep::CombinedInfo:
+    {
+        FClientGetPlayerCombinedInfoRequest Request;
+        Request.PlayFabId = Session->PlayFabId;
+        Request.InfoRequestParameters = NewObject<UPlayFabJsonObject>();
+        Request.InfoRequestParameters->SetBoolField(TEXT("GetUserAccountInfo"), true);
+        Request.InfoRequestParameters->SetBoolField(TEXT("GetUserInventory"), true);
+        Request.InfoRequestParameters->SetBoolField(TEXT("GetUserVirtualCurrency"), true);
+        Request.InfoRequestParameters->SetBoolField(TEXT("GetPlayerStatistics"), true);
+        UPlayFabClientAPI::FDelegateOnSuccessGetPlayerCombinedInfo OnSuccess;
+        OnSuccess.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UPlayFabClientLoadTestPlayer, OnCombinedInfo));
+        Send(UPlayFabClientAPI::GetPlayerCombinedInfo(Request, OnSuccess, OnFailure, nullptr));
+        break;
+    }
+    case EStep::Statistics:
+    {
+        FClientUpdatePlayerStatisticsRequest Request;
+        UPlayFabJsonObject* Statistic = NewObject<UPlayFabJsonObject>();
+        Statistic->SetStringField(TEXT("StatisticName"), FString::Printf(TEXT("LoadTestStat%d"), StepRepeat));
+        Statistic->SetNumberField(TEXT("Value"), Random.RandRange(0, 10000));
+        Request.Statistics.Add(Statistic);
+        UPlayFabClientAPI::FDelegateOnSuccessUpdatePlayerStatistics OnSuccess;
+        OnSuccess.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UPlayFabClientLoadTestPlayer, OnStatisticsUpdated));
+        Send(UPlayFabClientAPI::UpdatePlayerStatistics(Request, OnSuccess, OnFailure, nullptr));
+        break;
+    }
+    case EStep::Purchase:
+    {
+        FClientPurchaseItemRequest Request;
+        Request.ItemId = Driver->ItemId;
+        Request.VirtualCurrency = Driver->Currency;
+        Request.Price = Driver->Price;
+        UPlayFabClientAPI::FDelegateOnSuccessPurchaseItem OnSuccess;
+        OnSuccess.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UPlayFabClientLoadTestPlayer, OnPurchased));
+        Send(UPlayFabClientAPI::PurchaseItem(Request, OnSuccess, OnFailure, nullptr));
+        break;
+    }
+    case EStep::Event:
+    {
+        FClientWriteClientPlayerEventRequest Request;
+        Request.EventName = TEXT("load_test_event");
+        Request.Body = NewObject<UPlayFabJsonObject>();
+        Request.Body->SetNumberField(TEXT("Sequence"), StepRepeat);
+        UPlayFabClientAPI::FDelegateOnSuccessWritePlayerEvent OnSuccess;
+        OnSuccess.BindUFunction(this, GET_FUNCTION_NAME_CHECKED(UPlayFabClientLoadTestPlayer, OnEventWritten));
+        Send(UPlayFabClientAPI::WritePlayerEvent(Request, OnSuccess, OnFailure, nullptr));
+        break;
+    }
+    default:
+        // Jitter the think time so players don't move in lockstep
+        ThinkUntil = CallStartTime + Driver->ThinkSeconds * Random.FRandRange(0.5f, 1.5f);
+        break;
+    }
+}
+
+void UPlayFabClientLoadTestPlayer::Send(UPlayFabClientAPI* Call)
+{
+    Call->SetSessionContext(Session);
+    Call->Activate();
+}
+
+void UPlayFabClientLoadTestPlayer::Finish(bool bSucceeded)
+{
+    Driver->RecordCall(Step, FPlatformTime::Seconds() - CallStartTime, bSucceeded);
+    ++StepRepeat;
+
+    switch (Step)
+    {
+    case EStep::Login:
+        Run(bSucceeded ? EStep::CombinedInfo : EStep::Think);
+        break;
+    case EStep::CombinedInfo:
+        Run(EStep::Statistics);
+        break;
+    case EStep::Statistics:
+        Run(StepRepeat < Driver->StatisticsUpdates ? EStep::Statistics : EStep::Purchase);
+        break;
+    case EStep::Purchase:
+        Run(Driver->Events > 0 ? EStep::Event : EStep::Think);
+        break;
+    case EStep::Event:
+        Run(StepRepeat < Driver->Events ? EStep::Event : EStep::Think);
+        break;
+    default:
+        break;
+    }
+}
+
+void UPlayFabClientLoadTestPlayer::OnLoggedIn(FClientLoginResult result, UObject* customData)
+{
+    Finish(true);
+}
+
+void UPlayFabClientLoadTestPlayer::OnCombinedInfo(FClientGetPlayerCombinedInfoResult result, UObject* customData)
+{
+    Finish(true);
+}
+
+void UPlayFabClientLoadTestPlayer::OnStatisticsUpdated(FClientUpdatePlayerStatisticsResult result, UObject* customData)
+{
+    Finish(true);
+}
+
+void UPlayFabClientLoadTestPlayer::OnPurchased(FClientPurchaseItemResult result, UObject* customData)
+{
+    Finish(true);
+}
+
+void UPlayFabClientLoadTestPlayer::OnEventWritten(FClientWriteEventResponse result, UObject* customData)
+{
+    Finish(true);
+}
+
+void UPlayFabClientLoadTestPlayer::OnError(FPlayFabError error, UObject* customData)
+{
+    // A rejected login leaves no ticket, so the player logs in again after thinking
+    if (Step == EStep::Login)
+    {
+        Session->SessionTicket.Empty();
+    }
+    Finish(false);
+}
+
+UPlayFabClientLoadTestCommandlet::UPlayFabClientLoadTestCommandlet()
+    : ThinkSeconds(1.0f)
+    , StatisticsUpdates(2)
+    , Events(1)
+    , ItemId(TEXT("LoadTestItem"))
+    , Currency(TEXT("GO"))
+    , Price(0)
+    , bRampedUp(false)
+{
+    IsClient = false;
+    IsServer = false;
+    IsEditor = false;
+    LogToConsole = true;
+}
+
+void UPlayFabClientLoadTestCommandlet::TickEngine(float DeltaTime)
+{
+    // The dispatcher finishes calls on the game thread through the task graph and the core ticker, which also ticks the http module
+    FTaskGraphInterface::Get().ProcessThreadUntilIdle(ENamedThreads::GameThread);
+    FTicker::GetCoreTicker().Tick(DeltaTime);
+}
+
+void UPlayFabClientLoadTestCommandlet::RecordCall(UPlayFabClientLoadTestPlayer::EStep Step, double Seconds, bool bSucceeded)
+{
+    FStepResults& Results = Steps[(int32)Step];
+    Results.Latency.Record((uint64)(Seconds * 1000000.0));
+    if (bSucceeded)
+    {
+        ++Results.Succeeded;
+        Results.SucceededAfterRampUp += bRampedUp ? 1 : 0;
+    }
+    else
+    {
+        ++Results.Failed;
+    }
+}
+
+int32 UPlayFabClientLoadTestCommandlet::Main(const FString& Params)
+{
+    int32 PlayerCount = 1000;
+    float RampUpSeconds = 10.0f;
+    float DurationSeconds = 60.0f;
+    float GarbageCollectionInterval = 10.0f;
+    int32 MaxInFlight = 0;
+    int32 Port = 7780;
+    FString Script;
+    FString ServerUrl;
+    FParse::Value(*Params, TEXT("players="), PlayerCount);
+    FParse::Value(*Params, TEXT("rampup="), RampUpSeconds);
+    FParse::Value(*Params, TEXT("duration="), DurationSeconds);
+    FParse::Value(*Params, TEXT("think="), ThinkSeconds);
+    FParse::Value(*Params, TEXT("statsupdates="), StatisticsUpdates);
+    FParse::Value(*Params, TEXT("events="), Events);
+    FParse::Value(*Params, TEXT("item="), ItemId);
+    FParse::Value(*Params, TEXT("currency="), Currency);
+    FParse::Value(*Params, TEXT("price="), Price);
+    FParse::Value(*Params, TEXT("maxinflight="), MaxInFlight);
+    FParse::Value(*Params, TEXT("gcinterval="), GarbageCollectionInterval);
+    FParse::Value(*Params, TEXT("port="), Port);
+    FParse::Value(*Params, TEXT("script="), Script);
+    FParse::Value(*Params, TEXT("url="), ServerUrl);
+    PlayerCount = FMath::Max(PlayerCount, 1);
+    StatisticsUpdates = FMath::Max(StatisticsUpdates, 1);
+
+    if (IPlayFab::Get().getGameTitleId().IsEmpty())
+    {
+        IPlayFab::Get().setGameTitleId(TEXT("LOADTEST"));
+    }
+    if (!ServerUrl.IsEmpty())
+    {
+        IPlayFab::Get().setServerUrl(ServerUrl);
+    }
+    else if (!FPlayFabStandInServer::Start(Port, Script))
+    {
+        return 1;
+    }
+    if (MaxInFlight > 0)
+    {
+        FPlayFabRequestDispatcher::Get().SetMaxInFlight(MaxInFlight);
+    }
+
+    // The players never keep a call after its callback, so their managers can be reused
+    FPlayFabManagerPool::Get().SetEnabled(true);
+
+    AddToRoot();
+    FPlayFabMetrics::Get().Reset();
+    CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+    const int64 MemoryBefore = FPlatformMemory::GetStats().UsedPhysical;
+    int64 MemoryPerSession = 0;
+
+    const FString RunId = FGuid::NewGuid().ToString(EGuidFormats::Digits).Left(8);
+    UE_LOG(LogPlayFab, Display, TEXT("Load test %s: %d players over %.0fs, then %.0fs steady"), *RunId, PlayerCount, RampUpSeconds, DurationSeconds);
+
+    const double StartTime = FPlatformTime::Seconds();
+    const double RampUpEnd = StartTime + RampUpSeconds;
+    const double EndTime = RampUpEnd + DurationSeconds;
+    double LastTickTime = StartTime;
+    double NextGarbageCollection = StartTime + GarbageCollectionInterval;
+    double NextProgress = StartTime + 5.0;
+    Players.Reserve(PlayerCount);
+
+    for (double Now = StartTime; Now < EndTime; Now = FPlatformTime::Seconds())
+    {
+        // Spread logins evenly over the ramp up
+        const int32 Target = RampUpSeconds > 0.0f ? FMath::Min(PlayerCount, FMath::CeilToInt(PlayerCount * (Now - StartTime) / RampUpSeconds)) : PlayerCount;
+        while (Players.Num() < Target)
+        {
+            UPlayFabClientLoadTestPlayer* Player = NewObject<UPlayFabClientLoadTestPlayer>(this);
+            Players.Add(Player);
+            Player->Begin(this, Players.Num() - 1, RunId);
+        }
+
+        if (!bRampedUp && Now >= RampUpEnd)
+        {
+            bRampedUp = true;
+            MemoryPerSession = (FPlatformMemory::GetStats().UsedPhysical - MemoryBefore) / PlayerCount;
+        }
+
+        TickEngine(Now - LastTickTime);
+        LastTickTime = Now;
+
+        bool bIdle = true;
+        for (UPlayFabClientLoadTestPlayer* Player : Players)
+        {
+            bIdle &= !Player->TickThink(Now);
+        }
+
+        // Nothing collects garbage in a commandlet, so do it on the engine's usual cadence and time it
+        if (Now >= NextGarbageCollection)
+        {
+            const double GarbageCollectionStart = FPlatformTime::Seconds();
+            CollectGarbage(GARBAGE_COLLECTION_KEEPFLAGS);
+            GarbageCollectionMicros.Record((uint64)((FPlatformTime::Seconds() - GarbageCollectionStart) * 1000000.0));
+            NextGarbageCollection = FPlatformTime::Seconds() + GarbageCollectionInterval;
+        }
+
+        if (Now >= NextProgress)
+        {
+            UE_LOG(LogPlayFab, Display, TEXT("%.0fs: %d players, %d calls queued, %d in flight"), Now - StartTime, Players.Num(),
+                IPlayFab::Get().GetQueuedCallCount(), IPlayFab::Get().GetInFlightCallCount());
+            NextProgress = Now + 5.0;
+        }
+
+        if (bIdle)
+        {
+            FPlatformProcess::Sleep(0.001f);
+        }
+    }
+
+    // Let the calls still in flight finish, so they don't complete into a torn down commandlet
+    const double DrainEnd = FPlatformTime::Seconds() + 10.0;
+    for (double Now = FPlatformTime::Seconds(); IPlayFab::Get().GetPendingCallCount() > 0 && Now < DrainEnd; Now = FPlatformTime::Seconds())
+    {
+        TickEngine(Now - LastTickTime);
+        LastTickTime = Now;
+        FPlatformProcess::Sleep(0.001f);
+    }
+
+    Report(RampUpSeconds, DurationSeconds, PlayerCount, MemoryPerSession);
+
+    if (ServerUrl.IsEmpty())
+    {
+        FPlayFabStandInServer::Shutdown();
+    }
+    Players.Empty();
+    RemoveFromRoot();
+    return 0;
+}
+
+void UPlayFabClientLoadTestCommandlet::Report(double RampUpSeconds, double SteadySeconds, int32 PlayerCount, int64 MemoryPerSession) const
+{
+    int32 TotalSucceeded = 0;
+    int32 TotalFailed = 0;
+    int32 SteadySucceeded = 0;
+    UE_LOG(LogPlayFab, Display, TEXT("%-24s %9s %7s %9s %8s %8s %8s %8s"), TEXT("Step"), TEXT("ok"), TEXT("failed"), TEXT("calls/s"), TEXT("p50 ms"), TEXT("p90 ms"), TEXT("p99 ms"), TEXT("max ms"));
+    for (int32 StepIndex = 0; StepIndex < UPlayFabClientLoadTestPlayer::CallStepCount; ++StepIndex)
+    {
+        const FStepResults& Results = Steps[StepIndex];
+        TotalSucceeded += Results.Succeeded;
+        TotalFailed += Results.Failed;
+        SteadySucceeded += Results.SucceededAfterRampUp;
+        UE_LOG(LogPlayFab, Display, TEXT("%-24s %9d %7d %9.1f %8.1f %8.1f %8.1f %8.1f"), StepNames[StepIndex], Results.Succeeded, Results.Failed,
+            SteadySeconds > 0.0 ? Results.SucceededAfterRampUp / SteadySeconds : 0.0,
+            Results.Latency.GetPercentile(50.0f) / 1000.0, Results.Latency.GetPercentile(90.0f) / 1000.0,
+            Results.Latency.GetPercentile(99.0f) / 1000.0, Results.Latency.GetMax() / 1000.0);
+    }
+
+    UE_LOG(LogPlayFab, Display, TEXT("%d calls succeeded, %d failed, %.1f calls/s once ramped up"), TotalSucceeded, TotalFailed, SteadySeconds > 0.0 ? SteadySucceeded / SteadySeconds : 0.0);
+    UE_LOG(LogPlayFab, Display, TEXT("Memory per session %.1f KB across %d players, %d UObjects live"), MemoryPerSession / 1024.0, PlayerCount, GUObjectArray.GetObjectArrayNumMinusAvailable());
+    UE_LOG(LogPlayFab, Display, TEXT("Garbage collection: %d runs, mean %.2f ms, p99 %.2f ms, max %.2f ms"), GarbageCollectionMicros.GetCount(),
+        GarbageCollectionMicros.GetMean() / 1000.0, GarbageCollectionMicros.GetPercentile(99.0f) / 1000.0, GarbageCollectionMicros.GetMax() / 1000.0);
+
+    const FPlayFabManagerPool& Pool = FPlayFabManagerPool::Get();
+    UE_LOG(LogPlayFab, Display, TEXT("Call objects: %d created, %d reused, %d free"), Pool.GetCreatedCount(), Pool.GetReusedCount(), Pool.GetFreeCount());
+    UE_LOG(LogPlayFab, Display, TEXT("Endpoints paused after throttling: %d times"), FPlayFabRequestDispatcher::Get().GetThrottlePauseCount());
+    UE_LOG(LogPlayFab, Display, TEXT("Malformed bodies decoded from the json tree: %d"), FPlayFabJsonReader::GetFallbackCount());
+
+    const FPlayFabStandInStats StandIn = FPlayFabStandInServer::GetStats();
+    if (StandIn.Requests > 0)
+    {
+        UE_LOG(LogPlayFab, Display, TEXT("Stand-in: %d connections, %d requests, %d errors, %d throttled, %d dropped"),
+            StandIn.Connections, StandIn.Requests, StandIn.Errors, StandIn.Throttled, StandIn.Dropped);
+    }
+
+    // The per-endpoint breakdown of queue, network and decode time
+    FPlayFabMetrics::Get().Dump(*GLog);
+}
@@ -0,0 +1,93 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab gzip helpers.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabCompression.h"
+
+THIRD_PARTY_INCLUDES_START
+#include "zlib.h"
+THIRD_PARTY_INCLUDES_END
+
+// Adding 16 to the window bits makes zlib write a gzip header and trailer, adding 32 makes it accept either header
+static const int32 GzipWindowBits = MAX_WBITS + 16;
+static const int32 AutoDetectWindowBits = MAX_WBITS + 32;
+
+// Output grows by this much whenever the inflated data doesn't fit
+static const int32 InflateChunkSize = 16 * 1024;
+
+bool FPlayFabCompression::GzipCompress(const TArray<uint8>& Data, TArray<uint8>& OutCompressed)
+{
+    z_stream Stream;
+    FMemory::Memzero(Stream);
+    if (deflateInit2(&Stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, GzipWindowBits, 8, Z_DEFAULT_STRATEGY) != Z_OK)
+    {
+        return false;
+    }
+
+    OutCompressed.SetNumUninitialized(deflateBound(&Stream, Data.Num()));
+    Stream.next_in = (Bytef*)Data.GetData();
+    Stream.avail_in = Data.Num();
+    Stream.next_out = OutCompressed.GetData();
+    Stream.avail_out = OutCompressed.Num();
+
+    const int32 Result = deflate(&Stream, Z_FINISH);
+    deflateEnd(&Stream);
+    if (Result != Z_STREAM_END)
+    {
+        OutCompressed.Reset();
+        return false;
+    }
+
+    OutCompressed.SetNum(Stream.total_out, false);
+    return true;
+}
+
+bool FPlayFabCompression::IsCompressed(const uint8* Data, int32 Size)
+{
+    if (Size < 2)
+    {
+        return false;
+    }
+
+    // Gzip magic, or a zlib header using deflate whose check bits are valid. Neither can start a JSON document
+    const bool bGzip = Data[0] == 0x1f && Data[1] == 0x8b;
+    const bool bZlib = (Data[0] & 0x0f) == Z_DEFLATED && ((Data[0] << 8) | Data[1]) % 31 == 0;
+    return bGzip || bZlib;
+}
+
+bool FPlayFabCompression::Inflate(const uint8* Data, int32 Size, TArray<uint8>& OutData)
+{
+    OutData.Reset();
+
+    z_stream Stream;
+    FMemory::Memzero(Stream);
+    if (inflateInit2(&Stream, AutoDetectWindowBits) != Z_OK)
+    {
+        return false;
+    }
+
+    Stream.next_in = (Bytef*)Data;
+    Stream.avail_in = Size;
+
+    int32 Result = Z_OK;
+    while (Result == Z_OK)
+    {
+        const int32 Written = OutData.Num();
+        OutData.SetNumUninitialized(Written + InflateChunkSize, false);
+        Stream.next_out = OutData.GetData() + Written;
+        Stream.avail_out = InflateChunkSize;
+
+        Result = inflate(&Stream, Z_NO_FLUSH);
+        OutData.SetNum(Written + InflateChunkSize - Stream.avail_out, false);
+
+        // Out of input before the end of the stream means the body was truncated
+        if (Result == Z_BUF_ERROR || (Result == Z_OK && Stream.avail_in == 0 && Stream.avail_out != 0))
+        {
+            Result = Z_DATA_ERROR;
+        }
+    }
+    inflateEnd(&Stream);
+
+    return Result == Z_STREAM_END;
+}
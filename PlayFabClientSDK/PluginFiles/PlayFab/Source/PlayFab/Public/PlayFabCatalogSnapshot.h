@@ -0,0 +1,144 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Catalog Snapshot. A versioned binary copy of a GetCatalogItems or GetStoreItems
+// result, written in the background after every successful fetch and loaded with a single
+// read on the next launch, so a game can show its store before the network answers and
+// revalidate afterwards. Items are fixed-size records whose strings are offsets into one
+// UTF-8 string table, so reading a snapshot never allocates per item.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Interfaces/IHttpResponse.h"
+#include "Dom/JsonObject.h"
+
+/** A UTF-8 string in the snapshot's string table. Not null terminated */
+struct FPlayFabSnapshotString
+{
+    uint32 Offset;
+    uint32 Length;
+};
+
+/** One entry of an item's VirtualCurrencyPrices */
+struct FPlayFabSnapshotPrice
+{
+    FPlayFabSnapshotString Currency;
+    uint32 Amount;
+};
+
+/** One catalog or store item. Store items only fill in ItemId, CustomData, Json and their prices */
+struct FPlayFabSnapshotItem
+{
+    FPlayFabSnapshotString ItemId;
+    FPlayFabSnapshotString ItemClass;
+    FPlayFabSnapshotString DisplayName;
+    FPlayFabSnapshotString Description;
+    FPlayFabSnapshotString ItemImageUrl;
+    FPlayFabSnapshotString CustomData;
+
+    /** The whole item as condensed json, for fields that have no column of their own */
+    FPlayFabSnapshotString Json;
+
+    /** Range in the tag and price tables */
+    uint32 FirstTag;
+    uint32 TagCount;
+    uint32 FirstPrice;
+    uint32 PriceCount;
+};
+
+/** Start of every snapshot. The item, tag, price and string tables follow, in that order */
+struct FPlayFabSnapshotHeader
+{
+    uint32 Magic;
+    uint32 Version;
+    uint32 Kind;
+
+    /** Total bytes, to catch truncated files */
+    uint32 Size;
+
+    /** Unix time the snapshot was written */
+    int64 WrittenAt;
+
+    FPlayFabSnapshotString CatalogVersion;
+    FPlayFabSnapshotString StoreId;
+
+    uint32 ItemCount;
+    uint32 ItemsOffset;
+    uint32 TagCount;
+    uint32 TagsOffset;
+    uint32 PriceCount;
+    uint32 PricesOffset;
+    uint32 StringsOffset;
+    uint32 StringsSize;
+};
+
+class PLAYFAB_API FPlayFabCatalogSnapshot : public FNoncopyable
+{
+public:
+    enum class EKind : uint32
+    {
+        Catalog,
+        Store,
+    };
+
+    /** Bumped whenever the layout changes, older files are then ignored */
+    static const uint32 FormatVersion = 1;
+
+    /** Build a snapshot from the body of a GetCatalogItems or GetStoreItems response. Safe to call from any thread */
+    static bool Build(EKind Kind, const FString& CatalogVersion, const FString& StoreId, const TArray<uint8>& ResponseContent, TArray<uint8>& OutSnapshot);
+
+    /** Where the snapshot of a catalog version, or of a store in one, is kept for the current title */
+    static FString GetPath(EKind Kind, const FString& CatalogVersion, const FString& StoreId);
+
+    /**
+     * Called by the dispatcher with every successful call. Writes a snapshot on a worker thread for catalog and store reads.
+     * RequestBody is the call's json if it was built as a tree, otherwise the body is read back from Request
+     */
+    static void Capture(const FString& Endpoint, FHttpRequestPtr Request, const FJsonObject* RequestBody, FHttpResponsePtr Response);
+
+    /** Write snapshots after each fetch. On by default */
+    static void SetCaptureEnabled(bool bEnabled) { bCaptureEnabled = bEnabled; }
+
+    /** Load the snapshot written by an earlier fetch. Returns false if there is none, or it is damaged or from another format version */
+    bool Load(EKind Kind, const FString& CatalogVersion, const FString& StoreId = FString());
+
+    /** Take over a snapshot made by Build(). Returns false if it is not valid */
+    bool Load(TArray<uint8>&& Snapshot);
+
+    void Reset();
+
+    bool IsValid() const { return Header != nullptr; }
+    EKind GetKind() const { return (EKind)Header->Kind; }
+    FDateTime GetWrittenAt() const { return FDateTime::FromUnixTimestamp(Header->WrittenAt); }
+    FString GetCatalogVersion() const { return ToString(Header->CatalogVersion); }
+    FString GetStoreId() const { return ToString(Header->StoreId); }
+
+    int32 Num() const { return Header != nullptr ? (int32)Header->ItemCount : 0; }
+    const FPlayFabSnapshotItem& GetItem(int32 Index) const { return Items[Index]; }
+    const FPlayFabSnapshotString* GetTags(const FPlayFabSnapshotItem& Item) const { return Tags + Item.FirstTag; }
+    const FPlayFabSnapshotPrice* GetPrices(const FPlayFabSnapshotItem& Item) const { return Prices + Item.FirstPrice; }
+
+    /** The UTF-8 bytes of a string, String.Length long. Valid while the snapshot is loaded */
+    const ANSICHAR* GetChars(const FPlayFabSnapshotString& String) const { return Strings + String.Offset; }
+
+    /** Compare without converting, Other must be UTF-8 */
+    bool Equals(const FPlayFabSnapshotString& String, const ANSICHAR* Other, int32 OtherLength) const;
+
+    /** Convert a string to an FString, for display */
+    FString ToString(const FPlayFabSnapshotString& String) const;
+
+    /** The underlying bytes, e.g. to hand to a catalog index */
+    const TArray<uint8>& GetData() const { return Data; }
+
+private:
+    /** Check every table and string lies inside the data before exposing it */
+    bool Validate();
+
+    static bool bCaptureEnabled;
+
+    TArray<uint8> Data;
+    const FPlayFabSnapshotHeader* Header = nullptr;
+    const FPlayFabSnapshotItem* Items = nullptr;
+    const FPlayFabSnapshotString* Tags = nullptr;
+    const FPlayFabSnapshotPrice* Prices = nullptr;
+    const ANSICHAR* Strings = nullptr;
+};
@@ -7,6 +7,7 @@
 #include "PlayFabBaseModel.generated.h"
 
 class UPlayFabJsonObject;
+class FJsonObject;
 
 USTRUCT(BlueprintType)
 struct FPlayFabError
@@ -36,6 +37,9 @@ struct FPlayFabError
     // Decode the error if there is one
     void decodeError(UPlayFabJsonObject* responseData);
 
+    // Decode the error from the raw json, safe to call off the game thread
+    void decodeError(const FJsonObject* responseData);
+
 };
 
 USTRUCT(BlueprintType)
@@ -51,4 +55,7 @@ struct FPlayFabBaseModel
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Error | Models")
         UPlayFabJsonObject* responseData;
 
+    /** The uncompressed UTF-8 body the response was read from, for the one pass decoders. Empty for a response made up locally */
+    TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> responseBody;
+
 };
@@ -9,6 +9,7 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "PlayFabEnums.h"
+#include "PlayFabBaseModel.h"
 #include "PlayFabClientModels.h"
 #include "PlayFabClientModelDecoder.generated.h"
 
@@ -34,26 +35,56 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication Models")
         static FClientGetPhotonAuthenticationTokenResult decodeGetPhotonAuthenticationTokenResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPhotonAuthenticationTokenResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPhotonAuthenticationTokenResult readGetPhotonAuthenticationTokenResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetTitlePublicKeyResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication Models")
         static FClientGetTitlePublicKeyResult decodeGetTitlePublicKeyResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetTitlePublicKeyResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetTitlePublicKeyResult readGetTitlePublicKeyResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetWindowsHelloChallengeResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication Models")
         static FClientGetWindowsHelloChallengeResponse decodeGetWindowsHelloChallengeResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetWindowsHelloChallengeResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetWindowsHelloChallengeResponse readGetWindowsHelloChallengeResponseResponse(const FPlayFabBaseModel& response);
+
     /** Decode the LoginResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication Models")
         static FClientLoginResult decodeLoginResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the LoginResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientLoginResult readLoginResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a LoginResult from its views, for a Blueprint that reads them */
+    static void fillLoginResultJsonObjects(FClientLoginResult& result);
+
     /** Decode the RegisterPlayFabUserResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication Models")
         static FClientRegisterPlayFabUserResult decodeRegisterPlayFabUserResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RegisterPlayFabUserResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientRegisterPlayFabUserResult readRegisterPlayFabUserResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a RegisterPlayFabUserResult from its views, for a Blueprint that reads them */
+    static void fillRegisterPlayFabUserResultJsonObjects(FClientRegisterPlayFabUserResult& result);
+
     /** Decode the SetPlayerSecretResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Authentication Models")
         static FClientSetPlayerSecretResult decodeSetPlayerSecretResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetPlayerSecretResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientSetPlayerSecretResult readSetPlayerSecretResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -64,150 +95,328 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientAddGenericIDResult decodeAddGenericIDResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AddGenericIDResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientAddGenericIDResult readAddGenericIDResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the AddUsernamePasswordResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientAddUsernamePasswordResult decodeAddUsernamePasswordResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AddUsernamePasswordResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientAddUsernamePasswordResult readAddUsernamePasswordResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetAccountInfoResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientGetAccountInfoResult decodeGetAccountInfoResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetAccountInfoResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetAccountInfoResult readGetAccountInfoResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetAccountInfoResult from its views, for a Blueprint that reads them */
+    static void fillGetAccountInfoResultJsonObjects(FClientGetAccountInfoResult& result);
+
     /** Decode the GetPlayerCombinedInfoResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientGetPlayerCombinedInfoResult decodeGetPlayerCombinedInfoResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerCombinedInfoResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayerCombinedInfoResult readGetPlayerCombinedInfoResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerCombinedInfoResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerCombinedInfoResultJsonObjects(FClientGetPlayerCombinedInfoResult& result);
+
     /** Decode the GetPlayerProfileResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientGetPlayerProfileResult decodeGetPlayerProfileResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerProfileResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayerProfileResult readGetPlayerProfileResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerProfileResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerProfileResultJsonObjects(FClientGetPlayerProfileResult& result);
+
     /** Decode the GetPlayFabIDsFromFacebookIDsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientGetPlayFabIDsFromFacebookIDsResult decodeGetPlayFabIDsFromFacebookIDsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayFabIDsFromFacebookIDsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayFabIDsFromFacebookIDsResult readGetPlayFabIDsFromFacebookIDsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayFabIDsFromFacebookIDsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayFabIDsFromFacebookIDsResultJsonObjects(FClientGetPlayFabIDsFromFacebookIDsResult& result);
+
     /** Decode the GetPlayFabIDsFromGameCenterIDsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientGetPlayFabIDsFromGameCenterIDsResult decodeGetPlayFabIDsFromGameCenterIDsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayFabIDsFromGameCenterIDsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayFabIDsFromGameCenterIDsResult readGetPlayFabIDsFromGameCenterIDsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayFabIDsFromGameCenterIDsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayFabIDsFromGameCenterIDsResultJsonObjects(FClientGetPlayFabIDsFromGameCenterIDsResult& result);
+
     /** Decode the GetPlayFabIDsFromGenericIDsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientGetPlayFabIDsFromGenericIDsResult decodeGetPlayFabIDsFromGenericIDsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayFabIDsFromGenericIDsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayFabIDsFromGenericIDsResult readGetPlayFabIDsFromGenericIDsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayFabIDsFromGenericIDsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayFabIDsFromGenericIDsResultJsonObjects(FClientGetPlayFabIDsFromGenericIDsResult& result);
+
     /** Decode the GetPlayFabIDsFromGoogleIDsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientGetPlayFabIDsFromGoogleIDsResult decodeGetPlayFabIDsFromGoogleIDsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayFabIDsFromGoogleIDsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayFabIDsFromGoogleIDsResult readGetPlayFabIDsFromGoogleIDsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayFabIDsFromGoogleIDsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayFabIDsFromGoogleIDsResultJsonObjects(FClientGetPlayFabIDsFromGoogleIDsResult& result);
+
     /** Decode the GetPlayFabIDsFromKongregateIDsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientGetPlayFabIDsFromKongregateIDsResult decodeGetPlayFabIDsFromKongregateIDsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayFabIDsFromKongregateIDsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayFabIDsFromKongregateIDsResult readGetPlayFabIDsFromKongregateIDsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayFabIDsFromKongregateIDsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayFabIDsFromKongregateIDsResultJsonObjects(FClientGetPlayFabIDsFromKongregateIDsResult& result);
+
     /** Decode the GetPlayFabIDsFromSteamIDsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientGetPlayFabIDsFromSteamIDsResult decodeGetPlayFabIDsFromSteamIDsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayFabIDsFromSteamIDsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayFabIDsFromSteamIDsResult readGetPlayFabIDsFromSteamIDsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayFabIDsFromSteamIDsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayFabIDsFromSteamIDsResultJsonObjects(FClientGetPlayFabIDsFromSteamIDsResult& result);
+
     /** Decode the GetPlayFabIDsFromTwitchIDsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientGetPlayFabIDsFromTwitchIDsResult decodeGetPlayFabIDsFromTwitchIDsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayFabIDsFromTwitchIDsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayFabIDsFromTwitchIDsResult readGetPlayFabIDsFromTwitchIDsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayFabIDsFromTwitchIDsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayFabIDsFromTwitchIDsResultJsonObjects(FClientGetPlayFabIDsFromTwitchIDsResult& result);
+
     /** Decode the LinkAndroidDeviceIDResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientLinkAndroidDeviceIDResult decodeLinkAndroidDeviceIDResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the LinkAndroidDeviceIDResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientLinkAndroidDeviceIDResult readLinkAndroidDeviceIDResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the LinkCustomIDResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientLinkCustomIDResult decodeLinkCustomIDResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the LinkCustomIDResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientLinkCustomIDResult readLinkCustomIDResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the LinkFacebookAccountResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientLinkFacebookAccountResult decodeLinkFacebookAccountResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the LinkFacebookAccountResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientLinkFacebookAccountResult readLinkFacebookAccountResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the LinkGameCenterAccountResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientLinkGameCenterAccountResult decodeLinkGameCenterAccountResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the LinkGameCenterAccountResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientLinkGameCenterAccountResult readLinkGameCenterAccountResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the LinkGoogleAccountResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientLinkGoogleAccountResult decodeLinkGoogleAccountResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the LinkGoogleAccountResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientLinkGoogleAccountResult readLinkGoogleAccountResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the LinkIOSDeviceIDResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientLinkIOSDeviceIDResult decodeLinkIOSDeviceIDResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the LinkIOSDeviceIDResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientLinkIOSDeviceIDResult readLinkIOSDeviceIDResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the LinkKongregateAccountResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientLinkKongregateAccountResult decodeLinkKongregateAccountResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the LinkKongregateAccountResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientLinkKongregateAccountResult readLinkKongregateAccountResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the LinkSteamAccountResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientLinkSteamAccountResult decodeLinkSteamAccountResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the LinkSteamAccountResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientLinkSteamAccountResult readLinkSteamAccountResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the LinkTwitchAccountResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientLinkTwitchAccountResult decodeLinkTwitchAccountResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the LinkTwitchAccountResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientLinkTwitchAccountResult readLinkTwitchAccountResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the LinkWindowsHelloAccountResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientLinkWindowsHelloAccountResponse decodeLinkWindowsHelloAccountResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the LinkWindowsHelloAccountResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientLinkWindowsHelloAccountResponse readLinkWindowsHelloAccountResponseResponse(const FPlayFabBaseModel& response);
+
     /** Decode the RemoveGenericIDResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientRemoveGenericIDResult decodeRemoveGenericIDResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RemoveGenericIDResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientRemoveGenericIDResult readRemoveGenericIDResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the ReportPlayerClientResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientReportPlayerClientResult decodeReportPlayerClientResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ReportPlayerClientResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientReportPlayerClientResult readReportPlayerClientResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the SendAccountRecoveryEmailResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientSendAccountRecoveryEmailResult decodeSendAccountRecoveryEmailResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SendAccountRecoveryEmailResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientSendAccountRecoveryEmailResult readSendAccountRecoveryEmailResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UnlinkAndroidDeviceIDResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientUnlinkAndroidDeviceIDResult decodeUnlinkAndroidDeviceIDResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UnlinkAndroidDeviceIDResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUnlinkAndroidDeviceIDResult readUnlinkAndroidDeviceIDResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UnlinkCustomIDResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientUnlinkCustomIDResult decodeUnlinkCustomIDResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UnlinkCustomIDResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUnlinkCustomIDResult readUnlinkCustomIDResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UnlinkFacebookAccountResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientUnlinkFacebookAccountResult decodeUnlinkFacebookAccountResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UnlinkFacebookAccountResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUnlinkFacebookAccountResult readUnlinkFacebookAccountResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UnlinkGameCenterAccountResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientUnlinkGameCenterAccountResult decodeUnlinkGameCenterAccountResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UnlinkGameCenterAccountResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUnlinkGameCenterAccountResult readUnlinkGameCenterAccountResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UnlinkGoogleAccountResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientUnlinkGoogleAccountResult decodeUnlinkGoogleAccountResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UnlinkGoogleAccountResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUnlinkGoogleAccountResult readUnlinkGoogleAccountResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UnlinkIOSDeviceIDResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientUnlinkIOSDeviceIDResult decodeUnlinkIOSDeviceIDResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UnlinkIOSDeviceIDResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUnlinkIOSDeviceIDResult readUnlinkIOSDeviceIDResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UnlinkKongregateAccountResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientUnlinkKongregateAccountResult decodeUnlinkKongregateAccountResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UnlinkKongregateAccountResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUnlinkKongregateAccountResult readUnlinkKongregateAccountResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UnlinkSteamAccountResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientUnlinkSteamAccountResult decodeUnlinkSteamAccountResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UnlinkSteamAccountResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUnlinkSteamAccountResult readUnlinkSteamAccountResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UnlinkTwitchAccountResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientUnlinkTwitchAccountResult decodeUnlinkTwitchAccountResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UnlinkTwitchAccountResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUnlinkTwitchAccountResult readUnlinkTwitchAccountResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UnlinkWindowsHelloAccountResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientUnlinkWindowsHelloAccountResponse decodeUnlinkWindowsHelloAccountResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the UnlinkWindowsHelloAccountResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUnlinkWindowsHelloAccountResponse readUnlinkWindowsHelloAccountResponseResponse(const FPlayFabBaseModel& response);
+
     /** Decode the EmptyResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientEmptyResult decodeEmptyResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the EmptyResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientEmptyResult readEmptyResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdateUserTitleDisplayNameResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Account Management Models")
         static FClientUpdateUserTitleDisplayNameResult decodeUpdateUserTitleDisplayNameResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateUserTitleDisplayNameResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUpdateUserTitleDisplayNameResult readUpdateUserTitleDisplayNameResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -218,34 +427,84 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management Models")
         static FClientGetLeaderboardResult decodeGetLeaderboardResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetLeaderboardResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetLeaderboardResult readGetLeaderboardResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetLeaderboardResult from its views, for a Blueprint that reads them */
+    static void fillGetLeaderboardResultJsonObjects(FClientGetLeaderboardResult& result);
+
     /** Decode the GetFriendLeaderboardAroundPlayerResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management Models")
         static FClientGetFriendLeaderboardAroundPlayerResult decodeGetFriendLeaderboardAroundPlayerResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetFriendLeaderboardAroundPlayerResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetFriendLeaderboardAroundPlayerResult readGetFriendLeaderboardAroundPlayerResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetFriendLeaderboardAroundPlayerResult from its views, for a Blueprint that reads them */
+    static void fillGetFriendLeaderboardAroundPlayerResultJsonObjects(FClientGetFriendLeaderboardAroundPlayerResult& result);
+
     /** Decode the GetLeaderboardAroundPlayerResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management Models")
         static FClientGetLeaderboardAroundPlayerResult decodeGetLeaderboardAroundPlayerResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetLeaderboardAroundPlayerResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetLeaderboardAroundPlayerResult readGetLeaderboardAroundPlayerResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetLeaderboardAroundPlayerResult from its views, for a Blueprint that reads them */
+    static void fillGetLeaderboardAroundPlayerResultJsonObjects(FClientGetLeaderboardAroundPlayerResult& result);
+
     /** Decode the GetPlayerStatisticsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management Models")
         static FClientGetPlayerStatisticsResult decodeGetPlayerStatisticsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerStatisticsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayerStatisticsResult readGetPlayerStatisticsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerStatisticsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerStatisticsResultJsonObjects(FClientGetPlayerStatisticsResult& result);
+
     /** Decode the GetPlayerStatisticVersionsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management Models")
         static FClientGetPlayerStatisticVersionsResult decodeGetPlayerStatisticVersionsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerStatisticVersionsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayerStatisticVersionsResult readGetPlayerStatisticVersionsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerStatisticVersionsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerStatisticVersionsResultJsonObjects(FClientGetPlayerStatisticVersionsResult& result);
+
     /** Decode the GetUserDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management Models")
         static FClientGetUserDataResult decodeGetUserDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetUserDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetUserDataResult readGetUserDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetUserDataResult from its views, for a Blueprint that reads them */
+    static void fillGetUserDataResultJsonObjects(FClientGetUserDataResult& result);
+
     /** Decode the UpdatePlayerStatisticsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management Models")
         static FClientUpdatePlayerStatisticsResult decodeUpdatePlayerStatisticsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdatePlayerStatisticsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUpdatePlayerStatisticsResult readUpdatePlayerStatisticsResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdateUserDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Data Management Models")
         static FClientUpdateUserDataResult decodeUpdateUserDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateUserDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUpdateUserDataResult readUpdateUserDataResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -256,26 +515,65 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Title-Wide Data Management Models")
         static FClientGetCatalogItemsResult decodeGetCatalogItemsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCatalogItemsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetCatalogItemsResult readGetCatalogItemsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCatalogItemsResult from its views, for a Blueprint that reads them */
+    static void fillGetCatalogItemsResultJsonObjects(FClientGetCatalogItemsResult& result);
+
     /** Decode the GetPublisherDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Title-Wide Data Management Models")
         static FClientGetPublisherDataResult decodeGetPublisherDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPublisherDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPublisherDataResult readGetPublisherDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPublisherDataResult from its views, for a Blueprint that reads them */
+    static void fillGetPublisherDataResultJsonObjects(FClientGetPublisherDataResult& result);
+
     /** Decode the GetStoreItemsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Title-Wide Data Management Models")
         static FClientGetStoreItemsResult decodeGetStoreItemsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetStoreItemsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetStoreItemsResult readGetStoreItemsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetStoreItemsResult from its views, for a Blueprint that reads them */
+    static void fillGetStoreItemsResultJsonObjects(FClientGetStoreItemsResult& result);
+
     /** Decode the GetTimeResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Title-Wide Data Management Models")
         static FClientGetTimeResult decodeGetTimeResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetTimeResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetTimeResult readGetTimeResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetTitleDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Title-Wide Data Management Models")
         static FClientGetTitleDataResult decodeGetTitleDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetTitleDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetTitleDataResult readGetTitleDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetTitleDataResult from its views, for a Blueprint that reads them */
+    static void fillGetTitleDataResultJsonObjects(FClientGetTitleDataResult& result);
+
     /** Decode the GetTitleNewsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Title-Wide Data Management Models")
         static FClientGetTitleNewsResult decodeGetTitleNewsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetTitleNewsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetTitleNewsResult readGetTitleNewsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetTitleNewsResult from its views, for a Blueprint that reads them */
+    static void fillGetTitleNewsResultJsonObjects(FClientGetTitleNewsResult& result);
+
 
 
     ///////////////////////////////////////////////////////
@@ -286,46 +584,114 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management Models")
         static FClientModifyUserVirtualCurrencyResult decodeModifyUserVirtualCurrencyResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ModifyUserVirtualCurrencyResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientModifyUserVirtualCurrencyResult readModifyUserVirtualCurrencyResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the ConfirmPurchaseResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management Models")
         static FClientConfirmPurchaseResult decodeConfirmPurchaseResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ConfirmPurchaseResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientConfirmPurchaseResult readConfirmPurchaseResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a ConfirmPurchaseResult from its views, for a Blueprint that reads them */
+    static void fillConfirmPurchaseResultJsonObjects(FClientConfirmPurchaseResult& result);
+
     /** Decode the ConsumeItemResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management Models")
         static FClientConsumeItemResult decodeConsumeItemResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ConsumeItemResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientConsumeItemResult readConsumeItemResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetCharacterInventoryResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management Models")
         static FClientGetCharacterInventoryResult decodeGetCharacterInventoryResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCharacterInventoryResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetCharacterInventoryResult readGetCharacterInventoryResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCharacterInventoryResult from its views, for a Blueprint that reads them */
+    static void fillGetCharacterInventoryResultJsonObjects(FClientGetCharacterInventoryResult& result);
+
     /** Decode the GetPurchaseResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management Models")
         static FClientGetPurchaseResult decodeGetPurchaseResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPurchaseResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPurchaseResult readGetPurchaseResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetUserInventoryResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management Models")
         static FClientGetUserInventoryResult decodeGetUserInventoryResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetUserInventoryResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetUserInventoryResult readGetUserInventoryResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetUserInventoryResult from its views, for a Blueprint that reads them */
+    static void fillGetUserInventoryResultJsonObjects(FClientGetUserInventoryResult& result);
+
     /** Decode the PayForPurchaseResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management Models")
         static FClientPayForPurchaseResult decodePayForPurchaseResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the PayForPurchaseResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientPayForPurchaseResult readPayForPurchaseResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a PayForPurchaseResult from its views, for a Blueprint that reads them */
+    static void fillPayForPurchaseResultJsonObjects(FClientPayForPurchaseResult& result);
+
     /** Decode the PurchaseItemResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management Models")
         static FClientPurchaseItemResult decodePurchaseItemResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the PurchaseItemResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientPurchaseItemResult readPurchaseItemResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a PurchaseItemResult from its views, for a Blueprint that reads them */
+    static void fillPurchaseItemResultJsonObjects(FClientPurchaseItemResult& result);
+
     /** Decode the RedeemCouponResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management Models")
         static FClientRedeemCouponResult decodeRedeemCouponResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RedeemCouponResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientRedeemCouponResult readRedeemCouponResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a RedeemCouponResult from its views, for a Blueprint that reads them */
+    static void fillRedeemCouponResultJsonObjects(FClientRedeemCouponResult& result);
+
     /** Decode the StartPurchaseResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management Models")
         static FClientStartPurchaseResult decodeStartPurchaseResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the StartPurchaseResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientStartPurchaseResult readStartPurchaseResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a StartPurchaseResult from its views, for a Blueprint that reads them */
+    static void fillStartPurchaseResultJsonObjects(FClientStartPurchaseResult& result);
+
     /** Decode the UnlockContainerItemResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Player Item Management Models")
         static FClientUnlockContainerItemResult decodeUnlockContainerItemResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UnlockContainerItemResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUnlockContainerItemResult readUnlockContainerItemResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a UnlockContainerItemResult from its views, for a Blueprint that reads them */
+    static void fillUnlockContainerItemResultJsonObjects(FClientUnlockContainerItemResult& result);
+
 
 
     ///////////////////////////////////////////////////////
@@ -336,18 +702,37 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Friend List Management Models")
         static FClientAddFriendResult decodeAddFriendResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AddFriendResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientAddFriendResult readAddFriendResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetFriendsListResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Friend List Management Models")
         static FClientGetFriendsListResult decodeGetFriendsListResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetFriendsListResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetFriendsListResult readGetFriendsListResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetFriendsListResult from its views, for a Blueprint that reads them */
+    static void fillGetFriendsListResultJsonObjects(FClientGetFriendsListResult& result);
+
     /** Decode the RemoveFriendResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Friend List Management Models")
         static FClientRemoveFriendResult decodeRemoveFriendResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RemoveFriendResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientRemoveFriendResult readRemoveFriendResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the SetFriendTagsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Friend List Management Models")
         static FClientSetFriendTagsResult decodeSetFriendTagsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetFriendTagsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientSetFriendTagsResult readSetFriendTagsResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -358,18 +743,40 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Matchmaking Models")
         static FClientCurrentGamesResult decodeCurrentGamesResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the CurrentGamesResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientCurrentGamesResult readCurrentGamesResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a CurrentGamesResult from its views, for a Blueprint that reads them */
+    static void fillCurrentGamesResultJsonObjects(FClientCurrentGamesResult& result);
+
     /** Decode the GameServerRegionsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Matchmaking Models")
         static FClientGameServerRegionsResult decodeGameServerRegionsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GameServerRegionsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGameServerRegionsResult readGameServerRegionsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GameServerRegionsResult from its views, for a Blueprint that reads them */
+    static void fillGameServerRegionsResultJsonObjects(FClientGameServerRegionsResult& result);
+
     /** Decode the MatchmakeResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Matchmaking Models")
         static FClientMatchmakeResult decodeMatchmakeResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the MatchmakeResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientMatchmakeResult readMatchmakeResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the StartGameResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Matchmaking Models")
         static FClientStartGameResult decodeStartGameResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the StartGameResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientStartGameResult readStartGameResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -380,6 +787,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Analytics Models")
         static FClientWriteEventResponse decodeWriteEventResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the WriteEventResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientWriteEventResponse readWriteEventResponseResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -390,22 +801,45 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Shared Group Data Models")
         static FClientAddSharedGroupMembersResult decodeAddSharedGroupMembersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AddSharedGroupMembersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientAddSharedGroupMembersResult readAddSharedGroupMembersResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the CreateSharedGroupResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Shared Group Data Models")
         static FClientCreateSharedGroupResult decodeCreateSharedGroupResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the CreateSharedGroupResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientCreateSharedGroupResult readCreateSharedGroupResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetSharedGroupDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Shared Group Data Models")
         static FClientGetSharedGroupDataResult decodeGetSharedGroupDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetSharedGroupDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetSharedGroupDataResult readGetSharedGroupDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetSharedGroupDataResult from its views, for a Blueprint that reads them */
+    static void fillGetSharedGroupDataResultJsonObjects(FClientGetSharedGroupDataResult& result);
+
     /** Decode the RemoveSharedGroupMembersResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Shared Group Data Models")
         static FClientRemoveSharedGroupMembersResult decodeRemoveSharedGroupMembersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RemoveSharedGroupMembersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientRemoveSharedGroupMembersResult readRemoveSharedGroupMembersResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdateSharedGroupDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Shared Group Data Models")
         static FClientUpdateSharedGroupDataResult decodeUpdateSharedGroupDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateSharedGroupDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUpdateSharedGroupDataResult readUpdateSharedGroupDataResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -416,6 +850,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Server-Side Cloud Script Models")
         static FClientExecuteCloudScriptResult decodeExecuteCloudScriptResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ExecuteCloudScriptResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientExecuteCloudScriptResult readExecuteCloudScriptResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a ExecuteCloudScriptResult from its views, for a Blueprint that reads them */
+    static void fillExecuteCloudScriptResultJsonObjects(FClientExecuteCloudScriptResult& result);
+
 
 
     ///////////////////////////////////////////////////////
@@ -426,6 +867,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Content Models")
         static FClientGetContentDownloadUrlResult decodeGetContentDownloadUrlResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetContentDownloadUrlResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetContentDownloadUrlResult readGetContentDownloadUrlResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -436,30 +881,73 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters Models")
         static FClientListUsersCharactersResult decodeListUsersCharactersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ListUsersCharactersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientListUsersCharactersResult readListUsersCharactersResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a ListUsersCharactersResult from its views, for a Blueprint that reads them */
+    static void fillListUsersCharactersResultJsonObjects(FClientListUsersCharactersResult& result);
+
     /** Decode the GetCharacterLeaderboardResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters Models")
         static FClientGetCharacterLeaderboardResult decodeGetCharacterLeaderboardResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCharacterLeaderboardResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetCharacterLeaderboardResult readGetCharacterLeaderboardResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCharacterLeaderboardResult from its views, for a Blueprint that reads them */
+    static void fillGetCharacterLeaderboardResultJsonObjects(FClientGetCharacterLeaderboardResult& result);
+
     /** Decode the GetCharacterStatisticsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters Models")
         static FClientGetCharacterStatisticsResult decodeGetCharacterStatisticsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCharacterStatisticsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetCharacterStatisticsResult readGetCharacterStatisticsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCharacterStatisticsResult from its views, for a Blueprint that reads them */
+    static void fillGetCharacterStatisticsResultJsonObjects(FClientGetCharacterStatisticsResult& result);
+
     /** Decode the GetLeaderboardAroundCharacterResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters Models")
         static FClientGetLeaderboardAroundCharacterResult decodeGetLeaderboardAroundCharacterResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetLeaderboardAroundCharacterResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetLeaderboardAroundCharacterResult readGetLeaderboardAroundCharacterResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetLeaderboardAroundCharacterResult from its views, for a Blueprint that reads them */
+    static void fillGetLeaderboardAroundCharacterResultJsonObjects(FClientGetLeaderboardAroundCharacterResult& result);
+
     /** Decode the GetLeaderboardForUsersCharactersResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters Models")
         static FClientGetLeaderboardForUsersCharactersResult decodeGetLeaderboardForUsersCharactersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetLeaderboardForUsersCharactersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetLeaderboardForUsersCharactersResult readGetLeaderboardForUsersCharactersResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetLeaderboardForUsersCharactersResult from its views, for a Blueprint that reads them */
+    static void fillGetLeaderboardForUsersCharactersResultJsonObjects(FClientGetLeaderboardForUsersCharactersResult& result);
+
     /** Decode the GrantCharacterToUserResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters Models")
         static FClientGrantCharacterToUserResult decodeGrantCharacterToUserResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GrantCharacterToUserResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGrantCharacterToUserResult readGrantCharacterToUserResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdateCharacterStatisticsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Characters Models")
         static FClientUpdateCharacterStatisticsResult decodeUpdateCharacterStatisticsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateCharacterStatisticsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUpdateCharacterStatisticsResult readUpdateCharacterStatisticsResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -470,10 +958,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Character Data Models")
         static FClientGetCharacterDataResult decodeGetCharacterDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCharacterDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetCharacterDataResult readGetCharacterDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCharacterDataResult from its views, for a Blueprint that reads them */
+    static void fillGetCharacterDataResultJsonObjects(FClientGetCharacterDataResult& result);
+
     /** Decode the UpdateCharacterDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Character Data Models")
         static FClientUpdateCharacterDataResult decodeUpdateCharacterDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateCharacterDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientUpdateCharacterDataResult readUpdateCharacterDataResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -484,22 +983,57 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Trading Models")
         static FClientAcceptTradeResponse decodeAcceptTradeResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the AcceptTradeResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientAcceptTradeResponse readAcceptTradeResponseResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a AcceptTradeResponse from its views, for a Blueprint that reads them */
+    static void fillAcceptTradeResponseJsonObjects(FClientAcceptTradeResponse& result);
+
     /** Decode the CancelTradeResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Trading Models")
         static FClientCancelTradeResponse decodeCancelTradeResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the CancelTradeResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientCancelTradeResponse readCancelTradeResponseResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a CancelTradeResponse from its views, for a Blueprint that reads them */
+    static void fillCancelTradeResponseJsonObjects(FClientCancelTradeResponse& result);
+
     /** Decode the GetPlayerTradesResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Trading Models")
         static FClientGetPlayerTradesResponse decodeGetPlayerTradesResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerTradesResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayerTradesResponse readGetPlayerTradesResponseResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerTradesResponse from its views, for a Blueprint that reads them */
+    static void fillGetPlayerTradesResponseJsonObjects(FClientGetPlayerTradesResponse& result);
+
     /** Decode the GetTradeStatusResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Trading Models")
         static FClientGetTradeStatusResponse decodeGetTradeStatusResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetTradeStatusResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetTradeStatusResponse readGetTradeStatusResponseResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetTradeStatusResponse from its views, for a Blueprint that reads them */
+    static void fillGetTradeStatusResponseJsonObjects(FClientGetTradeStatusResponse& result);
+
     /** Decode the OpenTradeResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Trading Models")
         static FClientOpenTradeResponse decodeOpenTradeResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the OpenTradeResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientOpenTradeResponse readOpenTradeResponseResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a OpenTradeResponse from its views, for a Blueprint that reads them */
+    static void fillOpenTradeResponseJsonObjects(FClientOpenTradeResponse& result);
+
 
 
     ///////////////////////////////////////////////////////
@@ -510,6 +1044,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Advertising Models")
         static FClientAttributeInstallResult decodeAttributeInstallResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AttributeInstallResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientAttributeInstallResult readAttributeInstallResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -526,10 +1064,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | PlayStream Models")
         static FClientGetPlayerSegmentsResult decodeGetPlayerSegmentsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerSegmentsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayerSegmentsResult readGetPlayerSegmentsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerSegmentsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerSegmentsResultJsonObjects(FClientGetPlayerSegmentsResult& result);
+
     /** Decode the GetPlayerTagsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | PlayStream Models")
         static FClientGetPlayerTagsResult decodeGetPlayerTagsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerTagsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientGetPlayerTagsResult readGetPlayerTagsResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -540,30 +1089,58 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods Models")
         static FClientAndroidDevicePushNotificationRegistrationResult decodeAndroidDevicePushNotificationRegistrationResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AndroidDevicePushNotificationRegistrationResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientAndroidDevicePushNotificationRegistrationResult readAndroidDevicePushNotificationRegistrationResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the RegisterForIOSPushNotificationResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods Models")
         static FClientRegisterForIOSPushNotificationResult decodeRegisterForIOSPushNotificationResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RegisterForIOSPushNotificationResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientRegisterForIOSPushNotificationResult readRegisterForIOSPushNotificationResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the RestoreIOSPurchasesResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods Models")
         static FClientRestoreIOSPurchasesResult decodeRestoreIOSPurchasesResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RestoreIOSPurchasesResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientRestoreIOSPurchasesResult readRestoreIOSPurchasesResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the ValidateAmazonReceiptResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods Models")
         static FClientValidateAmazonReceiptResult decodeValidateAmazonReceiptResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ValidateAmazonReceiptResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientValidateAmazonReceiptResult readValidateAmazonReceiptResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the ValidateGooglePlayPurchaseResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods Models")
         static FClientValidateGooglePlayPurchaseResult decodeValidateGooglePlayPurchaseResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ValidateGooglePlayPurchaseResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientValidateGooglePlayPurchaseResult readValidateGooglePlayPurchaseResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the ValidateIOSReceiptResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods Models")
         static FClientValidateIOSReceiptResult decodeValidateIOSReceiptResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ValidateIOSReceiptResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientValidateIOSReceiptResult readValidateIOSReceiptResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the ValidateWindowsReceiptResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Client | Platform Specific Methods Models")
         static FClientValidateWindowsReceiptResult decodeValidateWindowsReceiptResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ValidateWindowsReceiptResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FClientValidateWindowsReceiptResult readValidateWindowsReceiptResultResponse(const FPlayFabBaseModel& response);
+
 
 
 };
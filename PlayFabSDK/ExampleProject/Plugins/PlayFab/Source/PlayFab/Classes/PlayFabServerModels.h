@@ -9,6 +9,7 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "PlayFabEnums.h"
+#include "PlayFabJsonView.h"
 #include "PlayFabServerModels.generated.h"
 
 class UPlayFabJsonObject;
@@ -40,6 +41,9 @@ public:
     /** Account info for the user whose session ticket was supplied. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Authentication Models")
         UPlayFabJsonObject* UserInfo = nullptr;
+    /** UserInfo, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Authentication Models")
+        FPlayFabJsonView UserInfoView;
 };
 
 USTRUCT(BlueprintType)
@@ -85,6 +89,9 @@ public:
     /** Information on the bans that were applied */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
         TArray<UPlayFabJsonObject*> BanData;
+    /** BanData, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
+        TArray<FPlayFabJsonView> BanDataView;
 };
 
 USTRUCT(BlueprintType)
@@ -108,6 +115,9 @@ public:
     /** The profile of the player. This profile is not guaranteed to be up-to-date. For a new player, this profile will not exist. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
         UPlayFabJsonObject* PlayerProfile = nullptr;
+    /** PlayerProfile, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
+        FPlayFabJsonView PlayerProfileView;
 };
 
 USTRUCT(BlueprintType)
@@ -128,6 +138,9 @@ public:
     /** Mapping of Facebook identifiers to PlayFab identifiers. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
         TArray<UPlayFabJsonObject*> Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
+        TArray<FPlayFabJsonView> DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -148,6 +161,9 @@ public:
     /** Mapping of Steam identifiers to PlayFab identifiers. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
         TArray<UPlayFabJsonObject*> Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
+        TArray<FPlayFabJsonView> DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -168,6 +184,9 @@ public:
     /** Account details for the user whose information was requested. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
         UPlayFabJsonObject* UserInfo = nullptr;
+    /** UserInfo, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
+        FPlayFabJsonView UserInfoView;
 };
 
 USTRUCT(BlueprintType)
@@ -188,6 +207,9 @@ public:
     /** Information about the bans */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
         TArray<UPlayFabJsonObject*> BanData;
+    /** BanData, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
+        TArray<FPlayFabJsonView> BanDataView;
 };
 
 USTRUCT(BlueprintType)
@@ -208,6 +230,9 @@ public:
     /** Information on the bans that were revoked. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
         TArray<UPlayFabJsonObject*> BanData;
+    /** BanData, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
+        TArray<FPlayFabJsonView> BanDataView;
 };
 
 USTRUCT(BlueprintType)
@@ -228,6 +253,9 @@ public:
     /** Information on the bans that were revoked */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
         TArray<UPlayFabJsonObject*> BanData;
+    /** BanData, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
+        TArray<FPlayFabJsonView> BanDataView;
 };
 
 USTRUCT(BlueprintType)
@@ -294,6 +322,9 @@ public:
     /** Information on the bans that were updated */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
         TArray<UPlayFabJsonObject*> BanData;
+    /** BanData, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Account Management Models")
+        TArray<FPlayFabJsonView> BanDataView;
 };
 
 
@@ -360,6 +391,9 @@ public:
     /** Ordered listing of users and their positions in the requested leaderboard. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
         TArray<UPlayFabJsonObject*> Leaderboard;
+    /** Leaderboard, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
+        TArray<FPlayFabJsonView> LeaderboardView;
     /** The version of the leaderboard returned. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
         int32 Version;
@@ -426,6 +460,9 @@ public:
     /** Ordered listing of users and their positions in the requested leaderboard. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
         TArray<UPlayFabJsonObject*> Leaderboard;
+    /** Leaderboard, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
+        TArray<FPlayFabJsonView> LeaderboardView;
     /** The version of the leaderboard returned. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
         int32 Version;
@@ -458,6 +495,9 @@ public:
     /** Results for requested info. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
         UPlayFabJsonObject* InfoResultPayload = nullptr;
+    /** InfoResultPayload, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
+        FPlayFabJsonView InfoResultPayloadView;
 };
 
 USTRUCT(BlueprintType)
@@ -487,6 +527,9 @@ public:
     /** User statistics for the requested user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
         TArray<UPlayFabJsonObject*> Statistics;
+    /** Statistics, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
+        TArray<FPlayFabJsonView> StatisticsView;
 };
 
 USTRUCT(BlueprintType)
@@ -507,6 +550,9 @@ public:
     /** version change history of the statistic */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
         TArray<UPlayFabJsonObject*> StatisticVersions;
+    /** StatisticVersions, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
+        TArray<FPlayFabJsonView> StatisticVersionsView;
 };
 
 USTRUCT(BlueprintType)
@@ -539,6 +585,9 @@ public:
     /** User specific data for this title. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
         UPlayFabJsonObject* Data = nullptr;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Data Management Models")
+        FPlayFabJsonView DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -632,6 +681,9 @@ public:
     /** Array of items which can be purchased. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Title-Wide Data Management Models")
         TArray<UPlayFabJsonObject*> Catalog;
+    /** Catalog, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Title-Wide Data Management Models")
+        TArray<FPlayFabJsonView> CatalogView;
 };
 
 USTRUCT(BlueprintType)
@@ -652,6 +704,9 @@ public:
     /** a dictionary object of key / value pairs */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Title-Wide Data Management Models")
         UPlayFabJsonObject* Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Title-Wide Data Management Models")
+        FPlayFabJsonView DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -689,6 +744,9 @@ public:
     /** a dictionary object of key / value pairs */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Title-Wide Data Management Models")
         UPlayFabJsonObject* Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Title-Wide Data Management Models")
+        FPlayFabJsonView DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -709,6 +767,9 @@ public:
     /** Array of news items. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Title-Wide Data Management Models")
         TArray<UPlayFabJsonObject*> News;
+    /** News, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Title-Wide Data Management Models")
+        TArray<FPlayFabJsonView> NewsView;
 };
 
 USTRUCT(BlueprintType)
@@ -908,12 +969,21 @@ public:
     /** Array of inventory items belonging to the character. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         TArray<UPlayFabJsonObject*> Inventory;
+    /** Inventory, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        TArray<FPlayFabJsonView> InventoryView;
     /** Array of virtual currency balance(s) belonging to the character. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrency;
+    /** VirtualCurrency, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyView;
     /** Array of remaining times and timestamps for virtual currencies. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrencyRechargeTimes = nullptr;
+    /** VirtualCurrencyRechargeTimes, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyRechargeTimesView;
 };
 
 USTRUCT(BlueprintType)
@@ -937,6 +1007,9 @@ public:
     /** array of random result tables currently available */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         UPlayFabJsonObject* Tables = nullptr;
+    /** Tables, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        FPlayFabJsonView TablesView;
 };
 
 USTRUCT(BlueprintType)
@@ -960,12 +1033,21 @@ public:
     /** Array of inventory items belonging to the user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         TArray<UPlayFabJsonObject*> Inventory;
+    /** Inventory, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        TArray<FPlayFabJsonView> InventoryView;
     /** Array of virtual currency balance(s) belonging to the user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrency;
+    /** VirtualCurrency, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyView;
     /** Array of remaining times and timestamps for virtual currencies. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrencyRechargeTimes = nullptr;
+    /** VirtualCurrencyRechargeTimes, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyRechargeTimesView;
 };
 
 USTRUCT(BlueprintType)
@@ -998,6 +1080,9 @@ public:
     /** Array of items granted to users. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         TArray<UPlayFabJsonObject*> ItemGrantResults;
+    /** ItemGrantResults, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        TArray<FPlayFabJsonView> ItemGrantResultsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1027,6 +1112,9 @@ public:
     /** Array of items granted to users. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         TArray<UPlayFabJsonObject*> ItemGrantResults;
+    /** ItemGrantResults, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        TArray<FPlayFabJsonView> ItemGrantResultsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1050,6 +1138,9 @@ public:
     /** Array of items granted to users. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         TArray<UPlayFabJsonObject*> ItemGrantResults;
+    /** ItemGrantResults, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        TArray<FPlayFabJsonView> ItemGrantResultsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1180,6 +1271,9 @@ public:
     /** Items granted to the player as a result of redeeming the coupon. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         TArray<UPlayFabJsonObject*> GrantedItems;
+    /** GrantedItems, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        TArray<FPlayFabJsonView> GrantedItemsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1305,9 +1399,15 @@ public:
     /** Items granted to the player as a result of unlocking the container. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         TArray<UPlayFabJsonObject*> GrantedItems;
+    /** GrantedItems, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        TArray<FPlayFabJsonView> GrantedItemsView;
     /** Virtual currency granted to the player as a result of unlocking the container. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrency;
+    /** VirtualCurrency, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyView;
 };
 
 USTRUCT(BlueprintType)
@@ -1402,6 +1502,9 @@ public:
     /** Array of friends found. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Friend List Management Models")
         TArray<UPlayFabJsonObject*> Friends;
+    /** Friends, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Friend List Management Models")
+        TArray<FPlayFabJsonView> FriendsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1505,6 +1608,9 @@ public:
     /** User account information for the user validated. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Matchmaking Models")
         UPlayFabJsonObject* UserInfo = nullptr;
+    /** UserInfo, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Matchmaking Models")
+        FPlayFabJsonView UserInfoView;
 };
 
 USTRUCT(BlueprintType)
@@ -1773,6 +1879,9 @@ public:
     /** Data for the requested keys. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Shared Group Data Models")
         UPlayFabJsonObject* Data = nullptr;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Shared Group Data Models")
+        FPlayFabJsonView DataView;
     /** List of PlayFabId identifiers for the members of this group, if requested. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Shared Group Data Models")
         FString Members;
@@ -1843,12 +1952,18 @@ public:
     /** The object returned from the CloudScript function, if any */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Server-Side Cloud Script Models")
         UPlayFabJsonObject* FunctionResult = nullptr;
+    /** FunctionResult, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Server-Side Cloud Script Models")
+        FPlayFabJsonView FunctionResultView;
     /** Flag indicating if the FunctionResult was too large and was subsequently dropped from this event. This only occurs if the total event size is larger than 350KB. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Server-Side Cloud Script Models")
         bool FunctionResultTooLarge;
     /** Entries logged during the function execution. These include both entries logged in the function code using log.info() and log.error() and error entries for API and HTTP request failures. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Server-Side Cloud Script Models")
         TArray<UPlayFabJsonObject*> Logs;
+    /** Logs, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Server-Side Cloud Script Models")
+        TArray<FPlayFabJsonView> LogsView;
     /** Flag indicating if the logs were too large and were subsequently dropped from this event. This only occurs if the total event size is larger than 350KB after the FunctionResult was removed. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Server-Side Cloud Script Models")
         bool LogsTooLarge;
@@ -1868,6 +1983,9 @@ public:
     /** Information about the error, if any, that occurred during execution */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Server-Side Cloud Script Models")
         UPlayFabJsonObject* Error = nullptr;
+    /** Error, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Server-Side Cloud Script Models")
+        FPlayFabJsonView ErrorView;
 };
 
 USTRUCT(BlueprintType)
@@ -1972,6 +2090,9 @@ public:
     /** The requested list of characters. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Characters Models")
         TArray<UPlayFabJsonObject*> Characters;
+    /** Characters, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Characters Models")
+        TArray<FPlayFabJsonView> CharactersView;
 };
 
 USTRUCT(BlueprintType)
@@ -2004,6 +2125,9 @@ public:
     /** Ordered list of leaderboard entries. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Characters Models")
         TArray<UPlayFabJsonObject*> Leaderboard;
+    /** Leaderboard, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Characters Models")
+        TArray<FPlayFabJsonView> LeaderboardView;
 };
 
 USTRUCT(BlueprintType)
@@ -2033,6 +2157,9 @@ public:
     /** Character statistics for the requested user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Characters Models")
         UPlayFabJsonObject* CharacterStatistics;
+    /** CharacterStatistics, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Characters Models")
+        FPlayFabJsonView CharacterStatisticsView;
 };
 
 USTRUCT(BlueprintType)
@@ -2065,6 +2192,9 @@ public:
     /** Ordered list of leaderboard entries. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Characters Models")
         TArray<UPlayFabJsonObject*> Leaderboard;
+    /** Leaderboard, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Characters Models")
+        TArray<FPlayFabJsonView> LeaderboardView;
 };
 
 USTRUCT(BlueprintType)
@@ -2091,6 +2221,9 @@ public:
     /** Ordered list of leaderboard entries. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Characters Models")
         TArray<UPlayFabJsonObject*> Leaderboard;
+    /** Leaderboard, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Characters Models")
+        TArray<FPlayFabJsonView> LeaderboardView;
 };
 
 USTRUCT(BlueprintType)
@@ -2180,6 +2313,9 @@ public:
     /** User specific data for this title. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Character Data Models")
         UPlayFabJsonObject* Data = nullptr;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Character Data Models")
+        FPlayFabJsonView DataView;
     /** Unique PlayFab assigned ID for a specific character owned by a user */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Character Data Models")
         FString CharacterId;
@@ -2262,6 +2398,9 @@ public:
     /** List of Action Groups. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | PlayStream Models")
         TArray<UPlayFabJsonObject*> ActionGroups;
+    /** ActionGroups, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | PlayStream Models")
+        TArray<FPlayFabJsonView> ActionGroupsView;
 };
 
 USTRUCT(BlueprintType)
@@ -2279,6 +2418,9 @@ public:
     /** Array of segments for this title. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | PlayStream Models")
         TArray<UPlayFabJsonObject*> Segments;
+    /** Segments, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | PlayStream Models")
+        TArray<FPlayFabJsonView> SegmentsView;
 };
 
 USTRUCT(BlueprintType)
@@ -2289,6 +2431,9 @@ public:
     /** Array of segments the requested player currently belongs to. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | PlayStream Models")
         TArray<UPlayFabJsonObject*> Segments;
+    /** Segments, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | PlayStream Models")
+        TArray<FPlayFabJsonView> SegmentsView;
 };
 
 USTRUCT(BlueprintType)
@@ -2334,6 +2479,9 @@ public:
     /** Array of player profiles in this segment. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | PlayStream Models")
         TArray<UPlayFabJsonObject*> PlayerProfiles;
+    /** PlayerProfiles, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | PlayStream Models")
+        TArray<FPlayFabJsonView> PlayerProfilesView;
 };
 
 USTRUCT(BlueprintType)
@@ -2405,5 +2553,8 @@ public:
     /** Array of achievements granted. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Platform Specific Methods Models")
         TArray<UPlayFabJsonObject*> AchievementResults;
+    /** AchievementResults, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Server | Platform Specific Methods Models")
+        TArray<FPlayFabJsonView> AchievementResultsView;
 };
 
@@ -6,6 +6,7 @@
 
 #include "PlayFabPrivatePCH.h"
 #include "PlayFabEnums.h"
+#include "PlayFabRequestWriter.h"
 #include "PlayFabClientAPI.h"
 
 UPlayFabClientAPI::UPlayFabClientAPI(const FObjectInitializer& ObjectInitializer)
@@ -16,6 +17,16 @@ UPlayFabClientAPI::UPlayFabClientAPI(const FObjectInitializer& ObjectInitializer
 void UPlayFabClientAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+UPlayFabJsonObject* UPlayFabClientAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr)
+    {
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabClientAPI::GetResponseObject()
@@ -67,12 +78,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPhotonAuthenticationToken(FClientGetPho
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPhotonAuthenticationToken = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPhotonAuthenticationToken);
 
@@ -80,16 +90,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPhotonAuthenticationToken(FClientGetPho
     manager->PlayFabRequestURL = "/Client/GetPhotonAuthenticationToken";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PhotonApplicationId.IsEmpty() || request.PhotonApplicationId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PhotonApplicationId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PhotonApplicationId"), request.PhotonApplicationId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PhotonApplicationId", request.PhotonApplicationId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -107,10 +115,10 @@ void UPlayFabClientAPI::HelperGetPhotonAuthenticationToken(FPlayFabBaseModel res
     }
     else
     {
-        FClientGetPhotonAuthenticationTokenResult result = UPlayFabClientModelDecoder::decodeGetPhotonAuthenticationTokenResultResponse(response.responseData);
-        if (OnSuccessGetPhotonAuthenticationToken.IsBound())
+        FClientGetPhotonAuthenticationTokenResult result = UPlayFabClientModelDecoder::readGetPhotonAuthenticationTokenResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPhotonAuthenticationToken.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPhotonAuthenticationToken(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -122,12 +130,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitlePublicKey(FClientGetTitlePublicKey
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTitlePublicKey = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetTitlePublicKey);
 
@@ -135,17 +142,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitlePublicKey(FClientGetTitlePublicKey
     manager->PlayFabRequestURL = "/Client/GetTitlePublicKey";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.TitleSharedSecret.IsEmpty() || request.TitleSharedSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TitleSharedSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TitleSharedSecret"), request.TitleSharedSecret);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("TitleSharedSecret", request.TitleSharedSecret);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -163,10 +169,10 @@ void UPlayFabClientAPI::HelperGetTitlePublicKey(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientGetTitlePublicKeyResult result = UPlayFabClientModelDecoder::decodeGetTitlePublicKeyResultResponse(response.responseData);
-        if (OnSuccessGetTitlePublicKey.IsBound())
+        FClientGetTitlePublicKeyResult result = UPlayFabClientModelDecoder::readGetTitlePublicKeyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTitlePublicKey.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTitlePublicKey(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -178,12 +184,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetWindowsHelloChallenge(FClientGetWindows
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetWindowsHelloChallenge = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetWindowsHelloChallenge);
 
@@ -191,17 +196,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetWindowsHelloChallenge(FClientGetWindows
     manager->PlayFabRequestURL = "/Client/GetWindowsHelloChallenge";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.PublicKeyHint.IsEmpty() || request.PublicKeyHint == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKeyHint"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKeyHint"), request.PublicKeyHint);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("PublicKeyHint", request.PublicKeyHint);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -219,10 +222,10 @@ void UPlayFabClientAPI::HelperGetWindowsHelloChallenge(FPlayFabBaseModel respons
     }
     else
     {
-        FClientGetWindowsHelloChallengeResponse result = UPlayFabClientModelDecoder::decodeGetWindowsHelloChallengeResponseResponse(response.responseData);
-        if (OnSuccessGetWindowsHelloChallenge.IsBound())
+        FClientGetWindowsHelloChallengeResponse result = UPlayFabClientModelDecoder::readGetWindowsHelloChallengeResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetWindowsHelloChallenge.Execute(result, mCustomData);
+            FDelegateOnSuccessGetWindowsHelloChallenge(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -234,12 +237,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithAndroidDeviceID(FClientLoginWithA
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithAndroidDeviceID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithAndroidDeviceID);
 
@@ -247,40 +249,22 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithAndroidDeviceID(FClientLoginWithA
     manager->PlayFabRequestURL = "/Client/LoginWithAndroidDeviceID";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.AndroidDeviceId.IsEmpty() || request.AndroidDeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDeviceId"), request.AndroidDeviceId);
-    }
-    if (request.OS.IsEmpty() || request.OS == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OS"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OS"), request.OS);
-    }
-    if (request.AndroidDevice.IsEmpty() || request.AndroidDevice == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDevice"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDevice"), request.AndroidDevice);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AndroidDeviceId", request.AndroidDeviceId);
+    Writer.WriteString("OS", request.OS);
+    Writer.WriteString("AndroidDevice", request.AndroidDevice);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -298,10 +282,14 @@ void UPlayFabClientAPI::HelperLoginWithAndroidDeviceID(FPlayFabBaseModel respons
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithAndroidDeviceID.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithAndroidDeviceID.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithAndroidDeviceID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -313,12 +301,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithCustomID(FClientLoginWithCustomID
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithCustomID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithCustomID);
 
@@ -326,30 +313,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithCustomID(FClientLoginWithCustomID
     manager->PlayFabRequestURL = "/Client/LoginWithCustomID";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.CustomId.IsEmpty() || request.CustomId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomId"), request.CustomId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CustomId", request.CustomId);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -367,10 +344,14 @@ void UPlayFabClientAPI::HelperLoginWithCustomID(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithCustomID.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithCustomID.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithCustomID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -382,12 +363,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithEmailAddress(FClientLoginWithEmai
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithEmailAddress = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithEmailAddress);
 
@@ -395,24 +375,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithEmailAddress(FClientLoginWithEmai
     manager->PlayFabRequestURL = "/Client/LoginWithEmailAddress";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("Email", request.Email);
+    Writer.WriteString("Password", request.Password);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -430,10 +404,14 @@ void UPlayFabClientAPI::HelperLoginWithEmailAddress(FPlayFabBaseModel response,
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithEmailAddress.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessLoginWithEmailAddress.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessLoginWithEmailAddress(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -445,12 +423,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithFacebook(FClientLoginWithFacebook
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithFacebook = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithFacebook);
 
@@ -458,30 +435,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithFacebook(FClientLoginWithFacebook
     manager->PlayFabRequestURL = "/Client/LoginWithFacebook";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AccessToken", request.AccessToken);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -499,10 +466,14 @@ void UPlayFabClientAPI::HelperLoginWithFacebook(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithFacebook.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithFacebook.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithFacebook(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -514,12 +485,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithGameCenter(FClientLoginWithGameCe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithGameCenter = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithGameCenter);
 
@@ -527,30 +497,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithGameCenter(FClientLoginWithGameCe
     manager->PlayFabRequestURL = "/Client/LoginWithGameCenter";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayerId.IsEmpty() || request.PlayerId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerId"), request.PlayerId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayerId", request.PlayerId);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -568,10 +528,14 @@ void UPlayFabClientAPI::HelperLoginWithGameCenter(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithGameCenter.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessLoginWithGameCenter.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessLoginWithGameCenter(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -583,12 +547,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithGoogleAccount(FClientLoginWithGoo
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithGoogleAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithGoogleAccount);
 
@@ -596,30 +559,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithGoogleAccount(FClientLoginWithGoo
     manager->PlayFabRequestURL = "/Client/LoginWithGoogleAccount";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.ServerAuthCode.IsEmpty() || request.ServerAuthCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerAuthCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerAuthCode"), request.ServerAuthCode);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ServerAuthCode", request.ServerAuthCode);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -637,10 +590,14 @@ void UPlayFabClientAPI::HelperLoginWithGoogleAccount(FPlayFabBaseModel response,
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithGoogleAccount.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithGoogleAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithGoogleAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -652,12 +609,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithIOSDeviceID(FClientLoginWithIOSDe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithIOSDeviceID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithIOSDeviceID);
 
@@ -665,40 +621,22 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithIOSDeviceID(FClientLoginWithIOSDe
     manager->PlayFabRequestURL = "/Client/LoginWithIOSDeviceID";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.DeviceId.IsEmpty() || request.DeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceId"), request.DeviceId);
-    }
-    if (request.OS.IsEmpty() || request.OS == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OS"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OS"), request.OS);
-    }
-    if (request.DeviceModel.IsEmpty() || request.DeviceModel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceModel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceModel"), request.DeviceModel);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("DeviceId", request.DeviceId);
+    Writer.WriteString("OS", request.OS);
+    Writer.WriteString("DeviceModel", request.DeviceModel);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -716,10 +654,14 @@ void UPlayFabClientAPI::HelperLoginWithIOSDeviceID(FPlayFabBaseModel response, U
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithIOSDeviceID.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithIOSDeviceID.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithIOSDeviceID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -731,12 +673,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithKongregate(FClientLoginWithKongre
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithKongregate = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithKongregate);
 
@@ -744,35 +685,21 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithKongregate(FClientLoginWithKongre
     manager->PlayFabRequestURL = "/Client/LoginWithKongregate";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.KongregateId.IsEmpty() || request.KongregateId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KongregateId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("KongregateId"), request.KongregateId);
-    }
-    if (request.AuthTicket.IsEmpty() || request.AuthTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AuthTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AuthTicket"), request.AuthTicket);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("KongregateId", request.KongregateId);
+    Writer.WriteString("AuthTicket", request.AuthTicket);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -790,10 +717,14 @@ void UPlayFabClientAPI::HelperLoginWithKongregate(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithKongregate.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithKongregate.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithKongregate(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -805,12 +736,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithPlayFab(FClientLoginWithPlayFabRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithPlayFab = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithPlayFab);
 
@@ -818,24 +748,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithPlayFab(FClientLoginWithPlayFabRe
     manager->PlayFabRequestURL = "/Client/LoginWithPlayFab";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("Username", request.Username);
+    Writer.WriteString("Password", request.Password);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -853,10 +777,14 @@ void UPlayFabClientAPI::HelperLoginWithPlayFab(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithPlayFab.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithPlayFab.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithPlayFab(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -868,12 +796,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithSteam(FClientLoginWithSteamReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithSteam = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithSteam);
 
@@ -881,30 +808,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithSteam(FClientLoginWithSteamReques
     manager->PlayFabRequestURL = "/Client/LoginWithSteam";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.SteamTicket.IsEmpty() || request.SteamTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SteamTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SteamTicket"), request.SteamTicket);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SteamTicket", request.SteamTicket);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -922,10 +839,14 @@ void UPlayFabClientAPI::HelperLoginWithSteam(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithSteam.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessLoginWithSteam.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessLoginWithSteam(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -937,12 +858,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithTwitch(FClientLoginWithTwitchRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithTwitch = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithTwitch);
 
@@ -950,30 +870,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithTwitch(FClientLoginWithTwitchRequ
     manager->PlayFabRequestURL = "/Client/LoginWithTwitch";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("CreateAccount"), request.CreateAccount);
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AccessToken", request.AccessToken);
+    Writer.WriteBool("CreateAccount", request.CreateAccount);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -991,10 +901,14 @@ void UPlayFabClientAPI::HelperLoginWithTwitch(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithTwitch.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithTwitch.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithTwitch(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1006,12 +920,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithWindowsHello(FClientLoginWithWind
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLoginWithWindowsHello = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLoginWithWindowsHello);
 
@@ -1019,24 +932,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::LoginWithWindowsHello(FClientLoginWithWind
     manager->PlayFabRequestURL = "/Client/LoginWithWindowsHello";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.ChallengeSignature.IsEmpty() || request.ChallengeSignature == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ChallengeSignature"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ChallengeSignature"), request.ChallengeSignature);
-    }
-    if (request.PublicKeyHint.IsEmpty() || request.PublicKeyHint == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKeyHint"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKeyHint"), request.PublicKeyHint);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("ChallengeSignature", request.ChallengeSignature);
+    Writer.WriteString("PublicKeyHint", request.PublicKeyHint);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1054,10 +961,14 @@ void UPlayFabClientAPI::HelperLoginWithWindowsHello(FPlayFabBaseModel response,
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessLoginWithWindowsHello.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLoginWithWindowsHello.Execute(result, mCustomData);
+            FDelegateOnSuccessLoginWithWindowsHello(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1069,12 +980,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterPlayFabUser(FClientRegisterPlayFab
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRegisterPlayFabUser = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRegisterPlayFabUser);
 
@@ -1082,44 +992,21 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterPlayFabUser(FClientRegisterPlayFab
     manager->PlayFabRequestURL = "/Client/RegisterPlayFabUser";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("RequireBothUsernameAndEmail"), request.RequireBothUsernameAndEmail);
-    if (request.DisplayName.IsEmpty() || request.DisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DisplayName"), request.DisplayName);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Username", request.Username);
+    Writer.WriteString("Email", request.Email);
+    Writer.WriteString("Password", request.Password);
+    Writer.WriteBool("RequireBothUsernameAndEmail", request.RequireBothUsernameAndEmail);
+    Writer.WriteString("DisplayName", request.DisplayName);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1137,10 +1024,14 @@ void UPlayFabClientAPI::HelperRegisterPlayFabUser(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientRegisterPlayFabUserResult result = UPlayFabClientModelDecoder::decodeRegisterPlayFabUserResultResponse(response.responseData);
-        if (OnSuccessRegisterPlayFabUser.IsBound())
+        FClientRegisterPlayFabUserResult result = UPlayFabClientModelDecoder::readRegisterPlayFabUserResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessRegisterPlayFabUser.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillRegisterPlayFabUserResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessRegisterPlayFabUser(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1152,12 +1043,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterWithWindowsHello(FClientRegisterWi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRegisterWithWindowsHello = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRegisterWithWindowsHello);
 
@@ -1165,39 +1055,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterWithWindowsHello(FClientRegisterWi
     manager->PlayFabRequestURL = "/Client/RegisterWithWindowsHello";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
     manager->isLoginRequest = true;
 
-    // Serialize all the request properties to json
-    if (request.UserName.IsEmpty() || request.UserName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("UserName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("UserName"), request.UserName);
-    }
-    if (request.PublicKey.IsEmpty() || request.PublicKey == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKey"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKey"), request.PublicKey);
-    }
-    if (request.DeviceName.IsEmpty() || request.DeviceName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceName"), request.DeviceName);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("UserName", request.UserName);
+    Writer.WriteString("PublicKey", request.PublicKey);
+    Writer.WriteString("DeviceName", request.DeviceName);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1215,10 +1086,14 @@ void UPlayFabClientAPI::HelperRegisterWithWindowsHello(FPlayFabBaseModel respons
     }
     else
     {
-        FClientLoginResult result = UPlayFabClientModelDecoder::decodeLoginResultResponse(response.responseData);
-        if (OnSuccessRegisterWithWindowsHello.IsBound())
+        FClientLoginResult result = UPlayFabClientModelDecoder::readLoginResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessRegisterWithWindowsHello.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillLoginResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessRegisterWithWindowsHello(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1230,12 +1105,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::SetPlayerSecret(FClientSetPlayerSecretRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetPlayerSecret = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperSetPlayerSecret);
 
@@ -1243,21 +1117,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::SetPlayerSecret(FClientSetPlayerSecretRequ
     manager->PlayFabRequestURL = "/Client/SetPlayerSecret";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.EncryptedRequest.IsEmpty() || request.EncryptedRequest == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EncryptedRequest"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EncryptedRequest"), request.EncryptedRequest);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteString("EncryptedRequest", request.EncryptedRequest);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1275,10 +1143,10 @@ void UPlayFabClientAPI::HelperSetPlayerSecret(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientSetPlayerSecretResult result = UPlayFabClientModelDecoder::decodeSetPlayerSecretResultResponse(response.responseData);
-        if (OnSuccessSetPlayerSecret.IsBound())
+        FClientSetPlayerSecretResult result = UPlayFabClientModelDecoder::readSetPlayerSecretResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetPlayerSecret.Execute(result, mCustomData);
+            FDelegateOnSuccessSetPlayerSecret(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1294,12 +1162,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddGenericID(FClientAddGenericIDRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddGenericID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAddGenericID);
 
@@ -1307,12 +1174,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddGenericID(FClientAddGenericIDRequest re
     manager->PlayFabRequestURL = "/Client/AddGenericID";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.GenericId != nullptr) OutRestJsonObj->SetObjectField(TEXT("GenericId"), request.GenericId);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("GenericId", request.GenericId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1330,10 +1198,10 @@ void UPlayFabClientAPI::HelperAddGenericID(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientAddGenericIDResult result = UPlayFabClientModelDecoder::decodeAddGenericIDResultResponse(response.responseData);
-        if (OnSuccessAddGenericID.IsBound())
+        FClientAddGenericIDResult result = UPlayFabClientModelDecoder::readAddGenericIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddGenericID.Execute(result, mCustomData);
+            FDelegateOnSuccessAddGenericID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1345,12 +1213,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddUsernamePassword(FClientAddUsernamePass
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddUsernamePassword = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAddUsernamePassword);
 
@@ -1358,26 +1225,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddUsernamePassword(FClientAddUsernamePass
     manager->PlayFabRequestURL = "/Client/AddUsernamePassword";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.Password.IsEmpty() || request.Password == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Password"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Password"), request.Password);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Username", request.Username);
+    Writer.WriteString("Email", request.Email);
+    Writer.WriteString("Password", request.Password);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1395,10 +1251,10 @@ void UPlayFabClientAPI::HelperAddUsernamePassword(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientAddUsernamePasswordResult result = UPlayFabClientModelDecoder::decodeAddUsernamePasswordResultResponse(response.responseData);
-        if (OnSuccessAddUsernamePassword.IsBound())
+        FClientAddUsernamePasswordResult result = UPlayFabClientModelDecoder::readAddUsernamePasswordResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddUsernamePassword.Execute(result, mCustomData);
+            FDelegateOnSuccessAddUsernamePassword(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1410,12 +1266,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAccountInfo(FClientGetAccountInfoReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetAccountInfo = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetAccountInfo);
 
@@ -1423,31 +1278,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAccountInfo(FClientGetAccountInfoReques
     manager->PlayFabRequestURL = "/Client/GetAccountInfo";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.TitleDisplayName.IsEmpty() || request.TitleDisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TitleDisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TitleDisplayName"), request.TitleDisplayName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("Username", request.Username);
+    Writer.WriteString("Email", request.Email);
+    Writer.WriteString("TitleDisplayName", request.TitleDisplayName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1465,10 +1307,14 @@ void UPlayFabClientAPI::HelperGetAccountInfo(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientGetAccountInfoResult result = UPlayFabClientModelDecoder::decodeGetAccountInfoResultResponse(response.responseData);
-        if (OnSuccessGetAccountInfo.IsBound())
+        FClientGetAccountInfoResult result = UPlayFabClientModelDecoder::readGetAccountInfoResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetAccountInfoResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetAccountInfo.Execute(result, mCustomData);
+            FDelegateOnSuccessGetAccountInfo(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1480,12 +1326,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerCombinedInfo(FClientGetPlayerComb
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerCombinedInfo = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerCombinedInfo);
 
@@ -1493,17 +1338,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerCombinedInfo(FClientGetPlayerComb
     manager->PlayFabRequestURL = "/Client/GetPlayerCombinedInfo";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1521,10 +1365,14 @@ void UPlayFabClientAPI::HelperGetPlayerCombinedInfo(FPlayFabBaseModel response,
     }
     else
     {
-        FClientGetPlayerCombinedInfoResult result = UPlayFabClientModelDecoder::decodeGetPlayerCombinedInfoResultResponse(response.responseData);
-        if (OnSuccessGetPlayerCombinedInfo.IsBound())
+        FClientGetPlayerCombinedInfoResult result = UPlayFabClientModelDecoder::readGetPlayerCombinedInfoResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayerCombinedInfoResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerCombinedInfo.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerCombinedInfo(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1536,12 +1384,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerProfile(FClientGetPlayerProfileRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerProfile = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerProfile);
 
@@ -1549,17 +1396,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerProfile(FClientGetPlayerProfileRe
     manager->PlayFabRequestURL = "/Client/GetPlayerProfile";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1577,10 +1423,14 @@ void UPlayFabClientAPI::HelperGetPlayerProfile(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientGetPlayerProfileResult result = UPlayFabClientModelDecoder::decodeGetPlayerProfileResultResponse(response.responseData);
-        if (OnSuccessGetPlayerProfile.IsBound())
+        FClientGetPlayerProfileResult result = UPlayFabClientModelDecoder::readGetPlayerProfileResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayerProfileResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerProfile.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerProfile(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1592,12 +1442,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(FClientGetPla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromFacebookIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromFacebookIDs);
 
@@ -1605,19 +1454,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromFacebookIDs(FClientGetPla
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromFacebookIDs";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.FacebookIDs.IsEmpty() || request.FacebookIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FacebookIDs"));
-    } else {
-        TArray<FString> FacebookIDsArray;
-        FString(request.FacebookIDs).ParseIntoArray(FacebookIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("FacebookIDs"), FacebookIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("FacebookIDs", request.FacebookIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1635,10 +1480,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromFacebookIDs(FPlayFabBaseModel res
     }
     else
     {
-        FClientGetPlayFabIDsFromFacebookIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromFacebookIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromFacebookIDs.IsBound())
+        FClientGetPlayFabIDsFromFacebookIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromFacebookIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromFacebookIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromFacebookIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromFacebookIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1650,12 +1499,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(FClientGetP
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromGameCenterIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromGameCenterIDs);
 
@@ -1663,19 +1511,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGameCenterIDs(FClientGetP
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromGameCenterIDs";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.GameCenterIDs.IsEmpty() || request.GameCenterIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameCenterIDs"));
-    } else {
-        TArray<FString> GameCenterIDsArray;
-        FString(request.GameCenterIDs).ParseIntoArray(GameCenterIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("GameCenterIDs"), GameCenterIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("GameCenterIDs", request.GameCenterIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1693,10 +1537,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromGameCenterIDs(FPlayFabBaseModel r
     }
     else
     {
-        FClientGetPlayFabIDsFromGameCenterIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGameCenterIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromGameCenterIDs.IsBound())
+        FClientGetPlayFabIDsFromGameCenterIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromGameCenterIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromGameCenterIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromGameCenterIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromGameCenterIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1708,12 +1556,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(FClientGetPlay
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromGenericIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromGenericIDs);
 
@@ -1721,16 +1568,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGenericIDs(FClientGetPlay
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromGenericIDs";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.GenericIDs.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("GenericIDs"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("GenericIDs"), request.GenericIDs);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("GenericIDs", request.GenericIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1748,10 +1594,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromGenericIDs(FPlayFabBaseModel resp
     }
     else
     {
-        FClientGetPlayFabIDsFromGenericIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGenericIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromGenericIDs.IsBound())
+        FClientGetPlayFabIDsFromGenericIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromGenericIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromGenericIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromGenericIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromGenericIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1763,12 +1613,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(FClientGetPlayF
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromGoogleIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromGoogleIDs);
 
@@ -1776,19 +1625,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromGoogleIDs(FClientGetPlayF
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromGoogleIDs";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.GoogleIDs.IsEmpty() || request.GoogleIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GoogleIDs"));
-    } else {
-        TArray<FString> GoogleIDsArray;
-        FString(request.GoogleIDs).ParseIntoArray(GoogleIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("GoogleIDs"), GoogleIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("GoogleIDs", request.GoogleIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1806,10 +1651,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromGoogleIDs(FPlayFabBaseModel respo
     }
     else
     {
-        FClientGetPlayFabIDsFromGoogleIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGoogleIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromGoogleIDs.IsBound())
+        FClientGetPlayFabIDsFromGoogleIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromGoogleIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromGoogleIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromGoogleIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromGoogleIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1821,12 +1670,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(FClientGetP
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromKongregateIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromKongregateIDs);
 
@@ -1834,19 +1682,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromKongregateIDs(FClientGetP
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromKongregateIDs";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.KongregateIDs.IsEmpty() || request.KongregateIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KongregateIDs"));
-    } else {
-        TArray<FString> KongregateIDsArray;
-        FString(request.KongregateIDs).ParseIntoArray(KongregateIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KongregateIDs"), KongregateIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("KongregateIDs", request.KongregateIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1864,10 +1708,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromKongregateIDs(FPlayFabBaseModel r
     }
     else
     {
-        FClientGetPlayFabIDsFromKongregateIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromKongregateIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromKongregateIDs.IsBound())
+        FClientGetPlayFabIDsFromKongregateIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromKongregateIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromKongregateIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromKongregateIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromKongregateIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1879,12 +1727,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(FClientGetPlayFa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromSteamIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromSteamIDs);
 
@@ -1892,19 +1739,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromSteamIDs(FClientGetPlayFa
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromSteamIDs";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.SteamStringIDs.IsEmpty() || request.SteamStringIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SteamStringIDs"));
-    } else {
-        TArray<FString> SteamStringIDsArray;
-        FString(request.SteamStringIDs).ParseIntoArray(SteamStringIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("SteamStringIDs"), SteamStringIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("SteamStringIDs", request.SteamStringIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1922,10 +1765,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromSteamIDs(FPlayFabBaseModel respon
     }
     else
     {
-        FClientGetPlayFabIDsFromSteamIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromSteamIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromSteamIDs.IsBound())
+        FClientGetPlayFabIDsFromSteamIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromSteamIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromSteamIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromSteamIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromSteamIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1937,12 +1784,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(FClientGetPlayF
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromTwitchIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayFabIDsFromTwitchIDs);
 
@@ -1950,19 +1796,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayFabIDsFromTwitchIDs(FClientGetPlayF
     manager->PlayFabRequestURL = "/Client/GetPlayFabIDsFromTwitchIDs";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.TwitchIds.IsEmpty() || request.TwitchIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TwitchIds"));
-    } else {
-        TArray<FString> TwitchIdsArray;
-        FString(request.TwitchIds).ParseIntoArray(TwitchIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("TwitchIds"), TwitchIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("TwitchIds", request.TwitchIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1980,10 +1822,14 @@ void UPlayFabClientAPI::HelperGetPlayFabIDsFromTwitchIDs(FPlayFabBaseModel respo
     }
     else
     {
-        FClientGetPlayFabIDsFromTwitchIDsResult result = UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromTwitchIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromTwitchIDs.IsBound())
+        FClientGetPlayFabIDsFromTwitchIDsResult result = UPlayFabClientModelDecoder::readGetPlayFabIDsFromTwitchIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayFabIDsFromTwitchIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromTwitchIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromTwitchIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1995,12 +1841,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkAndroidDeviceID(FClientLinkAndroidDevi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkAndroidDeviceID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkAndroidDeviceID);
 
@@ -2008,27 +1853,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkAndroidDeviceID(FClientLinkAndroidDevi
     manager->PlayFabRequestURL = "/Client/LinkAndroidDeviceID";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.AndroidDeviceId.IsEmpty() || request.AndroidDeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDeviceId"), request.AndroidDeviceId);
-    }
-    if (request.OS.IsEmpty() || request.OS == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OS"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OS"), request.OS);
-    }
-    if (request.AndroidDevice.IsEmpty() || request.AndroidDevice == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDevice"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDevice"), request.AndroidDevice);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AndroidDeviceId", request.AndroidDeviceId);
+    Writer.WriteString("OS", request.OS);
+    Writer.WriteString("AndroidDevice", request.AndroidDevice);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2046,10 +1881,10 @@ void UPlayFabClientAPI::HelperLinkAndroidDeviceID(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientLinkAndroidDeviceIDResult result = UPlayFabClientModelDecoder::decodeLinkAndroidDeviceIDResultResponse(response.responseData);
-        if (OnSuccessLinkAndroidDeviceID.IsBound())
+        FClientLinkAndroidDeviceIDResult result = UPlayFabClientModelDecoder::readLinkAndroidDeviceIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkAndroidDeviceID.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkAndroidDeviceID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2061,12 +1896,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkCustomID(FClientLinkCustomIDRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkCustomID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkCustomID);
 
@@ -2074,17 +1908,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkCustomID(FClientLinkCustomIDRequest re
     manager->PlayFabRequestURL = "/Client/LinkCustomID";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.CustomId.IsEmpty() || request.CustomId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomId"), request.CustomId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CustomId", request.CustomId);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2102,10 +1934,10 @@ void UPlayFabClientAPI::HelperLinkCustomID(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientLinkCustomIDResult result = UPlayFabClientModelDecoder::decodeLinkCustomIDResultResponse(response.responseData);
-        if (OnSuccessLinkCustomID.IsBound())
+        FClientLinkCustomIDResult result = UPlayFabClientModelDecoder::readLinkCustomIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkCustomID.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkCustomID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2117,12 +1949,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkFacebookAccount(FClientLinkFacebookAcc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkFacebookAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkFacebookAccount);
 
@@ -2130,17 +1961,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkFacebookAccount(FClientLinkFacebookAcc
     manager->PlayFabRequestURL = "/Client/LinkFacebookAccount";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AccessToken", request.AccessToken);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2158,10 +1987,10 @@ void UPlayFabClientAPI::HelperLinkFacebookAccount(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientLinkFacebookAccountResult result = UPlayFabClientModelDecoder::decodeLinkFacebookAccountResultResponse(response.responseData);
-        if (OnSuccessLinkFacebookAccount.IsBound())
+        FClientLinkFacebookAccountResult result = UPlayFabClientModelDecoder::readLinkFacebookAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkFacebookAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkFacebookAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2173,12 +2002,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkGameCenterAccount(FClientLinkGameCente
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkGameCenterAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkGameCenterAccount);
 
@@ -2186,17 +2014,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkGameCenterAccount(FClientLinkGameCente
     manager->PlayFabRequestURL = "/Client/LinkGameCenterAccount";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.GameCenterId.IsEmpty() || request.GameCenterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameCenterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameCenterId"), request.GameCenterId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("GameCenterId", request.GameCenterId);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2214,10 +2040,10 @@ void UPlayFabClientAPI::HelperLinkGameCenterAccount(FPlayFabBaseModel response,
     }
     else
     {
-        FClientLinkGameCenterAccountResult result = UPlayFabClientModelDecoder::decodeLinkGameCenterAccountResultResponse(response.responseData);
-        if (OnSuccessLinkGameCenterAccount.IsBound())
+        FClientLinkGameCenterAccountResult result = UPlayFabClientModelDecoder::readLinkGameCenterAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkGameCenterAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkGameCenterAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2229,12 +2055,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkGoogleAccount(FClientLinkGoogleAccount
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkGoogleAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkGoogleAccount);
 
@@ -2242,17 +2067,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkGoogleAccount(FClientLinkGoogleAccount
     manager->PlayFabRequestURL = "/Client/LinkGoogleAccount";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.ServerAuthCode.IsEmpty() || request.ServerAuthCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerAuthCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerAuthCode"), request.ServerAuthCode);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ServerAuthCode", request.ServerAuthCode);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2270,10 +2093,10 @@ void UPlayFabClientAPI::HelperLinkGoogleAccount(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientLinkGoogleAccountResult result = UPlayFabClientModelDecoder::decodeLinkGoogleAccountResultResponse(response.responseData);
-        if (OnSuccessLinkGoogleAccount.IsBound())
+        FClientLinkGoogleAccountResult result = UPlayFabClientModelDecoder::readLinkGoogleAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkGoogleAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkGoogleAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2285,12 +2108,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkIOSDeviceID(FClientLinkIOSDeviceIDRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkIOSDeviceID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkIOSDeviceID);
 
@@ -2298,27 +2120,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkIOSDeviceID(FClientLinkIOSDeviceIDRequ
     manager->PlayFabRequestURL = "/Client/LinkIOSDeviceID";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.DeviceId.IsEmpty() || request.DeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceId"), request.DeviceId);
-    }
-    if (request.OS.IsEmpty() || request.OS == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OS"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OS"), request.OS);
-    }
-    if (request.DeviceModel.IsEmpty() || request.DeviceModel == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceModel"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceModel"), request.DeviceModel);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("DeviceId", request.DeviceId);
+    Writer.WriteString("OS", request.OS);
+    Writer.WriteString("DeviceModel", request.DeviceModel);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2336,10 +2148,10 @@ void UPlayFabClientAPI::HelperLinkIOSDeviceID(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientLinkIOSDeviceIDResult result = UPlayFabClientModelDecoder::decodeLinkIOSDeviceIDResultResponse(response.responseData);
-        if (OnSuccessLinkIOSDeviceID.IsBound())
+        FClientLinkIOSDeviceIDResult result = UPlayFabClientModelDecoder::readLinkIOSDeviceIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkIOSDeviceID.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkIOSDeviceID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2351,12 +2163,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkKongregate(FClientLinkKongregateAccoun
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkKongregate = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkKongregate);
 
@@ -2364,22 +2175,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkKongregate(FClientLinkKongregateAccoun
     manager->PlayFabRequestURL = "/Client/LinkKongregate";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.KongregateId.IsEmpty() || request.KongregateId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KongregateId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("KongregateId"), request.KongregateId);
-    }
-    if (request.AuthTicket.IsEmpty() || request.AuthTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AuthTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AuthTicket"), request.AuthTicket);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("KongregateId", request.KongregateId);
+    Writer.WriteString("AuthTicket", request.AuthTicket);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2397,10 +2202,10 @@ void UPlayFabClientAPI::HelperLinkKongregate(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientLinkKongregateAccountResult result = UPlayFabClientModelDecoder::decodeLinkKongregateAccountResultResponse(response.responseData);
-        if (OnSuccessLinkKongregate.IsBound())
+        FClientLinkKongregateAccountResult result = UPlayFabClientModelDecoder::readLinkKongregateAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkKongregate.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkKongregate(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2412,12 +2217,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkSteamAccount(FClientLinkSteamAccountRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkSteamAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkSteamAccount);
 
@@ -2425,17 +2229,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkSteamAccount(FClientLinkSteamAccountRe
     manager->PlayFabRequestURL = "/Client/LinkSteamAccount";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.SteamTicket.IsEmpty() || request.SteamTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SteamTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SteamTicket"), request.SteamTicket);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SteamTicket", request.SteamTicket);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2453,10 +2255,10 @@ void UPlayFabClientAPI::HelperLinkSteamAccount(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientLinkSteamAccountResult result = UPlayFabClientModelDecoder::decodeLinkSteamAccountResultResponse(response.responseData);
-        if (OnSuccessLinkSteamAccount.IsBound())
+        FClientLinkSteamAccountResult result = UPlayFabClientModelDecoder::readLinkSteamAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkSteamAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkSteamAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2468,12 +2270,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkTwitch(FClientLinkTwitchAccountRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkTwitch = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkTwitch);
 
@@ -2481,17 +2282,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkTwitch(FClientLinkTwitchAccountRequest
     manager->PlayFabRequestURL = "/Client/LinkTwitch";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.AccessToken.IsEmpty() || request.AccessToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AccessToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AccessToken"), request.AccessToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AccessToken", request.AccessToken);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2509,10 +2308,10 @@ void UPlayFabClientAPI::HelperLinkTwitch(FPlayFabBaseModel response, UObject* cu
     }
     else
     {
-        FClientLinkTwitchAccountResult result = UPlayFabClientModelDecoder::decodeLinkTwitchAccountResultResponse(response.responseData);
-        if (OnSuccessLinkTwitch.IsBound())
+        FClientLinkTwitchAccountResult result = UPlayFabClientModelDecoder::readLinkTwitchAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkTwitch.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkTwitch(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2524,12 +2323,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkWindowsHello(FClientLinkWindowsHelloAc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessLinkWindowsHello = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperLinkWindowsHello);
 
@@ -2537,27 +2335,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::LinkWindowsHello(FClientLinkWindowsHelloAc
     manager->PlayFabRequestURL = "/Client/LinkWindowsHello";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.UserName.IsEmpty() || request.UserName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("UserName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("UserName"), request.UserName);
-    }
-    if (request.PublicKey.IsEmpty() || request.PublicKey == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKey"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKey"), request.PublicKey);
-    }
-    if (request.DeviceName.IsEmpty() || request.DeviceName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceName"), request.DeviceName);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceLink"), request.ForceLink);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("UserName", request.UserName);
+    Writer.WriteString("PublicKey", request.PublicKey);
+    Writer.WriteString("DeviceName", request.DeviceName);
+    Writer.WriteBool("ForceLink", request.ForceLink);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2575,10 +2363,10 @@ void UPlayFabClientAPI::HelperLinkWindowsHello(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientLinkWindowsHelloAccountResponse result = UPlayFabClientModelDecoder::decodeLinkWindowsHelloAccountResponseResponse(response.responseData);
-        if (OnSuccessLinkWindowsHello.IsBound())
+        FClientLinkWindowsHelloAccountResponse result = UPlayFabClientModelDecoder::readLinkWindowsHelloAccountResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessLinkWindowsHello.Execute(result, mCustomData);
+            FDelegateOnSuccessLinkWindowsHello(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2590,12 +2378,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveGenericID(FClientRemoveGenericIDRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRemoveGenericID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRemoveGenericID);
 
@@ -2603,12 +2390,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveGenericID(FClientRemoveGenericIDRequ
     manager->PlayFabRequestURL = "/Client/RemoveGenericID";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.GenericId != nullptr) OutRestJsonObj->SetObjectField(TEXT("GenericId"), request.GenericId);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("GenericId", request.GenericId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2626,10 +2414,10 @@ void UPlayFabClientAPI::HelperRemoveGenericID(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientRemoveGenericIDResult result = UPlayFabClientModelDecoder::decodeRemoveGenericIDResultResponse(response.responseData);
-        if (OnSuccessRemoveGenericID.IsBound())
+        FClientRemoveGenericIDResult result = UPlayFabClientModelDecoder::readRemoveGenericIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRemoveGenericID.Execute(result, mCustomData);
+            FDelegateOnSuccessRemoveGenericID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2641,12 +2429,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::ReportPlayer(FClientReportPlayerClientRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessReportPlayer = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperReportPlayer);
 
@@ -2654,21 +2441,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::ReportPlayer(FClientReportPlayerClientRequ
     manager->PlayFabRequestURL = "/Client/ReportPlayer";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.ReporteeId.IsEmpty() || request.ReporteeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReporteeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReporteeId"), request.ReporteeId);
-    }
-    if (request.Comment.IsEmpty() || request.Comment == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Comment"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Comment"), request.Comment);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ReporteeId", request.ReporteeId);
+    Writer.WriteString("Comment", request.Comment);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2686,10 +2466,10 @@ void UPlayFabClientAPI::HelperReportPlayer(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientReportPlayerClientResult result = UPlayFabClientModelDecoder::decodeReportPlayerClientResultResponse(response.responseData);
-        if (OnSuccessReportPlayer.IsBound())
+        FClientReportPlayerClientResult result = UPlayFabClientModelDecoder::readReportPlayerClientResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessReportPlayer.Execute(result, mCustomData);
+            FDelegateOnSuccessReportPlayer(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2701,12 +2481,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::SendAccountRecoveryEmail(FClientSendAccoun
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSendAccountRecoveryEmail = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperSendAccountRecoveryEmail);
 
@@ -2714,17 +2493,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::SendAccountRecoveryEmail(FClientSendAccoun
     manager->PlayFabRequestURL = "/Client/SendAccountRecoveryEmail";
     manager->useSessionTicket = false;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Email", request.Email);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2742,10 +2518,10 @@ void UPlayFabClientAPI::HelperSendAccountRecoveryEmail(FPlayFabBaseModel respons
     }
     else
     {
-        FClientSendAccountRecoveryEmailResult result = UPlayFabClientModelDecoder::decodeSendAccountRecoveryEmailResultResponse(response.responseData);
-        if (OnSuccessSendAccountRecoveryEmail.IsBound())
+        FClientSendAccountRecoveryEmailResult result = UPlayFabClientModelDecoder::readSendAccountRecoveryEmailResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSendAccountRecoveryEmail.Execute(result, mCustomData);
+            FDelegateOnSuccessSendAccountRecoveryEmail(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2757,12 +2533,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkAndroidDeviceID(FClientUnlinkAndroid
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkAndroidDeviceID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkAndroidDeviceID);
 
@@ -2770,16 +2545,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkAndroidDeviceID(FClientUnlinkAndroid
     manager->PlayFabRequestURL = "/Client/UnlinkAndroidDeviceID";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.AndroidDeviceId.IsEmpty() || request.AndroidDeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AndroidDeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AndroidDeviceId"), request.AndroidDeviceId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AndroidDeviceId", request.AndroidDeviceId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2797,10 +2570,10 @@ void UPlayFabClientAPI::HelperUnlinkAndroidDeviceID(FPlayFabBaseModel response,
     }
     else
     {
-        FClientUnlinkAndroidDeviceIDResult result = UPlayFabClientModelDecoder::decodeUnlinkAndroidDeviceIDResultResponse(response.responseData);
-        if (OnSuccessUnlinkAndroidDeviceID.IsBound())
+        FClientUnlinkAndroidDeviceIDResult result = UPlayFabClientModelDecoder::readUnlinkAndroidDeviceIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkAndroidDeviceID.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkAndroidDeviceID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2812,12 +2585,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkCustomID(FClientUnlinkCustomIDReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkCustomID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkCustomID);
 
@@ -2825,16 +2597,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkCustomID(FClientUnlinkCustomIDReques
     manager->PlayFabRequestURL = "/Client/UnlinkCustomID";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.CustomId.IsEmpty() || request.CustomId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomId"), request.CustomId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CustomId", request.CustomId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2852,10 +2622,10 @@ void UPlayFabClientAPI::HelperUnlinkCustomID(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientUnlinkCustomIDResult result = UPlayFabClientModelDecoder::decodeUnlinkCustomIDResultResponse(response.responseData);
-        if (OnSuccessUnlinkCustomID.IsBound())
+        FClientUnlinkCustomIDResult result = UPlayFabClientModelDecoder::readUnlinkCustomIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkCustomID.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkCustomID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2867,12 +2637,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkFacebookAccount(FClientUnlinkFaceboo
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkFacebookAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkFacebookAccount);
 
@@ -2880,11 +2649,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkFacebookAccount(FClientUnlinkFaceboo
     manager->PlayFabRequestURL = "/Client/UnlinkFacebookAccount";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2902,10 +2673,10 @@ void UPlayFabClientAPI::HelperUnlinkFacebookAccount(FPlayFabBaseModel response,
     }
     else
     {
-        FClientUnlinkFacebookAccountResult result = UPlayFabClientModelDecoder::decodeUnlinkFacebookAccountResultResponse(response.responseData);
-        if (OnSuccessUnlinkFacebookAccount.IsBound())
+        FClientUnlinkFacebookAccountResult result = UPlayFabClientModelDecoder::readUnlinkFacebookAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkFacebookAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkFacebookAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2917,12 +2688,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkGameCenterAccount(FClientUnlinkGameC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkGameCenterAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkGameCenterAccount);
 
@@ -2930,11 +2700,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkGameCenterAccount(FClientUnlinkGameC
     manager->PlayFabRequestURL = "/Client/UnlinkGameCenterAccount";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2952,10 +2724,10 @@ void UPlayFabClientAPI::HelperUnlinkGameCenterAccount(FPlayFabBaseModel response
     }
     else
     {
-        FClientUnlinkGameCenterAccountResult result = UPlayFabClientModelDecoder::decodeUnlinkGameCenterAccountResultResponse(response.responseData);
-        if (OnSuccessUnlinkGameCenterAccount.IsBound())
+        FClientUnlinkGameCenterAccountResult result = UPlayFabClientModelDecoder::readUnlinkGameCenterAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkGameCenterAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkGameCenterAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2967,12 +2739,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkGoogleAccount(FClientUnlinkGoogleAcc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkGoogleAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkGoogleAccount);
 
@@ -2980,11 +2751,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkGoogleAccount(FClientUnlinkGoogleAcc
     manager->PlayFabRequestURL = "/Client/UnlinkGoogleAccount";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3002,10 +2775,10 @@ void UPlayFabClientAPI::HelperUnlinkGoogleAccount(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientUnlinkGoogleAccountResult result = UPlayFabClientModelDecoder::decodeUnlinkGoogleAccountResultResponse(response.responseData);
-        if (OnSuccessUnlinkGoogleAccount.IsBound())
+        FClientUnlinkGoogleAccountResult result = UPlayFabClientModelDecoder::readUnlinkGoogleAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkGoogleAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkGoogleAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3017,12 +2790,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkIOSDeviceID(FClientUnlinkIOSDeviceID
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkIOSDeviceID = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkIOSDeviceID);
 
@@ -3030,16 +2802,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkIOSDeviceID(FClientUnlinkIOSDeviceID
     manager->PlayFabRequestURL = "/Client/UnlinkIOSDeviceID";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.DeviceId.IsEmpty() || request.DeviceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceId"), request.DeviceId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("DeviceId", request.DeviceId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3057,10 +2827,10 @@ void UPlayFabClientAPI::HelperUnlinkIOSDeviceID(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientUnlinkIOSDeviceIDResult result = UPlayFabClientModelDecoder::decodeUnlinkIOSDeviceIDResultResponse(response.responseData);
-        if (OnSuccessUnlinkIOSDeviceID.IsBound())
+        FClientUnlinkIOSDeviceIDResult result = UPlayFabClientModelDecoder::readUnlinkIOSDeviceIDResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkIOSDeviceID.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkIOSDeviceID(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3072,12 +2842,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkKongregate(FClientUnlinkKongregateAc
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkKongregate = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkKongregate);
 
@@ -3085,11 +2854,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkKongregate(FClientUnlinkKongregateAc
     manager->PlayFabRequestURL = "/Client/UnlinkKongregate";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3107,10 +2878,10 @@ void UPlayFabClientAPI::HelperUnlinkKongregate(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientUnlinkKongregateAccountResult result = UPlayFabClientModelDecoder::decodeUnlinkKongregateAccountResultResponse(response.responseData);
-        if (OnSuccessUnlinkKongregate.IsBound())
+        FClientUnlinkKongregateAccountResult result = UPlayFabClientModelDecoder::readUnlinkKongregateAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkKongregate.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkKongregate(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3122,12 +2893,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkSteamAccount(FClientUnlinkSteamAccou
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkSteamAccount = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkSteamAccount);
 
@@ -3135,11 +2905,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkSteamAccount(FClientUnlinkSteamAccou
     manager->PlayFabRequestURL = "/Client/UnlinkSteamAccount";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3157,10 +2929,10 @@ void UPlayFabClientAPI::HelperUnlinkSteamAccount(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FClientUnlinkSteamAccountResult result = UPlayFabClientModelDecoder::decodeUnlinkSteamAccountResultResponse(response.responseData);
-        if (OnSuccessUnlinkSteamAccount.IsBound())
+        FClientUnlinkSteamAccountResult result = UPlayFabClientModelDecoder::readUnlinkSteamAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkSteamAccount.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkSteamAccount(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3172,12 +2944,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkTwitch(FClientUnlinkTwitchAccountReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkTwitch = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkTwitch);
 
@@ -3185,11 +2956,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkTwitch(FClientUnlinkTwitchAccountReq
     manager->PlayFabRequestURL = "/Client/UnlinkTwitch";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3207,10 +2980,10 @@ void UPlayFabClientAPI::HelperUnlinkTwitch(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientUnlinkTwitchAccountResult result = UPlayFabClientModelDecoder::decodeUnlinkTwitchAccountResultResponse(response.responseData);
-        if (OnSuccessUnlinkTwitch.IsBound())
+        FClientUnlinkTwitchAccountResult result = UPlayFabClientModelDecoder::readUnlinkTwitchAccountResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkTwitch.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkTwitch(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3222,12 +2995,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkWindowsHello(FClientUnlinkWindowsHel
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlinkWindowsHello = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlinkWindowsHello);
 
@@ -3235,16 +3007,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlinkWindowsHello(FClientUnlinkWindowsHel
     manager->PlayFabRequestURL = "/Client/UnlinkWindowsHello";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PublicKeyHint.IsEmpty() || request.PublicKeyHint == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PublicKeyHint"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PublicKeyHint"), request.PublicKeyHint);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PublicKeyHint", request.PublicKeyHint);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3262,10 +3032,10 @@ void UPlayFabClientAPI::HelperUnlinkWindowsHello(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FClientUnlinkWindowsHelloAccountResponse result = UPlayFabClientModelDecoder::decodeUnlinkWindowsHelloAccountResponseResponse(response.responseData);
-        if (OnSuccessUnlinkWindowsHello.IsBound())
+        FClientUnlinkWindowsHelloAccountResponse result = UPlayFabClientModelDecoder::readUnlinkWindowsHelloAccountResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlinkWindowsHello.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlinkWindowsHello(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3277,12 +3047,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateAvatarUrl(FClientUpdateAvatarUrlRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateAvatarUrl = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateAvatarUrl);
 
@@ -3290,16 +3059,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateAvatarUrl(FClientUpdateAvatarUrlRequ
     manager->PlayFabRequestURL = "/Client/UpdateAvatarUrl";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.ImageUrl.IsEmpty() || request.ImageUrl == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ImageUrl"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ImageUrl"), request.ImageUrl);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ImageUrl", request.ImageUrl);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3317,10 +3083,10 @@ void UPlayFabClientAPI::HelperUpdateAvatarUrl(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientEmptyResult result = UPlayFabClientModelDecoder::decodeEmptyResultResponse(response.responseData);
-        if (OnSuccessUpdateAvatarUrl.IsBound())
+        FClientEmptyResult result = UPlayFabClientModelDecoder::readEmptyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateAvatarUrl.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateAvatarUrl(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3332,12 +3098,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserTitleDisplayName(FClientUpdateUs
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserTitleDisplayName = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateUserTitleDisplayName);
 
@@ -3345,16 +3110,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserTitleDisplayName(FClientUpdateUs
     manager->PlayFabRequestURL = "/Client/UpdateUserTitleDisplayName";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.DisplayName.IsEmpty() || request.DisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DisplayName"), request.DisplayName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("DisplayName", request.DisplayName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3372,10 +3134,10 @@ void UPlayFabClientAPI::HelperUpdateUserTitleDisplayName(FPlayFabBaseModel respo
     }
     else
     {
-        FClientUpdateUserTitleDisplayNameResult result = UPlayFabClientModelDecoder::decodeUpdateUserTitleDisplayNameResultResponse(response.responseData);
-        if (OnSuccessUpdateUserTitleDisplayName.IsBound())
+        FClientUpdateUserTitleDisplayNameResult result = UPlayFabClientModelDecoder::readUpdateUserTitleDisplayNameResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserTitleDisplayName.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserTitleDisplayName(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3391,12 +3153,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendLeaderboard(FClientGetFriendLeade
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetFriendLeaderboard = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetFriendLeaderboard);
 
@@ -3404,23 +3165,22 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendLeaderboard(FClientGetFriendLeade
     manager->PlayFabRequestURL = "/Client/GetFriendLeaderboard";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("StartPosition", request.StartPosition);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteBool("IncludeSteamFriends", request.IncludeSteamFriends);
+    Writer.WriteBool("IncludeFacebookFriends", request.IncludeFacebookFriends);
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteBool("UseSpecificVersion", request.UseSpecificVersion);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3438,10 +3198,14 @@ void UPlayFabClientAPI::HelperGetFriendLeaderboard(FPlayFabBaseModel response, U
     }
     else
     {
-        FClientGetLeaderboardResult result = UPlayFabClientModelDecoder::decodeGetLeaderboardResultResponse(response.responseData);
-        if (OnSuccessGetFriendLeaderboard.IsBound())
+        FClientGetLeaderboardResult result = UPlayFabClientModelDecoder::readGetLeaderboardResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetLeaderboardResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetFriendLeaderboard.Execute(result, mCustomData);
+            FDelegateOnSuccessGetFriendLeaderboard(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3453,12 +3217,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(FClientGe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetFriendLeaderboardAroundPlayer = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetFriendLeaderboardAroundPlayer);
 
@@ -3466,27 +3229,22 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendLeaderboardAroundPlayer(FClientGe
     manager->PlayFabRequestURL = "/Client/GetFriendLeaderboardAroundPlayer";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteBool("IncludeSteamFriends", request.IncludeSteamFriends);
+    Writer.WriteBool("IncludeFacebookFriends", request.IncludeFacebookFriends);
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteBool("UseSpecificVersion", request.UseSpecificVersion);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3504,10 +3262,14 @@ void UPlayFabClientAPI::HelperGetFriendLeaderboardAroundPlayer(FPlayFabBaseModel
     }
     else
     {
-        FClientGetFriendLeaderboardAroundPlayerResult result = UPlayFabClientModelDecoder::decodeGetFriendLeaderboardAroundPlayerResultResponse(response.responseData);
-        if (OnSuccessGetFriendLeaderboardAroundPlayer.IsBound())
+        FClientGetFriendLeaderboardAroundPlayerResult result = UPlayFabClientModelDecoder::readGetFriendLeaderboardAroundPlayerResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetFriendLeaderboardAroundPlayerResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetFriendLeaderboardAroundPlayer.Execute(result, mCustomData);
+            FDelegateOnSuccessGetFriendLeaderboardAroundPlayer(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3519,12 +3281,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboard(FClientGetLeaderboardReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetLeaderboard = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetLeaderboard);
 
@@ -3532,21 +3293,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboard(FClientGetLeaderboardReques
     manager->PlayFabRequestURL = "/Client/GetLeaderboard";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("StartPosition", request.StartPosition);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteBool("UseSpecificVersion", request.UseSpecificVersion);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3564,10 +3324,14 @@ void UPlayFabClientAPI::HelperGetLeaderboard(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientGetLeaderboardResult result = UPlayFabClientModelDecoder::decodeGetLeaderboardResultResponse(response.responseData);
-        if (OnSuccessGetLeaderboard.IsBound())
+        FClientGetLeaderboardResult result = UPlayFabClientModelDecoder::readGetLeaderboardResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetLeaderboardResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetLeaderboard.Execute(result, mCustomData);
+            FDelegateOnSuccessGetLeaderboard(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3579,12 +3343,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardAroundPlayer(FClientGetLeade
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetLeaderboardAroundPlayer = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetLeaderboardAroundPlayer);
 
@@ -3592,25 +3355,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardAroundPlayer(FClientGetLeade
     manager->PlayFabRequestURL = "/Client/GetLeaderboardAroundPlayer";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteBool("UseSpecificVersion", request.UseSpecificVersion);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3628,10 +3386,14 @@ void UPlayFabClientAPI::HelperGetLeaderboardAroundPlayer(FPlayFabBaseModel respo
     }
     else
     {
-        FClientGetLeaderboardAroundPlayerResult result = UPlayFabClientModelDecoder::decodeGetLeaderboardAroundPlayerResultResponse(response.responseData);
-        if (OnSuccessGetLeaderboardAroundPlayer.IsBound())
+        FClientGetLeaderboardAroundPlayerResult result = UPlayFabClientModelDecoder::readGetLeaderboardAroundPlayerResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetLeaderboardAroundPlayer.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetLeaderboardAroundPlayerResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetLeaderboardAroundPlayer(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3643,12 +3405,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerStatistics(FClientGetPlayerStatis
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerStatistics);
 
@@ -3656,24 +3417,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerStatistics(FClientGetPlayerStatis
     manager->PlayFabRequestURL = "/Client/GetPlayerStatistics";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.StatisticNames.IsEmpty() || request.StatisticNames == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticNames"));
-    } else {
-        TArray<FString> StatisticNamesArray;
-        FString(request.StatisticNames).ParseIntoArray(StatisticNamesArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("StatisticNames"), StatisticNamesArray);
-    }
-    if (request.StatisticNameVersions.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticNameVersions"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("StatisticNameVersions"), request.StatisticNameVersions);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("StatisticNames", request.StatisticNames);
+    Writer.WriteObjectArray("StatisticNameVersions", request.StatisticNameVersions);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3691,10 +3444,14 @@ void UPlayFabClientAPI::HelperGetPlayerStatistics(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientGetPlayerStatisticsResult result = UPlayFabClientModelDecoder::decodeGetPlayerStatisticsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerStatistics.IsBound())
+        FClientGetPlayerStatisticsResult result = UPlayFabClientModelDecoder::readGetPlayerStatisticsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayerStatisticsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3706,12 +3463,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerStatisticVersions(FClientGetPlaye
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerStatisticVersions = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerStatisticVersions);
 
@@ -3719,16 +3475,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerStatisticVersions(FClientGetPlaye
     manager->PlayFabRequestURL = "/Client/GetPlayerStatisticVersions";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3746,10 +3501,14 @@ void UPlayFabClientAPI::HelperGetPlayerStatisticVersions(FPlayFabBaseModel respo
     }
     else
     {
-        FClientGetPlayerStatisticVersionsResult result = UPlayFabClientModelDecoder::decodeGetPlayerStatisticVersionsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerStatisticVersions.IsBound())
+        FClientGetPlayerStatisticVersionsResult result = UPlayFabClientModelDecoder::readGetPlayerStatisticVersionsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayerStatisticVersionsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerStatisticVersions.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerStatisticVersions(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3761,12 +3520,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserData(FClientGetUserDataRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetUserData);
 
@@ -3774,25 +3532,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserData(FClientGetUserDataRequest requ
     manager->PlayFabRequestURL = "/Client/GetUserData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3810,10 +3560,14 @@ void UPlayFabClientAPI::HelperGetUserData(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FClientGetUserDataResult result = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserData.IsBound())
+        FClientGetUserDataResult result = UPlayFabClientModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3825,12 +3579,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserPublisherData(FClientGetUserDataReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetUserPublisherData);
 
@@ -3838,25 +3591,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserPublisherData(FClientGetUserDataReq
     manager->PlayFabRequestURL = "/Client/GetUserPublisherData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3874,10 +3619,14 @@ void UPlayFabClientAPI::HelperGetUserPublisherData(FPlayFabBaseModel response, U
     }
     else
     {
-        FClientGetUserDataResult result = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserPublisherData.IsBound())
+        FClientGetUserDataResult result = UPlayFabClientModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserPublisherData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3889,12 +3638,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserPublisherReadOnlyData(FClientGetUse
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserPublisherReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetUserPublisherReadOnlyData);
 
@@ -3902,25 +3650,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserPublisherReadOnlyData(FClientGetUse
     manager->PlayFabRequestURL = "/Client/GetUserPublisherReadOnlyData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3938,10 +3678,14 @@ void UPlayFabClientAPI::HelperGetUserPublisherReadOnlyData(FPlayFabBaseModel res
     }
     else
     {
-        FClientGetUserDataResult result = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserPublisherReadOnlyData.IsBound())
+        FClientGetUserDataResult result = UPlayFabClientModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetUserPublisherReadOnlyData.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetUserPublisherReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3953,12 +3697,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserReadOnlyData(FClientGetUserDataRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetUserReadOnlyData);
 
@@ -3966,25 +3709,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserReadOnlyData(FClientGetUserDataRequ
     manager->PlayFabRequestURL = "/Client/GetUserReadOnlyData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4002,10 +3737,14 @@ void UPlayFabClientAPI::HelperGetUserReadOnlyData(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientGetUserDataResult result = UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserReadOnlyData.IsBound())
+        FClientGetUserDataResult result = UPlayFabClientModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserReadOnlyData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4017,12 +3756,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdatePlayerStatistics(FClientUpdatePlayer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdatePlayerStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdatePlayerStatistics);
 
@@ -4030,16 +3768,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdatePlayerStatistics(FClientUpdatePlayer
     manager->PlayFabRequestURL = "/Client/UpdatePlayerStatistics";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Statistics.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Statistics"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Statistics"), request.Statistics);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("Statistics", request.Statistics);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4057,10 +3792,10 @@ void UPlayFabClientAPI::HelperUpdatePlayerStatistics(FPlayFabBaseModel response,
     }
     else
     {
-        FClientUpdatePlayerStatisticsResult result = UPlayFabClientModelDecoder::decodeUpdatePlayerStatisticsResultResponse(response.responseData);
-        if (OnSuccessUpdatePlayerStatistics.IsBound())
+        FClientUpdatePlayerStatisticsResult result = UPlayFabClientModelDecoder::readUpdatePlayerStatisticsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdatePlayerStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdatePlayerStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4072,12 +3807,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserData(FClientUpdateUserDataReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateUserData);
 
@@ -4085,23 +3819,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserData(FClientUpdateUserDataReques
     manager->PlayFabRequestURL = "/Client/UpdateUserData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4119,10 +3846,10 @@ void UPlayFabClientAPI::HelperUpdateUserData(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientUpdateUserDataResult result = UPlayFabClientModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserData.IsBound())
+        FClientUpdateUserDataResult result = UPlayFabClientModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4134,12 +3861,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserPublisherData(FClientUpdateUserD
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateUserPublisherData);
 
@@ -4147,23 +3873,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateUserPublisherData(FClientUpdateUserD
     manager->PlayFabRequestURL = "/Client/UpdateUserPublisherData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4181,10 +3900,10 @@ void UPlayFabClientAPI::HelperUpdateUserPublisherData(FPlayFabBaseModel response
     }
     else
     {
-        FClientUpdateUserDataResult result = UPlayFabClientModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserPublisherData.IsBound())
+        FClientUpdateUserDataResult result = UPlayFabClientModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserPublisherData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4200,12 +3919,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCatalogItems(FClientGetCatalogItemsRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCatalogItems = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCatalogItems);
 
@@ -4213,16 +3931,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCatalogItems(FClientGetCatalogItemsRequ
     manager->PlayFabRequestURL = "/Client/GetCatalogItems";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4240,10 +3957,14 @@ void UPlayFabClientAPI::HelperGetCatalogItems(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientGetCatalogItemsResult result = UPlayFabClientModelDecoder::decodeGetCatalogItemsResultResponse(response.responseData);
-        if (OnSuccessGetCatalogItems.IsBound())
+        FClientGetCatalogItemsResult result = UPlayFabClientModelDecoder::readGetCatalogItemsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetCatalogItemsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCatalogItems.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCatalogItems(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4255,12 +3976,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPublisherData(FClientGetPublisherDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPublisherData);
 
@@ -4268,19 +3988,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPublisherData(FClientGetPublisherDataRe
     manager->PlayFabRequestURL = "/Client/GetPublisherData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4298,10 +4014,14 @@ void UPlayFabClientAPI::HelperGetPublisherData(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientGetPublisherDataResult result = UPlayFabClientModelDecoder::decodeGetPublisherDataResultResponse(response.responseData);
-        if (OnSuccessGetPublisherData.IsBound())
+        FClientGetPublisherDataResult result = UPlayFabClientModelDecoder::readGetPublisherDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetPublisherData.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetPublisherDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4313,12 +4033,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetStoreItems(FClientGetStoreItemsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetStoreItems = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetStoreItems);
 
@@ -4326,21 +4045,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetStoreItems(FClientGetStoreItemsRequest
     manager->PlayFabRequestURL = "/Client/GetStoreItems";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("StoreId", request.StoreId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4358,10 +4072,14 @@ void UPlayFabClientAPI::HelperGetStoreItems(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientGetStoreItemsResult result = UPlayFabClientModelDecoder::decodeGetStoreItemsResultResponse(response.responseData);
-        if (OnSuccessGetStoreItems.IsBound())
+        FClientGetStoreItemsResult result = UPlayFabClientModelDecoder::readGetStoreItemsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetStoreItems.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetStoreItemsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetStoreItems(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4373,12 +4091,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTime(FClientGetTimeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTime = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetTime);
 
@@ -4386,11 +4103,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTime(FClientGetTimeRequest request,
     manager->PlayFabRequestURL = "/Client/GetTime";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4408,10 +4128,10 @@ void UPlayFabClientAPI::HelperGetTime(FPlayFabBaseModel response, UObject* custo
     }
     else
     {
-        FClientGetTimeResult result = UPlayFabClientModelDecoder::decodeGetTimeResultResponse(response.responseData);
-        if (OnSuccessGetTime.IsBound())
+        FClientGetTimeResult result = UPlayFabClientModelDecoder::readGetTimeResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTime.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTime(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4423,12 +4143,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitleData(FClientGetTitleDataRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTitleData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetTitleData);
 
@@ -4436,19 +4155,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitleData(FClientGetTitleDataRequest re
     manager->PlayFabRequestURL = "/Client/GetTitleData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4466,10 +4181,14 @@ void UPlayFabClientAPI::HelperGetTitleData(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientGetTitleDataResult result = UPlayFabClientModelDecoder::decodeGetTitleDataResultResponse(response.responseData);
-        if (OnSuccessGetTitleData.IsBound())
+        FClientGetTitleDataResult result = UPlayFabClientModelDecoder::readGetTitleDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetTitleDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTitleData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTitleData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4481,12 +4200,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitleNews(FClientGetTitleNewsRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTitleNews = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetTitleNews);
 
@@ -4494,12 +4212,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTitleNews(FClientGetTitleNewsRequest re
     manager->PlayFabRequestURL = "/Client/GetTitleNews";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Count"), request.Count);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteNumber("Count", request.Count);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4517,10 +4238,14 @@ void UPlayFabClientAPI::HelperGetTitleNews(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientGetTitleNewsResult result = UPlayFabClientModelDecoder::decodeGetTitleNewsResultResponse(response.responseData);
-        if (OnSuccessGetTitleNews.IsBound())
+        FClientGetTitleNewsResult result = UPlayFabClientModelDecoder::readGetTitleNewsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetTitleNewsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTitleNews.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTitleNews(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4536,12 +4261,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddUserVirtualCurrency(FClientAddUserVirtu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddUserVirtualCurrency = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAddUserVirtualCurrency);
 
@@ -4549,17 +4273,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddUserVirtualCurrency(FClientAddUserVirtu
     manager->PlayFabRequestURL = "/Client/AddUserVirtualCurrency";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("VirtualCurrency", request.VirtualCurrency);
+    Writer.WriteNumber("Amount", request.Amount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4577,10 +4298,10 @@ void UPlayFabClientAPI::HelperAddUserVirtualCurrency(FPlayFabBaseModel response,
     }
     else
     {
-        FClientModifyUserVirtualCurrencyResult result = UPlayFabClientModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
-        if (OnSuccessAddUserVirtualCurrency.IsBound())
+        FClientModifyUserVirtualCurrencyResult result = UPlayFabClientModelDecoder::readModifyUserVirtualCurrencyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddUserVirtualCurrency.Execute(result, mCustomData);
+            FDelegateOnSuccessAddUserVirtualCurrency(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4592,12 +4313,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConfirmPurchase(FClientConfirmPurchaseRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessConfirmPurchase = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperConfirmPurchase);
 
@@ -4605,16 +4325,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConfirmPurchase(FClientConfirmPurchaseRequ
     manager->PlayFabRequestURL = "/Client/ConfirmPurchase";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("OrderId", request.OrderId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4632,10 +4349,14 @@ void UPlayFabClientAPI::HelperConfirmPurchase(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientConfirmPurchaseResult result = UPlayFabClientModelDecoder::decodeConfirmPurchaseResultResponse(response.responseData);
-        if (OnSuccessConfirmPurchase.IsBound())
+        FClientConfirmPurchaseResult result = UPlayFabClientModelDecoder::readConfirmPurchaseResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillConfirmPurchaseResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessConfirmPurchase.Execute(result, mCustomData);
+            FDelegateOnSuccessConfirmPurchase(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4647,12 +4368,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumeItem(FClientConsumeItemRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessConsumeItem = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperConsumeItem);
 
@@ -4660,22 +4380,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::ConsumeItem(FClientConsumeItemRequest requ
     manager->PlayFabRequestURL = "/Client/ConsumeItem";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("ConsumeCount"), request.ConsumeCount);
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ItemInstanceId", request.ItemInstanceId);
+    Writer.WriteNumber("ConsumeCount", request.ConsumeCount);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4693,10 +4406,10 @@ void UPlayFabClientAPI::HelperConsumeItem(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FClientConsumeItemResult result = UPlayFabClientModelDecoder::decodeConsumeItemResultResponse(response.responseData);
-        if (OnSuccessConsumeItem.IsBound())
+        FClientConsumeItemResult result = UPlayFabClientModelDecoder::readConsumeItemResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessConsumeItem.Execute(result, mCustomData);
+            FDelegateOnSuccessConsumeItem(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4708,12 +4421,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterInventory(FClientGetCharacterI
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterInventory = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCharacterInventory);
 
@@ -4721,21 +4433,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterInventory(FClientGetCharacterI
     manager->PlayFabRequestURL = "/Client/GetCharacterInventory";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4753,10 +4460,14 @@ void UPlayFabClientAPI::HelperGetCharacterInventory(FPlayFabBaseModel response,
     }
     else
     {
-        FClientGetCharacterInventoryResult result = UPlayFabClientModelDecoder::decodeGetCharacterInventoryResultResponse(response.responseData);
-        if (OnSuccessGetCharacterInventory.IsBound())
+        FClientGetCharacterInventoryResult result = UPlayFabClientModelDecoder::readGetCharacterInventoryResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetCharacterInventoryResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCharacterInventory.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCharacterInventory(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4768,12 +4479,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPurchase(FClientGetPurchaseRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPurchase = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPurchase);
 
@@ -4781,16 +4491,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPurchase(FClientGetPurchaseRequest requ
     manager->PlayFabRequestURL = "/Client/GetPurchase";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("OrderId", request.OrderId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4808,10 +4517,10 @@ void UPlayFabClientAPI::HelperGetPurchase(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FClientGetPurchaseResult result = UPlayFabClientModelDecoder::decodeGetPurchaseResultResponse(response.responseData);
-        if (OnSuccessGetPurchase.IsBound())
+        FClientGetPurchaseResult result = UPlayFabClientModelDecoder::readGetPurchaseResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPurchase.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPurchase(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4823,12 +4532,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserInventory(FClientGetUserInventoryRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserInventory = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetUserInventory);
 
@@ -4836,11 +4544,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetUserInventory(FClientGetUserInventoryRe
     manager->PlayFabRequestURL = "/Client/GetUserInventory";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4858,10 +4569,14 @@ void UPlayFabClientAPI::HelperGetUserInventory(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientGetUserInventoryResult result = UPlayFabClientModelDecoder::decodeGetUserInventoryResultResponse(response.responseData);
-        if (OnSuccessGetUserInventory.IsBound())
+        FClientGetUserInventoryResult result = UPlayFabClientModelDecoder::readGetUserInventoryResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetUserInventory.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetUserInventoryResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetUserInventory(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4873,12 +4588,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::PayForPurchase(FClientPayForPurchaseReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessPayForPurchase = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperPayForPurchase);
 
@@ -4886,31 +4600,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::PayForPurchase(FClientPayForPurchaseReques
     manager->PlayFabRequestURL = "/Client/PayForPurchase";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
-    if (request.ProviderName.IsEmpty() || request.ProviderName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ProviderName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ProviderName"), request.ProviderName);
-    }
-    if (request.Currency.IsEmpty() || request.Currency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Currency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Currency"), request.Currency);
-    }
-    if (request.ProviderTransactionId.IsEmpty() || request.ProviderTransactionId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ProviderTransactionId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ProviderTransactionId"), request.ProviderTransactionId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("OrderId", request.OrderId);
+    Writer.WriteString("ProviderName", request.ProviderName);
+    Writer.WriteString("Currency", request.Currency);
+    Writer.WriteString("ProviderTransactionId", request.ProviderTransactionId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4928,10 +4627,14 @@ void UPlayFabClientAPI::HelperPayForPurchase(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientPayForPurchaseResult result = UPlayFabClientModelDecoder::decodePayForPurchaseResultResponse(response.responseData);
-        if (OnSuccessPayForPurchase.IsBound())
+        FClientPayForPurchaseResult result = UPlayFabClientModelDecoder::readPayForPurchaseResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessPayForPurchase.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillPayForPurchaseResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessPayForPurchase(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4943,12 +4646,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::PurchaseItem(FClientPurchaseItemRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessPurchaseItem = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperPurchaseItem);
 
@@ -4956,37 +4658,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::PurchaseItem(FClientPurchaseItemRequest re
     manager->PlayFabRequestURL = "/Client/PurchaseItem";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.ItemId.IsEmpty() || request.ItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemId"), request.ItemId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Price"), request.Price);
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ItemId", request.ItemId);
+    Writer.WriteString("VirtualCurrency", request.VirtualCurrency);
+    Writer.WriteNumber("Price", request.Price);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("StoreId", request.StoreId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5004,10 +4687,14 @@ void UPlayFabClientAPI::HelperPurchaseItem(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientPurchaseItemResult result = UPlayFabClientModelDecoder::decodePurchaseItemResultResponse(response.responseData);
-        if (OnSuccessPurchaseItem.IsBound())
+        FClientPurchaseItemResult result = UPlayFabClientModelDecoder::readPurchaseItemResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillPurchaseItemResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessPurchaseItem.Execute(result, mCustomData);
+            FDelegateOnSuccessPurchaseItem(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5019,12 +4706,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::RedeemCoupon(FClientRedeemCouponRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRedeemCoupon = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRedeemCoupon);
 
@@ -5032,26 +4718,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::RedeemCoupon(FClientRedeemCouponRequest re
     manager->PlayFabRequestURL = "/Client/RedeemCoupon";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.CouponCode.IsEmpty() || request.CouponCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CouponCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CouponCode"), request.CouponCode);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CouponCode", request.CouponCode);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5069,10 +4744,14 @@ void UPlayFabClientAPI::HelperRedeemCoupon(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientRedeemCouponResult result = UPlayFabClientModelDecoder::decodeRedeemCouponResultResponse(response.responseData);
-        if (OnSuccessRedeemCoupon.IsBound())
+        FClientRedeemCouponResult result = UPlayFabClientModelDecoder::readRedeemCouponResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessRedeemCoupon.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillRedeemCouponResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessRedeemCoupon(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5084,12 +4763,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::StartPurchase(FClientStartPurchaseRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessStartPurchase = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperStartPurchase);
 
@@ -5097,26 +4775,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::StartPurchase(FClientStartPurchaseRequest
     manager->PlayFabRequestURL = "/Client/StartPurchase";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
-    if (request.Items.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Items"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Items"), request.Items);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("StoreId", request.StoreId);
+    Writer.WriteObjectArray("Items", request.Items);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5134,10 +4801,14 @@ void UPlayFabClientAPI::HelperStartPurchase(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientStartPurchaseResult result = UPlayFabClientModelDecoder::decodeStartPurchaseResultResponse(response.responseData);
-        if (OnSuccessStartPurchase.IsBound())
+        FClientStartPurchaseResult result = UPlayFabClientModelDecoder::readStartPurchaseResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessStartPurchase.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillStartPurchaseResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessStartPurchase(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5149,12 +4820,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::SubtractUserVirtualCurrency(FClientSubtrac
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSubtractUserVirtualCurrency = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperSubtractUserVirtualCurrency);
 
@@ -5162,17 +4832,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::SubtractUserVirtualCurrency(FClientSubtrac
     manager->PlayFabRequestURL = "/Client/SubtractUserVirtualCurrency";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("VirtualCurrency", request.VirtualCurrency);
+    Writer.WriteNumber("Amount", request.Amount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5190,10 +4857,10 @@ void UPlayFabClientAPI::HelperSubtractUserVirtualCurrency(FPlayFabBaseModel resp
     }
     else
     {
-        FClientModifyUserVirtualCurrencyResult result = UPlayFabClientModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
-        if (OnSuccessSubtractUserVirtualCurrency.IsBound())
+        FClientModifyUserVirtualCurrencyResult result = UPlayFabClientModelDecoder::readModifyUserVirtualCurrencyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSubtractUserVirtualCurrency.Execute(result, mCustomData);
+            FDelegateOnSuccessSubtractUserVirtualCurrency(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5205,12 +4872,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlockContainerInstance(FClientUnlockConta
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlockContainerInstance = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlockContainerInstance);
 
@@ -5218,31 +4884,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlockContainerInstance(FClientUnlockConta
     manager->PlayFabRequestURL = "/Client/UnlockContainerInstance";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ContainerItemInstanceId.IsEmpty() || request.ContainerItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContainerItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContainerItemInstanceId"), request.ContainerItemInstanceId);
-    }
-    if (request.KeyItemInstanceId.IsEmpty() || request.KeyItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeyItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("KeyItemInstanceId"), request.KeyItemInstanceId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("ContainerItemInstanceId", request.ContainerItemInstanceId);
+    Writer.WriteString("KeyItemInstanceId", request.KeyItemInstanceId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5260,10 +4911,14 @@ void UPlayFabClientAPI::HelperUnlockContainerInstance(FPlayFabBaseModel response
     }
     else
     {
-        FClientUnlockContainerItemResult result = UPlayFabClientModelDecoder::decodeUnlockContainerItemResultResponse(response.responseData);
-        if (OnSuccessUnlockContainerInstance.IsBound())
+        FClientUnlockContainerItemResult result = UPlayFabClientModelDecoder::readUnlockContainerItemResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessUnlockContainerInstance.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillUnlockContainerItemResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessUnlockContainerInstance(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5275,12 +4930,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlockContainerItem(FClientUnlockContainer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlockContainerItem = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUnlockContainerItem);
 
@@ -5288,26 +4942,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::UnlockContainerItem(FClientUnlockContainer
     manager->PlayFabRequestURL = "/Client/UnlockContainerItem";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.ContainerItemId.IsEmpty() || request.ContainerItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContainerItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContainerItemId"), request.ContainerItemId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ContainerItemId", request.ContainerItemId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5325,10 +4968,14 @@ void UPlayFabClientAPI::HelperUnlockContainerItem(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientUnlockContainerItemResult result = UPlayFabClientModelDecoder::decodeUnlockContainerItemResultResponse(response.responseData);
-        if (OnSuccessUnlockContainerItem.IsBound())
+        FClientUnlockContainerItemResult result = UPlayFabClientModelDecoder::readUnlockContainerItemResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillUnlockContainerItemResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlockContainerItem.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlockContainerItem(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5344,12 +4991,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddFriend(FClientAddFriendRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddFriend = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAddFriend);
 
@@ -5357,31 +5003,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddFriend(FClientAddFriendRequest request,
     manager->PlayFabRequestURL = "/Client/AddFriend";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-    if (request.FriendUsername.IsEmpty() || request.FriendUsername == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendUsername"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendUsername"), request.FriendUsername);
-    }
-    if (request.FriendEmail.IsEmpty() || request.FriendEmail == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendEmail"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendEmail"), request.FriendEmail);
-    }
-    if (request.FriendTitleDisplayName.IsEmpty() || request.FriendTitleDisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendTitleDisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendTitleDisplayName"), request.FriendTitleDisplayName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("FriendPlayFabId", request.FriendPlayFabId);
+    Writer.WriteString("FriendUsername", request.FriendUsername);
+    Writer.WriteString("FriendEmail", request.FriendEmail);
+    Writer.WriteString("FriendTitleDisplayName", request.FriendTitleDisplayName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5399,10 +5030,10 @@ void UPlayFabClientAPI::HelperAddFriend(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FClientAddFriendResult result = UPlayFabClientModelDecoder::decodeAddFriendResultResponse(response.responseData);
-        if (OnSuccessAddFriend.IsBound())
+        FClientAddFriendResult result = UPlayFabClientModelDecoder::readAddFriendResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddFriend.Execute(result, mCustomData);
+            FDelegateOnSuccessAddFriend(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5414,12 +5045,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendsList(FClientGetFriendsListReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetFriendsList = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetFriendsList);
 
@@ -5427,13 +5057,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetFriendsList(FClientGetFriendsListReques
     manager->PlayFabRequestURL = "/Client/GetFriendsList";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteBool("IncludeSteamFriends", request.IncludeSteamFriends);
+    Writer.WriteBool("IncludeFacebookFriends", request.IncludeFacebookFriends);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5451,10 +5084,14 @@ void UPlayFabClientAPI::HelperGetFriendsList(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientGetFriendsListResult result = UPlayFabClientModelDecoder::decodeGetFriendsListResultResponse(response.responseData);
-        if (OnSuccessGetFriendsList.IsBound())
+        FClientGetFriendsListResult result = UPlayFabClientModelDecoder::readGetFriendsListResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetFriendsListResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetFriendsList.Execute(result, mCustomData);
+            FDelegateOnSuccessGetFriendsList(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5466,12 +5103,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveFriend(FClientRemoveFriendRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRemoveFriend = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRemoveFriend);
 
@@ -5479,16 +5115,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveFriend(FClientRemoveFriendRequest re
     manager->PlayFabRequestURL = "/Client/RemoveFriend";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("FriendPlayFabId", request.FriendPlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5506,10 +5139,10 @@ void UPlayFabClientAPI::HelperRemoveFriend(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientRemoveFriendResult result = UPlayFabClientModelDecoder::decodeRemoveFriendResultResponse(response.responseData);
-        if (OnSuccessRemoveFriend.IsBound())
+        FClientRemoveFriendResult result = UPlayFabClientModelDecoder::readRemoveFriendResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRemoveFriend.Execute(result, mCustomData);
+            FDelegateOnSuccessRemoveFriend(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5521,12 +5154,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::SetFriendTags(FClientSetFriendTagsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetFriendTags = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperSetFriendTags);
 
@@ -5534,24 +5166,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::SetFriendTags(FClientSetFriendTagsRequest
     manager->PlayFabRequestURL = "/Client/SetFriendTags";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Tags.IsEmpty() || request.Tags == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Tags"));
-    } else {
-        TArray<FString> TagsArray;
-        FString(request.Tags).ParseIntoArray(TagsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Tags"), TagsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("FriendPlayFabId", request.FriendPlayFabId);
+    Writer.WriteStringList("Tags", request.Tags);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5569,10 +5192,10 @@ void UPlayFabClientAPI::HelperSetFriendTags(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientSetFriendTagsResult result = UPlayFabClientModelDecoder::decodeSetFriendTagsResultResponse(response.responseData);
-        if (OnSuccessSetFriendTags.IsBound())
+        FClientSetFriendTagsResult result = UPlayFabClientModelDecoder::readSetFriendTagsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetFriendTags.Execute(result, mCustomData);
+            FDelegateOnSuccessSetFriendTags(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5588,12 +5211,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCurrentGames(FClientCurrentGamesRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCurrentGames = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCurrentGames);
 
@@ -5601,30 +5223,19 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCurrentGames(FClientCurrentGamesRequest
     manager->PlayFabRequestURL = "/Client/GetCurrentGames";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    FString temp_Region;
-    if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.TagFilter != nullptr) OutRestJsonObj->SetObjectField(TEXT("TagFilter"), request.TagFilter);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteEnum("Region", GetEnumName(request.Region));
+    Writer.WriteString("BuildVersion", request.BuildVersion);
+    Writer.WriteString("GameMode", request.GameMode);
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteObject("TagFilter", request.TagFilter);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5642,10 +5253,14 @@ void UPlayFabClientAPI::HelperGetCurrentGames(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientCurrentGamesResult result = UPlayFabClientModelDecoder::decodeCurrentGamesResultResponse(response.responseData);
-        if (OnSuccessGetCurrentGames.IsBound())
+        FClientCurrentGamesResult result = UPlayFabClientModelDecoder::readCurrentGamesResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillCurrentGamesResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCurrentGames.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCurrentGames(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5657,12 +5272,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetGameServerRegions(FClientGameServerRegi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetGameServerRegions = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetGameServerRegions);
 
@@ -5670,17 +5284,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetGameServerRegions(FClientGameServerRegi
     manager->PlayFabRequestURL = "/Client/GetGameServerRegions";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildVersion", request.BuildVersion);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5698,10 +5311,14 @@ void UPlayFabClientAPI::HelperGetGameServerRegions(FPlayFabBaseModel response, U
     }
     else
     {
-        FClientGameServerRegionsResult result = UPlayFabClientModelDecoder::decodeGameServerRegionsResultResponse(response.responseData);
-        if (OnSuccessGetGameServerRegions.IsBound())
+        FClientGameServerRegionsResult result = UPlayFabClientModelDecoder::readGameServerRegionsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGameServerRegionsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetGameServerRegions.Execute(result, mCustomData);
+            FDelegateOnSuccessGetGameServerRegions(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5713,12 +5330,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::Matchmake(FClientMatchmakeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessMatchmake = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperMatchmake);
 
@@ -5726,41 +5342,20 @@ UPlayFabClientAPI* UPlayFabClientAPI::Matchmake(FClientMatchmakeRequest request,
     manager->PlayFabRequestURL = "/Client/Matchmake";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    FString temp_Region;
-    if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("StartNewIfNoneFound"), request.StartNewIfNoneFound);
-    if (request.TagFilter != nullptr) OutRestJsonObj->SetObjectField(TEXT("TagFilter"), request.TagFilter);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildVersion", request.BuildVersion);
+    Writer.WriteEnum("Region", GetEnumName(request.Region));
+    Writer.WriteString("GameMode", request.GameMode);
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteBool("StartNewIfNoneFound", request.StartNewIfNoneFound);
+    Writer.WriteObject("TagFilter", request.TagFilter);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5778,10 +5373,10 @@ void UPlayFabClientAPI::HelperMatchmake(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FClientMatchmakeResult result = UPlayFabClientModelDecoder::decodeMatchmakeResultResponse(response.responseData);
-        if (OnSuccessMatchmake.IsBound())
+        FClientMatchmakeResult result = UPlayFabClientModelDecoder::readMatchmakeResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessMatchmake.Execute(result, mCustomData);
+            FDelegateOnSuccessMatchmake(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5793,12 +5388,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::StartGame(FClientStartGameRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessStartGame = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperStartGame);
 
@@ -5806,39 +5400,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::StartGame(FClientStartGameRequest request,
     manager->PlayFabRequestURL = "/Client/StartGame";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    FString temp_Region;
-    if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CustomCommandLineData.IsEmpty() || request.CustomCommandLineData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomCommandLineData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomCommandLineData"), request.CustomCommandLineData);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildVersion", request.BuildVersion);
+    Writer.WriteEnum("Region", GetEnumName(request.Region));
+    Writer.WriteString("GameMode", request.GameMode);
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("CustomCommandLineData", request.CustomCommandLineData);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5856,10 +5429,10 @@ void UPlayFabClientAPI::HelperStartGame(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FClientStartGameResult result = UPlayFabClientModelDecoder::decodeStartGameResultResponse(response.responseData);
-        if (OnSuccessStartGame.IsBound())
+        FClientStartGameResult result = UPlayFabClientModelDecoder::readStartGameResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessStartGame.Execute(result, mCustomData);
+            FDelegateOnSuccessStartGame(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5875,12 +5448,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::WriteCharacterEvent(FClientWriteClientChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessWriteCharacterEvent = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperWriteCharacterEvent);
 
@@ -5888,27 +5460,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::WriteCharacterEvent(FClientWriteClientChar
     manager->PlayFabRequestURL = "/Client/WriteCharacterEvent";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("EventName", request.EventName);
+    Writer.WriteString("Timestamp", request.Timestamp);
+    Writer.WriteObject("Body", request.Body);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5926,10 +5487,10 @@ void UPlayFabClientAPI::HelperWriteCharacterEvent(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientWriteEventResponse result = UPlayFabClientModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        if (OnSuccessWriteCharacterEvent.IsBound())
+        FClientWriteEventResponse result = UPlayFabClientModelDecoder::readWriteEventResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessWriteCharacterEvent.Execute(result, mCustomData);
+            FDelegateOnSuccessWriteCharacterEvent(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5941,12 +5502,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::WritePlayerEvent(FClientWriteClientPlayerE
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessWritePlayerEvent = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperWritePlayerEvent);
 
@@ -5954,22 +5514,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::WritePlayerEvent(FClientWriteClientPlayerE
     manager->PlayFabRequestURL = "/Client/WritePlayerEvent";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("EventName", request.EventName);
+    Writer.WriteString("Timestamp", request.Timestamp);
+    Writer.WriteObject("Body", request.Body);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5987,10 +5540,10 @@ void UPlayFabClientAPI::HelperWritePlayerEvent(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientWriteEventResponse result = UPlayFabClientModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        if (OnSuccessWritePlayerEvent.IsBound())
+        FClientWriteEventResponse result = UPlayFabClientModelDecoder::readWriteEventResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessWritePlayerEvent.Execute(result, mCustomData);
+            FDelegateOnSuccessWritePlayerEvent(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6002,12 +5555,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::WriteTitleEvent(FClientWriteTitleEventRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessWriteTitleEvent = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperWriteTitleEvent);
 
@@ -6015,22 +5567,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::WriteTitleEvent(FClientWriteTitleEventRequ
     manager->PlayFabRequestURL = "/Client/WriteTitleEvent";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("EventName", request.EventName);
+    Writer.WriteString("Timestamp", request.Timestamp);
+    Writer.WriteObject("Body", request.Body);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6048,10 +5593,10 @@ void UPlayFabClientAPI::HelperWriteTitleEvent(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientWriteEventResponse result = UPlayFabClientModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        if (OnSuccessWriteTitleEvent.IsBound())
+        FClientWriteEventResponse result = UPlayFabClientModelDecoder::readWriteEventResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessWriteTitleEvent.Execute(result, mCustomData);
+            FDelegateOnSuccessWriteTitleEvent(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6067,12 +5612,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddSharedGroupMembers(FClientAddSharedGrou
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddSharedGroupMembers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAddSharedGroupMembers);
 
@@ -6080,24 +5624,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::AddSharedGroupMembers(FClientAddSharedGrou
     manager->PlayFabRequestURL = "/Client/AddSharedGroupMembers";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-    // Check to see if string is empty
-    if (request.PlayFabIds.IsEmpty() || request.PlayFabIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIds"));
-    } else {
-        TArray<FString> PlayFabIdsArray;
-        FString(request.PlayFabIds).ParseIntoArray(PlayFabIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIds"), PlayFabIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteStringList("PlayFabIds", request.PlayFabIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6115,10 +5649,10 @@ void UPlayFabClientAPI::HelperAddSharedGroupMembers(FPlayFabBaseModel response,
     }
     else
     {
-        FClientAddSharedGroupMembersResult result = UPlayFabClientModelDecoder::decodeAddSharedGroupMembersResultResponse(response.responseData);
-        if (OnSuccessAddSharedGroupMembers.IsBound())
+        FClientAddSharedGroupMembersResult result = UPlayFabClientModelDecoder::readAddSharedGroupMembersResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddSharedGroupMembers.Execute(result, mCustomData);
+            FDelegateOnSuccessAddSharedGroupMembers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6130,12 +5664,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::CreateSharedGroup(FClientCreateSharedGroup
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessCreateSharedGroup = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperCreateSharedGroup);
 
@@ -6143,16 +5676,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::CreateSharedGroup(FClientCreateSharedGroup
     manager->PlayFabRequestURL = "/Client/CreateSharedGroup";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6170,10 +5700,10 @@ void UPlayFabClientAPI::HelperCreateSharedGroup(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientCreateSharedGroupResult result = UPlayFabClientModelDecoder::decodeCreateSharedGroupResultResponse(response.responseData);
-        if (OnSuccessCreateSharedGroup.IsBound())
+        FClientCreateSharedGroupResult result = UPlayFabClientModelDecoder::readCreateSharedGroupResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessCreateSharedGroup.Execute(result, mCustomData);
+            FDelegateOnSuccessCreateSharedGroup(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6185,12 +5715,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetSharedGroupData(FClientGetSharedGroupDa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetSharedGroupData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetSharedGroupData);
 
@@ -6198,25 +5727,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetSharedGroupData(FClientGetSharedGroupDa
     manager->PlayFabRequestURL = "/Client/GetSharedGroupData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("GetMembers"), request.GetMembers);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteBool("GetMembers", request.GetMembers);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6234,10 +5755,14 @@ void UPlayFabClientAPI::HelperGetSharedGroupData(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FClientGetSharedGroupDataResult result = UPlayFabClientModelDecoder::decodeGetSharedGroupDataResultResponse(response.responseData);
-        if (OnSuccessGetSharedGroupData.IsBound())
+        FClientGetSharedGroupDataResult result = UPlayFabClientModelDecoder::readGetSharedGroupDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetSharedGroupDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetSharedGroupData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetSharedGroupData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6249,12 +5774,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveSharedGroupMembers(FClientRemoveShar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRemoveSharedGroupMembers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRemoveSharedGroupMembers);
 
@@ -6262,24 +5786,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::RemoveSharedGroupMembers(FClientRemoveShar
     manager->PlayFabRequestURL = "/Client/RemoveSharedGroupMembers";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-    // Check to see if string is empty
-    if (request.PlayFabIds.IsEmpty() || request.PlayFabIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIds"));
-    } else {
-        TArray<FString> PlayFabIdsArray;
-        FString(request.PlayFabIds).ParseIntoArray(PlayFabIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIds"), PlayFabIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteStringList("PlayFabIds", request.PlayFabIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6297,10 +5811,10 @@ void UPlayFabClientAPI::HelperRemoveSharedGroupMembers(FPlayFabBaseModel respons
     }
     else
     {
-        FClientRemoveSharedGroupMembersResult result = UPlayFabClientModelDecoder::decodeRemoveSharedGroupMembersResultResponse(response.responseData);
-        if (OnSuccessRemoveSharedGroupMembers.IsBound())
+        FClientRemoveSharedGroupMembersResult result = UPlayFabClientModelDecoder::readRemoveSharedGroupMembersResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRemoveSharedGroupMembers.Execute(result, mCustomData);
+            FDelegateOnSuccessRemoveSharedGroupMembers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6312,12 +5826,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateSharedGroupData(FClientUpdateSharedG
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateSharedGroupData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateSharedGroupData);
 
@@ -6325,28 +5838,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateSharedGroupData(FClientUpdateSharedG
     manager->PlayFabRequestURL = "/Client/UpdateSharedGroupData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6364,10 +5866,10 @@ void UPlayFabClientAPI::HelperUpdateSharedGroupData(FPlayFabBaseModel response,
     }
     else
     {
-        FClientUpdateSharedGroupDataResult result = UPlayFabClientModelDecoder::decodeUpdateSharedGroupDataResultResponse(response.responseData);
-        if (OnSuccessUpdateSharedGroupData.IsBound())
+        FClientUpdateSharedGroupDataResult result = UPlayFabClientModelDecoder::readUpdateSharedGroupDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateSharedGroupData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateSharedGroupData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6383,12 +5885,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::ExecuteCloudScript(FClientExecuteCloudScri
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessExecuteCloudScript = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperExecuteCloudScript);
 
@@ -6396,22 +5897,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::ExecuteCloudScript(FClientExecuteCloudScri
     manager->PlayFabRequestURL = "/Client/ExecuteCloudScript";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.FunctionName.IsEmpty() || request.FunctionName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FunctionName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FunctionName"), request.FunctionName);
-    }
-    if (request.FunctionParameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("FunctionParameter"), request.FunctionParameter);
-    FString temp_RevisionSelection;
-    if (GetEnumValueToString<ECloudScriptRevisionOption>(TEXT("ECloudScriptRevisionOption"), request.RevisionSelection, temp_RevisionSelection))
-        OutRestJsonObj->SetStringField(TEXT("RevisionSelection"), temp_RevisionSelection);
-    OutRestJsonObj->SetNumberField(TEXT("SpecificRevision"), request.SpecificRevision);
-    OutRestJsonObj->SetBoolField(TEXT("GeneratePlayStreamEvent"), request.GeneratePlayStreamEvent);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("FunctionName", request.FunctionName);
+    Writer.WriteObject("FunctionParameter", request.FunctionParameter);
+    Writer.WriteEnum("RevisionSelection", GetEnumName(request.RevisionSelection));
+    Writer.WriteNumber("SpecificRevision", request.SpecificRevision);
+    Writer.WriteBool("GeneratePlayStreamEvent", request.GeneratePlayStreamEvent);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6429,10 +5925,14 @@ void UPlayFabClientAPI::HelperExecuteCloudScript(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FClientExecuteCloudScriptResult result = UPlayFabClientModelDecoder::decodeExecuteCloudScriptResultResponse(response.responseData);
-        if (OnSuccessExecuteCloudScript.IsBound())
+        FClientExecuteCloudScriptResult result = UPlayFabClientModelDecoder::readExecuteCloudScriptResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessExecuteCloudScript.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillExecuteCloudScriptResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessExecuteCloudScript(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6448,12 +5948,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetContentDownloadUrl(FClientGetContentDow
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetContentDownloadUrl = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetContentDownloadUrl);
 
@@ -6461,22 +5960,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetContentDownloadUrl(FClientGetContentDow
     manager->PlayFabRequestURL = "/Client/GetContentDownloadUrl";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.HttpMethod.IsEmpty() || request.HttpMethod == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("HttpMethod"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("HttpMethod"), request.HttpMethod);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ThruCDN"), request.ThruCDN);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Key", request.Key);
+    Writer.WriteString("HttpMethod", request.HttpMethod);
+    Writer.WriteBool("ThruCDN", request.ThruCDN);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6494,10 +5987,10 @@ void UPlayFabClientAPI::HelperGetContentDownloadUrl(FPlayFabBaseModel response,
     }
     else
     {
-        FClientGetContentDownloadUrlResult result = UPlayFabClientModelDecoder::decodeGetContentDownloadUrlResultResponse(response.responseData);
-        if (OnSuccessGetContentDownloadUrl.IsBound())
+        FClientGetContentDownloadUrlResult result = UPlayFabClientModelDecoder::readGetContentDownloadUrlResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetContentDownloadUrl.Execute(result, mCustomData);
+            FDelegateOnSuccessGetContentDownloadUrl(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6513,12 +6006,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAllUsersCharacters(FClientListUsersChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetAllUsersCharacters = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetAllUsersCharacters);
 
@@ -6526,16 +6018,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetAllUsersCharacters(FClientListUsersChar
     manager->PlayFabRequestURL = "/Client/GetAllUsersCharacters";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6553,10 +6044,14 @@ void UPlayFabClientAPI::HelperGetAllUsersCharacters(FPlayFabBaseModel response,
     }
     else
     {
-        FClientListUsersCharactersResult result = UPlayFabClientModelDecoder::decodeListUsersCharactersResultResponse(response.responseData);
-        if (OnSuccessGetAllUsersCharacters.IsBound())
+        FClientListUsersCharactersResult result = UPlayFabClientModelDecoder::readListUsersCharactersResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetAllUsersCharacters.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillListUsersCharactersResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetAllUsersCharacters(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6568,12 +6063,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterLeaderboard(FClientGetCharacte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterLeaderboard = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCharacterLeaderboard);
 
@@ -6581,23 +6075,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterLeaderboard(FClientGetCharacte
     manager->PlayFabRequestURL = "/Client/GetCharacterLeaderboard";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CharacterType.IsEmpty() || request.CharacterType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterType"), request.CharacterType);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterType", request.CharacterType);
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("StartPosition", request.StartPosition);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6615,10 +6104,14 @@ void UPlayFabClientAPI::HelperGetCharacterLeaderboard(FPlayFabBaseModel response
     }
     else
     {
-        FClientGetCharacterLeaderboardResult result = UPlayFabClientModelDecoder::decodeGetCharacterLeaderboardResultResponse(response.responseData);
-        if (OnSuccessGetCharacterLeaderboard.IsBound())
+        FClientGetCharacterLeaderboardResult result = UPlayFabClientModelDecoder::readGetCharacterLeaderboardResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetCharacterLeaderboard.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetCharacterLeaderboardResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetCharacterLeaderboard(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6630,12 +6123,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterStatistics(FClientGetCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCharacterStatistics);
 
@@ -6643,16 +6135,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterStatistics(FClientGetCharacter
     manager->PlayFabRequestURL = "/Client/GetCharacterStatistics";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6670,10 +6161,14 @@ void UPlayFabClientAPI::HelperGetCharacterStatistics(FPlayFabBaseModel response,
     }
     else
     {
-        FClientGetCharacterStatisticsResult result = UPlayFabClientModelDecoder::decodeGetCharacterStatisticsResultResponse(response.responseData);
-        if (OnSuccessGetCharacterStatistics.IsBound())
+        FClientGetCharacterStatisticsResult result = UPlayFabClientModelDecoder::readGetCharacterStatisticsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetCharacterStatisticsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCharacterStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCharacterStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6685,12 +6180,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardAroundCharacter(FClientGetLe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetLeaderboardAroundCharacter = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetLeaderboardAroundCharacter);
 
@@ -6698,27 +6192,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardAroundCharacter(FClientGetLe
     manager->PlayFabRequestURL = "/Client/GetLeaderboardAroundCharacter";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CharacterType.IsEmpty() || request.CharacterType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterType"), request.CharacterType);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("CharacterType", request.CharacterType);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6736,10 +6221,14 @@ void UPlayFabClientAPI::HelperGetLeaderboardAroundCharacter(FPlayFabBaseModel re
     }
     else
     {
-        FClientGetLeaderboardAroundCharacterResult result = UPlayFabClientModelDecoder::decodeGetLeaderboardAroundCharacterResultResponse(response.responseData);
-        if (OnSuccessGetLeaderboardAroundCharacter.IsBound())
+        FClientGetLeaderboardAroundCharacterResult result = UPlayFabClientModelDecoder::readGetLeaderboardAroundCharacterResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetLeaderboardAroundCharacterResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetLeaderboardAroundCharacter.Execute(result, mCustomData);
+            FDelegateOnSuccessGetLeaderboardAroundCharacter(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6751,12 +6240,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardForUserCharacters(FClientGet
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetLeaderboardForUserCharacters = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetLeaderboardForUserCharacters);
 
@@ -6764,17 +6252,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetLeaderboardForUserCharacters(FClientGet
     manager->PlayFabRequestURL = "/Client/GetLeaderboardForUserCharacters";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6792,10 +6279,14 @@ void UPlayFabClientAPI::HelperGetLeaderboardForUserCharacters(FPlayFabBaseModel
     }
     else
     {
-        FClientGetLeaderboardForUsersCharactersResult result = UPlayFabClientModelDecoder::decodeGetLeaderboardForUsersCharactersResultResponse(response.responseData);
-        if (OnSuccessGetLeaderboardForUserCharacters.IsBound())
+        FClientGetLeaderboardForUsersCharactersResult result = UPlayFabClientModelDecoder::readGetLeaderboardForUsersCharactersResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetLeaderboardForUsersCharactersResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetLeaderboardForUserCharacters.Execute(result, mCustomData);
+            FDelegateOnSuccessGetLeaderboardForUserCharacters(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6807,12 +6298,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GrantCharacterToUser(FClientGrantCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGrantCharacterToUser = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGrantCharacterToUser);
 
@@ -6820,26 +6310,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GrantCharacterToUser(FClientGrantCharacter
     manager->PlayFabRequestURL = "/Client/GrantCharacterToUser";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.ItemId.IsEmpty() || request.ItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemId"), request.ItemId);
-    }
-    if (request.CharacterName.IsEmpty() || request.CharacterName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterName"), request.CharacterName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("ItemId", request.ItemId);
+    Writer.WriteString("CharacterName", request.CharacterName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6857,10 +6336,10 @@ void UPlayFabClientAPI::HelperGrantCharacterToUser(FPlayFabBaseModel response, U
     }
     else
     {
-        FClientGrantCharacterToUserResult result = UPlayFabClientModelDecoder::decodeGrantCharacterToUserResultResponse(response.responseData);
-        if (OnSuccessGrantCharacterToUser.IsBound())
+        FClientGrantCharacterToUserResult result = UPlayFabClientModelDecoder::readGrantCharacterToUserResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGrantCharacterToUser.Execute(result, mCustomData);
+            FDelegateOnSuccessGrantCharacterToUser(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6872,12 +6351,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateCharacterStatistics(FClientUpdateCha
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateCharacterStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateCharacterStatistics);
 
@@ -6885,17 +6363,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateCharacterStatistics(FClientUpdateCha
     manager->PlayFabRequestURL = "/Client/UpdateCharacterStatistics";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CharacterStatistics != nullptr) OutRestJsonObj->SetObjectField(TEXT("CharacterStatistics"), request.CharacterStatistics);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObject("CharacterStatistics", request.CharacterStatistics);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6913,10 +6388,10 @@ void UPlayFabClientAPI::HelperUpdateCharacterStatistics(FPlayFabBaseModel respon
     }
     else
     {
-        FClientUpdateCharacterStatisticsResult result = UPlayFabClientModelDecoder::decodeUpdateCharacterStatisticsResultResponse(response.responseData);
-        if (OnSuccessUpdateCharacterStatistics.IsBound())
+        FClientUpdateCharacterStatisticsResult result = UPlayFabClientModelDecoder::readUpdateCharacterStatisticsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateCharacterStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateCharacterStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6932,12 +6407,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterData(FClientGetCharacterDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCharacterData);
 
@@ -6945,30 +6419,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterData(FClientGetCharacterDataRe
     manager->PlayFabRequestURL = "/Client/GetCharacterData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6986,10 +6448,14 @@ void UPlayFabClientAPI::HelperGetCharacterData(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientGetCharacterDataResult result = UPlayFabClientModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
-        if (OnSuccessGetCharacterData.IsBound())
+        FClientGetCharacterDataResult result = UPlayFabClientModelDecoder::readGetCharacterDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetCharacterDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCharacterData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCharacterData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7001,12 +6467,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterReadOnlyData(FClientGetCharact
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetCharacterReadOnlyData);
 
@@ -7014,30 +6479,18 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetCharacterReadOnlyData(FClientGetCharact
     manager->PlayFabRequestURL = "/Client/GetCharacterReadOnlyData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7055,10 +6508,14 @@ void UPlayFabClientAPI::HelperGetCharacterReadOnlyData(FPlayFabBaseModel respons
     }
     else
     {
-        FClientGetCharacterDataResult result = UPlayFabClientModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
-        if (OnSuccessGetCharacterReadOnlyData.IsBound())
+        FClientGetCharacterDataResult result = UPlayFabClientModelDecoder::readGetCharacterDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetCharacterDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCharacterReadOnlyData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCharacterReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7070,12 +6527,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateCharacterData(FClientUpdateCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateCharacterData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperUpdateCharacterData);
 
@@ -7083,28 +6539,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::UpdateCharacterData(FClientUpdateCharacter
     manager->PlayFabRequestURL = "/Client/UpdateCharacterData";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7122,10 +6567,10 @@ void UPlayFabClientAPI::HelperUpdateCharacterData(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientUpdateCharacterDataResult result = UPlayFabClientModelDecoder::decodeUpdateCharacterDataResultResponse(response.responseData);
-        if (OnSuccessUpdateCharacterData.IsBound())
+        FClientUpdateCharacterDataResult result = UPlayFabClientModelDecoder::readUpdateCharacterDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateCharacterData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateCharacterData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7141,12 +6586,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::AcceptTrade(FClientAcceptTradeRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAcceptTrade = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAcceptTrade);
 
@@ -7154,29 +6598,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::AcceptTrade(FClientAcceptTradeRequest requ
     manager->PlayFabRequestURL = "/Client/AcceptTrade";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.OfferingPlayerId.IsEmpty() || request.OfferingPlayerId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OfferingPlayerId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OfferingPlayerId"), request.OfferingPlayerId);
-    }
-    if (request.TradeId.IsEmpty() || request.TradeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TradeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TradeId"), request.TradeId);
-    }
-    // Check to see if string is empty
-    if (request.AcceptedInventoryInstanceIds.IsEmpty() || request.AcceptedInventoryInstanceIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AcceptedInventoryInstanceIds"));
-    } else {
-        TArray<FString> AcceptedInventoryInstanceIdsArray;
-        FString(request.AcceptedInventoryInstanceIds).ParseIntoArray(AcceptedInventoryInstanceIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("AcceptedInventoryInstanceIds"), AcceptedInventoryInstanceIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("OfferingPlayerId", request.OfferingPlayerId);
+    Writer.WriteString("TradeId", request.TradeId);
+    Writer.WriteStringList("AcceptedInventoryInstanceIds", request.AcceptedInventoryInstanceIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7194,10 +6624,14 @@ void UPlayFabClientAPI::HelperAcceptTrade(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FClientAcceptTradeResponse result = UPlayFabClientModelDecoder::decodeAcceptTradeResponseResponse(response.responseData);
-        if (OnSuccessAcceptTrade.IsBound())
+        FClientAcceptTradeResponse result = UPlayFabClientModelDecoder::readAcceptTradeResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillAcceptTradeResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAcceptTrade.Execute(result, mCustomData);
+            FDelegateOnSuccessAcceptTrade(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7209,12 +6643,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::CancelTrade(FClientCancelTradeRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessCancelTrade = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperCancelTrade);
 
@@ -7222,16 +6655,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::CancelTrade(FClientCancelTradeRequest requ
     manager->PlayFabRequestURL = "/Client/CancelTrade";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.TradeId.IsEmpty() || request.TradeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TradeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TradeId"), request.TradeId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TradeId", request.TradeId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7249,10 +6679,14 @@ void UPlayFabClientAPI::HelperCancelTrade(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FClientCancelTradeResponse result = UPlayFabClientModelDecoder::decodeCancelTradeResponseResponse(response.responseData);
-        if (OnSuccessCancelTrade.IsBound())
+        FClientCancelTradeResponse result = UPlayFabClientModelDecoder::readCancelTradeResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessCancelTrade.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillCancelTradeResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessCancelTrade(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7264,12 +6698,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerTrades(FClientGetPlayerTradesRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerTrades = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerTrades);
 
@@ -7277,14 +6710,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerTrades(FClientGetPlayerTradesRequ
     manager->PlayFabRequestURL = "/Client/GetPlayerTrades";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    FString temp_StatusFilter;
-    if (GetEnumValueToString<ETradeStatus>(TEXT("ETradeStatus"), request.StatusFilter, temp_StatusFilter))
-        OutRestJsonObj->SetStringField(TEXT("StatusFilter"), temp_StatusFilter);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteEnum("StatusFilter", GetEnumName(request.StatusFilter));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7302,10 +6736,14 @@ void UPlayFabClientAPI::HelperGetPlayerTrades(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FClientGetPlayerTradesResponse result = UPlayFabClientModelDecoder::decodeGetPlayerTradesResponseResponse(response.responseData);
-        if (OnSuccessGetPlayerTrades.IsBound())
+        FClientGetPlayerTradesResponse result = UPlayFabClientModelDecoder::readGetPlayerTradesResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetPlayerTrades.Execute(result, mCustomData);
+            UPlayFabClientModelDecoder::fillGetPlayerTradesResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetPlayerTrades(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7317,12 +6755,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTradeStatus(FClientGetTradeStatusReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTradeStatus = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetTradeStatus);
 
@@ -7330,21 +6767,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetTradeStatus(FClientGetTradeStatusReques
     manager->PlayFabRequestURL = "/Client/GetTradeStatus";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.OfferingPlayerId.IsEmpty() || request.OfferingPlayerId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OfferingPlayerId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OfferingPlayerId"), request.OfferingPlayerId);
-    }
-    if (request.TradeId.IsEmpty() || request.TradeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TradeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TradeId"), request.TradeId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("OfferingPlayerId", request.OfferingPlayerId);
+    Writer.WriteString("TradeId", request.TradeId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7362,10 +6794,14 @@ void UPlayFabClientAPI::HelperGetTradeStatus(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FClientGetTradeStatusResponse result = UPlayFabClientModelDecoder::decodeGetTradeStatusResponseResponse(response.responseData);
-        if (OnSuccessGetTradeStatus.IsBound())
+        FClientGetTradeStatusResponse result = UPlayFabClientModelDecoder::readGetTradeStatusResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetTradeStatusResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTradeStatus.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTradeStatus(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7377,12 +6813,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::OpenTrade(FClientOpenTradeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessOpenTrade = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperOpenTrade);
 
@@ -7390,35 +6825,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::OpenTrade(FClientOpenTradeRequest request,
     manager->PlayFabRequestURL = "/Client/OpenTrade";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.OfferedInventoryInstanceIds.IsEmpty() || request.OfferedInventoryInstanceIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OfferedInventoryInstanceIds"));
-    } else {
-        TArray<FString> OfferedInventoryInstanceIdsArray;
-        FString(request.OfferedInventoryInstanceIds).ParseIntoArray(OfferedInventoryInstanceIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("OfferedInventoryInstanceIds"), OfferedInventoryInstanceIdsArray);
-    }
-    // Check to see if string is empty
-    if (request.RequestedCatalogItemIds.IsEmpty() || request.RequestedCatalogItemIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("RequestedCatalogItemIds"));
-    } else {
-        TArray<FString> RequestedCatalogItemIdsArray;
-        FString(request.RequestedCatalogItemIds).ParseIntoArray(RequestedCatalogItemIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("RequestedCatalogItemIds"), RequestedCatalogItemIdsArray);
-    }
-    // Check to see if string is empty
-    if (request.AllowedPlayerIds.IsEmpty() || request.AllowedPlayerIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AllowedPlayerIds"));
-    } else {
-        TArray<FString> AllowedPlayerIdsArray;
-        FString(request.AllowedPlayerIds).ParseIntoArray(AllowedPlayerIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("AllowedPlayerIds"), AllowedPlayerIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("OfferedInventoryInstanceIds", request.OfferedInventoryInstanceIds);
+    Writer.WriteStringList("RequestedCatalogItemIds", request.RequestedCatalogItemIds);
+    Writer.WriteStringList("AllowedPlayerIds", request.AllowedPlayerIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7436,10 +6851,14 @@ void UPlayFabClientAPI::HelperOpenTrade(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FClientOpenTradeResponse result = UPlayFabClientModelDecoder::decodeOpenTradeResponseResponse(response.responseData);
-        if (OnSuccessOpenTrade.IsBound())
+        FClientOpenTradeResponse result = UPlayFabClientModelDecoder::readOpenTradeResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillOpenTradeResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessOpenTrade.Execute(result, mCustomData);
+            FDelegateOnSuccessOpenTrade(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7455,12 +6874,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::AttributeInstall(FClientAttributeInstallRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAttributeInstall = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAttributeInstall);
 
@@ -7468,21 +6886,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::AttributeInstall(FClientAttributeInstallRe
     manager->PlayFabRequestURL = "/Client/AttributeInstall";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.Idfa.IsEmpty() || request.Idfa == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Idfa"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Idfa"), request.Idfa);
-    }
-    if (request.Adid.IsEmpty() || request.Adid == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Adid"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Adid"), request.Adid);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Idfa", request.Idfa);
+    Writer.WriteString("Adid", request.Adid);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7500,10 +6911,10 @@ void UPlayFabClientAPI::HelperAttributeInstall(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FClientAttributeInstallResult result = UPlayFabClientModelDecoder::decodeAttributeInstallResultResponse(response.responseData);
-        if (OnSuccessAttributeInstall.IsBound())
+        FClientAttributeInstallResult result = UPlayFabClientModelDecoder::readAttributeInstallResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAttributeInstall.Execute(result, mCustomData);
+            FDelegateOnSuccessAttributeInstall(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7523,12 +6934,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerSegments(FClientGetPlayerSegments
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerSegments = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerSegments);
 
@@ -7536,11 +6946,14 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerSegments(FClientGetPlayerSegments
     manager->PlayFabRequestURL = "/Client/GetPlayerSegments";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7558,10 +6971,14 @@ void UPlayFabClientAPI::HelperGetPlayerSegments(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FClientGetPlayerSegmentsResult result = UPlayFabClientModelDecoder::decodeGetPlayerSegmentsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerSegments.IsBound())
+        FClientGetPlayerSegmentsResult result = UPlayFabClientModelDecoder::readGetPlayerSegmentsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabClientModelDecoder::fillGetPlayerSegmentsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerSegments.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerSegments(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7573,12 +6990,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerTags(FClientGetPlayerTagsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerTags = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperGetPlayerTags);
 
@@ -7586,21 +7002,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::GetPlayerTags(FClientGetPlayerTagsRequest
     manager->PlayFabRequestURL = "/Client/GetPlayerTags";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Namespace.IsEmpty() || request.Namespace == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Namespace"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Namespace"), request.Namespace);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("Namespace", request.Namespace);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7618,10 +7029,10 @@ void UPlayFabClientAPI::HelperGetPlayerTags(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FClientGetPlayerTagsResult result = UPlayFabClientModelDecoder::decodeGetPlayerTagsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerTags.IsBound())
+        FClientGetPlayerTagsResult result = UPlayFabClientModelDecoder::readGetPlayerTagsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerTags.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerTags(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7637,12 +7048,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAndroidDevicePushNotificationRegistration = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperAndroidDevicePushNotificationRegistration);
 
@@ -7650,22 +7060,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::AndroidDevicePushNotificationRegistration(
     manager->PlayFabRequestURL = "/Client/AndroidDevicePushNotificationRegistration";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.DeviceToken.IsEmpty() || request.DeviceToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceToken"), request.DeviceToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("SendPushNotificationConfirmation"), request.SendPushNotificationConfirmation);
-    if (request.ConfirmationMessage.IsEmpty() || request.ConfirmationMessage == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConfirmationMessage"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConfirmationMessage"), request.ConfirmationMessage);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("DeviceToken", request.DeviceToken);
+    Writer.WriteBool("SendPushNotificationConfirmation", request.SendPushNotificationConfirmation);
+    Writer.WriteString("ConfirmationMessage", request.ConfirmationMessage);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7683,10 +7086,10 @@ void UPlayFabClientAPI::HelperAndroidDevicePushNotificationRegistration(FPlayFab
     }
     else
     {
-        FClientAndroidDevicePushNotificationRegistrationResult result = UPlayFabClientModelDecoder::decodeAndroidDevicePushNotificationRegistrationResultResponse(response.responseData);
-        if (OnSuccessAndroidDevicePushNotificationRegistration.IsBound())
+        FClientAndroidDevicePushNotificationRegistrationResult result = UPlayFabClientModelDecoder::readAndroidDevicePushNotificationRegistrationResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAndroidDevicePushNotificationRegistration.Execute(result, mCustomData);
+            FDelegateOnSuccessAndroidDevicePushNotificationRegistration(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7698,12 +7101,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterForIOSPushNotification(FClientRegi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRegisterForIOSPushNotification = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRegisterForIOSPushNotification);
 
@@ -7711,22 +7113,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::RegisterForIOSPushNotification(FClientRegi
     manager->PlayFabRequestURL = "/Client/RegisterForIOSPushNotification";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.DeviceToken.IsEmpty() || request.DeviceToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeviceToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeviceToken"), request.DeviceToken);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("SendPushNotificationConfirmation"), request.SendPushNotificationConfirmation);
-    if (request.ConfirmationMessage.IsEmpty() || request.ConfirmationMessage == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ConfirmationMessage"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ConfirmationMessage"), request.ConfirmationMessage);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("DeviceToken", request.DeviceToken);
+    Writer.WriteBool("SendPushNotificationConfirmation", request.SendPushNotificationConfirmation);
+    Writer.WriteString("ConfirmationMessage", request.ConfirmationMessage);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7744,10 +7139,10 @@ void UPlayFabClientAPI::HelperRegisterForIOSPushNotification(FPlayFabBaseModel r
     }
     else
     {
-        FClientRegisterForIOSPushNotificationResult result = UPlayFabClientModelDecoder::decodeRegisterForIOSPushNotificationResultResponse(response.responseData);
-        if (OnSuccessRegisterForIOSPushNotification.IsBound())
+        FClientRegisterForIOSPushNotificationResult result = UPlayFabClientModelDecoder::readRegisterForIOSPushNotificationResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRegisterForIOSPushNotification.Execute(result, mCustomData);
+            FDelegateOnSuccessRegisterForIOSPushNotification(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7759,12 +7154,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::RestoreIOSPurchases(FClientRestoreIOSPurch
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRestoreIOSPurchases = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperRestoreIOSPurchases);
 
@@ -7772,16 +7166,13 @@ UPlayFabClientAPI* UPlayFabClientAPI::RestoreIOSPurchases(FClientRestoreIOSPurch
     manager->PlayFabRequestURL = "/Client/RestoreIOSPurchases";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.ReceiptData.IsEmpty() || request.ReceiptData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceiptData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceiptData"), request.ReceiptData);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ReceiptData", request.ReceiptData);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7799,10 +7190,10 @@ void UPlayFabClientAPI::HelperRestoreIOSPurchases(FPlayFabBaseModel response, UO
     }
     else
     {
-        FClientRestoreIOSPurchasesResult result = UPlayFabClientModelDecoder::decodeRestoreIOSPurchasesResultResponse(response.responseData);
-        if (OnSuccessRestoreIOSPurchases.IsBound())
+        FClientRestoreIOSPurchasesResult result = UPlayFabClientModelDecoder::readRestoreIOSPurchasesResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRestoreIOSPurchases.Execute(result, mCustomData);
+            FDelegateOnSuccessRestoreIOSPurchases(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7814,12 +7205,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateAmazonIAPReceipt(FClientValidateAm
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessValidateAmazonIAPReceipt = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperValidateAmazonIAPReceipt);
 
@@ -7827,32 +7217,17 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateAmazonIAPReceipt(FClientValidateAm
     manager->PlayFabRequestURL = "/Client/ValidateAmazonIAPReceipt";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.ReceiptId.IsEmpty() || request.ReceiptId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceiptId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceiptId"), request.ReceiptId);
-    }
-    if (request.UserId.IsEmpty() || request.UserId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("UserId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("UserId"), request.UserId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CurrencyCode.IsEmpty() || request.CurrencyCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CurrencyCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CurrencyCode"), request.CurrencyCode);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("PurchasePrice"), request.PurchasePrice);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ReceiptId", request.ReceiptId);
+    Writer.WriteString("UserId", request.UserId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("CurrencyCode", request.CurrencyCode);
+    Writer.WriteNumber("PurchasePrice", request.PurchasePrice);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7870,10 +7245,10 @@ void UPlayFabClientAPI::HelperValidateAmazonIAPReceipt(FPlayFabBaseModel respons
     }
     else
     {
-        FClientValidateAmazonReceiptResult result = UPlayFabClientModelDecoder::decodeValidateAmazonReceiptResultResponse(response.responseData);
-        if (OnSuccessValidateAmazonIAPReceipt.IsBound())
+        FClientValidateAmazonReceiptResult result = UPlayFabClientModelDecoder::readValidateAmazonReceiptResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessValidateAmazonIAPReceipt.Execute(result, mCustomData);
+            FDelegateOnSuccessValidateAmazonIAPReceipt(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7885,12 +7260,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateGooglePlayPurchase(FClientValidate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessValidateGooglePlayPurchase = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperValidateGooglePlayPurchase);
 
@@ -7898,27 +7272,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateGooglePlayPurchase(FClientValidate
     manager->PlayFabRequestURL = "/Client/ValidateGooglePlayPurchase";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.ReceiptJson.IsEmpty() || request.ReceiptJson == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceiptJson"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceiptJson"), request.ReceiptJson);
-    }
-    if (request.Signature.IsEmpty() || request.Signature == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Signature"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Signature"), request.Signature);
-    }
-    if (request.CurrencyCode.IsEmpty() || request.CurrencyCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CurrencyCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CurrencyCode"), request.CurrencyCode);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("PurchasePrice"), request.PurchasePrice);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ReceiptJson", request.ReceiptJson);
+    Writer.WriteString("Signature", request.Signature);
+    Writer.WriteString("CurrencyCode", request.CurrencyCode);
+    Writer.WriteNumber("PurchasePrice", request.PurchasePrice);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7936,10 +7299,10 @@ void UPlayFabClientAPI::HelperValidateGooglePlayPurchase(FPlayFabBaseModel respo
     }
     else
     {
-        FClientValidateGooglePlayPurchaseResult result = UPlayFabClientModelDecoder::decodeValidateGooglePlayPurchaseResultResponse(response.responseData);
-        if (OnSuccessValidateGooglePlayPurchase.IsBound())
+        FClientValidateGooglePlayPurchaseResult result = UPlayFabClientModelDecoder::readValidateGooglePlayPurchaseResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessValidateGooglePlayPurchase.Execute(result, mCustomData);
+            FDelegateOnSuccessValidateGooglePlayPurchase(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -7951,12 +7314,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateIOSReceipt(FClientValidateIOSRecei
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessValidateIOSReceipt = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperValidateIOSReceipt);
 
@@ -7964,22 +7326,15 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateIOSReceipt(FClientValidateIOSRecei
     manager->PlayFabRequestURL = "/Client/ValidateIOSReceipt";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.ReceiptData.IsEmpty() || request.ReceiptData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceiptData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceiptData"), request.ReceiptData);
-    }
-    if (request.CurrencyCode.IsEmpty() || request.CurrencyCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CurrencyCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CurrencyCode"), request.CurrencyCode);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("PurchasePrice"), request.PurchasePrice);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ReceiptData", request.ReceiptData);
+    Writer.WriteString("CurrencyCode", request.CurrencyCode);
+    Writer.WriteNumber("PurchasePrice", request.PurchasePrice);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -7997,10 +7352,10 @@ void UPlayFabClientAPI::HelperValidateIOSReceipt(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FClientValidateIOSReceiptResult result = UPlayFabClientModelDecoder::decodeValidateIOSReceiptResultResponse(response.responseData);
-        if (OnSuccessValidateIOSReceipt.IsBound())
+        FClientValidateIOSReceiptResult result = UPlayFabClientModelDecoder::readValidateIOSReceiptResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessValidateIOSReceipt.Execute(result, mCustomData);
+            FDelegateOnSuccessValidateIOSReceipt(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -8012,12 +7367,11 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateWindowsStoreReceipt(FClientValidat
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabClientAPI* manager = NewObject<UPlayFabClientAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabClientAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabClientAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessValidateWindowsStoreReceipt = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabClientAPI::HelperValidateWindowsStoreReceipt);
 
@@ -8025,27 +7379,16 @@ UPlayFabClientAPI* UPlayFabClientAPI::ValidateWindowsStoreReceipt(FClientValidat
     manager->PlayFabRequestURL = "/Client/ValidateWindowsStoreReceipt";
     manager->useSessionTicket = true;
     manager->useSecretKey = false;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.Receipt.IsEmpty() || request.Receipt == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Receipt"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Receipt"), request.Receipt);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CurrencyCode.IsEmpty() || request.CurrencyCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CurrencyCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CurrencyCode"), request.CurrencyCode);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("PurchasePrice"), request.PurchasePrice);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Receipt", request.Receipt);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("CurrencyCode", request.CurrencyCode);
+    Writer.WriteNumber("PurchasePrice", request.PurchasePrice);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -8063,17 +7406,17 @@ void UPlayFabClientAPI::HelperValidateWindowsStoreReceipt(FPlayFabBaseModel resp
     }
     else
     {
-        FClientValidateWindowsReceiptResult result = UPlayFabClientModelDecoder::decodeValidateWindowsReceiptResultResponse(response.responseData);
-        if (OnSuccessValidateWindowsStoreReceipt.IsBound())
+        FClientValidateWindowsReceiptResult result = UPlayFabClientModelDecoder::readValidateWindowsReceiptResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessValidateWindowsStoreReceipt.Execute(result, mCustomData);
+            FDelegateOnSuccessValidateWindowsStoreReceipt(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
 
 
 
-void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed)
 {
     // Be sure that we have no data from previous response
     ResetResponseData();
@@ -8086,6 +7429,7 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
+        ReleaseToPool();
         return;
     }
 
@@ -8102,23 +7446,29 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        // Requests dropped from a full dispatcher queue were never started
+        if (Request->GetStatus() == EHttpRequestStatus::NotStarted)
+        {
+            myResponse.responseError.ErrorName = "Request dropped";
+            myResponse.responseError.ErrorMessage = "The request queue for this priority class was full";
+        }
+
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
+        ReleaseToPool();
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
-
     // Save response code as int32
     ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
-
-    // Decide whether the request was successful
-    bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
+    // The body was inflated, parsed and checked for errors on a worker thread
+    bIsValidJsonResponse = Parsed.bValidJson;
+    if (Parsed.Json.IsValid())
+    {
+        // Edits made through responseData must not reach the response cache, or other callers sharing the json
+        ResponseJsonObj->GetRootObject() = Parsed.bShared ? FPlayFabJsonView(Parsed.Json).CopyJsonObject() : Parsed.Json;
+    }
 
     // Log errors
     if (!bIsValidJsonResponse)
@@ -8126,17 +7476,25 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
     }
 
-    // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
-
-    myResponse.responseError.decodeError(ResponseJsonObj);
+    myResponse.responseError = Parsed.Error;
     myResponse.responseData = ResponseJsonObj;
+    myResponse.responseBody = Parsed.Body;
     IPlayFab* pfSettings = &(IPlayFab::Get());
 
     if (isLoginRequest && !myResponse.responseError.hasError)
     {
-        pfSettings->setSessionTicket(myResponse.responseData->GetObjectField("data")->GetStringField("SessionTicket"));
-        bool needsAttribution = myResponse.responseData->GetObjectField("data")->GetBoolField("SessionTicket");
+        const FPlayFabJsonView LoginData = myResponse.responseData->GetView().GetObjectField("data");
+        const FString SessionTicket = LoginData.GetStringField("SessionTicket");
+        if (SessionContext.IsValid())
+        {
+            SessionContext->SessionTicket = SessionTicket;
+            SessionContext->PlayFabId = LoginData.GetStringField("PlayFabId");
+        }
+        else
+        {
+            pfSettings->setSessionTicket(SessionTicket);
+        }
+        bool needsAttribution = LoginData.GetBoolField("SessionTicket");
         if (needsAttribution && !pfSettings->DisableAdvertising && !pfSettings->AdvertisingIdType.IsEmpty() && !pfSettings->AdvertisingIdValue.IsEmpty())
         {
             FClientAttributeInstallRequest request;
@@ -8149,26 +7507,58 @@ void UPlayFabClientAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
                 makeAttrCall = false;
             if (makeAttrCall)
             {
-                // TODO: This request might be getting memory collected before it's complete...
+                // The pool holds the call until its response has been delivered
                 FDelegateOnSuccessAttributeInstall onSuccess;
                 FDelegateOnFailurePlayFabError onFailure;
                 UPlayFabClientAPI* callObj = AttributeInstall(request, onSuccess, onFailure, mCustomData);
+                callObj->SetSessionContext(SessionContext);
                 callObj->Activate();
             }
         }
     }
 
-    // Broadcast the result event
+    // Broadcast the result event, after which the response data is no longer ours to keep
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
+    ReleaseToPool();
 }
 
 void UPlayFabClientAPI::Activate()
+{
+    // From here the dispatcher holds the call, however long it takes
+    FPlayFabManagerPool::Get().MarkActivated(this);
+
+    FPlayFabDispatchInfo DispatchInfo;
+    DispatchInfo.Endpoint = PlayFabRequestURL;
+    DispatchInfo.Priority = requestPriority;
+    DispatchInfo.bIdempotent = isIdempotent;
+    DispatchInfo.bReadOnly = isReadOnly;
+    if (RequestBody.Num() == 0 && RequestJsonObj != nullptr)
+    {
+        // Built as a json tree by the caller rather than streamed by a factory
+        DispatchInfo.Body = RequestJsonObj->GetRootObject();
+    }
+    DispatchInfo.OnResponse = FPlayFabResponseDelegate::CreateUObject(this, &UPlayFabClientAPI::OnProcessRequestComplete);
+
+    // The generated decoders read the body itself, so the tree is only built for the login handling or other listeners
+    DispatchInfo.bNeedsJsonTree = isLoginRequest;
+    for (const UObject* Listener : OnPlayFabResponse.GetAllObjects())
+    {
+        DispatchInfo.bNeedsJsonTree |= Listener != this;
+    }
+
+    // Hand the request to the dispatcher, which sends it as soon as a connection is free
+    FPlayFabRequestDispatcher::Get().Submit(this, BuildHttpRequest(), DispatchInfo);
+}
+
+TSharedRef<IHttpRequest> UPlayFabClientAPI::BuildHttpRequest()
 {
     IPlayFab* pfSettings = &(IPlayFab::Get());
 
+    // Read the title and credentials from one snapshot, so a login completing meanwhile can't mix two sessions
+    const FPlayFabSettings& Settings = pfSettings->GetSettings();
+
     FString RequestUrl;
-    RequestUrl = TEXT("https://") + pfSettings->getGameTitleId() + IPlayFab::PlayFabURL + PlayFabRequestURL;
+    RequestUrl = Settings.GetUrl(PlayFabRequestURL);
 
     TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
     HttpRequest->SetURL(RequestUrl);
@@ -8176,31 +7566,19 @@ void UPlayFabClientAPI::Activate()
 
     // Headers
     if (useSessionTicket)
-        HttpRequest->SetHeader("X-Authentication", pfSettings->getSessionTicket());
+        HttpRequest->SetHeader("X-Authentication", SessionContext.IsValid() ? SessionContext->SessionTicket : Settings.SessionTicket);
     if (useSecretKey)
-        HttpRequest->SetHeader("X-SecretKey", pfSettings->getSecretApiKey());
+        HttpRequest->SetHeader("X-SecretKey", Settings.SecretApiKey);
     HttpRequest->SetHeader("Content-Type", "application/json");
+    HttpRequest->SetHeader("Accept-Encoding", "gzip, deflate");
     HttpRequest->SetHeader(TEXT("X-PlayFabSDK"), pfSettings->VersionString);
     HttpRequest->SetHeader("X-ReportErrorAsSuccess", "true"); // FHttpResponsePtr doesn't provide sufficient information when an error code is returned
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
+    if (RequestBody.Num() > 0)
+        HttpRequest->SetContent(RequestBody);
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
-
-    // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
-
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
-
-    // Bind event
-    HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabClientAPI::OnProcessRequestComplete);
-
-    // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    return HttpRequest;
 }
 
 void UPlayFabClientAPI::ResetResponseData()
@@ -8216,3 +7594,38 @@ void UPlayFabClientAPI::ResetResponseData()
 
     bIsValidJsonResponse = false;
 }
+
+void UPlayFabClientAPI::ReleaseToPool()
+{
+    FPlayFabManagerPool& Pool = FPlayFabManagerPool::Get();
+    if (!Pool.IsEnabled() || FPlayFabManagerPool::IsHeldOutside(this, OnPlayFabResponse, OnSuccess, OnFailure))
+    {
+        // Not reused, so the response is left for whoever still holds this call
+        Pool.Discard(this);
+        return;
+    }
+
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    OnSuccess.Unbind();
+    mCustomData = nullptr;
+
+    PlayFabRequestURL.Empty();
+    useSecretKey = false;
+    useSessionTicket = false;
+    isLoginRequest = false;
+    requestPriority = EPlayFabRequestPriority::Normal;
+    isIdempotent = false;
+    isReadOnly = false;
+    RequestHeaders.Empty();
+    RequestBody.Reset();
+    SessionContext.Reset();
+
+    if (RequestJsonObj != nullptr)
+    {
+        RequestJsonObj->Reset();
+    }
+    ResetResponseData();
+
+    Pool.Release(this);
+}
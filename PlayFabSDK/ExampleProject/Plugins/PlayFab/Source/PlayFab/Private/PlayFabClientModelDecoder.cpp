@@ -6,6 +6,7 @@
 
 #include "PlayFabPrivatePCH.h"
 #include "PlayFabClientModelDecoder.h"
+#include "PlayFabJsonReader.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Client API Functions
@@ -20,21 +21,83 @@ FClientGetPhotonAuthenticationTokenResult UPlayFabClientModelDecoder::decodeGetP
 {
     // Temp ustruct
     FClientGetPhotonAuthenticationTokenResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PhotonCustomAuthenticationToken = !(dataObj->HasField("PhotonCustomAuthenticationToken")) ? TEXT("") : dataObj->GetStringField("PhotonCustomAuthenticationToken");
+    tempStruct.PhotonCustomAuthenticationToken = !(dataObj.HasField("PhotonCustomAuthenticationToken")) ? TEXT("") : dataObj.GetStringField("PhotonCustomAuthenticationToken");
 
     return tempStruct;
 }
 
+FClientGetPhotonAuthenticationTokenResult UPlayFabClientModelDecoder::readGetPhotonAuthenticationTokenResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPhotonAuthenticationTokenResultResponse(Reader.GetFallbackTree(TEXT("GetPhotonAuthenticationTokenResult"), response));
+    }
+
+    FClientGetPhotonAuthenticationTokenResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PhotonCustomAuthenticationToken"):
+            Reader.ReadString(tempStruct.PhotonCustomAuthenticationToken);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPhotonAuthenticationTokenResultResponse(Reader.GetFallbackTree(TEXT("GetPhotonAuthenticationTokenResult"), response));
+    }
+    return tempStruct;
+}
+
 FClientGetTitlePublicKeyResult UPlayFabClientModelDecoder::decodeGetTitlePublicKeyResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetTitlePublicKeyResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.RSAPublicKey = !(dataObj.HasField("RSAPublicKey")) ? TEXT("") : dataObj.GetStringField("RSAPublicKey");
 
-    tempStruct.RSAPublicKey = !(dataObj->HasField("RSAPublicKey")) ? TEXT("") : dataObj->GetStringField("RSAPublicKey");
+    return tempStruct;
+}
+
+FClientGetTitlePublicKeyResult UPlayFabClientModelDecoder::readGetTitlePublicKeyResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetTitlePublicKeyResultResponse(Reader.GetFallbackTree(TEXT("GetTitlePublicKeyResult"), response));
+    }
 
+    FClientGetTitlePublicKeyResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("RSAPublicKey"):
+            Reader.ReadString(tempStruct.RSAPublicKey);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetTitlePublicKeyResultResponse(Reader.GetFallbackTree(TEXT("GetTitlePublicKeyResult"), response));
+    }
     return tempStruct;
 }
 
@@ -42,43 +105,171 @@ FClientGetWindowsHelloChallengeResponse UPlayFabClientModelDecoder::decodeGetWin
 {
     // Temp ustruct
     FClientGetWindowsHelloChallengeResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Challenge = !(dataObj->HasField("Challenge")) ? TEXT("") : dataObj->GetStringField("Challenge");
+    tempStruct.Challenge = !(dataObj.HasField("Challenge")) ? TEXT("") : dataObj.GetStringField("Challenge");
 
     return tempStruct;
 }
 
+FClientGetWindowsHelloChallengeResponse UPlayFabClientModelDecoder::readGetWindowsHelloChallengeResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetWindowsHelloChallengeResponseResponse(Reader.GetFallbackTree(TEXT("GetWindowsHelloChallengeResponse"), response));
+    }
+
+    FClientGetWindowsHelloChallengeResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Challenge"):
+            Reader.ReadString(tempStruct.Challenge);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetWindowsHelloChallengeResponseResponse(Reader.GetFallbackTree(TEXT("GetWindowsHelloChallengeResponse"), response));
+    }
+    return tempStruct;
+}
+
 FClientLoginResult UPlayFabClientModelDecoder::decodeLoginResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientLoginResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.SessionTicket = !(dataObj->HasField("SessionTicket")) ? TEXT("") : dataObj->GetStringField("SessionTicket");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.NewlyCreated = !(dataObj->HasField("NewlyCreated")) ? false : dataObj->GetBoolField("NewlyCreated");
-    tempStruct.SettingsForUser = !(dataObj->HasField("SettingsForUser")) ? nullptr : dataObj->GetObjectField("SettingsForUser");
-    tempStruct.LastLoginTime = !(dataObj->HasField("LastLoginTime")) ? TEXT("") : dataObj->GetStringField("LastLoginTime");
-    tempStruct.InfoResultPayload = !(dataObj->HasField("InfoResultPayload")) ? nullptr : dataObj->GetObjectField("InfoResultPayload");
+    tempStruct.SessionTicket = !(dataObj.HasField("SessionTicket")) ? TEXT("") : dataObj.GetStringField("SessionTicket");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.NewlyCreated = !(dataObj.HasField("NewlyCreated")) ? false : dataObj.GetBoolField("NewlyCreated");
+    tempStruct.SettingsForUserView = !(dataObj.HasField("SettingsForUser")) ? FPlayFabJsonView() : dataObj.GetObjectField("SettingsForUser");
+    tempStruct.LastLoginTime = !(dataObj.HasField("LastLoginTime")) ? TEXT("") : dataObj.GetStringField("LastLoginTime");
+    tempStruct.InfoResultPayloadView = !(dataObj.HasField("InfoResultPayload")) ? FPlayFabJsonView() : dataObj.GetObjectField("InfoResultPayload");
 
     return tempStruct;
 }
 
+FClientLoginResult UPlayFabClientModelDecoder::readLoginResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeLoginResultResponse(Reader.GetFallbackTree(TEXT("LoginResult"), response));
+    }
+
+    FClientLoginResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("SessionTicket"):
+            Reader.ReadString(tempStruct.SessionTicket);
+            break;
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("NewlyCreated"):
+            Reader.ReadBool(tempStruct.NewlyCreated);
+            break;
+        case FPlayFabJsonReader::Hash("SettingsForUser"):
+            Reader.ReadObject(tempStruct.SettingsForUserView, TEXT("SettingsForUser"));
+            break;
+        case FPlayFabJsonReader::Hash("LastLoginTime"):
+            Reader.ReadString(tempStruct.LastLoginTime);
+            break;
+        case FPlayFabJsonReader::Hash("InfoResultPayload"):
+            Reader.ReadObject(tempStruct.InfoResultPayloadView, TEXT("InfoResultPayload"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeLoginResultResponse(Reader.GetFallbackTree(TEXT("LoginResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillLoginResultJsonObjects(FClientLoginResult& result)
+{
+    result.SettingsForUser = result.SettingsForUserView.WrapJsonObject();
+    result.InfoResultPayload = result.InfoResultPayloadView.WrapJsonObject();
+}
+
 FClientRegisterPlayFabUserResult UPlayFabClientModelDecoder::decodeRegisterPlayFabUserResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientRegisterPlayFabUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.SessionTicket = !(dataObj->HasField("SessionTicket")) ? TEXT("") : dataObj->GetStringField("SessionTicket");
-    tempStruct.Username = !(dataObj->HasField("Username")) ? TEXT("") : dataObj->GetStringField("Username");
-    tempStruct.SettingsForUser = !(dataObj->HasField("SettingsForUser")) ? nullptr : dataObj->GetObjectField("SettingsForUser");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.SessionTicket = !(dataObj.HasField("SessionTicket")) ? TEXT("") : dataObj.GetStringField("SessionTicket");
+    tempStruct.Username = !(dataObj.HasField("Username")) ? TEXT("") : dataObj.GetStringField("Username");
+    tempStruct.SettingsForUserView = !(dataObj.HasField("SettingsForUser")) ? FPlayFabJsonView() : dataObj.GetObjectField("SettingsForUser");
 
     return tempStruct;
 }
 
+FClientRegisterPlayFabUserResult UPlayFabClientModelDecoder::readRegisterPlayFabUserResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeRegisterPlayFabUserResultResponse(Reader.GetFallbackTree(TEXT("RegisterPlayFabUserResult"), response));
+    }
+
+    FClientRegisterPlayFabUserResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("SessionTicket"):
+            Reader.ReadString(tempStruct.SessionTicket);
+            break;
+        case FPlayFabJsonReader::Hash("Username"):
+            Reader.ReadString(tempStruct.Username);
+            break;
+        case FPlayFabJsonReader::Hash("SettingsForUser"):
+            Reader.ReadObject(tempStruct.SettingsForUserView, TEXT("SettingsForUser"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeRegisterPlayFabUserResultResponse(Reader.GetFallbackTree(TEXT("RegisterPlayFabUserResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillRegisterPlayFabUserResultJsonObjects(FClientRegisterPlayFabUserResult& result)
+{
+    result.SettingsForUser = result.SettingsForUserView.WrapJsonObject();
+}
+
 FClientSetPlayerSecretResult UPlayFabClientModelDecoder::decodeSetPlayerSecretResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -88,6 +279,12 @@ FClientSetPlayerSecretResult UPlayFabClientModelDecoder::decodeSetPlayerSecretRe
     return tempStruct;
 }
 
+FClientSetPlayerSecretResult UPlayFabClientModelDecoder::readSetPlayerSecretResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientSetPlayerSecretResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -103,128 +300,528 @@ FClientAddGenericIDResult UPlayFabClientModelDecoder::decodeAddGenericIDResultRe
     return tempStruct;
 }
 
+FClientAddGenericIDResult UPlayFabClientModelDecoder::readAddGenericIDResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientAddGenericIDResult();
+}
+
 FClientAddUsernamePasswordResult UPlayFabClientModelDecoder::decodeAddUsernamePasswordResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientAddUsernamePasswordResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Username = !(dataObj->HasField("Username")) ? TEXT("") : dataObj->GetStringField("Username");
+    tempStruct.Username = !(dataObj.HasField("Username")) ? TEXT("") : dataObj.GetStringField("Username");
 
     return tempStruct;
 }
 
+FClientAddUsernamePasswordResult UPlayFabClientModelDecoder::readAddUsernamePasswordResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeAddUsernamePasswordResultResponse(Reader.GetFallbackTree(TEXT("AddUsernamePasswordResult"), response));
+    }
+
+    FClientAddUsernamePasswordResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Username"):
+            Reader.ReadString(tempStruct.Username);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeAddUsernamePasswordResultResponse(Reader.GetFallbackTree(TEXT("AddUsernamePasswordResult"), response));
+    }
+    return tempStruct;
+}
+
 FClientGetAccountInfoResult UPlayFabClientModelDecoder::decodeGetAccountInfoResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetAccountInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.AccountInfoView = !(dataObj.HasField("AccountInfo")) ? FPlayFabJsonView() : dataObj.GetObjectField("AccountInfo");
+
+    return tempStruct;
+}
 
-    tempStruct.AccountInfo = !(dataObj->HasField("AccountInfo")) ? nullptr : dataObj->GetObjectField("AccountInfo");
+FClientGetAccountInfoResult UPlayFabClientModelDecoder::readGetAccountInfoResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetAccountInfoResultResponse(Reader.GetFallbackTree(TEXT("GetAccountInfoResult"), response));
+    }
 
+    FClientGetAccountInfoResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("AccountInfo"):
+            Reader.ReadObject(tempStruct.AccountInfoView, TEXT("AccountInfo"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetAccountInfoResultResponse(Reader.GetFallbackTree(TEXT("GetAccountInfoResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetAccountInfoResultJsonObjects(FClientGetAccountInfoResult& result)
+{
+    result.AccountInfo = result.AccountInfoView.WrapJsonObject();
+}
+
 FClientGetPlayerCombinedInfoResult UPlayFabClientModelDecoder::decodeGetPlayerCombinedInfoResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayerCombinedInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.InfoResultPayloadView = !(dataObj.HasField("InfoResultPayload")) ? FPlayFabJsonView() : dataObj.GetObjectField("InfoResultPayload");
+
+    return tempStruct;
+}
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.InfoResultPayload = !(dataObj->HasField("InfoResultPayload")) ? nullptr : dataObj->GetObjectField("InfoResultPayload");
+FClientGetPlayerCombinedInfoResult UPlayFabClientModelDecoder::readGetPlayerCombinedInfoResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerCombinedInfoResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerCombinedInfoResult"), response));
+    }
 
+    FClientGetPlayerCombinedInfoResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("InfoResultPayload"):
+            Reader.ReadObject(tempStruct.InfoResultPayloadView, TEXT("InfoResultPayload"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerCombinedInfoResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerCombinedInfoResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetPlayerCombinedInfoResultJsonObjects(FClientGetPlayerCombinedInfoResult& result)
+{
+    result.InfoResultPayload = result.InfoResultPayloadView.WrapJsonObject();
+}
+
 FClientGetPlayerProfileResult UPlayFabClientModelDecoder::decodeGetPlayerProfileResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayerProfileResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayerProfile = !(dataObj->HasField("PlayerProfile")) ? nullptr : dataObj->GetObjectField("PlayerProfile");
+    tempStruct.PlayerProfileView = !(dataObj.HasField("PlayerProfile")) ? FPlayFabJsonView() : dataObj.GetObjectField("PlayerProfile");
 
     return tempStruct;
 }
 
+FClientGetPlayerProfileResult UPlayFabClientModelDecoder::readGetPlayerProfileResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerProfileResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerProfileResult"), response));
+    }
+
+    FClientGetPlayerProfileResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayerProfile"):
+            Reader.ReadObject(tempStruct.PlayerProfileView, TEXT("PlayerProfile"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerProfileResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerProfileResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetPlayerProfileResultJsonObjects(FClientGetPlayerProfileResult& result)
+{
+    result.PlayerProfile = result.PlayerProfileView.WrapJsonObject();
+}
+
 FClientGetPlayFabIDsFromFacebookIDsResult UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromFacebookIDsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromFacebookIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Data");
 
     return tempStruct;
 }
 
+FClientGetPlayFabIDsFromFacebookIDsResult UPlayFabClientModelDecoder::readGetPlayFabIDsFromFacebookIDsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayFabIDsFromFacebookIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromFacebookIDsResult"), response));
+    }
+
+    FClientGetPlayFabIDsFromFacebookIDsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObjectArray(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayFabIDsFromFacebookIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromFacebookIDsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetPlayFabIDsFromFacebookIDsResultJsonObjects(FClientGetPlayFabIDsFromFacebookIDsResult& result)
+{
+    result.Data = FPlayFabJsonView::WrapJsonObjects(result.DataView);
+}
+
 FClientGetPlayFabIDsFromGameCenterIDsResult UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGameCenterIDsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromGameCenterIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Data");
 
     return tempStruct;
 }
 
+FClientGetPlayFabIDsFromGameCenterIDsResult UPlayFabClientModelDecoder::readGetPlayFabIDsFromGameCenterIDsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayFabIDsFromGameCenterIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromGameCenterIDsResult"), response));
+    }
+
+    FClientGetPlayFabIDsFromGameCenterIDsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObjectArray(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayFabIDsFromGameCenterIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromGameCenterIDsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetPlayFabIDsFromGameCenterIDsResultJsonObjects(FClientGetPlayFabIDsFromGameCenterIDsResult& result)
+{
+    result.Data = FPlayFabJsonView::WrapJsonObjects(result.DataView);
+}
+
 FClientGetPlayFabIDsFromGenericIDsResult UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGenericIDsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromGenericIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Data");
 
     return tempStruct;
 }
 
+FClientGetPlayFabIDsFromGenericIDsResult UPlayFabClientModelDecoder::readGetPlayFabIDsFromGenericIDsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayFabIDsFromGenericIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromGenericIDsResult"), response));
+    }
+
+    FClientGetPlayFabIDsFromGenericIDsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObjectArray(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayFabIDsFromGenericIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromGenericIDsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetPlayFabIDsFromGenericIDsResultJsonObjects(FClientGetPlayFabIDsFromGenericIDsResult& result)
+{
+    result.Data = FPlayFabJsonView::WrapJsonObjects(result.DataView);
+}
+
 FClientGetPlayFabIDsFromGoogleIDsResult UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromGoogleIDsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromGoogleIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Data");
 
     return tempStruct;
 }
 
+FClientGetPlayFabIDsFromGoogleIDsResult UPlayFabClientModelDecoder::readGetPlayFabIDsFromGoogleIDsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayFabIDsFromGoogleIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromGoogleIDsResult"), response));
+    }
+
+    FClientGetPlayFabIDsFromGoogleIDsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObjectArray(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayFabIDsFromGoogleIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromGoogleIDsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetPlayFabIDsFromGoogleIDsResultJsonObjects(FClientGetPlayFabIDsFromGoogleIDsResult& result)
+{
+    result.Data = FPlayFabJsonView::WrapJsonObjects(result.DataView);
+}
+
 FClientGetPlayFabIDsFromKongregateIDsResult UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromKongregateIDsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromKongregateIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Data");
+
+    return tempStruct;
+}
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+FClientGetPlayFabIDsFromKongregateIDsResult UPlayFabClientModelDecoder::readGetPlayFabIDsFromKongregateIDsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayFabIDsFromKongregateIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromKongregateIDsResult"), response));
+    }
 
+    FClientGetPlayFabIDsFromKongregateIDsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObjectArray(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayFabIDsFromKongregateIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromKongregateIDsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetPlayFabIDsFromKongregateIDsResultJsonObjects(FClientGetPlayFabIDsFromKongregateIDsResult& result)
+{
+    result.Data = FPlayFabJsonView::WrapJsonObjects(result.DataView);
+}
+
 FClientGetPlayFabIDsFromSteamIDsResult UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromSteamIDsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromSteamIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Data");
 
     return tempStruct;
 }
 
+FClientGetPlayFabIDsFromSteamIDsResult UPlayFabClientModelDecoder::readGetPlayFabIDsFromSteamIDsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayFabIDsFromSteamIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromSteamIDsResult"), response));
+    }
+
+    FClientGetPlayFabIDsFromSteamIDsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObjectArray(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayFabIDsFromSteamIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromSteamIDsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetPlayFabIDsFromSteamIDsResultJsonObjects(FClientGetPlayFabIDsFromSteamIDsResult& result)
+{
+    result.Data = FPlayFabJsonView::WrapJsonObjects(result.DataView);
+}
+
 FClientGetPlayFabIDsFromTwitchIDsResult UPlayFabClientModelDecoder::decodeGetPlayFabIDsFromTwitchIDsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayFabIDsFromTwitchIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Data");
 
     return tempStruct;
 }
 
+FClientGetPlayFabIDsFromTwitchIDsResult UPlayFabClientModelDecoder::readGetPlayFabIDsFromTwitchIDsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayFabIDsFromTwitchIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromTwitchIDsResult"), response));
+    }
+
+    FClientGetPlayFabIDsFromTwitchIDsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObjectArray(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayFabIDsFromTwitchIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromTwitchIDsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetPlayFabIDsFromTwitchIDsResultJsonObjects(FClientGetPlayFabIDsFromTwitchIDsResult& result)
+{
+    result.Data = FPlayFabJsonView::WrapJsonObjects(result.DataView);
+}
+
 FClientLinkAndroidDeviceIDResult UPlayFabClientModelDecoder::decodeLinkAndroidDeviceIDResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -234,6 +831,12 @@ FClientLinkAndroidDeviceIDResult UPlayFabClientModelDecoder::decodeLinkAndroidDe
     return tempStruct;
 }
 
+FClientLinkAndroidDeviceIDResult UPlayFabClientModelDecoder::readLinkAndroidDeviceIDResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientLinkAndroidDeviceIDResult();
+}
+
 FClientLinkCustomIDResult UPlayFabClientModelDecoder::decodeLinkCustomIDResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -243,6 +846,12 @@ FClientLinkCustomIDResult UPlayFabClientModelDecoder::decodeLinkCustomIDResultRe
     return tempStruct;
 }
 
+FClientLinkCustomIDResult UPlayFabClientModelDecoder::readLinkCustomIDResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientLinkCustomIDResult();
+}
+
 FClientLinkFacebookAccountResult UPlayFabClientModelDecoder::decodeLinkFacebookAccountResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -252,6 +861,12 @@ FClientLinkFacebookAccountResult UPlayFabClientModelDecoder::decodeLinkFacebookA
     return tempStruct;
 }
 
+FClientLinkFacebookAccountResult UPlayFabClientModelDecoder::readLinkFacebookAccountResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientLinkFacebookAccountResult();
+}
+
 FClientLinkGameCenterAccountResult UPlayFabClientModelDecoder::decodeLinkGameCenterAccountResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -261,6 +876,12 @@ FClientLinkGameCenterAccountResult UPlayFabClientModelDecoder::decodeLinkGameCen
     return tempStruct;
 }
 
+FClientLinkGameCenterAccountResult UPlayFabClientModelDecoder::readLinkGameCenterAccountResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientLinkGameCenterAccountResult();
+}
+
 FClientLinkGoogleAccountResult UPlayFabClientModelDecoder::decodeLinkGoogleAccountResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -270,6 +891,12 @@ FClientLinkGoogleAccountResult UPlayFabClientModelDecoder::decodeLinkGoogleAccou
     return tempStruct;
 }
 
+FClientLinkGoogleAccountResult UPlayFabClientModelDecoder::readLinkGoogleAccountResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientLinkGoogleAccountResult();
+}
+
 FClientLinkIOSDeviceIDResult UPlayFabClientModelDecoder::decodeLinkIOSDeviceIDResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -279,6 +906,12 @@ FClientLinkIOSDeviceIDResult UPlayFabClientModelDecoder::decodeLinkIOSDeviceIDRe
     return tempStruct;
 }
 
+FClientLinkIOSDeviceIDResult UPlayFabClientModelDecoder::readLinkIOSDeviceIDResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientLinkIOSDeviceIDResult();
+}
+
 FClientLinkKongregateAccountResult UPlayFabClientModelDecoder::decodeLinkKongregateAccountResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -288,6 +921,12 @@ FClientLinkKongregateAccountResult UPlayFabClientModelDecoder::decodeLinkKongreg
     return tempStruct;
 }
 
+FClientLinkKongregateAccountResult UPlayFabClientModelDecoder::readLinkKongregateAccountResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientLinkKongregateAccountResult();
+}
+
 FClientLinkSteamAccountResult UPlayFabClientModelDecoder::decodeLinkSteamAccountResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -297,6 +936,12 @@ FClientLinkSteamAccountResult UPlayFabClientModelDecoder::decodeLinkSteamAccount
     return tempStruct;
 }
 
+FClientLinkSteamAccountResult UPlayFabClientModelDecoder::readLinkSteamAccountResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientLinkSteamAccountResult();
+}
+
 FClientLinkTwitchAccountResult UPlayFabClientModelDecoder::decodeLinkTwitchAccountResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -306,6 +951,12 @@ FClientLinkTwitchAccountResult UPlayFabClientModelDecoder::decodeLinkTwitchAccou
     return tempStruct;
 }
 
+FClientLinkTwitchAccountResult UPlayFabClientModelDecoder::readLinkTwitchAccountResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientLinkTwitchAccountResult();
+}
+
 FClientLinkWindowsHelloAccountResponse UPlayFabClientModelDecoder::decodeLinkWindowsHelloAccountResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -315,6 +966,12 @@ FClientLinkWindowsHelloAccountResponse UPlayFabClientModelDecoder::decodeLinkWin
     return tempStruct;
 }
 
+FClientLinkWindowsHelloAccountResponse UPlayFabClientModelDecoder::readLinkWindowsHelloAccountResponseResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientLinkWindowsHelloAccountResponse();
+}
+
 FClientRemoveGenericIDResult UPlayFabClientModelDecoder::decodeRemoveGenericIDResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -324,15 +981,55 @@ FClientRemoveGenericIDResult UPlayFabClientModelDecoder::decodeRemoveGenericIDRe
     return tempStruct;
 }
 
+FClientRemoveGenericIDResult UPlayFabClientModelDecoder::readRemoveGenericIDResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientRemoveGenericIDResult();
+}
+
 FClientReportPlayerClientResult UPlayFabClientModelDecoder::decodeReportPlayerClientResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientReportPlayerClientResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.Updated = !(dataObj.HasField("Updated")) ? false : dataObj.GetBoolField("Updated");
+    tempStruct.SubmissionsRemaining = !(dataObj.HasField("SubmissionsRemaining")) ? 0 : int(dataObj.GetNumberField("SubmissionsRemaining"));
 
-    tempStruct.Updated = !(dataObj->HasField("Updated")) ? false : dataObj->GetBoolField("Updated");
-    tempStruct.SubmissionsRemaining = !(dataObj->HasField("SubmissionsRemaining")) ? 0 : int(dataObj->GetNumberField("SubmissionsRemaining"));
+    return tempStruct;
+}
+
+FClientReportPlayerClientResult UPlayFabClientModelDecoder::readReportPlayerClientResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeReportPlayerClientResultResponse(Reader.GetFallbackTree(TEXT("ReportPlayerClientResult"), response));
+    }
 
+    FClientReportPlayerClientResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Updated"):
+            Reader.ReadBool(tempStruct.Updated);
+            break;
+        case FPlayFabJsonReader::Hash("SubmissionsRemaining"):
+            Reader.ReadInt(tempStruct.SubmissionsRemaining);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeReportPlayerClientResultResponse(Reader.GetFallbackTree(TEXT("ReportPlayerClientResult"), response));
+    }
     return tempStruct;
 }
 
@@ -345,6 +1042,12 @@ FClientSendAccountRecoveryEmailResult UPlayFabClientModelDecoder::decodeSendAcco
     return tempStruct;
 }
 
+FClientSendAccountRecoveryEmailResult UPlayFabClientModelDecoder::readSendAccountRecoveryEmailResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientSendAccountRecoveryEmailResult();
+}
+
 FClientUnlinkAndroidDeviceIDResult UPlayFabClientModelDecoder::decodeUnlinkAndroidDeviceIDResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -354,6 +1057,12 @@ FClientUnlinkAndroidDeviceIDResult UPlayFabClientModelDecoder::decodeUnlinkAndro
     return tempStruct;
 }
 
+FClientUnlinkAndroidDeviceIDResult UPlayFabClientModelDecoder::readUnlinkAndroidDeviceIDResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUnlinkAndroidDeviceIDResult();
+}
+
 FClientUnlinkCustomIDResult UPlayFabClientModelDecoder::decodeUnlinkCustomIDResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -363,6 +1072,12 @@ FClientUnlinkCustomIDResult UPlayFabClientModelDecoder::decodeUnlinkCustomIDResu
     return tempStruct;
 }
 
+FClientUnlinkCustomIDResult UPlayFabClientModelDecoder::readUnlinkCustomIDResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUnlinkCustomIDResult();
+}
+
 FClientUnlinkFacebookAccountResult UPlayFabClientModelDecoder::decodeUnlinkFacebookAccountResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -372,6 +1087,12 @@ FClientUnlinkFacebookAccountResult UPlayFabClientModelDecoder::decodeUnlinkFaceb
     return tempStruct;
 }
 
+FClientUnlinkFacebookAccountResult UPlayFabClientModelDecoder::readUnlinkFacebookAccountResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUnlinkFacebookAccountResult();
+}
+
 FClientUnlinkGameCenterAccountResult UPlayFabClientModelDecoder::decodeUnlinkGameCenterAccountResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -381,6 +1102,12 @@ FClientUnlinkGameCenterAccountResult UPlayFabClientModelDecoder::decodeUnlinkGam
     return tempStruct;
 }
 
+FClientUnlinkGameCenterAccountResult UPlayFabClientModelDecoder::readUnlinkGameCenterAccountResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUnlinkGameCenterAccountResult();
+}
+
 FClientUnlinkGoogleAccountResult UPlayFabClientModelDecoder::decodeUnlinkGoogleAccountResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -390,6 +1117,12 @@ FClientUnlinkGoogleAccountResult UPlayFabClientModelDecoder::decodeUnlinkGoogleA
     return tempStruct;
 }
 
+FClientUnlinkGoogleAccountResult UPlayFabClientModelDecoder::readUnlinkGoogleAccountResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUnlinkGoogleAccountResult();
+}
+
 FClientUnlinkIOSDeviceIDResult UPlayFabClientModelDecoder::decodeUnlinkIOSDeviceIDResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -399,6 +1132,12 @@ FClientUnlinkIOSDeviceIDResult UPlayFabClientModelDecoder::decodeUnlinkIOSDevice
     return tempStruct;
 }
 
+FClientUnlinkIOSDeviceIDResult UPlayFabClientModelDecoder::readUnlinkIOSDeviceIDResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUnlinkIOSDeviceIDResult();
+}
+
 FClientUnlinkKongregateAccountResult UPlayFabClientModelDecoder::decodeUnlinkKongregateAccountResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -408,6 +1147,12 @@ FClientUnlinkKongregateAccountResult UPlayFabClientModelDecoder::decodeUnlinkKon
     return tempStruct;
 }
 
+FClientUnlinkKongregateAccountResult UPlayFabClientModelDecoder::readUnlinkKongregateAccountResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUnlinkKongregateAccountResult();
+}
+
 FClientUnlinkSteamAccountResult UPlayFabClientModelDecoder::decodeUnlinkSteamAccountResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -417,6 +1162,12 @@ FClientUnlinkSteamAccountResult UPlayFabClientModelDecoder::decodeUnlinkSteamAcc
     return tempStruct;
 }
 
+FClientUnlinkSteamAccountResult UPlayFabClientModelDecoder::readUnlinkSteamAccountResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUnlinkSteamAccountResult();
+}
+
 FClientUnlinkTwitchAccountResult UPlayFabClientModelDecoder::decodeUnlinkTwitchAccountResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -426,6 +1177,12 @@ FClientUnlinkTwitchAccountResult UPlayFabClientModelDecoder::decodeUnlinkTwitchA
     return tempStruct;
 }
 
+FClientUnlinkTwitchAccountResult UPlayFabClientModelDecoder::readUnlinkTwitchAccountResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUnlinkTwitchAccountResult();
+}
+
 FClientUnlinkWindowsHelloAccountResponse UPlayFabClientModelDecoder::decodeUnlinkWindowsHelloAccountResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -435,6 +1192,12 @@ FClientUnlinkWindowsHelloAccountResponse UPlayFabClientModelDecoder::decodeUnlin
     return tempStruct;
 }
 
+FClientUnlinkWindowsHelloAccountResponse UPlayFabClientModelDecoder::readUnlinkWindowsHelloAccountResponseResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUnlinkWindowsHelloAccountResponse();
+}
+
 FClientEmptyResult UPlayFabClientModelDecoder::decodeEmptyResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -444,14 +1207,51 @@ FClientEmptyResult UPlayFabClientModelDecoder::decodeEmptyResultResponse(UPlayFa
     return tempStruct;
 }
 
+FClientEmptyResult UPlayFabClientModelDecoder::readEmptyResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientEmptyResult();
+}
+
 FClientUpdateUserTitleDisplayNameResult UPlayFabClientModelDecoder::decodeUpdateUserTitleDisplayNameResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientUpdateUserTitleDisplayNameResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.DisplayName = !(dataObj->HasField("DisplayName")) ? TEXT("") : dataObj->GetStringField("DisplayName");
+    tempStruct.DisplayName = !(dataObj.HasField("DisplayName")) ? TEXT("") : dataObj.GetStringField("DisplayName");
+
+    return tempStruct;
+}
+
+FClientUpdateUserTitleDisplayNameResult UPlayFabClientModelDecoder::readUpdateUserTitleDisplayNameResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUpdateUserTitleDisplayNameResultResponse(Reader.GetFallbackTree(TEXT("UpdateUserTitleDisplayNameResult"), response));
+    }
 
+    FClientUpdateUserTitleDisplayNameResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("DisplayName"):
+            Reader.ReadString(tempStruct.DisplayName);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeUpdateUserTitleDisplayNameResultResponse(Reader.GetFallbackTree(TEXT("UpdateUserTitleDisplayNameResult"), response));
+    }
     return tempStruct;
 }
 
@@ -465,75 +1265,312 @@ FClientGetLeaderboardResult UPlayFabClientModelDecoder::decodeGetLeaderboardResu
 {
     // Temp ustruct
     FClientGetLeaderboardResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.LeaderboardView = !(dataObj.HasField("Leaderboard")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Leaderboard");
+    tempStruct.Version = !(dataObj.HasField("Version")) ? 0 : int(dataObj.GetNumberField("Version"));
+    tempStruct.NextReset = !(dataObj.HasField("NextReset")) ? TEXT("") : dataObj.GetStringField("NextReset");
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
-    tempStruct.NextReset = !(dataObj->HasField("NextReset")) ? TEXT("") : dataObj->GetStringField("NextReset");
+    return tempStruct;
+}
 
+FClientGetLeaderboardResult UPlayFabClientModelDecoder::readGetLeaderboardResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetLeaderboardResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardResult"), response));
+    }
+
+    FClientGetLeaderboardResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Leaderboard"):
+            Reader.ReadObjectArray(tempStruct.LeaderboardView, TEXT("Leaderboard"));
+            break;
+        case FPlayFabJsonReader::Hash("Version"):
+            Reader.ReadInt(tempStruct.Version);
+            break;
+        case FPlayFabJsonReader::Hash("NextReset"):
+            Reader.ReadString(tempStruct.NextReset);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetLeaderboardResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetLeaderboardResultJsonObjects(FClientGetLeaderboardResult& result)
+{
+    result.Leaderboard = FPlayFabJsonView::WrapJsonObjects(result.LeaderboardView);
+}
+
 FClientGetFriendLeaderboardAroundPlayerResult UPlayFabClientModelDecoder::decodeGetFriendLeaderboardAroundPlayerResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetFriendLeaderboardAroundPlayerResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
-    tempStruct.NextReset = !(dataObj->HasField("NextReset")) ? TEXT("") : dataObj->GetStringField("NextReset");
+    tempStruct.LeaderboardView = !(dataObj.HasField("Leaderboard")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Leaderboard");
+    tempStruct.Version = !(dataObj.HasField("Version")) ? 0 : int(dataObj.GetNumberField("Version"));
+    tempStruct.NextReset = !(dataObj.HasField("NextReset")) ? TEXT("") : dataObj.GetStringField("NextReset");
 
     return tempStruct;
 }
 
+FClientGetFriendLeaderboardAroundPlayerResult UPlayFabClientModelDecoder::readGetFriendLeaderboardAroundPlayerResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetFriendLeaderboardAroundPlayerResultResponse(Reader.GetFallbackTree(TEXT("GetFriendLeaderboardAroundPlayerResult"), response));
+    }
+
+    FClientGetFriendLeaderboardAroundPlayerResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Leaderboard"):
+            Reader.ReadObjectArray(tempStruct.LeaderboardView, TEXT("Leaderboard"));
+            break;
+        case FPlayFabJsonReader::Hash("Version"):
+            Reader.ReadInt(tempStruct.Version);
+            break;
+        case FPlayFabJsonReader::Hash("NextReset"):
+            Reader.ReadString(tempStruct.NextReset);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetFriendLeaderboardAroundPlayerResultResponse(Reader.GetFallbackTree(TEXT("GetFriendLeaderboardAroundPlayerResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetFriendLeaderboardAroundPlayerResultJsonObjects(FClientGetFriendLeaderboardAroundPlayerResult& result)
+{
+    result.Leaderboard = FPlayFabJsonView::WrapJsonObjects(result.LeaderboardView);
+}
+
 FClientGetLeaderboardAroundPlayerResult UPlayFabClientModelDecoder::decodeGetLeaderboardAroundPlayerResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetLeaderboardAroundPlayerResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
-    tempStruct.NextReset = !(dataObj->HasField("NextReset")) ? TEXT("") : dataObj->GetStringField("NextReset");
+    tempStruct.LeaderboardView = !(dataObj.HasField("Leaderboard")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Leaderboard");
+    tempStruct.Version = !(dataObj.HasField("Version")) ? 0 : int(dataObj.GetNumberField("Version"));
+    tempStruct.NextReset = !(dataObj.HasField("NextReset")) ? TEXT("") : dataObj.GetStringField("NextReset");
 
     return tempStruct;
 }
 
+FClientGetLeaderboardAroundPlayerResult UPlayFabClientModelDecoder::readGetLeaderboardAroundPlayerResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetLeaderboardAroundPlayerResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardAroundPlayerResult"), response));
+    }
+
+    FClientGetLeaderboardAroundPlayerResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Leaderboard"):
+            Reader.ReadObjectArray(tempStruct.LeaderboardView, TEXT("Leaderboard"));
+            break;
+        case FPlayFabJsonReader::Hash("Version"):
+            Reader.ReadInt(tempStruct.Version);
+            break;
+        case FPlayFabJsonReader::Hash("NextReset"):
+            Reader.ReadString(tempStruct.NextReset);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetLeaderboardAroundPlayerResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardAroundPlayerResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetLeaderboardAroundPlayerResultJsonObjects(FClientGetLeaderboardAroundPlayerResult& result)
+{
+    result.Leaderboard = FPlayFabJsonView::WrapJsonObjects(result.LeaderboardView);
+}
+
 FClientGetPlayerStatisticsResult UPlayFabClientModelDecoder::decodeGetPlayerStatisticsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayerStatisticsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.StatisticsView = !(dataObj.HasField("Statistics")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Statistics");
+
+    return tempStruct;
+}
 
-    tempStruct.Statistics = !(dataObj->HasField("Statistics")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Statistics");
+FClientGetPlayerStatisticsResult UPlayFabClientModelDecoder::readGetPlayerStatisticsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerStatisticsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerStatisticsResult"), response));
+    }
 
+    FClientGetPlayerStatisticsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Statistics"):
+            Reader.ReadObjectArray(tempStruct.StatisticsView, TEXT("Statistics"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerStatisticsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerStatisticsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetPlayerStatisticsResultJsonObjects(FClientGetPlayerStatisticsResult& result)
+{
+    result.Statistics = FPlayFabJsonView::WrapJsonObjects(result.StatisticsView);
+}
+
 FClientGetPlayerStatisticVersionsResult UPlayFabClientModelDecoder::decodeGetPlayerStatisticVersionsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayerStatisticVersionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.StatisticVersions = !(dataObj->HasField("StatisticVersions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("StatisticVersions");
+    tempStruct.StatisticVersionsView = !(dataObj.HasField("StatisticVersions")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("StatisticVersions");
 
     return tempStruct;
 }
 
+FClientGetPlayerStatisticVersionsResult UPlayFabClientModelDecoder::readGetPlayerStatisticVersionsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerStatisticVersionsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerStatisticVersionsResult"), response));
+    }
+
+    FClientGetPlayerStatisticVersionsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("StatisticVersions"):
+            Reader.ReadObjectArray(tempStruct.StatisticVersionsView, TEXT("StatisticVersions"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerStatisticVersionsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerStatisticVersionsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetPlayerStatisticVersionsResultJsonObjects(FClientGetPlayerStatisticVersionsResult& result)
+{
+    result.StatisticVersions = FPlayFabJsonView::WrapJsonObjects(result.StatisticVersionsView);
+}
+
 FClientGetUserDataResult UPlayFabClientModelDecoder::decodeGetUserDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetUserDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
+    tempStruct.DataVersion = !(dataObj.HasField("DataVersion")) ? 0 : int(dataObj.GetNumberField("DataVersion"));
 
     return tempStruct;
 }
 
+FClientGetUserDataResult UPlayFabClientModelDecoder::readGetUserDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetUserDataResultResponse(Reader.GetFallbackTree(TEXT("GetUserDataResult"), response));
+    }
+
+    FClientGetUserDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        case FPlayFabJsonReader::Hash("DataVersion"):
+            Reader.ReadInt(tempStruct.DataVersion);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetUserDataResultResponse(Reader.GetFallbackTree(TEXT("GetUserDataResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetUserDataResultJsonObjects(FClientGetUserDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
+}
+
 FClientUpdatePlayerStatisticsResult UPlayFabClientModelDecoder::decodeUpdatePlayerStatisticsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -543,17 +1580,54 @@ FClientUpdatePlayerStatisticsResult UPlayFabClientModelDecoder::decodeUpdatePlay
     return tempStruct;
 }
 
+FClientUpdatePlayerStatisticsResult UPlayFabClientModelDecoder::readUpdatePlayerStatisticsResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUpdatePlayerStatisticsResult();
+}
+
 FClientUpdateUserDataResult UPlayFabClientModelDecoder::decodeUpdateUserDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientUpdateUserDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+    tempStruct.DataVersion = !(dataObj.HasField("DataVersion")) ? 0 : int(dataObj.GetNumberField("DataVersion"));
 
     return tempStruct;
 }
 
+FClientUpdateUserDataResult UPlayFabClientModelDecoder::readUpdateUserDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUpdateUserDataResultResponse(Reader.GetFallbackTree(TEXT("UpdateUserDataResult"), response));
+    }
+
+    FClientUpdateUserDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("DataVersion"):
+            Reader.ReadInt(tempStruct.DataVersion);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeUpdateUserDataResultResponse(Reader.GetFallbackTree(TEXT("UpdateUserDataResult"), response));
+    }
+    return tempStruct;
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -564,72 +1638,296 @@ FClientGetCatalogItemsResult UPlayFabClientModelDecoder::decodeGetCatalogItemsRe
 {
     // Temp ustruct
     FClientGetCatalogItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Catalog = !(dataObj->HasField("Catalog")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Catalog");
+    tempStruct.CatalogView = !(dataObj.HasField("Catalog")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Catalog");
 
     return tempStruct;
 }
 
+FClientGetCatalogItemsResult UPlayFabClientModelDecoder::readGetCatalogItemsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCatalogItemsResultResponse(Reader.GetFallbackTree(TEXT("GetCatalogItemsResult"), response));
+    }
+
+    FClientGetCatalogItemsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Catalog"):
+            Reader.ReadObjectArray(tempStruct.CatalogView, TEXT("Catalog"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetCatalogItemsResultResponse(Reader.GetFallbackTree(TEXT("GetCatalogItemsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetCatalogItemsResultJsonObjects(FClientGetCatalogItemsResult& result)
+{
+    result.Catalog = FPlayFabJsonView::WrapJsonObjects(result.CatalogView);
+}
+
 FClientGetPublisherDataResult UPlayFabClientModelDecoder::decodeGetPublisherDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPublisherDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
 
     return tempStruct;
 }
 
+FClientGetPublisherDataResult UPlayFabClientModelDecoder::readGetPublisherDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPublisherDataResultResponse(Reader.GetFallbackTree(TEXT("GetPublisherDataResult"), response));
+    }
+
+    FClientGetPublisherDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPublisherDataResultResponse(Reader.GetFallbackTree(TEXT("GetPublisherDataResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetPublisherDataResultJsonObjects(FClientGetPublisherDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
+}
+
 FClientGetStoreItemsResult UPlayFabClientModelDecoder::decodeGetStoreItemsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetStoreItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.StoreView = !(dataObj.HasField("Store")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Store");
+    GetEnumValueFromString<EPfSourceType>(TEXT("EPfSourceType"), dataObj.GetStringField("Source"), tempStruct.Source);
+    tempStruct.CatalogVersion = !(dataObj.HasField("CatalogVersion")) ? TEXT("") : dataObj.GetStringField("CatalogVersion");
+    tempStruct.StoreId = !(dataObj.HasField("StoreId")) ? TEXT("") : dataObj.GetStringField("StoreId");
+    tempStruct.MarketingDataView = !(dataObj.HasField("MarketingData")) ? FPlayFabJsonView() : dataObj.GetObjectField("MarketingData");
+
+    return tempStruct;
+}
 
-    tempStruct.Store = !(dataObj->HasField("Store")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Store");
-    GetEnumValueFromString<EPfSourceType>(TEXT("EPfSourceType"), dataObj->GetStringField("Source"), tempStruct.Source);
-    tempStruct.CatalogVersion = !(dataObj->HasField("CatalogVersion")) ? TEXT("") : dataObj->GetStringField("CatalogVersion");
-    tempStruct.StoreId = !(dataObj->HasField("StoreId")) ? TEXT("") : dataObj->GetStringField("StoreId");
-    tempStruct.MarketingData = !(dataObj->HasField("MarketingData")) ? nullptr : dataObj->GetObjectField("MarketingData");
+FClientGetStoreItemsResult UPlayFabClientModelDecoder::readGetStoreItemsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetStoreItemsResultResponse(Reader.GetFallbackTree(TEXT("GetStoreItemsResult"), response));
+    }
 
+    FClientGetStoreItemsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Store"):
+            Reader.ReadObjectArray(tempStruct.StoreView, TEXT("Store"));
+            break;
+        case FPlayFabJsonReader::Hash("Source"):
+            Reader.ReadEnum(tempStruct.Source);
+            break;
+        case FPlayFabJsonReader::Hash("CatalogVersion"):
+            Reader.ReadString(tempStruct.CatalogVersion);
+            break;
+        case FPlayFabJsonReader::Hash("StoreId"):
+            Reader.ReadString(tempStruct.StoreId);
+            break;
+        case FPlayFabJsonReader::Hash("MarketingData"):
+            Reader.ReadObject(tempStruct.MarketingDataView, TEXT("MarketingData"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetStoreItemsResultResponse(Reader.GetFallbackTree(TEXT("GetStoreItemsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetStoreItemsResultJsonObjects(FClientGetStoreItemsResult& result)
+{
+    result.Store = FPlayFabJsonView::WrapJsonObjects(result.StoreView);
+    result.MarketingData = result.MarketingDataView.WrapJsonObject();
+}
+
 FClientGetTimeResult UPlayFabClientModelDecoder::decodeGetTimeResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetTimeResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Time = !(dataObj->HasField("Time")) ? TEXT("") : dataObj->GetStringField("Time");
+    tempStruct.Time = !(dataObj.HasField("Time")) ? TEXT("") : dataObj.GetStringField("Time");
 
     return tempStruct;
 }
 
+FClientGetTimeResult UPlayFabClientModelDecoder::readGetTimeResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetTimeResultResponse(Reader.GetFallbackTree(TEXT("GetTimeResult"), response));
+    }
+
+    FClientGetTimeResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Time"):
+            Reader.ReadString(tempStruct.Time);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetTimeResultResponse(Reader.GetFallbackTree(TEXT("GetTimeResult"), response));
+    }
+    return tempStruct;
+}
+
 FClientGetTitleDataResult UPlayFabClientModelDecoder::decodeGetTitleDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetTitleDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
 
     return tempStruct;
 }
 
+FClientGetTitleDataResult UPlayFabClientModelDecoder::readGetTitleDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetTitleDataResultResponse(Reader.GetFallbackTree(TEXT("GetTitleDataResult"), response));
+    }
+
+    FClientGetTitleDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetTitleDataResultResponse(Reader.GetFallbackTree(TEXT("GetTitleDataResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetTitleDataResultJsonObjects(FClientGetTitleDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
+}
+
 FClientGetTitleNewsResult UPlayFabClientModelDecoder::decodeGetTitleNewsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetTitleNewsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.News = !(dataObj->HasField("News")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("News");
+    tempStruct.NewsView = !(dataObj.HasField("News")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("News");
 
     return tempStruct;
 }
 
+FClientGetTitleNewsResult UPlayFabClientModelDecoder::readGetTitleNewsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetTitleNewsResultResponse(Reader.GetFallbackTree(TEXT("GetTitleNewsResult"), response));
+    }
+
+    FClientGetTitleNewsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("News"):
+            Reader.ReadObjectArray(tempStruct.NewsView, TEXT("News"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetTitleNewsResultResponse(Reader.GetFallbackTree(TEXT("GetTitleNewsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetTitleNewsResultJsonObjects(FClientGetTitleNewsResult& result)
+{
+    result.News = FPlayFabJsonView::WrapJsonObjects(result.NewsView);
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -640,153 +1938,632 @@ FClientModifyUserVirtualCurrencyResult UPlayFabClientModelDecoder::decodeModifyU
 {
     // Temp ustruct
     FClientModifyUserVirtualCurrencyResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? TEXT("") : dataObj->GetStringField("VirtualCurrency");
-    tempStruct.BalanceChange = !(dataObj->HasField("BalanceChange")) ? 0 : int(dataObj->GetNumberField("BalanceChange"));
-    tempStruct.Balance = !(dataObj->HasField("Balance")) ? 0 : int(dataObj->GetNumberField("Balance"));
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.VirtualCurrency = !(dataObj.HasField("VirtualCurrency")) ? TEXT("") : dataObj.GetStringField("VirtualCurrency");
+    tempStruct.BalanceChange = !(dataObj.HasField("BalanceChange")) ? 0 : int(dataObj.GetNumberField("BalanceChange"));
+    tempStruct.Balance = !(dataObj.HasField("Balance")) ? 0 : int(dataObj.GetNumberField("Balance"));
 
     return tempStruct;
 }
 
+FClientModifyUserVirtualCurrencyResult UPlayFabClientModelDecoder::readModifyUserVirtualCurrencyResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeModifyUserVirtualCurrencyResultResponse(Reader.GetFallbackTree(TEXT("ModifyUserVirtualCurrencyResult"), response));
+    }
+
+    FClientModifyUserVirtualCurrencyResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadString(tempStruct.VirtualCurrency);
+            break;
+        case FPlayFabJsonReader::Hash("BalanceChange"):
+            Reader.ReadInt(tempStruct.BalanceChange);
+            break;
+        case FPlayFabJsonReader::Hash("Balance"):
+            Reader.ReadInt(tempStruct.Balance);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeModifyUserVirtualCurrencyResultResponse(Reader.GetFallbackTree(TEXT("ModifyUserVirtualCurrencyResult"), response));
+    }
+    return tempStruct;
+}
+
 FClientConfirmPurchaseResult UPlayFabClientModelDecoder::decodeConfirmPurchaseResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientConfirmPurchaseResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.OrderId = !(dataObj->HasField("OrderId")) ? TEXT("") : dataObj->GetStringField("OrderId");
-    tempStruct.PurchaseDate = !(dataObj->HasField("PurchaseDate")) ? TEXT("") : dataObj->GetStringField("PurchaseDate");
-    tempStruct.Items = !(dataObj->HasField("Items")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Items");
+    tempStruct.OrderId = !(dataObj.HasField("OrderId")) ? TEXT("") : dataObj.GetStringField("OrderId");
+    tempStruct.PurchaseDate = !(dataObj.HasField("PurchaseDate")) ? TEXT("") : dataObj.GetStringField("PurchaseDate");
+    tempStruct.ItemsView = !(dataObj.HasField("Items")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Items");
 
     return tempStruct;
 }
 
+FClientConfirmPurchaseResult UPlayFabClientModelDecoder::readConfirmPurchaseResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeConfirmPurchaseResultResponse(Reader.GetFallbackTree(TEXT("ConfirmPurchaseResult"), response));
+    }
+
+    FClientConfirmPurchaseResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("OrderId"):
+            Reader.ReadString(tempStruct.OrderId);
+            break;
+        case FPlayFabJsonReader::Hash("PurchaseDate"):
+            Reader.ReadString(tempStruct.PurchaseDate);
+            break;
+        case FPlayFabJsonReader::Hash("Items"):
+            Reader.ReadObjectArray(tempStruct.ItemsView, TEXT("Items"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeConfirmPurchaseResultResponse(Reader.GetFallbackTree(TEXT("ConfirmPurchaseResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillConfirmPurchaseResultJsonObjects(FClientConfirmPurchaseResult& result)
+{
+    result.Items = FPlayFabJsonView::WrapJsonObjects(result.ItemsView);
+}
+
 FClientConsumeItemResult UPlayFabClientModelDecoder::decodeConsumeItemResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientConsumeItemResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.ItemInstanceId = !(dataObj->HasField("ItemInstanceId")) ? TEXT("") : dataObj->GetStringField("ItemInstanceId");
-    tempStruct.RemainingUses = !(dataObj->HasField("RemainingUses")) ? 0 : int(dataObj->GetNumberField("RemainingUses"));
+    tempStruct.ItemInstanceId = !(dataObj.HasField("ItemInstanceId")) ? TEXT("") : dataObj.GetStringField("ItemInstanceId");
+    tempStruct.RemainingUses = !(dataObj.HasField("RemainingUses")) ? 0 : int(dataObj.GetNumberField("RemainingUses"));
 
     return tempStruct;
 }
 
+FClientConsumeItemResult UPlayFabClientModelDecoder::readConsumeItemResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeConsumeItemResultResponse(Reader.GetFallbackTree(TEXT("ConsumeItemResult"), response));
+    }
+
+    FClientConsumeItemResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ItemInstanceId"):
+            Reader.ReadString(tempStruct.ItemInstanceId);
+            break;
+        case FPlayFabJsonReader::Hash("RemainingUses"):
+            Reader.ReadInt(tempStruct.RemainingUses);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeConsumeItemResultResponse(Reader.GetFallbackTree(TEXT("ConsumeItemResult"), response));
+    }
+    return tempStruct;
+}
+
 FClientGetCharacterInventoryResult UPlayFabClientModelDecoder::decodeGetCharacterInventoryResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetCharacterInventoryResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.CharacterId = !(dataObj.HasField("CharacterId")) ? TEXT("") : dataObj.GetStringField("CharacterId");
+    tempStruct.InventoryView = !(dataObj.HasField("Inventory")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Inventory");
+    tempStruct.VirtualCurrencyView = !(dataObj.HasField("VirtualCurrency")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrency");
+    tempStruct.VirtualCurrencyRechargeTimesView = !(dataObj.HasField("VirtualCurrencyRechargeTimes")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrencyRechargeTimes");
+
+    return tempStruct;
+}
 
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
-    tempStruct.Inventory = !(dataObj->HasField("Inventory")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Inventory");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.VirtualCurrencyRechargeTimes = !(dataObj->HasField("VirtualCurrencyRechargeTimes")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyRechargeTimes");
+FClientGetCharacterInventoryResult UPlayFabClientModelDecoder::readGetCharacterInventoryResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCharacterInventoryResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterInventoryResult"), response));
+    }
 
+    FClientGetCharacterInventoryResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("CharacterId"):
+            Reader.ReadString(tempStruct.CharacterId);
+            break;
+        case FPlayFabJsonReader::Hash("Inventory"):
+            Reader.ReadObjectArray(tempStruct.InventoryView, TEXT("Inventory"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyView, TEXT("VirtualCurrency"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrencyRechargeTimes"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyRechargeTimesView, TEXT("VirtualCurrencyRechargeTimes"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetCharacterInventoryResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterInventoryResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetCharacterInventoryResultJsonObjects(FClientGetCharacterInventoryResult& result)
+{
+    result.Inventory = FPlayFabJsonView::WrapJsonObjects(result.InventoryView);
+    result.VirtualCurrency = result.VirtualCurrencyView.WrapJsonObject();
+    result.VirtualCurrencyRechargeTimes = result.VirtualCurrencyRechargeTimesView.WrapJsonObject();
+}
+
 FClientGetPurchaseResult UPlayFabClientModelDecoder::decodeGetPurchaseResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPurchaseResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.OrderId = !(dataObj->HasField("OrderId")) ? TEXT("") : dataObj->GetStringField("OrderId");
-    tempStruct.PaymentProvider = !(dataObj->HasField("PaymentProvider")) ? TEXT("") : dataObj->GetStringField("PaymentProvider");
-    tempStruct.TransactionId = !(dataObj->HasField("TransactionId")) ? TEXT("") : dataObj->GetStringField("TransactionId");
-    tempStruct.TransactionStatus = !(dataObj->HasField("TransactionStatus")) ? TEXT("") : dataObj->GetStringField("TransactionStatus");
-    tempStruct.PurchaseDate = !(dataObj->HasField("PurchaseDate")) ? TEXT("") : dataObj->GetStringField("PurchaseDate");
+    tempStruct.OrderId = !(dataObj.HasField("OrderId")) ? TEXT("") : dataObj.GetStringField("OrderId");
+    tempStruct.PaymentProvider = !(dataObj.HasField("PaymentProvider")) ? TEXT("") : dataObj.GetStringField("PaymentProvider");
+    tempStruct.TransactionId = !(dataObj.HasField("TransactionId")) ? TEXT("") : dataObj.GetStringField("TransactionId");
+    tempStruct.TransactionStatus = !(dataObj.HasField("TransactionStatus")) ? TEXT("") : dataObj.GetStringField("TransactionStatus");
+    tempStruct.PurchaseDate = !(dataObj.HasField("PurchaseDate")) ? TEXT("") : dataObj.GetStringField("PurchaseDate");
 
     return tempStruct;
 }
 
+FClientGetPurchaseResult UPlayFabClientModelDecoder::readGetPurchaseResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPurchaseResultResponse(Reader.GetFallbackTree(TEXT("GetPurchaseResult"), response));
+    }
+
+    FClientGetPurchaseResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("OrderId"):
+            Reader.ReadString(tempStruct.OrderId);
+            break;
+        case FPlayFabJsonReader::Hash("PaymentProvider"):
+            Reader.ReadString(tempStruct.PaymentProvider);
+            break;
+        case FPlayFabJsonReader::Hash("TransactionId"):
+            Reader.ReadString(tempStruct.TransactionId);
+            break;
+        case FPlayFabJsonReader::Hash("TransactionStatus"):
+            Reader.ReadString(tempStruct.TransactionStatus);
+            break;
+        case FPlayFabJsonReader::Hash("PurchaseDate"):
+            Reader.ReadString(tempStruct.PurchaseDate);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPurchaseResultResponse(Reader.GetFallbackTree(TEXT("GetPurchaseResult"), response));
+    }
+    return tempStruct;
+}
+
 FClientGetUserInventoryResult UPlayFabClientModelDecoder::decodeGetUserInventoryResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetUserInventoryResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Inventory = !(dataObj->HasField("Inventory")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Inventory");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.VirtualCurrencyRechargeTimes = !(dataObj->HasField("VirtualCurrencyRechargeTimes")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyRechargeTimes");
+    tempStruct.InventoryView = !(dataObj.HasField("Inventory")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Inventory");
+    tempStruct.VirtualCurrencyView = !(dataObj.HasField("VirtualCurrency")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrency");
+    tempStruct.VirtualCurrencyRechargeTimesView = !(dataObj.HasField("VirtualCurrencyRechargeTimes")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrencyRechargeTimes");
 
     return tempStruct;
 }
 
+FClientGetUserInventoryResult UPlayFabClientModelDecoder::readGetUserInventoryResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetUserInventoryResultResponse(Reader.GetFallbackTree(TEXT("GetUserInventoryResult"), response));
+    }
+
+    FClientGetUserInventoryResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Inventory"):
+            Reader.ReadObjectArray(tempStruct.InventoryView, TEXT("Inventory"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyView, TEXT("VirtualCurrency"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrencyRechargeTimes"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyRechargeTimesView, TEXT("VirtualCurrencyRechargeTimes"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetUserInventoryResultResponse(Reader.GetFallbackTree(TEXT("GetUserInventoryResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetUserInventoryResultJsonObjects(FClientGetUserInventoryResult& result)
+{
+    result.Inventory = FPlayFabJsonView::WrapJsonObjects(result.InventoryView);
+    result.VirtualCurrency = result.VirtualCurrencyView.WrapJsonObject();
+    result.VirtualCurrencyRechargeTimes = result.VirtualCurrencyRechargeTimesView.WrapJsonObject();
+}
+
 FClientPayForPurchaseResult UPlayFabClientModelDecoder::decodePayForPurchaseResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientPayForPurchaseResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.OrderId = !(dataObj.HasField("OrderId")) ? TEXT("") : dataObj.GetStringField("OrderId");
+    GetEnumValueFromString<ETransactionStatus>(TEXT("ETransactionStatus"), dataObj.GetStringField("Status"), tempStruct.Status);
+    tempStruct.VCAmountView = !(dataObj.HasField("VCAmount")) ? FPlayFabJsonView() : dataObj.GetObjectField("VCAmount");
+    tempStruct.PurchaseCurrency = !(dataObj.HasField("PurchaseCurrency")) ? TEXT("") : dataObj.GetStringField("PurchaseCurrency");
+    tempStruct.PurchasePrice = !(dataObj.HasField("PurchasePrice")) ? 0 : int(dataObj.GetNumberField("PurchasePrice"));
+    tempStruct.CreditApplied = !(dataObj.HasField("CreditApplied")) ? 0 : int(dataObj.GetNumberField("CreditApplied"));
+    tempStruct.ProviderData = !(dataObj.HasField("ProviderData")) ? TEXT("") : dataObj.GetStringField("ProviderData");
+    tempStruct.PurchaseConfirmationPageURL = !(dataObj.HasField("PurchaseConfirmationPageURL")) ? TEXT("") : dataObj.GetStringField("PurchaseConfirmationPageURL");
+    tempStruct.VirtualCurrencyView = !(dataObj.HasField("VirtualCurrency")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrency");
+    tempStruct.ProviderToken = !(dataObj.HasField("ProviderToken")) ? TEXT("") : dataObj.GetStringField("ProviderToken");
+
+    return tempStruct;
+}
 
-    tempStruct.OrderId = !(dataObj->HasField("OrderId")) ? TEXT("") : dataObj->GetStringField("OrderId");
-    GetEnumValueFromString<ETransactionStatus>(TEXT("ETransactionStatus"), dataObj->GetStringField("Status"), tempStruct.Status);
-    tempStruct.VCAmount = !(dataObj->HasField("VCAmount")) ? nullptr : dataObj->GetObjectField("VCAmount");
-    tempStruct.PurchaseCurrency = !(dataObj->HasField("PurchaseCurrency")) ? TEXT("") : dataObj->GetStringField("PurchaseCurrency");
-    tempStruct.PurchasePrice = !(dataObj->HasField("PurchasePrice")) ? 0 : int(dataObj->GetNumberField("PurchasePrice"));
-    tempStruct.CreditApplied = !(dataObj->HasField("CreditApplied")) ? 0 : int(dataObj->GetNumberField("CreditApplied"));
-    tempStruct.ProviderData = !(dataObj->HasField("ProviderData")) ? TEXT("") : dataObj->GetStringField("ProviderData");
-    tempStruct.PurchaseConfirmationPageURL = !(dataObj->HasField("PurchaseConfirmationPageURL")) ? TEXT("") : dataObj->GetStringField("PurchaseConfirmationPageURL");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.ProviderToken = !(dataObj->HasField("ProviderToken")) ? TEXT("") : dataObj->GetStringField("ProviderToken");
+FClientPayForPurchaseResult UPlayFabClientModelDecoder::readPayForPurchaseResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodePayForPurchaseResultResponse(Reader.GetFallbackTree(TEXT("PayForPurchaseResult"), response));
+    }
 
+    FClientPayForPurchaseResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("OrderId"):
+            Reader.ReadString(tempStruct.OrderId);
+            break;
+        case FPlayFabJsonReader::Hash("Status"):
+            Reader.ReadEnum(tempStruct.Status);
+            break;
+        case FPlayFabJsonReader::Hash("VCAmount"):
+            Reader.ReadObject(tempStruct.VCAmountView, TEXT("VCAmount"));
+            break;
+        case FPlayFabJsonReader::Hash("PurchaseCurrency"):
+            Reader.ReadString(tempStruct.PurchaseCurrency);
+            break;
+        case FPlayFabJsonReader::Hash("PurchasePrice"):
+            Reader.ReadInt(tempStruct.PurchasePrice);
+            break;
+        case FPlayFabJsonReader::Hash("CreditApplied"):
+            Reader.ReadInt(tempStruct.CreditApplied);
+            break;
+        case FPlayFabJsonReader::Hash("ProviderData"):
+            Reader.ReadString(tempStruct.ProviderData);
+            break;
+        case FPlayFabJsonReader::Hash("PurchaseConfirmationPageURL"):
+            Reader.ReadString(tempStruct.PurchaseConfirmationPageURL);
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyView, TEXT("VirtualCurrency"));
+            break;
+        case FPlayFabJsonReader::Hash("ProviderToken"):
+            Reader.ReadString(tempStruct.ProviderToken);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodePayForPurchaseResultResponse(Reader.GetFallbackTree(TEXT("PayForPurchaseResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillPayForPurchaseResultJsonObjects(FClientPayForPurchaseResult& result)
+{
+    result.VCAmount = result.VCAmountView.WrapJsonObject();
+    result.VirtualCurrency = result.VirtualCurrencyView.WrapJsonObject();
+}
+
 FClientPurchaseItemResult UPlayFabClientModelDecoder::decodePurchaseItemResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientPurchaseItemResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Items = !(dataObj->HasField("Items")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Items");
+    tempStruct.ItemsView = !(dataObj.HasField("Items")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Items");
 
     return tempStruct;
 }
 
+FClientPurchaseItemResult UPlayFabClientModelDecoder::readPurchaseItemResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodePurchaseItemResultResponse(Reader.GetFallbackTree(TEXT("PurchaseItemResult"), response));
+    }
+
+    FClientPurchaseItemResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Items"):
+            Reader.ReadObjectArray(tempStruct.ItemsView, TEXT("Items"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodePurchaseItemResultResponse(Reader.GetFallbackTree(TEXT("PurchaseItemResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillPurchaseItemResultJsonObjects(FClientPurchaseItemResult& result)
+{
+    result.Items = FPlayFabJsonView::WrapJsonObjects(result.ItemsView);
+}
+
 FClientRedeemCouponResult UPlayFabClientModelDecoder::decodeRedeemCouponResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientRedeemCouponResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.GrantedItemsView = !(dataObj.HasField("GrantedItems")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("GrantedItems");
 
-    tempStruct.GrantedItems = !(dataObj->HasField("GrantedItems")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GrantedItems");
+    return tempStruct;
+}
+
+FClientRedeemCouponResult UPlayFabClientModelDecoder::readRedeemCouponResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeRedeemCouponResultResponse(Reader.GetFallbackTree(TEXT("RedeemCouponResult"), response));
+    }
 
+    FClientRedeemCouponResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("GrantedItems"):
+            Reader.ReadObjectArray(tempStruct.GrantedItemsView, TEXT("GrantedItems"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeRedeemCouponResultResponse(Reader.GetFallbackTree(TEXT("RedeemCouponResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillRedeemCouponResultJsonObjects(FClientRedeemCouponResult& result)
+{
+    result.GrantedItems = FPlayFabJsonView::WrapJsonObjects(result.GrantedItemsView);
+}
+
 FClientStartPurchaseResult UPlayFabClientModelDecoder::decodeStartPurchaseResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientStartPurchaseResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.OrderId = !(dataObj.HasField("OrderId")) ? TEXT("") : dataObj.GetStringField("OrderId");
+    tempStruct.ContentsView = !(dataObj.HasField("Contents")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Contents");
+    tempStruct.PaymentOptionsView = !(dataObj.HasField("PaymentOptions")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("PaymentOptions");
+    tempStruct.VirtualCurrencyBalancesView = !(dataObj.HasField("VirtualCurrencyBalances")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrencyBalances");
+
+    return tempStruct;
+}
+
+FClientStartPurchaseResult UPlayFabClientModelDecoder::readStartPurchaseResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeStartPurchaseResultResponse(Reader.GetFallbackTree(TEXT("StartPurchaseResult"), response));
+    }
+
+    FClientStartPurchaseResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("OrderId"):
+            Reader.ReadString(tempStruct.OrderId);
+            break;
+        case FPlayFabJsonReader::Hash("Contents"):
+            Reader.ReadObjectArray(tempStruct.ContentsView, TEXT("Contents"));
+            break;
+        case FPlayFabJsonReader::Hash("PaymentOptions"):
+            Reader.ReadObjectArray(tempStruct.PaymentOptionsView, TEXT("PaymentOptions"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrencyBalances"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyBalancesView, TEXT("VirtualCurrencyBalances"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeStartPurchaseResultResponse(Reader.GetFallbackTree(TEXT("StartPurchaseResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillStartPurchaseResultJsonObjects(FClientStartPurchaseResult& result)
+{
+    result.Contents = FPlayFabJsonView::WrapJsonObjects(result.ContentsView);
+    result.PaymentOptions = FPlayFabJsonView::WrapJsonObjects(result.PaymentOptionsView);
+    result.VirtualCurrencyBalances = result.VirtualCurrencyBalancesView.WrapJsonObject();
+}
+
+FClientUnlockContainerItemResult UPlayFabClientModelDecoder::decodeUnlockContainerItemResultResponse(UPlayFabJsonObject* response)
+{
+    // Temp ustruct
+    FClientUnlockContainerItemResult tempStruct;
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.OrderId = !(dataObj->HasField("OrderId")) ? TEXT("") : dataObj->GetStringField("OrderId");
-    tempStruct.Contents = !(dataObj->HasField("Contents")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Contents");
-    tempStruct.PaymentOptions = !(dataObj->HasField("PaymentOptions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("PaymentOptions");
-    tempStruct.VirtualCurrencyBalances = !(dataObj->HasField("VirtualCurrencyBalances")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyBalances");
+    tempStruct.UnlockedItemInstanceId = !(dataObj.HasField("UnlockedItemInstanceId")) ? TEXT("") : dataObj.GetStringField("UnlockedItemInstanceId");
+    tempStruct.UnlockedWithItemInstanceId = !(dataObj.HasField("UnlockedWithItemInstanceId")) ? TEXT("") : dataObj.GetStringField("UnlockedWithItemInstanceId");
+    tempStruct.GrantedItemsView = !(dataObj.HasField("GrantedItems")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("GrantedItems");
+    tempStruct.VirtualCurrencyView = !(dataObj.HasField("VirtualCurrency")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrency");
 
     return tempStruct;
 }
 
-FClientUnlockContainerItemResult UPlayFabClientModelDecoder::decodeUnlockContainerItemResultResponse(UPlayFabJsonObject* response)
+FClientUnlockContainerItemResult UPlayFabClientModelDecoder::readUnlockContainerItemResultResponse(const FPlayFabBaseModel& response)
 {
-    // Temp ustruct
-    FClientUnlockContainerItemResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
-
-    tempStruct.UnlockedItemInstanceId = !(dataObj->HasField("UnlockedItemInstanceId")) ? TEXT("") : dataObj->GetStringField("UnlockedItemInstanceId");
-    tempStruct.UnlockedWithItemInstanceId = !(dataObj->HasField("UnlockedWithItemInstanceId")) ? TEXT("") : dataObj->GetStringField("UnlockedWithItemInstanceId");
-    tempStruct.GrantedItems = !(dataObj->HasField("GrantedItems")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GrantedItems");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUnlockContainerItemResultResponse(Reader.GetFallbackTree(TEXT("UnlockContainerItemResult"), response));
+    }
 
+    FClientUnlockContainerItemResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("UnlockedItemInstanceId"):
+            Reader.ReadString(tempStruct.UnlockedItemInstanceId);
+            break;
+        case FPlayFabJsonReader::Hash("UnlockedWithItemInstanceId"):
+            Reader.ReadString(tempStruct.UnlockedWithItemInstanceId);
+            break;
+        case FPlayFabJsonReader::Hash("GrantedItems"):
+            Reader.ReadObjectArray(tempStruct.GrantedItemsView, TEXT("GrantedItems"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyView, TEXT("VirtualCurrency"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeUnlockContainerItemResultResponse(Reader.GetFallbackTree(TEXT("UnlockContainerItemResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillUnlockContainerItemResultJsonObjects(FClientUnlockContainerItemResult& result)
+{
+    result.GrantedItems = FPlayFabJsonView::WrapJsonObjects(result.GrantedItemsView);
+    result.VirtualCurrency = result.VirtualCurrencyView.WrapJsonObject();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -797,24 +2574,91 @@ FClientAddFriendResult UPlayFabClientModelDecoder::decodeAddFriendResultResponse
 {
     // Temp ustruct
     FClientAddFriendResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Created = !(dataObj->HasField("Created")) ? false : dataObj->GetBoolField("Created");
+    tempStruct.Created = !(dataObj.HasField("Created")) ? false : dataObj.GetBoolField("Created");
 
     return tempStruct;
 }
 
+FClientAddFriendResult UPlayFabClientModelDecoder::readAddFriendResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeAddFriendResultResponse(Reader.GetFallbackTree(TEXT("AddFriendResult"), response));
+    }
+
+    FClientAddFriendResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Created"):
+            Reader.ReadBool(tempStruct.Created);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeAddFriendResultResponse(Reader.GetFallbackTree(TEXT("AddFriendResult"), response));
+    }
+    return tempStruct;
+}
+
 FClientGetFriendsListResult UPlayFabClientModelDecoder::decodeGetFriendsListResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetFriendsListResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.FriendsView = !(dataObj.HasField("Friends")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Friends");
+
+    return tempStruct;
+}
 
-    tempStruct.Friends = !(dataObj->HasField("Friends")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Friends");
+FClientGetFriendsListResult UPlayFabClientModelDecoder::readGetFriendsListResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetFriendsListResultResponse(Reader.GetFallbackTree(TEXT("GetFriendsListResult"), response));
+    }
 
+    FClientGetFriendsListResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Friends"):
+            Reader.ReadObjectArray(tempStruct.FriendsView, TEXT("Friends"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetFriendsListResultResponse(Reader.GetFallbackTree(TEXT("GetFriendsListResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetFriendsListResultJsonObjects(FClientGetFriendsListResult& result)
+{
+    result.Friends = FPlayFabJsonView::WrapJsonObjects(result.FriendsView);
+}
+
 FClientRemoveFriendResult UPlayFabClientModelDecoder::decodeRemoveFriendResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -824,6 +2668,12 @@ FClientRemoveFriendResult UPlayFabClientModelDecoder::decodeRemoveFriendResultRe
     return tempStruct;
 }
 
+FClientRemoveFriendResult UPlayFabClientModelDecoder::readRemoveFriendResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientRemoveFriendResult();
+}
+
 FClientSetFriendTagsResult UPlayFabClientModelDecoder::decodeSetFriendTagsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -833,6 +2683,12 @@ FClientSetFriendTagsResult UPlayFabClientModelDecoder::decodeSetFriendTagsResult
     return tempStruct;
 }
 
+FClientSetFriendTagsResult UPlayFabClientModelDecoder::readSetFriendTagsResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientSetFriendTagsResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -843,40 +2699,167 @@ FClientCurrentGamesResult UPlayFabClientModelDecoder::decodeCurrentGamesResultRe
 {
     // Temp ustruct
     FClientCurrentGamesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.GamesView = !(dataObj.HasField("Games")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Games");
+    tempStruct.PlayerCount = !(dataObj.HasField("PlayerCount")) ? 0 : int(dataObj.GetNumberField("PlayerCount"));
+    tempStruct.GameCount = !(dataObj.HasField("GameCount")) ? 0 : int(dataObj.GetNumberField("GameCount"));
+
+    return tempStruct;
+}
 
-    tempStruct.Games = !(dataObj->HasField("Games")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Games");
-    tempStruct.PlayerCount = !(dataObj->HasField("PlayerCount")) ? 0 : int(dataObj->GetNumberField("PlayerCount"));
-    tempStruct.GameCount = !(dataObj->HasField("GameCount")) ? 0 : int(dataObj->GetNumberField("GameCount"));
+FClientCurrentGamesResult UPlayFabClientModelDecoder::readCurrentGamesResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeCurrentGamesResultResponse(Reader.GetFallbackTree(TEXT("CurrentGamesResult"), response));
+    }
 
+    FClientCurrentGamesResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Games"):
+            Reader.ReadObjectArray(tempStruct.GamesView, TEXT("Games"));
+            break;
+        case FPlayFabJsonReader::Hash("PlayerCount"):
+            Reader.ReadInt(tempStruct.PlayerCount);
+            break;
+        case FPlayFabJsonReader::Hash("GameCount"):
+            Reader.ReadInt(tempStruct.GameCount);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeCurrentGamesResultResponse(Reader.GetFallbackTree(TEXT("CurrentGamesResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillCurrentGamesResultJsonObjects(FClientCurrentGamesResult& result)
+{
+    result.Games = FPlayFabJsonView::WrapJsonObjects(result.GamesView);
+}
+
 FClientGameServerRegionsResult UPlayFabClientModelDecoder::decodeGameServerRegionsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGameServerRegionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.RegionsView = !(dataObj.HasField("Regions")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Regions");
+
+    return tempStruct;
+}
 
-    tempStruct.Regions = !(dataObj->HasField("Regions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Regions");
+FClientGameServerRegionsResult UPlayFabClientModelDecoder::readGameServerRegionsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGameServerRegionsResultResponse(Reader.GetFallbackTree(TEXT("GameServerRegionsResult"), response));
+    }
 
+    FClientGameServerRegionsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Regions"):
+            Reader.ReadObjectArray(tempStruct.RegionsView, TEXT("Regions"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGameServerRegionsResultResponse(Reader.GetFallbackTree(TEXT("GameServerRegionsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGameServerRegionsResultJsonObjects(FClientGameServerRegionsResult& result)
+{
+    result.Regions = FPlayFabJsonView::WrapJsonObjects(result.RegionsView);
+}
+
 FClientMatchmakeResult UPlayFabClientModelDecoder::decodeMatchmakeResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientMatchmakeResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.LobbyID = !(dataObj.HasField("LobbyID")) ? TEXT("") : dataObj.GetStringField("LobbyID");
+    tempStruct.ServerHostname = !(dataObj.HasField("ServerHostname")) ? TEXT("") : dataObj.GetStringField("ServerHostname");
+    tempStruct.ServerPort = !(dataObj.HasField("ServerPort")) ? 0 : int(dataObj.GetNumberField("ServerPort"));
+    tempStruct.Ticket = !(dataObj.HasField("Ticket")) ? TEXT("") : dataObj.GetStringField("Ticket");
+    tempStruct.Expires = !(dataObj.HasField("Expires")) ? TEXT("") : dataObj.GetStringField("Expires");
+    tempStruct.PollWaitTimeMS = !(dataObj.HasField("PollWaitTimeMS")) ? 0 : int(dataObj.GetNumberField("PollWaitTimeMS"));
+    GetEnumValueFromString<EMatchmakeStatus>(TEXT("EMatchmakeStatus"), dataObj.GetStringField("Status"), tempStruct.Status);
 
-    tempStruct.LobbyID = !(dataObj->HasField("LobbyID")) ? TEXT("") : dataObj->GetStringField("LobbyID");
-    tempStruct.ServerHostname = !(dataObj->HasField("ServerHostname")) ? TEXT("") : dataObj->GetStringField("ServerHostname");
-    tempStruct.ServerPort = !(dataObj->HasField("ServerPort")) ? 0 : int(dataObj->GetNumberField("ServerPort"));
-    tempStruct.Ticket = !(dataObj->HasField("Ticket")) ? TEXT("") : dataObj->GetStringField("Ticket");
-    tempStruct.Expires = !(dataObj->HasField("Expires")) ? TEXT("") : dataObj->GetStringField("Expires");
-    tempStruct.PollWaitTimeMS = !(dataObj->HasField("PollWaitTimeMS")) ? 0 : int(dataObj->GetNumberField("PollWaitTimeMS"));
-    GetEnumValueFromString<EMatchmakeStatus>(TEXT("EMatchmakeStatus"), dataObj->GetStringField("Status"), tempStruct.Status);
+    return tempStruct;
+}
+
+FClientMatchmakeResult UPlayFabClientModelDecoder::readMatchmakeResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeMatchmakeResultResponse(Reader.GetFallbackTree(TEXT("MatchmakeResult"), response));
+    }
 
+    FClientMatchmakeResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("LobbyID"):
+            Reader.ReadString(tempStruct.LobbyID);
+            break;
+        case FPlayFabJsonReader::Hash("ServerHostname"):
+            Reader.ReadString(tempStruct.ServerHostname);
+            break;
+        case FPlayFabJsonReader::Hash("ServerPort"):
+            Reader.ReadInt(tempStruct.ServerPort);
+            break;
+        case FPlayFabJsonReader::Hash("Ticket"):
+            Reader.ReadString(tempStruct.Ticket);
+            break;
+        case FPlayFabJsonReader::Hash("Expires"):
+            Reader.ReadString(tempStruct.Expires);
+            break;
+        case FPlayFabJsonReader::Hash("PollWaitTimeMS"):
+            Reader.ReadInt(tempStruct.PollWaitTimeMS);
+            break;
+        case FPlayFabJsonReader::Hash("Status"):
+            Reader.ReadEnum(tempStruct.Status);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeMatchmakeResultResponse(Reader.GetFallbackTree(TEXT("MatchmakeResult"), response));
+    }
     return tempStruct;
 }
 
@@ -884,15 +2867,61 @@ FClientStartGameResult UPlayFabClientModelDecoder::decodeStartGameResultResponse
 {
     // Temp ustruct
     FClientStartGameResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.LobbyID = !(dataObj.HasField("LobbyID")) ? TEXT("") : dataObj.GetStringField("LobbyID");
+    tempStruct.ServerHostname = !(dataObj.HasField("ServerHostname")) ? TEXT("") : dataObj.GetStringField("ServerHostname");
+    tempStruct.ServerPort = !(dataObj.HasField("ServerPort")) ? 0 : int(dataObj.GetNumberField("ServerPort"));
+    tempStruct.Ticket = !(dataObj.HasField("Ticket")) ? TEXT("") : dataObj.GetStringField("Ticket");
+    tempStruct.Expires = !(dataObj.HasField("Expires")) ? TEXT("") : dataObj.GetStringField("Expires");
+    tempStruct.Password = !(dataObj.HasField("Password")) ? TEXT("") : dataObj.GetStringField("Password");
+
+    return tempStruct;
+}
 
-    tempStruct.LobbyID = !(dataObj->HasField("LobbyID")) ? TEXT("") : dataObj->GetStringField("LobbyID");
-    tempStruct.ServerHostname = !(dataObj->HasField("ServerHostname")) ? TEXT("") : dataObj->GetStringField("ServerHostname");
-    tempStruct.ServerPort = !(dataObj->HasField("ServerPort")) ? 0 : int(dataObj->GetNumberField("ServerPort"));
-    tempStruct.Ticket = !(dataObj->HasField("Ticket")) ? TEXT("") : dataObj->GetStringField("Ticket");
-    tempStruct.Expires = !(dataObj->HasField("Expires")) ? TEXT("") : dataObj->GetStringField("Expires");
-    tempStruct.Password = !(dataObj->HasField("Password")) ? TEXT("") : dataObj->GetStringField("Password");
+FClientStartGameResult UPlayFabClientModelDecoder::readStartGameResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeStartGameResultResponse(Reader.GetFallbackTree(TEXT("StartGameResult"), response));
+    }
 
+    FClientStartGameResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("LobbyID"):
+            Reader.ReadString(tempStruct.LobbyID);
+            break;
+        case FPlayFabJsonReader::Hash("ServerHostname"):
+            Reader.ReadString(tempStruct.ServerHostname);
+            break;
+        case FPlayFabJsonReader::Hash("ServerPort"):
+            Reader.ReadInt(tempStruct.ServerPort);
+            break;
+        case FPlayFabJsonReader::Hash("Ticket"):
+            Reader.ReadString(tempStruct.Ticket);
+            break;
+        case FPlayFabJsonReader::Hash("Expires"):
+            Reader.ReadString(tempStruct.Expires);
+            break;
+        case FPlayFabJsonReader::Hash("Password"):
+            Reader.ReadString(tempStruct.Password);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeStartGameResultResponse(Reader.GetFallbackTree(TEXT("StartGameResult"), response));
+    }
     return tempStruct;
 }
 
@@ -906,10 +2935,41 @@ FClientWriteEventResponse UPlayFabClientModelDecoder::decodeWriteEventResponseRe
 {
     // Temp ustruct
     FClientWriteEventResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.EventId = !(dataObj.HasField("EventId")) ? TEXT("") : dataObj.GetStringField("EventId");
 
-    tempStruct.EventId = !(dataObj->HasField("EventId")) ? TEXT("") : dataObj->GetStringField("EventId");
+    return tempStruct;
+}
+
+FClientWriteEventResponse UPlayFabClientModelDecoder::readWriteEventResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeWriteEventResponseResponse(Reader.GetFallbackTree(TEXT("WriteEventResponse"), response));
+    }
 
+    FClientWriteEventResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("EventId"):
+            Reader.ReadString(tempStruct.EventId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeWriteEventResponseResponse(Reader.GetFallbackTree(TEXT("WriteEventResponse"), response));
+    }
     return tempStruct;
 }
 
@@ -928,14 +2988,51 @@ FClientAddSharedGroupMembersResult UPlayFabClientModelDecoder::decodeAddSharedGr
     return tempStruct;
 }
 
+FClientAddSharedGroupMembersResult UPlayFabClientModelDecoder::readAddSharedGroupMembersResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientAddSharedGroupMembersResult();
+}
+
 FClientCreateSharedGroupResult UPlayFabClientModelDecoder::decodeCreateSharedGroupResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientCreateSharedGroupResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.SharedGroupId = !(dataObj.HasField("SharedGroupId")) ? TEXT("") : dataObj.GetStringField("SharedGroupId");
+
+    return tempStruct;
+}
 
-    tempStruct.SharedGroupId = !(dataObj->HasField("SharedGroupId")) ? TEXT("") : dataObj->GetStringField("SharedGroupId");
+FClientCreateSharedGroupResult UPlayFabClientModelDecoder::readCreateSharedGroupResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeCreateSharedGroupResultResponse(Reader.GetFallbackTree(TEXT("CreateSharedGroupResult"), response));
+    }
 
+    FClientCreateSharedGroupResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("SharedGroupId"):
+            Reader.ReadString(tempStruct.SharedGroupId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeCreateSharedGroupResultResponse(Reader.GetFallbackTree(TEXT("CreateSharedGroupResult"), response));
+    }
     return tempStruct;
 }
 
@@ -943,14 +3040,53 @@ FClientGetSharedGroupDataResult UPlayFabClientModelDecoder::decodeGetSharedGroup
 {
     // Temp ustruct
     FClientGetSharedGroupDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
+    tempStruct.Members = !(dataObj.HasField("Members")) ? TEXT("") : FString::Join(dataObj.GetStringArrayField("Members"), TEXT(","));
+
+    return tempStruct;
+}
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
-    tempStruct.Members = !(dataObj->HasField("Members")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Members"), TEXT(","));
+FClientGetSharedGroupDataResult UPlayFabClientModelDecoder::readGetSharedGroupDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetSharedGroupDataResultResponse(Reader.GetFallbackTree(TEXT("GetSharedGroupDataResult"), response));
+    }
 
+    FClientGetSharedGroupDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        case FPlayFabJsonReader::Hash("Members"):
+            Reader.ReadStringList(tempStruct.Members);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetSharedGroupDataResultResponse(Reader.GetFallbackTree(TEXT("GetSharedGroupDataResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetSharedGroupDataResultJsonObjects(FClientGetSharedGroupDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
+}
+
 FClientRemoveSharedGroupMembersResult UPlayFabClientModelDecoder::decodeRemoveSharedGroupMembersResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -960,6 +3096,12 @@ FClientRemoveSharedGroupMembersResult UPlayFabClientModelDecoder::decodeRemoveSh
     return tempStruct;
 }
 
+FClientRemoveSharedGroupMembersResult UPlayFabClientModelDecoder::readRemoveSharedGroupMembersResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientRemoveSharedGroupMembersResult();
+}
+
 FClientUpdateSharedGroupDataResult UPlayFabClientModelDecoder::decodeUpdateSharedGroupDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -969,6 +3111,12 @@ FClientUpdateSharedGroupDataResult UPlayFabClientModelDecoder::decodeUpdateShare
     return tempStruct;
 }
 
+FClientUpdateSharedGroupDataResult UPlayFabClientModelDecoder::readUpdateSharedGroupDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUpdateSharedGroupDataResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -979,24 +3127,95 @@ FClientExecuteCloudScriptResult UPlayFabClientModelDecoder::decodeExecuteCloudSc
 {
     // Temp ustruct
     FClientExecuteCloudScriptResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.FunctionName = !(dataObj.HasField("FunctionName")) ? TEXT("") : dataObj.GetStringField("FunctionName");
+    tempStruct.Revision = !(dataObj.HasField("Revision")) ? 0 : int(dataObj.GetNumberField("Revision"));
+    tempStruct.FunctionResultView = !(dataObj.HasField("FunctionResult")) ? FPlayFabJsonView() : dataObj.GetObjectField("FunctionResult");
+    tempStruct.FunctionResultTooLarge = !(dataObj.HasField("FunctionResultTooLarge")) ? false : dataObj.GetBoolField("FunctionResultTooLarge");
+    tempStruct.LogsView = !(dataObj.HasField("Logs")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Logs");
+    tempStruct.LogsTooLarge = !(dataObj.HasField("LogsTooLarge")) ? false : dataObj.GetBoolField("LogsTooLarge");
+    tempStruct.ExecutionTimeSeconds = !(dataObj.HasField("ExecutionTimeSeconds")) ? 0 : int(dataObj.GetNumberField("ExecutionTimeSeconds"));
+    tempStruct.ProcessorTimeSeconds = !(dataObj.HasField("ProcessorTimeSeconds")) ? 0 : int(dataObj.GetNumberField("ProcessorTimeSeconds"));
+    tempStruct.MemoryConsumedBytes = !(dataObj.HasField("MemoryConsumedBytes")) ? 0 : int(dataObj.GetNumberField("MemoryConsumedBytes"));
+    tempStruct.APIRequestsIssued = !(dataObj.HasField("APIRequestsIssued")) ? 0 : int(dataObj.GetNumberField("APIRequestsIssued"));
+    tempStruct.HttpRequestsIssued = !(dataObj.HasField("HttpRequestsIssued")) ? 0 : int(dataObj.GetNumberField("HttpRequestsIssued"));
+    tempStruct.ErrorView = !(dataObj.HasField("Error")) ? FPlayFabJsonView() : dataObj.GetObjectField("Error");
+
+    return tempStruct;
+}
 
-    tempStruct.FunctionName = !(dataObj->HasField("FunctionName")) ? TEXT("") : dataObj->GetStringField("FunctionName");
-    tempStruct.Revision = !(dataObj->HasField("Revision")) ? 0 : int(dataObj->GetNumberField("Revision"));
-    tempStruct.FunctionResult = !(dataObj->HasField("FunctionResult")) ? nullptr : dataObj->GetObjectField("FunctionResult");
-    tempStruct.FunctionResultTooLarge = !(dataObj->HasField("FunctionResultTooLarge")) ? false : dataObj->GetBoolField("FunctionResultTooLarge");
-    tempStruct.Logs = !(dataObj->HasField("Logs")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Logs");
-    tempStruct.LogsTooLarge = !(dataObj->HasField("LogsTooLarge")) ? false : dataObj->GetBoolField("LogsTooLarge");
-    tempStruct.ExecutionTimeSeconds = !(dataObj->HasField("ExecutionTimeSeconds")) ? 0 : int(dataObj->GetNumberField("ExecutionTimeSeconds"));
-    tempStruct.ProcessorTimeSeconds = !(dataObj->HasField("ProcessorTimeSeconds")) ? 0 : int(dataObj->GetNumberField("ProcessorTimeSeconds"));
-    tempStruct.MemoryConsumedBytes = !(dataObj->HasField("MemoryConsumedBytes")) ? 0 : int(dataObj->GetNumberField("MemoryConsumedBytes"));
-    tempStruct.APIRequestsIssued = !(dataObj->HasField("APIRequestsIssued")) ? 0 : int(dataObj->GetNumberField("APIRequestsIssued"));
-    tempStruct.HttpRequestsIssued = !(dataObj->HasField("HttpRequestsIssued")) ? 0 : int(dataObj->GetNumberField("HttpRequestsIssued"));
-    tempStruct.Error = !(dataObj->HasField("Error")) ? nullptr : dataObj->GetObjectField("Error");
+FClientExecuteCloudScriptResult UPlayFabClientModelDecoder::readExecuteCloudScriptResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeExecuteCloudScriptResultResponse(Reader.GetFallbackTree(TEXT("ExecuteCloudScriptResult"), response));
+    }
 
+    FClientExecuteCloudScriptResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("FunctionName"):
+            Reader.ReadString(tempStruct.FunctionName);
+            break;
+        case FPlayFabJsonReader::Hash("Revision"):
+            Reader.ReadInt(tempStruct.Revision);
+            break;
+        case FPlayFabJsonReader::Hash("FunctionResult"):
+            Reader.ReadObject(tempStruct.FunctionResultView, TEXT("FunctionResult"));
+            break;
+        case FPlayFabJsonReader::Hash("FunctionResultTooLarge"):
+            Reader.ReadBool(tempStruct.FunctionResultTooLarge);
+            break;
+        case FPlayFabJsonReader::Hash("Logs"):
+            Reader.ReadObjectArray(tempStruct.LogsView, TEXT("Logs"));
+            break;
+        case FPlayFabJsonReader::Hash("LogsTooLarge"):
+            Reader.ReadBool(tempStruct.LogsTooLarge);
+            break;
+        case FPlayFabJsonReader::Hash("ExecutionTimeSeconds"):
+            Reader.ReadInt(tempStruct.ExecutionTimeSeconds);
+            break;
+        case FPlayFabJsonReader::Hash("ProcessorTimeSeconds"):
+            Reader.ReadInt(tempStruct.ProcessorTimeSeconds);
+            break;
+        case FPlayFabJsonReader::Hash("MemoryConsumedBytes"):
+            Reader.ReadInt(tempStruct.MemoryConsumedBytes);
+            break;
+        case FPlayFabJsonReader::Hash("APIRequestsIssued"):
+            Reader.ReadInt(tempStruct.APIRequestsIssued);
+            break;
+        case FPlayFabJsonReader::Hash("HttpRequestsIssued"):
+            Reader.ReadInt(tempStruct.HttpRequestsIssued);
+            break;
+        case FPlayFabJsonReader::Hash("Error"):
+            Reader.ReadObject(tempStruct.ErrorView, TEXT("Error"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeExecuteCloudScriptResultResponse(Reader.GetFallbackTree(TEXT("ExecuteCloudScriptResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillExecuteCloudScriptResultJsonObjects(FClientExecuteCloudScriptResult& result)
+{
+    result.FunctionResult = result.FunctionResultView.WrapJsonObject();
+    result.Logs = FPlayFabJsonView::WrapJsonObjects(result.LogsView);
+    result.Error = result.ErrorView.WrapJsonObject();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -1007,10 +3226,41 @@ FClientGetContentDownloadUrlResult UPlayFabClientModelDecoder::decodeGetContentD
 {
     // Temp ustruct
     FClientGetContentDownloadUrlResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.URL = !(dataObj.HasField("URL")) ? TEXT("") : dataObj.GetStringField("URL");
+
+    return tempStruct;
+}
 
-    tempStruct.URL = !(dataObj->HasField("URL")) ? TEXT("") : dataObj->GetStringField("URL");
+FClientGetContentDownloadUrlResult UPlayFabClientModelDecoder::readGetContentDownloadUrlResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetContentDownloadUrlResultResponse(Reader.GetFallbackTree(TEXT("GetContentDownloadUrlResult"), response));
+    }
 
+    FClientGetContentDownloadUrlResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("URL"):
+            Reader.ReadString(tempStruct.URL);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetContentDownloadUrlResultResponse(Reader.GetFallbackTree(TEXT("GetContentDownloadUrlResult"), response));
+    }
     return tempStruct;
 }
 
@@ -1024,67 +3274,284 @@ FClientListUsersCharactersResult UPlayFabClientModelDecoder::decodeListUsersChar
 {
     // Temp ustruct
     FClientListUsersCharactersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.CharactersView = !(dataObj.HasField("Characters")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Characters");
 
-    tempStruct.Characters = !(dataObj->HasField("Characters")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Characters");
+    return tempStruct;
+}
+
+FClientListUsersCharactersResult UPlayFabClientModelDecoder::readListUsersCharactersResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeListUsersCharactersResultResponse(Reader.GetFallbackTree(TEXT("ListUsersCharactersResult"), response));
+    }
 
+    FClientListUsersCharactersResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Characters"):
+            Reader.ReadObjectArray(tempStruct.CharactersView, TEXT("Characters"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeListUsersCharactersResultResponse(Reader.GetFallbackTree(TEXT("ListUsersCharactersResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillListUsersCharactersResultJsonObjects(FClientListUsersCharactersResult& result)
+{
+    result.Characters = FPlayFabJsonView::WrapJsonObjects(result.CharactersView);
+}
+
 FClientGetCharacterLeaderboardResult UPlayFabClientModelDecoder::decodeGetCharacterLeaderboardResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetCharacterLeaderboardResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
+    tempStruct.LeaderboardView = !(dataObj.HasField("Leaderboard")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Leaderboard");
 
     return tempStruct;
 }
 
+FClientGetCharacterLeaderboardResult UPlayFabClientModelDecoder::readGetCharacterLeaderboardResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCharacterLeaderboardResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterLeaderboardResult"), response));
+    }
+
+    FClientGetCharacterLeaderboardResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Leaderboard"):
+            Reader.ReadObjectArray(tempStruct.LeaderboardView, TEXT("Leaderboard"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetCharacterLeaderboardResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterLeaderboardResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillGetCharacterLeaderboardResultJsonObjects(FClientGetCharacterLeaderboardResult& result)
+{
+    result.Leaderboard = FPlayFabJsonView::WrapJsonObjects(result.LeaderboardView);
+}
+
 FClientGetCharacterStatisticsResult UPlayFabClientModelDecoder::decodeGetCharacterStatisticsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetCharacterStatisticsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.CharacterStatisticsView = !(dataObj.HasField("CharacterStatistics")) ? FPlayFabJsonView() : dataObj.GetObjectField("CharacterStatistics");
+
+    return tempStruct;
+}
 
-    tempStruct.CharacterStatistics = !(dataObj->HasField("CharacterStatistics")) ? nullptr : dataObj->GetObjectField("CharacterStatistics");
+FClientGetCharacterStatisticsResult UPlayFabClientModelDecoder::readGetCharacterStatisticsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCharacterStatisticsResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterStatisticsResult"), response));
+    }
 
+    FClientGetCharacterStatisticsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("CharacterStatistics"):
+            Reader.ReadObject(tempStruct.CharacterStatisticsView, TEXT("CharacterStatistics"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetCharacterStatisticsResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterStatisticsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetCharacterStatisticsResultJsonObjects(FClientGetCharacterStatisticsResult& result)
+{
+    result.CharacterStatistics = result.CharacterStatisticsView.WrapJsonObject();
+}
+
 FClientGetLeaderboardAroundCharacterResult UPlayFabClientModelDecoder::decodeGetLeaderboardAroundCharacterResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetLeaderboardAroundCharacterResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.LeaderboardView = !(dataObj.HasField("Leaderboard")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Leaderboard");
+
+    return tempStruct;
+}
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
+FClientGetLeaderboardAroundCharacterResult UPlayFabClientModelDecoder::readGetLeaderboardAroundCharacterResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetLeaderboardAroundCharacterResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardAroundCharacterResult"), response));
+    }
 
+    FClientGetLeaderboardAroundCharacterResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Leaderboard"):
+            Reader.ReadObjectArray(tempStruct.LeaderboardView, TEXT("Leaderboard"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetLeaderboardAroundCharacterResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardAroundCharacterResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetLeaderboardAroundCharacterResultJsonObjects(FClientGetLeaderboardAroundCharacterResult& result)
+{
+    result.Leaderboard = FPlayFabJsonView::WrapJsonObjects(result.LeaderboardView);
+}
+
 FClientGetLeaderboardForUsersCharactersResult UPlayFabClientModelDecoder::decodeGetLeaderboardForUsersCharactersResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetLeaderboardForUsersCharactersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.LeaderboardView = !(dataObj.HasField("Leaderboard")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Leaderboard");
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
+    return tempStruct;
+}
+
+FClientGetLeaderboardForUsersCharactersResult UPlayFabClientModelDecoder::readGetLeaderboardForUsersCharactersResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetLeaderboardForUsersCharactersResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardForUsersCharactersResult"), response));
+    }
 
+    FClientGetLeaderboardForUsersCharactersResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Leaderboard"):
+            Reader.ReadObjectArray(tempStruct.LeaderboardView, TEXT("Leaderboard"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetLeaderboardForUsersCharactersResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardForUsersCharactersResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetLeaderboardForUsersCharactersResultJsonObjects(FClientGetLeaderboardForUsersCharactersResult& result)
+{
+    result.Leaderboard = FPlayFabJsonView::WrapJsonObjects(result.LeaderboardView);
+}
+
 FClientGrantCharacterToUserResult UPlayFabClientModelDecoder::decodeGrantCharacterToUserResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGrantCharacterToUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.CharacterId = !(dataObj.HasField("CharacterId")) ? TEXT("") : dataObj.GetStringField("CharacterId");
+    tempStruct.CharacterType = !(dataObj.HasField("CharacterType")) ? TEXT("") : dataObj.GetStringField("CharacterType");
+    tempStruct.Result = !(dataObj.HasField("Result")) ? false : dataObj.GetBoolField("Result");
+
+    return tempStruct;
+}
 
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
-    tempStruct.CharacterType = !(dataObj->HasField("CharacterType")) ? TEXT("") : dataObj->GetStringField("CharacterType");
-    tempStruct.Result = !(dataObj->HasField("Result")) ? false : dataObj->GetBoolField("Result");
+FClientGrantCharacterToUserResult UPlayFabClientModelDecoder::readGrantCharacterToUserResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGrantCharacterToUserResultResponse(Reader.GetFallbackTree(TEXT("GrantCharacterToUserResult"), response));
+    }
 
+    FClientGrantCharacterToUserResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("CharacterId"):
+            Reader.ReadString(tempStruct.CharacterId);
+            break;
+        case FPlayFabJsonReader::Hash("CharacterType"):
+            Reader.ReadString(tempStruct.CharacterType);
+            break;
+        case FPlayFabJsonReader::Hash("Result"):
+            Reader.ReadBool(tempStruct.Result);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGrantCharacterToUserResultResponse(Reader.GetFallbackTree(TEXT("GrantCharacterToUserResult"), response));
+    }
     return tempStruct;
 }
 
@@ -1097,6 +3564,12 @@ FClientUpdateCharacterStatisticsResult UPlayFabClientModelDecoder::decodeUpdateC
     return tempStruct;
 }
 
+FClientUpdateCharacterStatisticsResult UPlayFabClientModelDecoder::readUpdateCharacterStatisticsResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientUpdateCharacterStatisticsResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -1107,23 +3580,96 @@ FClientGetCharacterDataResult UPlayFabClientModelDecoder::decodeGetCharacterData
 {
     // Temp ustruct
     FClientGetCharacterDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.CharacterId = !(dataObj.HasField("CharacterId")) ? TEXT("") : dataObj.GetStringField("CharacterId");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
+    tempStruct.DataVersion = !(dataObj.HasField("DataVersion")) ? 0 : int(dataObj.GetNumberField("DataVersion"));
+
+    return tempStruct;
+}
 
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+FClientGetCharacterDataResult UPlayFabClientModelDecoder::readGetCharacterDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCharacterDataResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterDataResult"), response));
+    }
 
+    FClientGetCharacterDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("CharacterId"):
+            Reader.ReadString(tempStruct.CharacterId);
+            break;
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        case FPlayFabJsonReader::Hash("DataVersion"):
+            Reader.ReadInt(tempStruct.DataVersion);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetCharacterDataResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterDataResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetCharacterDataResultJsonObjects(FClientGetCharacterDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
+}
+
 FClientUpdateCharacterDataResult UPlayFabClientModelDecoder::decodeUpdateCharacterDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientUpdateCharacterDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.DataVersion = !(dataObj.HasField("DataVersion")) ? 0 : int(dataObj.GetNumberField("DataVersion"));
+
+    return tempStruct;
+}
 
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+FClientUpdateCharacterDataResult UPlayFabClientModelDecoder::readUpdateCharacterDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUpdateCharacterDataResultResponse(Reader.GetFallbackTree(TEXT("UpdateCharacterDataResult"), response));
+    }
 
+    FClientUpdateCharacterDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("DataVersion"):
+            Reader.ReadInt(tempStruct.DataVersion);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeUpdateCharacterDataResultResponse(Reader.GetFallbackTree(TEXT("UpdateCharacterDataResult"), response));
+    }
     return tempStruct;
 }
 
@@ -1137,58 +3683,242 @@ FClientAcceptTradeResponse UPlayFabClientModelDecoder::decodeAcceptTradeResponse
 {
     // Temp ustruct
     FClientAcceptTradeResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.TradeView = !(dataObj.HasField("Trade")) ? FPlayFabJsonView() : dataObj.GetObjectField("Trade");
+
+    return tempStruct;
+}
 
-    tempStruct.Trade = !(dataObj->HasField("Trade")) ? nullptr : dataObj->GetObjectField("Trade");
+FClientAcceptTradeResponse UPlayFabClientModelDecoder::readAcceptTradeResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeAcceptTradeResponseResponse(Reader.GetFallbackTree(TEXT("AcceptTradeResponse"), response));
+    }
 
+    FClientAcceptTradeResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Trade"):
+            Reader.ReadObject(tempStruct.TradeView, TEXT("Trade"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeAcceptTradeResponseResponse(Reader.GetFallbackTree(TEXT("AcceptTradeResponse"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillAcceptTradeResponseJsonObjects(FClientAcceptTradeResponse& result)
+{
+    result.Trade = result.TradeView.WrapJsonObject();
+}
+
 FClientCancelTradeResponse UPlayFabClientModelDecoder::decodeCancelTradeResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientCancelTradeResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.TradeView = !(dataObj.HasField("Trade")) ? FPlayFabJsonView() : dataObj.GetObjectField("Trade");
+
+    return tempStruct;
+}
 
-    tempStruct.Trade = !(dataObj->HasField("Trade")) ? nullptr : dataObj->GetObjectField("Trade");
+FClientCancelTradeResponse UPlayFabClientModelDecoder::readCancelTradeResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeCancelTradeResponseResponse(Reader.GetFallbackTree(TEXT("CancelTradeResponse"), response));
+    }
 
+    FClientCancelTradeResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Trade"):
+            Reader.ReadObject(tempStruct.TradeView, TEXT("Trade"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeCancelTradeResponseResponse(Reader.GetFallbackTree(TEXT("CancelTradeResponse"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillCancelTradeResponseJsonObjects(FClientCancelTradeResponse& result)
+{
+    result.Trade = result.TradeView.WrapJsonObject();
+}
+
 FClientGetPlayerTradesResponse UPlayFabClientModelDecoder::decodeGetPlayerTradesResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayerTradesResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.OpenedTradesView = !(dataObj.HasField("OpenedTrades")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("OpenedTrades");
+    tempStruct.AcceptedTradesView = !(dataObj.HasField("AcceptedTrades")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("AcceptedTrades");
+
+    return tempStruct;
+}
 
-    tempStruct.OpenedTrades = !(dataObj->HasField("OpenedTrades")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("OpenedTrades");
-    tempStruct.AcceptedTrades = !(dataObj->HasField("AcceptedTrades")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("AcceptedTrades");
+FClientGetPlayerTradesResponse UPlayFabClientModelDecoder::readGetPlayerTradesResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerTradesResponseResponse(Reader.GetFallbackTree(TEXT("GetPlayerTradesResponse"), response));
+    }
 
+    FClientGetPlayerTradesResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("OpenedTrades"):
+            Reader.ReadObjectArray(tempStruct.OpenedTradesView, TEXT("OpenedTrades"));
+            break;
+        case FPlayFabJsonReader::Hash("AcceptedTrades"):
+            Reader.ReadObjectArray(tempStruct.AcceptedTradesView, TEXT("AcceptedTrades"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerTradesResponseResponse(Reader.GetFallbackTree(TEXT("GetPlayerTradesResponse"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetPlayerTradesResponseJsonObjects(FClientGetPlayerTradesResponse& result)
+{
+    result.OpenedTrades = FPlayFabJsonView::WrapJsonObjects(result.OpenedTradesView);
+    result.AcceptedTrades = FPlayFabJsonView::WrapJsonObjects(result.AcceptedTradesView);
+}
+
 FClientGetTradeStatusResponse UPlayFabClientModelDecoder::decodeGetTradeStatusResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetTradeStatusResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.TradeView = !(dataObj.HasField("Trade")) ? FPlayFabJsonView() : dataObj.GetObjectField("Trade");
 
-    tempStruct.Trade = !(dataObj->HasField("Trade")) ? nullptr : dataObj->GetObjectField("Trade");
+    return tempStruct;
+}
+
+FClientGetTradeStatusResponse UPlayFabClientModelDecoder::readGetTradeStatusResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetTradeStatusResponseResponse(Reader.GetFallbackTree(TEXT("GetTradeStatusResponse"), response));
+    }
 
+    FClientGetTradeStatusResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Trade"):
+            Reader.ReadObject(tempStruct.TradeView, TEXT("Trade"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetTradeStatusResponseResponse(Reader.GetFallbackTree(TEXT("GetTradeStatusResponse"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetTradeStatusResponseJsonObjects(FClientGetTradeStatusResponse& result)
+{
+    result.Trade = result.TradeView.WrapJsonObject();
+}
+
 FClientOpenTradeResponse UPlayFabClientModelDecoder::decodeOpenTradeResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientOpenTradeResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Trade = !(dataObj->HasField("Trade")) ? nullptr : dataObj->GetObjectField("Trade");
+    tempStruct.TradeView = !(dataObj.HasField("Trade")) ? FPlayFabJsonView() : dataObj.GetObjectField("Trade");
 
     return tempStruct;
 }
 
+FClientOpenTradeResponse UPlayFabClientModelDecoder::readOpenTradeResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeOpenTradeResponseResponse(Reader.GetFallbackTree(TEXT("OpenTradeResponse"), response));
+    }
+
+    FClientOpenTradeResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Trade"):
+            Reader.ReadObject(tempStruct.TradeView, TEXT("Trade"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeOpenTradeResponseResponse(Reader.GetFallbackTree(TEXT("OpenTradeResponse"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabClientModelDecoder::fillOpenTradeResponseJsonObjects(FClientOpenTradeResponse& result)
+{
+    result.Trade = result.TradeView.WrapJsonObject();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -1204,6 +3934,12 @@ FClientAttributeInstallResult UPlayFabClientModelDecoder::decodeAttributeInstall
     return tempStruct;
 }
 
+FClientAttributeInstallResult UPlayFabClientModelDecoder::readAttributeInstallResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientAttributeInstallResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -1220,22 +3956,92 @@ FClientGetPlayerSegmentsResult UPlayFabClientModelDecoder::decodeGetPlayerSegmen
 {
     // Temp ustruct
     FClientGetPlayerSegmentsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.SegmentsView = !(dataObj.HasField("Segments")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Segments");
+
+    return tempStruct;
+}
 
-    tempStruct.Segments = !(dataObj->HasField("Segments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Segments");
+FClientGetPlayerSegmentsResult UPlayFabClientModelDecoder::readGetPlayerSegmentsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerSegmentsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerSegmentsResult"), response));
+    }
 
+    FClientGetPlayerSegmentsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Segments"):
+            Reader.ReadObjectArray(tempStruct.SegmentsView, TEXT("Segments"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerSegmentsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerSegmentsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabClientModelDecoder::fillGetPlayerSegmentsResultJsonObjects(FClientGetPlayerSegmentsResult& result)
+{
+    result.Segments = FPlayFabJsonView::WrapJsonObjects(result.SegmentsView);
+}
+
 FClientGetPlayerTagsResult UPlayFabClientModelDecoder::decodeGetPlayerTagsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FClientGetPlayerTagsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.Tags = !(dataObj.HasField("Tags")) ? TEXT("") : FString::Join(dataObj.GetStringArrayField("Tags"), TEXT(","));
+
+    return tempStruct;
+}
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.Tags = !(dataObj->HasField("Tags")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Tags"), TEXT(","));
+FClientGetPlayerTagsResult UPlayFabClientModelDecoder::readGetPlayerTagsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerTagsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerTagsResult"), response));
+    }
 
+    FClientGetPlayerTagsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("Tags"):
+            Reader.ReadStringList(tempStruct.Tags);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerTagsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerTagsResult"), response));
+    }
     return tempStruct;
 }
 
@@ -1254,6 +4060,12 @@ FClientAndroidDevicePushNotificationRegistrationResult UPlayFabClientModelDecode
     return tempStruct;
 }
 
+FClientAndroidDevicePushNotificationRegistrationResult UPlayFabClientModelDecoder::readAndroidDevicePushNotificationRegistrationResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientAndroidDevicePushNotificationRegistrationResult();
+}
+
 FClientRegisterForIOSPushNotificationResult UPlayFabClientModelDecoder::decodeRegisterForIOSPushNotificationResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -1263,6 +4075,12 @@ FClientRegisterForIOSPushNotificationResult UPlayFabClientModelDecoder::decodeRe
     return tempStruct;
 }
 
+FClientRegisterForIOSPushNotificationResult UPlayFabClientModelDecoder::readRegisterForIOSPushNotificationResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientRegisterForIOSPushNotificationResult();
+}
+
 FClientRestoreIOSPurchasesResult UPlayFabClientModelDecoder::decodeRestoreIOSPurchasesResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -1272,6 +4090,12 @@ FClientRestoreIOSPurchasesResult UPlayFabClientModelDecoder::decodeRestoreIOSPur
     return tempStruct;
 }
 
+FClientRestoreIOSPurchasesResult UPlayFabClientModelDecoder::readRestoreIOSPurchasesResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientRestoreIOSPurchasesResult();
+}
+
 FClientValidateAmazonReceiptResult UPlayFabClientModelDecoder::decodeValidateAmazonReceiptResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -1281,6 +4105,12 @@ FClientValidateAmazonReceiptResult UPlayFabClientModelDecoder::decodeValidateAma
     return tempStruct;
 }
 
+FClientValidateAmazonReceiptResult UPlayFabClientModelDecoder::readValidateAmazonReceiptResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientValidateAmazonReceiptResult();
+}
+
 FClientValidateGooglePlayPurchaseResult UPlayFabClientModelDecoder::decodeValidateGooglePlayPurchaseResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -1290,6 +4120,12 @@ FClientValidateGooglePlayPurchaseResult UPlayFabClientModelDecoder::decodeValida
     return tempStruct;
 }
 
+FClientValidateGooglePlayPurchaseResult UPlayFabClientModelDecoder::readValidateGooglePlayPurchaseResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientValidateGooglePlayPurchaseResult();
+}
+
 FClientValidateIOSReceiptResult UPlayFabClientModelDecoder::decodeValidateIOSReceiptResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -1299,6 +4135,12 @@ FClientValidateIOSReceiptResult UPlayFabClientModelDecoder::decodeValidateIOSRec
     return tempStruct;
 }
 
+FClientValidateIOSReceiptResult UPlayFabClientModelDecoder::readValidateIOSReceiptResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientValidateIOSReceiptResult();
+}
+
 FClientValidateWindowsReceiptResult UPlayFabClientModelDecoder::decodeValidateWindowsReceiptResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -1308,4 +4150,10 @@ FClientValidateWindowsReceiptResult UPlayFabClientModelDecoder::decodeValidateWi
     return tempStruct;
 }
 
+FClientValidateWindowsReceiptResult UPlayFabClientModelDecoder::readValidateWindowsReceiptResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FClientValidateWindowsReceiptResult();
+}
+
 
@@ -6,6 +6,7 @@
 
 #include "PlayFabPrivatePCH.h"
 #include "PlayFabEnums.h"
+#include "PlayFabRequestWriter.h"
 #include "PlayFabMatchmakerAPI.h"
 
 UPlayFabMatchmakerAPI::UPlayFabMatchmakerAPI(const FObjectInitializer& ObjectInitializer)
@@ -16,6 +17,16 @@ UPlayFabMatchmakerAPI::UPlayFabMatchmakerAPI(const FObjectInitializer& ObjectIni
 void UPlayFabMatchmakerAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+UPlayFabJsonObject* UPlayFabMatchmakerAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr)
+    {
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabMatchmakerAPI::GetResponseObject()
@@ -67,12 +78,11 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::AuthUser(FMatchmakerAuthUserReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMatchmakerAPI* manager = NewObject<UPlayFabMatchmakerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMatchmakerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabMatchmakerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAuthUser = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabMatchmakerAPI::HelperAuthUser);
 
@@ -80,16 +90,14 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::AuthUser(FMatchmakerAuthUserReques
     manager->PlayFabRequestURL = "/Matchmaker/AuthUser";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.AuthorizationTicket.IsEmpty() || request.AuthorizationTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("AuthorizationTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("AuthorizationTicket"), request.AuthorizationTicket);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("AuthorizationTicket", request.AuthorizationTicket);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -107,10 +115,10 @@ void UPlayFabMatchmakerAPI::HelperAuthUser(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FMatchmakerAuthUserResponse result = UPlayFabMatchmakerModelDecoder::decodeAuthUserResponseResponse(response.responseData);
-        if (OnSuccessAuthUser.IsBound())
+        FMatchmakerAuthUserResponse result = UPlayFabMatchmakerModelDecoder::readAuthUserResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAuthUser.Execute(result, mCustomData);
+            FDelegateOnSuccessAuthUser(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -122,12 +130,11 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::PlayerJoined(FMatchmakerPlayerJoin
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMatchmakerAPI* manager = NewObject<UPlayFabMatchmakerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMatchmakerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabMatchmakerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessPlayerJoined = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabMatchmakerAPI::HelperPlayerJoined);
 
@@ -135,21 +142,14 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::PlayerJoined(FMatchmakerPlayerJoin
     manager->PlayFabRequestURL = "/Matchmaker/PlayerJoined";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -167,10 +167,10 @@ void UPlayFabMatchmakerAPI::HelperPlayerJoined(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FMatchmakerPlayerJoinedResponse result = UPlayFabMatchmakerModelDecoder::decodePlayerJoinedResponseResponse(response.responseData);
-        if (OnSuccessPlayerJoined.IsBound())
+        FMatchmakerPlayerJoinedResponse result = UPlayFabMatchmakerModelDecoder::readPlayerJoinedResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessPlayerJoined.Execute(result, mCustomData);
+            FDelegateOnSuccessPlayerJoined(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -182,12 +182,11 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::PlayerLeft(FMatchmakerPlayerLeftRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMatchmakerAPI* manager = NewObject<UPlayFabMatchmakerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMatchmakerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabMatchmakerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessPlayerLeft = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabMatchmakerAPI::HelperPlayerLeft);
 
@@ -195,21 +194,14 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::PlayerLeft(FMatchmakerPlayerLeftRe
     manager->PlayFabRequestURL = "/Matchmaker/PlayerLeft";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -227,10 +219,10 @@ void UPlayFabMatchmakerAPI::HelperPlayerLeft(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FMatchmakerPlayerLeftResponse result = UPlayFabMatchmakerModelDecoder::decodePlayerLeftResponseResponse(response.responseData);
-        if (OnSuccessPlayerLeft.IsBound())
+        FMatchmakerPlayerLeftResponse result = UPlayFabMatchmakerModelDecoder::readPlayerLeftResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessPlayerLeft.Execute(result, mCustomData);
+            FDelegateOnSuccessPlayerLeft(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -242,12 +234,11 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::StartGame(FMatchmakerStartGameRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMatchmakerAPI* manager = NewObject<UPlayFabMatchmakerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMatchmakerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabMatchmakerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessStartGame = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabMatchmakerAPI::HelperStartGame);
 
@@ -255,34 +246,17 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::StartGame(FMatchmakerStartGameRequ
     manager->PlayFabRequestURL = "/Matchmaker/StartGame";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.Build.IsEmpty() || request.Build == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Build"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Build"), request.Build);
-    }
-    FString temp_Region;
-    if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
-    if (request.CustomCommandLineData.IsEmpty() || request.CustomCommandLineData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CustomCommandLineData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CustomCommandLineData"), request.CustomCommandLineData);
-    }
-    if (request.ExternalMatchmakerEventEndpoint.IsEmpty() || request.ExternalMatchmakerEventEndpoint == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExternalMatchmakerEventEndpoint"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExternalMatchmakerEventEndpoint"), request.ExternalMatchmakerEventEndpoint);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::High;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Build", request.Build);
+    Writer.WriteEnum("Region", GetEnumName(request.Region));
+    Writer.WriteString("GameMode", request.GameMode);
+    Writer.WriteString("CustomCommandLineData", request.CustomCommandLineData);
+    Writer.WriteString("ExternalMatchmakerEventEndpoint", request.ExternalMatchmakerEventEndpoint);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -300,10 +274,10 @@ void UPlayFabMatchmakerAPI::HelperStartGame(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FMatchmakerStartGameResponse result = UPlayFabMatchmakerModelDecoder::decodeStartGameResponseResponse(response.responseData);
-        if (OnSuccessStartGame.IsBound())
+        FMatchmakerStartGameResponse result = UPlayFabMatchmakerModelDecoder::readStartGameResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessStartGame.Execute(result, mCustomData);
+            FDelegateOnSuccessStartGame(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -315,12 +289,11 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::UserInfo(FMatchmakerUserInfoReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabMatchmakerAPI* manager = NewObject<UPlayFabMatchmakerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabMatchmakerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabMatchmakerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUserInfo = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabMatchmakerAPI::HelperUserInfo);
 
@@ -328,17 +301,16 @@ UPlayFabMatchmakerAPI* UPlayFabMatchmakerAPI::UserInfo(FMatchmakerUserInfoReques
     manager->PlayFabRequestURL = "/Matchmaker/UserInfo";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MinCatalogVersion"), request.MinCatalogVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteNumber("MinCatalogVersion", request.MinCatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -356,17 +328,21 @@ void UPlayFabMatchmakerAPI::HelperUserInfo(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FMatchmakerUserInfoResponse result = UPlayFabMatchmakerModelDecoder::decodeUserInfoResponseResponse(response.responseData);
-        if (OnSuccessUserInfo.IsBound())
+        FMatchmakerUserInfoResponse result = UPlayFabMatchmakerModelDecoder::readUserInfoResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabMatchmakerModelDecoder::fillUserInfoResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUserInfo.Execute(result, mCustomData);
+            FDelegateOnSuccessUserInfo(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
 
 
 
-void UPlayFabMatchmakerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+void UPlayFabMatchmakerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed)
 {
     // Be sure that we have no data from previous response
     ResetResponseData();
@@ -379,6 +355,7 @@ void UPlayFabMatchmakerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FH
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
+        ReleaseToPool();
         return;
     }
 
@@ -395,23 +372,29 @@ void UPlayFabMatchmakerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FH
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        // Requests dropped from a full dispatcher queue were never started
+        if (Request->GetStatus() == EHttpRequestStatus::NotStarted)
+        {
+            myResponse.responseError.ErrorName = "Request dropped";
+            myResponse.responseError.ErrorMessage = "The request queue for this priority class was full";
+        }
+
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
+        ReleaseToPool();
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
-
     // Save response code as int32
     ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
-
-    // Decide whether the request was successful
-    bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
+    // The body was inflated, parsed and checked for errors on a worker thread
+    bIsValidJsonResponse = Parsed.bValidJson;
+    if (Parsed.Json.IsValid())
+    {
+        // Edits made through responseData must not reach the response cache, or other callers sharing the json
+        ResponseJsonObj->GetRootObject() = Parsed.bShared ? FPlayFabJsonView(Parsed.Json).CopyJsonObject() : Parsed.Json;
+    }
 
     // Log errors
     if (!bIsValidJsonResponse)
@@ -419,24 +402,52 @@ void UPlayFabMatchmakerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FH
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
     }
 
-    // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
-
-    myResponse.responseError.decodeError(ResponseJsonObj);
+    myResponse.responseError = Parsed.Error;
     myResponse.responseData = ResponseJsonObj;
-    IPlayFab* pfSettings = &(IPlayFab::Get());
+    myResponse.responseBody = Parsed.Body;
 
-    // Broadcast the result event
+    // Broadcast the result event, after which the response data is no longer ours to keep
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
+    ReleaseToPool();
 }
 
 void UPlayFabMatchmakerAPI::Activate()
+{
+    // From here the dispatcher holds the call, however long it takes
+    FPlayFabManagerPool::Get().MarkActivated(this);
+
+    FPlayFabDispatchInfo DispatchInfo;
+    DispatchInfo.Endpoint = PlayFabRequestURL;
+    DispatchInfo.Priority = requestPriority;
+    DispatchInfo.bIdempotent = isIdempotent;
+    DispatchInfo.bReadOnly = isReadOnly;
+    if (RequestBody.Num() == 0 && RequestJsonObj != nullptr)
+    {
+        // Built as a json tree by the caller rather than streamed by a factory
+        DispatchInfo.Body = RequestJsonObj->GetRootObject();
+    }
+    DispatchInfo.OnResponse = FPlayFabResponseDelegate::CreateUObject(this, &UPlayFabMatchmakerAPI::OnProcessRequestComplete);
+
+    // The generated decoders read the body itself, so the tree is only built for the login handling or other listeners
+    DispatchInfo.bNeedsJsonTree = isLoginRequest;
+    for (const UObject* Listener : OnPlayFabResponse.GetAllObjects())
+    {
+        DispatchInfo.bNeedsJsonTree |= Listener != this;
+    }
+
+    // Hand the request to the dispatcher, which sends it as soon as a connection is free
+    FPlayFabRequestDispatcher::Get().Submit(this, BuildHttpRequest(), DispatchInfo);
+}
+
+TSharedRef<IHttpRequest> UPlayFabMatchmakerAPI::BuildHttpRequest()
 {
     IPlayFab* pfSettings = &(IPlayFab::Get());
 
+    // Read the title and credentials from one snapshot, so a login completing meanwhile can't mix two sessions
+    const FPlayFabSettings& Settings = pfSettings->GetSettings();
+
     FString RequestUrl;
-    RequestUrl = TEXT("https://") + pfSettings->getGameTitleId() + IPlayFab::PlayFabURL + PlayFabRequestURL;
+    RequestUrl = Settings.GetUrl(PlayFabRequestURL);
 
     TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
     HttpRequest->SetURL(RequestUrl);
@@ -444,31 +455,19 @@ void UPlayFabMatchmakerAPI::Activate()
 
     // Headers
     if (useSessionTicket)
-        HttpRequest->SetHeader("X-Authentication", pfSettings->getSessionTicket());
+        HttpRequest->SetHeader("X-Authentication", Settings.SessionTicket);
     if (useSecretKey)
-        HttpRequest->SetHeader("X-SecretKey", pfSettings->getSecretApiKey());
+        HttpRequest->SetHeader("X-SecretKey", Settings.SecretApiKey);
     HttpRequest->SetHeader("Content-Type", "application/json");
+    HttpRequest->SetHeader("Accept-Encoding", "gzip, deflate");
     HttpRequest->SetHeader(TEXT("X-PlayFabSDK"), pfSettings->VersionString);
     HttpRequest->SetHeader("X-ReportErrorAsSuccess", "true"); // FHttpResponsePtr doesn't provide sufficient information when an error code is returned
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
+    if (RequestBody.Num() > 0)
+        HttpRequest->SetContent(RequestBody);
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
-
-    // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
-
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
-
-    // Bind event
-    HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabMatchmakerAPI::OnProcessRequestComplete);
-
-    // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    return HttpRequest;
 }
 
 void UPlayFabMatchmakerAPI::ResetResponseData()
@@ -484,3 +483,37 @@ void UPlayFabMatchmakerAPI::ResetResponseData()
 
     bIsValidJsonResponse = false;
 }
+
+void UPlayFabMatchmakerAPI::ReleaseToPool()
+{
+    FPlayFabManagerPool& Pool = FPlayFabManagerPool::Get();
+    if (!Pool.IsEnabled() || FPlayFabManagerPool::IsHeldOutside(this, OnPlayFabResponse, OnSuccess, OnFailure))
+    {
+        // Not reused, so the response is left for whoever still holds this call
+        Pool.Discard(this);
+        return;
+    }
+
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    OnSuccess.Unbind();
+    mCustomData = nullptr;
+
+    PlayFabRequestURL.Empty();
+    useSecretKey = false;
+    useSessionTicket = false;
+    isLoginRequest = false;
+    requestPriority = EPlayFabRequestPriority::Normal;
+    isIdempotent = false;
+    isReadOnly = false;
+    RequestHeaders.Empty();
+    RequestBody.Reset();
+
+    if (RequestJsonObj != nullptr)
+    {
+        RequestJsonObj->Reset();
+    }
+    ResetResponseData();
+
+    Pool.Release(this);
+}
@@ -6,6 +6,7 @@
 
 #include "PlayFabPrivatePCH.h"
 #include "PlayFabMatchmakerModelDecoder.h"
+#include "PlayFabJsonReader.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Matchmaker API Functions
@@ -20,14 +21,48 @@ FMatchmakerAuthUserResponse UPlayFabMatchmakerModelDecoder::decodeAuthUserRespon
 {
     // Temp ustruct
     FMatchmakerAuthUserResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Authorized = !(dataObj->HasField("Authorized")) ? false : dataObj->GetBoolField("Authorized");
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
+    tempStruct.Authorized = !(dataObj.HasField("Authorized")) ? false : dataObj.GetBoolField("Authorized");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
 
     return tempStruct;
 }
 
+FMatchmakerAuthUserResponse UPlayFabMatchmakerModelDecoder::readAuthUserResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeAuthUserResponseResponse(Reader.GetFallbackTree(TEXT("AuthUserResponse"), response));
+    }
+
+    FMatchmakerAuthUserResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Authorized"):
+            Reader.ReadBool(tempStruct.Authorized);
+            break;
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeAuthUserResponseResponse(Reader.GetFallbackTree(TEXT("AuthUserResponse"), response));
+    }
+    return tempStruct;
+}
+
 FMatchmakerPlayerJoinedResponse UPlayFabMatchmakerModelDecoder::decodePlayerJoinedResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -37,6 +72,12 @@ FMatchmakerPlayerJoinedResponse UPlayFabMatchmakerModelDecoder::decodePlayerJoin
     return tempStruct;
 }
 
+FMatchmakerPlayerJoinedResponse UPlayFabMatchmakerModelDecoder::readPlayerJoinedResponseResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FMatchmakerPlayerJoinedResponse();
+}
+
 FMatchmakerPlayerLeftResponse UPlayFabMatchmakerModelDecoder::decodePlayerLeftResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -46,35 +87,137 @@ FMatchmakerPlayerLeftResponse UPlayFabMatchmakerModelDecoder::decodePlayerLeftRe
     return tempStruct;
 }
 
+FMatchmakerPlayerLeftResponse UPlayFabMatchmakerModelDecoder::readPlayerLeftResponseResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FMatchmakerPlayerLeftResponse();
+}
+
 FMatchmakerStartGameResponse UPlayFabMatchmakerModelDecoder::decodeStartGameResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FMatchmakerStartGameResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.GameID = !(dataObj->HasField("GameID")) ? TEXT("") : dataObj->GetStringField("GameID");
-    tempStruct.ServerHostname = !(dataObj->HasField("ServerHostname")) ? TEXT("") : dataObj->GetStringField("ServerHostname");
-    tempStruct.ServerPort = !(dataObj->HasField("ServerPort")) ? 0 : int(dataObj->GetNumberField("ServerPort"));
+    tempStruct.GameID = !(dataObj.HasField("GameID")) ? TEXT("") : dataObj.GetStringField("GameID");
+    tempStruct.ServerHostname = !(dataObj.HasField("ServerHostname")) ? TEXT("") : dataObj.GetStringField("ServerHostname");
+    tempStruct.ServerPort = !(dataObj.HasField("ServerPort")) ? 0 : int(dataObj.GetNumberField("ServerPort"));
 
     return tempStruct;
 }
 
+FMatchmakerStartGameResponse UPlayFabMatchmakerModelDecoder::readStartGameResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeStartGameResponseResponse(Reader.GetFallbackTree(TEXT("StartGameResponse"), response));
+    }
+
+    FMatchmakerStartGameResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("GameID"):
+            Reader.ReadString(tempStruct.GameID);
+            break;
+        case FPlayFabJsonReader::Hash("ServerHostname"):
+            Reader.ReadString(tempStruct.ServerHostname);
+            break;
+        case FPlayFabJsonReader::Hash("ServerPort"):
+            Reader.ReadInt(tempStruct.ServerPort);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeStartGameResponseResponse(Reader.GetFallbackTree(TEXT("StartGameResponse"), response));
+    }
+    return tempStruct;
+}
+
 FMatchmakerUserInfoResponse UPlayFabMatchmakerModelDecoder::decodeUserInfoResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FMatchmakerUserInfoResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.Username = !(dataObj->HasField("Username")) ? TEXT("") : dataObj->GetStringField("Username");
-    tempStruct.TitleDisplayName = !(dataObj->HasField("TitleDisplayName")) ? TEXT("") : dataObj->GetStringField("TitleDisplayName");
-    tempStruct.Inventory = !(dataObj->HasField("Inventory")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Inventory");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.VirtualCurrencyRechargeTimes = !(dataObj->HasField("VirtualCurrencyRechargeTimes")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyRechargeTimes");
-    tempStruct.IsDeveloper = !(dataObj->HasField("IsDeveloper")) ? false : dataObj->GetBoolField("IsDeveloper");
-    tempStruct.SteamId = !(dataObj->HasField("SteamId")) ? TEXT("") : dataObj->GetStringField("SteamId");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.Username = !(dataObj.HasField("Username")) ? TEXT("") : dataObj.GetStringField("Username");
+    tempStruct.TitleDisplayName = !(dataObj.HasField("TitleDisplayName")) ? TEXT("") : dataObj.GetStringField("TitleDisplayName");
+    tempStruct.InventoryView = !(dataObj.HasField("Inventory")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Inventory");
+    tempStruct.VirtualCurrencyView = !(dataObj.HasField("VirtualCurrency")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrency");
+    tempStruct.VirtualCurrencyRechargeTimesView = !(dataObj.HasField("VirtualCurrencyRechargeTimes")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrencyRechargeTimes");
+    tempStruct.IsDeveloper = !(dataObj.HasField("IsDeveloper")) ? false : dataObj.GetBoolField("IsDeveloper");
+    tempStruct.SteamId = !(dataObj.HasField("SteamId")) ? TEXT("") : dataObj.GetStringField("SteamId");
 
     return tempStruct;
 }
 
+FMatchmakerUserInfoResponse UPlayFabMatchmakerModelDecoder::readUserInfoResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUserInfoResponseResponse(Reader.GetFallbackTree(TEXT("UserInfoResponse"), response));
+    }
+
+    FMatchmakerUserInfoResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("Username"):
+            Reader.ReadString(tempStruct.Username);
+            break;
+        case FPlayFabJsonReader::Hash("TitleDisplayName"):
+            Reader.ReadString(tempStruct.TitleDisplayName);
+            break;
+        case FPlayFabJsonReader::Hash("Inventory"):
+            Reader.ReadObjectArray(tempStruct.InventoryView, TEXT("Inventory"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyView, TEXT("VirtualCurrency"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrencyRechargeTimes"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyRechargeTimesView, TEXT("VirtualCurrencyRechargeTimes"));
+            break;
+        case FPlayFabJsonReader::Hash("IsDeveloper"):
+            Reader.ReadBool(tempStruct.IsDeveloper);
+            break;
+        case FPlayFabJsonReader::Hash("SteamId"):
+            Reader.ReadString(tempStruct.SteamId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeUserInfoResponseResponse(Reader.GetFallbackTree(TEXT("UserInfoResponse"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabMatchmakerModelDecoder::fillUserInfoResponseJsonObjects(FMatchmakerUserInfoResponse& result)
+{
+    result.Inventory = FPlayFabJsonView::WrapJsonObjects(result.InventoryView);
+    result.VirtualCurrency = result.VirtualCurrencyView.WrapJsonObject();
+    result.VirtualCurrencyRechargeTimes = result.VirtualCurrencyRechargeTimesView.WrapJsonObject();
+}
+
 
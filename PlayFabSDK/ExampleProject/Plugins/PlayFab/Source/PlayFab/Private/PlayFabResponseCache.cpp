@@ -0,0 +1,139 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab response cache.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabResponseCache.h"
+
+FPlayFabResponseCache::FPlayFabResponseCache()
+    : ByteBudget(4 * 1024 * 1024)
+    , BytesUsed(0)
+    , UseCounter(0)
+    , Hits(0)
+    , Misses(0)
+    , Evictions(0)
+{
+    // Title wide data that rarely changes during a session, and that a client can't change itself. Nothing clears
+    // an entry when the data is written, so the server and admin reads, which run beside those writes, are left out
+    static const TCHAR* DefaultEndpoints[] =
+    {
+        TEXT("/Client/GetTitleData"),
+        TEXT("/Client/GetTitleNews"),
+        TEXT("/Client/GetPublisherData"),
+        TEXT("/Client/GetCatalogItems"),
+        TEXT("/Client/GetStoreItems"),
+        TEXT("/Client/GetGameServerRegions"),
+    };
+    for (const TCHAR* Endpoint : DefaultEndpoints)
+    {
+        EndpointTtls.Add(Endpoint, 60.0f);
+    }
+}
+
+void FPlayFabResponseCache::SetEndpointTtl(const FString& Endpoint, float Seconds)
+{
+    if (Seconds > 0.0f)
+    {
+        EndpointTtls.Add(Endpoint, Seconds);
+    }
+    else
+    {
+        EndpointTtls.Remove(Endpoint);
+    }
+}
+
+void FPlayFabResponseCache::SetByteBudget(int64 InByteBudget)
+{
+    ByteBudget = FMath::Max<int64>(InByteBudget, 0);
+    MakeRoom(0);
+}
+
+bool FPlayFabResponseCache::Find(const FString& Endpoint, uint32 Fingerprint, const TArray<uint8>& Canonical, FHttpResponsePtr& OutResponse, TSharedPtr<FJsonObject>& OutJson, TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe>& OutBody)
+{
+    if (!IsCacheable(Endpoint))
+    {
+        return false;
+    }
+
+    FEntry* Entry = Entries.Find(Fingerprint);
+    if (Entry != nullptr && Entry->ExpiresAt <= FPlatformTime::Seconds())
+    {
+        Remove(Fingerprint);
+        Entry = nullptr;
+    }
+    if (Entry == nullptr || Entry->Canonical != Canonical)
+    {
+        Misses++;
+        return false;
+    }
+
+    Hits++;
+    Entry->LastUsed = ++UseCounter;
+    OutResponse = Entry->Response;
+    OutJson = Entry->Json;
+    OutBody = Entry->Body;
+    return true;
+}
+
+void FPlayFabResponseCache::Add(const FString& Endpoint, uint32 Fingerprint, const TArray<uint8>& Canonical, FHttpResponsePtr Response, const TSharedPtr<FJsonObject>& Json, const TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe>& Body)
+{
+    const float* Ttl = EndpointTtls.Find(Endpoint);
+    if (Ttl == nullptr || !Response.IsValid() || !Json.IsValid())
+    {
+        return;
+    }
+
+    // The parsed tree takes a few times the body, but the body is a fair proxy for comparing entries
+    const int64 Bytes = Response->GetContent().Num() + Canonical.Num() + (Body.IsValid() ? Body->Num() : 0);
+    if (Bytes > ByteBudget)
+    {
+        return;
+    }
+
+    Remove(Fingerprint);
+    MakeRoom(Bytes);
+
+    FEntry& Entry = Entries.Add(Fingerprint);
+    Entry.Canonical = Canonical;
+    Entry.Response = Response;
+    Entry.Json = Json;
+    Entry.Body = Body;
+    Entry.ExpiresAt = FPlatformTime::Seconds() + *Ttl;
+    Entry.Bytes = Bytes;
+    Entry.LastUsed = ++UseCounter;
+    BytesUsed += Bytes;
+}
+
+void FPlayFabResponseCache::Clear()
+{
+    Entries.Empty();
+    BytesUsed = 0;
+}
+
+void FPlayFabResponseCache::Remove(uint32 Fingerprint)
+{
+    FEntry Entry;
+    if (Entries.RemoveAndCopyValue(Fingerprint, Entry))
+    {
+        BytesUsed -= Entry.Bytes;
+    }
+}
+
+void FPlayFabResponseCache::MakeRoom(int64 Bytes)
+{
+    while (Entries.Num() > 0 && BytesUsed + Bytes > ByteBudget)
+    {
+        uint32 OldestKey = 0;
+        uint64 OldestUse = MAX_uint64;
+        for (const TPair<uint32, FEntry>& Pair : Entries)
+        {
+            if (Pair.Value.LastUsed < OldestUse)
+            {
+                OldestKey = Pair.Key;
+                OldestUse = Pair.Value.LastUsed;
+            }
+        }
+        Remove(OldestKey);
+        Evictions++;
+    }
+}
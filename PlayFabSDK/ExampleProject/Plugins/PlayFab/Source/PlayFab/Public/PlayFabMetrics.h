@@ -0,0 +1,163 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Metrics. Per-endpoint histograms of how long each stage of a call takes and how
+// large its request and response are, plus counts of the error codes it returned. Every
+// counter is updated with atomics, and endpoints are found in a fixed open addressed table,
+// so any thread can record or read without taking a lock. Histograms use log-linear
+// buckets: exact below 8, then 8 buckets per power of two, so a percentile is within
+// 12.5% of the true value. The PlayFab.DumpMetrics console command writes a summary.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Stats/Stats.h"
+#include "PlayFabRequestTypes.h"
+
+DECLARE_STATS_GROUP(TEXT("PlayFab"), STATGROUP_PlayFab, STATCAT_Advanced);
+
+/** A log-linear histogram of non-negative values up to 2^32 */
+class PLAYFAB_API FPlayFabHistogram
+{
+public:
+    static const int32 SubBucketBits = 3;
+    static const int32 SubBucketCount = 1 << SubBucketBits;
+    static const int32 BucketCount = (32 - SubBucketBits + 1) * SubBucketCount;
+
+    FPlayFabHistogram() { Reset(); }
+
+    void Record(uint64 Value);
+    void Reset();
+
+    int32 GetCount() const { return Count; }
+    uint64 GetMax() const { return (uint64)Max; }
+    double GetMean() const { return Count > 0 ? (double)Sum / Count : 0.0; }
+
+    /** Upper bound of the bucket holding the given percentile, 0 to 100. 0 if nothing was recorded */
+    uint64 GetPercentile(float Percentile) const;
+
+private:
+    static int32 GetBucket(uint64 Value);
+    static uint64 GetBucketUpperBound(int32 Bucket);
+
+    volatile int32 Buckets[BucketCount];
+    volatile int32 Count;
+    volatile int64 Sum;
+    volatile int64 Max;
+};
+
+/** Everything recorded for one endpoint */
+class PLAYFAB_API FPlayFabEndpointMetrics
+{
+public:
+    static const int32 StageCount = (int32)EPlayFabCallStage::Callback + 1;
+
+    /** Distinct error codes counted per endpoint, rarer ones are only counted in total */
+    static const int32 MaxErrorCodes = 16;
+
+    explicit FPlayFabEndpointMetrics(const ANSICHAR* InName);
+
+    const ANSICHAR* GetName() const { return Name; }
+
+    /** Time in each stage, in microseconds */
+    const FPlayFabHistogram& GetStage(EPlayFabCallStage Stage) const { return Stages[(int32)Stage]; }
+
+    /** Bytes on the wire, after any compression */
+    const FPlayFabHistogram& GetRequestBytes() const { return RequestBytes; }
+    const FPlayFabHistogram& GetResponseBytes() const { return ResponseBytes; }
+
+    int32 GetAttemptCount() const { return Attempts; }
+    int32 GetErrorCount() const { return Errors; }
+
+    /** How many attempts returned ErrorCode. Transport failures and dropped calls count as code 0 */
+    int32 GetErrorCodeCount(int32 ErrorCode) const;
+
+    /** Every error code seen, with its count */
+    void GetErrorCodeCounts(TMap<int32, int32>& OutCounts) const;
+
+private:
+    friend class FPlayFabMetrics;
+
+    void Reset();
+    void AddError(int32 ErrorCode);
+
+    struct FErrorCount
+    {
+        /** The code in this slot, or MIN_int32 while the slot is free */
+        volatile int32 ErrorCode;
+        volatile int32 Count;
+    };
+
+    ANSICHAR Name[64];
+    FPlayFabHistogram Stages[StageCount];
+    FPlayFabHistogram RequestBytes;
+    FPlayFabHistogram ResponseBytes;
+    volatile int32 Attempts;
+    volatile int32 Errors;
+    FErrorCount ErrorCodes[MaxErrorCodes];
+};
+
+/** One finished attempt of a call, as reported by the dispatcher */
+struct FPlayFabAttemptSample
+{
+    /** Microseconds spent in each stage the attempt went through, negative for stages it didn't reach */
+    int64 StageMicros[FPlayFabEndpointMetrics::StageCount];
+
+    int32 RequestBytes = 0;
+    int32 ResponseBytes = 0;
+
+    /** Whether the attempt failed, and the PlayFab error code if it got one */
+    bool bFailed = false;
+    int32 ErrorCode = 0;
+
+    FPlayFabAttemptSample()
+    {
+        for (int64& Micros : StageMicros)
+        {
+            Micros = -1;
+        }
+    }
+};
+
+class PLAYFAB_API FPlayFabMetrics
+{
+public:
+    /** Number of distinct endpoints tracked, must be a power of two */
+    static const int32 MaxEndpoints = 512;
+
+    /** Create and destroy the metrics, called by the module */
+    static void Startup();
+    static void Shutdown();
+
+    /** Returns the metrics, only valid between Startup() and Shutdown() */
+    static FPlayFabMetrics& Get();
+    static bool IsAvailable() { return Instance != nullptr; }
+
+    /** Add an attempt from any thread */
+    void RecordAttempt(const FString& Endpoint, const FPlayFabAttemptSample& Sample);
+
+    /** Add the time one stage took, for stages measured outside an attempt like the callback */
+    void RecordStage(const FString& Endpoint, EPlayFabCallStage Stage, int64 Micros);
+
+    /** The metrics of an endpoint, e.g. "/Client/GetTitleData", or null if it hasn't been called */
+    const FPlayFabEndpointMetrics* Find(const FString& Endpoint) const;
+
+    /** Every endpoint called so far */
+    void GetEndpoints(TArray<const FPlayFabEndpointMetrics*>& OutEndpoints) const;
+
+    /** Zero every counter, endpoints stay registered */
+    void Reset();
+
+    /** Write p50/p90/p99 of every stage, sizes and error counts for each endpoint */
+    void Dump(FOutputDevice& Ar) const;
+
+private:
+    FPlayFabMetrics();
+    ~FPlayFabMetrics();
+
+    /** Find an endpoint's slot, claiming a free one for it if Create is set */
+    FPlayFabEndpointMetrics* FindSlot(const FString& Endpoint, bool bCreate) const;
+
+    static FPlayFabMetrics* Instance;
+
+    /** Open addressed by the hash of the endpoint. Slots are claimed with a compare and swap and never released */
+    mutable FPlayFabEndpointMetrics* volatile Slots[MaxEndpoints];
+};
@@ -0,0 +1,334 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Request Dispatcher. Every API call is sent through here. It caps the number of
+// requests in flight so they share a small set of keep-alive connections to the title's
+// endpoint, and holds any excess in bounded per-priority queues until a slot frees up.
+// Calls that fail for a transient reason are sent again after a jittered backoff, and a read
+// that is identical to one already in flight waits for that call's response instead. Reads of
+// slow changing title data are answered from a response cache while it is fresh. An endpoint
+// that answers with a throttling error is paused, and its calls held, until it has had time
+// to recover.
+//
+// Each call moves through three stages: its body is serialized (and gzipped if large) on a
+// worker thread, it is sent, and its response is inflated, parsed and checked for errors on
+// a worker thread. Only the finished result is handed back to the owner on the game thread.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "UObject/GCObject.h"
+#include "Containers/Ticker.h"
+#include "Interfaces/IHttpRequest.h"
+#include "HAL/ThreadSafeCounter.h"
+#include "PlayFabRequestTypes.h"
+#include "PlayFabRetryPolicy.h"
+#include "PlayFabResponseReader.h"
+#include "PlayFabResponseCache.h"
+
+/** Delivers a finished call to its owner on the game thread. Response is null if the call never completed */
+DECLARE_DELEGATE_FourParams(FPlayFabResponseDelegate, FHttpRequestPtr, FHttpResponsePtr, bool, const FPlayFabParsedResponse&);
+
+/** Describes an API call handed to the dispatcher */
+struct FPlayFabDispatchInfo
+{
+    /** The API path, e.g. /Client/LoginWithCustomID */
+    FString Endpoint;
+
+    EPlayFabRequestPriority Priority = EPlayFabRequestPriority::Normal;
+
+    /** Safe to apply more than once, so it may be retried after an ambiguous failure */
+    bool bIdempotent = false;
+
+    /** Only reads data, so identical calls in flight at the same time can share one response. Never set for calls that issue a token, nonce or signed url */
+    bool bReadOnly = false;
+
+    /** Something other than the one pass decoders reads the response's json tree, so it must be built */
+    bool bNeedsJsonTree = true;
+
+    /** The request json, serialized into the body on a worker thread. Must not be modified once submitted. Null if the http request already holds the body */
+    TSharedPtr<FJsonObject> Body;
+
+    /** Called with the parsed result once the call is finished */
+    FPlayFabResponseDelegate OnResponse;
+};
+
+class PLAYFAB_API FPlayFabRequestDispatcher : public FGCObject
+{
+public:
+    static const int32 PriorityCount = (int32)EPlayFabRequestPriority::Low + 1;
+
+    /** Create and destroy the dispatcher, called by the module */
+    static void Startup();
+    static void Shutdown();
+
+    /** Returns the dispatcher, only valid between Startup() and Shutdown() */
+    static FPlayFabRequestDispatcher& Get();
+
+    /** Maximum number of requests allowed on the wire at once */
+    void SetMaxInFlight(int32 InMaxInFlight);
+    int32 GetMaxInFlight() const { return MaxInFlight; }
+
+    /** Set the queue bound for a priority class and what happens when it overflows */
+    void SetQueuePolicy(EPlayFabRequestPriority Priority, int32 Capacity, EPlayFabQueueOverflowPolicy Overflow);
+
+    /** Override the generated default priority of an endpoint for every call made to it */
+    void SetEndpointPriority(const FString& Endpoint, EPlayFabRequestPriority Priority);
+    void ClearEndpointPriority(const FString& Endpoint);
+
+    /** Controls which failed calls are sent again and how long to back off first */
+    FPlayFabRetryPolicy& GetRetryPolicy() { return RetryPolicy; }
+
+    /**
+     * Pause an endpoint for BaseSeconds when it answers with a throttling error, doubling with each further throttled
+     * answer up to MaxSeconds, or for as long as the service asks if it says. Calls to a paused endpoint are held, not
+     * sent, and it resumes once a call to it succeeds. A BaseSeconds of 0 turns pausing off. 1 and 30 seconds by default
+     */
+    void SetThrottlePause(float BaseSeconds, float MaxSeconds);
+
+    /** True while calls to Endpoint, e.g. "/Client/GetLeaderboard", are held after throttling */
+    bool IsEndpointPaused(const FString& Endpoint) const { return GetEndpointPauseRemaining(Endpoint) > 0.0f; }
+    float GetEndpointPauseRemaining(const FString& Endpoint) const;
+    int32 GetPausedEndpointCount() const;
+
+    /** Number of times an endpoint has been paused since startup */
+    int32 GetThrottlePauseCount() const { return ThrottlePauseCount; }
+
+    /**
+     * Hold every call made shortly after startup until a random point in [0, WindowSeconds) from module startup,
+     * so a fleet of processes restarting together does not log in at the same moment. Defaults to 10 seconds on
+     * dedicated servers and off everywhere else.
+     */
+    void SetStartupSpreadWindow(float WindowSeconds);
+
+    /** Gzip request bodies of at least ThresholdBytes before sending them. Off by default */
+    void SetRequestCompression(bool bEnabled, int32 ThresholdBytes);
+    int32 GetCompressedRequestCount() const { return CompressedRequestCount; }
+    int64 GetCompressionBytesSaved() const { return CompressionBytesSaved; }
+
+    /**
+     * Let a read-only call attach to an identical one already in flight, matched by endpoint, auth identity and body.
+     * Every attached caller gets the same parsed response. On by default
+     */
+    void SetReadDeduplication(bool bEnabled) { bDeduplicateReads = bEnabled; }
+    int32 GetDeduplicatedCount() const { return DeduplicatedCount; }
+
+    /** Leave null fields out of the bodies the generated factories write, rather than sending them as null. Off by default */
+    void SetOmitNullFields(bool bEnabled) { bOmitNullFields = bEnabled; }
+    bool ShouldOmitNullFields() const { return bOmitNullFields; }
+
+    /** Time to live per endpoint, byte budget and hit counters of the cache in front of read-only calls */
+    FPlayFabResponseCache& GetResponseCache() { return ResponseCache; }
+
+    /**
+     * Save the uncompressed body of every successful response to Directory/<Endpoint>.json, e.g. Directory/Client/GetCatalogItems.json,
+     * as fixtures for the PlayFabBenchmark commandlet. An empty directory stops recording. Off by default
+     */
+    void SetFixtureDirectory(const FString& Directory) { FixtureDirectory = Directory; }
+
+    /** Send a request, or queue it if the in-flight cap has been reached. The owner is kept alive until its response has been delivered */
+    void Submit(UObject* Owner, TSharedRef<IHttpRequest> HttpRequest, const FPlayFabDispatchInfo& Info);
+
+    int32 GetQueuedCount() const;
+    int32 GetQueuedCount(EPlayFabRequestPriority Priority) const { return Queues[(int32)Priority].Num(); }
+    int32 GetInFlightCount() const { return InFlight.Num(); }
+
+    /** Calls waiting out a retry backoff or a paused endpoint */
+    int32 GetRetryWaitingCount() const { return RetryWaiting.Num(); }
+
+    /** FGCObject interface */
+    virtual void AddReferencedObjects(FReferenceCollector& Collector) override;
+
+private:
+    FPlayFabRequestDispatcher();
+    virtual ~FPlayFabRequestDispatcher();
+
+    struct FDispatchedRequest
+    {
+        UObject* Owner;
+        TSharedPtr<IHttpRequest> HttpRequest;
+        FPlayFabDispatchInfo Info;
+
+        /** Number of times this call has been sent */
+        int32 Attempts = 0;
+
+        /** Time before which a retry must not be sent */
+        double NotBefore = 0.0;
+
+        /** Timestamps of the current attempt, for the trace */
+        double SubmitTime = 0.0;
+        double SendTime = 0.0;
+        double ReceiveTime = 0.0;
+
+        /** Keep the bodies in the trace even if the call succeeds */
+        bool bSampled = false;
+
+        /** Hash and bytes of the endpoint, identity and canonical body of a read-only call, otherwise 0 and null */
+        uint32 Fingerprint = 0;
+        TSharedPtr<const TArray<uint8>> Canonical;
+
+        /** Other identical reads may attach to this call through SharedReads */
+        bool bLeadsSharedRead = false;
+
+        /** Key of the identical calls merged into this one while it was queued, in Coalesced. 0 if there are none */
+        uint32 CoalesceKey = 0;
+    };
+
+    /** A read in flight, and the identical reads waiting for its response */
+    struct FSharedRead
+    {
+        TSharedPtr<const TArray<uint8>> Canonical;
+        TArray<FDispatchedRequest> Followers;
+    };
+
+    /** The output of the prepare stage, built on a worker thread */
+    struct FPreparedBody
+    {
+        TArray<uint8> Content;
+        int32 UncompressedSize = 0;
+        bool bGzipped = false;
+
+        /** Endpoint, identity and canonical body of a read-only call, and its hash */
+        TArray<uint8> Canonical;
+        uint32 Fingerprint = 0;
+    };
+
+    /** Prepare jobs still reading a call's json. Shared with the jobs, so the last one can signal after the dispatcher is gone */
+    struct FPrepareJobs
+    {
+        FThreadSafeCounter Reading;
+
+        /** Triggered whenever Reading drops to zero */
+        FEvent* Done;
+
+        FPrepareJobs() : Done(FPlatformProcess::GetSynchEventFromPool(true)) {}
+        ~FPrepareJobs() { FPlatformProcess::ReturnSynchEventToPool(Done); }
+    };
+
+    struct FQueuePolicy
+    {
+        int32 Capacity;
+        EPlayFabQueueOverflowPolicy Overflow;
+    };
+
+    /** An endpoint that has answered with throttling errors since its last success */
+    struct FEndpointThrottle
+    {
+        /** Time before which no call to the endpoint is sent */
+        double ResumeTime = 0.0;
+
+        /** Throttled answers in a row, which set the length of the next pause */
+        int32 Strikes = 0;
+    };
+
+    /** Serialize and possibly gzip the body on the thread pool, then route the request from the game thread */
+    void Prepare(const FDispatchedRequest& Request);
+
+    /** True if a call is a read whose body is fingerprinted, so it can share an identical read's response or be answered from the cache */
+    bool IsFingerprinted(const FPlayFabDispatchInfo& Info) const;
+    void OnRequestPrepared(uint32 JobId, FPreparedBody& Prepared);
+
+    /** Hand a fresh cached response to the owner. Returns false if the call must be sent */
+    bool DeliverFromCache(const FDispatchedRequest& Request);
+
+    /** Attach Request to an identical read in flight. Returns false if it must be sent itself */
+    bool AttachToSharedRead(FDispatchedRequest& Request);
+
+    /** Send the request if a slot is free, otherwise queue it */
+    void Route(const FDispatchedRequest& Request);
+    void Enqueue(const FDispatchedRequest& Request);
+
+    /** Park a call to a paused endpoint with the waiting retries until the pause is over */
+    void Hold(const FDispatchedRequest& Request, double ResumeTime);
+
+    /** The time a paused endpoint resumes, or 0 if it isn't paused */
+    double GetResumeTime(const FString& Endpoint) const;
+
+    /** Pause an endpoint after a throttled answer, or forget its throttling after a success */
+    void PauseEndpoint(const FString& Endpoint, FHttpResponsePtr Response, const FPlayFabParsedResponse& Parsed);
+    void ResumeEndpoint(const FString& Endpoint);
+
+    /** Merge a read only Request into an identical call in its full queue, so both get that call's response. Returns false if it isn't read only or there is none */
+    bool CoalesceWithQueued(const FDispatchedRequest& Request);
+
+    /** Same endpoint, caller and body */
+    static bool IsSameCall(const FDispatchedRequest& A, const FDispatchedRequest& B);
+
+    /** Make room for Request in its full queue. Returns false if the request itself must be rejected */
+    bool ApplyOverflowPolicy(const FDispatchedRequest& Request, TArray<FDispatchedRequest>& OutDropped);
+
+    /** Start queued requests while there are free slots, highest priority first */
+    void Pump();
+    void Send(const FDispatchedRequest& Request);
+    void Fail(const FDispatchedRequest& Request);
+    void OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FDispatchedRequest Dispatched);
+
+    /** Called on the game thread once a worker has parsed the response */
+    void OnResponseDecoded(uint32 JobId, FHttpResponsePtr Response, FPlayFabParsedResponse& Parsed, FPlayFabRetryPolicy::EOutcome Outcome);
+
+    /** Retry the call or hand the result to its owner */
+    void Complete(const FDispatchedRequest& Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed, FPlayFabRetryPolicy::EOutcome Outcome);
+
+    /** Hand the result to the owner, and to every identical read that attached to the call */
+    void Deliver(const FDispatchedRequest& Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed);
+
+    /** Write the body of a successful response to the fixture directory on a worker thread */
+    void RecordFixture(const FString& Endpoint, FHttpResponsePtr Response) const;
+
+    /** Add a finished or dropped attempt to the trace and the endpoint's metrics */
+    static void RecordAttempt(const FDispatchedRequest& Request, FHttpResponsePtr Response, const FPlayFabParsedResponse& Parsed, bool bFailed);
+
+    /** Start a retry on a fresh http request, copying the url, verb, headers and body of the failed one */
+    static TSharedRef<IHttpRequest> CloneRequest(const TSharedPtr<IHttpRequest>& Source);
+
+    /** Move retries and held calls whose wait has elapsed into the queues, and release calls held by the startup window */
+    bool Tick(float DeltaTime);
+    bool IsHeldForStartup() const { return FPlatformTime::Seconds() < StartupReleaseTime; }
+
+    static FPlayFabRequestDispatcher* Instance;
+
+    TArray<FDispatchedRequest> Queues[PriorityCount];
+    FQueuePolicy QueuePolicies[PriorityCount];
+    TMap<FString, EPlayFabRequestPriority> EndpointPriorities;
+    TArray<UObject*> InFlight;
+    /** The requests on the wire, cancelled on shutdown so a late completion can't reach a deleted dispatcher */
+    TArray<TSharedPtr<IHttpRequest>> InFlightRequests;
+    TArray<FDispatchedRequest> RetryWaiting;
+    int32 MaxInFlight;
+
+    TMap<FString, FEndpointThrottle> ThrottledEndpoints;
+    float ThrottlePauseBaseSeconds;
+    float ThrottlePauseMaxSeconds;
+    int32 ThrottlePauseCount;
+
+    /** Calls with work running on the thread pool, by job id. Only the game thread touches these */
+    TMap<uint32, FDispatchedRequest> Preparing;
+    TMap<uint32, FDispatchedRequest> Decoding;
+    uint32 NextJobId;
+
+    /** Shutdown waits on these before Preparing, and the json the jobs read, is destroyed */
+    TSharedRef<FPrepareJobs, ESPMode::ThreadSafe> PrepareJobs;
+
+    TMap<uint32, FSharedRead> SharedReads;
+
+    /** Calls merged into an identical queued call by the coalesce overflow policy, by the survivor's key */
+    TMap<uint32, TArray<FDispatchedRequest>> Coalesced;
+    uint32 NextCoalesceKey;
+
+    bool bDeduplicateReads;
+    int32 DeduplicatedCount;
+
+    FPlayFabResponseCache ResponseCache;
+    FString FixtureDirectory;
+
+    FPlayFabRetryPolicy RetryPolicy;
+    double StartupTime;
+    double StartupReleaseTime;
+
+    bool bOmitNullFields;
+
+    bool bCompressRequests;
+    int32 CompressionThreshold;
+    int32 CompressedRequestCount;
+    int64 CompressionBytesSaved;
+
+    FDelegateHandle TickHandle;
+};
@@ -6,6 +6,7 @@
 
 #include "PlayFabPrivatePCH.h"
 #include "PlayFabEnums.h"
+#include "PlayFabRequestWriter.h"
 #include "PlayFabAdminAPI.h"
 
 UPlayFabAdminAPI::UPlayFabAdminAPI(const FObjectInitializer& ObjectInitializer)
@@ -16,6 +17,16 @@ UPlayFabAdminAPI::UPlayFabAdminAPI(const FObjectInitializer& ObjectInitializer)
 void UPlayFabAdminAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+UPlayFabJsonObject* UPlayFabAdminAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr)
+    {
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabAdminAPI::GetResponseObject()
@@ -67,12 +78,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreatePlayerSharedSecret(FAdminCreatePlayerS
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessCreatePlayerSharedSecret = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperCreatePlayerSharedSecret);
 
@@ -80,16 +90,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreatePlayerSharedSecret(FAdminCreatePlayerS
     manager->PlayFabRequestURL = "/Admin/CreatePlayerSharedSecret";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.FriendlyName.IsEmpty() || request.FriendlyName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendlyName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendlyName"), request.FriendlyName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("FriendlyName", request.FriendlyName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -107,10 +114,10 @@ void UPlayFabAdminAPI::HelperCreatePlayerSharedSecret(FPlayFabBaseModel response
     }
     else
     {
-        FAdminCreatePlayerSharedSecretResult result = UPlayFabAdminModelDecoder::decodeCreatePlayerSharedSecretResultResponse(response.responseData);
-        if (OnSuccessCreatePlayerSharedSecret.IsBound())
+        FAdminCreatePlayerSharedSecretResult result = UPlayFabAdminModelDecoder::readCreatePlayerSharedSecretResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessCreatePlayerSharedSecret.Execute(result, mCustomData);
+            FDelegateOnSuccessCreatePlayerSharedSecret(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -122,12 +129,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeletePlayerSharedSecret(FAdminDeletePlayerS
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessDeletePlayerSharedSecret = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperDeletePlayerSharedSecret);
 
@@ -135,16 +141,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeletePlayerSharedSecret(FAdminDeletePlayerS
     manager->PlayFabRequestURL = "/Admin/DeletePlayerSharedSecret";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.SecretKey.IsEmpty() || request.SecretKey == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SecretKey"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SecretKey"), request.SecretKey);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SecretKey", request.SecretKey);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -162,10 +165,10 @@ void UPlayFabAdminAPI::HelperDeletePlayerSharedSecret(FPlayFabBaseModel response
     }
     else
     {
-        FAdminDeletePlayerSharedSecretResult result = UPlayFabAdminModelDecoder::decodeDeletePlayerSharedSecretResultResponse(response.responseData);
-        if (OnSuccessDeletePlayerSharedSecret.IsBound())
+        FAdminDeletePlayerSharedSecretResult result = UPlayFabAdminModelDecoder::readDeletePlayerSharedSecretResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessDeletePlayerSharedSecret.Execute(result, mCustomData);
+            FDelegateOnSuccessDeletePlayerSharedSecret(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -177,12 +180,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerSharedSecrets(FAdminGetPlayerShared
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerSharedSecrets = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetPlayerSharedSecrets);
 
@@ -190,11 +192,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerSharedSecrets(FAdminGetPlayerShared
     manager->PlayFabRequestURL = "/Admin/GetPlayerSharedSecrets";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -212,10 +217,14 @@ void UPlayFabAdminAPI::HelperGetPlayerSharedSecrets(FPlayFabBaseModel response,
     }
     else
     {
-        FAdminGetPlayerSharedSecretsResult result = UPlayFabAdminModelDecoder::decodeGetPlayerSharedSecretsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerSharedSecrets.IsBound())
+        FAdminGetPlayerSharedSecretsResult result = UPlayFabAdminModelDecoder::readGetPlayerSharedSecretsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetPlayerSharedSecrets.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillGetPlayerSharedSecretsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetPlayerSharedSecrets(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -227,12 +236,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPolicy(FAdminGetPolicyRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPolicy = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetPolicy);
 
@@ -240,16 +248,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPolicy(FAdminGetPolicyRequest request,
     manager->PlayFabRequestURL = "/Admin/GetPolicy";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PolicyName.IsEmpty() || request.PolicyName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PolicyName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PolicyName"), request.PolicyName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PolicyName", request.PolicyName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -267,10 +274,14 @@ void UPlayFabAdminAPI::HelperGetPolicy(FPlayFabBaseModel response, UObject* cust
     }
     else
     {
-        FAdminGetPolicyResponse result = UPlayFabAdminModelDecoder::decodeGetPolicyResponseResponse(response.responseData);
-        if (OnSuccessGetPolicy.IsBound())
+        FAdminGetPolicyResponse result = UPlayFabAdminModelDecoder::readGetPolicyResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetPolicyResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPolicy.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPolicy(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -282,12 +293,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetPlayerSecret(FAdminSetPlayerSecretRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetPlayerSecret = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperSetPlayerSecret);
 
@@ -295,21 +305,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetPlayerSecret(FAdminSetPlayerSecretRequest
     manager->PlayFabRequestURL = "/Admin/SetPlayerSecret";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -327,10 +331,10 @@ void UPlayFabAdminAPI::HelperSetPlayerSecret(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FAdminSetPlayerSecretResult result = UPlayFabAdminModelDecoder::decodeSetPlayerSecretResultResponse(response.responseData);
-        if (OnSuccessSetPlayerSecret.IsBound())
+        FAdminSetPlayerSecretResult result = UPlayFabAdminModelDecoder::readSetPlayerSecretResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetPlayerSecret.Execute(result, mCustomData);
+            FDelegateOnSuccessSetPlayerSecret(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -342,12 +346,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdatePlayerSharedSecret(FAdminUpdatePlayerS
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdatePlayerSharedSecret = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdatePlayerSharedSecret);
 
@@ -355,22 +358,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdatePlayerSharedSecret(FAdminUpdatePlayerS
     manager->PlayFabRequestURL = "/Admin/UpdatePlayerSharedSecret";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.SecretKey.IsEmpty() || request.SecretKey == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SecretKey"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SecretKey"), request.SecretKey);
-    }
-    if (request.FriendlyName.IsEmpty() || request.FriendlyName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendlyName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendlyName"), request.FriendlyName);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("Disabled"), request.Disabled);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SecretKey", request.SecretKey);
+    Writer.WriteString("FriendlyName", request.FriendlyName);
+    Writer.WriteBool("Disabled", request.Disabled);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -388,10 +384,10 @@ void UPlayFabAdminAPI::HelperUpdatePlayerSharedSecret(FPlayFabBaseModel response
     }
     else
     {
-        FAdminUpdatePlayerSharedSecretResult result = UPlayFabAdminModelDecoder::decodeUpdatePlayerSharedSecretResultResponse(response.responseData);
-        if (OnSuccessUpdatePlayerSharedSecret.IsBound())
+        FAdminUpdatePlayerSharedSecretResult result = UPlayFabAdminModelDecoder::readUpdatePlayerSharedSecretResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdatePlayerSharedSecret.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdatePlayerSharedSecret(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -403,12 +399,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdatePolicy(FAdminUpdatePolicyRequest reque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdatePolicy = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdatePolicy);
 
@@ -416,22 +411,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdatePolicy(FAdminUpdatePolicyRequest reque
     manager->PlayFabRequestURL = "/Admin/UpdatePolicy";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PolicyName.IsEmpty() || request.PolicyName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PolicyName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PolicyName"), request.PolicyName);
-    }
-    if (request.Statements.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Statements"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Statements"), request.Statements);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("OverwritePolicy"), request.OverwritePolicy);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PolicyName", request.PolicyName);
+    Writer.WriteObjectArray("Statements", request.Statements);
+    Writer.WriteBool("OverwritePolicy", request.OverwritePolicy);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -449,10 +437,14 @@ void UPlayFabAdminAPI::HelperUpdatePolicy(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FAdminUpdatePolicyResponse result = UPlayFabAdminModelDecoder::decodeUpdatePolicyResponseResponse(response.responseData);
-        if (OnSuccessUpdatePolicy.IsBound())
+        FAdminUpdatePolicyResponse result = UPlayFabAdminModelDecoder::readUpdatePolicyResponseResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessUpdatePolicy.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillUpdatePolicyResponseJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessUpdatePolicy(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -468,12 +460,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::BanUsers(FAdminBanUsersRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessBanUsers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperBanUsers);
 
@@ -481,16 +472,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::BanUsers(FAdminBanUsersRequest request,
     manager->PlayFabRequestURL = "/Admin/BanUsers";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Bans.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Bans"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Bans"), request.Bans);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("Bans", request.Bans);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -508,10 +496,14 @@ void UPlayFabAdminAPI::HelperBanUsers(FPlayFabBaseModel response, UObject* custo
     }
     else
     {
-        FAdminBanUsersResult result = UPlayFabAdminModelDecoder::decodeBanUsersResultResponse(response.responseData);
-        if (OnSuccessBanUsers.IsBound())
+        FAdminBanUsersResult result = UPlayFabAdminModelDecoder::readBanUsersResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillBanUsersResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessBanUsers.Execute(result, mCustomData);
+            FDelegateOnSuccessBanUsers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -523,12 +515,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeletePlayer(FAdminDeletePlayerRequest reque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessDeletePlayer = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperDeletePlayer);
 
@@ -536,16 +527,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeletePlayer(FAdminDeletePlayerRequest reque
     manager->PlayFabRequestURL = "/Admin/DeletePlayer";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -563,10 +551,10 @@ void UPlayFabAdminAPI::HelperDeletePlayer(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FAdminDeletePlayerResult result = UPlayFabAdminModelDecoder::decodeDeletePlayerResultResponse(response.responseData);
-        if (OnSuccessDeletePlayer.IsBound())
+        FAdminDeletePlayerResult result = UPlayFabAdminModelDecoder::readDeletePlayerResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessDeletePlayer.Execute(result, mCustomData);
+            FDelegateOnSuccessDeletePlayer(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -578,12 +566,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserAccountInfo(FAdminLookupUserAccountIn
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserAccountInfo = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetUserAccountInfo);
 
@@ -591,31 +578,18 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserAccountInfo(FAdminLookupUserAccountIn
     manager->PlayFabRequestURL = "/Admin/GetUserAccountInfo";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-    if (request.Username.IsEmpty() || request.Username == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Username"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Username"), request.Username);
-    }
-    if (request.TitleDisplayName.IsEmpty() || request.TitleDisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TitleDisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TitleDisplayName"), request.TitleDisplayName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("Email", request.Email);
+    Writer.WriteString("Username", request.Username);
+    Writer.WriteString("TitleDisplayName", request.TitleDisplayName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -633,10 +607,14 @@ void UPlayFabAdminAPI::HelperGetUserAccountInfo(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FAdminLookupUserAccountInfoResult result = UPlayFabAdminModelDecoder::decodeLookupUserAccountInfoResultResponse(response.responseData);
-        if (OnSuccessGetUserAccountInfo.IsBound())
+        FAdminLookupUserAccountInfoResult result = UPlayFabAdminModelDecoder::readLookupUserAccountInfoResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillLookupUserAccountInfoResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserAccountInfo.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserAccountInfo(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -648,12 +626,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserBans(FAdminGetUserBansRequest request
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserBans = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetUserBans);
 
@@ -661,16 +638,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserBans(FAdminGetUserBansRequest request
     manager->PlayFabRequestURL = "/Admin/GetUserBans";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -688,10 +664,14 @@ void UPlayFabAdminAPI::HelperGetUserBans(FPlayFabBaseModel response, UObject* cu
     }
     else
     {
-        FAdminGetUserBansResult result = UPlayFabAdminModelDecoder::decodeGetUserBansResultResponse(response.responseData);
-        if (OnSuccessGetUserBans.IsBound())
+        FAdminGetUserBansResult result = UPlayFabAdminModelDecoder::readGetUserBansResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetUserBans.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillGetUserBansResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetUserBans(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -703,12 +683,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResetUsers(FAdminResetUsersRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessResetUsers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperResetUsers);
 
@@ -716,16 +695,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResetUsers(FAdminResetUsersRequest request,
     manager->PlayFabRequestURL = "/Admin/ResetUsers";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Users.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Users"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Users"), request.Users);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("Users", request.Users);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -743,10 +719,10 @@ void UPlayFabAdminAPI::HelperResetUsers(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FAdminBlankResult result = UPlayFabAdminModelDecoder::decodeBlankResultResponse(response.responseData);
-        if (OnSuccessResetUsers.IsBound())
+        FAdminBlankResult result = UPlayFabAdminModelDecoder::readBlankResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessResetUsers.Execute(result, mCustomData);
+            FDelegateOnSuccessResetUsers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -758,12 +734,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeAllBansForUser(FAdminRevokeAllBansForU
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRevokeAllBansForUser = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperRevokeAllBansForUser);
 
@@ -771,16 +746,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeAllBansForUser(FAdminRevokeAllBansForU
     manager->PlayFabRequestURL = "/Admin/RevokeAllBansForUser";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -798,10 +770,14 @@ void UPlayFabAdminAPI::HelperRevokeAllBansForUser(FPlayFabBaseModel response, UO
     }
     else
     {
-        FAdminRevokeAllBansForUserResult result = UPlayFabAdminModelDecoder::decodeRevokeAllBansForUserResultResponse(response.responseData);
-        if (OnSuccessRevokeAllBansForUser.IsBound())
+        FAdminRevokeAllBansForUserResult result = UPlayFabAdminModelDecoder::readRevokeAllBansForUserResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessRevokeAllBansForUser.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillRevokeAllBansForUserResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessRevokeAllBansForUser(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -813,12 +789,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeBans(FAdminRevokeBansRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRevokeBans = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperRevokeBans);
 
@@ -826,19 +801,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeBans(FAdminRevokeBansRequest request,
     manager->PlayFabRequestURL = "/Admin/RevokeBans";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.BanIds.IsEmpty() || request.BanIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BanIds"));
-    } else {
-        TArray<FString> BanIdsArray;
-        FString(request.BanIds).ParseIntoArray(BanIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("BanIds"), BanIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("BanIds", request.BanIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -856,10 +825,14 @@ void UPlayFabAdminAPI::HelperRevokeBans(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FAdminRevokeBansResult result = UPlayFabAdminModelDecoder::decodeRevokeBansResultResponse(response.responseData);
-        if (OnSuccessRevokeBans.IsBound())
+        FAdminRevokeBansResult result = UPlayFabAdminModelDecoder::readRevokeBansResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillRevokeBansResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRevokeBans.Execute(result, mCustomData);
+            FDelegateOnSuccessRevokeBans(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -871,12 +844,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SendAccountRecoveryEmail(FAdminSendAccountRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSendAccountRecoveryEmail = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperSendAccountRecoveryEmail);
 
@@ -884,16 +856,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SendAccountRecoveryEmail(FAdminSendAccountRe
     manager->PlayFabRequestURL = "/Admin/SendAccountRecoveryEmail";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Email.IsEmpty() || request.Email == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Email"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Email"), request.Email);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Email", request.Email);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -911,10 +880,10 @@ void UPlayFabAdminAPI::HelperSendAccountRecoveryEmail(FPlayFabBaseModel response
     }
     else
     {
-        FAdminSendAccountRecoveryEmailResult result = UPlayFabAdminModelDecoder::decodeSendAccountRecoveryEmailResultResponse(response.responseData);
-        if (OnSuccessSendAccountRecoveryEmail.IsBound())
+        FAdminSendAccountRecoveryEmailResult result = UPlayFabAdminModelDecoder::readSendAccountRecoveryEmailResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSendAccountRecoveryEmail.Execute(result, mCustomData);
+            FDelegateOnSuccessSendAccountRecoveryEmail(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -926,12 +895,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateBans(FAdminUpdateBansRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateBans = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateBans);
 
@@ -939,16 +907,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateBans(FAdminUpdateBansRequest request,
     manager->PlayFabRequestURL = "/Admin/UpdateBans";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Bans.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Bans"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Bans"), request.Bans);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("Bans", request.Bans);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -966,10 +931,14 @@ void UPlayFabAdminAPI::HelperUpdateBans(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FAdminUpdateBansResult result = UPlayFabAdminModelDecoder::decodeUpdateBansResultResponse(response.responseData);
-        if (OnSuccessUpdateBans.IsBound())
+        FAdminUpdateBansResult result = UPlayFabAdminModelDecoder::readUpdateBansResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillUpdateBansResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateBans.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateBans(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -981,12 +950,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserTitleDisplayName(FAdminUpdateUserT
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserTitleDisplayName = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateUserTitleDisplayName);
 
@@ -994,21 +962,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserTitleDisplayName(FAdminUpdateUserT
     manager->PlayFabRequestURL = "/Admin/UpdateUserTitleDisplayName";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.DisplayName.IsEmpty() || request.DisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DisplayName"), request.DisplayName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("DisplayName", request.DisplayName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1026,10 +987,10 @@ void UPlayFabAdminAPI::HelperUpdateUserTitleDisplayName(FPlayFabBaseModel respon
     }
     else
     {
-        FAdminUpdateUserTitleDisplayNameResult result = UPlayFabAdminModelDecoder::decodeUpdateUserTitleDisplayNameResultResponse(response.responseData);
-        if (OnSuccessUpdateUserTitleDisplayName.IsBound())
+        FAdminUpdateUserTitleDisplayNameResult result = UPlayFabAdminModelDecoder::readUpdateUserTitleDisplayNameResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserTitleDisplayName.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserTitleDisplayName(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1045,12 +1006,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreatePlayerStatisticDefinition(FAdminCreate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessCreatePlayerStatisticDefinition = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperCreatePlayerStatisticDefinition);
 
@@ -1058,22 +1018,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreatePlayerStatisticDefinition(FAdminCreate
     manager->PlayFabRequestURL = "/Admin/CreatePlayerStatisticDefinition";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    FString temp_VersionChangeInterval;
-    if (GetEnumValueToString<EStatisticResetIntervalOption>(TEXT("EStatisticResetIntervalOption"), request.VersionChangeInterval, temp_VersionChangeInterval))
-        OutRestJsonObj->SetStringField(TEXT("VersionChangeInterval"), temp_VersionChangeInterval);
-    FString temp_AggregationMethod;
-    if (GetEnumValueToString<EStatisticAggregationMethod>(TEXT("EStatisticAggregationMethod"), request.AggregationMethod, temp_AggregationMethod))
-        OutRestJsonObj->SetStringField(TEXT("AggregationMethod"), temp_AggregationMethod);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteEnum("VersionChangeInterval", GetEnumName(request.VersionChangeInterval));
+    Writer.WriteEnum("AggregationMethod", GetEnumName(request.AggregationMethod));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1091,10 +1044,14 @@ void UPlayFabAdminAPI::HelperCreatePlayerStatisticDefinition(FPlayFabBaseModel r
     }
     else
     {
-        FAdminCreatePlayerStatisticDefinitionResult result = UPlayFabAdminModelDecoder::decodeCreatePlayerStatisticDefinitionResultResponse(response.responseData);
-        if (OnSuccessCreatePlayerStatisticDefinition.IsBound())
+        FAdminCreatePlayerStatisticDefinitionResult result = UPlayFabAdminModelDecoder::readCreatePlayerStatisticDefinitionResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillCreatePlayerStatisticDefinitionResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessCreatePlayerStatisticDefinition.Execute(result, mCustomData);
+            FDelegateOnSuccessCreatePlayerStatisticDefinition(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1106,12 +1063,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteUsers(FAdminDeleteUsersRequest request
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessDeleteUsers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperDeleteUsers);
 
@@ -1119,20 +1075,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteUsers(FAdminDeleteUsersRequest request
     manager->PlayFabRequestURL = "/Admin/DeleteUsers";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.PlayFabIds.IsEmpty() || request.PlayFabIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIds"));
-    } else {
-        TArray<FString> PlayFabIdsArray;
-        FString(request.PlayFabIds).ParseIntoArray(PlayFabIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIds"), PlayFabIdsArray);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("PlayFabIds", request.PlayFabIds);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1150,10 +1100,10 @@ void UPlayFabAdminAPI::HelperDeleteUsers(FPlayFabBaseModel response, UObject* cu
     }
     else
     {
-        FAdminDeleteUsersResult result = UPlayFabAdminModelDecoder::decodeDeleteUsersResultResponse(response.responseData);
-        if (OnSuccessDeleteUsers.IsBound())
+        FAdminDeleteUsersResult result = UPlayFabAdminModelDecoder::readDeleteUsersResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessDeleteUsers.Execute(result, mCustomData);
+            FDelegateOnSuccessDeleteUsers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1165,12 +1115,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetDataReport(FAdminGetDataReportRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetDataReport = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetDataReport);
 
@@ -1178,19 +1127,18 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetDataReport(FAdminGetDataReportRequest req
     manager->PlayFabRequestURL = "/Admin/GetDataReport";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.ReportName.IsEmpty() || request.ReportName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReportName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReportName"), request.ReportName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Year"), request.Year);
-    OutRestJsonObj->SetNumberField(TEXT("Month"), request.Month);
-    OutRestJsonObj->SetNumberField(TEXT("Day"), request.Day);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ReportName", request.ReportName);
+    Writer.WriteNumber("Year", request.Year);
+    Writer.WriteNumber("Month", request.Month);
+    Writer.WriteNumber("Day", request.Day);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1208,10 +1156,10 @@ void UPlayFabAdminAPI::HelperGetDataReport(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FAdminGetDataReportResult result = UPlayFabAdminModelDecoder::decodeGetDataReportResultResponse(response.responseData);
-        if (OnSuccessGetDataReport.IsBound())
+        FAdminGetDataReportResult result = UPlayFabAdminModelDecoder::readGetDataReportResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetDataReport.Execute(result, mCustomData);
+            FDelegateOnSuccessGetDataReport(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1223,12 +1171,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerStatisticDefinitions(FAdminGetPlaye
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerStatisticDefinitions = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetPlayerStatisticDefinitions);
 
@@ -1236,11 +1183,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerStatisticDefinitions(FAdminGetPlaye
     manager->PlayFabRequestURL = "/Admin/GetPlayerStatisticDefinitions";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1258,10 +1208,14 @@ void UPlayFabAdminAPI::HelperGetPlayerStatisticDefinitions(FPlayFabBaseModel res
     }
     else
     {
-        FAdminGetPlayerStatisticDefinitionsResult result = UPlayFabAdminModelDecoder::decodeGetPlayerStatisticDefinitionsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerStatisticDefinitions.IsBound())
+        FAdminGetPlayerStatisticDefinitionsResult result = UPlayFabAdminModelDecoder::readGetPlayerStatisticDefinitionsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetPlayerStatisticDefinitionsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerStatisticDefinitions.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerStatisticDefinitions(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1273,12 +1227,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerStatisticVersions(FAdminGetPlayerSt
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerStatisticVersions = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetPlayerStatisticVersions);
 
@@ -1286,16 +1239,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerStatisticVersions(FAdminGetPlayerSt
     manager->PlayFabRequestURL = "/Admin/GetPlayerStatisticVersions";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1313,10 +1265,14 @@ void UPlayFabAdminAPI::HelperGetPlayerStatisticVersions(FPlayFabBaseModel respon
     }
     else
     {
-        FAdminGetPlayerStatisticVersionsResult result = UPlayFabAdminModelDecoder::decodeGetPlayerStatisticVersionsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerStatisticVersions.IsBound())
+        FAdminGetPlayerStatisticVersionsResult result = UPlayFabAdminModelDecoder::readGetPlayerStatisticVersionsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetPlayerStatisticVersionsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerStatisticVersions.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerStatisticVersions(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1328,12 +1284,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserData(FAdminGetUserDataRequest request
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetUserData);
 
@@ -1341,25 +1296,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserData(FAdminGetUserDataRequest request
     manager->PlayFabRequestURL = "/Admin/GetUserData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1377,10 +1324,14 @@ void UPlayFabAdminAPI::HelperGetUserData(FPlayFabBaseModel response, UObject* cu
     }
     else
     {
-        FAdminGetUserDataResult result = UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserData.IsBound())
+        FAdminGetUserDataResult result = UPlayFabAdminModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1392,12 +1343,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserInternalData(FAdminGetUserDataRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetUserInternalData);
 
@@ -1405,25 +1355,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserInternalData(FAdminGetUserDataRequest
     manager->PlayFabRequestURL = "/Admin/GetUserInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1441,10 +1383,14 @@ void UPlayFabAdminAPI::HelperGetUserInternalData(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FAdminGetUserDataResult result = UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserInternalData.IsBound())
+        FAdminGetUserDataResult result = UPlayFabAdminModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserInternalData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1456,12 +1402,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserPublisherData(FAdminGetUserDataReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetUserPublisherData);
 
@@ -1469,25 +1414,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserPublisherData(FAdminGetUserDataReques
     manager->PlayFabRequestURL = "/Admin/GetUserPublisherData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1505,10 +1442,14 @@ void UPlayFabAdminAPI::HelperGetUserPublisherData(FPlayFabBaseModel response, UO
     }
     else
     {
-        FAdminGetUserDataResult result = UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserPublisherData.IsBound())
+        FAdminGetUserDataResult result = UPlayFabAdminModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetUserPublisherData.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetUserPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1520,12 +1461,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserPublisherInternalData(FAdminGetUserDa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserPublisherInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetUserPublisherInternalData);
 
@@ -1533,25 +1473,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserPublisherInternalData(FAdminGetUserDa
     manager->PlayFabRequestURL = "/Admin/GetUserPublisherInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1569,10 +1501,14 @@ void UPlayFabAdminAPI::HelperGetUserPublisherInternalData(FPlayFabBaseModel resp
     }
     else
     {
-        FAdminGetUserDataResult result = UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserPublisherInternalData.IsBound())
+        FAdminGetUserDataResult result = UPlayFabAdminModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserPublisherInternalData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserPublisherInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1584,12 +1520,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserPublisherReadOnlyData(FAdminGetUserDa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserPublisherReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetUserPublisherReadOnlyData);
 
@@ -1597,25 +1532,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserPublisherReadOnlyData(FAdminGetUserDa
     manager->PlayFabRequestURL = "/Admin/GetUserPublisherReadOnlyData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1633,10 +1560,14 @@ void UPlayFabAdminAPI::HelperGetUserPublisherReadOnlyData(FPlayFabBaseModel resp
     }
     else
     {
-        FAdminGetUserDataResult result = UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserPublisherReadOnlyData.IsBound())
+        FAdminGetUserDataResult result = UPlayFabAdminModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserPublisherReadOnlyData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserPublisherReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1648,12 +1579,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserReadOnlyData(FAdminGetUserDataRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetUserReadOnlyData);
 
@@ -1661,25 +1591,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserReadOnlyData(FAdminGetUserDataRequest
     manager->PlayFabRequestURL = "/Admin/GetUserReadOnlyData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1697,10 +1619,14 @@ void UPlayFabAdminAPI::HelperGetUserReadOnlyData(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FAdminGetUserDataResult result = UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserReadOnlyData.IsBound())
+        FAdminGetUserDataResult result = UPlayFabAdminModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserReadOnlyData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1712,12 +1638,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::IncrementPlayerStatisticVersion(FAdminIncrem
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessIncrementPlayerStatisticVersion = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperIncrementPlayerStatisticVersion);
 
@@ -1725,16 +1650,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::IncrementPlayerStatisticVersion(FAdminIncrem
     manager->PlayFabRequestURL = "/Admin/IncrementPlayerStatisticVersion";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1752,10 +1674,14 @@ void UPlayFabAdminAPI::HelperIncrementPlayerStatisticVersion(FPlayFabBaseModel r
     }
     else
     {
-        FAdminIncrementPlayerStatisticVersionResult result = UPlayFabAdminModelDecoder::decodeIncrementPlayerStatisticVersionResultResponse(response.responseData);
-        if (OnSuccessIncrementPlayerStatisticVersion.IsBound())
+        FAdminIncrementPlayerStatisticVersionResult result = UPlayFabAdminModelDecoder::readIncrementPlayerStatisticVersionResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessIncrementPlayerStatisticVersion.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillIncrementPlayerStatisticVersionResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessIncrementPlayerStatisticVersion(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1767,12 +1693,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RefundPurchase(FAdminRefundPurchaseRequest r
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRefundPurchase = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperRefundPurchase);
 
@@ -1780,26 +1705,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RefundPurchase(FAdminRefundPurchaseRequest r
     manager->PlayFabRequestURL = "/Admin/RefundPurchase";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
-    if (request.Reason.IsEmpty() || request.Reason == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Reason"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Reason"), request.Reason);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("OrderId", request.OrderId);
+    Writer.WriteString("Reason", request.Reason);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1817,10 +1731,10 @@ void UPlayFabAdminAPI::HelperRefundPurchase(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FAdminRefundPurchaseResponse result = UPlayFabAdminModelDecoder::decodeRefundPurchaseResponseResponse(response.responseData);
-        if (OnSuccessRefundPurchase.IsBound())
+        FAdminRefundPurchaseResponse result = UPlayFabAdminModelDecoder::readRefundPurchaseResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRefundPurchase.Execute(result, mCustomData);
+            FDelegateOnSuccessRefundPurchase(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1832,12 +1746,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResetUserStatistics(FAdminResetUserStatistic
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessResetUserStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperResetUserStatistics);
 
@@ -1845,16 +1758,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResetUserStatistics(FAdminResetUserStatistic
     manager->PlayFabRequestURL = "/Admin/ResetUserStatistics";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1872,10 +1782,10 @@ void UPlayFabAdminAPI::HelperResetUserStatistics(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FAdminResetUserStatisticsResult result = UPlayFabAdminModelDecoder::decodeResetUserStatisticsResultResponse(response.responseData);
-        if (OnSuccessResetUserStatistics.IsBound())
+        FAdminResetUserStatisticsResult result = UPlayFabAdminModelDecoder::readResetUserStatisticsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessResetUserStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessResetUserStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1887,12 +1797,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResolvePurchaseDispute(FAdminResolvePurchase
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessResolvePurchaseDispute = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperResolvePurchaseDispute);
 
@@ -1900,29 +1809,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResolvePurchaseDispute(FAdminResolvePurchase
     manager->PlayFabRequestURL = "/Admin/ResolvePurchaseDispute";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.OrderId.IsEmpty() || request.OrderId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("OrderId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("OrderId"), request.OrderId);
-    }
-    if (request.Reason.IsEmpty() || request.Reason == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Reason"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Reason"), request.Reason);
-    }
-    FString temp_Outcome;
-    if (GetEnumValueToString<EResolutionOutcome>(TEXT("EResolutionOutcome"), request.Outcome, temp_Outcome))
-        OutRestJsonObj->SetStringField(TEXT("Outcome"), temp_Outcome);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("OrderId", request.OrderId);
+    Writer.WriteString("Reason", request.Reason);
+    Writer.WriteEnum("Outcome", GetEnumName(request.Outcome));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1940,10 +1836,10 @@ void UPlayFabAdminAPI::HelperResolvePurchaseDispute(FPlayFabBaseModel response,
     }
     else
     {
-        FAdminResolvePurchaseDisputeResponse result = UPlayFabAdminModelDecoder::decodeResolvePurchaseDisputeResponseResponse(response.responseData);
-        if (OnSuccessResolvePurchaseDispute.IsBound())
+        FAdminResolvePurchaseDisputeResponse result = UPlayFabAdminModelDecoder::readResolvePurchaseDisputeResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessResolvePurchaseDispute.Execute(result, mCustomData);
+            FDelegateOnSuccessResolvePurchaseDispute(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1955,12 +1851,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdatePlayerStatisticDefinition(FAdminUpdate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdatePlayerStatisticDefinition = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdatePlayerStatisticDefinition);
 
@@ -1968,22 +1863,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdatePlayerStatisticDefinition(FAdminUpdate
     manager->PlayFabRequestURL = "/Admin/UpdatePlayerStatisticDefinition";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    FString temp_VersionChangeInterval;
-    if (GetEnumValueToString<EStatisticResetIntervalOption>(TEXT("EStatisticResetIntervalOption"), request.VersionChangeInterval, temp_VersionChangeInterval))
-        OutRestJsonObj->SetStringField(TEXT("VersionChangeInterval"), temp_VersionChangeInterval);
-    FString temp_AggregationMethod;
-    if (GetEnumValueToString<EStatisticAggregationMethod>(TEXT("EStatisticAggregationMethod"), request.AggregationMethod, temp_AggregationMethod))
-        OutRestJsonObj->SetStringField(TEXT("AggregationMethod"), temp_AggregationMethod);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteEnum("VersionChangeInterval", GetEnumName(request.VersionChangeInterval));
+    Writer.WriteEnum("AggregationMethod", GetEnumName(request.AggregationMethod));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2001,10 +1889,14 @@ void UPlayFabAdminAPI::HelperUpdatePlayerStatisticDefinition(FPlayFabBaseModel r
     }
     else
     {
-        FAdminUpdatePlayerStatisticDefinitionResult result = UPlayFabAdminModelDecoder::decodeUpdatePlayerStatisticDefinitionResultResponse(response.responseData);
-        if (OnSuccessUpdatePlayerStatisticDefinition.IsBound())
+        FAdminUpdatePlayerStatisticDefinitionResult result = UPlayFabAdminModelDecoder::readUpdatePlayerStatisticDefinitionResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillUpdatePlayerStatisticDefinitionResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdatePlayerStatisticDefinition.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdatePlayerStatisticDefinition(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2016,12 +1908,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserData(FAdminUpdateUserDataRequest r
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateUserData);
 
@@ -2029,28 +1920,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserData(FAdminUpdateUserDataRequest r
     manager->PlayFabRequestURL = "/Admin/UpdateUserData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2068,10 +1948,10 @@ void UPlayFabAdminAPI::HelperUpdateUserData(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FAdminUpdateUserDataResult result = UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserData.IsBound())
+        FAdminUpdateUserDataResult result = UPlayFabAdminModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2083,12 +1963,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserInternalData(FAdminUpdateUserInter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateUserInternalData);
 
@@ -2096,25 +1975,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserInternalData(FAdminUpdateUserInter
     manager->PlayFabRequestURL = "/Admin/UpdateUserInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2132,10 +2002,10 @@ void UPlayFabAdminAPI::HelperUpdateUserInternalData(FPlayFabBaseModel response,
     }
     else
     {
-        FAdminUpdateUserDataResult result = UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserInternalData.IsBound())
+        FAdminUpdateUserDataResult result = UPlayFabAdminModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserInternalData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2147,12 +2017,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserPublisherData(FAdminUpdateUserData
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateUserPublisherData);
 
@@ -2160,28 +2029,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserPublisherData(FAdminUpdateUserData
     manager->PlayFabRequestURL = "/Admin/UpdateUserPublisherData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2199,10 +2057,10 @@ void UPlayFabAdminAPI::HelperUpdateUserPublisherData(FPlayFabBaseModel response,
     }
     else
     {
-        FAdminUpdateUserDataResult result = UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserPublisherData.IsBound())
+        FAdminUpdateUserDataResult result = UPlayFabAdminModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserPublisherData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2214,12 +2072,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserPublisherInternalData(FAdminUpdate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserPublisherInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateUserPublisherInternalData);
 
@@ -2227,25 +2084,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserPublisherInternalData(FAdminUpdate
     manager->PlayFabRequestURL = "/Admin/UpdateUserPublisherInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2263,10 +2111,10 @@ void UPlayFabAdminAPI::HelperUpdateUserPublisherInternalData(FPlayFabBaseModel r
     }
     else
     {
-        FAdminUpdateUserDataResult result = UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserPublisherInternalData.IsBound())
+        FAdminUpdateUserDataResult result = UPlayFabAdminModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserPublisherInternalData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserPublisherInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2278,12 +2126,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserPublisherReadOnlyData(FAdminUpdate
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserPublisherReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateUserPublisherReadOnlyData);
 
@@ -2291,28 +2138,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserPublisherReadOnlyData(FAdminUpdate
     manager->PlayFabRequestURL = "/Admin/UpdateUserPublisherReadOnlyData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2330,10 +2166,10 @@ void UPlayFabAdminAPI::HelperUpdateUserPublisherReadOnlyData(FPlayFabBaseModel r
     }
     else
     {
-        FAdminUpdateUserDataResult result = UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserPublisherReadOnlyData.IsBound())
+        FAdminUpdateUserDataResult result = UPlayFabAdminModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserPublisherReadOnlyData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserPublisherReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2345,12 +2181,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserReadOnlyData(FAdminUpdateUserDataR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateUserReadOnlyData);
 
@@ -2358,28 +2193,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateUserReadOnlyData(FAdminUpdateUserDataR
     manager->PlayFabRequestURL = "/Admin/UpdateUserReadOnlyData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2397,10 +2221,10 @@ void UPlayFabAdminAPI::HelperUpdateUserReadOnlyData(FPlayFabBaseModel response,
     }
     else
     {
-        FAdminUpdateUserDataResult result = UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserReadOnlyData.IsBound())
+        FAdminUpdateUserDataResult result = UPlayFabAdminModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserReadOnlyData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2416,12 +2240,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddNews(FAdminAddNewsRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddNews = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperAddNews);
 
@@ -2429,26 +2252,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddNews(FAdminAddNewsRequest request,
     manager->PlayFabRequestURL = "/Admin/AddNews";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    if (request.Title.IsEmpty() || request.Title == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Title"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Title"), request.Title);
-    }
-    if (request.Body.IsEmpty() || request.Body == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Body"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Body"), request.Body);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Timestamp", request.Timestamp);
+    Writer.WriteString("Title", request.Title);
+    Writer.WriteString("Body", request.Body);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2466,10 +2278,10 @@ void UPlayFabAdminAPI::HelperAddNews(FPlayFabBaseModel response, UObject* custom
     }
     else
     {
-        FAdminAddNewsResult result = UPlayFabAdminModelDecoder::decodeAddNewsResultResponse(response.responseData);
-        if (OnSuccessAddNews.IsBound())
+        FAdminAddNewsResult result = UPlayFabAdminModelDecoder::readAddNewsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddNews.Execute(result, mCustomData);
+            FDelegateOnSuccessAddNews(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2481,12 +2293,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddVirtualCurrencyTypes(FAdminAddVirtualCurr
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddVirtualCurrencyTypes = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperAddVirtualCurrencyTypes);
 
@@ -2494,16 +2305,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddVirtualCurrencyTypes(FAdminAddVirtualCurr
     manager->PlayFabRequestURL = "/Admin/AddVirtualCurrencyTypes";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.VirtualCurrencies.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrencies"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("VirtualCurrencies"), request.VirtualCurrencies);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("VirtualCurrencies", request.VirtualCurrencies);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2521,10 +2329,10 @@ void UPlayFabAdminAPI::HelperAddVirtualCurrencyTypes(FPlayFabBaseModel response,
     }
     else
     {
-        FAdminBlankResult result = UPlayFabAdminModelDecoder::decodeBlankResultResponse(response.responseData);
-        if (OnSuccessAddVirtualCurrencyTypes.IsBound())
+        FAdminBlankResult result = UPlayFabAdminModelDecoder::readBlankResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddVirtualCurrencyTypes.Execute(result, mCustomData);
+            FDelegateOnSuccessAddVirtualCurrencyTypes(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2536,12 +2344,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteStore(FAdminDeleteStoreRequest request
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessDeleteStore = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperDeleteStore);
 
@@ -2549,21 +2356,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteStore(FAdminDeleteStoreRequest request
     manager->PlayFabRequestURL = "/Admin/DeleteStore";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("StoreId", request.StoreId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2581,10 +2381,10 @@ void UPlayFabAdminAPI::HelperDeleteStore(FPlayFabBaseModel response, UObject* cu
     }
     else
     {
-        FAdminDeleteStoreResult result = UPlayFabAdminModelDecoder::decodeDeleteStoreResultResponse(response.responseData);
-        if (OnSuccessDeleteStore.IsBound())
+        FAdminDeleteStoreResult result = UPlayFabAdminModelDecoder::readDeleteStoreResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessDeleteStore.Execute(result, mCustomData);
+            FDelegateOnSuccessDeleteStore(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2596,12 +2396,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCatalogItems(FAdminGetCatalogItemsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCatalogItems = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetCatalogItems);
 
@@ -2609,16 +2408,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCatalogItems(FAdminGetCatalogItemsRequest
     manager->PlayFabRequestURL = "/Admin/GetCatalogItems";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2636,10 +2434,14 @@ void UPlayFabAdminAPI::HelperGetCatalogItems(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FAdminGetCatalogItemsResult result = UPlayFabAdminModelDecoder::decodeGetCatalogItemsResultResponse(response.responseData);
-        if (OnSuccessGetCatalogItems.IsBound())
+        FAdminGetCatalogItemsResult result = UPlayFabAdminModelDecoder::readGetCatalogItemsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetCatalogItemsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCatalogItems.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCatalogItems(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2651,12 +2453,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPublisherData(FAdminGetPublisherDataReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetPublisherData);
 
@@ -2664,19 +2465,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPublisherData(FAdminGetPublisherDataReque
     manager->PlayFabRequestURL = "/Admin/GetPublisherData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2694,10 +2491,14 @@ void UPlayFabAdminAPI::HelperGetPublisherData(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FAdminGetPublisherDataResult result = UPlayFabAdminModelDecoder::decodeGetPublisherDataResultResponse(response.responseData);
-        if (OnSuccessGetPublisherData.IsBound())
+        FAdminGetPublisherDataResult result = UPlayFabAdminModelDecoder::readGetPublisherDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetPublisherDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPublisherData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2709,12 +2510,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetRandomResultTables(FAdminGetRandomResultT
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetRandomResultTables = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetRandomResultTables);
 
@@ -2722,16 +2522,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetRandomResultTables(FAdminGetRandomResultT
     manager->PlayFabRequestURL = "/Admin/GetRandomResultTables";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2749,10 +2548,14 @@ void UPlayFabAdminAPI::HelperGetRandomResultTables(FPlayFabBaseModel response, U
     }
     else
     {
-        FAdminGetRandomResultTablesResult result = UPlayFabAdminModelDecoder::decodeGetRandomResultTablesResultResponse(response.responseData);
-        if (OnSuccessGetRandomResultTables.IsBound())
+        FAdminGetRandomResultTablesResult result = UPlayFabAdminModelDecoder::readGetRandomResultTablesResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetRandomResultTables.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillGetRandomResultTablesResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetRandomResultTables(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2764,12 +2567,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetStoreItems(FAdminGetStoreItemsRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetStoreItems = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetStoreItems);
 
@@ -2777,21 +2579,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetStoreItems(FAdminGetStoreItemsRequest req
     manager->PlayFabRequestURL = "/Admin/GetStoreItems";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("StoreId", request.StoreId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2809,10 +2606,14 @@ void UPlayFabAdminAPI::HelperGetStoreItems(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FAdminGetStoreItemsResult result = UPlayFabAdminModelDecoder::decodeGetStoreItemsResultResponse(response.responseData);
-        if (OnSuccessGetStoreItems.IsBound())
+        FAdminGetStoreItemsResult result = UPlayFabAdminModelDecoder::readGetStoreItemsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetStoreItemsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetStoreItems.Execute(result, mCustomData);
+            FDelegateOnSuccessGetStoreItems(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2824,12 +2625,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTitleData(FAdminGetTitleDataRequest reque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTitleData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetTitleData);
 
@@ -2837,19 +2637,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTitleData(FAdminGetTitleDataRequest reque
     manager->PlayFabRequestURL = "/Admin/GetTitleData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2867,10 +2663,14 @@ void UPlayFabAdminAPI::HelperGetTitleData(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FAdminGetTitleDataResult result = UPlayFabAdminModelDecoder::decodeGetTitleDataResultResponse(response.responseData);
-        if (OnSuccessGetTitleData.IsBound())
+        FAdminGetTitleDataResult result = UPlayFabAdminModelDecoder::readGetTitleDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetTitleData.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillGetTitleDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetTitleData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2882,12 +2682,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTitleInternalData(FAdminGetTitleDataReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTitleInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetTitleInternalData);
 
@@ -2895,19 +2694,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTitleInternalData(FAdminGetTitleDataReque
     manager->PlayFabRequestURL = "/Admin/GetTitleInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2925,10 +2720,14 @@ void UPlayFabAdminAPI::HelperGetTitleInternalData(FPlayFabBaseModel response, UO
     }
     else
     {
-        FAdminGetTitleDataResult result = UPlayFabAdminModelDecoder::decodeGetTitleDataResultResponse(response.responseData);
-        if (OnSuccessGetTitleInternalData.IsBound())
+        FAdminGetTitleDataResult result = UPlayFabAdminModelDecoder::readGetTitleDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetTitleDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTitleInternalData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTitleInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2940,12 +2739,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ListVirtualCurrencyTypes(FAdminListVirtualCu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessListVirtualCurrencyTypes = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperListVirtualCurrencyTypes);
 
@@ -2953,11 +2751,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ListVirtualCurrencyTypes(FAdminListVirtualCu
     manager->PlayFabRequestURL = "/Admin/ListVirtualCurrencyTypes";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2975,10 +2776,14 @@ void UPlayFabAdminAPI::HelperListVirtualCurrencyTypes(FPlayFabBaseModel response
     }
     else
     {
-        FAdminListVirtualCurrencyTypesResult result = UPlayFabAdminModelDecoder::decodeListVirtualCurrencyTypesResultResponse(response.responseData);
-        if (OnSuccessListVirtualCurrencyTypes.IsBound())
+        FAdminListVirtualCurrencyTypesResult result = UPlayFabAdminModelDecoder::readListVirtualCurrencyTypesResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillListVirtualCurrencyTypesResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessListVirtualCurrencyTypes.Execute(result, mCustomData);
+            FDelegateOnSuccessListVirtualCurrencyTypes(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2990,12 +2795,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RemoveVirtualCurrencyTypes(FAdminRemoveVirtu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRemoveVirtualCurrencyTypes = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperRemoveVirtualCurrencyTypes);
 
@@ -3003,16 +2807,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RemoveVirtualCurrencyTypes(FAdminRemoveVirtu
     manager->PlayFabRequestURL = "/Admin/RemoveVirtualCurrencyTypes";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.VirtualCurrencies.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrencies"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("VirtualCurrencies"), request.VirtualCurrencies);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("VirtualCurrencies", request.VirtualCurrencies);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3030,10 +2831,10 @@ void UPlayFabAdminAPI::HelperRemoveVirtualCurrencyTypes(FPlayFabBaseModel respon
     }
     else
     {
-        FAdminBlankResult result = UPlayFabAdminModelDecoder::decodeBlankResultResponse(response.responseData);
-        if (OnSuccessRemoveVirtualCurrencyTypes.IsBound())
+        FAdminBlankResult result = UPlayFabAdminModelDecoder::readBlankResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRemoveVirtualCurrencyTypes.Execute(result, mCustomData);
+            FDelegateOnSuccessRemoveVirtualCurrencyTypes(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3045,12 +2846,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetCatalogItems(FAdminUpdateCatalogItemsRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetCatalogItems = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperSetCatalogItems);
 
@@ -3058,22 +2858,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetCatalogItems(FAdminUpdateCatalogItemsRequ
     manager->PlayFabRequestURL = "/Admin/SetCatalogItems";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("SetAsDefaultCatalog"), request.SetAsDefaultCatalog);
-    if (request.Catalog.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Catalog"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Catalog"), request.Catalog);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteBool("SetAsDefaultCatalog", request.SetAsDefaultCatalog);
+    Writer.WriteObjectArray("Catalog", request.Catalog);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3091,10 +2885,10 @@ void UPlayFabAdminAPI::HelperSetCatalogItems(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FAdminUpdateCatalogItemsResult result = UPlayFabAdminModelDecoder::decodeUpdateCatalogItemsResultResponse(response.responseData);
-        if (OnSuccessSetCatalogItems.IsBound())
+        FAdminUpdateCatalogItemsResult result = UPlayFabAdminModelDecoder::readUpdateCatalogItemsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetCatalogItems.Execute(result, mCustomData);
+            FDelegateOnSuccessSetCatalogItems(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3106,12 +2900,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetStoreItems(FAdminUpdateStoreItemsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetStoreItems = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperSetStoreItems);
 
@@ -3119,27 +2912,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetStoreItems(FAdminUpdateStoreItemsRequest
     manager->PlayFabRequestURL = "/Admin/SetStoreItems";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
-    if (request.MarketingData != nullptr) OutRestJsonObj->SetObjectField(TEXT("MarketingData"), request.MarketingData);
-    if (request.Store.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Store"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Store"), request.Store);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("StoreId", request.StoreId);
+    Writer.WriteObject("MarketingData", request.MarketingData);
+    Writer.WriteObjectArray("Store", request.Store);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3157,10 +2940,10 @@ void UPlayFabAdminAPI::HelperSetStoreItems(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FAdminUpdateStoreItemsResult result = UPlayFabAdminModelDecoder::decodeUpdateStoreItemsResultResponse(response.responseData);
-        if (OnSuccessSetStoreItems.IsBound())
+        FAdminUpdateStoreItemsResult result = UPlayFabAdminModelDecoder::readUpdateStoreItemsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetStoreItems.Execute(result, mCustomData);
+            FDelegateOnSuccessSetStoreItems(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3172,12 +2955,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetTitleData(FAdminSetTitleDataRequest reque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetTitleData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperSetTitleData);
 
@@ -3185,21 +2967,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetTitleData(FAdminSetTitleDataRequest reque
     manager->PlayFabRequestURL = "/Admin/SetTitleData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Value.IsEmpty() || request.Value == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Value"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Value"), request.Value);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Key", request.Key);
+    Writer.WriteString("Value", request.Value);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3217,10 +2993,10 @@ void UPlayFabAdminAPI::HelperSetTitleData(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FAdminSetTitleDataResult result = UPlayFabAdminModelDecoder::decodeSetTitleDataResultResponse(response.responseData);
-        if (OnSuccessSetTitleData.IsBound())
+        FAdminSetTitleDataResult result = UPlayFabAdminModelDecoder::readSetTitleDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetTitleData.Execute(result, mCustomData);
+            FDelegateOnSuccessSetTitleData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3232,12 +3008,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetTitleInternalData(FAdminSetTitleDataReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetTitleInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperSetTitleInternalData);
 
@@ -3245,21 +3020,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetTitleInternalData(FAdminSetTitleDataReque
     manager->PlayFabRequestURL = "/Admin/SetTitleInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Value.IsEmpty() || request.Value == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Value"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Value"), request.Value);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Key", request.Key);
+    Writer.WriteString("Value", request.Value);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3277,10 +3046,10 @@ void UPlayFabAdminAPI::HelperSetTitleInternalData(FPlayFabBaseModel response, UO
     }
     else
     {
-        FAdminSetTitleDataResult result = UPlayFabAdminModelDecoder::decodeSetTitleDataResultResponse(response.responseData);
-        if (OnSuccessSetTitleInternalData.IsBound())
+        FAdminSetTitleDataResult result = UPlayFabAdminModelDecoder::readSetTitleDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetTitleInternalData.Execute(result, mCustomData);
+            FDelegateOnSuccessSetTitleInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3292,12 +3061,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetupPushNotification(FAdminSetupPushNotific
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetupPushNotification = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperSetupPushNotification);
 
@@ -3305,30 +3073,18 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetupPushNotification(FAdminSetupPushNotific
     manager->PlayFabRequestURL = "/Admin/SetupPushNotification";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
-    FString temp_Platform;
-    if (GetEnumValueToString<EPushSetupPlatform>(TEXT("EPushSetupPlatform"), request.Platform, temp_Platform))
-        OutRestJsonObj->SetStringField(TEXT("Platform"), temp_Platform);
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Credential.IsEmpty() || request.Credential == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Credential"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Credential"), request.Credential);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("OverwriteOldARN"), request.OverwriteOldARN);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Name", request.Name);
+    Writer.WriteEnum("Platform", GetEnumName(request.Platform));
+    Writer.WriteString("Key", request.Key);
+    Writer.WriteString("Credential", request.Credential);
+    Writer.WriteBool("OverwriteOldARN", request.OverwriteOldARN);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3346,10 +3102,10 @@ void UPlayFabAdminAPI::HelperSetupPushNotification(FPlayFabBaseModel response, U
     }
     else
     {
-        FAdminSetupPushNotificationResult result = UPlayFabAdminModelDecoder::decodeSetupPushNotificationResultResponse(response.responseData);
-        if (OnSuccessSetupPushNotification.IsBound())
+        FAdminSetupPushNotificationResult result = UPlayFabAdminModelDecoder::readSetupPushNotificationResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetupPushNotification.Execute(result, mCustomData);
+            FDelegateOnSuccessSetupPushNotification(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3361,12 +3117,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateCatalogItems(FAdminUpdateCatalogItemsR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateCatalogItems = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateCatalogItems);
 
@@ -3374,22 +3129,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateCatalogItems(FAdminUpdateCatalogItemsR
     manager->PlayFabRequestURL = "/Admin/UpdateCatalogItems";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("SetAsDefaultCatalog"), request.SetAsDefaultCatalog);
-    if (request.Catalog.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Catalog"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Catalog"), request.Catalog);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteBool("SetAsDefaultCatalog", request.SetAsDefaultCatalog);
+    Writer.WriteObjectArray("Catalog", request.Catalog);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3407,10 +3155,10 @@ void UPlayFabAdminAPI::HelperUpdateCatalogItems(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FAdminUpdateCatalogItemsResult result = UPlayFabAdminModelDecoder::decodeUpdateCatalogItemsResultResponse(response.responseData);
-        if (OnSuccessUpdateCatalogItems.IsBound())
+        FAdminUpdateCatalogItemsResult result = UPlayFabAdminModelDecoder::readUpdateCatalogItemsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateCatalogItems.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateCatalogItems(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3422,12 +3170,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateRandomResultTables(FAdminUpdateRandomR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateRandomResultTables = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateRandomResultTables);
 
@@ -3435,21 +3182,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateRandomResultTables(FAdminUpdateRandomR
     manager->PlayFabRequestURL = "/Admin/UpdateRandomResultTables";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.Tables.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Tables"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Tables"), request.Tables);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectArray("Tables", request.Tables);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3467,10 +3207,10 @@ void UPlayFabAdminAPI::HelperUpdateRandomResultTables(FPlayFabBaseModel response
     }
     else
     {
-        FAdminUpdateRandomResultTablesResult result = UPlayFabAdminModelDecoder::decodeUpdateRandomResultTablesResultResponse(response.responseData);
-        if (OnSuccessUpdateRandomResultTables.IsBound())
+        FAdminUpdateRandomResultTablesResult result = UPlayFabAdminModelDecoder::readUpdateRandomResultTablesResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateRandomResultTables.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateRandomResultTables(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3482,12 +3222,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateStoreItems(FAdminUpdateStoreItemsReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateStoreItems = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateStoreItems);
 
@@ -3495,27 +3234,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateStoreItems(FAdminUpdateStoreItemsReque
     manager->PlayFabRequestURL = "/Admin/UpdateStoreItems";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.StoreId.IsEmpty() || request.StoreId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StoreId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StoreId"), request.StoreId);
-    }
-    if (request.MarketingData != nullptr) OutRestJsonObj->SetObjectField(TEXT("MarketingData"), request.MarketingData);
-    if (request.Store.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Store"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Store"), request.Store);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("StoreId", request.StoreId);
+    Writer.WriteObject("MarketingData", request.MarketingData);
+    Writer.WriteObjectArray("Store", request.Store);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3533,10 +3261,10 @@ void UPlayFabAdminAPI::HelperUpdateStoreItems(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FAdminUpdateStoreItemsResult result = UPlayFabAdminModelDecoder::decodeUpdateStoreItemsResultResponse(response.responseData);
-        if (OnSuccessUpdateStoreItems.IsBound())
+        FAdminUpdateStoreItemsResult result = UPlayFabAdminModelDecoder::readUpdateStoreItemsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateStoreItems.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateStoreItems(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3552,12 +3280,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddUserVirtualCurrency(FAdminAddUserVirtualC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddUserVirtualCurrency = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperAddUserVirtualCurrency);
 
@@ -3565,22 +3292,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddUserVirtualCurrency(FAdminAddUserVirtualC
     manager->PlayFabRequestURL = "/Admin/AddUserVirtualCurrency";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("VirtualCurrency", request.VirtualCurrency);
+    Writer.WriteNumber("Amount", request.Amount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3598,10 +3318,10 @@ void UPlayFabAdminAPI::HelperAddUserVirtualCurrency(FPlayFabBaseModel response,
     }
     else
     {
-        FAdminModifyUserVirtualCurrencyResult result = UPlayFabAdminModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
-        if (OnSuccessAddUserVirtualCurrency.IsBound())
+        FAdminModifyUserVirtualCurrencyResult result = UPlayFabAdminModelDecoder::readModifyUserVirtualCurrencyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddUserVirtualCurrency.Execute(result, mCustomData);
+            FDelegateOnSuccessAddUserVirtualCurrency(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3613,12 +3333,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserInventory(FAdminGetUserInventoryReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserInventory = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetUserInventory);
 
@@ -3626,16 +3345,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetUserInventory(FAdminGetUserInventoryReque
     manager->PlayFabRequestURL = "/Admin/GetUserInventory";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3653,10 +3371,14 @@ void UPlayFabAdminAPI::HelperGetUserInventory(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FAdminGetUserInventoryResult result = UPlayFabAdminModelDecoder::decodeGetUserInventoryResultResponse(response.responseData);
-        if (OnSuccessGetUserInventory.IsBound())
+        FAdminGetUserInventoryResult result = UPlayFabAdminModelDecoder::readGetUserInventoryResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetUserInventoryResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserInventory.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserInventory(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3668,12 +3390,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GrantItemsToUsers(FAdminGrantItemsToUsersReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGrantItemsToUsers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGrantItemsToUsers);
 
@@ -3681,21 +3402,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GrantItemsToUsers(FAdminGrantItemsToUsersReq
     manager->PlayFabRequestURL = "/Admin/GrantItemsToUsers";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.ItemGrants.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemGrants"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("ItemGrants"), request.ItemGrants);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectArray("ItemGrants", request.ItemGrants);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3713,10 +3427,14 @@ void UPlayFabAdminAPI::HelperGrantItemsToUsers(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FAdminGrantItemsToUsersResult result = UPlayFabAdminModelDecoder::decodeGrantItemsToUsersResultResponse(response.responseData);
-        if (OnSuccessGrantItemsToUsers.IsBound())
+        FAdminGrantItemsToUsersResult result = UPlayFabAdminModelDecoder::readGrantItemsToUsersResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGrantItemsToUsersResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGrantItemsToUsers.Execute(result, mCustomData);
+            FDelegateOnSuccessGrantItemsToUsers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3728,12 +3446,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeInventoryItem(FAdminRevokeInventoryIte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRevokeInventoryItem = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperRevokeInventoryItem);
 
@@ -3741,26 +3458,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RevokeInventoryItem(FAdminRevokeInventoryIte
     manager->PlayFabRequestURL = "/Admin/RevokeInventoryItem";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("ItemInstanceId", request.ItemInstanceId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3778,10 +3484,10 @@ void UPlayFabAdminAPI::HelperRevokeInventoryItem(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FAdminRevokeInventoryResult result = UPlayFabAdminModelDecoder::decodeRevokeInventoryResultResponse(response.responseData);
-        if (OnSuccessRevokeInventoryItem.IsBound())
+        FAdminRevokeInventoryResult result = UPlayFabAdminModelDecoder::readRevokeInventoryResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRevokeInventoryItem.Execute(result, mCustomData);
+            FDelegateOnSuccessRevokeInventoryItem(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3793,12 +3499,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SubtractUserVirtualCurrency(FAdminSubtractUs
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSubtractUserVirtualCurrency = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperSubtractUserVirtualCurrency);
 
@@ -3806,22 +3511,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SubtractUserVirtualCurrency(FAdminSubtractUs
     manager->PlayFabRequestURL = "/Admin/SubtractUserVirtualCurrency";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("VirtualCurrency", request.VirtualCurrency);
+    Writer.WriteNumber("Amount", request.Amount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3839,10 +3537,10 @@ void UPlayFabAdminAPI::HelperSubtractUserVirtualCurrency(FPlayFabBaseModel respo
     }
     else
     {
-        FAdminModifyUserVirtualCurrencyResult result = UPlayFabAdminModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
-        if (OnSuccessSubtractUserVirtualCurrency.IsBound())
+        FAdminModifyUserVirtualCurrencyResult result = UPlayFabAdminModelDecoder::readModifyUserVirtualCurrencyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSubtractUserVirtualCurrency.Execute(result, mCustomData);
+            FDelegateOnSuccessSubtractUserVirtualCurrency(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3858,12 +3556,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetMatchmakerGameInfo(FAdminGetMatchmakerGam
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetMatchmakerGameInfo = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetMatchmakerGameInfo);
 
@@ -3871,16 +3568,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetMatchmakerGameInfo(FAdminGetMatchmakerGam
     manager->PlayFabRequestURL = "/Admin/GetMatchmakerGameInfo";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3898,10 +3594,10 @@ void UPlayFabAdminAPI::HelperGetMatchmakerGameInfo(FPlayFabBaseModel response, U
     }
     else
     {
-        FAdminGetMatchmakerGameInfoResult result = UPlayFabAdminModelDecoder::decodeGetMatchmakerGameInfoResultResponse(response.responseData);
-        if (OnSuccessGetMatchmakerGameInfo.IsBound())
+        FAdminGetMatchmakerGameInfoResult result = UPlayFabAdminModelDecoder::readGetMatchmakerGameInfoResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetMatchmakerGameInfo.Execute(result, mCustomData);
+            FDelegateOnSuccessGetMatchmakerGameInfo(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3913,12 +3609,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetMatchmakerGameModes(FAdminGetMatchmakerGa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetMatchmakerGameModes = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetMatchmakerGameModes);
 
@@ -3926,16 +3621,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetMatchmakerGameModes(FAdminGetMatchmakerGa
     manager->PlayFabRequestURL = "/Admin/GetMatchmakerGameModes";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildVersion", request.BuildVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3953,10 +3647,14 @@ void UPlayFabAdminAPI::HelperGetMatchmakerGameModes(FPlayFabBaseModel response,
     }
     else
     {
-        FAdminGetMatchmakerGameModesResult result = UPlayFabAdminModelDecoder::decodeGetMatchmakerGameModesResultResponse(response.responseData);
-        if (OnSuccessGetMatchmakerGameModes.IsBound())
+        FAdminGetMatchmakerGameModesResult result = UPlayFabAdminModelDecoder::readGetMatchmakerGameModesResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetMatchmakerGameModesResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetMatchmakerGameModes.Execute(result, mCustomData);
+            FDelegateOnSuccessGetMatchmakerGameModes(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3968,12 +3666,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ModifyMatchmakerGameModes(FAdminModifyMatchm
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessModifyMatchmakerGameModes = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperModifyMatchmakerGameModes);
 
@@ -3981,21 +3678,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ModifyMatchmakerGameModes(FAdminModifyMatchm
     manager->PlayFabRequestURL = "/Admin/ModifyMatchmakerGameModes";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.BuildVersion.IsEmpty() || request.BuildVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildVersion"), request.BuildVersion);
-    }
-    if (request.GameModes.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("GameModes"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("GameModes"), request.GameModes);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildVersion", request.BuildVersion);
+    Writer.WriteObjectArray("GameModes", request.GameModes);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4013,10 +3703,10 @@ void UPlayFabAdminAPI::HelperModifyMatchmakerGameModes(FPlayFabBaseModel respons
     }
     else
     {
-        FAdminModifyMatchmakerGameModesResult result = UPlayFabAdminModelDecoder::decodeModifyMatchmakerGameModesResultResponse(response.responseData);
-        if (OnSuccessModifyMatchmakerGameModes.IsBound())
+        FAdminModifyMatchmakerGameModesResult result = UPlayFabAdminModelDecoder::readModifyMatchmakerGameModesResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessModifyMatchmakerGameModes.Execute(result, mCustomData);
+            FDelegateOnSuccessModifyMatchmakerGameModes(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4032,12 +3722,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddServerBuild(FAdminAddServerBuildRequest r
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddServerBuild = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperAddServerBuild);
 
@@ -4045,41 +3734,19 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddServerBuild(FAdminAddServerBuildRequest r
     manager->PlayFabRequestURL = "/Admin/AddServerBuild";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.CommandLineTemplate.IsEmpty() || request.CommandLineTemplate == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CommandLineTemplate"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CommandLineTemplate"), request.CommandLineTemplate);
-    }
-    if (request.ExecutablePath.IsEmpty() || request.ExecutablePath == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExecutablePath"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExecutablePath"), request.ExecutablePath);
-    }
-    // Check to see if string is empty
-    if (request.ActiveRegions.IsEmpty() || request.ActiveRegions == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ActiveRegions"));
-    } else {
-        TArray<FString> ActiveRegionsArray;
-        FString(request.ActiveRegions).ParseIntoArray(ActiveRegionsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("ActiveRegions"), ActiveRegionsArray);
-    }
-    if (request.Comment.IsEmpty() || request.Comment == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Comment"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Comment"), request.Comment);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxGamesPerHost"), request.MaxGamesPerHost);
-    OutRestJsonObj->SetNumberField(TEXT("MinFreeGameSlots"), request.MinFreeGameSlots);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildId", request.BuildId);
+    Writer.WriteString("CommandLineTemplate", request.CommandLineTemplate);
+    Writer.WriteString("ExecutablePath", request.ExecutablePath);
+    Writer.WriteStringList("ActiveRegions", request.ActiveRegions);
+    Writer.WriteString("Comment", request.Comment);
+    Writer.WriteNumber("MaxGamesPerHost", request.MaxGamesPerHost);
+    Writer.WriteNumber("MinFreeGameSlots", request.MinFreeGameSlots);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4097,10 +3764,10 @@ void UPlayFabAdminAPI::HelperAddServerBuild(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FAdminAddServerBuildResult result = UPlayFabAdminModelDecoder::decodeAddServerBuildResultResponse(response.responseData);
-        if (OnSuccessAddServerBuild.IsBound())
+        FAdminAddServerBuildResult result = UPlayFabAdminModelDecoder::readAddServerBuildResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddServerBuild.Execute(result, mCustomData);
+            FDelegateOnSuccessAddServerBuild(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4112,12 +3779,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetServerBuildInfo(FAdminGetServerBuildInfoR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetServerBuildInfo = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetServerBuildInfo);
 
@@ -4125,16 +3791,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetServerBuildInfo(FAdminGetServerBuildInfoR
     manager->PlayFabRequestURL = "/Admin/GetServerBuildInfo";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildId", request.BuildId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4152,10 +3817,10 @@ void UPlayFabAdminAPI::HelperGetServerBuildInfo(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FAdminGetServerBuildInfoResult result = UPlayFabAdminModelDecoder::decodeGetServerBuildInfoResultResponse(response.responseData);
-        if (OnSuccessGetServerBuildInfo.IsBound())
+        FAdminGetServerBuildInfoResult result = UPlayFabAdminModelDecoder::readGetServerBuildInfoResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetServerBuildInfo.Execute(result, mCustomData);
+            FDelegateOnSuccessGetServerBuildInfo(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4167,12 +3832,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetServerBuildUploadUrl(FAdminGetServerBuild
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetServerBuildUploadUrl = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetServerBuildUploadUrl);
 
@@ -4180,16 +3844,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetServerBuildUploadUrl(FAdminGetServerBuild
     manager->PlayFabRequestURL = "/Admin/GetServerBuildUploadUrl";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildId", request.BuildId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4207,10 +3869,10 @@ void UPlayFabAdminAPI::HelperGetServerBuildUploadUrl(FPlayFabBaseModel response,
     }
     else
     {
-        FAdminGetServerBuildUploadURLResult result = UPlayFabAdminModelDecoder::decodeGetServerBuildUploadURLResultResponse(response.responseData);
-        if (OnSuccessGetServerBuildUploadUrl.IsBound())
+        FAdminGetServerBuildUploadURLResult result = UPlayFabAdminModelDecoder::readGetServerBuildUploadURLResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetServerBuildUploadUrl.Execute(result, mCustomData);
+            FDelegateOnSuccessGetServerBuildUploadUrl(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4222,12 +3884,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ListServerBuilds(FAdminListBuildsRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessListServerBuilds = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperListServerBuilds);
 
@@ -4235,11 +3896,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ListServerBuilds(FAdminListBuildsRequest req
     manager->PlayFabRequestURL = "/Admin/ListServerBuilds";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4257,10 +3921,14 @@ void UPlayFabAdminAPI::HelperListServerBuilds(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FAdminListBuildsResult result = UPlayFabAdminModelDecoder::decodeListBuildsResultResponse(response.responseData);
-        if (OnSuccessListServerBuilds.IsBound())
+        FAdminListBuildsResult result = UPlayFabAdminModelDecoder::readListBuildsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillListBuildsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessListServerBuilds.Execute(result, mCustomData);
+            FDelegateOnSuccessListServerBuilds(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4272,12 +3940,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ModifyServerBuild(FAdminModifyServerBuildReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessModifyServerBuild = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperModifyServerBuild);
 
@@ -4285,46 +3952,20 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ModifyServerBuild(FAdminModifyServerBuildReq
     manager->PlayFabRequestURL = "/Admin/ModifyServerBuild";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    // Check to see if string is empty
-    if (request.ActiveRegions.IsEmpty() || request.ActiveRegions == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ActiveRegions"));
-    } else {
-        TArray<FString> ActiveRegionsArray;
-        FString(request.ActiveRegions).ParseIntoArray(ActiveRegionsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("ActiveRegions"), ActiveRegionsArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxGamesPerHost"), request.MaxGamesPerHost);
-    OutRestJsonObj->SetNumberField(TEXT("MinFreeGameSlots"), request.MinFreeGameSlots);
-    if (request.CommandLineTemplate.IsEmpty() || request.CommandLineTemplate == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CommandLineTemplate"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CommandLineTemplate"), request.CommandLineTemplate);
-    }
-    if (request.ExecutablePath.IsEmpty() || request.ExecutablePath == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ExecutablePath"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ExecutablePath"), request.ExecutablePath);
-    }
-    if (request.Comment.IsEmpty() || request.Comment == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Comment"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Comment"), request.Comment);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildId", request.BuildId);
+    Writer.WriteString("Timestamp", request.Timestamp);
+    Writer.WriteStringList("ActiveRegions", request.ActiveRegions);
+    Writer.WriteNumber("MaxGamesPerHost", request.MaxGamesPerHost);
+    Writer.WriteNumber("MinFreeGameSlots", request.MinFreeGameSlots);
+    Writer.WriteString("CommandLineTemplate", request.CommandLineTemplate);
+    Writer.WriteString("ExecutablePath", request.ExecutablePath);
+    Writer.WriteString("Comment", request.Comment);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4342,10 +3983,10 @@ void UPlayFabAdminAPI::HelperModifyServerBuild(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FAdminModifyServerBuildResult result = UPlayFabAdminModelDecoder::decodeModifyServerBuildResultResponse(response.responseData);
-        if (OnSuccessModifyServerBuild.IsBound())
+        FAdminModifyServerBuildResult result = UPlayFabAdminModelDecoder::readModifyServerBuildResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessModifyServerBuild.Execute(result, mCustomData);
+            FDelegateOnSuccessModifyServerBuild(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4357,12 +3998,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RemoveServerBuild(FAdminRemoveServerBuildReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRemoveServerBuild = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperRemoveServerBuild);
 
@@ -4370,16 +4010,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RemoveServerBuild(FAdminRemoveServerBuildReq
     manager->PlayFabRequestURL = "/Admin/RemoveServerBuild";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.BuildId.IsEmpty() || request.BuildId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BuildId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("BuildId"), request.BuildId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("BuildId", request.BuildId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4397,10 +4034,10 @@ void UPlayFabAdminAPI::HelperRemoveServerBuild(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FAdminRemoveServerBuildResult result = UPlayFabAdminModelDecoder::decodeRemoveServerBuildResultResponse(response.responseData);
-        if (OnSuccessRemoveServerBuild.IsBound())
+        FAdminRemoveServerBuildResult result = UPlayFabAdminModelDecoder::readRemoveServerBuildResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRemoveServerBuild.Execute(result, mCustomData);
+            FDelegateOnSuccessRemoveServerBuild(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4416,12 +4053,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetPublisherData(FAdminSetPublisherDataReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperSetPublisherData);
 
@@ -4429,21 +4065,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetPublisherData(FAdminSetPublisherDataReque
     manager->PlayFabRequestURL = "/Admin/SetPublisherData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Value.IsEmpty() || request.Value == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Value"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Value"), request.Value);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Key", request.Key);
+    Writer.WriteString("Value", request.Value);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4461,10 +4091,10 @@ void UPlayFabAdminAPI::HelperSetPublisherData(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FAdminSetPublisherDataResult result = UPlayFabAdminModelDecoder::decodeSetPublisherDataResultResponse(response.responseData);
-        if (OnSuccessSetPublisherData.IsBound())
+        FAdminSetPublisherDataResult result = UPlayFabAdminModelDecoder::readSetPublisherDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetPublisherData.Execute(result, mCustomData);
+            FDelegateOnSuccessSetPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4480,12 +4110,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCloudScriptRevision(FAdminGetCloudScriptR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCloudScriptRevision = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetCloudScriptRevision);
 
@@ -4493,13 +4122,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCloudScriptRevision(FAdminGetCloudScriptR
     manager->PlayFabRequestURL = "/Admin/GetCloudScriptRevision";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetNumberField(TEXT("Revision"), request.Revision);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteNumber("Revision", request.Revision);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4517,10 +4149,14 @@ void UPlayFabAdminAPI::HelperGetCloudScriptRevision(FPlayFabBaseModel response,
     }
     else
     {
-        FAdminGetCloudScriptRevisionResult result = UPlayFabAdminModelDecoder::decodeGetCloudScriptRevisionResultResponse(response.responseData);
-        if (OnSuccessGetCloudScriptRevision.IsBound())
+        FAdminGetCloudScriptRevisionResult result = UPlayFabAdminModelDecoder::readGetCloudScriptRevisionResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetCloudScriptRevisionResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCloudScriptRevision.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCloudScriptRevision(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4532,12 +4168,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCloudScriptVersions(FAdminGetCloudScriptV
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCloudScriptVersions = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetCloudScriptVersions);
 
@@ -4545,11 +4180,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCloudScriptVersions(FAdminGetCloudScriptV
     manager->PlayFabRequestURL = "/Admin/GetCloudScriptVersions";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4567,10 +4205,14 @@ void UPlayFabAdminAPI::HelperGetCloudScriptVersions(FPlayFabBaseModel response,
     }
     else
     {
-        FAdminGetCloudScriptVersionsResult result = UPlayFabAdminModelDecoder::decodeGetCloudScriptVersionsResultResponse(response.responseData);
-        if (OnSuccessGetCloudScriptVersions.IsBound())
+        FAdminGetCloudScriptVersionsResult result = UPlayFabAdminModelDecoder::readGetCloudScriptVersionsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetCloudScriptVersionsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCloudScriptVersions.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCloudScriptVersions(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4582,12 +4224,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetPublishedRevision(FAdminSetPublishedRevis
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetPublishedRevision = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperSetPublishedRevision);
 
@@ -4595,13 +4236,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::SetPublishedRevision(FAdminSetPublishedRevis
     manager->PlayFabRequestURL = "/Admin/SetPublishedRevision";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetNumberField(TEXT("Revision"), request.Revision);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteNumber("Revision", request.Revision);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4619,10 +4262,10 @@ void UPlayFabAdminAPI::HelperSetPublishedRevision(FPlayFabBaseModel response, UO
     }
     else
     {
-        FAdminSetPublishedRevisionResult result = UPlayFabAdminModelDecoder::decodeSetPublishedRevisionResultResponse(response.responseData);
-        if (OnSuccessSetPublishedRevision.IsBound())
+        FAdminSetPublishedRevisionResult result = UPlayFabAdminModelDecoder::readSetPublishedRevisionResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetPublishedRevision.Execute(result, mCustomData);
+            FDelegateOnSuccessSetPublishedRevision(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4634,12 +4277,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateCloudScript(FAdminUpdateCloudScriptReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateCloudScript = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateCloudScript);
 
@@ -4647,22 +4289,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateCloudScript(FAdminUpdateCloudScriptReq
     manager->PlayFabRequestURL = "/Admin/UpdateCloudScript";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Files.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Files"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Files"), request.Files);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("Publish"), request.Publish);
-    if (request.DeveloperPlayFabId.IsEmpty() || request.DeveloperPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("DeveloperPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("DeveloperPlayFabId"), request.DeveloperPlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("Files", request.Files);
+    Writer.WriteBool("Publish", request.Publish);
+    Writer.WriteString("DeveloperPlayFabId", request.DeveloperPlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4680,10 +4315,10 @@ void UPlayFabAdminAPI::HelperUpdateCloudScript(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FAdminUpdateCloudScriptResult result = UPlayFabAdminModelDecoder::decodeUpdateCloudScriptResultResponse(response.responseData);
-        if (OnSuccessUpdateCloudScript.IsBound())
+        FAdminUpdateCloudScriptResult result = UPlayFabAdminModelDecoder::readUpdateCloudScriptResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateCloudScript.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateCloudScript(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4699,12 +4334,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteContent(FAdminDeleteContentRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessDeleteContent = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperDeleteContent);
 
@@ -4712,16 +4346,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteContent(FAdminDeleteContentRequest req
     manager->PlayFabRequestURL = "/Admin/DeleteContent";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Key", request.Key);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4739,10 +4370,10 @@ void UPlayFabAdminAPI::HelperDeleteContent(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FAdminBlankResult result = UPlayFabAdminModelDecoder::decodeBlankResultResponse(response.responseData);
-        if (OnSuccessDeleteContent.IsBound())
+        FAdminBlankResult result = UPlayFabAdminModelDecoder::readBlankResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessDeleteContent.Execute(result, mCustomData);
+            FDelegateOnSuccessDeleteContent(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4754,12 +4385,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetContentList(FAdminGetContentListRequest r
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetContentList = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetContentList);
 
@@ -4767,16 +4397,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetContentList(FAdminGetContentListRequest r
     manager->PlayFabRequestURL = "/Admin/GetContentList";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.Prefix.IsEmpty() || request.Prefix == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Prefix"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Prefix"), request.Prefix);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Prefix", request.Prefix);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4794,10 +4423,14 @@ void UPlayFabAdminAPI::HelperGetContentList(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FAdminGetContentListResult result = UPlayFabAdminModelDecoder::decodeGetContentListResultResponse(response.responseData);
-        if (OnSuccessGetContentList.IsBound())
+        FAdminGetContentListResult result = UPlayFabAdminModelDecoder::readGetContentListResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetContentListResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetContentList.Execute(result, mCustomData);
+            FDelegateOnSuccessGetContentList(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4809,12 +4442,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetContentUploadUrl(FAdminGetContentUploadUr
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetContentUploadUrl = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetContentUploadUrl);
 
@@ -4822,21 +4454,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetContentUploadUrl(FAdminGetContentUploadUr
     manager->PlayFabRequestURL = "/Admin/GetContentUploadUrl";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.ContentType.IsEmpty() || request.ContentType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContentType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContentType"), request.ContentType);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Key", request.Key);
+    Writer.WriteString("ContentType", request.ContentType);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4854,10 +4480,10 @@ void UPlayFabAdminAPI::HelperGetContentUploadUrl(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FAdminGetContentUploadUrlResult result = UPlayFabAdminModelDecoder::decodeGetContentUploadUrlResultResponse(response.responseData);
-        if (OnSuccessGetContentUploadUrl.IsBound())
+        FAdminGetContentUploadUrlResult result = UPlayFabAdminModelDecoder::readGetContentUploadUrlResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetContentUploadUrl.Execute(result, mCustomData);
+            FDelegateOnSuccessGetContentUploadUrl(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4873,12 +4499,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResetCharacterStatistics(FAdminResetCharacte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessResetCharacterStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperResetCharacterStatistics);
 
@@ -4886,21 +4511,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::ResetCharacterStatistics(FAdminResetCharacte
     manager->PlayFabRequestURL = "/Admin/ResetCharacterStatistics";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4918,10 +4536,10 @@ void UPlayFabAdminAPI::HelperResetCharacterStatistics(FPlayFabBaseModel response
     }
     else
     {
-        FAdminResetCharacterStatisticsResult result = UPlayFabAdminModelDecoder::decodeResetCharacterStatisticsResultResponse(response.responseData);
-        if (OnSuccessResetCharacterStatistics.IsBound())
+        FAdminResetCharacterStatisticsResult result = UPlayFabAdminModelDecoder::readResetCharacterStatisticsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessResetCharacterStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessResetCharacterStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4937,12 +4555,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddPlayerTag(FAdminAddPlayerTagRequest reque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddPlayerTag = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperAddPlayerTag);
 
@@ -4950,21 +4567,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AddPlayerTag(FAdminAddPlayerTagRequest reque
     manager->PlayFabRequestURL = "/Admin/AddPlayerTag";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.TagName.IsEmpty() || request.TagName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TagName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TagName"), request.TagName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("TagName", request.TagName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4982,10 +4592,10 @@ void UPlayFabAdminAPI::HelperAddPlayerTag(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FAdminAddPlayerTagResult result = UPlayFabAdminModelDecoder::decodeAddPlayerTagResultResponse(response.responseData);
-        if (OnSuccessAddPlayerTag.IsBound())
+        FAdminAddPlayerTagResult result = UPlayFabAdminModelDecoder::readAddPlayerTagResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddPlayerTag.Execute(result, mCustomData);
+            FDelegateOnSuccessAddPlayerTag(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4997,12 +4607,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetAllActionGroups(FAdminGetAllActionGroupsR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetAllActionGroups = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetAllActionGroups);
 
@@ -5010,11 +4619,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetAllActionGroups(FAdminGetAllActionGroupsR
     manager->PlayFabRequestURL = "/Admin/GetAllActionGroups";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5032,10 +4644,14 @@ void UPlayFabAdminAPI::HelperGetAllActionGroups(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FAdminGetAllActionGroupsResult result = UPlayFabAdminModelDecoder::decodeGetAllActionGroupsResultResponse(response.responseData);
-        if (OnSuccessGetAllActionGroups.IsBound())
+        FAdminGetAllActionGroupsResult result = UPlayFabAdminModelDecoder::readGetAllActionGroupsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetAllActionGroupsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetAllActionGroups.Execute(result, mCustomData);
+            FDelegateOnSuccessGetAllActionGroups(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5047,12 +4663,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetAllSegments(FAdminGetAllSegmentsRequest r
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetAllSegments = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetAllSegments);
 
@@ -5060,11 +4675,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetAllSegments(FAdminGetAllSegmentsRequest r
     manager->PlayFabRequestURL = "/Admin/GetAllSegments";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5082,10 +4700,14 @@ void UPlayFabAdminAPI::HelperGetAllSegments(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FAdminGetAllSegmentsResult result = UPlayFabAdminModelDecoder::decodeGetAllSegmentsResultResponse(response.responseData);
-        if (OnSuccessGetAllSegments.IsBound())
+        FAdminGetAllSegmentsResult result = UPlayFabAdminModelDecoder::readGetAllSegmentsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetAllSegmentsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetAllSegments.Execute(result, mCustomData);
+            FDelegateOnSuccessGetAllSegments(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5097,12 +4719,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerSegments(FAdminGetPlayersSegmentsRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerSegments = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetPlayerSegments);
 
@@ -5110,16 +4731,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerSegments(FAdminGetPlayersSegmentsRe
     manager->PlayFabRequestURL = "/Admin/GetPlayerSegments";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5137,10 +4757,14 @@ void UPlayFabAdminAPI::HelperGetPlayerSegments(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FAdminGetPlayerSegmentsResult result = UPlayFabAdminModelDecoder::decodeGetPlayerSegmentsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerSegments.IsBound())
+        FAdminGetPlayerSegmentsResult result = UPlayFabAdminModelDecoder::readGetPlayerSegmentsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetPlayerSegments.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillGetPlayerSegmentsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetPlayerSegments(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5152,12 +4776,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayersInSegment(FAdminGetPlayersInSegmen
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayersInSegment = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetPlayersInSegment);
 
@@ -5165,23 +4788,18 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayersInSegment(FAdminGetPlayersInSegmen
     manager->PlayFabRequestURL = "/Admin/GetPlayersInSegment";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.SegmentId.IsEmpty() || request.SegmentId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SegmentId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SegmentId"), request.SegmentId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("SecondsToLive"), request.SecondsToLive);
-    OutRestJsonObj->SetNumberField(TEXT("MaxBatchSize"), request.MaxBatchSize);
-    if (request.ContinuationToken.IsEmpty() || request.ContinuationToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContinuationToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContinuationToken"), request.ContinuationToken);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SegmentId", request.SegmentId);
+    Writer.WriteNumber("SecondsToLive", request.SecondsToLive);
+    Writer.WriteNumber("MaxBatchSize", request.MaxBatchSize);
+    Writer.WriteString("ContinuationToken", request.ContinuationToken);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5199,10 +4817,14 @@ void UPlayFabAdminAPI::HelperGetPlayersInSegment(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FAdminGetPlayersInSegmentResult result = UPlayFabAdminModelDecoder::decodeGetPlayersInSegmentResultResponse(response.responseData);
-        if (OnSuccessGetPlayersInSegment.IsBound())
+        FAdminGetPlayersInSegmentResult result = UPlayFabAdminModelDecoder::readGetPlayersInSegmentResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetPlayersInSegment.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillGetPlayersInSegmentResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetPlayersInSegment(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5214,12 +4836,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerTags(FAdminGetPlayerTagsRequest req
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerTags = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetPlayerTags);
 
@@ -5227,21 +4848,16 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetPlayerTags(FAdminGetPlayerTagsRequest req
     manager->PlayFabRequestURL = "/Admin/GetPlayerTags";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Namespace.IsEmpty() || request.Namespace == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Namespace"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Namespace"), request.Namespace);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("Namespace", request.Namespace);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5259,10 +4875,10 @@ void UPlayFabAdminAPI::HelperGetPlayerTags(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FAdminGetPlayerTagsResult result = UPlayFabAdminModelDecoder::decodeGetPlayerTagsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerTags.IsBound())
+        FAdminGetPlayerTagsResult result = UPlayFabAdminModelDecoder::readGetPlayerTagsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerTags.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerTags(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5274,12 +4890,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RemovePlayerTag(FAdminRemovePlayerTagRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRemovePlayerTag = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperRemovePlayerTag);
 
@@ -5287,21 +4902,14 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RemovePlayerTag(FAdminRemovePlayerTagRequest
     manager->PlayFabRequestURL = "/Admin/RemovePlayerTag";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.TagName.IsEmpty() || request.TagName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TagName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TagName"), request.TagName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("TagName", request.TagName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5319,10 +4927,10 @@ void UPlayFabAdminAPI::HelperRemovePlayerTag(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FAdminRemovePlayerTagResult result = UPlayFabAdminModelDecoder::decodeRemovePlayerTagResultResponse(response.responseData);
-        if (OnSuccessRemovePlayerTag.IsBound())
+        FAdminRemovePlayerTagResult result = UPlayFabAdminModelDecoder::readRemovePlayerTagResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRemovePlayerTag.Execute(result, mCustomData);
+            FDelegateOnSuccessRemovePlayerTag(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5338,12 +4946,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AbortTaskInstance(FAdminAbortTaskInstanceReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAbortTaskInstance = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperAbortTaskInstance);
 
@@ -5351,16 +4958,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::AbortTaskInstance(FAdminAbortTaskInstanceReq
     manager->PlayFabRequestURL = "/Admin/AbortTaskInstance";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.TaskInstanceId.IsEmpty() || request.TaskInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TaskInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TaskInstanceId"), request.TaskInstanceId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TaskInstanceId", request.TaskInstanceId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5378,10 +4982,10 @@ void UPlayFabAdminAPI::HelperAbortTaskInstance(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FAdminEmptyResult result = UPlayFabAdminModelDecoder::decodeEmptyResultResponse(response.responseData);
-        if (OnSuccessAbortTaskInstance.IsBound())
+        FAdminEmptyResult result = UPlayFabAdminModelDecoder::readEmptyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAbortTaskInstance.Execute(result, mCustomData);
+            FDelegateOnSuccessAbortTaskInstance(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5393,12 +4997,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(FAdminCr
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessCreateActionsOnPlayersInSegmentTask = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperCreateActionsOnPlayersInSegmentTask);
 
@@ -5406,28 +5009,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateActionsOnPlayersInSegmentTask(FAdminCr
     manager->PlayFabRequestURL = "/Admin/CreateActionsOnPlayersInSegmentTask";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
-    if (request.Description.IsEmpty() || request.Description == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Description"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Description"), request.Description);
-    }
-    if (request.Schedule.IsEmpty() || request.Schedule == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Schedule"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Schedule"), request.Schedule);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("IsActive"), request.IsActive);
-    if (request.Parameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("Parameter"), request.Parameter);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Name", request.Name);
+    Writer.WriteString("Description", request.Description);
+    Writer.WriteString("Schedule", request.Schedule);
+    Writer.WriteBool("IsActive", request.IsActive);
+    Writer.WriteObject("Parameter", request.Parameter);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5445,10 +5037,10 @@ void UPlayFabAdminAPI::HelperCreateActionsOnPlayersInSegmentTask(FPlayFabBaseMod
     }
     else
     {
-        FAdminCreateTaskResult result = UPlayFabAdminModelDecoder::decodeCreateTaskResultResponse(response.responseData);
-        if (OnSuccessCreateActionsOnPlayersInSegmentTask.IsBound())
+        FAdminCreateTaskResult result = UPlayFabAdminModelDecoder::readCreateTaskResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessCreateActionsOnPlayersInSegmentTask.Execute(result, mCustomData);
+            FDelegateOnSuccessCreateActionsOnPlayersInSegmentTask(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5460,12 +5052,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateCloudScriptTask(FAdminCreateCloudScrip
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessCreateCloudScriptTask = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperCreateCloudScriptTask);
 
@@ -5473,28 +5064,17 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::CreateCloudScriptTask(FAdminCreateCloudScrip
     manager->PlayFabRequestURL = "/Admin/CreateCloudScriptTask";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
-    if (request.Description.IsEmpty() || request.Description == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Description"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Description"), request.Description);
-    }
-    if (request.Schedule.IsEmpty() || request.Schedule == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Schedule"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Schedule"), request.Schedule);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("IsActive"), request.IsActive);
-    if (request.Parameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("Parameter"), request.Parameter);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Name", request.Name);
+    Writer.WriteString("Description", request.Description);
+    Writer.WriteString("Schedule", request.Schedule);
+    Writer.WriteBool("IsActive", request.IsActive);
+    Writer.WriteObject("Parameter", request.Parameter);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5512,10 +5092,10 @@ void UPlayFabAdminAPI::HelperCreateCloudScriptTask(FPlayFabBaseModel response, U
     }
     else
     {
-        FAdminCreateTaskResult result = UPlayFabAdminModelDecoder::decodeCreateTaskResultResponse(response.responseData);
-        if (OnSuccessCreateCloudScriptTask.IsBound())
+        FAdminCreateTaskResult result = UPlayFabAdminModelDecoder::readCreateTaskResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessCreateCloudScriptTask.Execute(result, mCustomData);
+            FDelegateOnSuccessCreateCloudScriptTask(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5527,12 +5107,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteTask(FAdminDeleteTaskRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessDeleteTask = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperDeleteTask);
 
@@ -5540,12 +5119,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::DeleteTask(FAdminDeleteTaskRequest request,
     manager->PlayFabRequestURL = "/Admin/DeleteTask";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Identifier != nullptr) OutRestJsonObj->SetObjectField(TEXT("Identifier"), request.Identifier);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("Identifier", request.Identifier);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5563,10 +5143,10 @@ void UPlayFabAdminAPI::HelperDeleteTask(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FAdminEmptyResult result = UPlayFabAdminModelDecoder::decodeEmptyResultResponse(response.responseData);
-        if (OnSuccessDeleteTask.IsBound())
+        FAdminEmptyResult result = UPlayFabAdminModelDecoder::readEmptyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessDeleteTask.Execute(result, mCustomData);
+            FDelegateOnSuccessDeleteTask(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5578,12 +5158,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(FAd
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetActionsOnPlayersInSegmentTaskInstance = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetActionsOnPlayersInSegmentTaskInstance);
 
@@ -5591,16 +5170,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetActionsOnPlayersInSegmentTaskInstance(FAd
     manager->PlayFabRequestURL = "/Admin/GetActionsOnPlayersInSegmentTaskInstance";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.TaskInstanceId.IsEmpty() || request.TaskInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TaskInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TaskInstanceId"), request.TaskInstanceId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TaskInstanceId", request.TaskInstanceId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5618,10 +5196,14 @@ void UPlayFabAdminAPI::HelperGetActionsOnPlayersInSegmentTaskInstance(FPlayFabBa
     }
     else
     {
-        FAdminGetActionsOnPlayersInSegmentTaskInstanceResult result = UPlayFabAdminModelDecoder::decodeGetActionsOnPlayersInSegmentTaskInstanceResultResponse(response.responseData);
-        if (OnSuccessGetActionsOnPlayersInSegmentTaskInstance.IsBound())
+        FAdminGetActionsOnPlayersInSegmentTaskInstanceResult result = UPlayFabAdminModelDecoder::readGetActionsOnPlayersInSegmentTaskInstanceResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabAdminModelDecoder::fillGetActionsOnPlayersInSegmentTaskInstanceResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetActionsOnPlayersInSegmentTaskInstance.Execute(result, mCustomData);
+            FDelegateOnSuccessGetActionsOnPlayersInSegmentTaskInstance(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5633,12 +5215,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCloudScriptTaskInstance(FAdminGetTaskInst
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCloudScriptTaskInstance = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetCloudScriptTaskInstance);
 
@@ -5646,16 +5227,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetCloudScriptTaskInstance(FAdminGetTaskInst
     manager->PlayFabRequestURL = "/Admin/GetCloudScriptTaskInstance";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.TaskInstanceId.IsEmpty() || request.TaskInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TaskInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TaskInstanceId"), request.TaskInstanceId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TaskInstanceId", request.TaskInstanceId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5673,10 +5253,14 @@ void UPlayFabAdminAPI::HelperGetCloudScriptTaskInstance(FPlayFabBaseModel respon
     }
     else
     {
-        FAdminGetCloudScriptTaskInstanceResult result = UPlayFabAdminModelDecoder::decodeGetCloudScriptTaskInstanceResultResponse(response.responseData);
-        if (OnSuccessGetCloudScriptTaskInstance.IsBound())
+        FAdminGetCloudScriptTaskInstanceResult result = UPlayFabAdminModelDecoder::readGetCloudScriptTaskInstanceResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetCloudScriptTaskInstance.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillGetCloudScriptTaskInstanceResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetCloudScriptTaskInstance(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5688,12 +5272,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTaskInstances(FAdminGetTaskInstancesReque
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTaskInstances = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetTaskInstances);
 
@@ -5701,25 +5284,18 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTaskInstances(FAdminGetTaskInstancesReque
     manager->PlayFabRequestURL = "/Admin/GetTaskInstances";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.TaskIdentifier != nullptr) OutRestJsonObj->SetObjectField(TEXT("TaskIdentifier"), request.TaskIdentifier);
-    FString temp_StatusFilter;
-    if (GetEnumValueToString<ETaskInstanceStatus>(TEXT("ETaskInstanceStatus"), request.StatusFilter, temp_StatusFilter))
-        OutRestJsonObj->SetStringField(TEXT("StatusFilter"), temp_StatusFilter);
-    if (request.StartedAtRangeFrom.IsEmpty() || request.StartedAtRangeFrom == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StartedAtRangeFrom"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StartedAtRangeFrom"), request.StartedAtRangeFrom);
-    }
-    if (request.StartedAtRangeTo.IsEmpty() || request.StartedAtRangeTo == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StartedAtRangeTo"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StartedAtRangeTo"), request.StartedAtRangeTo);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("TaskIdentifier", request.TaskIdentifier);
+    Writer.WriteEnum("StatusFilter", GetEnumName(request.StatusFilter));
+    Writer.WriteString("StartedAtRangeFrom", request.StartedAtRangeFrom);
+    Writer.WriteString("StartedAtRangeTo", request.StartedAtRangeTo);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5737,10 +5313,14 @@ void UPlayFabAdminAPI::HelperGetTaskInstances(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FAdminGetTaskInstancesResult result = UPlayFabAdminModelDecoder::decodeGetTaskInstancesResultResponse(response.responseData);
-        if (OnSuccessGetTaskInstances.IsBound())
+        FAdminGetTaskInstancesResult result = UPlayFabAdminModelDecoder::readGetTaskInstancesResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetTaskInstances.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillGetTaskInstancesResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetTaskInstances(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5752,12 +5332,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTasks(FAdminGetTasksRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTasks = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperGetTasks);
 
@@ -5765,12 +5344,15 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::GetTasks(FAdminGetTasksRequest request,
     manager->PlayFabRequestURL = "/Admin/GetTasks";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.Identifier != nullptr) OutRestJsonObj->SetObjectField(TEXT("Identifier"), request.Identifier);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("Identifier", request.Identifier);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5788,10 +5370,14 @@ void UPlayFabAdminAPI::HelperGetTasks(FPlayFabBaseModel response, UObject* custo
     }
     else
     {
-        FAdminGetTasksResult result = UPlayFabAdminModelDecoder::decodeGetTasksResultResponse(response.responseData);
-        if (OnSuccessGetTasks.IsBound())
+        FAdminGetTasksResult result = UPlayFabAdminModelDecoder::readGetTasksResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetTasks.Execute(result, mCustomData);
+            UPlayFabAdminModelDecoder::fillGetTasksResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetTasks(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5803,12 +5389,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RunTask(FAdminRunTaskRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRunTask = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperRunTask);
 
@@ -5816,12 +5401,13 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::RunTask(FAdminRunTaskRequest request,
     manager->PlayFabRequestURL = "/Admin/RunTask";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Identifier != nullptr) OutRestJsonObj->SetObjectField(TEXT("Identifier"), request.Identifier);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("Identifier", request.Identifier);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5839,10 +5425,10 @@ void UPlayFabAdminAPI::HelperRunTask(FPlayFabBaseModel response, UObject* custom
     }
     else
     {
-        FAdminRunTaskResult result = UPlayFabAdminModelDecoder::decodeRunTaskResultResponse(response.responseData);
-        if (OnSuccessRunTask.IsBound())
+        FAdminRunTaskResult result = UPlayFabAdminModelDecoder::readRunTaskResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRunTask.Execute(result, mCustomData);
+            FDelegateOnSuccessRunTask(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5854,12 +5440,11 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateTask(FAdminUpdateTaskRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabAdminAPI* manager = NewObject<UPlayFabAdminAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabAdminAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabAdminAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateTask = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabAdminAPI::HelperUpdateTask);
 
@@ -5867,32 +5452,19 @@ UPlayFabAdminAPI* UPlayFabAdminAPI::UpdateTask(FAdminUpdateTaskRequest request,
     manager->PlayFabRequestURL = "/Admin/UpdateTask";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.Identifier != nullptr) OutRestJsonObj->SetObjectField(TEXT("Identifier"), request.Identifier);
-    if (request.Name.IsEmpty() || request.Name == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Name"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Name"), request.Name);
-    }
-    if (request.Description.IsEmpty() || request.Description == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Description"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Description"), request.Description);
-    }
-    if (request.Schedule.IsEmpty() || request.Schedule == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Schedule"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Schedule"), request.Schedule);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("IsActive"), request.IsActive);
-    FString temp_Type;
-    if (GetEnumValueToString<EScheduledTaskType>(TEXT("EScheduledTaskType"), request.Type, temp_Type))
-        OutRestJsonObj->SetStringField(TEXT("Type"), temp_Type);
-    if (request.Parameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("Parameter"), request.Parameter);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObject("Identifier", request.Identifier);
+    Writer.WriteString("Name", request.Name);
+    Writer.WriteString("Description", request.Description);
+    Writer.WriteString("Schedule", request.Schedule);
+    Writer.WriteBool("IsActive", request.IsActive);
+    Writer.WriteEnum("Type", GetEnumName(request.Type));
+    Writer.WriteObject("Parameter", request.Parameter);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5910,17 +5482,17 @@ void UPlayFabAdminAPI::HelperUpdateTask(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FAdminEmptyResult result = UPlayFabAdminModelDecoder::decodeEmptyResultResponse(response.responseData);
-        if (OnSuccessUpdateTask.IsBound())
+        FAdminEmptyResult result = UPlayFabAdminModelDecoder::readEmptyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateTask.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateTask(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
 
 
 
-void UPlayFabAdminAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+void UPlayFabAdminAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed)
 {
     // Be sure that we have no data from previous response
     ResetResponseData();
@@ -5933,6 +5505,7 @@ void UPlayFabAdminAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRe
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
+        ReleaseToPool();
         return;
     }
 
@@ -5949,23 +5522,29 @@ void UPlayFabAdminAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRe
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        // Requests dropped from a full dispatcher queue were never started
+        if (Request->GetStatus() == EHttpRequestStatus::NotStarted)
+        {
+            myResponse.responseError.ErrorName = "Request dropped";
+            myResponse.responseError.ErrorMessage = "The request queue for this priority class was full";
+        }
+
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
+        ReleaseToPool();
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
-
     // Save response code as int32
     ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
-
-    // Decide whether the request was successful
-    bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
+    // The body was inflated, parsed and checked for errors on a worker thread
+    bIsValidJsonResponse = Parsed.bValidJson;
+    if (Parsed.Json.IsValid())
+    {
+        // Edits made through responseData must not reach the response cache, or other callers sharing the json
+        ResponseJsonObj->GetRootObject() = Parsed.bShared ? FPlayFabJsonView(Parsed.Json).CopyJsonObject() : Parsed.Json;
+    }
 
     // Log errors
     if (!bIsValidJsonResponse)
@@ -5973,24 +5552,52 @@ void UPlayFabAdminAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpRe
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
     }
 
-    // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
-
-    myResponse.responseError.decodeError(ResponseJsonObj);
+    myResponse.responseError = Parsed.Error;
     myResponse.responseData = ResponseJsonObj;
-    IPlayFab* pfSettings = &(IPlayFab::Get());
+    myResponse.responseBody = Parsed.Body;
 
-    // Broadcast the result event
+    // Broadcast the result event, after which the response data is no longer ours to keep
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
+    ReleaseToPool();
 }
 
 void UPlayFabAdminAPI::Activate()
+{
+    // From here the dispatcher holds the call, however long it takes
+    FPlayFabManagerPool::Get().MarkActivated(this);
+
+    FPlayFabDispatchInfo DispatchInfo;
+    DispatchInfo.Endpoint = PlayFabRequestURL;
+    DispatchInfo.Priority = requestPriority;
+    DispatchInfo.bIdempotent = isIdempotent;
+    DispatchInfo.bReadOnly = isReadOnly;
+    if (RequestBody.Num() == 0 && RequestJsonObj != nullptr)
+    {
+        // Built as a json tree by the caller rather than streamed by a factory
+        DispatchInfo.Body = RequestJsonObj->GetRootObject();
+    }
+    DispatchInfo.OnResponse = FPlayFabResponseDelegate::CreateUObject(this, &UPlayFabAdminAPI::OnProcessRequestComplete);
+
+    // The generated decoders read the body itself, so the tree is only built for the login handling or other listeners
+    DispatchInfo.bNeedsJsonTree = isLoginRequest;
+    for (const UObject* Listener : OnPlayFabResponse.GetAllObjects())
+    {
+        DispatchInfo.bNeedsJsonTree |= Listener != this;
+    }
+
+    // Hand the request to the dispatcher, which sends it as soon as a connection is free
+    FPlayFabRequestDispatcher::Get().Submit(this, BuildHttpRequest(), DispatchInfo);
+}
+
+TSharedRef<IHttpRequest> UPlayFabAdminAPI::BuildHttpRequest()
 {
     IPlayFab* pfSettings = &(IPlayFab::Get());
 
+    // Read the title and credentials from one snapshot, so a login completing meanwhile can't mix two sessions
+    const FPlayFabSettings& Settings = pfSettings->GetSettings();
+
     FString RequestUrl;
-    RequestUrl = TEXT("https://") + pfSettings->getGameTitleId() + IPlayFab::PlayFabURL + PlayFabRequestURL;
+    RequestUrl = Settings.GetUrl(PlayFabRequestURL);
 
     TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
     HttpRequest->SetURL(RequestUrl);
@@ -5998,31 +5605,19 @@ void UPlayFabAdminAPI::Activate()
 
     // Headers
     if (useSessionTicket)
-        HttpRequest->SetHeader("X-Authentication", pfSettings->getSessionTicket());
+        HttpRequest->SetHeader("X-Authentication", Settings.SessionTicket);
     if (useSecretKey)
-        HttpRequest->SetHeader("X-SecretKey", pfSettings->getSecretApiKey());
+        HttpRequest->SetHeader("X-SecretKey", Settings.SecretApiKey);
     HttpRequest->SetHeader("Content-Type", "application/json");
+    HttpRequest->SetHeader("Accept-Encoding", "gzip, deflate");
     HttpRequest->SetHeader(TEXT("X-PlayFabSDK"), pfSettings->VersionString);
     HttpRequest->SetHeader("X-ReportErrorAsSuccess", "true"); // FHttpResponsePtr doesn't provide sufficient information when an error code is returned
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
+    if (RequestBody.Num() > 0)
+        HttpRequest->SetContent(RequestBody);
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
-
-    // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
-
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
-
-    // Bind event
-    HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabAdminAPI::OnProcessRequestComplete);
-
-    // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    return HttpRequest;
 }
 
 void UPlayFabAdminAPI::ResetResponseData()
@@ -6038,3 +5633,37 @@ void UPlayFabAdminAPI::ResetResponseData()
 
     bIsValidJsonResponse = false;
 }
+
+void UPlayFabAdminAPI::ReleaseToPool()
+{
+    FPlayFabManagerPool& Pool = FPlayFabManagerPool::Get();
+    if (!Pool.IsEnabled() || FPlayFabManagerPool::IsHeldOutside(this, OnPlayFabResponse, OnSuccess, OnFailure))
+    {
+        // Not reused, so the response is left for whoever still holds this call
+        Pool.Discard(this);
+        return;
+    }
+
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    OnSuccess.Unbind();
+    mCustomData = nullptr;
+
+    PlayFabRequestURL.Empty();
+    useSecretKey = false;
+    useSessionTicket = false;
+    isLoginRequest = false;
+    requestPriority = EPlayFabRequestPriority::Normal;
+    isIdempotent = false;
+    isReadOnly = false;
+    RequestHeaders.Empty();
+    RequestBody.Reset();
+
+    if (RequestJsonObj != nullptr)
+    {
+        RequestJsonObj->Reset();
+    }
+    ResetResponseData();
+
+    Pool.Release(this);
+}
@@ -0,0 +1,333 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab metrics.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabMetrics.h"
+
+FPlayFabMetrics* FPlayFabMetrics::Instance = nullptr;
+
+static void DumpMetricsToLog()
+{
+    if (FPlayFabMetrics::IsAvailable())
+    {
+        FPlayFabMetrics::Get().Dump(*GLog);
+    }
+}
+
+static FAutoConsoleCommand DumpMetricsCommand(
+    TEXT("PlayFab.DumpMetrics"),
+    TEXT("Write per-endpoint PlayFab latency, size and error metrics to the log"),
+    FConsoleCommandDelegate::CreateStatic(&DumpMetricsToLog));
+
+static const TCHAR* StageNames[FPlayFabEndpointMetrics::StageCount] = { TEXT("queue"), TEXT("net"), TEXT("decode"), TEXT("parse"), TEXT("callback") };
+
+int32 FPlayFabHistogram::GetBucket(uint64 Value)
+{
+    Value = FMath::Min<uint64>(Value, MAX_uint32);
+    if (Value < SubBucketCount)
+    {
+        return (int32)Value;
+    }
+
+    const int32 Shift = FMath::FloorLog2_64(Value) - SubBucketBits;
+    const int32 SubBucket = (int32)(Value >> Shift) - SubBucketCount;
+    return (Shift + 1) * SubBucketCount + SubBucket;
+}
+
+uint64 FPlayFabHistogram::GetBucketUpperBound(int32 Bucket)
+{
+    if (Bucket < SubBucketCount)
+    {
+        return Bucket;
+    }
+
+    const int32 Shift = Bucket / SubBucketCount - 1;
+    const uint64 SubBucket = Bucket % SubBucketCount;
+    return ((SubBucketCount + SubBucket + 1) << Shift) - 1;
+}
+
+void FPlayFabHistogram::Record(uint64 Value)
+{
+    FPlatformAtomics::InterlockedIncrement(&Buckets[GetBucket(Value)]);
+    FPlatformAtomics::InterlockedIncrement(&Count);
+    FPlatformAtomics::InterlockedAdd(&Sum, (int64)Value);
+
+    int64 Seen = Max;
+    while ((int64)Value > Seen)
+    {
+        const int64 Previous = FPlatformAtomics::InterlockedCompareExchange(&Max, (int64)Value, Seen);
+        if (Previous == Seen)
+        {
+            break;
+        }
+        Seen = Previous;
+    }
+}
+
+void FPlayFabHistogram::Reset()
+{
+    for (volatile int32& Bucket : Buckets)
+    {
+        Bucket = 0;
+    }
+    Count = 0;
+    Sum = 0;
+    Max = 0;
+}
+
+uint64 FPlayFabHistogram::GetPercentile(float Percentile) const
+{
+    // Counts may move while we read, so rank against the buckets' own total
+    int64 Total = 0;
+    for (const volatile int32& Bucket : Buckets)
+    {
+        Total += Bucket;
+    }
+    if (Total == 0)
+    {
+        return 0;
+    }
+
+    const int64 Rank = FMath::Max<int64>(1, FMath::CeilToInt(FMath::Clamp(Percentile, 0.0f, 100.0f) / 100.0f * Total));
+    int64 Seen = 0;
+    for (int32 Bucket = 0; Bucket < BucketCount; ++Bucket)
+    {
+        Seen += Buckets[Bucket];
+        if (Seen >= Rank)
+        {
+            return FMath::Min<uint64>(GetBucketUpperBound(Bucket), GetMax());
+        }
+    }
+    return GetMax();
+}
+
+FPlayFabEndpointMetrics::FPlayFabEndpointMetrics(const ANSICHAR* InName)
+{
+    FCStringAnsi::Strncpy(Name, InName, ARRAY_COUNT(Name));
+    Reset();
+}
+
+void FPlayFabEndpointMetrics::Reset()
+{
+    for (FPlayFabHistogram& Stage : Stages)
+    {
+        Stage.Reset();
+    }
+    RequestBytes.Reset();
+    ResponseBytes.Reset();
+    Attempts = 0;
+    Errors = 0;
+    for (FErrorCount& Entry : ErrorCodes)
+    {
+        Entry.Count = 0;
+        Entry.ErrorCode = MIN_int32;
+    }
+}
+
+void FPlayFabEndpointMetrics::AddError(int32 ErrorCode)
+{
+    FPlatformAtomics::InterlockedIncrement(&Errors);
+    for (FErrorCount& Entry : ErrorCodes)
+    {
+        const int32 Code = Entry.ErrorCode;
+        if (Code == ErrorCode || (Code == MIN_int32 && (FPlatformAtomics::InterlockedCompareExchange(&Entry.ErrorCode, ErrorCode, MIN_int32) == MIN_int32 || Entry.ErrorCode == ErrorCode)))
+        {
+            FPlatformAtomics::InterlockedIncrement(&Entry.Count);
+            return;
+        }
+    }
+}
+
+int32 FPlayFabEndpointMetrics::GetErrorCodeCount(int32 ErrorCode) const
+{
+    for (const FErrorCount& Entry : ErrorCodes)
+    {
+        if (Entry.ErrorCode == ErrorCode)
+        {
+            return Entry.Count;
+        }
+    }
+    return 0;
+}
+
+void FPlayFabEndpointMetrics::GetErrorCodeCounts(TMap<int32, int32>& OutCounts) const
+{
+    OutCounts.Reset();
+    for (const FErrorCount& Entry : ErrorCodes)
+    {
+        if (Entry.ErrorCode != MIN_int32)
+        {
+            OutCounts.Add(Entry.ErrorCode, Entry.Count);
+        }
+    }
+}
+
+void FPlayFabMetrics::Startup()
+{
+    if (Instance == nullptr)
+    {
+        Instance = new FPlayFabMetrics();
+    }
+}
+
+void FPlayFabMetrics::Shutdown()
+{
+    delete Instance;
+    Instance = nullptr;
+}
+
+FPlayFabMetrics& FPlayFabMetrics::Get()
+{
+    check(Instance != nullptr);
+    return *Instance;
+}
+
+FPlayFabMetrics::FPlayFabMetrics()
+{
+    static_assert((MaxEndpoints & (MaxEndpoints - 1)) == 0, "MaxEndpoints must be a power of two");
+    for (FPlayFabEndpointMetrics* volatile& Slot : Slots)
+    {
+        Slot = nullptr;
+    }
+}
+
+FPlayFabMetrics::~FPlayFabMetrics()
+{
+    for (FPlayFabEndpointMetrics* volatile& Slot : Slots)
+    {
+        delete Slot;
+        Slot = nullptr;
+    }
+}
+
+FPlayFabEndpointMetrics* FPlayFabMetrics::FindSlot(const FString& Endpoint, bool bCreate) const
+{
+    const FTCHARToUTF8 Name(*Endpoint, Endpoint.Len());
+    const uint32 Mask = MaxEndpoints - 1;
+    const uint32 Home = FCrc::MemCrc32(Name.Get(), Name.Length()) & Mask;
+
+    for (uint32 Probe = 0; Probe < (uint32)MaxEndpoints; ++Probe)
+    {
+        FPlayFabEndpointMetrics* volatile& Slot = Slots[(Home + Probe) & Mask];
+        FPlayFabEndpointMetrics* Existing = Slot;
+        if (Existing == nullptr)
+        {
+            if (!bCreate)
+            {
+                return nullptr;
+            }
+
+            // Fill the entry before publishing it. If another thread claimed the slot first, check what it put there
+            FPlayFabEndpointMetrics* Created = new FPlayFabEndpointMetrics(Name.Get());
+            Existing = (FPlayFabEndpointMetrics*)FPlatformAtomics::InterlockedCompareExchangePointer((void**)&Slot, Created, nullptr);
+            if (Existing == nullptr)
+            {
+                return Created;
+            }
+            delete Created;
+        }
+
+        if (FCStringAnsi::Strncmp(Existing->Name, Name.Get(), ARRAY_COUNT(Existing->Name) - 1) == 0)
+        {
+            return Existing;
+        }
+    }
+
+    // Out of slots, the generated APIs have fewer endpoints than this
+    return nullptr;
+}
+
+void FPlayFabMetrics::RecordAttempt(const FString& Endpoint, const FPlayFabAttemptSample& Sample)
+{
+    FPlayFabEndpointMetrics* Metrics = FindSlot(Endpoint, true);
+    if (Metrics == nullptr)
+    {
+        return;
+    }
+
+    FPlatformAtomics::InterlockedIncrement(&Metrics->Attempts);
+    for (int32 Stage = 0; Stage < FPlayFabEndpointMetrics::StageCount; ++Stage)
+    {
+        if (Sample.StageMicros[Stage] >= 0)
+        {
+            Metrics->Stages[Stage].Record(Sample.StageMicros[Stage]);
+        }
+    }
+    Metrics->RequestBytes.Record(FMath::Max(Sample.RequestBytes, 0));
+    if (Sample.ResponseBytes > 0)
+    {
+        Metrics->ResponseBytes.Record(Sample.ResponseBytes);
+    }
+    if (Sample.bFailed)
+    {
+        Metrics->AddError(Sample.ErrorCode);
+    }
+}
+
+void FPlayFabMetrics::RecordStage(const FString& Endpoint, EPlayFabCallStage Stage, int64 Micros)
+{
+    FPlayFabEndpointMetrics* Metrics = FindSlot(Endpoint, true);
+    if (Metrics != nullptr)
+    {
+        Metrics->Stages[(int32)Stage].Record(FMath::Max<int64>(Micros, 0));
+    }
+}
+
+const FPlayFabEndpointMetrics* FPlayFabMetrics::Find(const FString& Endpoint) const
+{
+    return FindSlot(Endpoint, false);
+}
+
+void FPlayFabMetrics::GetEndpoints(TArray<const FPlayFabEndpointMetrics*>& OutEndpoints) const
+{
+    OutEndpoints.Reset();
+    for (FPlayFabEndpointMetrics* Slot : Slots)
+    {
+        if (Slot != nullptr)
+        {
+            OutEndpoints.Add(Slot);
+        }
+    }
+}
+
+void FPlayFabMetrics::Reset()
+{
+    for (FPlayFabEndpointMetrics* Slot : Slots)
+    {
+        if (Slot != nullptr)
+        {
+            Slot->Reset();
+        }
+    }
+}
+
+void FPlayFabMetrics::Dump(FOutputDevice& Ar) const
+{
+    TArray<const FPlayFabEndpointMetrics*> Endpoints;
+    GetEndpoints(Endpoints);
+    Endpoints.Sort([](const FPlayFabEndpointMetrics& A, const FPlayFabEndpointMetrics& B) { return FCStringAnsi::Strcmp(A.GetName(), B.GetName()) < 0; });
+
+    Ar.Logf(TEXT("PlayFab metrics for %d endpoints (p50/p90/p99, ms):"), Endpoints.Num());
+    for (const FPlayFabEndpointMetrics* Metrics : Endpoints)
+    {
+        Ar.Logf(TEXT("  %s attempts=%d errors=%d req=%.0fB resp=%.0fB (mean)"), ANSI_TO_TCHAR(Metrics->GetName()),
+            Metrics->GetAttemptCount(), Metrics->GetErrorCount(), Metrics->GetRequestBytes().GetMean(), Metrics->GetResponseBytes().GetMean());
+
+        FString Stages;
+        for (int32 Stage = 0; Stage < FPlayFabEndpointMetrics::StageCount; ++Stage)
+        {
+            const FPlayFabHistogram& Histogram = Metrics->GetStage((EPlayFabCallStage)Stage);
+            Stages += FString::Printf(TEXT(" %s=%.2f/%.2f/%.2f"), StageNames[Stage],
+                Histogram.GetPercentile(50.0f) / 1000.0, Histogram.GetPercentile(90.0f) / 1000.0, Histogram.GetPercentile(99.0f) / 1000.0);
+        }
+        Ar.Logf(TEXT("   %s"), *Stages);
+
+        TMap<int32, int32> ErrorCodes;
+        Metrics->GetErrorCodeCounts(ErrorCodes);
+        for (const TPair<int32, int32>& Entry : ErrorCodes)
+        {
+            Ar.Logf(TEXT("    error %d x%d"), Entry.Key, Entry.Value);
+        }
+    }
+}
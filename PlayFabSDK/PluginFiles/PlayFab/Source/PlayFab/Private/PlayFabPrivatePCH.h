@@ -17,5 +17,12 @@
 DECLARE_LOG_CATEGORY_EXTERN(LogPlayFab, Log, All);
 
 #include "IPlayFab.h"
+#include "PlayFabManagerPool.h"
+#include "PlayFabRequestDispatcher.h"
+#include "PlayFabResponseReader.h"
+#include "PlayFabTracer.h"
+#include "PlayFabMetrics.h"
+#include "PlayFabCatalogIndex.h"
+#include "PlayFabStandInServer.h"
 
 #include "PlayFabClasses.h"
@@ -0,0 +1,77 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab retry policy.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabRetryPolicy.h"
+#include "PlayFabErrorCodes.h"
+
+FPlayFabRetryPolicy::EOutcome FPlayFabRetryPolicy::Classify(FHttpResponsePtr Response, bool bWasSuccessful, const FJsonObject* Json)
+{
+    if (!bWasSuccessful || !Response.IsValid())
+    {
+        return EOutcome::Transient;
+    }
+
+    const int32 HttpCode = Response->GetResponseCode();
+    if (HttpCode == 429)
+    {
+        return EOutcome::Throttled;
+    }
+    if (HttpCode >= 500)
+    {
+        return EOutcome::Transient;
+    }
+
+    // Errors are reported as successful http responses, so look at the body
+    if (Json == nullptr)
+    {
+        // A truncated or garbled body is a transport problem
+        return EOutcome::Transient;
+    }
+
+    int32 Code = 200;
+    int32 ErrorCode = 0;
+    Json->TryGetNumberField(TEXT("code"), Code);
+    Json->TryGetNumberField(TEXT("errorCode"), ErrorCode);
+    if (Code == 200)
+    {
+        return EOutcome::Success;
+    }
+
+    const EPlayFabErrorCategory Category = FPlayFabErrorCodes::GetCategory(ErrorCode);
+    if (Code == 429 || Category == EPlayFabErrorCategory::Throttled)
+    {
+        return EOutcome::Throttled;
+    }
+    if (Code >= 500 || Category == EPlayFabErrorCategory::Retryable)
+    {
+        return EOutcome::Transient;
+    }
+    return EOutcome::Permanent;
+}
+
+bool FPlayFabRetryPolicy::ShouldRetry(EOutcome Outcome, bool bIdempotent, int32 Attempts) const
+{
+    if (Attempts >= MaxAttempts)
+    {
+        return false;
+    }
+
+    switch (Outcome)
+    {
+    case EOutcome::Throttled:
+        return true;
+    case EOutcome::Transient:
+        // The first attempt may have been applied, so only repeat calls that are safe to apply twice
+        return bIdempotent;
+    default:
+        return false;
+    }
+}
+
+float FPlayFabRetryPolicy::GetBackoffDelay(int32 Attempts) const
+{
+    const float Ceiling = FMath::Min(MaxDelaySeconds, BaseDelaySeconds * FMath::Pow(2.0f, (float)FMath::Max(Attempts - 1, 0)));
+    return FMath::FRandRange(0.0f, Ceiling);
+}
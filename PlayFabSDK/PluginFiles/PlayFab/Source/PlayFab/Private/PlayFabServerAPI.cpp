@@ -6,6 +6,7 @@
 
 #include "PlayFabPrivatePCH.h"
 #include "PlayFabEnums.h"
+#include "PlayFabRequestWriter.h"
 #include "PlayFabServerAPI.h"
 
 UPlayFabServerAPI::UPlayFabServerAPI(const FObjectInitializer& ObjectInitializer)
@@ -16,6 +17,16 @@ UPlayFabServerAPI::UPlayFabServerAPI(const FObjectInitializer& ObjectInitializer
 void UPlayFabServerAPI::SetRequestObject(UPlayFabJsonObject* JsonObject)
 {
     RequestJsonObj = JsonObject;
+    RequestBody.Reset();
+}
+
+UPlayFabJsonObject* UPlayFabServerAPI::GetRequestObject()
+{
+    if (RequestJsonObj == nullptr)
+    {
+        RequestJsonObj = NewObject<UPlayFabJsonObject>();
+    }
+    return RequestJsonObj;
 }
 
 UPlayFabJsonObject* UPlayFabServerAPI::GetResponseObject()
@@ -67,12 +78,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::AuthenticateSessionTicket(FServerAuthentic
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAuthenticateSessionTicket = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperAuthenticateSessionTicket);
 
@@ -80,16 +90,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::AuthenticateSessionTicket(FServerAuthentic
     manager->PlayFabRequestURL = "/Server/AuthenticateSessionTicket";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.SessionTicket.IsEmpty() || request.SessionTicket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SessionTicket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SessionTicket"), request.SessionTicket);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SessionTicket", request.SessionTicket);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -107,10 +116,14 @@ void UPlayFabServerAPI::HelperAuthenticateSessionTicket(FPlayFabBaseModel respon
     }
     else
     {
-        FServerAuthenticateSessionTicketResult result = UPlayFabServerModelDecoder::decodeAuthenticateSessionTicketResultResponse(response.responseData);
-        if (OnSuccessAuthenticateSessionTicket.IsBound())
+        FServerAuthenticateSessionTicketResult result = UPlayFabServerModelDecoder::readAuthenticateSessionTicketResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillAuthenticateSessionTicketResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAuthenticateSessionTicket.Execute(result, mCustomData);
+            FDelegateOnSuccessAuthenticateSessionTicket(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -122,12 +135,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetPlayerSecret(FServerSetPlayerSecretRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetPlayerSecret = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperSetPlayerSecret);
 
@@ -135,21 +147,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetPlayerSecret(FServerSetPlayerSecretRequ
     manager->PlayFabRequestURL = "/Server/SetPlayerSecret";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayerSecret.IsEmpty() || request.PlayerSecret == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayerSecret"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayerSecret"), request.PlayerSecret);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayerSecret", request.PlayerSecret);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -167,10 +173,10 @@ void UPlayFabServerAPI::HelperSetPlayerSecret(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FServerSetPlayerSecretResult result = UPlayFabServerModelDecoder::decodeSetPlayerSecretResultResponse(response.responseData);
-        if (OnSuccessSetPlayerSecret.IsBound())
+        FServerSetPlayerSecretResult result = UPlayFabServerModelDecoder::readSetPlayerSecretResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetPlayerSecret.Execute(result, mCustomData);
+            FDelegateOnSuccessSetPlayerSecret(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -186,12 +192,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::BanUsers(FServerBanUsersRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessBanUsers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperBanUsers);
 
@@ -199,16 +204,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::BanUsers(FServerBanUsersRequest request,
     manager->PlayFabRequestURL = "/Server/BanUsers";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Bans.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Bans"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Bans"), request.Bans);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("Bans", request.Bans);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -226,10 +228,14 @@ void UPlayFabServerAPI::HelperBanUsers(FPlayFabBaseModel response, UObject* cust
     }
     else
     {
-        FServerBanUsersResult result = UPlayFabServerModelDecoder::decodeBanUsersResultResponse(response.responseData);
-        if (OnSuccessBanUsers.IsBound())
+        FServerBanUsersResult result = UPlayFabServerModelDecoder::readBanUsersResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillBanUsersResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessBanUsers.Execute(result, mCustomData);
+            FDelegateOnSuccessBanUsers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -241,12 +247,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerProfile(FServerGetPlayerProfileRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerProfile = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetPlayerProfile);
 
@@ -254,17 +259,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerProfile(FServerGetPlayerProfileRe
     manager->PlayFabRequestURL = "/Server/GetPlayerProfile";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -282,10 +286,14 @@ void UPlayFabServerAPI::HelperGetPlayerProfile(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FServerGetPlayerProfileResult result = UPlayFabServerModelDecoder::decodeGetPlayerProfileResultResponse(response.responseData);
-        if (OnSuccessGetPlayerProfile.IsBound())
+        FServerGetPlayerProfileResult result = UPlayFabServerModelDecoder::readGetPlayerProfileResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetPlayerProfileResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerProfile.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerProfile(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -297,12 +305,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromFacebookIDs(FServerGetPla
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromFacebookIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetPlayFabIDsFromFacebookIDs);
 
@@ -310,19 +317,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromFacebookIDs(FServerGetPla
     manager->PlayFabRequestURL = "/Server/GetPlayFabIDsFromFacebookIDs";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.FacebookIDs.IsEmpty() || request.FacebookIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FacebookIDs"));
-    } else {
-        TArray<FString> FacebookIDsArray;
-        FString(request.FacebookIDs).ParseIntoArray(FacebookIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("FacebookIDs"), FacebookIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("FacebookIDs", request.FacebookIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -340,10 +343,14 @@ void UPlayFabServerAPI::HelperGetPlayFabIDsFromFacebookIDs(FPlayFabBaseModel res
     }
     else
     {
-        FServerGetPlayFabIDsFromFacebookIDsResult result = UPlayFabServerModelDecoder::decodeGetPlayFabIDsFromFacebookIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromFacebookIDs.IsBound())
+        FServerGetPlayFabIDsFromFacebookIDsResult result = UPlayFabServerModelDecoder::readGetPlayFabIDsFromFacebookIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetPlayFabIDsFromFacebookIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromFacebookIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromFacebookIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -355,12 +362,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromSteamIDs(FServerGetPlayFa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayFabIDsFromSteamIDs = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetPlayFabIDsFromSteamIDs);
 
@@ -368,19 +374,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayFabIDsFromSteamIDs(FServerGetPlayFa
     manager->PlayFabRequestURL = "/Server/GetPlayFabIDsFromSteamIDs";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.SteamStringIDs.IsEmpty() || request.SteamStringIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SteamStringIDs"));
-    } else {
-        TArray<FString> SteamStringIDsArray;
-        FString(request.SteamStringIDs).ParseIntoArray(SteamStringIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("SteamStringIDs"), SteamStringIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("SteamStringIDs", request.SteamStringIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -398,10 +400,14 @@ void UPlayFabServerAPI::HelperGetPlayFabIDsFromSteamIDs(FPlayFabBaseModel respon
     }
     else
     {
-        FServerGetPlayFabIDsFromSteamIDsResult result = UPlayFabServerModelDecoder::decodeGetPlayFabIDsFromSteamIDsResultResponse(response.responseData);
-        if (OnSuccessGetPlayFabIDsFromSteamIDs.IsBound())
+        FServerGetPlayFabIDsFromSteamIDsResult result = UPlayFabServerModelDecoder::readGetPlayFabIDsFromSteamIDsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetPlayFabIDsFromSteamIDsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayFabIDsFromSteamIDs.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayFabIDsFromSteamIDs(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -413,12 +419,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserAccountInfo(FServerGetUserAccountIn
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserAccountInfo = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetUserAccountInfo);
 
@@ -426,16 +431,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserAccountInfo(FServerGetUserAccountIn
     manager->PlayFabRequestURL = "/Server/GetUserAccountInfo";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -453,10 +457,14 @@ void UPlayFabServerAPI::HelperGetUserAccountInfo(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FServerGetUserAccountInfoResult result = UPlayFabServerModelDecoder::decodeGetUserAccountInfoResultResponse(response.responseData);
-        if (OnSuccessGetUserAccountInfo.IsBound())
+        FServerGetUserAccountInfoResult result = UPlayFabServerModelDecoder::readGetUserAccountInfoResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetUserAccountInfoResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserAccountInfo.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserAccountInfo(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -468,12 +476,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserBans(FServerGetUserBansRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserBans = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetUserBans);
 
@@ -481,16 +488,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserBans(FServerGetUserBansRequest requ
     manager->PlayFabRequestURL = "/Server/GetUserBans";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -508,10 +514,14 @@ void UPlayFabServerAPI::HelperGetUserBans(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FServerGetUserBansResult result = UPlayFabServerModelDecoder::decodeGetUserBansResultResponse(response.responseData);
-        if (OnSuccessGetUserBans.IsBound())
+        FServerGetUserBansResult result = UPlayFabServerModelDecoder::readGetUserBansResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetUserBansResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserBans.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserBans(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -523,12 +533,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeAllBansForUser(FServerRevokeAllBansF
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRevokeAllBansForUser = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperRevokeAllBansForUser);
 
@@ -536,16 +545,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeAllBansForUser(FServerRevokeAllBansF
     manager->PlayFabRequestURL = "/Server/RevokeAllBansForUser";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -563,10 +569,14 @@ void UPlayFabServerAPI::HelperRevokeAllBansForUser(FPlayFabBaseModel response, U
     }
     else
     {
-        FServerRevokeAllBansForUserResult result = UPlayFabServerModelDecoder::decodeRevokeAllBansForUserResultResponse(response.responseData);
-        if (OnSuccessRevokeAllBansForUser.IsBound())
+        FServerRevokeAllBansForUserResult result = UPlayFabServerModelDecoder::readRevokeAllBansForUserResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillRevokeAllBansForUserResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRevokeAllBansForUser.Execute(result, mCustomData);
+            FDelegateOnSuccessRevokeAllBansForUser(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -578,12 +588,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeBans(FServerRevokeBansRequest reques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRevokeBans = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperRevokeBans);
 
@@ -591,19 +600,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeBans(FServerRevokeBansRequest reques
     manager->PlayFabRequestURL = "/Server/RevokeBans";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.BanIds.IsEmpty() || request.BanIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("BanIds"));
-    } else {
-        TArray<FString> BanIdsArray;
-        FString(request.BanIds).ParseIntoArray(BanIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("BanIds"), BanIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("BanIds", request.BanIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -621,10 +624,14 @@ void UPlayFabServerAPI::HelperRevokeBans(FPlayFabBaseModel response, UObject* cu
     }
     else
     {
-        FServerRevokeBansResult result = UPlayFabServerModelDecoder::decodeRevokeBansResultResponse(response.responseData);
-        if (OnSuccessRevokeBans.IsBound())
+        FServerRevokeBansResult result = UPlayFabServerModelDecoder::readRevokeBansResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillRevokeBansResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRevokeBans.Execute(result, mCustomData);
+            FDelegateOnSuccessRevokeBans(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -636,12 +643,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::SendPushNotification(FServerSendPushNotifi
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSendPushNotification = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperSendPushNotification);
 
@@ -649,27 +655,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::SendPushNotification(FServerSendPushNotifi
     manager->PlayFabRequestURL = "/Server/SendPushNotification";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Recipient.IsEmpty() || request.Recipient == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Recipient"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Recipient"), request.Recipient);
-    }
-    if (request.Message.IsEmpty() || request.Message == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Message"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Message"), request.Message);
-    }
-    if (request.Package != nullptr) OutRestJsonObj->SetObjectField(TEXT("Package"), request.Package);
-    if (request.Subject.IsEmpty() || request.Subject == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Subject"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Subject"), request.Subject);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Recipient", request.Recipient);
+    Writer.WriteString("Message", request.Message);
+    Writer.WriteObject("Package", request.Package);
+    Writer.WriteString("Subject", request.Subject);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -687,10 +682,10 @@ void UPlayFabServerAPI::HelperSendPushNotification(FPlayFabBaseModel response, U
     }
     else
     {
-        FServerSendPushNotificationResult result = UPlayFabServerModelDecoder::decodeSendPushNotificationResultResponse(response.responseData);
-        if (OnSuccessSendPushNotification.IsBound())
+        FServerSendPushNotificationResult result = UPlayFabServerModelDecoder::readSendPushNotificationResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSendPushNotification.Execute(result, mCustomData);
+            FDelegateOnSuccessSendPushNotification(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -702,12 +697,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateAvatarUrl(FServerUpdateAvatarUrlRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateAvatarUrl = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateAvatarUrl);
 
@@ -715,21 +709,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateAvatarUrl(FServerUpdateAvatarUrlRequ
     manager->PlayFabRequestURL = "/Server/UpdateAvatarUrl";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ImageUrl.IsEmpty() || request.ImageUrl == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ImageUrl"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ImageUrl"), request.ImageUrl);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("ImageUrl", request.ImageUrl);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -747,10 +734,10 @@ void UPlayFabServerAPI::HelperUpdateAvatarUrl(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FServerEmptyResult result = UPlayFabServerModelDecoder::decodeEmptyResultResponse(response.responseData);
-        if (OnSuccessUpdateAvatarUrl.IsBound())
+        FServerEmptyResult result = UPlayFabServerModelDecoder::readEmptyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateAvatarUrl.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateAvatarUrl(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -762,12 +749,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateBans(FServerUpdateBansRequest reques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateBans = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateBans);
 
@@ -775,16 +761,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateBans(FServerUpdateBansRequest reques
     manager->PlayFabRequestURL = "/Server/UpdateBans";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Bans.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Bans"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Bans"), request.Bans);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("Bans", request.Bans);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -802,10 +785,14 @@ void UPlayFabServerAPI::HelperUpdateBans(FPlayFabBaseModel response, UObject* cu
     }
     else
     {
-        FServerUpdateBansResult result = UPlayFabServerModelDecoder::decodeUpdateBansResultResponse(response.responseData);
-        if (OnSuccessUpdateBans.IsBound())
+        FServerUpdateBansResult result = UPlayFabServerModelDecoder::readUpdateBansResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillUpdateBansResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateBans.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateBans(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -821,12 +808,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeleteUsers(FServerDeleteUsersRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessDeleteUsers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperDeleteUsers);
 
@@ -834,20 +820,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeleteUsers(FServerDeleteUsersRequest requ
     manager->PlayFabRequestURL = "/Server/DeleteUsers";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.PlayFabIds.IsEmpty() || request.PlayFabIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIds"));
-    } else {
-        TArray<FString> PlayFabIdsArray;
-        FString(request.PlayFabIds).ParseIntoArray(PlayFabIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIds"), PlayFabIdsArray);
-    }
-    OutRestJsonObj->SetStringField(TEXT("TitleId"), IPlayFab::Get().getGameTitleId());
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("PlayFabIds", request.PlayFabIds);
+    Writer.WriteString("TitleId", IPlayFab::Get().GetSettings().GameTitleId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -865,10 +845,10 @@ void UPlayFabServerAPI::HelperDeleteUsers(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FServerDeleteUsersResult result = UPlayFabServerModelDecoder::decodeDeleteUsersResultResponse(response.responseData);
-        if (OnSuccessDeleteUsers.IsBound())
+        FServerDeleteUsersResult result = UPlayFabServerModelDecoder::readDeleteUsersResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessDeleteUsers.Execute(result, mCustomData);
+            FDelegateOnSuccessDeleteUsers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -880,12 +860,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetFriendLeaderboard(FServerGetFriendLeade
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetFriendLeaderboard = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetFriendLeaderboard);
 
@@ -893,28 +872,23 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetFriendLeaderboard(FServerGetFriendLeade
     manager->PlayFabRequestURL = "/Server/GetFriendLeaderboard";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("StartPosition", request.StartPosition);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteBool("IncludeSteamFriends", request.IncludeSteamFriends);
+    Writer.WriteBool("IncludeFacebookFriends", request.IncludeFacebookFriends);
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteBool("UseSpecificVersion", request.UseSpecificVersion);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -932,10 +906,14 @@ void UPlayFabServerAPI::HelperGetFriendLeaderboard(FPlayFabBaseModel response, U
     }
     else
     {
-        FServerGetLeaderboardResult result = UPlayFabServerModelDecoder::decodeGetLeaderboardResultResponse(response.responseData);
-        if (OnSuccessGetFriendLeaderboard.IsBound())
+        FServerGetLeaderboardResult result = UPlayFabServerModelDecoder::readGetLeaderboardResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetLeaderboardResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetFriendLeaderboard.Execute(result, mCustomData);
+            FDelegateOnSuccessGetFriendLeaderboard(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -947,12 +925,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboard(FServerGetLeaderboardReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetLeaderboard = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetLeaderboard);
 
@@ -960,21 +937,20 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboard(FServerGetLeaderboardReques
     manager->PlayFabRequestURL = "/Server/GetLeaderboard";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("StartPosition", request.StartPosition);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteBool("UseSpecificVersion", request.UseSpecificVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -992,10 +968,14 @@ void UPlayFabServerAPI::HelperGetLeaderboard(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FServerGetLeaderboardResult result = UPlayFabServerModelDecoder::decodeGetLeaderboardResultResponse(response.responseData);
-        if (OnSuccessGetLeaderboard.IsBound())
+        FServerGetLeaderboardResult result = UPlayFabServerModelDecoder::readGetLeaderboardResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetLeaderboardResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetLeaderboard.Execute(result, mCustomData);
+            FDelegateOnSuccessGetLeaderboard(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1007,12 +987,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboardAroundUser(FServerGetLeaderb
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetLeaderboardAroundUser = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetLeaderboardAroundUser);
 
@@ -1020,25 +999,20 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboardAroundUser(FServerGetLeaderb
     manager->PlayFabRequestURL = "/Server/GetLeaderboardAroundUser";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-    if (request.ProfileConstraints != nullptr) OutRestJsonObj->SetObjectField(TEXT("ProfileConstraints"), request.ProfileConstraints);
-    OutRestJsonObj->SetNumberField(TEXT("Version"), request.Version);
-    OutRestJsonObj->SetBoolField(TEXT("UseSpecificVersion"), request.UseSpecificVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteObject("ProfileConstraints", request.ProfileConstraints);
+    Writer.WriteNumber("Version", request.Version);
+    Writer.WriteBool("UseSpecificVersion", request.UseSpecificVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1056,10 +1030,14 @@ void UPlayFabServerAPI::HelperGetLeaderboardAroundUser(FPlayFabBaseModel respons
     }
     else
     {
-        FServerGetLeaderboardAroundUserResult result = UPlayFabServerModelDecoder::decodeGetLeaderboardAroundUserResultResponse(response.responseData);
-        if (OnSuccessGetLeaderboardAroundUser.IsBound())
+        FServerGetLeaderboardAroundUserResult result = UPlayFabServerModelDecoder::readGetLeaderboardAroundUserResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetLeaderboardAroundUser.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillGetLeaderboardAroundUserResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetLeaderboardAroundUser(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1071,12 +1049,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerCombinedInfo(FServerGetPlayerComb
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerCombinedInfo = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetPlayerCombinedInfo);
 
@@ -1084,17 +1061,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerCombinedInfo(FServerGetPlayerComb
     manager->PlayFabRequestURL = "/Server/GetPlayerCombinedInfo";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.InfoRequestParameters != nullptr) OutRestJsonObj->SetObjectField(TEXT("InfoRequestParameters"), request.InfoRequestParameters);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("InfoRequestParameters", request.InfoRequestParameters);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1112,10 +1088,14 @@ void UPlayFabServerAPI::HelperGetPlayerCombinedInfo(FPlayFabBaseModel response,
     }
     else
     {
-        FServerGetPlayerCombinedInfoResult result = UPlayFabServerModelDecoder::decodeGetPlayerCombinedInfoResultResponse(response.responseData);
-        if (OnSuccessGetPlayerCombinedInfo.IsBound())
+        FServerGetPlayerCombinedInfoResult result = UPlayFabServerModelDecoder::readGetPlayerCombinedInfoResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetPlayerCombinedInfo.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillGetPlayerCombinedInfoResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetPlayerCombinedInfo(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1127,12 +1107,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerStatistics(FServerGetPlayerStatis
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetPlayerStatistics);
 
@@ -1140,29 +1119,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerStatistics(FServerGetPlayerStatis
     manager->PlayFabRequestURL = "/Server/GetPlayerStatistics";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.StatisticNames.IsEmpty() || request.StatisticNames == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticNames"));
-    } else {
-        TArray<FString> StatisticNamesArray;
-        FString(request.StatisticNames).ParseIntoArray(StatisticNamesArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("StatisticNames"), StatisticNamesArray);
-    }
-    if (request.StatisticNameVersions.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticNameVersions"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("StatisticNameVersions"), request.StatisticNameVersions);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("StatisticNames", request.StatisticNames);
+    Writer.WriteObjectArray("StatisticNameVersions", request.StatisticNameVersions);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1180,10 +1147,14 @@ void UPlayFabServerAPI::HelperGetPlayerStatistics(FPlayFabBaseModel response, UO
     }
     else
     {
-        FServerGetPlayerStatisticsResult result = UPlayFabServerModelDecoder::decodeGetPlayerStatisticsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerStatistics.IsBound())
+        FServerGetPlayerStatisticsResult result = UPlayFabServerModelDecoder::readGetPlayerStatisticsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetPlayerStatisticsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1195,12 +1166,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerStatisticVersions(FServerGetPlaye
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerStatisticVersions = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetPlayerStatisticVersions);
 
@@ -1208,16 +1178,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerStatisticVersions(FServerGetPlaye
     manager->PlayFabRequestURL = "/Server/GetPlayerStatisticVersions";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1235,10 +1204,14 @@ void UPlayFabServerAPI::HelperGetPlayerStatisticVersions(FPlayFabBaseModel respo
     }
     else
     {
-        FServerGetPlayerStatisticVersionsResult result = UPlayFabServerModelDecoder::decodeGetPlayerStatisticVersionsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerStatisticVersions.IsBound())
+        FServerGetPlayerStatisticVersionsResult result = UPlayFabServerModelDecoder::readGetPlayerStatisticVersionsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetPlayerStatisticVersionsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerStatisticVersions.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerStatisticVersions(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1250,12 +1223,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserData(FServerGetUserDataRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetUserData);
 
@@ -1263,25 +1235,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserData(FServerGetUserDataRequest requ
     manager->PlayFabRequestURL = "/Server/GetUserData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1299,10 +1263,14 @@ void UPlayFabServerAPI::HelperGetUserData(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FServerGetUserDataResult result = UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserData.IsBound())
+        FServerGetUserDataResult result = UPlayFabServerModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1314,12 +1282,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserInternalData(FServerGetUserDataRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetUserInternalData);
 
@@ -1327,25 +1294,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserInternalData(FServerGetUserDataRequ
     manager->PlayFabRequestURL = "/Server/GetUserInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1363,10 +1322,14 @@ void UPlayFabServerAPI::HelperGetUserInternalData(FPlayFabBaseModel response, UO
     }
     else
     {
-        FServerGetUserDataResult result = UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserInternalData.IsBound())
+        FServerGetUserDataResult result = UPlayFabServerModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserInternalData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1378,12 +1341,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserPublisherData(FServerGetUserDataReq
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetUserPublisherData);
 
@@ -1391,25 +1353,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserPublisherData(FServerGetUserDataReq
     manager->PlayFabRequestURL = "/Server/GetUserPublisherData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1427,10 +1381,14 @@ void UPlayFabServerAPI::HelperGetUserPublisherData(FPlayFabBaseModel response, U
     }
     else
     {
-        FServerGetUserDataResult result = UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserPublisherData.IsBound())
+        FServerGetUserDataResult result = UPlayFabServerModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserPublisherData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1442,12 +1400,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserPublisherInternalData(FServerGetUse
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserPublisherInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetUserPublisherInternalData);
 
@@ -1455,25 +1412,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserPublisherInternalData(FServerGetUse
     manager->PlayFabRequestURL = "/Server/GetUserPublisherInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1491,10 +1440,14 @@ void UPlayFabServerAPI::HelperGetUserPublisherInternalData(FPlayFabBaseModel res
     }
     else
     {
-        FServerGetUserDataResult result = UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserPublisherInternalData.IsBound())
+        FServerGetUserDataResult result = UPlayFabServerModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetUserPublisherInternalData.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetUserPublisherInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1506,12 +1459,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserPublisherReadOnlyData(FServerGetUse
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserPublisherReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetUserPublisherReadOnlyData);
 
@@ -1519,25 +1471,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserPublisherReadOnlyData(FServerGetUse
     manager->PlayFabRequestURL = "/Server/GetUserPublisherReadOnlyData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1555,10 +1499,14 @@ void UPlayFabServerAPI::HelperGetUserPublisherReadOnlyData(FPlayFabBaseModel res
     }
     else
     {
-        FServerGetUserDataResult result = UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserPublisherReadOnlyData.IsBound())
+        FServerGetUserDataResult result = UPlayFabServerModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetUserPublisherReadOnlyData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetUserPublisherReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1570,12 +1518,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserReadOnlyData(FServerGetUserDataRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetUserReadOnlyData);
 
@@ -1583,25 +1530,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserReadOnlyData(FServerGetUserDataRequ
     manager->PlayFabRequestURL = "/Server/GetUserReadOnlyData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1619,10 +1558,14 @@ void UPlayFabServerAPI::HelperGetUserReadOnlyData(FPlayFabBaseModel response, UO
     }
     else
     {
-        FServerGetUserDataResult result = UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(response.responseData);
-        if (OnSuccessGetUserReadOnlyData.IsBound())
+        FServerGetUserDataResult result = UPlayFabServerModelDecoder::readGetUserDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetUserReadOnlyData.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillGetUserDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetUserReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1634,12 +1577,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdatePlayerStatistics(FServerUpdatePlayer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdatePlayerStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdatePlayerStatistics);
 
@@ -1647,22 +1589,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdatePlayerStatistics(FServerUpdatePlayer
     manager->PlayFabRequestURL = "/Server/UpdatePlayerStatistics";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Statistics.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Statistics"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Statistics"), request.Statistics);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ForceUpdate"), request.ForceUpdate);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectArray("Statistics", request.Statistics);
+    Writer.WriteBool("ForceUpdate", request.ForceUpdate);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1680,10 +1615,10 @@ void UPlayFabServerAPI::HelperUpdatePlayerStatistics(FPlayFabBaseModel response,
     }
     else
     {
-        FServerUpdatePlayerStatisticsResult result = UPlayFabServerModelDecoder::decodeUpdatePlayerStatisticsResultResponse(response.responseData);
-        if (OnSuccessUpdatePlayerStatistics.IsBound())
+        FServerUpdatePlayerStatisticsResult result = UPlayFabServerModelDecoder::readUpdatePlayerStatisticsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdatePlayerStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdatePlayerStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1695,12 +1630,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserData(FServerUpdateUserDataReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateUserData);
 
@@ -1708,28 +1642,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserData(FServerUpdateUserDataReques
     manager->PlayFabRequestURL = "/Server/UpdateUserData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1747,10 +1670,10 @@ void UPlayFabServerAPI::HelperUpdateUserData(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FServerUpdateUserDataResult result = UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserData.IsBound())
+        FServerUpdateUserDataResult result = UPlayFabServerModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1762,12 +1685,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserInternalData(FServerUpdateUserIn
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateUserInternalData);
 
@@ -1775,25 +1697,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserInternalData(FServerUpdateUserIn
     manager->PlayFabRequestURL = "/Server/UpdateUserInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1811,10 +1724,10 @@ void UPlayFabServerAPI::HelperUpdateUserInternalData(FPlayFabBaseModel response,
     }
     else
     {
-        FServerUpdateUserDataResult result = UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserInternalData.IsBound())
+        FServerUpdateUserDataResult result = UPlayFabServerModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserInternalData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1826,12 +1739,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserPublisherData(FServerUpdateUserD
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateUserPublisherData);
 
@@ -1839,28 +1751,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserPublisherData(FServerUpdateUserD
     manager->PlayFabRequestURL = "/Server/UpdateUserPublisherData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1878,10 +1779,10 @@ void UPlayFabServerAPI::HelperUpdateUserPublisherData(FPlayFabBaseModel response
     }
     else
     {
-        FServerUpdateUserDataResult result = UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserPublisherData.IsBound())
+        FServerUpdateUserDataResult result = UPlayFabServerModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserPublisherData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1893,12 +1794,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserPublisherInternalData(FServerUpd
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserPublisherInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateUserPublisherInternalData);
 
@@ -1906,25 +1806,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserPublisherInternalData(FServerUpd
     manager->PlayFabRequestURL = "/Server/UpdateUserPublisherInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -1942,10 +1833,10 @@ void UPlayFabServerAPI::HelperUpdateUserPublisherInternalData(FPlayFabBaseModel
     }
     else
     {
-        FServerUpdateUserDataResult result = UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserPublisherInternalData.IsBound())
+        FServerUpdateUserDataResult result = UPlayFabServerModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserPublisherInternalData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserPublisherInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -1957,12 +1848,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserPublisherReadOnlyData(FServerUpd
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserPublisherReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateUserPublisherReadOnlyData);
 
@@ -1970,28 +1860,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserPublisherReadOnlyData(FServerUpd
     manager->PlayFabRequestURL = "/Server/UpdateUserPublisherReadOnlyData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2009,10 +1888,10 @@ void UPlayFabServerAPI::HelperUpdateUserPublisherReadOnlyData(FPlayFabBaseModel
     }
     else
     {
-        FServerUpdateUserDataResult result = UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserPublisherReadOnlyData.IsBound())
+        FServerUpdateUserDataResult result = UPlayFabServerModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserPublisherReadOnlyData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserPublisherReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2024,12 +1903,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserReadOnlyData(FServerUpdateUserDa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateUserReadOnlyData);
 
@@ -2037,28 +1915,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserReadOnlyData(FServerUpdateUserDa
     manager->PlayFabRequestURL = "/Server/UpdateUserReadOnlyData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2076,10 +1943,10 @@ void UPlayFabServerAPI::HelperUpdateUserReadOnlyData(FPlayFabBaseModel response,
     }
     else
     {
-        FServerUpdateUserDataResult result = UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(response.responseData);
-        if (OnSuccessUpdateUserReadOnlyData.IsBound())
+        FServerUpdateUserDataResult result = UPlayFabServerModelDecoder::readUpdateUserDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserReadOnlyData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2095,12 +1962,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCatalogItems(FServerGetCatalogItemsRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCatalogItems = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetCatalogItems);
 
@@ -2108,16 +1974,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCatalogItems(FServerGetCatalogItemsRequ
     manager->PlayFabRequestURL = "/Server/GetCatalogItems";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2135,10 +2000,14 @@ void UPlayFabServerAPI::HelperGetCatalogItems(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FServerGetCatalogItemsResult result = UPlayFabServerModelDecoder::decodeGetCatalogItemsResultResponse(response.responseData);
-        if (OnSuccessGetCatalogItems.IsBound())
+        FServerGetCatalogItemsResult result = UPlayFabServerModelDecoder::readGetCatalogItemsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetCatalogItemsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCatalogItems.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCatalogItems(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2150,12 +2019,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPublisherData(FServerGetPublisherDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetPublisherData);
 
@@ -2163,19 +2031,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPublisherData(FServerGetPublisherDataRe
     manager->PlayFabRequestURL = "/Server/GetPublisherData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2193,10 +2057,14 @@ void UPlayFabServerAPI::HelperGetPublisherData(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FServerGetPublisherDataResult result = UPlayFabServerModelDecoder::decodeGetPublisherDataResultResponse(response.responseData);
-        if (OnSuccessGetPublisherData.IsBound())
+        FServerGetPublisherDataResult result = UPlayFabServerModelDecoder::readGetPublisherDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetPublisherDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPublisherData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2208,12 +2076,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTime(FServerGetTimeRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTime = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetTime);
 
@@ -2221,11 +2088,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTime(FServerGetTimeRequest request,
     manager->PlayFabRequestURL = "/Server/GetTime";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2243,10 +2113,10 @@ void UPlayFabServerAPI::HelperGetTime(FPlayFabBaseModel response, UObject* custo
     }
     else
     {
-        FServerGetTimeResult result = UPlayFabServerModelDecoder::decodeGetTimeResultResponse(response.responseData);
-        if (OnSuccessGetTime.IsBound())
+        FServerGetTimeResult result = UPlayFabServerModelDecoder::readGetTimeResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTime.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTime(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2258,12 +2128,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTitleData(FServerGetTitleDataRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTitleData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetTitleData);
 
@@ -2271,19 +2140,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTitleData(FServerGetTitleDataRequest re
     manager->PlayFabRequestURL = "/Server/GetTitleData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2301,10 +2166,14 @@ void UPlayFabServerAPI::HelperGetTitleData(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FServerGetTitleDataResult result = UPlayFabServerModelDecoder::decodeGetTitleDataResultResponse(response.responseData);
-        if (OnSuccessGetTitleData.IsBound())
+        FServerGetTitleDataResult result = UPlayFabServerModelDecoder::readGetTitleDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetTitleDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTitleData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTitleData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2316,12 +2185,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTitleInternalData(FServerGetTitleDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTitleInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetTitleInternalData);
 
@@ -2329,19 +2197,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTitleInternalData(FServerGetTitleDataRe
     manager->PlayFabRequestURL = "/Server/GetTitleInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2359,10 +2223,14 @@ void UPlayFabServerAPI::HelperGetTitleInternalData(FPlayFabBaseModel response, U
     }
     else
     {
-        FServerGetTitleDataResult result = UPlayFabServerModelDecoder::decodeGetTitleDataResultResponse(response.responseData);
-        if (OnSuccessGetTitleInternalData.IsBound())
+        FServerGetTitleDataResult result = UPlayFabServerModelDecoder::readGetTitleDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetTitleDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTitleInternalData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTitleInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2374,12 +2242,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTitleNews(FServerGetTitleNewsRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetTitleNews = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetTitleNews);
 
@@ -2387,12 +2254,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetTitleNews(FServerGetTitleNewsRequest re
     manager->PlayFabRequestURL = "/Server/GetTitleNews";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    OutRestJsonObj->SetNumberField(TEXT("Count"), request.Count);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteNumber("Count", request.Count);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2410,10 +2280,14 @@ void UPlayFabServerAPI::HelperGetTitleNews(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FServerGetTitleNewsResult result = UPlayFabServerModelDecoder::decodeGetTitleNewsResultResponse(response.responseData);
-        if (OnSuccessGetTitleNews.IsBound())
+        FServerGetTitleNewsResult result = UPlayFabServerModelDecoder::readGetTitleNewsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetTitleNewsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetTitleNews.Execute(result, mCustomData);
+            FDelegateOnSuccessGetTitleNews(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2425,12 +2299,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetPublisherData(FServerSetPublisherDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetPublisherData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperSetPublisherData);
 
@@ -2438,21 +2311,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetPublisherData(FServerSetPublisherDataRe
     manager->PlayFabRequestURL = "/Server/SetPublisherData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Value.IsEmpty() || request.Value == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Value"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Value"), request.Value);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Key", request.Key);
+    Writer.WriteString("Value", request.Value);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2470,10 +2337,10 @@ void UPlayFabServerAPI::HelperSetPublisherData(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FServerSetPublisherDataResult result = UPlayFabServerModelDecoder::decodeSetPublisherDataResultResponse(response.responseData);
-        if (OnSuccessSetPublisherData.IsBound())
+        FServerSetPublisherDataResult result = UPlayFabServerModelDecoder::readSetPublisherDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetPublisherData.Execute(result, mCustomData);
+            FDelegateOnSuccessSetPublisherData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2485,12 +2352,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetTitleData(FServerSetTitleDataRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetTitleData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperSetTitleData);
 
@@ -2498,21 +2364,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetTitleData(FServerSetTitleDataRequest re
     manager->PlayFabRequestURL = "/Server/SetTitleData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Value.IsEmpty() || request.Value == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Value"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Value"), request.Value);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Key", request.Key);
+    Writer.WriteString("Value", request.Value);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2530,10 +2390,10 @@ void UPlayFabServerAPI::HelperSetTitleData(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FServerSetTitleDataResult result = UPlayFabServerModelDecoder::decodeSetTitleDataResultResponse(response.responseData);
-        if (OnSuccessSetTitleData.IsBound())
+        FServerSetTitleDataResult result = UPlayFabServerModelDecoder::readSetTitleDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetTitleData.Execute(result, mCustomData);
+            FDelegateOnSuccessSetTitleData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2545,12 +2405,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetTitleInternalData(FServerSetTitleDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetTitleInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperSetTitleInternalData);
 
@@ -2558,21 +2417,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetTitleInternalData(FServerSetTitleDataRe
     manager->PlayFabRequestURL = "/Server/SetTitleInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.Value.IsEmpty() || request.Value == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Value"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Value"), request.Value);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Key", request.Key);
+    Writer.WriteString("Value", request.Value);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2590,10 +2443,10 @@ void UPlayFabServerAPI::HelperSetTitleInternalData(FPlayFabBaseModel response, U
     }
     else
     {
-        FServerSetTitleDataResult result = UPlayFabServerModelDecoder::decodeSetTitleDataResultResponse(response.responseData);
-        if (OnSuccessSetTitleInternalData.IsBound())
+        FServerSetTitleDataResult result = UPlayFabServerModelDecoder::readSetTitleDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetTitleInternalData.Execute(result, mCustomData);
+            FDelegateOnSuccessSetTitleInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2609,12 +2462,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddCharacterVirtualCurrency(FServerAddChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddCharacterVirtualCurrency = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperAddCharacterVirtualCurrency);
 
@@ -2622,27 +2474,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddCharacterVirtualCurrency(FServerAddChar
     manager->PlayFabRequestURL = "/Server/AddCharacterVirtualCurrency";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("VirtualCurrency", request.VirtualCurrency);
+    Writer.WriteNumber("Amount", request.Amount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2660,10 +2501,10 @@ void UPlayFabServerAPI::HelperAddCharacterVirtualCurrency(FPlayFabBaseModel resp
     }
     else
     {
-        FServerModifyCharacterVirtualCurrencyResult result = UPlayFabServerModelDecoder::decodeModifyCharacterVirtualCurrencyResultResponse(response.responseData);
-        if (OnSuccessAddCharacterVirtualCurrency.IsBound())
+        FServerModifyCharacterVirtualCurrencyResult result = UPlayFabServerModelDecoder::readModifyCharacterVirtualCurrencyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddCharacterVirtualCurrency.Execute(result, mCustomData);
+            FDelegateOnSuccessAddCharacterVirtualCurrency(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2675,12 +2516,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddUserVirtualCurrency(FServerAddUserVirtu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddUserVirtualCurrency = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperAddUserVirtualCurrency);
 
@@ -2688,22 +2528,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddUserVirtualCurrency(FServerAddUserVirtu
     manager->PlayFabRequestURL = "/Server/AddUserVirtualCurrency";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("VirtualCurrency", request.VirtualCurrency);
+    Writer.WriteNumber("Amount", request.Amount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2721,10 +2554,10 @@ void UPlayFabServerAPI::HelperAddUserVirtualCurrency(FPlayFabBaseModel response,
     }
     else
     {
-        FServerModifyUserVirtualCurrencyResult result = UPlayFabServerModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
-        if (OnSuccessAddUserVirtualCurrency.IsBound())
+        FServerModifyUserVirtualCurrencyResult result = UPlayFabServerModelDecoder::readModifyUserVirtualCurrencyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddUserVirtualCurrency.Execute(result, mCustomData);
+            FDelegateOnSuccessAddUserVirtualCurrency(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2736,12 +2569,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::ConsumeItem(FServerConsumeItemRequest requ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessConsumeItem = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperConsumeItem);
 
@@ -2749,27 +2581,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::ConsumeItem(FServerConsumeItemRequest requ
     manager->PlayFabRequestURL = "/Server/ConsumeItem";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("ConsumeCount"), request.ConsumeCount);
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("ItemInstanceId", request.ItemInstanceId);
+    Writer.WriteNumber("ConsumeCount", request.ConsumeCount);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2787,10 +2608,10 @@ void UPlayFabServerAPI::HelperConsumeItem(FPlayFabBaseModel response, UObject* c
     }
     else
     {
-        FServerConsumeItemResult result = UPlayFabServerModelDecoder::decodeConsumeItemResultResponse(response.responseData);
-        if (OnSuccessConsumeItem.IsBound())
+        FServerConsumeItemResult result = UPlayFabServerModelDecoder::readConsumeItemResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessConsumeItem.Execute(result, mCustomData);
+            FDelegateOnSuccessConsumeItem(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2802,12 +2623,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::EvaluateRandomResultTable(FServerEvaluateR
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessEvaluateRandomResultTable = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperEvaluateRandomResultTable);
 
@@ -2815,21 +2635,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::EvaluateRandomResultTable(FServerEvaluateR
     manager->PlayFabRequestURL = "/Server/EvaluateRandomResultTable";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.TableId.IsEmpty() || request.TableId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TableId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TableId"), request.TableId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("TableId", request.TableId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2847,10 +2661,10 @@ void UPlayFabServerAPI::HelperEvaluateRandomResultTable(FPlayFabBaseModel respon
     }
     else
     {
-        FServerEvaluateRandomResultTableResult result = UPlayFabServerModelDecoder::decodeEvaluateRandomResultTableResultResponse(response.responseData);
-        if (OnSuccessEvaluateRandomResultTable.IsBound())
+        FServerEvaluateRandomResultTableResult result = UPlayFabServerModelDecoder::readEvaluateRandomResultTableResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessEvaluateRandomResultTable.Execute(result, mCustomData);
+            FDelegateOnSuccessEvaluateRandomResultTable(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2862,12 +2676,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterInventory(FServerGetCharacterI
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterInventory = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetCharacterInventory);
 
@@ -2875,26 +2688,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterInventory(FServerGetCharacterI
     manager->PlayFabRequestURL = "/Server/GetCharacterInventory";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2912,10 +2716,14 @@ void UPlayFabServerAPI::HelperGetCharacterInventory(FPlayFabBaseModel response,
     }
     else
     {
-        FServerGetCharacterInventoryResult result = UPlayFabServerModelDecoder::decodeGetCharacterInventoryResultResponse(response.responseData);
-        if (OnSuccessGetCharacterInventory.IsBound())
+        FServerGetCharacterInventoryResult result = UPlayFabServerModelDecoder::readGetCharacterInventoryResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetCharacterInventoryResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCharacterInventory.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCharacterInventory(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2927,12 +2735,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetRandomResultTables(FServerGetRandomResu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetRandomResultTables = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetRandomResultTables);
 
@@ -2940,24 +2747,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetRandomResultTables(FServerGetRandomResu
     manager->PlayFabRequestURL = "/Server/GetRandomResultTables";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    // Check to see if string is empty
-    if (request.TableIDs.IsEmpty() || request.TableIDs == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TableIDs"));
-    } else {
-        TArray<FString> TableIDsArray;
-        FString(request.TableIDs).ParseIntoArray(TableIDsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("TableIDs"), TableIDsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteStringList("TableIDs", request.TableIDs);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -2975,10 +2774,14 @@ void UPlayFabServerAPI::HelperGetRandomResultTables(FPlayFabBaseModel response,
     }
     else
     {
-        FServerGetRandomResultTablesResult result = UPlayFabServerModelDecoder::decodeGetRandomResultTablesResultResponse(response.responseData);
-        if (OnSuccessGetRandomResultTables.IsBound())
+        FServerGetRandomResultTablesResult result = UPlayFabServerModelDecoder::readGetRandomResultTablesResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetRandomResultTables.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillGetRandomResultTablesResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetRandomResultTables(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -2990,12 +2793,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserInventory(FServerGetUserInventoryRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetUserInventory = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetUserInventory);
 
@@ -3003,16 +2805,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetUserInventory(FServerGetUserInventoryRe
     manager->PlayFabRequestURL = "/Server/GetUserInventory";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3030,10 +2831,14 @@ void UPlayFabServerAPI::HelperGetUserInventory(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FServerGetUserInventoryResult result = UPlayFabServerModelDecoder::decodeGetUserInventoryResultResponse(response.responseData);
-        if (OnSuccessGetUserInventory.IsBound())
+        FServerGetUserInventoryResult result = UPlayFabServerModelDecoder::readGetUserInventoryResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetUserInventory.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillGetUserInventoryResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetUserInventory(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3045,12 +2850,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantItemsToCharacter(FServerGrantItemsToC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGrantItemsToCharacter = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGrantItemsToCharacter);
 
@@ -3058,39 +2862,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantItemsToCharacter(FServerGrantItemsToC
     manager->PlayFabRequestURL = "/Server/GrantItemsToCharacter";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Annotation.IsEmpty() || request.Annotation == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Annotation"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Annotation"), request.Annotation);
-    }
-    // Check to see if string is empty
-    if (request.ItemIds.IsEmpty() || request.ItemIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemIds"));
-    } else {
-        TArray<FString> ItemIdsArray;
-        FString(request.ItemIds).ParseIntoArray(ItemIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("ItemIds"), ItemIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::High;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("Annotation", request.Annotation);
+    Writer.WriteStringList("ItemIds", request.ItemIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3108,10 +2890,14 @@ void UPlayFabServerAPI::HelperGrantItemsToCharacter(FPlayFabBaseModel response,
     }
     else
     {
-        FServerGrantItemsToCharacterResult result = UPlayFabServerModelDecoder::decodeGrantItemsToCharacterResultResponse(response.responseData);
-        if (OnSuccessGrantItemsToCharacter.IsBound())
+        FServerGrantItemsToCharacterResult result = UPlayFabServerModelDecoder::readGrantItemsToCharacterResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGrantItemsToCharacterResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGrantItemsToCharacter.Execute(result, mCustomData);
+            FDelegateOnSuccessGrantItemsToCharacter(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3123,12 +2909,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantItemsToUser(FServerGrantItemsToUserRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGrantItemsToUser = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGrantItemsToUser);
 
@@ -3136,34 +2921,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantItemsToUser(FServerGrantItemsToUserRe
     manager->PlayFabRequestURL = "/Server/GrantItemsToUser";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Annotation.IsEmpty() || request.Annotation == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Annotation"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Annotation"), request.Annotation);
-    }
-    // Check to see if string is empty
-    if (request.ItemIds.IsEmpty() || request.ItemIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemIds"));
-    } else {
-        TArray<FString> ItemIdsArray;
-        FString(request.ItemIds).ParseIntoArray(ItemIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("ItemIds"), ItemIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("Annotation", request.Annotation);
+    Writer.WriteStringList("ItemIds", request.ItemIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3181,10 +2948,14 @@ void UPlayFabServerAPI::HelperGrantItemsToUser(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FServerGrantItemsToUserResult result = UPlayFabServerModelDecoder::decodeGrantItemsToUserResultResponse(response.responseData);
-        if (OnSuccessGrantItemsToUser.IsBound())
+        FServerGrantItemsToUserResult result = UPlayFabServerModelDecoder::readGrantItemsToUserResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGrantItemsToUser.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillGrantItemsToUserResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGrantItemsToUser(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3196,12 +2967,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantItemsToUsers(FServerGrantItemsToUsers
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGrantItemsToUsers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGrantItemsToUsers);
 
@@ -3209,21 +2979,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantItemsToUsers(FServerGrantItemsToUsers
     manager->PlayFabRequestURL = "/Server/GrantItemsToUsers";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.ItemGrants.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemGrants"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("ItemGrants"), request.ItemGrants);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectArray("ItemGrants", request.ItemGrants);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3241,10 +3004,14 @@ void UPlayFabServerAPI::HelperGrantItemsToUsers(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FServerGrantItemsToUsersResult result = UPlayFabServerModelDecoder::decodeGrantItemsToUsersResultResponse(response.responseData);
-        if (OnSuccessGrantItemsToUsers.IsBound())
+        FServerGrantItemsToUsersResult result = UPlayFabServerModelDecoder::readGrantItemsToUsersResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGrantItemsToUsersResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGrantItemsToUsers.Execute(result, mCustomData);
+            FDelegateOnSuccessGrantItemsToUsers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3256,12 +3023,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::ModifyItemUses(FServerModifyItemUsesReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessModifyItemUses = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperModifyItemUses);
 
@@ -3269,22 +3035,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::ModifyItemUses(FServerModifyItemUsesReques
     manager->PlayFabRequestURL = "/Server/ModifyItemUses";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("UsesToAdd"), request.UsesToAdd);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("ItemInstanceId", request.ItemInstanceId);
+    Writer.WriteNumber("UsesToAdd", request.UsesToAdd);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3302,10 +3061,10 @@ void UPlayFabServerAPI::HelperModifyItemUses(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FServerModifyItemUsesResult result = UPlayFabServerModelDecoder::decodeModifyItemUsesResultResponse(response.responseData);
-        if (OnSuccessModifyItemUses.IsBound())
+        FServerModifyItemUsesResult result = UPlayFabServerModelDecoder::readModifyItemUsesResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessModifyItemUses.Execute(result, mCustomData);
+            FDelegateOnSuccessModifyItemUses(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3317,12 +3076,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::MoveItemToCharacterFromCharacter(FServerMo
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessMoveItemToCharacterFromCharacter = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperMoveItemToCharacterFromCharacter);
 
@@ -3330,31 +3088,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::MoveItemToCharacterFromCharacter(FServerMo
     manager->PlayFabRequestURL = "/Server/MoveItemToCharacterFromCharacter";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.GivingCharacterId.IsEmpty() || request.GivingCharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GivingCharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GivingCharacterId"), request.GivingCharacterId);
-    }
-    if (request.ReceivingCharacterId.IsEmpty() || request.ReceivingCharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReceivingCharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReceivingCharacterId"), request.ReceivingCharacterId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("GivingCharacterId", request.GivingCharacterId);
+    Writer.WriteString("ReceivingCharacterId", request.ReceivingCharacterId);
+    Writer.WriteString("ItemInstanceId", request.ItemInstanceId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3372,10 +3115,10 @@ void UPlayFabServerAPI::HelperMoveItemToCharacterFromCharacter(FPlayFabBaseModel
     }
     else
     {
-        FServerMoveItemToCharacterFromCharacterResult result = UPlayFabServerModelDecoder::decodeMoveItemToCharacterFromCharacterResultResponse(response.responseData);
-        if (OnSuccessMoveItemToCharacterFromCharacter.IsBound())
+        FServerMoveItemToCharacterFromCharacterResult result = UPlayFabServerModelDecoder::readMoveItemToCharacterFromCharacterResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessMoveItemToCharacterFromCharacter.Execute(result, mCustomData);
+            FDelegateOnSuccessMoveItemToCharacterFromCharacter(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3387,12 +3130,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::MoveItemToCharacterFromUser(FServerMoveIte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessMoveItemToCharacterFromUser = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperMoveItemToCharacterFromUser);
 
@@ -3400,26 +3142,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::MoveItemToCharacterFromUser(FServerMoveIte
     manager->PlayFabRequestURL = "/Server/MoveItemToCharacterFromUser";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("ItemInstanceId", request.ItemInstanceId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3437,10 +3168,10 @@ void UPlayFabServerAPI::HelperMoveItemToCharacterFromUser(FPlayFabBaseModel resp
     }
     else
     {
-        FServerMoveItemToCharacterFromUserResult result = UPlayFabServerModelDecoder::decodeMoveItemToCharacterFromUserResultResponse(response.responseData);
-        if (OnSuccessMoveItemToCharacterFromUser.IsBound())
+        FServerMoveItemToCharacterFromUserResult result = UPlayFabServerModelDecoder::readMoveItemToCharacterFromUserResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessMoveItemToCharacterFromUser.Execute(result, mCustomData);
+            FDelegateOnSuccessMoveItemToCharacterFromUser(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3452,12 +3183,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::MoveItemToUserFromCharacter(FServerMoveIte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessMoveItemToUserFromCharacter = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperMoveItemToUserFromCharacter);
 
@@ -3465,26 +3195,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::MoveItemToUserFromCharacter(FServerMoveIte
     manager->PlayFabRequestURL = "/Server/MoveItemToUserFromCharacter";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("ItemInstanceId", request.ItemInstanceId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3502,10 +3221,10 @@ void UPlayFabServerAPI::HelperMoveItemToUserFromCharacter(FPlayFabBaseModel resp
     }
     else
     {
-        FServerMoveItemToUserFromCharacterResult result = UPlayFabServerModelDecoder::decodeMoveItemToUserFromCharacterResultResponse(response.responseData);
-        if (OnSuccessMoveItemToUserFromCharacter.IsBound())
+        FServerMoveItemToUserFromCharacterResult result = UPlayFabServerModelDecoder::readMoveItemToUserFromCharacterResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessMoveItemToUserFromCharacter.Execute(result, mCustomData);
+            FDelegateOnSuccessMoveItemToUserFromCharacter(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3517,12 +3236,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::RedeemCoupon(FServerRedeemCouponRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRedeemCoupon = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperRedeemCoupon);
 
@@ -3530,31 +3248,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::RedeemCoupon(FServerRedeemCouponRequest re
     manager->PlayFabRequestURL = "/Server/RedeemCoupon";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.CouponCode.IsEmpty() || request.CouponCode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CouponCode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CouponCode"), request.CouponCode);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CouponCode", request.CouponCode);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3572,10 +3275,14 @@ void UPlayFabServerAPI::HelperRedeemCoupon(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FServerRedeemCouponResult result = UPlayFabServerModelDecoder::decodeRedeemCouponResultResponse(response.responseData);
-        if (OnSuccessRedeemCoupon.IsBound())
+        FServerRedeemCouponResult result = UPlayFabServerModelDecoder::readRedeemCouponResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessRedeemCoupon.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillRedeemCouponResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessRedeemCoupon(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3587,12 +3294,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::ReportPlayer(FServerReportPlayerServerRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessReportPlayer = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperReportPlayer);
 
@@ -3600,26 +3306,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::ReportPlayer(FServerReportPlayerServerRequ
     manager->PlayFabRequestURL = "/Server/ReportPlayer";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.ReporterId.IsEmpty() || request.ReporterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReporterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReporterId"), request.ReporterId);
-    }
-    if (request.ReporteeId.IsEmpty() || request.ReporteeId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ReporteeId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ReporteeId"), request.ReporteeId);
-    }
-    if (request.Comment.IsEmpty() || request.Comment == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Comment"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Comment"), request.Comment);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("ReporterId", request.ReporterId);
+    Writer.WriteString("ReporteeId", request.ReporteeId);
+    Writer.WriteString("Comment", request.Comment);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3637,10 +3332,10 @@ void UPlayFabServerAPI::HelperReportPlayer(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FServerReportPlayerServerResult result = UPlayFabServerModelDecoder::decodeReportPlayerServerResultResponse(response.responseData);
-        if (OnSuccessReportPlayer.IsBound())
+        FServerReportPlayerServerResult result = UPlayFabServerModelDecoder::readReportPlayerServerResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessReportPlayer.Execute(result, mCustomData);
+            FDelegateOnSuccessReportPlayer(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3652,12 +3347,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeInventoryItem(FServerRevokeInventory
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRevokeInventoryItem = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperRevokeInventoryItem);
 
@@ -3665,26 +3359,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::RevokeInventoryItem(FServerRevokeInventory
     manager->PlayFabRequestURL = "/Server/RevokeInventoryItem";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("ItemInstanceId", request.ItemInstanceId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3702,10 +3385,10 @@ void UPlayFabServerAPI::HelperRevokeInventoryItem(FPlayFabBaseModel response, UO
     }
     else
     {
-        FServerRevokeInventoryResult result = UPlayFabServerModelDecoder::decodeRevokeInventoryResultResponse(response.responseData);
-        if (OnSuccessRevokeInventoryItem.IsBound())
+        FServerRevokeInventoryResult result = UPlayFabServerModelDecoder::readRevokeInventoryResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRevokeInventoryItem.Execute(result, mCustomData);
+            FDelegateOnSuccessRevokeInventoryItem(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3717,12 +3400,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::SubtractCharacterVirtualCurrency(FServerSu
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSubtractCharacterVirtualCurrency = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperSubtractCharacterVirtualCurrency);
 
@@ -3730,27 +3412,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::SubtractCharacterVirtualCurrency(FServerSu
     manager->PlayFabRequestURL = "/Server/SubtractCharacterVirtualCurrency";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("VirtualCurrency", request.VirtualCurrency);
+    Writer.WriteNumber("Amount", request.Amount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3768,10 +3439,10 @@ void UPlayFabServerAPI::HelperSubtractCharacterVirtualCurrency(FPlayFabBaseModel
     }
     else
     {
-        FServerModifyCharacterVirtualCurrencyResult result = UPlayFabServerModelDecoder::decodeModifyCharacterVirtualCurrencyResultResponse(response.responseData);
-        if (OnSuccessSubtractCharacterVirtualCurrency.IsBound())
+        FServerModifyCharacterVirtualCurrencyResult result = UPlayFabServerModelDecoder::readModifyCharacterVirtualCurrencyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSubtractCharacterVirtualCurrency.Execute(result, mCustomData);
+            FDelegateOnSuccessSubtractCharacterVirtualCurrency(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3783,12 +3454,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::SubtractUserVirtualCurrency(FServerSubtrac
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSubtractUserVirtualCurrency = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperSubtractUserVirtualCurrency);
 
@@ -3796,22 +3466,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::SubtractUserVirtualCurrency(FServerSubtrac
     manager->PlayFabRequestURL = "/Server/SubtractUserVirtualCurrency";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.VirtualCurrency.IsEmpty() || request.VirtualCurrency == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("VirtualCurrency"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("VirtualCurrency"), request.VirtualCurrency);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("Amount"), request.Amount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("VirtualCurrency", request.VirtualCurrency);
+    Writer.WriteNumber("Amount", request.Amount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3829,10 +3492,10 @@ void UPlayFabServerAPI::HelperSubtractUserVirtualCurrency(FPlayFabBaseModel resp
     }
     else
     {
-        FServerModifyUserVirtualCurrencyResult result = UPlayFabServerModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(response.responseData);
-        if (OnSuccessSubtractUserVirtualCurrency.IsBound())
+        FServerModifyUserVirtualCurrencyResult result = UPlayFabServerModelDecoder::readModifyUserVirtualCurrencyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSubtractUserVirtualCurrency.Execute(result, mCustomData);
+            FDelegateOnSuccessSubtractUserVirtualCurrency(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3844,12 +3507,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlockContainerInstance(FServerUnlockConta
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlockContainerInstance = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUnlockContainerInstance);
 
@@ -3857,36 +3519,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlockContainerInstance(FServerUnlockConta
     manager->PlayFabRequestURL = "/Server/UnlockContainerInstance";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ContainerItemInstanceId.IsEmpty() || request.ContainerItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContainerItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContainerItemInstanceId"), request.ContainerItemInstanceId);
-    }
-    if (request.KeyItemInstanceId.IsEmpty() || request.KeyItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeyItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("KeyItemInstanceId"), request.KeyItemInstanceId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::High;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("ContainerItemInstanceId", request.ContainerItemInstanceId);
+    Writer.WriteString("KeyItemInstanceId", request.KeyItemInstanceId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3904,10 +3547,14 @@ void UPlayFabServerAPI::HelperUnlockContainerInstance(FPlayFabBaseModel response
     }
     else
     {
-        FServerUnlockContainerItemResult result = UPlayFabServerModelDecoder::decodeUnlockContainerItemResultResponse(response.responseData);
-        if (OnSuccessUnlockContainerInstance.IsBound())
+        FServerUnlockContainerItemResult result = UPlayFabServerModelDecoder::readUnlockContainerItemResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillUnlockContainerItemResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUnlockContainerInstance.Execute(result, mCustomData);
+            FDelegateOnSuccessUnlockContainerInstance(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3919,12 +3566,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlockContainerItem(FServerUnlockContainer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUnlockContainerItem = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUnlockContainerItem);
 
@@ -3932,31 +3578,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::UnlockContainerItem(FServerUnlockContainer
     manager->PlayFabRequestURL = "/Server/UnlockContainerItem";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ContainerItemId.IsEmpty() || request.ContainerItemId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContainerItemId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContainerItemId"), request.ContainerItemId);
-    }
-    if (request.CatalogVersion.IsEmpty() || request.CatalogVersion == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CatalogVersion"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CatalogVersion"), request.CatalogVersion);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("ContainerItemId", request.ContainerItemId);
+    Writer.WriteString("CatalogVersion", request.CatalogVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -3974,10 +3605,14 @@ void UPlayFabServerAPI::HelperUnlockContainerItem(FPlayFabBaseModel response, UO
     }
     else
     {
-        FServerUnlockContainerItemResult result = UPlayFabServerModelDecoder::decodeUnlockContainerItemResultResponse(response.responseData);
-        if (OnSuccessUnlockContainerItem.IsBound())
+        FServerUnlockContainerItemResult result = UPlayFabServerModelDecoder::readUnlockContainerItemResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessUnlockContainerItem.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillUnlockContainerItemResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessUnlockContainerItem(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -3989,12 +3624,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserInventoryItemCustomData(FServerU
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateUserInventoryItemCustomData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateUserInventoryItemCustomData);
 
@@ -4002,35 +3636,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateUserInventoryItemCustomData(FServerU
     manager->PlayFabRequestURL = "/Server/UpdateUserInventoryItemCustomData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.ItemInstanceId.IsEmpty() || request.ItemInstanceId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ItemInstanceId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ItemInstanceId"), request.ItemInstanceId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("ItemInstanceId", request.ItemInstanceId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4048,10 +3665,10 @@ void UPlayFabServerAPI::HelperUpdateUserInventoryItemCustomData(FPlayFabBaseMode
     }
     else
     {
-        FServerEmptyResult result = UPlayFabServerModelDecoder::decodeEmptyResultResponse(response.responseData);
-        if (OnSuccessUpdateUserInventoryItemCustomData.IsBound())
+        FServerEmptyResult result = UPlayFabServerModelDecoder::readEmptyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateUserInventoryItemCustomData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateUserInventoryItemCustomData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4067,12 +3684,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddFriend(FServerAddFriendRequest request,
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddFriend = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperAddFriend);
 
@@ -4080,36 +3696,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddFriend(FServerAddFriendRequest request,
     manager->PlayFabRequestURL = "/Server/AddFriend";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-    if (request.FriendUsername.IsEmpty() || request.FriendUsername == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendUsername"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendUsername"), request.FriendUsername);
-    }
-    if (request.FriendEmail.IsEmpty() || request.FriendEmail == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendEmail"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendEmail"), request.FriendEmail);
-    }
-    if (request.FriendTitleDisplayName.IsEmpty() || request.FriendTitleDisplayName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendTitleDisplayName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendTitleDisplayName"), request.FriendTitleDisplayName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("FriendPlayFabId", request.FriendPlayFabId);
+    Writer.WriteString("FriendUsername", request.FriendUsername);
+    Writer.WriteString("FriendEmail", request.FriendEmail);
+    Writer.WriteString("FriendTitleDisplayName", request.FriendTitleDisplayName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4127,10 +3724,10 @@ void UPlayFabServerAPI::HelperAddFriend(FPlayFabBaseModel response, UObject* cus
     }
     else
     {
-        FServerEmptyResult result = UPlayFabServerModelDecoder::decodeEmptyResultResponse(response.responseData);
-        if (OnSuccessAddFriend.IsBound())
+        FServerEmptyResult result = UPlayFabServerModelDecoder::readEmptyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddFriend.Execute(result, mCustomData);
+            FDelegateOnSuccessAddFriend(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4142,12 +3739,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetFriendsList(FServerGetFriendsListReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetFriendsList = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetFriendsList);
 
@@ -4155,18 +3751,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetFriendsList(FServerGetFriendsListReques
     manager->PlayFabRequestURL = "/Server/GetFriendsList";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("IncludeSteamFriends"), request.IncludeSteamFriends);
-    OutRestJsonObj->SetBoolField(TEXT("IncludeFacebookFriends"), request.IncludeFacebookFriends);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteBool("IncludeSteamFriends", request.IncludeSteamFriends);
+    Writer.WriteBool("IncludeFacebookFriends", request.IncludeFacebookFriends);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4184,10 +3779,14 @@ void UPlayFabServerAPI::HelperGetFriendsList(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FServerGetFriendsListResult result = UPlayFabServerModelDecoder::decodeGetFriendsListResultResponse(response.responseData);
-        if (OnSuccessGetFriendsList.IsBound())
+        FServerGetFriendsListResult result = UPlayFabServerModelDecoder::readGetFriendsListResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetFriendsListResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetFriendsList.Execute(result, mCustomData);
+            FDelegateOnSuccessGetFriendsList(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4199,12 +3798,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemoveFriend(FServerRemoveFriendRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRemoveFriend = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperRemoveFriend);
 
@@ -4212,21 +3810,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemoveFriend(FServerRemoveFriendRequest re
     manager->PlayFabRequestURL = "/Server/RemoveFriend";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("FriendPlayFabId", request.FriendPlayFabId);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4244,10 +3835,10 @@ void UPlayFabServerAPI::HelperRemoveFriend(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FServerEmptyResult result = UPlayFabServerModelDecoder::decodeEmptyResultResponse(response.responseData);
-        if (OnSuccessRemoveFriend.IsBound())
+        FServerEmptyResult result = UPlayFabServerModelDecoder::readEmptyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRemoveFriend.Execute(result, mCustomData);
+            FDelegateOnSuccessRemoveFriend(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4259,12 +3850,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetFriendTags(FServerSetFriendTagsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetFriendTags = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperSetFriendTags);
 
@@ -4272,29 +3862,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetFriendTags(FServerSetFriendTagsRequest
     manager->PlayFabRequestURL = "/Server/SetFriendTags";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.FriendPlayFabId.IsEmpty() || request.FriendPlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FriendPlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FriendPlayFabId"), request.FriendPlayFabId);
-    }
-    // Check to see if string is empty
-    if (request.Tags.IsEmpty() || request.Tags == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Tags"));
-    } else {
-        TArray<FString> TagsArray;
-        FString(request.Tags).ParseIntoArray(TagsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Tags"), TagsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("FriendPlayFabId", request.FriendPlayFabId);
+    Writer.WriteStringList("Tags", request.Tags);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4312,10 +3889,10 @@ void UPlayFabServerAPI::HelperSetFriendTags(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FServerEmptyResult result = UPlayFabServerModelDecoder::decodeEmptyResultResponse(response.responseData);
-        if (OnSuccessSetFriendTags.IsBound())
+        FServerEmptyResult result = UPlayFabServerModelDecoder::readEmptyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetFriendTags.Execute(result, mCustomData);
+            FDelegateOnSuccessSetFriendTags(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4331,12 +3908,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeregisterGame(FServerDeregisterGameReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessDeregisterGame = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperDeregisterGame);
 
@@ -4344,16 +3920,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeregisterGame(FServerDeregisterGameReques
     manager->PlayFabRequestURL = "/Server/DeregisterGame";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4371,10 +3944,10 @@ void UPlayFabServerAPI::HelperDeregisterGame(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FServerDeregisterGameResponse result = UPlayFabServerModelDecoder::decodeDeregisterGameResponseResponse(response.responseData);
-        if (OnSuccessDeregisterGame.IsBound())
+        FServerDeregisterGameResponse result = UPlayFabServerModelDecoder::readDeregisterGameResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessDeregisterGame.Execute(result, mCustomData);
+            FDelegateOnSuccessDeregisterGame(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4386,12 +3959,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::NotifyMatchmakerPlayerLeft(FServerNotifyMa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessNotifyMatchmakerPlayerLeft = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperNotifyMatchmakerPlayerLeft);
 
@@ -4399,21 +3971,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::NotifyMatchmakerPlayerLeft(FServerNotifyMa
     manager->PlayFabRequestURL = "/Server/NotifyMatchmakerPlayerLeft";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4431,10 +3996,10 @@ void UPlayFabServerAPI::HelperNotifyMatchmakerPlayerLeft(FPlayFabBaseModel respo
     }
     else
     {
-        FServerNotifyMatchmakerPlayerLeftResult result = UPlayFabServerModelDecoder::decodeNotifyMatchmakerPlayerLeftResultResponse(response.responseData);
-        if (OnSuccessNotifyMatchmakerPlayerLeft.IsBound())
+        FServerNotifyMatchmakerPlayerLeftResult result = UPlayFabServerModelDecoder::readNotifyMatchmakerPlayerLeftResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessNotifyMatchmakerPlayerLeft.Execute(result, mCustomData);
+            FDelegateOnSuccessNotifyMatchmakerPlayerLeft(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4446,12 +4011,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::RedeemMatchmakerTicket(FServerRedeemMatchm
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRedeemMatchmakerTicket = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperRedeemMatchmakerTicket);
 
@@ -4459,21 +4023,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::RedeemMatchmakerTicket(FServerRedeemMatchm
     manager->PlayFabRequestURL = "/Server/RedeemMatchmakerTicket";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
 
-    // Serialize all the request properties to json
-    if (request.Ticket.IsEmpty() || request.Ticket == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Ticket"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Ticket"), request.Ticket);
-    }
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Ticket", request.Ticket);
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4491,10 +4048,14 @@ void UPlayFabServerAPI::HelperRedeemMatchmakerTicket(FPlayFabBaseModel response,
     }
     else
     {
-        FServerRedeemMatchmakerTicketResult result = UPlayFabServerModelDecoder::decodeRedeemMatchmakerTicketResultResponse(response.responseData);
-        if (OnSuccessRedeemMatchmakerTicket.IsBound())
+        FServerRedeemMatchmakerTicketResult result = UPlayFabServerModelDecoder::readRedeemMatchmakerTicketResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessRedeemMatchmakerTicket.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillRedeemMatchmakerTicketResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessRedeemMatchmakerTicket(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4506,12 +4067,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::RefreshGameServerInstanceHeartbeat(FServer
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRefreshGameServerInstanceHeartbeat = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperRefreshGameServerInstanceHeartbeat);
 
@@ -4519,16 +4079,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::RefreshGameServerInstanceHeartbeat(FServer
     manager->PlayFabRequestURL = "/Server/RefreshGameServerInstanceHeartbeat";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4546,10 +4104,10 @@ void UPlayFabServerAPI::HelperRefreshGameServerInstanceHeartbeat(FPlayFabBaseMod
     }
     else
     {
-        FServerRefreshGameServerInstanceHeartbeatResult result = UPlayFabServerModelDecoder::decodeRefreshGameServerInstanceHeartbeatResultResponse(response.responseData);
-        if (OnSuccessRefreshGameServerInstanceHeartbeat.IsBound())
+        FServerRefreshGameServerInstanceHeartbeatResult result = UPlayFabServerModelDecoder::readRefreshGameServerInstanceHeartbeatResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRefreshGameServerInstanceHeartbeat.Execute(result, mCustomData);
+            FDelegateOnSuccessRefreshGameServerInstanceHeartbeat(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4561,12 +4119,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::RegisterGame(FServerRegisterGameRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRegisterGame = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperRegisterGame);
 
@@ -4574,40 +4131,19 @@ UPlayFabServerAPI* UPlayFabServerAPI::RegisterGame(FServerRegisterGameRequest re
     manager->PlayFabRequestURL = "/Server/RegisterGame";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.ServerHost.IsEmpty() || request.ServerHost == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerHost"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerHost"), request.ServerHost);
-    }
-    if (request.ServerPort.IsEmpty() || request.ServerPort == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ServerPort"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ServerPort"), request.ServerPort);
-    }
-    if (request.Build.IsEmpty() || request.Build == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Build"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Build"), request.Build);
-    }
-    FString temp_Region;
-    if (GetEnumValueToString<ERegion>(TEXT("ERegion"), request.Region, temp_Region))
-        OutRestJsonObj->SetStringField(TEXT("Region"), temp_Region);
-    if (request.GameMode.IsEmpty() || request.GameMode == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameMode"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameMode"), request.GameMode);
-    }
-    if (request.Tags != nullptr) OutRestJsonObj->SetObjectField(TEXT("Tags"), request.Tags);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Critical;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteString("ServerHost", request.ServerHost);
+    Writer.WriteString("ServerPort", request.ServerPort);
+    Writer.WriteString("Build", request.Build);
+    Writer.WriteEnum("Region", GetEnumName(request.Region));
+    Writer.WriteString("GameMode", request.GameMode);
+    Writer.WriteObject("Tags", request.Tags);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4625,10 +4161,10 @@ void UPlayFabServerAPI::HelperRegisterGame(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FServerRegisterGameResponse result = UPlayFabServerModelDecoder::decodeRegisterGameResponseResponse(response.responseData);
-        if (OnSuccessRegisterGame.IsBound())
+        FServerRegisterGameResponse result = UPlayFabServerModelDecoder::readRegisterGameResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRegisterGame.Execute(result, mCustomData);
+            FDelegateOnSuccessRegisterGame(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4640,12 +4176,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetGameServerInstanceData(FServerSetGameSe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetGameServerInstanceData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperSetGameServerInstanceData);
 
@@ -4653,21 +4188,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetGameServerInstanceData(FServerSetGameSe
     manager->PlayFabRequestURL = "/Server/SetGameServerInstanceData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.GameServerData.IsEmpty() || request.GameServerData == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("GameServerData"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("GameServerData"), request.GameServerData);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteString("GameServerData", request.GameServerData);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4685,10 +4214,10 @@ void UPlayFabServerAPI::HelperSetGameServerInstanceData(FPlayFabBaseModel respon
     }
     else
     {
-        FServerSetGameServerInstanceDataResult result = UPlayFabServerModelDecoder::decodeSetGameServerInstanceDataResultResponse(response.responseData);
-        if (OnSuccessSetGameServerInstanceData.IsBound())
+        FServerSetGameServerInstanceDataResult result = UPlayFabServerModelDecoder::readSetGameServerInstanceDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetGameServerInstanceData.Execute(result, mCustomData);
+            FDelegateOnSuccessSetGameServerInstanceData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4700,12 +4229,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetGameServerInstanceState(FServerSetGameS
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetGameServerInstanceState = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperSetGameServerInstanceState);
 
@@ -4713,19 +4241,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetGameServerInstanceState(FServerSetGameS
     manager->PlayFabRequestURL = "/Server/SetGameServerInstanceState";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    FString temp_State;
-    if (GetEnumValueToString<EGameInstanceState>(TEXT("EGameInstanceState"), request.State, temp_State))
-        OutRestJsonObj->SetStringField(TEXT("State"), temp_State);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteEnum("State", GetEnumName(request.State));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4743,10 +4267,10 @@ void UPlayFabServerAPI::HelperSetGameServerInstanceState(FPlayFabBaseModel respo
     }
     else
     {
-        FServerSetGameServerInstanceStateResult result = UPlayFabServerModelDecoder::decodeSetGameServerInstanceStateResultResponse(response.responseData);
-        if (OnSuccessSetGameServerInstanceState.IsBound())
+        FServerSetGameServerInstanceStateResult result = UPlayFabServerModelDecoder::readSetGameServerInstanceStateResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetGameServerInstanceState.Execute(result, mCustomData);
+            FDelegateOnSuccessSetGameServerInstanceState(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4758,12 +4282,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetGameServerInstanceTags(FServerSetGameSe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessSetGameServerInstanceTags = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperSetGameServerInstanceTags);
 
@@ -4771,17 +4294,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::SetGameServerInstanceTags(FServerSetGameSe
     manager->PlayFabRequestURL = "/Server/SetGameServerInstanceTags";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.LobbyId.IsEmpty() || request.LobbyId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("LobbyId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("LobbyId"), request.LobbyId);
-    }
-    if (request.Tags != nullptr) OutRestJsonObj->SetObjectField(TEXT("Tags"), request.Tags);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("LobbyId", request.LobbyId);
+    Writer.WriteObject("Tags", request.Tags);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4799,10 +4320,10 @@ void UPlayFabServerAPI::HelperSetGameServerInstanceTags(FPlayFabBaseModel respon
     }
     else
     {
-        FServerSetGameServerInstanceTagsResult result = UPlayFabServerModelDecoder::decodeSetGameServerInstanceTagsResultResponse(response.responseData);
-        if (OnSuccessSetGameServerInstanceTags.IsBound())
+        FServerSetGameServerInstanceTagsResult result = UPlayFabServerModelDecoder::readSetGameServerInstanceTagsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessSetGameServerInstanceTags.Execute(result, mCustomData);
+            FDelegateOnSuccessSetGameServerInstanceTags(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4818,12 +4339,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::WriteCharacterEvent(FServerWriteServerChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessWriteCharacterEvent = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperWriteCharacterEvent);
 
@@ -4831,32 +4351,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::WriteCharacterEvent(FServerWriteServerChar
     manager->PlayFabRequestURL = "/Server/WriteCharacterEvent";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("EventName", request.EventName);
+    Writer.WriteString("Timestamp", request.Timestamp);
+    Writer.WriteObject("Body", request.Body);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4874,10 +4379,10 @@ void UPlayFabServerAPI::HelperWriteCharacterEvent(FPlayFabBaseModel response, UO
     }
     else
     {
-        FServerWriteEventResponse result = UPlayFabServerModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        if (OnSuccessWriteCharacterEvent.IsBound())
+        FServerWriteEventResponse result = UPlayFabServerModelDecoder::readWriteEventResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessWriteCharacterEvent.Execute(result, mCustomData);
+            FDelegateOnSuccessWriteCharacterEvent(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4889,12 +4394,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::WritePlayerEvent(FServerWriteServerPlayerE
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessWritePlayerEvent = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperWritePlayerEvent);
 
@@ -4902,27 +4406,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::WritePlayerEvent(FServerWriteServerPlayerE
     manager->PlayFabRequestURL = "/Server/WritePlayerEvent";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("EventName", request.EventName);
+    Writer.WriteString("Timestamp", request.Timestamp);
+    Writer.WriteObject("Body", request.Body);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -4940,10 +4433,10 @@ void UPlayFabServerAPI::HelperWritePlayerEvent(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FServerWriteEventResponse result = UPlayFabServerModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        if (OnSuccessWritePlayerEvent.IsBound())
+        FServerWriteEventResponse result = UPlayFabServerModelDecoder::readWriteEventResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessWritePlayerEvent.Execute(result, mCustomData);
+            FDelegateOnSuccessWritePlayerEvent(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -4955,12 +4448,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::WriteTitleEvent(FServerWriteTitleEventRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessWriteTitleEvent = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperWriteTitleEvent);
 
@@ -4968,22 +4460,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::WriteTitleEvent(FServerWriteTitleEventRequ
     manager->PlayFabRequestURL = "/Server/WriteTitleEvent";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Low;
 
-    // Serialize all the request properties to json
-    if (request.EventName.IsEmpty() || request.EventName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("EventName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("EventName"), request.EventName);
-    }
-    if (request.Timestamp.IsEmpty() || request.Timestamp == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Timestamp"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Timestamp"), request.Timestamp);
-    }
-    if (request.Body != nullptr) OutRestJsonObj->SetObjectField(TEXT("Body"), request.Body);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("EventName", request.EventName);
+    Writer.WriteString("Timestamp", request.Timestamp);
+    Writer.WriteObject("Body", request.Body);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5001,10 +4486,10 @@ void UPlayFabServerAPI::HelperWriteTitleEvent(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FServerWriteEventResponse result = UPlayFabServerModelDecoder::decodeWriteEventResponseResponse(response.responseData);
-        if (OnSuccessWriteTitleEvent.IsBound())
+        FServerWriteEventResponse result = UPlayFabServerModelDecoder::readWriteEventResponseResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessWriteTitleEvent.Execute(result, mCustomData);
+            FDelegateOnSuccessWriteTitleEvent(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5020,12 +4505,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddSharedGroupMembers(FServerAddSharedGrou
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddSharedGroupMembers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperAddSharedGroupMembers);
 
@@ -5033,24 +4517,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddSharedGroupMembers(FServerAddSharedGrou
     manager->PlayFabRequestURL = "/Server/AddSharedGroupMembers";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-    // Check to see if string is empty
-    if (request.PlayFabIds.IsEmpty() || request.PlayFabIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIds"));
-    } else {
-        TArray<FString> PlayFabIdsArray;
-        FString(request.PlayFabIds).ParseIntoArray(PlayFabIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIds"), PlayFabIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteStringList("PlayFabIds", request.PlayFabIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5068,10 +4542,10 @@ void UPlayFabServerAPI::HelperAddSharedGroupMembers(FPlayFabBaseModel response,
     }
     else
     {
-        FServerAddSharedGroupMembersResult result = UPlayFabServerModelDecoder::decodeAddSharedGroupMembersResultResponse(response.responseData);
-        if (OnSuccessAddSharedGroupMembers.IsBound())
+        FServerAddSharedGroupMembersResult result = UPlayFabServerModelDecoder::readAddSharedGroupMembersResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddSharedGroupMembers.Execute(result, mCustomData);
+            FDelegateOnSuccessAddSharedGroupMembers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5083,12 +4557,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::CreateSharedGroup(FServerCreateSharedGroup
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessCreateSharedGroup = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperCreateSharedGroup);
 
@@ -5096,16 +4569,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::CreateSharedGroup(FServerCreateSharedGroup
     manager->PlayFabRequestURL = "/Server/CreateSharedGroup";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5123,10 +4593,10 @@ void UPlayFabServerAPI::HelperCreateSharedGroup(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FServerCreateSharedGroupResult result = UPlayFabServerModelDecoder::decodeCreateSharedGroupResultResponse(response.responseData);
-        if (OnSuccessCreateSharedGroup.IsBound())
+        FServerCreateSharedGroupResult result = UPlayFabServerModelDecoder::readCreateSharedGroupResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessCreateSharedGroup.Execute(result, mCustomData);
+            FDelegateOnSuccessCreateSharedGroup(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5138,12 +4608,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeleteSharedGroup(FServerDeleteSharedGroup
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessDeleteSharedGroup = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperDeleteSharedGroup);
 
@@ -5151,16 +4620,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeleteSharedGroup(FServerDeleteSharedGroup
     manager->PlayFabRequestURL = "/Server/DeleteSharedGroup";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5178,10 +4644,10 @@ void UPlayFabServerAPI::HelperDeleteSharedGroup(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FServerEmptyResult result = UPlayFabServerModelDecoder::decodeEmptyResultResponse(response.responseData);
-        if (OnSuccessDeleteSharedGroup.IsBound())
+        FServerEmptyResult result = UPlayFabServerModelDecoder::readEmptyResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessDeleteSharedGroup.Execute(result, mCustomData);
+            FDelegateOnSuccessDeleteSharedGroup(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5193,12 +4659,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetSharedGroupData(FServerGetSharedGroupDa
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetSharedGroupData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetSharedGroupData);
 
@@ -5206,25 +4671,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetSharedGroupData(FServerGetSharedGroupDa
     manager->PlayFabRequestURL = "/Server/GetSharedGroupData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("GetMembers"), request.GetMembers);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteBool("GetMembers", request.GetMembers);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5242,10 +4699,14 @@ void UPlayFabServerAPI::HelperGetSharedGroupData(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FServerGetSharedGroupDataResult result = UPlayFabServerModelDecoder::decodeGetSharedGroupDataResultResponse(response.responseData);
-        if (OnSuccessGetSharedGroupData.IsBound())
+        FServerGetSharedGroupDataResult result = UPlayFabServerModelDecoder::readGetSharedGroupDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetSharedGroupDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetSharedGroupData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetSharedGroupData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5257,12 +4718,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemoveSharedGroupMembers(FServerRemoveShar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRemoveSharedGroupMembers = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperRemoveSharedGroupMembers);
 
@@ -5270,24 +4730,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemoveSharedGroupMembers(FServerRemoveShar
     manager->PlayFabRequestURL = "/Server/RemoveSharedGroupMembers";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-    // Check to see if string is empty
-    if (request.PlayFabIds.IsEmpty() || request.PlayFabIds == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabIds"));
-    } else {
-        TArray<FString> PlayFabIdsArray;
-        FString(request.PlayFabIds).ParseIntoArray(PlayFabIdsArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("PlayFabIds"), PlayFabIdsArray);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteStringList("PlayFabIds", request.PlayFabIds);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5305,10 +4755,10 @@ void UPlayFabServerAPI::HelperRemoveSharedGroupMembers(FPlayFabBaseModel respons
     }
     else
     {
-        FServerRemoveSharedGroupMembersResult result = UPlayFabServerModelDecoder::decodeRemoveSharedGroupMembersResultResponse(response.responseData);
-        if (OnSuccessRemoveSharedGroupMembers.IsBound())
+        FServerRemoveSharedGroupMembersResult result = UPlayFabServerModelDecoder::readRemoveSharedGroupMembersResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRemoveSharedGroupMembers.Execute(result, mCustomData);
+            FDelegateOnSuccessRemoveSharedGroupMembers(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5320,12 +4770,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateSharedGroupData(FServerUpdateSharedG
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateSharedGroupData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateSharedGroupData);
 
@@ -5333,28 +4782,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateSharedGroupData(FServerUpdateSharedG
     manager->PlayFabRequestURL = "/Server/UpdateSharedGroupData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.SharedGroupId.IsEmpty() || request.SharedGroupId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SharedGroupId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SharedGroupId"), request.SharedGroupId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SharedGroupId", request.SharedGroupId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5372,10 +4810,10 @@ void UPlayFabServerAPI::HelperUpdateSharedGroupData(FPlayFabBaseModel response,
     }
     else
     {
-        FServerUpdateSharedGroupDataResult result = UPlayFabServerModelDecoder::decodeUpdateSharedGroupDataResultResponse(response.responseData);
-        if (OnSuccessUpdateSharedGroupData.IsBound())
+        FServerUpdateSharedGroupDataResult result = UPlayFabServerModelDecoder::readUpdateSharedGroupDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateSharedGroupData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateSharedGroupData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5391,12 +4829,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::ExecuteCloudScript(FServerExecuteCloudScri
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessExecuteCloudScript = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperExecuteCloudScript);
 
@@ -5404,27 +4841,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::ExecuteCloudScript(FServerExecuteCloudScri
     manager->PlayFabRequestURL = "/Server/ExecuteCloudScript";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.FunctionName.IsEmpty() || request.FunctionName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("FunctionName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("FunctionName"), request.FunctionName);
-    }
-    if (request.FunctionParameter != nullptr) OutRestJsonObj->SetObjectField(TEXT("FunctionParameter"), request.FunctionParameter);
-    FString temp_RevisionSelection;
-    if (GetEnumValueToString<ECloudScriptRevisionOption>(TEXT("ECloudScriptRevisionOption"), request.RevisionSelection, temp_RevisionSelection))
-        OutRestJsonObj->SetStringField(TEXT("RevisionSelection"), temp_RevisionSelection);
-    OutRestJsonObj->SetNumberField(TEXT("SpecificRevision"), request.SpecificRevision);
-    OutRestJsonObj->SetBoolField(TEXT("GeneratePlayStreamEvent"), request.GeneratePlayStreamEvent);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("FunctionName", request.FunctionName);
+    Writer.WriteObject("FunctionParameter", request.FunctionParameter);
+    Writer.WriteEnum("RevisionSelection", GetEnumName(request.RevisionSelection));
+    Writer.WriteNumber("SpecificRevision", request.SpecificRevision);
+    Writer.WriteBool("GeneratePlayStreamEvent", request.GeneratePlayStreamEvent);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5442,10 +4870,14 @@ void UPlayFabServerAPI::HelperExecuteCloudScript(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FServerExecuteCloudScriptResult result = UPlayFabServerModelDecoder::decodeExecuteCloudScriptResultResponse(response.responseData);
-        if (OnSuccessExecuteCloudScript.IsBound())
+        FServerExecuteCloudScriptResult result = UPlayFabServerModelDecoder::readExecuteCloudScriptResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillExecuteCloudScriptResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessExecuteCloudScript.Execute(result, mCustomData);
+            FDelegateOnSuccessExecuteCloudScript(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5461,12 +4893,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetContentDownloadUrl(FServerGetContentDow
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetContentDownloadUrl = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetContentDownloadUrl);
 
@@ -5474,22 +4905,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetContentDownloadUrl(FServerGetContentDow
     manager->PlayFabRequestURL = "/Server/GetContentDownloadUrl";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
 
-    // Serialize all the request properties to json
-    if (request.Key.IsEmpty() || request.Key == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Key"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Key"), request.Key);
-    }
-    if (request.HttpMethod.IsEmpty() || request.HttpMethod == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("HttpMethod"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("HttpMethod"), request.HttpMethod);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("ThruCDN"), request.ThruCDN);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("Key", request.Key);
+    Writer.WriteString("HttpMethod", request.HttpMethod);
+    Writer.WriteBool("ThruCDN", request.ThruCDN);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5507,10 +4932,10 @@ void UPlayFabServerAPI::HelperGetContentDownloadUrl(FPlayFabBaseModel response,
     }
     else
     {
-        FServerGetContentDownloadUrlResult result = UPlayFabServerModelDecoder::decodeGetContentDownloadUrlResultResponse(response.responseData);
-        if (OnSuccessGetContentDownloadUrl.IsBound())
+        FServerGetContentDownloadUrlResult result = UPlayFabServerModelDecoder::readGetContentDownloadUrlResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetContentDownloadUrl.Execute(result, mCustomData);
+            FDelegateOnSuccessGetContentDownloadUrl(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5526,12 +4951,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeleteCharacterFromUser(FServerDeleteChara
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessDeleteCharacterFromUser = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperDeleteCharacterFromUser);
 
@@ -5539,22 +4963,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::DeleteCharacterFromUser(FServerDeleteChara
     manager->PlayFabRequestURL = "/Server/DeleteCharacterFromUser";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    OutRestJsonObj->SetBoolField(TEXT("SaveCharacterInventory"), request.SaveCharacterInventory);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteBool("SaveCharacterInventory", request.SaveCharacterInventory);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5572,10 +4989,10 @@ void UPlayFabServerAPI::HelperDeleteCharacterFromUser(FPlayFabBaseModel response
     }
     else
     {
-        FServerDeleteCharacterFromUserResult result = UPlayFabServerModelDecoder::decodeDeleteCharacterFromUserResultResponse(response.responseData);
-        if (OnSuccessDeleteCharacterFromUser.IsBound())
+        FServerDeleteCharacterFromUserResult result = UPlayFabServerModelDecoder::readDeleteCharacterFromUserResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessDeleteCharacterFromUser.Execute(result, mCustomData);
+            FDelegateOnSuccessDeleteCharacterFromUser(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5587,12 +5004,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetAllUsersCharacters(FServerListUsersChar
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetAllUsersCharacters = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetAllUsersCharacters);
 
@@ -5600,16 +5016,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetAllUsersCharacters(FServerListUsersChar
     manager->PlayFabRequestURL = "/Server/GetAllUsersCharacters";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5627,10 +5042,14 @@ void UPlayFabServerAPI::HelperGetAllUsersCharacters(FPlayFabBaseModel response,
     }
     else
     {
-        FServerListUsersCharactersResult result = UPlayFabServerModelDecoder::decodeListUsersCharactersResultResponse(response.responseData);
-        if (OnSuccessGetAllUsersCharacters.IsBound())
+        FServerListUsersCharactersResult result = UPlayFabServerModelDecoder::readListUsersCharactersResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillListUsersCharactersResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetAllUsersCharacters.Execute(result, mCustomData);
+            FDelegateOnSuccessGetAllUsersCharacters(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5642,12 +5061,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterLeaderboard(FServerGetCharacte
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterLeaderboard = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetCharacterLeaderboard);
 
@@ -5655,28 +5073,19 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterLeaderboard(FServerGetCharacte
     manager->PlayFabRequestURL = "/Server/GetCharacterLeaderboard";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CharacterType.IsEmpty() || request.CharacterType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterType"), request.CharacterType);
-    }
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("StartPosition"), request.StartPosition);
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("CharacterType", request.CharacterType);
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteNumber("StartPosition", request.StartPosition);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5694,10 +5103,14 @@ void UPlayFabServerAPI::HelperGetCharacterLeaderboard(FPlayFabBaseModel response
     }
     else
     {
-        FServerGetCharacterLeaderboardResult result = UPlayFabServerModelDecoder::decodeGetCharacterLeaderboardResultResponse(response.responseData);
-        if (OnSuccessGetCharacterLeaderboard.IsBound())
+        FServerGetCharacterLeaderboardResult result = UPlayFabServerModelDecoder::readGetCharacterLeaderboardResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetCharacterLeaderboard.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillGetCharacterLeaderboardResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetCharacterLeaderboard(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5709,12 +5122,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterStatistics(FServerGetCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetCharacterStatistics);
 
@@ -5722,21 +5134,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterStatistics(FServerGetCharacter
     manager->PlayFabRequestURL = "/Server/GetCharacterStatistics";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5754,10 +5161,14 @@ void UPlayFabServerAPI::HelperGetCharacterStatistics(FPlayFabBaseModel response,
     }
     else
     {
-        FServerGetCharacterStatisticsResult result = UPlayFabServerModelDecoder::decodeGetCharacterStatisticsResultResponse(response.responseData);
-        if (OnSuccessGetCharacterStatistics.IsBound())
+        FServerGetCharacterStatisticsResult result = UPlayFabServerModelDecoder::readGetCharacterStatisticsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetCharacterStatisticsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCharacterStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCharacterStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5769,12 +5180,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboardAroundCharacter(FServerGetLe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetLeaderboardAroundCharacter = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetLeaderboardAroundCharacter);
 
@@ -5782,32 +5192,19 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboardAroundCharacter(FServerGetLe
     manager->PlayFabRequestURL = "/Server/GetLeaderboardAroundCharacter";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CharacterType.IsEmpty() || request.CharacterType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterType"), request.CharacterType);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteString("CharacterType", request.CharacterType);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5825,10 +5222,14 @@ void UPlayFabServerAPI::HelperGetLeaderboardAroundCharacter(FPlayFabBaseModel re
     }
     else
     {
-        FServerGetLeaderboardAroundCharacterResult result = UPlayFabServerModelDecoder::decodeGetLeaderboardAroundCharacterResultResponse(response.responseData);
-        if (OnSuccessGetLeaderboardAroundCharacter.IsBound())
+        FServerGetLeaderboardAroundCharacterResult result = UPlayFabServerModelDecoder::readGetLeaderboardAroundCharacterResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetLeaderboardAroundCharacterResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetLeaderboardAroundCharacter.Execute(result, mCustomData);
+            FDelegateOnSuccessGetLeaderboardAroundCharacter(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5840,12 +5241,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboardForUserCharacters(FServerGet
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetLeaderboardForUserCharacters = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetLeaderboardForUserCharacters);
 
@@ -5853,22 +5253,17 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetLeaderboardForUserCharacters(FServerGet
     manager->PlayFabRequestURL = "/Server/GetLeaderboardForUserCharacters";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.StatisticName.IsEmpty() || request.StatisticName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("StatisticName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("StatisticName"), request.StatisticName);
-    }
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("MaxResultsCount"), request.MaxResultsCount);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Low;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("StatisticName", request.StatisticName);
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteNumber("MaxResultsCount", request.MaxResultsCount);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5886,10 +5281,14 @@ void UPlayFabServerAPI::HelperGetLeaderboardForUserCharacters(FPlayFabBaseModel
     }
     else
     {
-        FServerGetLeaderboardForUsersCharactersResult result = UPlayFabServerModelDecoder::decodeGetLeaderboardForUsersCharactersResultResponse(response.responseData);
-        if (OnSuccessGetLeaderboardForUserCharacters.IsBound())
+        FServerGetLeaderboardForUsersCharactersResult result = UPlayFabServerModelDecoder::readGetLeaderboardForUsersCharactersResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetLeaderboardForUsersCharactersResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetLeaderboardForUserCharacters.Execute(result, mCustomData);
+            FDelegateOnSuccessGetLeaderboardForUserCharacters(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5901,12 +5300,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantCharacterToUser(FServerGrantCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGrantCharacterToUser = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGrantCharacterToUser);
 
@@ -5914,26 +5312,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GrantCharacterToUser(FServerGrantCharacter
     manager->PlayFabRequestURL = "/Server/GrantCharacterToUser";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::High;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterName.IsEmpty() || request.CharacterName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterName"), request.CharacterName);
-    }
-    if (request.CharacterType.IsEmpty() || request.CharacterType == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterType"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterType"), request.CharacterType);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterName", request.CharacterName);
+    Writer.WriteString("CharacterType", request.CharacterType);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -5951,10 +5338,10 @@ void UPlayFabServerAPI::HelperGrantCharacterToUser(FPlayFabBaseModel response, U
     }
     else
     {
-        FServerGrantCharacterToUserResult result = UPlayFabServerModelDecoder::decodeGrantCharacterToUserResultResponse(response.responseData);
-        if (OnSuccessGrantCharacterToUser.IsBound())
+        FServerGrantCharacterToUserResult result = UPlayFabServerModelDecoder::readGrantCharacterToUserResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGrantCharacterToUser.Execute(result, mCustomData);
+            FDelegateOnSuccessGrantCharacterToUser(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -5966,12 +5353,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterStatistics(FServerUpdateCha
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateCharacterStatistics = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateCharacterStatistics);
 
@@ -5979,22 +5365,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterStatistics(FServerUpdateCha
     manager->PlayFabRequestURL = "/Server/UpdateCharacterStatistics";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.CharacterStatistics != nullptr) OutRestJsonObj->SetObjectField(TEXT("CharacterStatistics"), request.CharacterStatistics);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObject("CharacterStatistics", request.CharacterStatistics);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6012,10 +5391,10 @@ void UPlayFabServerAPI::HelperUpdateCharacterStatistics(FPlayFabBaseModel respon
     }
     else
     {
-        FServerUpdateCharacterStatisticsResult result = UPlayFabServerModelDecoder::decodeUpdateCharacterStatisticsResultResponse(response.responseData);
-        if (OnSuccessUpdateCharacterStatistics.IsBound())
+        FServerUpdateCharacterStatisticsResult result = UPlayFabServerModelDecoder::readUpdateCharacterStatisticsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateCharacterStatistics.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateCharacterStatistics(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6031,12 +5410,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterData(FServerGetCharacterDataRe
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetCharacterData);
 
@@ -6044,30 +5422,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterData(FServerGetCharacterDataRe
     manager->PlayFabRequestURL = "/Server/GetCharacterData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6085,10 +5451,14 @@ void UPlayFabServerAPI::HelperGetCharacterData(FPlayFabBaseModel response, UObje
     }
     else
     {
-        FServerGetCharacterDataResult result = UPlayFabServerModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
-        if (OnSuccessGetCharacterData.IsBound())
+        FServerGetCharacterDataResult result = UPlayFabServerModelDecoder::readGetCharacterDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetCharacterDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetCharacterData.Execute(result, mCustomData);
+            FDelegateOnSuccessGetCharacterData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6100,12 +5470,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterInternalData(FServerGetCharact
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetCharacterInternalData);
 
@@ -6113,30 +5482,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterInternalData(FServerGetCharact
     manager->PlayFabRequestURL = "/Server/GetCharacterInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6154,10 +5511,14 @@ void UPlayFabServerAPI::HelperGetCharacterInternalData(FPlayFabBaseModel respons
     }
     else
     {
-        FServerGetCharacterDataResult result = UPlayFabServerModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
-        if (OnSuccessGetCharacterInternalData.IsBound())
+        FServerGetCharacterDataResult result = UPlayFabServerModelDecoder::readGetCharacterDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetCharacterInternalData.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillGetCharacterDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetCharacterInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6169,12 +5530,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterReadOnlyData(FServerGetCharact
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetCharacterReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetCharacterReadOnlyData);
 
@@ -6182,30 +5542,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetCharacterReadOnlyData(FServerGetCharact
     manager->PlayFabRequestURL = "/Server/GetCharacterReadOnlyData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    // Check to see if string is empty
-    if (request.Keys.IsEmpty() || request.Keys == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Keys"));
-    } else {
-        TArray<FString> KeysArray;
-        FString(request.Keys).ParseIntoArray(KeysArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("Keys"), KeysArray);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("IfChangedFromDataVersion"), request.IfChangedFromDataVersion);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteStringList("Keys", request.Keys);
+    Writer.WriteNumber("IfChangedFromDataVersion", request.IfChangedFromDataVersion);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6223,10 +5571,14 @@ void UPlayFabServerAPI::HelperGetCharacterReadOnlyData(FPlayFabBaseModel respons
     }
     else
     {
-        FServerGetCharacterDataResult result = UPlayFabServerModelDecoder::decodeGetCharacterDataResultResponse(response.responseData);
-        if (OnSuccessGetCharacterReadOnlyData.IsBound())
+        FServerGetCharacterDataResult result = UPlayFabServerModelDecoder::readGetCharacterDataResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetCharacterReadOnlyData.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillGetCharacterDataResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetCharacterReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6238,12 +5590,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterData(FServerUpdateCharacter
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateCharacterData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateCharacterData);
 
@@ -6251,33 +5602,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterData(FServerUpdateCharacter
     manager->PlayFabRequestURL = "/Server/UpdateCharacterData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6295,10 +5631,10 @@ void UPlayFabServerAPI::HelperUpdateCharacterData(FPlayFabBaseModel response, UO
     }
     else
     {
-        FServerUpdateCharacterDataResult result = UPlayFabServerModelDecoder::decodeUpdateCharacterDataResultResponse(response.responseData);
-        if (OnSuccessUpdateCharacterData.IsBound())
+        FServerUpdateCharacterDataResult result = UPlayFabServerModelDecoder::readUpdateCharacterDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateCharacterData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateCharacterData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6310,12 +5646,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterInternalData(FServerUpdateC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateCharacterInternalData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateCharacterInternalData);
 
@@ -6323,33 +5658,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterInternalData(FServerUpdateC
     manager->PlayFabRequestURL = "/Server/UpdateCharacterInternalData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6367,10 +5687,10 @@ void UPlayFabServerAPI::HelperUpdateCharacterInternalData(FPlayFabBaseModel resp
     }
     else
     {
-        FServerUpdateCharacterDataResult result = UPlayFabServerModelDecoder::decodeUpdateCharacterDataResultResponse(response.responseData);
-        if (OnSuccessUpdateCharacterInternalData.IsBound())
+        FServerUpdateCharacterDataResult result = UPlayFabServerModelDecoder::readUpdateCharacterDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateCharacterInternalData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateCharacterInternalData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6382,12 +5702,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterReadOnlyData(FServerUpdateC
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessUpdateCharacterReadOnlyData = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperUpdateCharacterReadOnlyData);
 
@@ -6395,33 +5714,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::UpdateCharacterReadOnlyData(FServerUpdateC
     manager->PlayFabRequestURL = "/Server/UpdateCharacterReadOnlyData";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.CharacterId.IsEmpty() || request.CharacterId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("CharacterId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("CharacterId"), request.CharacterId);
-    }
-    if (request.Data != nullptr) OutRestJsonObj->SetObjectField(TEXT("Data"), request.Data);
-    // Check to see if string is empty
-    if (request.KeysToRemove.IsEmpty() || request.KeysToRemove == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("KeysToRemove"));
-    } else {
-        TArray<FString> KeysToRemoveArray;
-        FString(request.KeysToRemove).ParseIntoArray(KeysToRemoveArray, TEXT(","), false);
-        OutRestJsonObj->SetStringArrayField(TEXT("KeysToRemove"), KeysToRemoveArray);
-    }
-    FString temp_Permission;
-    if (GetEnumValueToString<EUserDataPermission>(TEXT("EUserDataPermission"), request.Permission, temp_Permission))
-        OutRestJsonObj->SetStringField(TEXT("Permission"), temp_Permission);
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("CharacterId", request.CharacterId);
+    Writer.WriteObject("Data", request.Data);
+    Writer.WriteStringList("KeysToRemove", request.KeysToRemove);
+    Writer.WriteEnum("Permission", GetEnumName(request.Permission));
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6439,10 +5743,10 @@ void UPlayFabServerAPI::HelperUpdateCharacterReadOnlyData(FPlayFabBaseModel resp
     }
     else
     {
-        FServerUpdateCharacterDataResult result = UPlayFabServerModelDecoder::decodeUpdateCharacterDataResultResponse(response.responseData);
-        if (OnSuccessUpdateCharacterReadOnlyData.IsBound())
+        FServerUpdateCharacterDataResult result = UPlayFabServerModelDecoder::readUpdateCharacterDataResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessUpdateCharacterReadOnlyData.Execute(result, mCustomData);
+            FDelegateOnSuccessUpdateCharacterReadOnlyData(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6462,12 +5766,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddPlayerTag(FServerAddPlayerTagRequest re
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAddPlayerTag = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperAddPlayerTag);
 
@@ -6475,21 +5778,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::AddPlayerTag(FServerAddPlayerTagRequest re
     manager->PlayFabRequestURL = "/Server/AddPlayerTag";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.TagName.IsEmpty() || request.TagName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TagName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TagName"), request.TagName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("TagName", request.TagName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6507,10 +5803,10 @@ void UPlayFabServerAPI::HelperAddPlayerTag(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FServerAddPlayerTagResult result = UPlayFabServerModelDecoder::decodeAddPlayerTagResultResponse(response.responseData);
-        if (OnSuccessAddPlayerTag.IsBound())
+        FServerAddPlayerTagResult result = UPlayFabServerModelDecoder::readAddPlayerTagResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessAddPlayerTag.Execute(result, mCustomData);
+            FDelegateOnSuccessAddPlayerTag(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6522,12 +5818,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetAllActionGroups(FServerGetAllActionGrou
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetAllActionGroups = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetAllActionGroups);
 
@@ -6535,11 +5830,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetAllActionGroups(FServerGetAllActionGrou
     manager->PlayFabRequestURL = "/Server/GetAllActionGroups";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6557,10 +5855,14 @@ void UPlayFabServerAPI::HelperGetAllActionGroups(FPlayFabBaseModel response, UOb
     }
     else
     {
-        FServerGetAllActionGroupsResult result = UPlayFabServerModelDecoder::decodeGetAllActionGroupsResultResponse(response.responseData);
-        if (OnSuccessGetAllActionGroups.IsBound())
+        FServerGetAllActionGroupsResult result = UPlayFabServerModelDecoder::readGetAllActionGroupsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetAllActionGroupsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetAllActionGroups.Execute(result, mCustomData);
+            FDelegateOnSuccessGetAllActionGroups(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6572,12 +5874,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetAllSegments(FServerGetAllSegmentsReques
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetAllSegments = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetAllSegments);
 
@@ -6585,11 +5886,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetAllSegments(FServerGetAllSegmentsReques
     manager->PlayFabRequestURL = "/Server/GetAllSegments";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6607,10 +5911,14 @@ void UPlayFabServerAPI::HelperGetAllSegments(FPlayFabBaseModel response, UObject
     }
     else
     {
-        FServerGetAllSegmentsResult result = UPlayFabServerModelDecoder::decodeGetAllSegmentsResultResponse(response.responseData);
-        if (OnSuccessGetAllSegments.IsBound())
+        FServerGetAllSegmentsResult result = UPlayFabServerModelDecoder::readGetAllSegmentsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetAllSegments.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillGetAllSegmentsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetAllSegments(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6622,12 +5930,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerSegments(FServerGetPlayersSegment
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerSegments = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetPlayerSegments);
 
@@ -6635,16 +5942,15 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerSegments(FServerGetPlayersSegment
     manager->PlayFabRequestURL = "/Server/GetPlayerSegments";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6662,10 +5968,14 @@ void UPlayFabServerAPI::HelperGetPlayerSegments(FPlayFabBaseModel response, UObj
     }
     else
     {
-        FServerGetPlayerSegmentsResult result = UPlayFabServerModelDecoder::decodeGetPlayerSegmentsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerSegments.IsBound())
+        FServerGetPlayerSegmentsResult result = UPlayFabServerModelDecoder::readGetPlayerSegmentsResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessGetPlayerSegments.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillGetPlayerSegmentsResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessGetPlayerSegments(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6677,12 +5987,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayersInSegment(FServerGetPlayersInSeg
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayersInSegment = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetPlayersInSegment);
 
@@ -6690,23 +5999,18 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayersInSegment(FServerGetPlayersInSeg
     manager->PlayFabRequestURL = "/Server/GetPlayersInSegment";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
-
-    // Serialize all the request properties to json
-    if (request.SegmentId.IsEmpty() || request.SegmentId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("SegmentId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("SegmentId"), request.SegmentId);
-    }
-    OutRestJsonObj->SetNumberField(TEXT("SecondsToLive"), request.SecondsToLive);
-    OutRestJsonObj->SetNumberField(TEXT("MaxBatchSize"), request.MaxBatchSize);
-    if (request.ContinuationToken.IsEmpty() || request.ContinuationToken == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("ContinuationToken"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("ContinuationToken"), request.ContinuationToken);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
+
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("SegmentId", request.SegmentId);
+    Writer.WriteNumber("SecondsToLive", request.SecondsToLive);
+    Writer.WriteNumber("MaxBatchSize", request.MaxBatchSize);
+    Writer.WriteString("ContinuationToken", request.ContinuationToken);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6724,10 +6028,14 @@ void UPlayFabServerAPI::HelperGetPlayersInSegment(FPlayFabBaseModel response, UO
     }
     else
     {
-        FServerGetPlayersInSegmentResult result = UPlayFabServerModelDecoder::decodeGetPlayersInSegmentResultResponse(response.responseData);
-        if (OnSuccessGetPlayersInSegment.IsBound())
+        FServerGetPlayersInSegmentResult result = UPlayFabServerModelDecoder::readGetPlayersInSegmentResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
+        {
+            UPlayFabServerModelDecoder::fillGetPlayersInSegmentResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayersInSegment.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayersInSegment(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6739,12 +6047,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerTags(FServerGetPlayerTagsRequest
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessGetPlayerTags = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperGetPlayerTags);
 
@@ -6752,21 +6059,16 @@ UPlayFabServerAPI* UPlayFabServerAPI::GetPlayerTags(FServerGetPlayerTagsRequest
     manager->PlayFabRequestURL = "/Server/GetPlayerTags";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
+    manager->isIdempotent = true;
+    manager->isReadOnly = true;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.Namespace.IsEmpty() || request.Namespace == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("Namespace"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("Namespace"), request.Namespace);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("Namespace", request.Namespace);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6784,10 +6086,10 @@ void UPlayFabServerAPI::HelperGetPlayerTags(FPlayFabBaseModel response, UObject*
     }
     else
     {
-        FServerGetPlayerTagsResult result = UPlayFabServerModelDecoder::decodeGetPlayerTagsResultResponse(response.responseData);
-        if (OnSuccessGetPlayerTags.IsBound())
+        FServerGetPlayerTagsResult result = UPlayFabServerModelDecoder::readGetPlayerTagsResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessGetPlayerTags.Execute(result, mCustomData);
+            FDelegateOnSuccessGetPlayerTags(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6799,12 +6101,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemovePlayerTag(FServerRemovePlayerTagRequ
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessRemovePlayerTag = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperRemovePlayerTag);
 
@@ -6812,21 +6113,14 @@ UPlayFabServerAPI* UPlayFabServerAPI::RemovePlayerTag(FServerRemovePlayerTagRequ
     manager->PlayFabRequestURL = "/Server/RemovePlayerTag";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.PlayFabId.IsEmpty() || request.PlayFabId == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("PlayFabId"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("PlayFabId"), request.PlayFabId);
-    }
-    if (request.TagName.IsEmpty() || request.TagName == "") {
-        OutRestJsonObj->SetFieldNull(TEXT("TagName"));
-    } else {
-        OutRestJsonObj->SetStringField(TEXT("TagName"), request.TagName);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteString("PlayFabId", request.PlayFabId);
+    Writer.WriteString("TagName", request.TagName);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6844,10 +6138,10 @@ void UPlayFabServerAPI::HelperRemovePlayerTag(FPlayFabBaseModel response, UObjec
     }
     else
     {
-        FServerRemovePlayerTagResult result = UPlayFabServerModelDecoder::decodeRemovePlayerTagResultResponse(response.responseData);
-        if (OnSuccessRemovePlayerTag.IsBound())
+        FServerRemovePlayerTagResult result = UPlayFabServerModelDecoder::readRemovePlayerTagResultResponse(response);
+        if (OnSuccess.IsBound())
         {
-            OnSuccessRemovePlayerTag.Execute(result, mCustomData);
+            FDelegateOnSuccessRemovePlayerTag(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
@@ -6863,12 +6157,11 @@ UPlayFabServerAPI* UPlayFabServerAPI::AwardSteamAchievement(FServerAwardSteamAch
     UObject* customData)
 {
     // Objects containing request data
-    UPlayFabServerAPI* manager = NewObject<UPlayFabServerAPI>();
-    UPlayFabJsonObject* OutRestJsonObj = NewObject<UPlayFabJsonObject>();
+    UPlayFabServerAPI* manager = FPlayFabManagerPool::Get().Acquire<UPlayFabServerAPI>();
     manager->mCustomData = customData;
 
     // Assign delegates
-    manager->OnSuccessAwardSteamAchievement = onSuccess;
+    manager->OnSuccess = onSuccess;
     manager->OnFailure = onFailure;
     manager->OnPlayFabResponse.AddDynamic(manager, &UPlayFabServerAPI::HelperAwardSteamAchievement);
 
@@ -6876,16 +6169,13 @@ UPlayFabServerAPI* UPlayFabServerAPI::AwardSteamAchievement(FServerAwardSteamAch
     manager->PlayFabRequestURL = "/Server/AwardSteamAchievement";
     manager->useSessionTicket = false;
     manager->useSecretKey = true;
+    manager->requestPriority = EPlayFabRequestPriority::Normal;
 
-    // Serialize all the request properties to json
-    if (request.Achievements.Num() == 0) {
-        OutRestJsonObj->SetFieldNull(TEXT("Achievements"));
-    } else {
-        OutRestJsonObj->SetObjectArrayField(TEXT("Achievements"), request.Achievements);
-    }
-
-    // Add Request to manager
-    manager->SetRequestObject(OutRestJsonObj);
+    // Stream the request properties straight into the body
+    FPlayFabJsonWriter Writer(manager->RequestBody, FPlayFabRequestDispatcher::Get().ShouldOmitNullFields());
+    Writer.WriteObjectStart();
+    Writer.WriteObjectArray("Achievements", request.Achievements);
+    Writer.WriteObjectEnd();
 
     return manager;
 }
@@ -6903,17 +6193,21 @@ void UPlayFabServerAPI::HelperAwardSteamAchievement(FPlayFabBaseModel response,
     }
     else
     {
-        FServerAwardSteamAchievementResult result = UPlayFabServerModelDecoder::decodeAwardSteamAchievementResultResponse(response.responseData);
-        if (OnSuccessAwardSteamAchievement.IsBound())
+        FServerAwardSteamAchievementResult result = UPlayFabServerModelDecoder::readAwardSteamAchievementResultResponse(response);
+        if (FPlayFabJsonObjectFields::IsWanted(OnSuccess))
         {
-            OnSuccessAwardSteamAchievement.Execute(result, mCustomData);
+            UPlayFabServerModelDecoder::fillAwardSteamAchievementResultJsonObjects(result);
+        }
+        if (OnSuccess.IsBound())
+        {
+            FDelegateOnSuccessAwardSteamAchievement(OnSuccess).Execute(result, mCustomData);
         }
     }
 }
 
 
 
-void UPlayFabServerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful)
+void UPlayFabServerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed)
 {
     // Be sure that we have no data from previous response
     ResetResponseData();
@@ -6926,6 +6220,7 @@ void UPlayFabServerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
     if (!OnPlayFabResponse.IsBound())
     {
         UE_LOG(LogPlayFab, Error, TEXT("OnPlayFabResponse has come un-bound during OnProcessRequestComplete."));
+        ReleaseToPool();
         return;
     }
 
@@ -6942,23 +6237,29 @@ void UPlayFabServerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         myResponse.responseError.ErrorName = "Unable to contact server";
         myResponse.responseError.ErrorMessage = "Unable to contact server";
 
+        // Requests dropped from a full dispatcher queue were never started
+        if (Request->GetStatus() == EHttpRequestStatus::NotStarted)
+        {
+            myResponse.responseError.ErrorName = "Request dropped";
+            myResponse.responseError.ErrorMessage = "The request queue for this priority class was full";
+        }
+
         OnPlayFabResponse.Broadcast(myResponse, mCustomData, false);
+        ReleaseToPool();
 
         return;
     }
 
-    // Save response data as a string
-    ResponseContent = Response->GetContentAsString();
-
     // Save response code as int32
     ResponseCode = Response->GetResponseCode();
 
-    // Try to deserialize data to JSON
-    TSharedRef<TJsonReader<TCHAR>> JsonReader = TJsonReaderFactory<TCHAR>::Create(ResponseContent);
-    FJsonSerializer::Deserialize(JsonReader, ResponseJsonObj->GetRootObject());
-
-    // Decide whether the request was successful
-    bIsValidJsonResponse = bWasSuccessful && ResponseJsonObj->GetRootObject().IsValid();
+    // The body was inflated, parsed and checked for errors on a worker thread
+    bIsValidJsonResponse = Parsed.bValidJson;
+    if (Parsed.Json.IsValid())
+    {
+        // Edits made through responseData must not reach the response cache, or other callers sharing the json
+        ResponseJsonObj->GetRootObject() = Parsed.bShared ? FPlayFabJsonView(Parsed.Json).CopyJsonObject() : Parsed.Json;
+    }
 
     // Log errors
     if (!bIsValidJsonResponse)
@@ -6966,24 +6267,52 @@ void UPlayFabServerAPI::OnProcessRequestComplete(FHttpRequestPtr Request, FHttpR
         UE_LOG(LogPlayFab, Warning, TEXT("JSON could not be decoded!"));
     }
 
-    // Log response state
-    UE_LOG(LogPlayFab, Log, TEXT("Response : %s"), *ResponseContent);
-
-    myResponse.responseError.decodeError(ResponseJsonObj);
+    myResponse.responseError = Parsed.Error;
     myResponse.responseData = ResponseJsonObj;
-    IPlayFab* pfSettings = &(IPlayFab::Get());
+    myResponse.responseBody = Parsed.Body;
 
-    // Broadcast the result event
+    // Broadcast the result event, after which the response data is no longer ours to keep
     OnPlayFabResponse.Broadcast(myResponse, mCustomData, myResponse.responseError.hasError);
-    pfSettings->ModifyPendingCallCount(-1);
+    ReleaseToPool();
 }
 
 void UPlayFabServerAPI::Activate()
+{
+    // From here the dispatcher holds the call, however long it takes
+    FPlayFabManagerPool::Get().MarkActivated(this);
+
+    FPlayFabDispatchInfo DispatchInfo;
+    DispatchInfo.Endpoint = PlayFabRequestURL;
+    DispatchInfo.Priority = requestPriority;
+    DispatchInfo.bIdempotent = isIdempotent;
+    DispatchInfo.bReadOnly = isReadOnly;
+    if (RequestBody.Num() == 0 && RequestJsonObj != nullptr)
+    {
+        // Built as a json tree by the caller rather than streamed by a factory
+        DispatchInfo.Body = RequestJsonObj->GetRootObject();
+    }
+    DispatchInfo.OnResponse = FPlayFabResponseDelegate::CreateUObject(this, &UPlayFabServerAPI::OnProcessRequestComplete);
+
+    // The generated decoders read the body itself, so the tree is only built for the login handling or other listeners
+    DispatchInfo.bNeedsJsonTree = isLoginRequest;
+    for (const UObject* Listener : OnPlayFabResponse.GetAllObjects())
+    {
+        DispatchInfo.bNeedsJsonTree |= Listener != this;
+    }
+
+    // Hand the request to the dispatcher, which sends it as soon as a connection is free
+    FPlayFabRequestDispatcher::Get().Submit(this, BuildHttpRequest(), DispatchInfo);
+}
+
+TSharedRef<IHttpRequest> UPlayFabServerAPI::BuildHttpRequest()
 {
     IPlayFab* pfSettings = &(IPlayFab::Get());
 
+    // Read the title and credentials from one snapshot, so a login completing meanwhile can't mix two sessions
+    const FPlayFabSettings& Settings = pfSettings->GetSettings();
+
     FString RequestUrl;
-    RequestUrl = TEXT("https://") + pfSettings->getGameTitleId() + IPlayFab::PlayFabURL + PlayFabRequestURL;
+    RequestUrl = Settings.GetUrl(PlayFabRequestURL);
 
     TSharedRef<IHttpRequest> HttpRequest = FHttpModule::Get().CreateRequest();
     HttpRequest->SetURL(RequestUrl);
@@ -6991,31 +6320,19 @@ void UPlayFabServerAPI::Activate()
 
     // Headers
     if (useSessionTicket)
-        HttpRequest->SetHeader("X-Authentication", pfSettings->getSessionTicket());
+        HttpRequest->SetHeader("X-Authentication", Settings.SessionTicket);
     if (useSecretKey)
-        HttpRequest->SetHeader("X-SecretKey", pfSettings->getSecretApiKey());
+        HttpRequest->SetHeader("X-SecretKey", Settings.SecretApiKey);
     HttpRequest->SetHeader("Content-Type", "application/json");
+    HttpRequest->SetHeader("Accept-Encoding", "gzip, deflate");
     HttpRequest->SetHeader(TEXT("X-PlayFabSDK"), pfSettings->VersionString);
     HttpRequest->SetHeader("X-ReportErrorAsSuccess", "true"); // FHttpResponsePtr doesn't provide sufficient information when an error code is returned
     for (TMap<FString, FString>::TConstIterator It(RequestHeaders); It; ++It)
         HttpRequest->SetHeader(It.Key(), It.Value());
+    if (RequestBody.Num() > 0)
+        HttpRequest->SetContent(RequestBody);
 
-    // Serialize data to json string
-    FString OutputString;
-    TSharedRef< TJsonWriter<> > Writer = TJsonWriterFactory<>::Create(&OutputString);
-    FJsonSerializer::Serialize(RequestJsonObj->GetRootObject().ToSharedRef(), Writer);
-
-    // Set Json content
-    HttpRequest->SetContentAsString(OutputString);
-
-    UE_LOG(LogPlayFab, Log, TEXT("Request: %s"), *OutputString);
-
-    // Bind event
-    HttpRequest->OnProcessRequestComplete().BindUObject(this, &UPlayFabServerAPI::OnProcessRequestComplete);
-
-    // Execute the request
-    pfSettings->ModifyPendingCallCount(1);
-    HttpRequest->ProcessRequest();
+    return HttpRequest;
 }
 
 void UPlayFabServerAPI::ResetResponseData()
@@ -7031,3 +6348,37 @@ void UPlayFabServerAPI::ResetResponseData()
 
     bIsValidJsonResponse = false;
 }
+
+void UPlayFabServerAPI::ReleaseToPool()
+{
+    FPlayFabManagerPool& Pool = FPlayFabManagerPool::Get();
+    if (!Pool.IsEnabled() || FPlayFabManagerPool::IsHeldOutside(this, OnPlayFabResponse, OnSuccess, OnFailure))
+    {
+        // Not reused, so the response is left for whoever still holds this call
+        Pool.Discard(this);
+        return;
+    }
+
+    OnPlayFabResponse.Clear();
+    OnFailure.Unbind();
+    OnSuccess.Unbind();
+    mCustomData = nullptr;
+
+    PlayFabRequestURL.Empty();
+    useSecretKey = false;
+    useSessionTicket = false;
+    isLoginRequest = false;
+    requestPriority = EPlayFabRequestPriority::Normal;
+    isIdempotent = false;
+    isReadOnly = false;
+    RequestHeaders.Empty();
+    RequestBody.Reset();
+
+    if (RequestJsonObj != nullptr)
+    {
+        RequestJsonObj->Reset();
+    }
+    ResetResponseData();
+
+    Pool.Release(this);
+}
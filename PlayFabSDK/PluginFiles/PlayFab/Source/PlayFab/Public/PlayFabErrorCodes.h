@@ -0,0 +1,45 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Error Codes. A static table of every PlayFab error code, its name and the kind of
+// failure it is, so the dispatcher and game code can react to an error by category rather
+// than by comparing names. Lookups index the table directly and never allocate.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabRequestTypes.h"
+
+class PLAYFAB_API FPlayFabErrorCodes
+{
+public:
+    /** The error's name, e.g. "APIRequestLimitExceeded", "Success" for 0, and an empty string for a code the table doesn't know */
+    static const TCHAR* GetName(int32 ErrorCode);
+
+    /** What kind of failure the code is. None for 0, and Permanent for a code the table doesn't know */
+    static EPlayFabErrorCategory GetCategory(int32 ErrorCode);
+
+    static bool IsRetryable(int32 ErrorCode) { return GetCategory(ErrorCode) == EPlayFabErrorCategory::Retryable; }
+    static bool IsThrottled(int32 ErrorCode) { return GetCategory(ErrorCode) == EPlayFabErrorCategory::Throttled; }
+    static bool IsAuthExpired(int32 ErrorCode) { return GetCategory(ErrorCode) == EPlayFabErrorCategory::AuthExpired; }
+    static bool IsPermanent(int32 ErrorCode) { return GetCategory(ErrorCode) == EPlayFabErrorCategory::Permanent; }
+    static bool IsClientBug(int32 ErrorCode) { return GetCategory(ErrorCode) == EPlayFabErrorCategory::ClientBug; }
+
+    /** True if the code is 0 or has a row in the table */
+    static bool IsKnown(int32 ErrorCode);
+
+    /** The category's name, e.g. "Throttled" */
+    static const TCHAR* GetCategoryName(EPlayFabErrorCategory Category);
+
+private:
+    struct FEntry
+    {
+        const TCHAR* Name;
+        EPlayFabErrorCategory Category;
+    };
+
+    /** Every code from FirstCode to LastCode has a row, unassigned codes have an empty name */
+    static const int32 FirstCode = 1000;
+    static const int32 LastCode = 1325;
+    static const FEntry Entries[];
+
+    static const FEntry* Find(int32 ErrorCode);
+};
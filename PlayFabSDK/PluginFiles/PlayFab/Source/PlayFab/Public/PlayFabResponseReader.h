@@ -0,0 +1,62 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Response Reader. Turns raw response bytes, gzipped or not, into JSON by parsing
+// the UTF-8 in place, without widening the body first. A response that wasn't compressed
+// is read straight out of the http content, which the parsed result keeps alive rather than
+// copies. A compressed one is inflated into a buffer of its own that the result then owns.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Dom/JsonObject.h"
+#include "PlayFabBaseModel.h"
+
+/** A response body parsed and checked for errors off the game thread */
+struct FPlayFabParsedResponse
+{
+    /** The parsed body. Left out of a successful response nothing reads the tree of, see FPlayFabDispatchInfo::bNeedsJsonTree */
+    TSharedPtr<FJsonObject> Json;
+
+    /** The body is a well formed json object, whether or not its tree was built */
+    bool bValidJson = false;
+
+    /** The uncompressed UTF-8 body, kept for the generated decoders to read in one pass. Shares the http content when it wasn't compressed */
+    TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Body;
+
+    FPlayFabError Error;
+
+    /** The json is also held by the response cache or other callers, so it must be copied before it is handed out for editing */
+    bool bShared = false;
+
+    /** Microseconds spent inflating and parsing the body, for the metrics */
+    int64 DecodeMicros = 0;
+    int64 ParseMicros = 0;
+
+    FPlayFabParsedResponse()
+    {
+        Error.hasError = false;
+        Error.ErrorCode = 0;
+    }
+};
+
+class PLAYFAB_API FPlayFabResponseReader
+{
+public:
+    /**
+     * Returns the uncompressed UTF-8 body. Points into Content when it wasn't compressed, otherwise into this
+     * thread's inflate buffer, valid until the next call on this thread. Returns nullptr if inflating failed
+     */
+    static const uint8* GetBody(const TArray<uint8>& Content, int32& OutSize);
+
+    /** Decode the body into OutObject. Returns false if it isn't a valid JSON object */
+    static bool Deserialize(const TArray<uint8>& Content, TSharedPtr<FJsonObject>& OutObject);
+
+    /** Parse an uncompressed UTF-8 body into OutObject. Returns false if it isn't a valid JSON object */
+    static bool Deserialize(const uint8* Body, int32 BodySize, TSharedPtr<FJsonObject>& OutObject);
+
+    /**
+     * Deserialize the body and decode its error block. Safe to call from any thread. Unless bBuildJson is set, a body
+     * reporting success is only checked to be well formed, and left to the one pass decoders without building its tree.
+     * Content is held by the result rather than copied when it wasn't compressed, so it must not change afterwards
+     */
+    static void Decode(const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe>& Content, FPlayFabParsedResponse& OutParsed, bool bBuildJson = true);
+};
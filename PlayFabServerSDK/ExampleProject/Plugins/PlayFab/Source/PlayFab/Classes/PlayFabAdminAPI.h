@@ -9,6 +9,7 @@
 
 #include "OnlineBlueprintCallProxyBase.h"
 #include "PlayFabBaseModel.h"
+#include "PlayFabRequestTypes.h"
 #include "PlayFabAdminModels.h"
 #include "PlayFabAdminAPI.generated.h"
 
@@ -25,9 +26,12 @@ public:
     UPROPERTY(BlueprintAssignable)
         FOnPlayFabAdminRequestCompleted OnPlayFabResponse;
 
-    /** Set the Request Json object */
+    /** Set the Request Json object, sent in place of the body the factory wrote */
     void SetRequestObject(UPlayFabJsonObject* JsonObject);
 
+    /** Get the Request Json object, created on first use and kept while the manager is pooled */
+    UPlayFabJsonObject* GetRequestObject();
+
     /** Get the Response Json object */
     UPlayFabJsonObject* GetResponseObject();
 
@@ -40,6 +44,10 @@ public:
     /** UOnlineBlueprintCallProxyBase interface */
     virtual void Activate() override;
 
+    /** Clear this call's request, response and delegates and hand it back to the manager pool. Done once the response has been delivered, or call it instead of Activate() to drop a call */
+    UFUNCTION()
+        void ReleaseToPool();
+
     //////////////////////////////////////////////////////////////////////////
     // Generated PlayFab Admin API Functions
     //////////////////////////////////////////////////////////////////////////
@@ -1376,117 +1384,26 @@ public:
     bool useSecretKey = false;
     bool useSessionTicket = false;
     bool isLoginRequest = false;
+    EPlayFabRequestPriority requestPriority = EPlayFabRequestPriority::Normal;
+    bool isIdempotent = false;
+    bool isReadOnly = false;
 
     /** Is the response valid JSON? */
     bool bIsValidJsonResponse;
-    FString ResponseContent;
     int32 ResponseCode;
     UObject* mCustomData;
 
     FDelegateOnFailurePlayFabError OnFailure;
-    FDelegateOnSuccessCreatePlayerSharedSecret OnSuccessCreatePlayerSharedSecret;
-    FDelegateOnSuccessDeletePlayerSharedSecret OnSuccessDeletePlayerSharedSecret;
-    FDelegateOnSuccessGetPlayerSharedSecrets OnSuccessGetPlayerSharedSecrets;
-    FDelegateOnSuccessGetPolicy OnSuccessGetPolicy;
-    FDelegateOnSuccessSetPlayerSecret OnSuccessSetPlayerSecret;
-    FDelegateOnSuccessUpdatePlayerSharedSecret OnSuccessUpdatePlayerSharedSecret;
-    FDelegateOnSuccessUpdatePolicy OnSuccessUpdatePolicy;
-    FDelegateOnSuccessBanUsers OnSuccessBanUsers;
-    FDelegateOnSuccessDeletePlayer OnSuccessDeletePlayer;
-    FDelegateOnSuccessGetUserAccountInfo OnSuccessGetUserAccountInfo;
-    FDelegateOnSuccessGetUserBans OnSuccessGetUserBans;
-    FDelegateOnSuccessResetUsers OnSuccessResetUsers;
-    FDelegateOnSuccessRevokeAllBansForUser OnSuccessRevokeAllBansForUser;
-    FDelegateOnSuccessRevokeBans OnSuccessRevokeBans;
-    FDelegateOnSuccessSendAccountRecoveryEmail OnSuccessSendAccountRecoveryEmail;
-    FDelegateOnSuccessUpdateBans OnSuccessUpdateBans;
-    FDelegateOnSuccessUpdateUserTitleDisplayName OnSuccessUpdateUserTitleDisplayName;
-    FDelegateOnSuccessCreatePlayerStatisticDefinition OnSuccessCreatePlayerStatisticDefinition;
-    FDelegateOnSuccessDeleteUsers OnSuccessDeleteUsers;
-    FDelegateOnSuccessGetDataReport OnSuccessGetDataReport;
-    FDelegateOnSuccessGetPlayerStatisticDefinitions OnSuccessGetPlayerStatisticDefinitions;
-    FDelegateOnSuccessGetPlayerStatisticVersions OnSuccessGetPlayerStatisticVersions;
-    FDelegateOnSuccessGetUserData OnSuccessGetUserData;
-    FDelegateOnSuccessGetUserInternalData OnSuccessGetUserInternalData;
-    FDelegateOnSuccessGetUserPublisherData OnSuccessGetUserPublisherData;
-    FDelegateOnSuccessGetUserPublisherInternalData OnSuccessGetUserPublisherInternalData;
-    FDelegateOnSuccessGetUserPublisherReadOnlyData OnSuccessGetUserPublisherReadOnlyData;
-    FDelegateOnSuccessGetUserReadOnlyData OnSuccessGetUserReadOnlyData;
-    FDelegateOnSuccessIncrementPlayerStatisticVersion OnSuccessIncrementPlayerStatisticVersion;
-    FDelegateOnSuccessRefundPurchase OnSuccessRefundPurchase;
-    FDelegateOnSuccessResetUserStatistics OnSuccessResetUserStatistics;
-    FDelegateOnSuccessResolvePurchaseDispute OnSuccessResolvePurchaseDispute;
-    FDelegateOnSuccessUpdatePlayerStatisticDefinition OnSuccessUpdatePlayerStatisticDefinition;
-    FDelegateOnSuccessUpdateUserData OnSuccessUpdateUserData;
-    FDelegateOnSuccessUpdateUserInternalData OnSuccessUpdateUserInternalData;
-    FDelegateOnSuccessUpdateUserPublisherData OnSuccessUpdateUserPublisherData;
-    FDelegateOnSuccessUpdateUserPublisherInternalData OnSuccessUpdateUserPublisherInternalData;
-    FDelegateOnSuccessUpdateUserPublisherReadOnlyData OnSuccessUpdateUserPublisherReadOnlyData;
-    FDelegateOnSuccessUpdateUserReadOnlyData OnSuccessUpdateUserReadOnlyData;
-    FDelegateOnSuccessAddNews OnSuccessAddNews;
-    FDelegateOnSuccessAddVirtualCurrencyTypes OnSuccessAddVirtualCurrencyTypes;
-    FDelegateOnSuccessDeleteStore OnSuccessDeleteStore;
-    FDelegateOnSuccessGetCatalogItems OnSuccessGetCatalogItems;
-    FDelegateOnSuccessGetPublisherData OnSuccessGetPublisherData;
-    FDelegateOnSuccessGetRandomResultTables OnSuccessGetRandomResultTables;
-    FDelegateOnSuccessGetStoreItems OnSuccessGetStoreItems;
-    FDelegateOnSuccessGetTitleData OnSuccessGetTitleData;
-    FDelegateOnSuccessGetTitleInternalData OnSuccessGetTitleInternalData;
-    FDelegateOnSuccessListVirtualCurrencyTypes OnSuccessListVirtualCurrencyTypes;
-    FDelegateOnSuccessRemoveVirtualCurrencyTypes OnSuccessRemoveVirtualCurrencyTypes;
-    FDelegateOnSuccessSetCatalogItems OnSuccessSetCatalogItems;
-    FDelegateOnSuccessSetStoreItems OnSuccessSetStoreItems;
-    FDelegateOnSuccessSetTitleData OnSuccessSetTitleData;
-    FDelegateOnSuccessSetTitleInternalData OnSuccessSetTitleInternalData;
-    FDelegateOnSuccessSetupPushNotification OnSuccessSetupPushNotification;
-    FDelegateOnSuccessUpdateCatalogItems OnSuccessUpdateCatalogItems;
-    FDelegateOnSuccessUpdateRandomResultTables OnSuccessUpdateRandomResultTables;
-    FDelegateOnSuccessUpdateStoreItems OnSuccessUpdateStoreItems;
-    FDelegateOnSuccessAddUserVirtualCurrency OnSuccessAddUserVirtualCurrency;
-    FDelegateOnSuccessGetUserInventory OnSuccessGetUserInventory;
-    FDelegateOnSuccessGrantItemsToUsers OnSuccessGrantItemsToUsers;
-    FDelegateOnSuccessRevokeInventoryItem OnSuccessRevokeInventoryItem;
-    FDelegateOnSuccessSubtractUserVirtualCurrency OnSuccessSubtractUserVirtualCurrency;
-    FDelegateOnSuccessGetMatchmakerGameInfo OnSuccessGetMatchmakerGameInfo;
-    FDelegateOnSuccessGetMatchmakerGameModes OnSuccessGetMatchmakerGameModes;
-    FDelegateOnSuccessModifyMatchmakerGameModes OnSuccessModifyMatchmakerGameModes;
-    FDelegateOnSuccessAddServerBuild OnSuccessAddServerBuild;
-    FDelegateOnSuccessGetServerBuildInfo OnSuccessGetServerBuildInfo;
-    FDelegateOnSuccessGetServerBuildUploadUrl OnSuccessGetServerBuildUploadUrl;
-    FDelegateOnSuccessListServerBuilds OnSuccessListServerBuilds;
-    FDelegateOnSuccessModifyServerBuild OnSuccessModifyServerBuild;
-    FDelegateOnSuccessRemoveServerBuild OnSuccessRemoveServerBuild;
-    FDelegateOnSuccessSetPublisherData OnSuccessSetPublisherData;
-    FDelegateOnSuccessGetCloudScriptRevision OnSuccessGetCloudScriptRevision;
-    FDelegateOnSuccessGetCloudScriptVersions OnSuccessGetCloudScriptVersions;
-    FDelegateOnSuccessSetPublishedRevision OnSuccessSetPublishedRevision;
-    FDelegateOnSuccessUpdateCloudScript OnSuccessUpdateCloudScript;
-    FDelegateOnSuccessDeleteContent OnSuccessDeleteContent;
-    FDelegateOnSuccessGetContentList OnSuccessGetContentList;
-    FDelegateOnSuccessGetContentUploadUrl OnSuccessGetContentUploadUrl;
-    FDelegateOnSuccessResetCharacterStatistics OnSuccessResetCharacterStatistics;
-    FDelegateOnSuccessAddPlayerTag OnSuccessAddPlayerTag;
-    FDelegateOnSuccessGetAllActionGroups OnSuccessGetAllActionGroups;
-    FDelegateOnSuccessGetAllSegments OnSuccessGetAllSegments;
-    FDelegateOnSuccessGetPlayerSegments OnSuccessGetPlayerSegments;
-    FDelegateOnSuccessGetPlayersInSegment OnSuccessGetPlayersInSegment;
-    FDelegateOnSuccessGetPlayerTags OnSuccessGetPlayerTags;
-    FDelegateOnSuccessRemovePlayerTag OnSuccessRemovePlayerTag;
-    FDelegateOnSuccessAbortTaskInstance OnSuccessAbortTaskInstance;
-    FDelegateOnSuccessCreateActionsOnPlayersInSegmentTask OnSuccessCreateActionsOnPlayersInSegmentTask;
-    FDelegateOnSuccessCreateCloudScriptTask OnSuccessCreateCloudScriptTask;
-    FDelegateOnSuccessDeleteTask OnSuccessDeleteTask;
-    FDelegateOnSuccessGetActionsOnPlayersInSegmentTaskInstance OnSuccessGetActionsOnPlayersInSegmentTaskInstance;
-    FDelegateOnSuccessGetCloudScriptTaskInstance OnSuccessGetCloudScriptTaskInstance;
-    FDelegateOnSuccessGetTaskInstances OnSuccessGetTaskInstances;
-    FDelegateOnSuccessGetTasks OnSuccessGetTasks;
-    FDelegateOnSuccessRunTask OnSuccessRunTask;
-    FDelegateOnSuccessUpdateTask OnSuccessUpdateTask;
+
+    /** The success callback of the one call this manager makes. Its helper executes it as the call's FDelegateOnSuccess type */
+    FScriptDelegate OnSuccess;
 
 private:
-    /** Internal bind function for the IHTTPRequest::OnProcessRequestCompleted() event */
-    void OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
+    /** Internal bind function, called by the request dispatcher once the response has been parsed on a worker thread */
+    void OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed);
 
+    /** Builds the http request for this call. The dispatcher serializes the body */
+    TSharedRef<IHttpRequest> BuildHttpRequest();
 protected:
     /** Internal request data stored as JSON */
     UPROPERTY()
@@ -1498,4 +1415,7 @@ protected:
 
     /** Mapping of header section to values. Used to generate final header string for request */
     TMap<FString, FString> RequestHeaders;
+
+    /** The condensed UTF-8 body the factory streamed the request into. Kept, with its capacity, while the manager is pooled */
+    TArray<uint8> RequestBody;
 };
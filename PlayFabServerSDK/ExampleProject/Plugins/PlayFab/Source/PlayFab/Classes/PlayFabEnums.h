@@ -5,40 +5,105 @@
 #pragma once
 
 // PlayFab enums start with "pfenum_" in order to avoid code-name conflicts - For JSON, remove that prefix, and send only the expected portion (the display name is not fetchable when compiled)
-static const FString prefix = TEXT("pfenum_");
+// Every enum below is followed by a table of its json names and a perfect hash of them, so converting a value neither searches the object system nor allocates
 
+/** The json names of one of the enums below, in value order, and the displacements and slots that map a name back to its value */
 template <typename EnumType>
-static FORCEINLINE bool GetEnumValueFromString(const FString& enumTypeName, const FString& input, EnumType& output)
+struct TPlayFabEnumNames;
+
+namespace PlayFabEnumNames
 {
-    UEnum* enumPtr = FindObject<UEnum>(ANY_PACKAGE, *enumTypeName, true);
-    if (!enumPtr)
+    static FORCEINLINE uint32 ToLower(uint32 Char)
     {
-        output = EnumType(0);
-        return false;
+        return (Char >= 'A' && Char <= 'Z') ? Char + ('a' - 'A') : Char;
     }
 
-    FString fullInput;
-    if (!input.StartsWith(*prefix))
-        fullInput = prefix + input;
-    else
-        fullInput = input;
-    output = (EnumType)enumPtr->FindEnumIndex(FName(*fullInput));
-    return true;
+    /** FNV-1a of a name folded to lower case, as the FName lookup this replaced was case-insensitive */
+    template <typename CharType>
+    static FORCEINLINE uint32 Hash(const CharType* Name, int32 Length)
+    {
+        uint32 Result = 2166136261u;
+        for (int32 Index = 0; Index < Length; ++Index)
+        {
+            Result = (Result ^ ToLower((uint32)Name[Index])) * 16777619u;
+        }
+        return Result;
+    }
+
+    /** The slot of a hash, given the displacement of its bucket */
+    static FORCEINLINE uint32 Slot(uint32 NameHash, uint32 Displacement, uint32 SlotBits)
+    {
+        return ((NameHash ^ (Displacement * 0x9E3779B9u)) * 0x85EBCA6Bu) >> (32 - SlotBits);
+    }
+
+    template <typename CharType>
+    static FORCEINLINE bool Equals(const ANSICHAR* Expected, const CharType* Name, int32 Length)
+    {
+        for (int32 Index = 0; Index < Length; ++Index)
+        {
+            if (ToLower((uint32)Name[Index]) != ToLower((uint8)Expected[Index]))
+            {
+                return false;
+            }
+        }
+        return Expected[Length] == 0;
+    }
+
+    /** The value of a json name, with or without the "pfenum_" prefix, or INDEX_NONE */
+    template <typename EnumType, typename CharType>
+    static FORCEINLINE int32 Find(const CharType* Name, int32 Length)
+    {
+        typedef TPlayFabEnumNames<EnumType> FNames;
+        if (Length > 7 && Equals("pfenum_", Name, 7))
+        {
+            Name += 7;
+            Length -= 7;
+        }
+
+        const uint32 NameHash = Hash(Name, Length);
+        const uint32 Displacement = FNames::Displacements()[NameHash & (FNames::BucketCount - 1)];
+        const int32 Entry = FNames::Slots()[Slot(NameHash, Displacement, FNames::SlotBits)];
+        return (Entry != 0 && Equals(FNames::Names()[Entry - 1], Name, Length)) ? Entry - 1 : INDEX_NONE;
+    }
+}
+
+/** Read a json name, e.g. straight out of a response body. An unknown name gives the first value and returns false */
+template <typename EnumType>
+static FORCEINLINE bool GetEnumValueFromName(const ANSICHAR* input, int32 length, EnumType& output)
+{
+    const int32 index = PlayFabEnumNames::Find<EnumType>(input, length);
+    output = EnumType(index != INDEX_NONE ? index : 0);
+    return index != INDEX_NONE;
+}
+
+/** enumTypeName is left over from the reflection lookup, and kept for the generated callers */
+template <typename EnumType>
+static FORCEINLINE bool GetEnumValueFromString(const FString& enumTypeName, const FString& input, EnumType& output)
+{
+    const int32 index = PlayFabEnumNames::Find<EnumType>(*input, input.Len());
+    output = EnumType(index != INDEX_NONE ? index : 0);
+    return index != INDEX_NONE;
+}
+
+/** The json name of a value, or nullptr if it isn't one */
+template <typename EnumType>
+static FORCEINLINE const ANSICHAR* GetEnumName(EnumType input)
+{
+    typedef TPlayFabEnumNames<EnumType> FNames;
+    return (int32)input < FNames::Count ? FNames::Names()[(int32)input] : nullptr;
 }
 
 template<typename EnumType>
 static FORCEINLINE bool GetEnumValueToString(const FString& enumTypeName, const EnumType& input, FString& output)
 {
-    const UEnum* enumPtr = FindObject<UEnum>(ANY_PACKAGE, *enumTypeName, true);
-    if (!enumPtr)
+    const ANSICHAR* name = GetEnumName(input);
+    if (!name)
     {
         output = FString("0");
         return false;
     }
 
-    output = enumPtr->GetEnumName((int32)input);
-    if (output.StartsWith(*prefix))
-        output.RemoveAt(0, 7, false);
+    output = name;
     return true;
 }
 
@@ -51,6 +116,33 @@ enum class EConditionals : uint8
     pfenum_False UMETA(DisplayName = "False"),
 };
 
+template <>
+struct TPlayFabEnumNames<EConditionals>
+{
+    static const int32 Count = 3;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 2;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Any", "True", "False"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 1 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            3, 2, 0, 1
+        };
+        return Table;
+    }
+};
+
 // Enum for ContinentCode
 UENUM(BlueprintType)
 enum class EContinentCode : uint8
@@ -64,6 +156,33 @@ enum class EContinentCode : uint8
     pfenum_SA UMETA(DisplayName = "SA"),
 };
 
+template <>
+struct TPlayFabEnumNames<EContinentCode>
+{
+    static const int32 Count = 7;
+    static const uint32 BucketCount = 2;
+    static const uint32 SlotBits = 3;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "AF", "AN", "AS", "EU", "NA", "OC", "SA"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 21, 3 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            2, 4, 0, 5, 3, 7, 1, 6
+        };
+        return Table;
+    }
+};
+
 // Enum for CountryCode
 UENUM(BlueprintType)
 enum class ECountryCode : uint8
@@ -319,6 +438,68 @@ enum class ECountryCode : uint8
     pfenum_ZW UMETA(DisplayName = "ZW"),
 };
 
+template <>
+struct TPlayFabEnumNames<ECountryCode>
+{
+    static const int32 Count = 249;
+    static const uint32 BucketCount = 64;
+    static const uint32 SlotBits = 9;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "AF", "AX", "AL", "DZ", "AS", "AD", "AO", "AI", "AQ", "AG", "AR", "AM", "AW", "AU", "AT", "AZ",
+            "BS", "BH", "BD", "BB", "BY", "BE", "BZ", "BJ", "BM", "BT", "BO", "BQ", "BA", "BW", "BV", "BR",
+            "IO", "BN", "BG", "BF", "BI", "KH", "CM", "CA", "CV", "KY", "CF", "TD", "CL", "CN", "CX", "CC",
+            "CO", "KM", "CG", "CD", "CK", "CR", "CI", "HR", "CU", "CW", "CY", "CZ", "DK", "DJ", "DM", "DO",
+            "EC", "EG", "SV", "GQ", "ER", "EE", "ET", "FK", "FO", "FJ", "FI", "FR", "GF", "PF", "TF", "GA",
+            "GM", "GE", "DE", "GH", "GI", "GR", "GL", "GD", "GP", "GU", "GT", "GG", "GN", "GW", "GY", "HT",
+            "HM", "VA", "HN", "HK", "HU", "IS", "IN", "ID", "IR", "IQ", "IE", "IM", "IL", "IT", "JM", "JP",
+            "JE", "JO", "KZ", "KE", "KI", "KP", "KR", "KW", "KG", "LA", "LV", "LB", "LS", "LR", "LY", "LI",
+            "LT", "LU", "MO", "MK", "MG", "MW", "MY", "MV", "ML", "MT", "MH", "MQ", "MR", "MU", "YT", "MX",
+            "FM", "MD", "MC", "MN", "ME", "MS", "MA", "MZ", "MM", "NA", "NR", "NP", "NL", "NC", "NZ", "NI",
+            "NE", "NG", "NU", "NF", "MP", "NO", "OM", "PK", "PW", "PS", "PA", "PG", "PY", "PE", "PH", "PN",
+            "PL", "PT", "PR", "QA", "RE", "RO", "RU", "RW", "BL", "SH", "KN", "LC", "MF", "PM", "VC", "WS",
+            "SM", "ST", "SA", "SN", "RS", "SC", "SL", "SG", "SX", "SK", "SI", "SB", "SO", "ZA", "GS", "SS",
+            "ES", "LK", "SD", "SR", "SJ", "SZ", "SE", "CH", "SY", "TW", "TJ", "TZ", "TH", "TL", "TG", "TK",
+            "TO", "TT", "TN", "TR", "TM", "TC", "TV", "UG", "UA", "AE", "GB", "US", "UM", "UY", "UZ", "VU",
+            "VE", "VN", "VG", "VI", "WF", "EH", "YE", "ZM", "ZW"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0, 8, 0, 8, 0, 0, 1, 1, 2, 2, 0, 0, 0, 0, 1, 3, 14, 0, 1, 0, 2, 5, 0, 1, 0, 1, 0, 0, 0, 8, 0, 7, 0,
+            0, 0, 3, 4, 0, 3, 3, 1, 0, 23, 0, 4, 2, 2, 5, 5, 0, 0, 10, 2, 5, 0, 1, 2, 0, 3, 3, 0, 2, 17, 20 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            0, 238, 0, 0, 63, 0, 0, 93, 127, 179, 0, 0, 0, 194, 0, 153, 0, 0, 0, 30, 169, 0, 227, 0, 0, 0, 0,
+            221, 73, 0, 102, 0, 0, 109, 0, 0, 0, 0, 0, 83, 142, 104, 190, 241, 7, 0, 0, 0, 0, 44, 13, 72, 27,
+            122, 0, 140, 0, 189, 0, 0, 0, 24, 214, 0, 126, 0, 178, 225, 0, 0, 159, 209, 0, 0, 23, 143, 0, 2,
+            79, 240, 0, 186, 78, 54, 38, 26, 97, 0, 0, 100, 0, 0, 0, 0, 0, 0, 170, 0, 0, 0, 135, 0, 154, 0,
+            218, 81, 0, 0, 0, 148, 235, 244, 0, 217, 0, 155, 0, 0, 108, 205, 0, 174, 0, 0, 239, 0, 0, 176, 80,
+            0, 0, 0, 0, 0, 11, 0, 70, 173, 0, 66, 0, 31, 0, 95, 6, 0, 184, 161, 0, 0, 0, 18, 206, 0, 136, 0, 0,
+            131, 0, 0, 0, 65, 0, 0, 249, 0, 0, 0, 0, 0, 45, 120, 224, 105, 0, 0, 0, 14, 0, 0, 113, 0, 171, 86,
+            0, 233, 34, 133, 85, 3, 21, 0, 0, 71, 223, 0, 0, 0, 0, 138, 0, 64, 114, 203, 220, 0, 208, 0, 0, 20,
+            0, 0, 42, 115, 0, 52, 200, 230, 76, 110, 0, 0, 0, 92, 211, 213, 215, 216, 182, 0, 0, 36, 192, 0,
+            128, 0, 112, 163, 198, 0, 103, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 212, 132, 68, 197, 0, 9, 0, 0,
+            246, 245, 74, 28, 0, 199, 234, 123, 0, 0, 164, 121, 0, 0, 82, 167, 157, 0, 50, 0, 67, 0, 47, 195,
+            0, 0, 0, 0, 149, 98, 75, 0, 232, 219, 77, 145, 0, 58, 150, 8, 0, 117, 201, 0, 188, 0, 0, 139, 118,
+            125, 191, 12, 35, 0, 55, 0, 0, 134, 0, 53, 16, 0, 0, 0, 0, 196, 0, 60, 147, 0, 25, 15, 0, 0, 0, 0,
+            0, 99, 0, 0, 237, 40, 0, 0, 90, 0, 0, 0, 175, 181, 0, 0, 0, 29, 0, 0, 248, 0, 106, 0, 0, 228, 33,
+            84, 0, 210, 61, 0, 0, 51, 160, 177, 0, 0, 0, 22, 137, 226, 0, 0, 0, 156, 231, 207, 0, 46, 0, 0, 0,
+            0, 0, 162, 204, 229, 0, 0, 0, 0, 5, 32, 0, 0, 0, 146, 59, 62, 0, 0, 1, 0, 0, 0, 0, 158, 0, 0, 247,
+            0, 0, 0, 0, 180, 0, 187, 0, 0, 89, 57, 37, 0, 0, 152, 0, 141, 0, 0, 0, 119, 0, 0, 129, 56, 124,
+            165, 0, 0, 222, 48, 101, 91, 96, 243, 130, 185, 242, 88, 0, 111, 0, 0, 69, 116, 0, 236, 0, 0, 0, 0,
+            0, 41, 202, 172, 0, 193, 0, 0, 151, 0, 0, 0, 0, 166, 43, 0, 0, 0, 0, 0, 144, 0, 107, 0, 0, 168, 87,
+            4, 0, 0, 19, 94, 0, 0, 0, 0, 39, 183, 0, 17, 0, 49, 10
+        };
+        return Table;
+    }
+};
+
 // Enum for Currency
 UENUM(BlueprintType)
 enum class ECurrency : uint8
@@ -487,6 +668,54 @@ enum class ECurrency : uint8
     pfenum_ZWD UMETA(DisplayName = "ZWD"),
 };
 
+template <>
+struct TPlayFabEnumNames<ECurrency>
+{
+    static const int32 Count = 162;
+    static const uint32 BucketCount = 64;
+    static const uint32 SlotBits = 8;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "AED", "AFN", "ALL", "AMD", "ANG", "AOA", "ARS", "AUD", "AWG", "AZN", "BAM", "BBD", "BDT", "BGN",
+            "BHD", "BIF", "BMD", "BND", "BOB", "BRL", "BSD", "BTN", "BWP", "BYR", "BZD", "CAD", "CDF", "CHF",
+            "CLP", "CNY", "COP", "CRC", "CUC", "CUP", "CVE", "CZK", "DJF", "DKK", "DOP", "DZD", "EGP", "ERN",
+            "ETB", "EUR", "FJD", "FKP", "GBP", "GEL", "GGP", "GHS", "GIP", "GMD", "GNF", "GTQ", "GYD", "HKD",
+            "HNL", "HRK", "HTG", "HUF", "IDR", "ILS", "IMP", "INR", "IQD", "IRR", "ISK", "JEP", "JMD", "JOD",
+            "JPY", "KES", "KGS", "KHR", "KMF", "KPW", "KRW", "KWD", "KYD", "KZT", "LAK", "LBP", "LKR", "LRD",
+            "LSL", "LYD", "MAD", "MDL", "MGA", "MKD", "MMK", "MNT", "MOP", "MRO", "MUR", "MVR", "MWK", "MXN",
+            "MYR", "MZN", "NAD", "NGN", "NIO", "NOK", "NPR", "NZD", "OMR", "PAB", "PEN", "PGK", "PHP", "PKR",
+            "PLN", "PYG", "QAR", "RON", "RSD", "RUB", "RWF", "SAR", "SBD", "SCR", "SDG", "SEK", "SGD", "SHP",
+            "SLL", "SOS", "SPL", "SRD", "STD", "SVC", "SYP", "SZL", "THB", "TJS", "TMT", "TND", "TOP", "TRY",
+            "TTD", "TVD", "TWD", "TZS", "UAH", "UGX", "USD", "UYU", "UZS", "VEF", "VND", "VUV", "WST", "XAF",
+            "XCD", "XDR", "XOF", "XPF", "YER", "ZAR", "ZMW", "ZWD"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0, 0, 0, 1, 0, 1, 3, 3, 2, 0, 0, 0, 0, 4, 2, 1, 0, 0, 0, 0, 4, 3, 0, 1, 3, 5, 0, 1, 1, 0, 2, 0, 1,
+            4, 1, 0, 2, 2, 4, 0, 0, 2, 0, 15, 2, 0, 0, 0, 0, 0, 0, 4, 3, 9, 0, 8, 7, 2, 6, 0, 0, 0, 2, 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            30, 66, 0, 146, 0, 0, 90, 102, 99, 52, 128, 15, 65, 120, 0, 25, 0, 31, 27, 115, 0, 104, 0, 0, 19,
+            143, 0, 6, 95, 155, 127, 55, 101, 0, 0, 0, 134, 0, 0, 97, 105, 0, 0, 43, 72, 0, 89, 58, 82, 0, 0,
+            0, 106, 0, 64, 0, 22, 0, 152, 0, 153, 0, 0, 68, 142, 42, 11, 116, 130, 144, 10, 12, 0, 0, 23, 161,
+            0, 147, 86, 61, 81, 108, 0, 119, 26, 57, 20, 0, 0, 0, 80, 0, 0, 28, 121, 100, 35, 0, 37, 156, 0,
+            84, 0, 0, 96, 21, 0, 0, 112, 32, 47, 14, 0, 83, 0, 0, 1, 0, 0, 91, 139, 0, 13, 79, 129, 0, 158, 0,
+            0, 46, 17, 0, 77, 0, 0, 0, 8, 150, 51, 0, 76, 0, 0, 138, 133, 110, 67, 40, 148, 69, 0, 0, 160, 71,
+            49, 0, 0, 0, 54, 0, 34, 162, 7, 117, 109, 0, 33, 137, 132, 135, 0, 125, 0, 0, 0, 88, 0, 0, 140,
+            136, 9, 159, 94, 0, 151, 0, 0, 60, 18, 0, 98, 145, 0, 0, 78, 0, 0, 0, 0, 50, 59, 56, 0, 53, 93, 73,
+            87, 3, 41, 157, 0, 111, 131, 0, 48, 0, 114, 103, 149, 0, 0, 36, 122, 39, 85, 4, 118, 107, 29, 124,
+            70, 74, 126, 16, 2, 0, 154, 0, 0, 141, 92, 0, 75, 38, 0, 0, 0, 45, 63, 5, 24, 44, 113, 0, 123, 62
+        };
+        return Table;
+    }
+};
+
 // Enum for EffectType
 UENUM(BlueprintType)
 enum class EEffectType : uint8
@@ -495,6 +724,33 @@ enum class EEffectType : uint8
     pfenum_Deny UMETA(DisplayName = "Deny"),
 };
 
+template <>
+struct TPlayFabEnumNames<EEffectType>
+{
+    static const int32 Count = 2;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 1;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Allow", "Deny"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            2, 1
+        };
+        return Table;
+    }
+};
+
 // Enum for EmailVerificationStatus
 UENUM(BlueprintType)
 enum class EEmailVerificationStatus : uint8
@@ -504,6 +760,33 @@ enum class EEmailVerificationStatus : uint8
     pfenum_Confirmed UMETA(DisplayName = "Confirmed"),
 };
 
+template <>
+struct TPlayFabEnumNames<EEmailVerificationStatus>
+{
+    static const int32 Count = 3;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 2;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Unverified", "Pending", "Confirmed"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 3 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            0, 2, 1, 3
+        };
+        return Table;
+    }
+};
+
 // Enum for GameBuildStatus
 UENUM(BlueprintType)
 enum class EGameBuildStatus : uint8
@@ -515,6 +798,33 @@ enum class EGameBuildStatus : uint8
     pfenum_FailedToProcess UMETA(DisplayName = "FailedToProcess"),
 };
 
+template <>
+struct TPlayFabEnumNames<EGameBuildStatus>
+{
+    static const int32 Count = 5;
+    static const uint32 BucketCount = 2;
+    static const uint32 SlotBits = 3;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Available", "Validating", "InvalidBuildPackage", "Processing", "FailedToProcess"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 3, 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            0, 0, 2, 4, 1, 5, 3, 0
+        };
+        return Table;
+    }
+};
+
 // Enum for LoginIdentityProvider
 UENUM(BlueprintType)
 enum class ELoginIdentityProvider : uint8
@@ -535,6 +845,35 @@ enum class ELoginIdentityProvider : uint8
     pfenum_WindowsHello UMETA(DisplayName = "WindowsHello"),
 };
 
+template <>
+struct TPlayFabEnumNames<ELoginIdentityProvider>
+{
+    static const int32 Count = 14;
+    static const uint32 BucketCount = 4;
+    static const uint32 SlotBits = 5;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Unknown", "PlayFab", "Custom", "GameCenter", "GooglePlay", "Steam", "XBoxLive", "PSN",
+            "Kongregate", "Facebook", "IOSDevice", "AndroidDevice", "Twitch", "WindowsHello"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0, 0, 0, 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            12, 0, 0, 0, 10, 0, 0, 6, 0, 0, 0, 9, 0, 8, 14, 2, 1, 0, 0, 5, 7, 0, 0, 0, 13, 4, 0, 0, 0, 3, 11,
+            0
+        };
+        return Table;
+    }
+};
+
 // Enum for PushNotificationPlatform
 UENUM(BlueprintType)
 enum class EPushNotificationPlatform : uint8
@@ -543,6 +882,33 @@ enum class EPushNotificationPlatform : uint8
     pfenum_GoogleCloudMessaging UMETA(DisplayName = "GoogleCloudMessaging"),
 };
 
+template <>
+struct TPlayFabEnumNames<EPushNotificationPlatform>
+{
+    static const int32 Count = 2;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 1;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "ApplePushNotificationService", "GoogleCloudMessaging"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            2, 1
+        };
+        return Table;
+    }
+};
+
 // Enum for PushSetupPlatform
 UENUM(BlueprintType)
 enum class EPushSetupPlatform : uint8
@@ -552,6 +918,33 @@ enum class EPushSetupPlatform : uint8
     pfenum_APNS_SANDBOX UMETA(DisplayName = "APNS_SANDBOX"),
 };
 
+template <>
+struct TPlayFabEnumNames<EPushSetupPlatform>
+{
+    static const int32 Count = 3;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 2;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "GCM", "APNS", "APNS_SANDBOX"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 2 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            3, 0, 2, 1
+        };
+        return Table;
+    }
+};
+
 // Enum for Region
 UENUM(BlueprintType)
 enum class ERegion : uint8
@@ -565,6 +958,33 @@ enum class ERegion : uint8
     pfenum_Australia UMETA(DisplayName = "Australia"),
 };
 
+template <>
+struct TPlayFabEnumNames<ERegion>
+{
+    static const int32 Count = 7;
+    static const uint32 BucketCount = 2;
+    static const uint32 SlotBits = 3;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "USCentral", "USEast", "EUWest", "Singapore", "Japan", "Brazil", "Australia"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 24, 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            5, 6, 4, 7, 3, 0, 1, 2
+        };
+        return Table;
+    }
+};
+
 // Enum for ResolutionOutcome
 UENUM(BlueprintType)
 enum class EResolutionOutcome : uint8
@@ -574,6 +994,33 @@ enum class EResolutionOutcome : uint8
     pfenum_Manual UMETA(DisplayName = "Manual"),
 };
 
+template <>
+struct TPlayFabEnumNames<EResolutionOutcome>
+{
+    static const int32 Count = 3;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 2;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Revoke", "Reinstate", "Manual"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            3, 2, 1, 0
+        };
+        return Table;
+    }
+};
+
 // Enum for ResultTableNodeType
 UENUM(BlueprintType)
 enum class EResultTableNodeType : uint8
@@ -582,6 +1029,33 @@ enum class EResultTableNodeType : uint8
     pfenum_TableId UMETA(DisplayName = "TableId"),
 };
 
+template <>
+struct TPlayFabEnumNames<EResultTableNodeType>
+{
+    static const int32 Count = 2;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 1;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "ItemId", "TableId"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 1 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            2, 1
+        };
+        return Table;
+    }
+};
+
 // Enum for ScheduledTaskType
 UENUM(BlueprintType)
 enum class EScheduledTaskType : uint8
@@ -590,6 +1064,33 @@ enum class EScheduledTaskType : uint8
     pfenum_ActionsOnPlayerSegment UMETA(DisplayName = "ActionsOnPlayerSegment"),
 };
 
+template <>
+struct TPlayFabEnumNames<EScheduledTaskType>
+{
+    static const int32 Count = 2;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 1;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "CloudScript", "ActionsOnPlayerSegment"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            2, 1
+        };
+        return Table;
+    }
+};
+
 // Enum for PfSourceType
 UENUM(BlueprintType)
 enum class EPfSourceType : uint8
@@ -601,6 +1102,33 @@ enum class EPfSourceType : uint8
     pfenum_Partner UMETA(DisplayName = "Partner"),
 };
 
+template <>
+struct TPlayFabEnumNames<EPfSourceType>
+{
+    static const int32 Count = 5;
+    static const uint32 BucketCount = 2;
+    static const uint32 SlotBits = 3;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Admin", "BackEnd", "GameClient", "GameServer", "Partner"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0, 1 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            1, 5, 4, 0, 3, 0, 0, 2
+        };
+        return Table;
+    }
+};
+
 // Enum for StatisticAggregationMethod
 UENUM(BlueprintType)
 enum class EStatisticAggregationMethod : uint8
@@ -611,6 +1139,33 @@ enum class EStatisticAggregationMethod : uint8
     pfenum_Sum UMETA(DisplayName = "Sum"),
 };
 
+template <>
+struct TPlayFabEnumNames<EStatisticAggregationMethod>
+{
+    static const int32 Count = 4;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 3;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Last", "Min", "Max", "Sum"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 1 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            0, 0, 4, 0, 2, 0, 3, 1
+        };
+        return Table;
+    }
+};
+
 // Enum for StatisticResetIntervalOption
 UENUM(BlueprintType)
 enum class EStatisticResetIntervalOption : uint8
@@ -622,6 +1177,33 @@ enum class EStatisticResetIntervalOption : uint8
     pfenum_Month UMETA(DisplayName = "Month"),
 };
 
+template <>
+struct TPlayFabEnumNames<EStatisticResetIntervalOption>
+{
+    static const int32 Count = 5;
+    static const uint32 BucketCount = 2;
+    static const uint32 SlotBits = 3;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Never", "Hour", "Day", "Week", "Month"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0, 12 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            0, 3, 4, 5, 0, 1, 0, 2
+        };
+        return Table;
+    }
+};
+
 // Enum for StatisticVersionArchivalStatus
 UENUM(BlueprintType)
 enum class EStatisticVersionArchivalStatus : uint8
@@ -633,6 +1215,33 @@ enum class EStatisticVersionArchivalStatus : uint8
     pfenum_Complete UMETA(DisplayName = "Complete"),
 };
 
+template <>
+struct TPlayFabEnumNames<EStatisticVersionArchivalStatus>
+{
+    static const int32 Count = 5;
+    static const uint32 BucketCount = 2;
+    static const uint32 SlotBits = 3;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "NotScheduled", "Scheduled", "Queued", "InProgress", "Complete"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 1, 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            5, 4, 0, 1, 3, 0, 0, 2
+        };
+        return Table;
+    }
+};
+
 // Enum for StatisticVersionStatus
 UENUM(BlueprintType)
 enum class EStatisticVersionStatus : uint8
@@ -644,6 +1253,33 @@ enum class EStatisticVersionStatus : uint8
     pfenum_Archived UMETA(DisplayName = "Archived"),
 };
 
+template <>
+struct TPlayFabEnumNames<EStatisticVersionStatus>
+{
+    static const int32 Count = 5;
+    static const uint32 BucketCount = 2;
+    static const uint32 SlotBits = 3;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Active", "SnapshotPending", "Snapshot", "ArchivalPending", "Archived"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 4, 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            0, 3, 5, 0, 2, 1, 4, 0
+        };
+        return Table;
+    }
+};
+
 // Enum for TaskInstanceStatus
 UENUM(BlueprintType)
 enum class ETaskInstanceStatus : uint8
@@ -656,6 +1292,33 @@ enum class ETaskInstanceStatus : uint8
     pfenum_Pending UMETA(DisplayName = "Pending"),
 };
 
+template <>
+struct TPlayFabEnumNames<ETaskInstanceStatus>
+{
+    static const int32 Count = 6;
+    static const uint32 BucketCount = 2;
+    static const uint32 SlotBits = 3;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Succeeded", "Starting", "InProgress", "Failed", "Aborted", "Pending"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0, 6 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            2, 5, 6, 4, 3, 0, 0, 1
+        };
+        return Table;
+    }
+};
+
 // Enum for TitleActivationStatus
 UENUM(BlueprintType)
 enum class ETitleActivationStatus : uint8
@@ -667,6 +1330,33 @@ enum class ETitleActivationStatus : uint8
     pfenum_RevokedSteam UMETA(DisplayName = "RevokedSteam"),
 };
 
+template <>
+struct TPlayFabEnumNames<ETitleActivationStatus>
+{
+    static const int32 Count = 5;
+    static const uint32 BucketCount = 2;
+    static const uint32 SlotBits = 3;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "None", "ActivatedTitleKey", "PendingSteam", "ActivatedSteam", "RevokedSteam"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 2, 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            1, 2, 0, 4, 0, 5, 0, 3
+        };
+        return Table;
+    }
+};
+
 // Enum for UserDataPermission
 UENUM(BlueprintType)
 enum class EUserDataPermission : uint8
@@ -675,6 +1365,33 @@ enum class EUserDataPermission : uint8
     pfenum_Public UMETA(DisplayName = "Public"),
 };
 
+template <>
+struct TPlayFabEnumNames<EUserDataPermission>
+{
+    static const int32 Count = 2;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 1;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Private", "Public"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            2, 1
+        };
+        return Table;
+    }
+};
+
 // Enum for UserOrigination
 UENUM(BlueprintType)
 enum class EUserOrigination : uint8
@@ -699,6 +1416,36 @@ enum class EUserOrigination : uint8
     pfenum_WindowsHello UMETA(DisplayName = "WindowsHello"),
 };
 
+template <>
+struct TPlayFabEnumNames<EUserOrigination>
+{
+    static const int32 Count = 18;
+    static const uint32 BucketCount = 8;
+    static const uint32 SlotBits = 5;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Organic", "Steam", "Google", "Amazon", "Facebook", "Kongregate", "GamersFirst", "Unknown", "IOS",
+            "LoadTest", "Android", "PSN", "GameCenter", "CustomId", "XboxLive", "Parse", "Twitch",
+            "WindowsHello"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0, 2, 1, 1, 15, 1, 6, 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            2, 0, 10, 0, 9, 4, 0, 16, 0, 0, 6, 0, 0, 0, 1, 14, 0, 15, 7, 0, 0, 0, 17, 13, 11, 0, 8, 18, 0, 5,
+            12, 3
+        };
+        return Table;
+    }
+};
+
 // Enum for CloudScriptRevisionOption
 UENUM(BlueprintType)
 enum class ECloudScriptRevisionOption : uint8
@@ -708,6 +1455,33 @@ enum class ECloudScriptRevisionOption : uint8
     pfenum_Specific UMETA(DisplayName = "Specific"),
 };
 
+template <>
+struct TPlayFabEnumNames<ECloudScriptRevisionOption>
+{
+    static const int32 Count = 3;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 2;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Live", "Latest", "Specific"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 0 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            2, 1, 3, 0
+        };
+        return Table;
+    }
+};
+
 // Enum for GameInstanceState
 UENUM(BlueprintType)
 enum class EGameInstanceState : uint8
@@ -716,6 +1490,33 @@ enum class EGameInstanceState : uint8
     pfenum_Closed UMETA(DisplayName = "Closed"),
 };
 
+template <>
+struct TPlayFabEnumNames<EGameInstanceState>
+{
+    static const int32 Count = 2;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 1;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Open", "Closed"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 1 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            2, 1
+        };
+        return Table;
+    }
+};
+
 // Enum for PlayerConnectionState
 UENUM(BlueprintType)
 enum class EPlayerConnectionState : uint8
@@ -726,3 +1527,30 @@ enum class EPlayerConnectionState : uint8
     pfenum_Participated UMETA(DisplayName = "Participated"),
 };
 
+template <>
+struct TPlayFabEnumNames<EPlayerConnectionState>
+{
+    static const int32 Count = 4;
+    static const uint32 BucketCount = 1;
+    static const uint32 SlotBits = 3;
+    static FORCEINLINE const ANSICHAR* const* Names()
+    {
+        static constexpr const ANSICHAR* Table[Count] = {
+            "Unassigned", "Connecting", "Participating", "Participated"
+        };
+        return Table;
+    }
+    static FORCEINLINE const uint16* Displacements()
+    {
+        static constexpr uint16 Table[BucketCount] = { 6 };
+        return Table;
+    }
+    static FORCEINLINE const uint8* Slots()
+    {
+        static constexpr uint8 Table[1 << SlotBits] = {
+            3, 2, 0, 0, 0, 0, 4, 1
+        };
+        return Table;
+    }
+};
+
@@ -7,6 +7,7 @@
 
 #pragma once
 
+#include "PlayFabJsonView.h"
 #include "PlayFabJsonObject.generated.h"
 
 class UPlayFabJsonValue;
@@ -33,6 +34,9 @@ class PLAYFAB_API UPlayFabJsonObject : public UObject
     /** Set the root Json object */
     void SetRootObject(TSharedPtr<FJsonObject>& JsonObject);
 
+    /** A view of the root Json object, for reading it without making more objects */
+    FPlayFabJsonView GetView() const { return FPlayFabJsonView(JsonObj); }
+
 
     //////////////////////////////////////////////////////////////////////////
     // Serialization
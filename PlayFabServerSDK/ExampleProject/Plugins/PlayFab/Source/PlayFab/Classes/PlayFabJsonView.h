@@ -0,0 +1,153 @@
+////////////////////////////////////////////////////////////
+// JSon Views
+// A light handle into a parsed json document, handed out by
+// the response models beside each UPlayFabJsonObject field.
+// It shares the document rather than copying it, and is only
+// turned into a UObject when Blueprint asks for one.
+////////////////////////////////////////////////////////////
+
+#pragma once
+
+#include "Dom/JsonObject.h"
+#include "Kismet/BlueprintFunctionLibrary.h"
+#include "PlayFabJsonView.generated.h"
+
+class UPlayFabJsonObject;
+struct FPlayFabJsonArrayView;
+
+/**
+ * A json object in a response. Copying one only copies a reference to the document
+ */
+USTRUCT(BlueprintType)
+struct PLAYFAB_API FPlayFabJsonView
+{
+    GENERATED_USTRUCT_BODY()
+
+    FPlayFabJsonView() {}
+    explicit FPlayFabJsonView(const TSharedPtr<FJsonObject>& InObject) : Object(InObject) {}
+
+    /** False for a field that was missing or not an object */
+    bool IsValid() const { return Object.IsValid(); }
+
+    /** The json this refers to */
+    const TSharedPtr<FJsonObject>& GetJsonObject() const { return Object; }
+
+    /** Field getters. A missing field, or one of another type, gives the default without logging */
+    bool HasField(const FString& FieldName) const;
+    FString GetStringField(const FString& FieldName) const;
+    double GetNumberField(const FString& FieldName) const;
+    bool GetBoolField(const FString& FieldName) const;
+    FPlayFabJsonView GetObjectField(const FString& FieldName) const;
+    FPlayFabJsonArrayView GetArrayField(const FString& FieldName) const;
+    TArray<FPlayFabJsonView> GetObjectArrayField(const FString& FieldName) const;
+    TArray<FString> GetStringArrayField(const FString& FieldName) const;
+
+    /** A deep copy of the json, for handing out where it may be edited. Null if the view is invalid */
+    TSharedPtr<FJsonObject> CopyJsonObject() const;
+
+    /** A new UPlayFabJsonObject holding a deep copy of the json, so editing it can't change the response. Returns nullptr if the view is invalid */
+    UPlayFabJsonObject* ToJsonObject() const;
+
+    /** A new UPlayFabJsonObject sharing the json, for a document nothing outside this response holds. Returns nullptr if the view is invalid */
+    UPlayFabJsonObject* WrapJsonObject() const;
+    static TArray<UPlayFabJsonObject*> WrapJsonObjects(const TArray<FPlayFabJsonView>& Views);
+
+private:
+    TSharedPtr<FJsonObject> Object;
+};
+
+/**
+ * A json array inside a document, read in place. Keeps the object holding the array alive
+ */
+struct PLAYFAB_API FPlayFabJsonArrayView
+{
+    FPlayFabJsonArrayView() : Values(nullptr) {}
+    FPlayFabJsonArrayView(const TSharedPtr<FJsonObject>& InOwner, const TArray<TSharedPtr<FJsonValue>>* InValues) : Owner(InOwner), Values(InValues) {}
+
+    int32 Num() const { return Values != nullptr ? Values->Num() : 0; }
+    const TSharedPtr<FJsonValue>& operator[](int32 Index) const { return (*Values)[Index]; }
+
+    /** The element at Index as an object, invalid if it isn't one */
+    FPlayFabJsonView GetObject(int32 Index) const;
+
+    /** Range-for over the values */
+    const TSharedPtr<FJsonValue>* begin() const { return Values != nullptr ? Values->GetData() : nullptr; }
+    const TSharedPtr<FJsonValue>* end() const { return Values != nullptr ? Values->GetData() + Values->Num() : nullptr; }
+
+private:
+    TSharedPtr<FJsonObject> Owner;
+    const TArray<TSharedPtr<FJsonValue>>* Values;
+};
+
+/**
+ * The response models hold every object field twice: as a view named XView, and as the UPlayFabJsonObject field X
+ * that graphs made before views existed are wired to. The objects are only made for a result about to reach a
+ * Blueprint, by the generated fill functions of the model decoders. Only the game thread uses this
+ */
+class PLAYFAB_API FPlayFabJsonObjectFields
+{
+public:
+    static void SetEnabled(bool bInEnabled) { bEnabled = bInEnabled; }
+    static bool IsEnabled() { return bEnabled; }
+
+    /** True if the result of a call should have its object fields filled before it is passed to OnSuccess */
+    static bool IsWanted(const FScriptDelegate& OnSuccess);
+
+private:
+    static bool bEnabled;
+};
+
+/**
+ * Blueprint access to json views, so a graph can read a response without making a UObject per object in it
+ */
+UCLASS()
+class PLAYFAB_API UPlayFabJsonViewLibrary : public UBlueprintFunctionLibrary
+{
+    GENERATED_BODY()
+
+public:
+    /** Copy the view into a Json Object, for the nodes that take one. Each call makes a new object */
+    UFUNCTION(BlueprintPure, meta = (DisplayName = "To Json Object"), Category = "PlayFab | Json")
+        static UPlayFabJsonObject* ToJsonObject(const FPlayFabJsonView& View);
+
+    /** Copy every view into a Json Object. Reading the views directly avoids making them */
+    UFUNCTION(BlueprintPure, meta = (DisplayName = "To Json Object Array"), Category = "PlayFab | Json")
+        static TArray<UPlayFabJsonObject*> ToJsonObjectArray(const TArray<FPlayFabJsonView>& Views);
+
+    /** Is there json behind the view */
+    UFUNCTION(BlueprintPure, meta = (DisplayName = "Is Valid (Json View)"), Category = "PlayFab | Json")
+        static bool IsValidView(const FPlayFabJsonView& View);
+
+    /** Checks to see if the FieldName exists in the object */
+    UFUNCTION(BlueprintPure, meta = (DisplayName = "Has Field (Json View)"), Category = "PlayFab | Json")
+        static bool HasViewField(const FPlayFabJsonView& View, const FString& FieldName);
+
+    /** Get the field named FieldName as a string */
+    UFUNCTION(BlueprintPure, meta = (DisplayName = "Get String Field (Json View)"), Category = "PlayFab | Json")
+        static FString GetViewStringField(const FPlayFabJsonView& View, const FString& FieldName);
+
+    /** Get the field named FieldName as a number
+     * Attn.!! float used instead of double to make the function blueprintable! */
+    UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Number Field (Json View)"), Category = "PlayFab | Json")
+        static float GetViewNumberField(const FPlayFabJsonView& View, const FString& FieldName);
+
+    /** Get the field named FieldName as a boolean */
+    UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Bool Field (Json View)"), Category = "PlayFab | Json")
+        static bool GetViewBoolField(const FPlayFabJsonView& View, const FString& FieldName);
+
+    /** Get the field named FieldName as a view */
+    UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Object Field (Json View)"), Category = "PlayFab | Json")
+        static FPlayFabJsonView GetViewObjectField(const FPlayFabJsonView& View, const FString& FieldName);
+
+    /** Get the field named FieldName as an array of views */
+    UFUNCTION(BlueprintPure, meta = (DisplayName = "Get Object Array Field (Json View)"), Category = "PlayFab | Json")
+        static TArray<FPlayFabJsonView> GetViewObjectArrayField(const FPlayFabJsonView& View, const FString& FieldName);
+
+    /** Get the field named FieldName as a String Array */
+    UFUNCTION(BlueprintPure, meta = (DisplayName = "Get String Array Field (Json View)"), Category = "PlayFab | Json")
+        static TArray<FString> GetViewStringArrayField(const FPlayFabJsonView& View, const FString& FieldName);
+
+    /** Serialize the view to a condensed json string */
+    UFUNCTION(BlueprintPure, meta = (DisplayName = "Encode Json (Json View)"), Category = "PlayFab | Json")
+        static FString EncodeViewJson(const FPlayFabJsonView& View);
+};
@@ -9,6 +9,7 @@
 
 #include "OnlineBlueprintCallProxyBase.h"
 #include "PlayFabBaseModel.h"
+#include "PlayFabRequestTypes.h"
 #include "PlayFabMatchmakerModels.h"
 #include "PlayFabMatchmakerAPI.generated.h"
 
@@ -25,9 +26,12 @@ public:
     UPROPERTY(BlueprintAssignable)
         FOnPlayFabMatchmakerRequestCompleted OnPlayFabResponse;
 
-    /** Set the Request Json object */
+    /** Set the Request Json object, sent in place of the body the factory wrote */
     void SetRequestObject(UPlayFabJsonObject* JsonObject);
 
+    /** Get the Request Json object, created on first use and kept while the manager is pooled */
+    UPlayFabJsonObject* GetRequestObject();
+
     /** Get the Response Json object */
     UPlayFabJsonObject* GetResponseObject();
 
@@ -40,6 +44,10 @@ public:
     /** UOnlineBlueprintCallProxyBase interface */
     virtual void Activate() override;
 
+    /** Clear this call's request, response and delegates and hand it back to the manager pool. Done once the response has been delivered, or call it instead of Activate() to drop a call */
+    UFUNCTION()
+        void ReleaseToPool();
+
     //////////////////////////////////////////////////////////////////////////
     // Generated PlayFab Matchmaker API Functions
     //////////////////////////////////////////////////////////////////////////
@@ -119,24 +127,26 @@ public:
     bool useSecretKey = false;
     bool useSessionTicket = false;
     bool isLoginRequest = false;
+    EPlayFabRequestPriority requestPriority = EPlayFabRequestPriority::Normal;
+    bool isIdempotent = false;
+    bool isReadOnly = false;
 
     /** Is the response valid JSON? */
     bool bIsValidJsonResponse;
-    FString ResponseContent;
     int32 ResponseCode;
     UObject* mCustomData;
 
     FDelegateOnFailurePlayFabError OnFailure;
-    FDelegateOnSuccessAuthUser OnSuccessAuthUser;
-    FDelegateOnSuccessPlayerJoined OnSuccessPlayerJoined;
-    FDelegateOnSuccessPlayerLeft OnSuccessPlayerLeft;
-    FDelegateOnSuccessStartGame OnSuccessStartGame;
-    FDelegateOnSuccessUserInfo OnSuccessUserInfo;
+
+    /** The success callback of the one call this manager makes. Its helper executes it as the call's FDelegateOnSuccess type */
+    FScriptDelegate OnSuccess;
 
 private:
-    /** Internal bind function for the IHTTPRequest::OnProcessRequestCompleted() event */
-    void OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
+    /** Internal bind function, called by the request dispatcher once the response has been parsed on a worker thread */
+    void OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed);
 
+    /** Builds the http request for this call. The dispatcher serializes the body */
+    TSharedRef<IHttpRequest> BuildHttpRequest();
 protected:
     /** Internal request data stored as JSON */
     UPROPERTY()
@@ -148,4 +158,7 @@ protected:
 
     /** Mapping of header section to values. Used to generate final header string for request */
     TMap<FString, FString> RequestHeaders;
+
+    /** The condensed UTF-8 body the factory streamed the request into. Kept, with its capacity, while the manager is pooled */
+    TArray<uint8> RequestBody;
 };
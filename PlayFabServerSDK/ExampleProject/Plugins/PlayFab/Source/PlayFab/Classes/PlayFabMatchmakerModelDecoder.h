@@ -9,6 +9,7 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "PlayFabEnums.h"
+#include "PlayFabBaseModel.h"
 #include "PlayFabMatchmakerModels.h"
 #include "PlayFabMatchmakerModelDecoder.generated.h"
 
@@ -34,22 +35,45 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Matchmaker | Matchmaking Models")
         static FMatchmakerAuthUserResponse decodeAuthUserResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the AuthUserResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FMatchmakerAuthUserResponse readAuthUserResponseResponse(const FPlayFabBaseModel& response);
+
     /** Decode the PlayerJoinedResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Matchmaker | Matchmaking Models")
         static FMatchmakerPlayerJoinedResponse decodePlayerJoinedResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the PlayerJoinedResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FMatchmakerPlayerJoinedResponse readPlayerJoinedResponseResponse(const FPlayFabBaseModel& response);
+
     /** Decode the PlayerLeftResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Matchmaker | Matchmaking Models")
         static FMatchmakerPlayerLeftResponse decodePlayerLeftResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the PlayerLeftResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FMatchmakerPlayerLeftResponse readPlayerLeftResponseResponse(const FPlayFabBaseModel& response);
+
     /** Decode the StartGameResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Matchmaker | Matchmaking Models")
         static FMatchmakerStartGameResponse decodeStartGameResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the StartGameResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FMatchmakerStartGameResponse readStartGameResponseResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UserInfoResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Matchmaker | Matchmaking Models")
         static FMatchmakerUserInfoResponse decodeUserInfoResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the UserInfoResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FMatchmakerUserInfoResponse readUserInfoResponseResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a UserInfoResponse from its views, for a Blueprint that reads them */
+    static void fillUserInfoResponseJsonObjects(FMatchmakerUserInfoResponse& result);
+
 
 
 };
@@ -9,6 +9,7 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "PlayFabEnums.h"
+#include "PlayFabJsonView.h"
 #include "PlayFabMatchmakerModels.generated.h"
 
 class UPlayFabJsonObject;
@@ -153,12 +154,21 @@ public:
     /** Array of inventory items in the user's current inventory. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Matchmaker | Matchmaking Models")
         TArray<UPlayFabJsonObject*> Inventory;
+    /** Inventory, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Matchmaker | Matchmaking Models")
+        TArray<FPlayFabJsonView> InventoryView;
     /** Array of virtual currency balance(s) belonging to the user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Matchmaker | Matchmaking Models")
         UPlayFabJsonObject* VirtualCurrency;
+    /** VirtualCurrency, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Matchmaker | Matchmaking Models")
+        FPlayFabJsonView VirtualCurrencyView;
     /** Array of remaining times and timestamps for virtual currencies. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Matchmaker | Matchmaking Models")
         UPlayFabJsonObject* VirtualCurrencyRechargeTimes = nullptr;
+    /** VirtualCurrencyRechargeTimes, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Matchmaker | Matchmaking Models")
+        FPlayFabJsonView VirtualCurrencyRechargeTimesView;
     /** Boolean indicating whether the user is a developer. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Matchmaker | Matchmaking Models")
         bool IsDeveloper;
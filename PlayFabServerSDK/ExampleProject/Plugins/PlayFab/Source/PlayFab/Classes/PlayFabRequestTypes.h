@@ -0,0 +1,51 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Request Types. Settings shared by every API that control how the request
+// dispatcher schedules calls, the stages it reports metrics for, and the categories of
+// PlayFab error codes.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabRequestTypes.generated.h"
+
+// Priority class of a request. The dispatcher always starts queued requests from the highest class first.
+UENUM(BlueprintType)
+enum class EPlayFabRequestPriority : uint8
+{
+    Critical UMETA(DisplayName = "Critical"), // Login, purchase and receipt validation
+    High UMETA(DisplayName = "High"), // Inventory and currency changes
+    Normal UMETA(DisplayName = "Normal"),
+    Low UMETA(DisplayName = "Low"), // Telemetry and leaderboard refreshes
+};
+
+// What the dispatcher does with a new request when the queue for its priority class is full
+UENUM(BlueprintType)
+enum class EPlayFabQueueOverflowPolicy : uint8
+{
+    DropOldest UMETA(DisplayName = "Drop Oldest"), // Fail the oldest queued request to make room
+    Reject UMETA(DisplayName = "Reject"), // Fail the new request
+    Coalesce UMETA(DisplayName = "Coalesce"), // Merge a read only request into a queued one with the same endpoint, caller and body, so both get its response, otherwise drop the oldest
+};
+
+// Stage of a call that the metrics time separately
+UENUM(BlueprintType)
+enum class EPlayFabCallStage : uint8
+{
+    QueueWait UMETA(DisplayName = "Queue Wait"), // Submitted until sent, including serializing the body
+    Network UMETA(DisplayName = "Network"), // Sent until the response arrived
+    Decode UMETA(DisplayName = "Decode"), // Inflating a compressed response
+    Parse UMETA(DisplayName = "Parse"), // Parsing the response json and its error block
+    Callback UMETA(DisplayName = "Callback"), // Handing the result to the caller, including model decoding
+};
+
+// What kind of failure a PlayFab error code is, and so what the caller should do about it
+UENUM(BlueprintType)
+enum class EPlayFabErrorCategory : uint8
+{
+    None UMETA(DisplayName = "None"), // Not an error
+    Retryable UMETA(DisplayName = "Retryable"), // A temporary service problem, the same call may succeed later
+    Throttled UMETA(DisplayName = "Throttled"), // The service is rate limiting the title or client, back off before calling again
+    AuthExpired UMETA(DisplayName = "Auth Expired"), // The session or a platform token is no longer valid, log in again
+    Permanent UMETA(DisplayName = "Permanent"), // The call was refused and will be refused the same way again
+    ClientBug UMETA(DisplayName = "Client Bug"), // The request is malformed or not allowed for this caller
+};
@@ -9,6 +9,7 @@
 
 #include "OnlineBlueprintCallProxyBase.h"
 #include "PlayFabBaseModel.h"
+#include "PlayFabRequestTypes.h"
 #include "PlayFabServerModels.h"
 #include "PlayFabServerAPI.generated.h"
 
@@ -25,9 +26,12 @@ public:
     UPROPERTY(BlueprintAssignable)
         FOnPlayFabServerRequestCompleted OnPlayFabResponse;
 
-    /** Set the Request Json object */
+    /** Set the Request Json object, sent in place of the body the factory wrote */
     void SetRequestObject(UPlayFabJsonObject* JsonObject);
 
+    /** Get the Request Json object, created on first use and kept while the manager is pooled */
+    UPlayFabJsonObject* GetRequestObject();
+
     /** Get the Response Json object */
     UPlayFabJsonObject* GetResponseObject();
 
@@ -40,6 +44,10 @@ public:
     /** UOnlineBlueprintCallProxyBase interface */
     virtual void Activate() override;
 
+    /** Clear this call's request, response and delegates and hand it back to the manager pool. Done once the response has been delivered, or call it instead of Activate() to drop a call */
+    UFUNCTION()
+        void ReleaseToPool();
+
     //////////////////////////////////////////////////////////////////////////
     // Generated PlayFab Server API Functions
     //////////////////////////////////////////////////////////////////////////
@@ -1531,128 +1539,26 @@ public:
     bool useSecretKey = false;
     bool useSessionTicket = false;
     bool isLoginRequest = false;
+    EPlayFabRequestPriority requestPriority = EPlayFabRequestPriority::Normal;
+    bool isIdempotent = false;
+    bool isReadOnly = false;
 
     /** Is the response valid JSON? */
     bool bIsValidJsonResponse;
-    FString ResponseContent;
     int32 ResponseCode;
     UObject* mCustomData;
 
     FDelegateOnFailurePlayFabError OnFailure;
-    FDelegateOnSuccessAuthenticateSessionTicket OnSuccessAuthenticateSessionTicket;
-    FDelegateOnSuccessSetPlayerSecret OnSuccessSetPlayerSecret;
-    FDelegateOnSuccessBanUsers OnSuccessBanUsers;
-    FDelegateOnSuccessGetPlayerProfile OnSuccessGetPlayerProfile;
-    FDelegateOnSuccessGetPlayFabIDsFromFacebookIDs OnSuccessGetPlayFabIDsFromFacebookIDs;
-    FDelegateOnSuccessGetPlayFabIDsFromSteamIDs OnSuccessGetPlayFabIDsFromSteamIDs;
-    FDelegateOnSuccessGetUserAccountInfo OnSuccessGetUserAccountInfo;
-    FDelegateOnSuccessGetUserBans OnSuccessGetUserBans;
-    FDelegateOnSuccessRevokeAllBansForUser OnSuccessRevokeAllBansForUser;
-    FDelegateOnSuccessRevokeBans OnSuccessRevokeBans;
-    FDelegateOnSuccessSendPushNotification OnSuccessSendPushNotification;
-    FDelegateOnSuccessUpdateAvatarUrl OnSuccessUpdateAvatarUrl;
-    FDelegateOnSuccessUpdateBans OnSuccessUpdateBans;
-    FDelegateOnSuccessDeleteUsers OnSuccessDeleteUsers;
-    FDelegateOnSuccessGetFriendLeaderboard OnSuccessGetFriendLeaderboard;
-    FDelegateOnSuccessGetLeaderboard OnSuccessGetLeaderboard;
-    FDelegateOnSuccessGetLeaderboardAroundUser OnSuccessGetLeaderboardAroundUser;
-    FDelegateOnSuccessGetPlayerCombinedInfo OnSuccessGetPlayerCombinedInfo;
-    FDelegateOnSuccessGetPlayerStatistics OnSuccessGetPlayerStatistics;
-    FDelegateOnSuccessGetPlayerStatisticVersions OnSuccessGetPlayerStatisticVersions;
-    FDelegateOnSuccessGetUserData OnSuccessGetUserData;
-    FDelegateOnSuccessGetUserInternalData OnSuccessGetUserInternalData;
-    FDelegateOnSuccessGetUserPublisherData OnSuccessGetUserPublisherData;
-    FDelegateOnSuccessGetUserPublisherInternalData OnSuccessGetUserPublisherInternalData;
-    FDelegateOnSuccessGetUserPublisherReadOnlyData OnSuccessGetUserPublisherReadOnlyData;
-    FDelegateOnSuccessGetUserReadOnlyData OnSuccessGetUserReadOnlyData;
-    FDelegateOnSuccessUpdatePlayerStatistics OnSuccessUpdatePlayerStatistics;
-    FDelegateOnSuccessUpdateUserData OnSuccessUpdateUserData;
-    FDelegateOnSuccessUpdateUserInternalData OnSuccessUpdateUserInternalData;
-    FDelegateOnSuccessUpdateUserPublisherData OnSuccessUpdateUserPublisherData;
-    FDelegateOnSuccessUpdateUserPublisherInternalData OnSuccessUpdateUserPublisherInternalData;
-    FDelegateOnSuccessUpdateUserPublisherReadOnlyData OnSuccessUpdateUserPublisherReadOnlyData;
-    FDelegateOnSuccessUpdateUserReadOnlyData OnSuccessUpdateUserReadOnlyData;
-    FDelegateOnSuccessGetCatalogItems OnSuccessGetCatalogItems;
-    FDelegateOnSuccessGetPublisherData OnSuccessGetPublisherData;
-    FDelegateOnSuccessGetTime OnSuccessGetTime;
-    FDelegateOnSuccessGetTitleData OnSuccessGetTitleData;
-    FDelegateOnSuccessGetTitleInternalData OnSuccessGetTitleInternalData;
-    FDelegateOnSuccessGetTitleNews OnSuccessGetTitleNews;
-    FDelegateOnSuccessSetPublisherData OnSuccessSetPublisherData;
-    FDelegateOnSuccessSetTitleData OnSuccessSetTitleData;
-    FDelegateOnSuccessSetTitleInternalData OnSuccessSetTitleInternalData;
-    FDelegateOnSuccessAddCharacterVirtualCurrency OnSuccessAddCharacterVirtualCurrency;
-    FDelegateOnSuccessAddUserVirtualCurrency OnSuccessAddUserVirtualCurrency;
-    FDelegateOnSuccessConsumeItem OnSuccessConsumeItem;
-    FDelegateOnSuccessEvaluateRandomResultTable OnSuccessEvaluateRandomResultTable;
-    FDelegateOnSuccessGetCharacterInventory OnSuccessGetCharacterInventory;
-    FDelegateOnSuccessGetRandomResultTables OnSuccessGetRandomResultTables;
-    FDelegateOnSuccessGetUserInventory OnSuccessGetUserInventory;
-    FDelegateOnSuccessGrantItemsToCharacter OnSuccessGrantItemsToCharacter;
-    FDelegateOnSuccessGrantItemsToUser OnSuccessGrantItemsToUser;
-    FDelegateOnSuccessGrantItemsToUsers OnSuccessGrantItemsToUsers;
-    FDelegateOnSuccessModifyItemUses OnSuccessModifyItemUses;
-    FDelegateOnSuccessMoveItemToCharacterFromCharacter OnSuccessMoveItemToCharacterFromCharacter;
-    FDelegateOnSuccessMoveItemToCharacterFromUser OnSuccessMoveItemToCharacterFromUser;
-    FDelegateOnSuccessMoveItemToUserFromCharacter OnSuccessMoveItemToUserFromCharacter;
-    FDelegateOnSuccessRedeemCoupon OnSuccessRedeemCoupon;
-    FDelegateOnSuccessReportPlayer OnSuccessReportPlayer;
-    FDelegateOnSuccessRevokeInventoryItem OnSuccessRevokeInventoryItem;
-    FDelegateOnSuccessSubtractCharacterVirtualCurrency OnSuccessSubtractCharacterVirtualCurrency;
-    FDelegateOnSuccessSubtractUserVirtualCurrency OnSuccessSubtractUserVirtualCurrency;
-    FDelegateOnSuccessUnlockContainerInstance OnSuccessUnlockContainerInstance;
-    FDelegateOnSuccessUnlockContainerItem OnSuccessUnlockContainerItem;
-    FDelegateOnSuccessUpdateUserInventoryItemCustomData OnSuccessUpdateUserInventoryItemCustomData;
-    FDelegateOnSuccessAddFriend OnSuccessAddFriend;
-    FDelegateOnSuccessGetFriendsList OnSuccessGetFriendsList;
-    FDelegateOnSuccessRemoveFriend OnSuccessRemoveFriend;
-    FDelegateOnSuccessSetFriendTags OnSuccessSetFriendTags;
-    FDelegateOnSuccessDeregisterGame OnSuccessDeregisterGame;
-    FDelegateOnSuccessNotifyMatchmakerPlayerLeft OnSuccessNotifyMatchmakerPlayerLeft;
-    FDelegateOnSuccessRedeemMatchmakerTicket OnSuccessRedeemMatchmakerTicket;
-    FDelegateOnSuccessRefreshGameServerInstanceHeartbeat OnSuccessRefreshGameServerInstanceHeartbeat;
-    FDelegateOnSuccessRegisterGame OnSuccessRegisterGame;
-    FDelegateOnSuccessSetGameServerInstanceData OnSuccessSetGameServerInstanceData;
-    FDelegateOnSuccessSetGameServerInstanceState OnSuccessSetGameServerInstanceState;
-    FDelegateOnSuccessSetGameServerInstanceTags OnSuccessSetGameServerInstanceTags;
-    FDelegateOnSuccessWriteCharacterEvent OnSuccessWriteCharacterEvent;
-    FDelegateOnSuccessWritePlayerEvent OnSuccessWritePlayerEvent;
-    FDelegateOnSuccessWriteTitleEvent OnSuccessWriteTitleEvent;
-    FDelegateOnSuccessAddSharedGroupMembers OnSuccessAddSharedGroupMembers;
-    FDelegateOnSuccessCreateSharedGroup OnSuccessCreateSharedGroup;
-    FDelegateOnSuccessDeleteSharedGroup OnSuccessDeleteSharedGroup;
-    FDelegateOnSuccessGetSharedGroupData OnSuccessGetSharedGroupData;
-    FDelegateOnSuccessRemoveSharedGroupMembers OnSuccessRemoveSharedGroupMembers;
-    FDelegateOnSuccessUpdateSharedGroupData OnSuccessUpdateSharedGroupData;
-    FDelegateOnSuccessExecuteCloudScript OnSuccessExecuteCloudScript;
-    FDelegateOnSuccessGetContentDownloadUrl OnSuccessGetContentDownloadUrl;
-    FDelegateOnSuccessDeleteCharacterFromUser OnSuccessDeleteCharacterFromUser;
-    FDelegateOnSuccessGetAllUsersCharacters OnSuccessGetAllUsersCharacters;
-    FDelegateOnSuccessGetCharacterLeaderboard OnSuccessGetCharacterLeaderboard;
-    FDelegateOnSuccessGetCharacterStatistics OnSuccessGetCharacterStatistics;
-    FDelegateOnSuccessGetLeaderboardAroundCharacter OnSuccessGetLeaderboardAroundCharacter;
-    FDelegateOnSuccessGetLeaderboardForUserCharacters OnSuccessGetLeaderboardForUserCharacters;
-    FDelegateOnSuccessGrantCharacterToUser OnSuccessGrantCharacterToUser;
-    FDelegateOnSuccessUpdateCharacterStatistics OnSuccessUpdateCharacterStatistics;
-    FDelegateOnSuccessGetCharacterData OnSuccessGetCharacterData;
-    FDelegateOnSuccessGetCharacterInternalData OnSuccessGetCharacterInternalData;
-    FDelegateOnSuccessGetCharacterReadOnlyData OnSuccessGetCharacterReadOnlyData;
-    FDelegateOnSuccessUpdateCharacterData OnSuccessUpdateCharacterData;
-    FDelegateOnSuccessUpdateCharacterInternalData OnSuccessUpdateCharacterInternalData;
-    FDelegateOnSuccessUpdateCharacterReadOnlyData OnSuccessUpdateCharacterReadOnlyData;
-    FDelegateOnSuccessAddPlayerTag OnSuccessAddPlayerTag;
-    FDelegateOnSuccessGetAllActionGroups OnSuccessGetAllActionGroups;
-    FDelegateOnSuccessGetAllSegments OnSuccessGetAllSegments;
-    FDelegateOnSuccessGetPlayerSegments OnSuccessGetPlayerSegments;
-    FDelegateOnSuccessGetPlayersInSegment OnSuccessGetPlayersInSegment;
-    FDelegateOnSuccessGetPlayerTags OnSuccessGetPlayerTags;
-    FDelegateOnSuccessRemovePlayerTag OnSuccessRemovePlayerTag;
-    FDelegateOnSuccessAwardSteamAchievement OnSuccessAwardSteamAchievement;
+
+    /** The success callback of the one call this manager makes. Its helper executes it as the call's FDelegateOnSuccess type */
+    FScriptDelegate OnSuccess;
 
 private:
-    /** Internal bind function for the IHTTPRequest::OnProcessRequestCompleted() event */
-    void OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful);
+    /** Internal bind function, called by the request dispatcher once the response has been parsed on a worker thread */
+    void OnProcessRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed);
 
+    /** Builds the http request for this call. The dispatcher serializes the body */
+    TSharedRef<IHttpRequest> BuildHttpRequest();
 protected:
     /** Internal request data stored as JSON */
     UPROPERTY()
@@ -1664,4 +1570,7 @@ protected:
 
     /** Mapping of header section to values. Used to generate final header string for request */
     TMap<FString, FString> RequestHeaders;
+
+    /** The condensed UTF-8 body the factory streamed the request into. Kept, with its capacity, while the manager is pooled */
+    TArray<uint8> RequestBody;
 };
@@ -21,6 +21,18 @@ namespace UnrealBuildTool.Rules
                     "OnlineSubsystemUtils"
                 }
             );
+
+            // The stand-in server listens on a local socket
+            PrivateDependencyModuleNames.AddRange(
+                new string[]
+                {
+                    "Sockets",
+                    "Networking"
+                }
+            );
+
+            // Request and response bodies are gzipped with zlib directly, so they can be streamed
+            AddEngineThirdPartyPrivateStaticDependencies(Target, "zlib");
         }
     }
 }
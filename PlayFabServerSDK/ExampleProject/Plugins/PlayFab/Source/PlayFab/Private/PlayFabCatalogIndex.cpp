@@ -0,0 +1,237 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab catalog index.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabCatalogIndex.h"
+
+/** The current index of each catalog version. Only the game thread touches this */
+static TMap<FString, TSharedPtr<FPlayFabCatalogIndex, ESPMode::ThreadSafe>> GCatalogIndexes;
+
+static uint32 HashKey(const ANSICHAR* Key, int32 Length)
+{
+    return FCrc::MemCrc32(Key, Length);
+}
+
+/** Walk an open addressed table from the key's home slot until a row matches or an empty slot ends the chain */
+template<typename MatchesRow>
+static int32 ProbeSlots(const TArray<int32>& Slots, uint32 Hash, MatchesRow Matches)
+{
+    if (Slots.Num() == 0)
+    {
+        return INDEX_NONE;
+    }
+
+    const uint32 Mask = Slots.Num() - 1;
+    for (uint32 Slot = Hash & Mask; ; Slot = (Slot + 1) & Mask)
+    {
+        const int32 Row = Slots[Slot];
+        if (Row == INDEX_NONE || Matches(Row))
+        {
+            return Row;
+        }
+    }
+}
+
+template<typename KeyOfRow>
+void FPlayFabCatalogIndex::BuildSlots(TArray<int32>& OutSlots, int32 RowCount, const FPlayFabCatalogSnapshot& Snapshot, KeyOfRow GetKey)
+{
+    // At most half full, so chains stay short and probing always finds an empty slot
+    OutSlots.Init(INDEX_NONE, RowCount > 0 ? FMath::RoundUpToPowerOfTwo(RowCount * 2) : 0);
+    const uint32 Mask = OutSlots.Num() - 1;
+    for (int32 Row = 0; Row < RowCount; ++Row)
+    {
+        const FPlayFabSnapshotString& Key = GetKey(Row);
+        uint32 Slot = HashKey(Snapshot.GetChars(Key), Key.Length) & Mask;
+        while (OutSlots[Slot] != INDEX_NONE)
+        {
+            Slot = (Slot + 1) & Mask;
+        }
+        OutSlots[Slot] = Row;
+    }
+}
+
+TSharedPtr<FPlayFabCatalogIndex, ESPMode::ThreadSafe> FPlayFabCatalogIndex::Create(TArray<uint8>&& SnapshotData)
+{
+    TSharedPtr<FPlayFabCatalogIndex, ESPMode::ThreadSafe> Index = MakeShareable(new FPlayFabCatalogIndex());
+    FPlayFabCatalogSnapshot& Snapshot = Index->Snapshot;
+    if (!Snapshot.Load(MoveTemp(SnapshotData)) || Snapshot.GetKind() != FPlayFabCatalogSnapshot::EKind::Catalog)
+    {
+        return nullptr;
+    }
+
+    const int32 ItemCount = Snapshot.Num();
+    BuildSlots(Index->ItemSlots, ItemCount, Snapshot, [&Snapshot](int32 Row) -> const FPlayFabSnapshotString& { return Snapshot.GetItem(Row).ItemId; });
+
+    // Group items by class and by tag, in catalog order, then lay every group out in one members array
+    TMap<FString, int32> ClassByName;
+    TMap<FString, int32> TagByName;
+    TArray<TArray<int32>> ClassItems;
+    TArray<TArray<int32>> TagItems;
+    auto AddToGroup = [&Snapshot](TMap<FString, int32>& ByName, TArray<FGroup>& Groups, TArray<TArray<int32>>& GroupItems, const FPlayFabSnapshotString& Key, int32 ItemIndex)
+    {
+        if (Key.Length == 0)
+        {
+            return;
+        }
+
+        const FString Name = Snapshot.ToString(Key);
+        int32* GroupIndex = ByName.Find(Name);
+        if (GroupIndex == nullptr)
+        {
+            GroupIndex = &ByName.Add(Name, Groups.Num());
+            FGroup Group;
+            Group.Key = Key;
+            Groups.Add(Group);
+            GroupItems.AddDefaulted();
+        }
+        GroupItems[*GroupIndex].Add(ItemIndex);
+    };
+
+    TMap<FString, int32> CurrencyByCode;
+    for (int32 ItemIndex = 0; ItemIndex < ItemCount; ++ItemIndex)
+    {
+        const FPlayFabSnapshotItem& Item = Snapshot.GetItem(ItemIndex);
+        AddToGroup(ClassByName, Index->ClassGroups, ClassItems, Item.ItemClass, ItemIndex);
+
+        const FPlayFabSnapshotString* Tags = Snapshot.GetTags(Item);
+        for (uint32 TagIndex = 0; TagIndex < Item.TagCount; ++TagIndex)
+        {
+            AddToGroup(TagByName, Index->TagGroups, TagItems, Tags[TagIndex], ItemIndex);
+        }
+
+        const FPlayFabSnapshotPrice* Prices = Snapshot.GetPrices(Item);
+        for (uint32 PriceIndex = 0; PriceIndex < Item.PriceCount; ++PriceIndex)
+        {
+            const FString Code = Snapshot.ToString(Prices[PriceIndex].Currency);
+            int32* CurrencyIndex = CurrencyByCode.Find(Code);
+            if (CurrencyIndex == nullptr)
+            {
+                CurrencyIndex = &CurrencyByCode.Add(Code, Index->Currencies.Num());
+                FCurrency& Currency = Index->Currencies[Index->Currencies.AddDefaulted()];
+                Currency.Code = Code;
+                Currency.Prices.Init(NoPrice, ItemCount);
+            }
+            Index->Currencies[*CurrencyIndex].Prices[ItemIndex] = Prices[PriceIndex].Amount;
+        }
+    }
+
+    auto FlattenGroups = [&Index](TArray<FGroup>& Groups, const TArray<TArray<int32>>& GroupItems)
+    {
+        for (int32 GroupIndex = 0; GroupIndex < Groups.Num(); ++GroupIndex)
+        {
+            Groups[GroupIndex].First = Index->GroupMembers.Num();
+            Groups[GroupIndex].Count = GroupItems[GroupIndex].Num();
+            Index->GroupMembers.Append(GroupItems[GroupIndex]);
+        }
+    };
+    FlattenGroups(Index->ClassGroups, ClassItems);
+    FlattenGroups(Index->TagGroups, TagItems);
+
+    const TArray<FGroup>& ClassGroups = Index->ClassGroups;
+    const TArray<FGroup>& TagGroups = Index->TagGroups;
+    BuildSlots(Index->ClassSlots, ClassGroups.Num(), Snapshot, [&ClassGroups](int32 Row) -> const FPlayFabSnapshotString& { return ClassGroups[Row].Key; });
+    BuildSlots(Index->TagSlots, TagGroups.Num(), Snapshot, [&TagGroups](int32 Row) -> const FPlayFabSnapshotString& { return TagGroups[Row].Key; });
+    return Index;
+}
+
+void FPlayFabCatalogIndex::Register(const TSharedRef<FPlayFabCatalogIndex, ESPMode::ThreadSafe>& Index)
+{
+    check(IsInGameThread());
+    GCatalogIndexes.Add(Index->Snapshot.GetCatalogVersion(), Index);
+}
+
+TSharedPtr<const FPlayFabCatalogIndex, ESPMode::ThreadSafe> FPlayFabCatalogIndex::Find(const FString& CatalogVersion)
+{
+    check(IsInGameThread());
+    return GCatalogIndexes.FindRef(CatalogVersion);
+}
+
+bool FPlayFabCatalogIndex::LoadSnapshot(const FString& CatalogVersion)
+{
+    TArray<uint8> Data;
+    if (!FFileHelper::LoadFileToArray(Data, *FPlayFabCatalogSnapshot::GetPath(FPlayFabCatalogSnapshot::EKind::Catalog, CatalogVersion, FString()), FILEREAD_Silent))
+    {
+        return false;
+    }
+
+    // The file name is a hash, so check it really is this version
+    TSharedPtr<FPlayFabCatalogIndex, ESPMode::ThreadSafe> Index = Create(MoveTemp(Data));
+    if (!Index.IsValid() || Index->Snapshot.GetCatalogVersion() != CatalogVersion)
+    {
+        return false;
+    }
+
+    Register(Index.ToSharedRef());
+    return true;
+}
+
+void FPlayFabCatalogIndex::Shutdown()
+{
+    GCatalogIndexes.Empty();
+}
+
+int32 FPlayFabCatalogIndex::FindItem(const FString& ItemId) const
+{
+    FTCHARToUTF8 Utf8(*ItemId, ItemId.Len());
+    return FindItem(Utf8.Get(), Utf8.Length());
+}
+
+int32 FPlayFabCatalogIndex::FindItem(const ANSICHAR* ItemId, int32 Length) const
+{
+    return ProbeSlots(ItemSlots, HashKey(ItemId, Length), [this, ItemId, Length](int32 Row)
+    {
+        return Snapshot.Equals(Snapshot.GetItem(Row).ItemId, ItemId, Length);
+    });
+}
+
+const FPlayFabCatalogIndex::FGroup* FPlayFabCatalogIndex::FindGroup(const TArray<FGroup>& Groups, const TArray<int32>& Slots, const FString& Key) const
+{
+    FTCHARToUTF8 Utf8(*Key, Key.Len());
+    const ANSICHAR* Chars = Utf8.Get();
+    const int32 Length = Utf8.Length();
+    const int32 Row = ProbeSlots(Slots, HashKey(Chars, Length), [this, &Groups, Chars, Length](int32 Candidate)
+    {
+        return Snapshot.Equals(Groups[Candidate].Key, Chars, Length);
+    });
+    return Row != INDEX_NONE ? &Groups[Row] : nullptr;
+}
+
+const int32* FPlayFabCatalogIndex::GetItemsOfClass(const FString& ItemClass, int32& OutCount) const
+{
+    const FGroup* Group = FindGroup(ClassGroups, ClassSlots, ItemClass);
+    OutCount = Group != nullptr ? Group->Count : 0;
+    return Group != nullptr ? GroupMembers.GetData() + Group->First : nullptr;
+}
+
+const int32* FPlayFabCatalogIndex::GetItemsWithTag(const FString& Tag, int32& OutCount) const
+{
+    const FGroup* Group = FindGroup(TagGroups, TagSlots, Tag);
+    OutCount = Group != nullptr ? Group->Count : 0;
+    return Group != nullptr ? GroupMembers.GetData() + Group->First : nullptr;
+}
+
+const uint32* FPlayFabCatalogIndex::GetPrices(const FString& Currency) const
+{
+    // Titles have a handful of currencies, a scan beats hashing
+    for (const FCurrency& Entry : Currencies)
+    {
+        if (Entry.Code.Equals(Currency, ESearchCase::CaseSensitive))
+        {
+            return Entry.Prices.GetData();
+        }
+    }
+    return nullptr;
+}
+
+bool FPlayFabCatalogIndex::GetPrice(int32 ItemIndex, const FString& Currency, uint32& OutPrice) const
+{
+    const uint32* Prices = GetPrices(Currency);
+    if (Prices == nullptr || ItemIndex < 0 || ItemIndex >= Num() || Prices[ItemIndex] == NoPrice)
+    {
+        return false;
+    }
+
+    OutPrice = Prices[ItemIndex];
+    return true;
+}
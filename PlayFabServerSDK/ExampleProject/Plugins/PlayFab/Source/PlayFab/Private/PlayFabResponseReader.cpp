@@ -0,0 +1,126 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab response reader.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabResponseReader.h"
+#include "PlayFabCompression.h"
+#include "PlayFabMetrics.h"
+#include "PlayFabJsonReader.h"
+#include "Misc/ThreadSingleton.h"
+
+DECLARE_CYCLE_STAT(TEXT("Parse Response"), STAT_PlayFabParse, STATGROUP_PlayFab);
+
+/** Buffers reused by every response decoded on a thread */
+class FPlayFabResponseBuffers : public TThreadSingleton<FPlayFabResponseBuffers>
+{
+public:
+    TArray<uint8> Inflated;
+};
+
+const uint8* FPlayFabResponseReader::GetBody(const TArray<uint8>& Content, int32& OutSize)
+{
+    if (!FPlayFabCompression::IsCompressed(Content.GetData(), Content.Num()))
+    {
+        OutSize = Content.Num();
+        return Content.GetData();
+    }
+
+    TArray<uint8>& Inflated = FPlayFabResponseBuffers::Get().Inflated;
+    if (!FPlayFabCompression::Inflate(Content.GetData(), Content.Num(), Inflated))
+    {
+        UE_LOG(LogPlayFab, Warning, TEXT("Failed to decompress a %d byte response"), Content.Num());
+        OutSize = 0;
+        return nullptr;
+    }
+
+    OutSize = Inflated.Num();
+    return Inflated.GetData();
+}
+
+bool FPlayFabResponseReader::Deserialize(const TArray<uint8>& Content, TSharedPtr<FJsonObject>& OutObject)
+{
+    int32 BodySize = 0;
+    const uint8* Body = GetBody(Content, BodySize);
+    return Deserialize(Body, BodySize, OutObject);
+}
+
+bool FPlayFabResponseReader::Deserialize(const uint8* Body, int32 BodySize, TSharedPtr<FJsonObject>& OutObject)
+{
+    // Parse the UTF-8 in place. Only string values are widened, as the tree holds them as FStrings
+    FPlayFabJsonReader Reader(Body, BodySize);
+    if (!Reader.ReadJsonObject(OutObject) || !Reader.IsAtEnd())
+    {
+        OutObject.Reset();
+        return false;
+    }
+    return true;
+}
+
+/** True if Body is a well formed json object whose code is 200, checked without building anything */
+static bool IsWellFormedSuccess(const uint8* Body, int32 BodySize)
+{
+    FPlayFabJsonReader Reader(Body, BodySize);
+    if (!Reader.EnterObject())
+    {
+        return false;
+    }
+
+    int32 Code = 0;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        if (Field == FPlayFabJsonReader::Hash("code"))
+        {
+            Reader.ReadInt(Code);
+        }
+        else
+        {
+            Reader.Skip();
+        }
+    }
+    return Code == 200 && Reader.IsAtEnd();
+}
+
+void FPlayFabResponseReader::Decode(const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe>& SharedContent, FPlayFabParsedResponse& OutParsed, bool bBuildJson)
+{
+    SCOPE_CYCLE_COUNTER(STAT_PlayFabParse);
+
+    const double StartTime = FPlatformTime::Seconds();
+    const TArray<uint8>& Content = *SharedContent;
+
+    // The body outlives this call, so a compressed one is inflated into its own buffer and moved into the result
+    // rather than through the reused thread buffer and copied out of it
+    TArray<uint8> Inflated;
+    const bool bCompressed = FPlayFabCompression::IsCompressed(Content.GetData(), Content.Num());
+    if (bCompressed && !FPlayFabCompression::Inflate(Content.GetData(), Content.Num(), Inflated))
+    {
+        UE_LOG(LogPlayFab, Warning, TEXT("Failed to decompress a %d byte response"), Content.Num());
+        Inflated.Reset();
+    }
+    const TArray<uint8>& Body = bCompressed ? Inflated : Content;
+    const double InflatedTime = FPlatformTime::Seconds();
+
+    // Errors and malformed bodies always get the tree, since their error block is read from it
+    const bool bSkipTree = !bBuildJson && IsWellFormedSuccess(Body.GetData(), Body.Num());
+    OutParsed.bValidJson = bSkipTree || Deserialize(Body.GetData(), Body.Num(), OutParsed.Json);
+    if (!OutParsed.bValidJson)
+    {
+        OutParsed.Json.Reset();
+    }
+    else if (bCompressed)
+    {
+        OutParsed.Body = MakeShareable(new TArray<uint8>(MoveTemp(Inflated)));
+    }
+    else
+    {
+        OutParsed.Body = SharedContent;
+    }
+    if (!bSkipTree)
+    {
+        OutParsed.Error.decodeError(OutParsed.Json.Get());
+    }
+
+    OutParsed.DecodeMicros = (int64)((InflatedTime - StartTime) * 1000000.0);
+    OutParsed.ParseMicros = (int64)((FPlatformTime::Seconds() - InflatedTime) * 1000000.0);
+}
@@ -0,0 +1,559 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab stand-in server.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabStandInServer.h"
+#include "PlayFabErrorCodes.h"
+#include "Sockets.h"
+#include "SocketSubsystem.h"
+#include "Common/TcpSocketBuilder.h"
+#include "Interfaces/IPv4/IPv4Endpoint.h"
+
+FPlayFabStandInServer* FPlayFabStandInServer::Instance = nullptr;
+FCriticalSection FPlayFabStandInServer::StatsLock;
+
+/** Stop serving rather than grow without bound when a client sends garbage */
+static const int32 MaxRequestBytes = 16 * 1024 * 1024;
+
+static void StandInCommand(const TArray<FString>& Args)
+{
+    if (Args.Num() > 0 && Args[0] == TEXT("off"))
+    {
+        FPlayFabStandInServer::Shutdown();
+        return;
+    }
+
+    const int32 Port = Args.Num() > 0 ? FCString::Atoi(*Args[0]) : 7780;
+    FPlayFabStandInServer::Start(Port, Args.Num() > 1 ? Args[1] : FString());
+}
+
+static FAutoConsoleCommand StandInConsoleCommand(
+    TEXT("PlayFab.StandIn"),
+    TEXT("Serve PlayFab calls from a local stand-in server and point the SDK at it. Arguments: [Port, 7780 by default] [ScriptFile], or 'off'"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&StandInCommand));
+
+/** The name a live server would send for ErrorCode, from the shared error code table */
+static const TCHAR* GetErrorName(int32 ErrorCode)
+{
+    return FPlayFabErrorCodes::IsKnown(ErrorCode) ? FPlayFabErrorCodes::GetName(ErrorCode) : TEXT("ScriptedError");
+}
+
+static const ANSICHAR* GetStatusText(int32 HttpStatus)
+{
+    switch (HttpStatus)
+    {
+    case 200: return "OK";
+    case 400: return "Bad Request";
+    case 401: return "Unauthorized";
+    case 404: return "Not Found";
+    case 429: return "Too Many Requests";
+    case 500: return "Internal Server Error";
+    case 503: return "Service Unavailable";
+    default: return "Error";
+    }
+}
+
+float FPlayFabStandInLatency::Sample(FRandomStream& Random) const
+{
+    float Milliseconds = MeanMs;
+    switch (Shape)
+    {
+    case EShape::Uniform:
+        Milliseconds = MeanMs + SpreadMs * (2.0f * Random.GetFraction() - 1.0f);
+        break;
+    case EShape::Normal:
+    {
+        // Box-Muller
+        const float U1 = FMath::Max(Random.GetFraction(), KINDA_SMALL_NUMBER);
+        const float U2 = Random.GetFraction();
+        Milliseconds = MeanMs + SpreadMs * FMath::Sqrt(-2.0f * FMath::Loge(U1)) * FMath::Cos(2.0f * PI * U2);
+        break;
+    }
+    case EShape::Exponential:
+        Milliseconds = -MeanMs * FMath::Loge(FMath::Max(1.0f - Random.GetFraction(), KINDA_SMALL_NUMBER));
+        break;
+    default:
+        break;
+    }
+    return FMath::Max(Milliseconds, 0.0f) / 1000.0f;
+}
+
+bool FPlayFabStandInServer::Start(int32 Port, const FString& ScriptFile)
+{
+    check(IsInGameThread());
+    Shutdown();
+
+    FPlayFabStandInRoute DefaultRule;
+    TMap<FString, FPlayFabStandInRoute> Rules;
+    FString FixtureDirectory = FPaths::GameSavedDir() / TEXT("PlayFab/Fixtures");
+    int32 Seed = 0;
+    if (!ScriptFile.IsEmpty() && !LoadScript(ScriptFile, DefaultRule, Rules, FixtureDirectory, Seed))
+    {
+        UE_LOG(LogPlayFab, Error, TEXT("Failed to read stand-in server script %s"), *ScriptFile);
+        return false;
+    }
+
+    FSocket* Listener = FTcpSocketBuilder(TEXT("PlayFabStandIn"))
+        .AsReusable()
+        .AsNonBlocking()
+        .BoundToEndpoint(FIPv4Endpoint(FIPv4Address(127, 0, 0, 1), Port))
+        .Listening(256)
+        .Build();
+    if (Listener == nullptr)
+    {
+        UE_LOG(LogPlayFab, Error, TEXT("Stand-in server could not listen on port %d"), Port);
+        return false;
+    }
+
+    Instance = new FPlayFabStandInServer(Listener, MoveTemp(DefaultRule), MoveTemp(Rules), FixtureDirectory, Seed);
+    Instance->PreviousServerUrl = IPlayFab::Get().getServerUrl();
+    IPlayFab::Get().setServerUrl(FString::Printf(TEXT("http://127.0.0.1:%d"), Port));
+    Instance->Thread = FRunnableThread::Create(Instance, TEXT("PlayFabStandInServer"), 0, TPri_Normal);
+
+    UE_LOG(LogPlayFab, Log, TEXT("Stand-in server listening on port %d"), Port);
+    return true;
+}
+
+void FPlayFabStandInServer::Shutdown()
+{
+    if (Instance == nullptr)
+    {
+        return;
+    }
+
+    // Kill() stops the loop and waits for it, after which nothing else touches the server
+    Instance->Thread->Kill(true);
+    delete Instance->Thread;
+    IPlayFab::Get().setServerUrl(Instance->PreviousServerUrl);
+
+    FScopeLock Lock(&StatsLock);
+    delete Instance;
+    Instance = nullptr;
+}
+
+FPlayFabStandInStats FPlayFabStandInServer::GetStats()
+{
+    FScopeLock Lock(&StatsLock);
+    return Instance != nullptr ? Instance->Stats : FPlayFabStandInStats();
+}
+
+FPlayFabStandInServer::FPlayFabStandInServer(FSocket* InListener, FPlayFabStandInRoute&& InDefaultRule, TMap<FString, FPlayFabStandInRoute>&& InRules, const FString& InFixtureDirectory, int32 Seed)
+    : Listener(InListener)
+    , Thread(nullptr)
+    , DefaultRule(MoveTemp(InDefaultRule))
+    , Rules(MoveTemp(InRules))
+    , FixtureDirectory(InFixtureDirectory)
+    , Random(Seed)
+    , NextPlayerId(0)
+{
+}
+
+FPlayFabStandInServer::~FPlayFabStandInServer()
+{
+    ISocketSubsystem* Sockets = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+    for (FConnection& Connection : Connections)
+    {
+        Connection.Socket->Close();
+        Sockets->DestroySocket(Connection.Socket);
+    }
+    Listener->Close();
+    Sockets->DestroySocket(Listener);
+}
+
+bool FPlayFabStandInServer::LoadScript(const FString& ScriptFile, FPlayFabStandInRoute& OutDefaultRule, TMap<FString, FPlayFabStandInRoute>& OutRules, FString& OutFixtureDirectory, int32& OutSeed)
+{
+    FString Text;
+    TSharedPtr<FJsonObject> Script;
+    if (!FFileHelper::LoadFileToString(Text, *ScriptFile) || !FJsonSerializer::Deserialize(TJsonReaderFactory<>::Create(Text), Script) || !Script.IsValid())
+    {
+        return false;
+    }
+
+    Script->TryGetNumberField(TEXT("Seed"), OutSeed);
+    Script->TryGetStringField(TEXT("Fixtures"), OutFixtureDirectory);
+
+    const TSharedPtr<FJsonObject>* Default = nullptr;
+    if (Script->TryGetObjectField(TEXT("Default"), Default))
+    {
+        ReadRule(**Default, OutDefaultRule);
+    }
+
+    // Each route starts from the default rule, so a script only spells out what differs
+    const TSharedPtr<FJsonObject>* Routes = nullptr;
+    if (Script->TryGetObjectField(TEXT("Routes"), Routes))
+    {
+        for (const auto& Route : (*Routes)->Values)
+        {
+            const TSharedPtr<FJsonObject>& RuleJson = Route.Value->AsObject();
+            if (RuleJson.IsValid())
+            {
+                FPlayFabStandInRoute& Rule = OutRules.Add(Route.Key, OutDefaultRule);
+                ReadRule(*RuleJson, Rule);
+            }
+        }
+    }
+    return true;
+}
+
+void FPlayFabStandInServer::ReadRule(const FJsonObject& Json, FPlayFabStandInRoute& OutRule)
+{
+    const TSharedPtr<FJsonObject>* Latency = nullptr;
+    if (Json.TryGetObjectField(TEXT("Latency"), Latency))
+    {
+        FString Shape;
+        if ((*Latency)->TryGetStringField(TEXT("Shape"), Shape))
+        {
+            OutRule.Latency.Shape =
+                Shape == TEXT("Uniform") ? FPlayFabStandInLatency::EShape::Uniform :
+                Shape == TEXT("Normal") ? FPlayFabStandInLatency::EShape::Normal :
+                Shape == TEXT("Exponential") ? FPlayFabStandInLatency::EShape::Exponential :
+                FPlayFabStandInLatency::EShape::Constant;
+        }
+        double Value = 0.0;
+        if ((*Latency)->TryGetNumberField(TEXT("Mean"), Value))
+        {
+            OutRule.Latency.MeanMs = (float)Value;
+        }
+        if ((*Latency)->TryGetNumberField(TEXT("Spread"), Value))
+        {
+            OutRule.Latency.SpreadMs = (float)Value;
+        }
+    }
+
+    double Value = 0.0;
+    if (Json.TryGetNumberField(TEXT("ErrorRate"), Value))
+    {
+        OutRule.ErrorRate = (float)Value;
+    }
+    Json.TryGetNumberField(TEXT("ErrorCode"), OutRule.ErrorCode);
+    Json.TryGetNumberField(TEXT("ErrorHttpStatus"), OutRule.ErrorHttpStatus);
+    if (Json.TryGetNumberField(TEXT("DropRate"), Value))
+    {
+        OutRule.DropRate = (float)Value;
+    }
+    if (Json.TryGetNumberField(TEXT("ThrottlePerSecond"), Value))
+    {
+        OutRule.ThrottlePerSecond = (float)Value;
+    }
+
+    const TArray<TSharedPtr<FJsonValue>>* Responses = nullptr;
+    if (Json.TryGetArrayField(TEXT("Responses"), Responses))
+    {
+        OutRule.Responses.Reset();
+        for (const TSharedPtr<FJsonValue>& Response : *Responses)
+        {
+            const TSharedPtr<FJsonObject>& Data = Response->AsObject();
+            if (Data.IsValid())
+            {
+                FString Condensed;
+                FJsonSerializer::Serialize(Data.ToSharedRef(), TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Condensed));
+                OutRule.Responses.Add(Condensed);
+            }
+        }
+    }
+}
+
+uint32 FPlayFabStandInServer::Run()
+{
+    while (!bStopping)
+    {
+        AcceptConnections();
+
+        const double Now = FPlatformTime::Seconds();
+        bool bIdle = true;
+        for (int32 Index = Connections.Num() - 1; Index >= 0; --Index)
+        {
+            FConnection& Connection = Connections[Index];
+            bool bReceived = false;
+            bool bOpen = ReceiveRequests(Connection, bReceived);
+            bIdle &= !bReceived;
+
+            const bool bReady = (Connection.Answer.Num() > 0 || Connection.bCloseWhenReady) && Now >= Connection.ReadyTime;
+            if (bOpen && bReady)
+            {
+                bIdle = false;
+                bOpen = SendAnswer(Connection) && !(Connection.bCloseWhenReady && Connection.Answer.Num() == 0);
+            }
+
+            if (!bOpen)
+            {
+                ISocketSubsystem* Sockets = ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM);
+                Connection.Socket->Close();
+                Sockets->DestroySocket(Connection.Socket);
+                Connections.RemoveAtSwap(Index);
+            }
+        }
+
+        if (bIdle)
+        {
+            FPlatformProcess::Sleep(0.001f);
+        }
+    }
+    return 0;
+}
+
+void FPlayFabStandInServer::AcceptConnections()
+{
+    bool bPending = false;
+    while (Listener->HasPendingConnection(bPending) && bPending)
+    {
+        FSocket* Socket = Listener->Accept(TEXT("PlayFabStandInConnection"));
+        if (Socket == nullptr)
+        {
+            return;
+        }
+
+        Socket->SetNonBlocking(true);
+        Socket->SetNoDelay(true);
+        FConnection& Connection = Connections[Connections.AddDefaulted()];
+        Connection.Socket = Socket;
+
+        FScopeLock Lock(&StatsLock);
+        ++Stats.Connections;
+    }
+}
+
+bool FPlayFabStandInServer::ReceiveRequests(FConnection& Connection, bool& bOutReceived)
+{
+    uint8 Buffer[16 * 1024];
+    for (;;)
+    {
+        int32 BytesRead = 0;
+        if (!Connection.Socket->Recv(Buffer, sizeof(Buffer), BytesRead))
+        {
+            // Closed by the client, or failed
+            return false;
+        }
+        if (BytesRead == 0)
+        {
+            break;
+        }
+        Connection.Received.Append(Buffer, BytesRead);
+        bOutReceived = true;
+    }
+
+    // One request at a time per connection, the next waits until this one is answered
+    while (Connection.Answer.Num() == 0 && !Connection.bCloseWhenReady)
+    {
+        FRequest Request;
+        bool bMalformed = false;
+        if (!ParseRequest(Connection.Received, Request, bMalformed))
+        {
+            return !bMalformed && Connection.Received.Num() <= MaxRequestBytes;
+        }
+        Answer(Connection, Request);
+    }
+    return true;
+}
+
+bool FPlayFabStandInServer::SendAnswer(FConnection& Connection)
+{
+    if (Connection.Answer.Num() == 0)
+    {
+        return true;
+    }
+
+    int32 BytesSent = 0;
+    if (!Connection.Socket->Send(Connection.Answer.GetData(), Connection.Answer.Num(), BytesSent))
+    {
+        return ISocketSubsystem::Get(PLATFORM_SOCKETSUBSYSTEM)->GetLastErrorCode() == SE_EWOULDBLOCK;
+    }
+
+    Connection.Answer.RemoveAt(0, BytesSent, false);
+    return true;
+}
+
+bool FPlayFabStandInServer::ParseRequest(TArray<uint8>& Received, FRequest& OutRequest, bool& bOutMalformed)
+{
+    // Headers end at the first blank line
+    int32 HeaderEnd = INDEX_NONE;
+    for (int32 Index = 0; Index + 3 < Received.Num(); ++Index)
+    {
+        if (Received[Index] == '\r' && Received[Index + 1] == '\n' && Received[Index + 2] == '\r' && Received[Index + 3] == '\n')
+        {
+            HeaderEnd = Index;
+            break;
+        }
+    }
+    if (HeaderEnd == INDEX_NONE)
+    {
+        return false;
+    }
+
+    const FString Headers(HeaderEnd, (const ANSICHAR*)Received.GetData());
+    TArray<FString> Lines;
+    Headers.ParseIntoArray(Lines, TEXT("\r\n"));
+
+    TArray<FString> RequestLine;
+    if (Lines.Num() == 0 || Lines[0].ParseIntoArrayWS(RequestLine) < 2)
+    {
+        bOutMalformed = true;
+        return false;
+    }
+
+    int32 ContentLength = 0;
+    for (int32 LineIndex = 1; LineIndex < Lines.Num(); ++LineIndex)
+    {
+        FString Name;
+        FString Value;
+        if (!Lines[LineIndex].Split(TEXT(":"), &Name, &Value))
+        {
+            continue;
+        }
+        Value = Value.Trim();
+        if (Name.Equals(TEXT("Content-Length"), ESearchCase::IgnoreCase))
+        {
+            ContentLength = FCString::Atoi(*Value);
+        }
+        else if (Name.Equals(TEXT("X-Authentication"), ESearchCase::IgnoreCase))
+        {
+            OutRequest.Authentication = Value;
+        }
+        else if (Name.Equals(TEXT("X-SecretKey"), ESearchCase::IgnoreCase))
+        {
+            OutRequest.SecretKey = Value;
+        }
+    }
+
+    const int32 BodyStart = HeaderEnd + 4;
+    if (ContentLength < 0 || BodyStart + ContentLength > Received.Num())
+    {
+        bOutMalformed = ContentLength < 0;
+        return false;
+    }
+
+    // The reader inflates the body if the SDK gzipped it
+    OutRequest.Path = RequestLine[1];
+    TArray<uint8> Body;
+    Body.Append(Received.GetData() + BodyStart, ContentLength);
+    FPlayFabResponseReader::Deserialize(Body, OutRequest.Body);
+
+    Received.RemoveAt(0, BodyStart + ContentLength, false);
+    return true;
+}
+
+void FPlayFabStandInServer::Answer(FConnection& Connection, const FRequest& Request)
+{
+    const double Now = FPlatformTime::Seconds();
+    const FPlayFabStandInRoute* Found = Rules.Find(Request.Path);
+    const FPlayFabStandInRoute& Rule = Found != nullptr ? *Found : DefaultRule;
+    Connection.ReadyTime = Now + Rule.Latency.Sample(Random);
+
+    FScopeLock Lock(&StatsLock);
+    ++Stats.Requests;
+
+    FString Api;
+    Request.Path.Split(TEXT("/"), nullptr, &Api, ESearchCase::CaseSensitive, ESearchDir::FromEnd);
+    const bool bClientRoute = Request.Path.StartsWith(TEXT("/Client/"));
+    const bool bKnownRoute = bClientRoute || Request.Path.StartsWith(TEXT("/Server/")) || Request.Path.StartsWith(TEXT("/Admin/")) || Request.Path.StartsWith(TEXT("/Matchmaker/"));
+    const bool bLogin = bClientRoute && (Api.StartsWith(TEXT("Login")) || Api.StartsWith(TEXT("Register")));
+
+    if (!bKnownRoute)
+    {
+        ++Stats.Errors;
+        WriteAnswer(404, MakeError(404, 1071, TEXT("APINotFound"), TEXT("Unknown route")), Connection.Answer);
+    }
+    else if (Random.GetFraction() < Rule.DropRate)
+    {
+        ++Stats.Dropped;
+        Connection.bCloseWhenReady = true;
+    }
+    else if (IsThrottled(Request.Path, Rule, Now))
+    {
+        ++Stats.Throttled;
+        WriteAnswer(429, MakeError(429, 1199, TEXT("APIClientRequestRateLimitExceeded"), TEXT("Stand-in rate limit exceeded")), Connection.Answer);
+    }
+    else if (Random.GetFraction() < Rule.ErrorRate)
+    {
+        ++Stats.Errors;
+        WriteAnswer(Rule.ErrorHttpStatus, MakeError(Rule.ErrorHttpStatus, Rule.ErrorCode, GetErrorName(Rule.ErrorCode), TEXT("Injected by the stand-in server")), Connection.Answer);
+    }
+    else if (bClientRoute ? (!bLogin && Request.Authentication.IsEmpty()) : Request.SecretKey.IsEmpty())
+    {
+        ++Stats.Errors;
+        WriteAnswer(401, MakeError(401, 1074, TEXT("NotAuthenticated"), TEXT("This API method requires authentication")), Connection.Answer);
+    }
+    else
+    {
+        ++Stats.Succeeded;
+        WriteAnswer(200, bLogin && Rule.Responses.Num() == 0 ? TEXT("{\"code\":200,\"status\":\"OK\",\"data\":") + MakeLoginData(Request) + TEXT("}") : GetResponseBody(Request, Rule), Connection.Answer);
+    }
+}
+
+FString FPlayFabStandInServer::GetResponseBody(const FRequest& Request, const FPlayFabStandInRoute& Rule)
+{
+    if (Rule.Responses.Num() > 0)
+    {
+        int32& Next = ResponseIndex.FindOrAdd(Request.Path);
+        const FString& Data = Rule.Responses[FMath::Min(Next, Rule.Responses.Num() - 1)];
+        Next = FMath::Min(Next + 1, Rule.Responses.Num());
+        return TEXT("{\"code\":200,\"status\":\"OK\",\"data\":") + Data + TEXT("}");
+    }
+
+    // Recorded fixtures are whole response bodies, read once per route
+    FString* Fixture = FixtureCache.Find(Request.Path);
+    if (Fixture == nullptr)
+    {
+        Fixture = &FixtureCache.Add(Request.Path);
+        FFileHelper::LoadFileToString(*Fixture, *(FixtureDirectory / Request.Path.Mid(1) + TEXT(".json")));
+    }
+    return Fixture->IsEmpty() ? TEXT("{\"code\":200,\"status\":\"OK\",\"data\":{}}") : *Fixture;
+}
+
+FString FPlayFabStandInServer::MakeLoginData(const FRequest& Request)
+{
+    // The same credentials always log in as the same player
+    static const TCHAR* CredentialFields[] = { TEXT("CustomId"), TEXT("Username"), TEXT("Email"), TEXT("AndroidDeviceId"), TEXT("IOSDeviceId"), TEXT("ServerAuthCode") };
+    FString Credential;
+    for (const TCHAR* Field : CredentialFields)
+    {
+        if (Request.Body.IsValid() && Request.Body->TryGetStringField(Field, Credential) && !Credential.IsEmpty())
+        {
+            break;
+        }
+    }
+    if (Credential.IsEmpty())
+    {
+        Credential = FString::Printf(TEXT("Anonymous%d"), NextPlayerId++);
+    }
+
+    const FString PlayFabId = FString::Printf(TEXT("%08X%08X"), FCrc::StrCrc32(*Credential), FCrc::StrCrc32(*Credential, 0x9E3779B9));
+    const FString SessionTicket = PlayFabId + TEXT("-") + FGuid::NewGuid().ToString(EGuidFormats::Digits);
+    return FString::Printf(TEXT("{\"SessionTicket\":\"%s\",\"PlayFabId\":\"%s\",\"NewlyCreated\":false,\"LastLoginTime\":\"%s\"}"),
+        *SessionTicket, *PlayFabId, *FDateTime::UtcNow().ToIso8601());
+}
+
+bool FPlayFabStandInServer::IsThrottled(const FString& Path, const FPlayFabStandInRoute& Rule, double Now)
+{
+    if (Rule.ThrottlePerSecond <= 0.0f)
+    {
+        return false;
+    }
+
+    FThrottle& Throttle = Throttles.FindOrAdd(Path);
+    if (Now - Throttle.WindowStart >= 1.0)
+    {
+        Throttle.WindowStart = Now;
+        Throttle.Count = 0;
+    }
+    return ++Throttle.Count > Rule.ThrottlePerSecond;
+}
+
+void FPlayFabStandInServer::WriteAnswer(int32 HttpStatus, const FString& Json, TArray<uint8>& OutAnswer)
+{
+    FTCHARToUTF8 Body(*Json, Json.Len());
+    const FString Head = FString::Printf(TEXT("HTTP/1.1 %d %s\r\nContent-Type: application/json\r\nContent-Length: %d\r\nConnection: keep-alive\r\n%s\r\n"),
+        HttpStatus, ANSI_TO_TCHAR(GetStatusText(HttpStatus)), Body.Length(), HttpStatus == 429 ? TEXT("Retry-After: 1\r\n") : TEXT(""));
+
+    FTCHARToUTF8 HeadUtf8(*Head, Head.Len());
+    OutAnswer.Reset();
+    OutAnswer.Append((const uint8*)HeadUtf8.Get(), HeadUtf8.Length());
+    OutAnswer.Append((const uint8*)Body.Get(), Body.Length());
+}
+
+FString FPlayFabStandInServer::MakeError(int32 HttpStatus, int32 ErrorCode, const TCHAR* ErrorName, const TCHAR* Message)
+{
+    return FString::Printf(TEXT("{\"code\":%d,\"status\":\"%s\",\"error\":\"%s\",\"errorCode\":%d,\"errorMessage\":\"%s\"}"),
+        HttpStatus, ANSI_TO_TCHAR(GetStatusText(HttpStatus)), ErrorName, ErrorCode, Message);
+}
@@ -0,0 +1,21 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Compression. Gzip helpers for request and response bodies.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+class PLAYFAB_API FPlayFabCompression
+{
+public:
+    /** Gzip Data into OutCompressed. Safe to call from any thread. Returns false if zlib failed */
+    static bool GzipCompress(const TArray<uint8>& Data, TArray<uint8>& OutCompressed);
+
+    /** Returns true if Data starts with a gzip or zlib (deflate) header */
+    static bool IsCompressed(const uint8* Data, int32 Size);
+
+    /**
+     * Inflate a gzip or zlib stream into OutData a chunk at a time. OutData is reset but keeps its allocation, so
+     * callers can reuse one buffer across responses. Returns false if the stream is corrupt or truncated
+     */
+    static bool Inflate(const uint8* Data, int32 Size, TArray<uint8>& OutData);
+};
@@ -0,0 +1,135 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Json Reader. Reads UTF-8 json in place, one token at a time, so the generated
+// decoders can fill a result struct in a single pass over the response body. Field names
+// are hashed as they are read and matched against hashes computed at compile time, and a
+// wide string is only made for the values that end up in FString members. Objects are
+// taken from the tree the worker thread already parsed from the same body, so nothing is
+// parsed twice.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Dom/JsonObject.h"
+#include "PlayFabJsonView.h"
+
+class UPlayFabJsonObject;
+struct FPlayFabBaseModel;
+
+class PLAYFAB_API FPlayFabJsonReader
+{
+public:
+    FPlayFabJsonReader(const uint8* InData, int32 InSize);
+    explicit FPlayFabJsonReader(const TArray<uint8>& InData);
+
+    /** Read a body that may be missing, in which case there is nothing to read */
+    explicit FPlayFabJsonReader(const TArray<uint8>* InData);
+
+    /** 64 bit FNV-1a of a field name, usable as a case label */
+    static constexpr uint64 Hash(const ANSICHAR* Name, uint64 Seed = 14695981039346656037ull)
+    {
+        return *Name == 0 ? Seed : Hash(Name + 1, (Seed ^ (uint64)(uint8)*Name) * 1099511628211ull);
+    }
+
+    /** Step into the "data" object of a response body. Returns false if there is none */
+    bool EnterData();
+
+    /** Step into "data", taking the objects in it from Parsed, the tree already parsed from the same body, if it has one */
+    bool EnterData(const UPlayFabJsonObject* Parsed);
+
+    /** Step into an object value. Returns false if the next value isn't one */
+    bool EnterObject();
+
+    /**
+     * Move to the next field of the object being read and return the hash of its name. Its value must be read
+     * or skipped before the next call. Returns false at the end of the object, or if the json is malformed
+     */
+    bool NextField(uint64& OutNameHash);
+    bool NextField(FString& OutName);
+
+    /** Read the value of a field. A null, or a value of another type, is skipped and leaves Out as it was */
+    void ReadString(FString& Out);
+    void ReadInt(int32& Out);
+    void ReadBool(bool& Out);
+    void ReadNumber(double& Out);
+
+    /**
+     * Read a string value that has no escapes as a pointer into the body, without copying it. Returns false,
+     * having stepped over the value, for anything else
+     */
+    bool ReadRawString(const ANSICHAR*& OutText, int32& OutLength);
+
+    /** Read a string value into one of the generated enums, through its name table. Anything else leaves Out as it was */
+    template <typename EnumType>
+    void ReadEnum(EnumType& Out)
+    {
+        const ANSICHAR* Text = nullptr;
+        int32 Length = 0;
+        if (ReadRawString(Text, Length))
+        {
+            GetEnumValueFromName(Text, Length, Out);
+        }
+    }
+
+    /** Read an array of strings, joined with commas the way the generated models hold them */
+    void ReadStringList(FString& Out);
+
+    /**
+     * Read an object, or an array of objects, into the json views the generated models hold. A field of "data" named
+     * FieldName is viewed in the parsed tree given to EnterData, anything else is parsed into a new tree
+     */
+    void ReadObject(FPlayFabJsonView& Out, const TCHAR* FieldName = nullptr);
+    void ReadObjectArray(TArray<FPlayFabJsonView>& Out, const TCHAR* FieldName = nullptr);
+
+    /** Read the next value, of any type, as a json tree */
+    TSharedPtr<FJsonValue> ReadValue();
+    bool ReadJsonObject(TSharedPtr<FJsonObject>& Out);
+
+    /** Step over the next value without building anything */
+    void Skip();
+
+    /** True once malformed json has been met. Everything read after that is left as it was */
+    bool HasError() const { return bError; }
+
+    /** True if only whitespace is left after what has been read, and none of it was malformed */
+    bool IsAtEnd();
+
+    /** If the body was malformed, log and count that the decoder of ResultName fell back to the json tree */
+    void ReportFallback(const TCHAR* ResultName) const;
+
+    /** Report the fallback, and return the json tree of Response for the tree decoder, parsing it from the body if it was left out */
+    UPlayFabJsonObject* GetFallbackTree(const TCHAR* ResultName, const FPlayFabBaseModel& Response) const;
+
+    /** Number of one pass reads that fell back to the json tree since startup */
+    static int32 GetFallbackCount() { return FallbackCount; }
+
+private:
+    uint8 Peek();
+    bool Consume(uint8 Expected);
+    bool EnterArray();
+    bool NextElement(bool& bFirst);
+    bool NextFieldSeparator();
+    bool ReadName(uint64& OutHash, FString* OutName);
+    bool ReadQuoted(FString* Out);
+    bool ReadNumberToken(double& Out);
+    bool ReadLiteral(const ANSICHAR* Literal, int32 Length);
+    void SkipWhitespace();
+    void Fail() { bError = true; Position = Size; }
+
+    /** True when the value about to be read is a field of "data" that can be viewed in the parsed tree */
+    bool IsInParsedData(const TCHAR* FieldName) const { return FieldName != nullptr && ParsedData.IsValid() && Depth == DataDepth; }
+
+    const uint8* Data;
+    int32 Size;
+    int32 Position;
+    int32 Depth;
+    bool bError;
+
+    /** True between entering an object and reading its first field, the only place a field needs no comma before it */
+    bool bFirstField;
+
+    /** The "data" object of the parsed tree, and the depth its fields are read at */
+    FPlayFabJsonView ParsedData;
+    int32 DataDepth;
+
+    static int32 FallbackCount;
+};
@@ -0,0 +1,65 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Response Cache. Keeps parsed responses of read-only calls to endpoints that have a
+// time to live, so repeating the same read within that time is answered without a round
+// trip or another parse. Entries share one byte budget and the least recently used entry is
+// evicted first. Owned by the request dispatcher and only used on the game thread.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "Interfaces/IHttpResponse.h"
+#include "Dom/JsonObject.h"
+
+class PLAYFAB_API FPlayFabResponseCache
+{
+public:
+    FPlayFabResponseCache();
+
+    /** Cache successful responses of Endpoint, e.g. "/Client/GetTitleData", for Seconds. 0 stops caching it */
+    void SetEndpointTtl(const FString& Endpoint, float Seconds);
+    bool IsCacheable(const FString& Endpoint) const { return EndpointTtls.Contains(Endpoint); }
+
+    /** Total bytes of response bodies kept before evicting */
+    void SetByteBudget(int64 InByteBudget);
+    int64 GetByteBudget() const { return ByteBudget; }
+    int64 GetBytesUsed() const { return BytesUsed; }
+
+    /** Returns the cached response for a call, or false on a miss. Canonical is the call's full fingerprint */
+    bool Find(const FString& Endpoint, uint32 Fingerprint, const TArray<uint8>& Canonical, FHttpResponsePtr& OutResponse, TSharedPtr<FJsonObject>& OutJson, TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe>& OutBody);
+
+    /** Cache the response of a successful call, if its endpoint has a time to live */
+    void Add(const FString& Endpoint, uint32 Fingerprint, const TArray<uint8>& Canonical, FHttpResponsePtr Response, const TSharedPtr<FJsonObject>& Json, const TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe>& Body);
+
+    void Clear();
+
+    int32 GetHitCount() const { return Hits; }
+    int32 GetMissCount() const { return Misses; }
+    int32 GetEvictionCount() const { return Evictions; }
+
+private:
+    struct FEntry
+    {
+        TArray<uint8> Canonical;
+        FHttpResponsePtr Response;
+        TSharedPtr<FJsonObject> Json;
+        TSharedPtr<const TArray<uint8>, ESPMode::ThreadSafe> Body;
+        double ExpiresAt;
+        int64 Bytes;
+        uint64 LastUsed;
+    };
+
+    void Remove(uint32 Fingerprint);
+
+    /** Evict least recently used entries until Bytes more fit in the budget */
+    void MakeRoom(int64 Bytes);
+
+    TMap<FString, float> EndpointTtls;
+    TMap<uint32, FEntry> Entries;
+    int64 ByteBudget;
+    int64 BytesUsed;
+    uint64 UseCounter;
+
+    int32 Hits;
+    int32 Misses;
+    int32 Evictions;
+};
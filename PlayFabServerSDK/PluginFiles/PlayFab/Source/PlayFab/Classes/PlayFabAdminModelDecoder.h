@@ -9,6 +9,7 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "PlayFabEnums.h"
+#include "PlayFabBaseModel.h"
 #include "PlayFabAdminModels.h"
 #include "PlayFabAdminModelDecoder.generated.h"
 
@@ -34,30 +35,67 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Authentication Models")
         static FAdminCreatePlayerSharedSecretResult decodeCreatePlayerSharedSecretResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the CreatePlayerSharedSecretResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminCreatePlayerSharedSecretResult readCreatePlayerSharedSecretResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the DeletePlayerSharedSecretResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Authentication Models")
         static FAdminDeletePlayerSharedSecretResult decodeDeletePlayerSharedSecretResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the DeletePlayerSharedSecretResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminDeletePlayerSharedSecretResult readDeletePlayerSharedSecretResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetPlayerSharedSecretsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Authentication Models")
         static FAdminGetPlayerSharedSecretsResult decodeGetPlayerSharedSecretsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerSharedSecretsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetPlayerSharedSecretsResult readGetPlayerSharedSecretsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerSharedSecretsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerSharedSecretsResultJsonObjects(FAdminGetPlayerSharedSecretsResult& result);
+
     /** Decode the GetPolicyResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Authentication Models")
         static FAdminGetPolicyResponse decodeGetPolicyResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPolicyResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetPolicyResponse readGetPolicyResponseResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPolicyResponse from its views, for a Blueprint that reads them */
+    static void fillGetPolicyResponseJsonObjects(FAdminGetPolicyResponse& result);
+
     /** Decode the SetPlayerSecretResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Authentication Models")
         static FAdminSetPlayerSecretResult decodeSetPlayerSecretResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetPlayerSecretResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminSetPlayerSecretResult readSetPlayerSecretResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdatePlayerSharedSecretResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Authentication Models")
         static FAdminUpdatePlayerSharedSecretResult decodeUpdatePlayerSharedSecretResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdatePlayerSharedSecretResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminUpdatePlayerSharedSecretResult readUpdatePlayerSharedSecretResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdatePolicyResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Authentication Models")
         static FAdminUpdatePolicyResponse decodeUpdatePolicyResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdatePolicyResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminUpdatePolicyResponse readUpdatePolicyResponseResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a UpdatePolicyResponse from its views, for a Blueprint that reads them */
+    static void fillUpdatePolicyResponseJsonObjects(FAdminUpdatePolicyResponse& result);
+
 
 
     ///////////////////////////////////////////////////////
@@ -68,42 +106,100 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Account Management Models")
         static FAdminBanUsersResult decodeBanUsersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the BanUsersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminBanUsersResult readBanUsersResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a BanUsersResult from its views, for a Blueprint that reads them */
+    static void fillBanUsersResultJsonObjects(FAdminBanUsersResult& result);
+
     /** Decode the DeletePlayerResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Account Management Models")
         static FAdminDeletePlayerResult decodeDeletePlayerResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the DeletePlayerResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminDeletePlayerResult readDeletePlayerResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the LookupUserAccountInfoResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Account Management Models")
         static FAdminLookupUserAccountInfoResult decodeLookupUserAccountInfoResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the LookupUserAccountInfoResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminLookupUserAccountInfoResult readLookupUserAccountInfoResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a LookupUserAccountInfoResult from its views, for a Blueprint that reads them */
+    static void fillLookupUserAccountInfoResultJsonObjects(FAdminLookupUserAccountInfoResult& result);
+
     /** Decode the GetUserBansResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Account Management Models")
         static FAdminGetUserBansResult decodeGetUserBansResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetUserBansResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetUserBansResult readGetUserBansResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetUserBansResult from its views, for a Blueprint that reads them */
+    static void fillGetUserBansResultJsonObjects(FAdminGetUserBansResult& result);
+
     /** Decode the BlankResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Account Management Models")
         static FAdminBlankResult decodeBlankResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the BlankResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminBlankResult readBlankResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the RevokeAllBansForUserResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Account Management Models")
         static FAdminRevokeAllBansForUserResult decodeRevokeAllBansForUserResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RevokeAllBansForUserResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminRevokeAllBansForUserResult readRevokeAllBansForUserResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a RevokeAllBansForUserResult from its views, for a Blueprint that reads them */
+    static void fillRevokeAllBansForUserResultJsonObjects(FAdminRevokeAllBansForUserResult& result);
+
     /** Decode the RevokeBansResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Account Management Models")
         static FAdminRevokeBansResult decodeRevokeBansResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RevokeBansResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminRevokeBansResult readRevokeBansResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a RevokeBansResult from its views, for a Blueprint that reads them */
+    static void fillRevokeBansResultJsonObjects(FAdminRevokeBansResult& result);
+
     /** Decode the SendAccountRecoveryEmailResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Account Management Models")
         static FAdminSendAccountRecoveryEmailResult decodeSendAccountRecoveryEmailResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SendAccountRecoveryEmailResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminSendAccountRecoveryEmailResult readSendAccountRecoveryEmailResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdateBansResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Account Management Models")
         static FAdminUpdateBansResult decodeUpdateBansResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateBansResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminUpdateBansResult readUpdateBansResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a UpdateBansResult from its views, for a Blueprint that reads them */
+    static void fillUpdateBansResultJsonObjects(FAdminUpdateBansResult& result);
+
     /** Decode the UpdateUserTitleDisplayNameResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Account Management Models")
         static FAdminUpdateUserTitleDisplayNameResult decodeUpdateUserTitleDisplayNameResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateUserTitleDisplayNameResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminUpdateUserTitleDisplayNameResult readUpdateUserTitleDisplayNameResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -114,50 +210,116 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Data Management Models")
         static FAdminCreatePlayerStatisticDefinitionResult decodeCreatePlayerStatisticDefinitionResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the CreatePlayerStatisticDefinitionResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminCreatePlayerStatisticDefinitionResult readCreatePlayerStatisticDefinitionResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a CreatePlayerStatisticDefinitionResult from its views, for a Blueprint that reads them */
+    static void fillCreatePlayerStatisticDefinitionResultJsonObjects(FAdminCreatePlayerStatisticDefinitionResult& result);
+
     /** Decode the DeleteUsersResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Data Management Models")
         static FAdminDeleteUsersResult decodeDeleteUsersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the DeleteUsersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminDeleteUsersResult readDeleteUsersResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetDataReportResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Data Management Models")
         static FAdminGetDataReportResult decodeGetDataReportResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetDataReportResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetDataReportResult readGetDataReportResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetPlayerStatisticDefinitionsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Data Management Models")
         static FAdminGetPlayerStatisticDefinitionsResult decodeGetPlayerStatisticDefinitionsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerStatisticDefinitionsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetPlayerStatisticDefinitionsResult readGetPlayerStatisticDefinitionsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerStatisticDefinitionsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerStatisticDefinitionsResultJsonObjects(FAdminGetPlayerStatisticDefinitionsResult& result);
+
     /** Decode the GetPlayerStatisticVersionsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Data Management Models")
         static FAdminGetPlayerStatisticVersionsResult decodeGetPlayerStatisticVersionsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerStatisticVersionsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetPlayerStatisticVersionsResult readGetPlayerStatisticVersionsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerStatisticVersionsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerStatisticVersionsResultJsonObjects(FAdminGetPlayerStatisticVersionsResult& result);
+
     /** Decode the GetUserDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Data Management Models")
         static FAdminGetUserDataResult decodeGetUserDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetUserDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetUserDataResult readGetUserDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetUserDataResult from its views, for a Blueprint that reads them */
+    static void fillGetUserDataResultJsonObjects(FAdminGetUserDataResult& result);
+
     /** Decode the IncrementPlayerStatisticVersionResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Data Management Models")
         static FAdminIncrementPlayerStatisticVersionResult decodeIncrementPlayerStatisticVersionResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the IncrementPlayerStatisticVersionResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminIncrementPlayerStatisticVersionResult readIncrementPlayerStatisticVersionResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a IncrementPlayerStatisticVersionResult from its views, for a Blueprint that reads them */
+    static void fillIncrementPlayerStatisticVersionResultJsonObjects(FAdminIncrementPlayerStatisticVersionResult& result);
+
     /** Decode the RefundPurchaseResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Data Management Models")
         static FAdminRefundPurchaseResponse decodeRefundPurchaseResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the RefundPurchaseResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminRefundPurchaseResponse readRefundPurchaseResponseResponse(const FPlayFabBaseModel& response);
+
     /** Decode the ResetUserStatisticsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Data Management Models")
         static FAdminResetUserStatisticsResult decodeResetUserStatisticsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ResetUserStatisticsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminResetUserStatisticsResult readResetUserStatisticsResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the ResolvePurchaseDisputeResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Data Management Models")
         static FAdminResolvePurchaseDisputeResponse decodeResolvePurchaseDisputeResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the ResolvePurchaseDisputeResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminResolvePurchaseDisputeResponse readResolvePurchaseDisputeResponseResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdatePlayerStatisticDefinitionResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Data Management Models")
         static FAdminUpdatePlayerStatisticDefinitionResult decodeUpdatePlayerStatisticDefinitionResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdatePlayerStatisticDefinitionResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminUpdatePlayerStatisticDefinitionResult readUpdatePlayerStatisticDefinitionResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a UpdatePlayerStatisticDefinitionResult from its views, for a Blueprint that reads them */
+    static void fillUpdatePlayerStatisticDefinitionResultJsonObjects(FAdminUpdatePlayerStatisticDefinitionResult& result);
+
     /** Decode the UpdateUserDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Data Management Models")
         static FAdminUpdateUserDataResult decodeUpdateUserDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateUserDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminUpdateUserDataResult readUpdateUserDataResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -168,54 +330,124 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminAddNewsResult decodeAddNewsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AddNewsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminAddNewsResult readAddNewsResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the DeleteStoreResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminDeleteStoreResult decodeDeleteStoreResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the DeleteStoreResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminDeleteStoreResult readDeleteStoreResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetCatalogItemsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminGetCatalogItemsResult decodeGetCatalogItemsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCatalogItemsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetCatalogItemsResult readGetCatalogItemsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCatalogItemsResult from its views, for a Blueprint that reads them */
+    static void fillGetCatalogItemsResultJsonObjects(FAdminGetCatalogItemsResult& result);
+
     /** Decode the GetPublisherDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminGetPublisherDataResult decodeGetPublisherDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPublisherDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetPublisherDataResult readGetPublisherDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPublisherDataResult from its views, for a Blueprint that reads them */
+    static void fillGetPublisherDataResultJsonObjects(FAdminGetPublisherDataResult& result);
+
     /** Decode the GetRandomResultTablesResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminGetRandomResultTablesResult decodeGetRandomResultTablesResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetRandomResultTablesResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetRandomResultTablesResult readGetRandomResultTablesResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetRandomResultTablesResult from its views, for a Blueprint that reads them */
+    static void fillGetRandomResultTablesResultJsonObjects(FAdminGetRandomResultTablesResult& result);
+
     /** Decode the GetStoreItemsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminGetStoreItemsResult decodeGetStoreItemsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetStoreItemsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetStoreItemsResult readGetStoreItemsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetStoreItemsResult from its views, for a Blueprint that reads them */
+    static void fillGetStoreItemsResultJsonObjects(FAdminGetStoreItemsResult& result);
+
     /** Decode the GetTitleDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminGetTitleDataResult decodeGetTitleDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetTitleDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetTitleDataResult readGetTitleDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetTitleDataResult from its views, for a Blueprint that reads them */
+    static void fillGetTitleDataResultJsonObjects(FAdminGetTitleDataResult& result);
+
     /** Decode the ListVirtualCurrencyTypesResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminListVirtualCurrencyTypesResult decodeListVirtualCurrencyTypesResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ListVirtualCurrencyTypesResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminListVirtualCurrencyTypesResult readListVirtualCurrencyTypesResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a ListVirtualCurrencyTypesResult from its views, for a Blueprint that reads them */
+    static void fillListVirtualCurrencyTypesResultJsonObjects(FAdminListVirtualCurrencyTypesResult& result);
+
     /** Decode the UpdateCatalogItemsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminUpdateCatalogItemsResult decodeUpdateCatalogItemsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateCatalogItemsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminUpdateCatalogItemsResult readUpdateCatalogItemsResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdateStoreItemsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminUpdateStoreItemsResult decodeUpdateStoreItemsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateStoreItemsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminUpdateStoreItemsResult readUpdateStoreItemsResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the SetTitleDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminSetTitleDataResult decodeSetTitleDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetTitleDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminSetTitleDataResult readSetTitleDataResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the SetupPushNotificationResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminSetupPushNotificationResult decodeSetupPushNotificationResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetupPushNotificationResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminSetupPushNotificationResult readSetupPushNotificationResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdateRandomResultTablesResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         static FAdminUpdateRandomResultTablesResult decodeUpdateRandomResultTablesResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateRandomResultTablesResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminUpdateRandomResultTablesResult readUpdateRandomResultTablesResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -226,18 +458,40 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Item Management Models")
         static FAdminModifyUserVirtualCurrencyResult decodeModifyUserVirtualCurrencyResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ModifyUserVirtualCurrencyResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminModifyUserVirtualCurrencyResult readModifyUserVirtualCurrencyResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetUserInventoryResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Item Management Models")
         static FAdminGetUserInventoryResult decodeGetUserInventoryResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetUserInventoryResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetUserInventoryResult readGetUserInventoryResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetUserInventoryResult from its views, for a Blueprint that reads them */
+    static void fillGetUserInventoryResultJsonObjects(FAdminGetUserInventoryResult& result);
+
     /** Decode the GrantItemsToUsersResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Item Management Models")
         static FAdminGrantItemsToUsersResult decodeGrantItemsToUsersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GrantItemsToUsersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGrantItemsToUsersResult readGrantItemsToUsersResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GrantItemsToUsersResult from its views, for a Blueprint that reads them */
+    static void fillGrantItemsToUsersResultJsonObjects(FAdminGrantItemsToUsersResult& result);
+
     /** Decode the RevokeInventoryResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Player Item Management Models")
         static FAdminRevokeInventoryResult decodeRevokeInventoryResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RevokeInventoryResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminRevokeInventoryResult readRevokeInventoryResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -248,14 +502,29 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Matchmaking Models")
         static FAdminGetMatchmakerGameInfoResult decodeGetMatchmakerGameInfoResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetMatchmakerGameInfoResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetMatchmakerGameInfoResult readGetMatchmakerGameInfoResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetMatchmakerGameModesResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Matchmaking Models")
         static FAdminGetMatchmakerGameModesResult decodeGetMatchmakerGameModesResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetMatchmakerGameModesResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetMatchmakerGameModesResult readGetMatchmakerGameModesResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetMatchmakerGameModesResult from its views, for a Blueprint that reads them */
+    static void fillGetMatchmakerGameModesResultJsonObjects(FAdminGetMatchmakerGameModesResult& result);
+
     /** Decode the ModifyMatchmakerGameModesResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Matchmaking Models")
         static FAdminModifyMatchmakerGameModesResult decodeModifyMatchmakerGameModesResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ModifyMatchmakerGameModesResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminModifyMatchmakerGameModesResult readModifyMatchmakerGameModesResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -266,26 +535,53 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Custom Server Management Models")
         static FAdminAddServerBuildResult decodeAddServerBuildResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AddServerBuildResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminAddServerBuildResult readAddServerBuildResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetServerBuildInfoResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Custom Server Management Models")
         static FAdminGetServerBuildInfoResult decodeGetServerBuildInfoResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetServerBuildInfoResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetServerBuildInfoResult readGetServerBuildInfoResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetServerBuildUploadURLResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Custom Server Management Models")
         static FAdminGetServerBuildUploadURLResult decodeGetServerBuildUploadURLResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetServerBuildUploadURLResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetServerBuildUploadURLResult readGetServerBuildUploadURLResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the ListBuildsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Custom Server Management Models")
         static FAdminListBuildsResult decodeListBuildsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ListBuildsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminListBuildsResult readListBuildsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a ListBuildsResult from its views, for a Blueprint that reads them */
+    static void fillListBuildsResultJsonObjects(FAdminListBuildsResult& result);
+
     /** Decode the ModifyServerBuildResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Custom Server Management Models")
         static FAdminModifyServerBuildResult decodeModifyServerBuildResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ModifyServerBuildResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminModifyServerBuildResult readModifyServerBuildResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the RemoveServerBuildResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Custom Server Management Models")
         static FAdminRemoveServerBuildResult decodeRemoveServerBuildResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RemoveServerBuildResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminRemoveServerBuildResult readRemoveServerBuildResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -296,6 +592,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Shared Group Data Models")
         static FAdminSetPublisherDataResult decodeSetPublisherDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetPublisherDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminSetPublisherDataResult readSetPublisherDataResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -306,18 +606,40 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Server-Side Cloud Script Models")
         static FAdminGetCloudScriptRevisionResult decodeGetCloudScriptRevisionResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCloudScriptRevisionResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetCloudScriptRevisionResult readGetCloudScriptRevisionResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCloudScriptRevisionResult from its views, for a Blueprint that reads them */
+    static void fillGetCloudScriptRevisionResultJsonObjects(FAdminGetCloudScriptRevisionResult& result);
+
     /** Decode the GetCloudScriptVersionsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Server-Side Cloud Script Models")
         static FAdminGetCloudScriptVersionsResult decodeGetCloudScriptVersionsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCloudScriptVersionsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetCloudScriptVersionsResult readGetCloudScriptVersionsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCloudScriptVersionsResult from its views, for a Blueprint that reads them */
+    static void fillGetCloudScriptVersionsResultJsonObjects(FAdminGetCloudScriptVersionsResult& result);
+
     /** Decode the SetPublishedRevisionResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Server-Side Cloud Script Models")
         static FAdminSetPublishedRevisionResult decodeSetPublishedRevisionResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetPublishedRevisionResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminSetPublishedRevisionResult readSetPublishedRevisionResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdateCloudScriptResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Server-Side Cloud Script Models")
         static FAdminUpdateCloudScriptResult decodeUpdateCloudScriptResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateCloudScriptResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminUpdateCloudScriptResult readUpdateCloudScriptResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -328,10 +650,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Content Models")
         static FAdminGetContentListResult decodeGetContentListResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetContentListResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetContentListResult readGetContentListResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetContentListResult from its views, for a Blueprint that reads them */
+    static void fillGetContentListResultJsonObjects(FAdminGetContentListResult& result);
+
     /** Decode the GetContentUploadUrlResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Content Models")
         static FAdminGetContentUploadUrlResult decodeGetContentUploadUrlResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetContentUploadUrlResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetContentUploadUrlResult readGetContentUploadUrlResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -342,6 +675,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | Characters Models")
         static FAdminResetCharacterStatisticsResult decodeResetCharacterStatisticsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ResetCharacterStatisticsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminResetCharacterStatisticsResult readResetCharacterStatisticsResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -352,30 +689,70 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | PlayStream Models")
         static FAdminAddPlayerTagResult decodeAddPlayerTagResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AddPlayerTagResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminAddPlayerTagResult readAddPlayerTagResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetAllActionGroupsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | PlayStream Models")
         static FAdminGetAllActionGroupsResult decodeGetAllActionGroupsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetAllActionGroupsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetAllActionGroupsResult readGetAllActionGroupsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetAllActionGroupsResult from its views, for a Blueprint that reads them */
+    static void fillGetAllActionGroupsResultJsonObjects(FAdminGetAllActionGroupsResult& result);
+
     /** Decode the GetAllSegmentsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | PlayStream Models")
         static FAdminGetAllSegmentsResult decodeGetAllSegmentsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetAllSegmentsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetAllSegmentsResult readGetAllSegmentsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetAllSegmentsResult from its views, for a Blueprint that reads them */
+    static void fillGetAllSegmentsResultJsonObjects(FAdminGetAllSegmentsResult& result);
+
     /** Decode the GetPlayerSegmentsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | PlayStream Models")
         static FAdminGetPlayerSegmentsResult decodeGetPlayerSegmentsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerSegmentsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetPlayerSegmentsResult readGetPlayerSegmentsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerSegmentsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerSegmentsResultJsonObjects(FAdminGetPlayerSegmentsResult& result);
+
     /** Decode the GetPlayersInSegmentResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | PlayStream Models")
         static FAdminGetPlayersInSegmentResult decodeGetPlayersInSegmentResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayersInSegmentResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetPlayersInSegmentResult readGetPlayersInSegmentResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayersInSegmentResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayersInSegmentResultJsonObjects(FAdminGetPlayersInSegmentResult& result);
+
     /** Decode the GetPlayerTagsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | PlayStream Models")
         static FAdminGetPlayerTagsResult decodeGetPlayerTagsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerTagsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetPlayerTagsResult readGetPlayerTagsResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the RemovePlayerTagResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | PlayStream Models")
         static FAdminRemovePlayerTagResult decodeRemovePlayerTagResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RemovePlayerTagResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminRemovePlayerTagResult readRemovePlayerTagResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -386,30 +763,70 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | ScheduledTask Models")
         static FAdminEmptyResult decodeEmptyResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the EmptyResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminEmptyResult readEmptyResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the CreateTaskResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | ScheduledTask Models")
         static FAdminCreateTaskResult decodeCreateTaskResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the CreateTaskResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminCreateTaskResult readCreateTaskResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetActionsOnPlayersInSegmentTaskInstanceResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | ScheduledTask Models")
         static FAdminGetActionsOnPlayersInSegmentTaskInstanceResult decodeGetActionsOnPlayersInSegmentTaskInstanceResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetActionsOnPlayersInSegmentTaskInstanceResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetActionsOnPlayersInSegmentTaskInstanceResult readGetActionsOnPlayersInSegmentTaskInstanceResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetActionsOnPlayersInSegmentTaskInstanceResult from its views, for a Blueprint that reads them */
+    static void fillGetActionsOnPlayersInSegmentTaskInstanceResultJsonObjects(FAdminGetActionsOnPlayersInSegmentTaskInstanceResult& result);
+
     /** Decode the GetCloudScriptTaskInstanceResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | ScheduledTask Models")
         static FAdminGetCloudScriptTaskInstanceResult decodeGetCloudScriptTaskInstanceResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCloudScriptTaskInstanceResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetCloudScriptTaskInstanceResult readGetCloudScriptTaskInstanceResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCloudScriptTaskInstanceResult from its views, for a Blueprint that reads them */
+    static void fillGetCloudScriptTaskInstanceResultJsonObjects(FAdminGetCloudScriptTaskInstanceResult& result);
+
     /** Decode the GetTaskInstancesResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | ScheduledTask Models")
         static FAdminGetTaskInstancesResult decodeGetTaskInstancesResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetTaskInstancesResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetTaskInstancesResult readGetTaskInstancesResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetTaskInstancesResult from its views, for a Blueprint that reads them */
+    static void fillGetTaskInstancesResultJsonObjects(FAdminGetTaskInstancesResult& result);
+
     /** Decode the GetTasksResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | ScheduledTask Models")
         static FAdminGetTasksResult decodeGetTasksResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetTasksResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminGetTasksResult readGetTasksResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetTasksResult from its views, for a Blueprint that reads them */
+    static void fillGetTasksResultJsonObjects(FAdminGetTasksResult& result);
+
     /** Decode the RunTaskResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Admin | ScheduledTask Models")
         static FAdminRunTaskResult decodeRunTaskResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RunTaskResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FAdminRunTaskResult readRunTaskResultResponse(const FPlayFabBaseModel& response);
+
 
 
 };
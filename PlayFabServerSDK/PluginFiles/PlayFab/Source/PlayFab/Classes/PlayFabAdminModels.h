@@ -9,6 +9,7 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "PlayFabEnums.h"
+#include "PlayFabJsonView.h"
 #include "PlayFabAdminModels.generated.h"
 
 class UPlayFabJsonObject;
@@ -74,6 +75,9 @@ public:
     /** The player shared secret to use when calling Client/GetTitlePublicKey */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Authentication Models")
         TArray<UPlayFabJsonObject*> SharedSecrets;
+    /** SharedSecrets, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Authentication Models")
+        TArray<FPlayFabJsonView> SharedSecretsView;
 };
 
 USTRUCT(BlueprintType)
@@ -97,6 +101,9 @@ public:
     /** The statements in the requested policy. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Authentication Models")
         TArray<UPlayFabJsonObject*> Statements;
+    /** Statements, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Authentication Models")
+        TArray<FPlayFabJsonView> StatementsView;
 };
 
 USTRUCT(BlueprintType)
@@ -169,6 +176,9 @@ public:
     /** The statements included in the new version of the policy. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Authentication Models")
         TArray<UPlayFabJsonObject*> Statements;
+    /** Statements, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Authentication Models")
+        TArray<FPlayFabJsonView> StatementsView;
 };
 
 
@@ -194,6 +204,9 @@ public:
     /** Information on the bans that were applied */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Account Management Models")
         TArray<UPlayFabJsonObject*> BanData;
+    /** BanData, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Account Management Models")
+        TArray<FPlayFabJsonView> BanDataView;
 };
 
 USTRUCT(BlueprintType)
@@ -240,6 +253,9 @@ public:
     /** User info for the user matching the request */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Account Management Models")
         UPlayFabJsonObject* UserInfo = nullptr;
+    /** UserInfo, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Account Management Models")
+        FPlayFabJsonView UserInfoView;
 };
 
 USTRUCT(BlueprintType)
@@ -260,6 +276,9 @@ public:
     /** Information about the bans */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Account Management Models")
         TArray<UPlayFabJsonObject*> BanData;
+    /** BanData, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Account Management Models")
+        TArray<FPlayFabJsonView> BanDataView;
 };
 
 USTRUCT(BlueprintType)
@@ -297,6 +316,9 @@ public:
     /** Information on the bans that were revoked. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Account Management Models")
         TArray<UPlayFabJsonObject*> BanData;
+    /** BanData, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Account Management Models")
+        TArray<FPlayFabJsonView> BanDataView;
 };
 
 USTRUCT(BlueprintType)
@@ -317,6 +339,9 @@ public:
     /** Information on the bans that were revoked */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Account Management Models")
         TArray<UPlayFabJsonObject*> BanData;
+    /** BanData, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Account Management Models")
+        TArray<FPlayFabJsonView> BanDataView;
 };
 
 USTRUCT(BlueprintType)
@@ -354,6 +379,9 @@ public:
     /** Information on the bans that were updated */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Account Management Models")
         TArray<UPlayFabJsonObject*> BanData;
+    /** BanData, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Account Management Models")
+        TArray<FPlayFabJsonView> BanDataView;
 };
 
 USTRUCT(BlueprintType)
@@ -408,6 +436,9 @@ public:
     /** created statistic definition */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Data Management Models")
         UPlayFabJsonObject* Statistic = nullptr;
+    /** Statistic, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Data Management Models")
+        FPlayFabJsonView StatisticView;
 };
 
 USTRUCT(BlueprintType)
@@ -471,6 +502,9 @@ public:
     /** the player statistic definitions for the title */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Data Management Models")
         TArray<UPlayFabJsonObject*> Statistics;
+    /** Statistics, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Data Management Models")
+        TArray<FPlayFabJsonView> StatisticsView;
 };
 
 USTRUCT(BlueprintType)
@@ -491,6 +525,9 @@ public:
     /** version change history of the statistic */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Data Management Models")
         TArray<UPlayFabJsonObject*> StatisticVersions;
+    /** StatisticVersions, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Data Management Models")
+        TArray<FPlayFabJsonView> StatisticVersionsView;
 };
 
 USTRUCT(BlueprintType)
@@ -523,6 +560,9 @@ public:
     /** User specific data for this title. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Data Management Models")
         UPlayFabJsonObject* Data = nullptr;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Data Management Models")
+        FPlayFabJsonView DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -543,6 +583,9 @@ public:
     /** version change history of the statistic */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Data Management Models")
         UPlayFabJsonObject* StatisticVersion = nullptr;
+    /** StatisticVersion, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Data Management Models")
+        FPlayFabJsonView StatisticVersionView;
 };
 
 USTRUCT(BlueprintType)
@@ -641,6 +684,9 @@ public:
     /** updated statistic definition */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Data Management Models")
         UPlayFabJsonObject* Statistic = nullptr;
+    /** Statistic, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Data Management Models")
+        FPlayFabJsonView StatisticView;
 };
 
 USTRUCT(BlueprintType)
@@ -767,6 +813,9 @@ public:
     /** Array of items which can be purchased. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         TArray<UPlayFabJsonObject*> Catalog;
+    /** Catalog, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
+        TArray<FPlayFabJsonView> CatalogView;
 };
 
 USTRUCT(BlueprintType)
@@ -787,6 +836,9 @@ public:
     /** a dictionary object of key / value pairs */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         UPlayFabJsonObject* Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
+        FPlayFabJsonView DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -807,6 +859,9 @@ public:
     /** array of random result tables currently available */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         UPlayFabJsonObject* Tables = nullptr;
+    /** Tables, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
+        FPlayFabJsonView TablesView;
 };
 
 USTRUCT(BlueprintType)
@@ -830,6 +885,9 @@ public:
     /** Array of items which can be purchased from this store. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         TArray<UPlayFabJsonObject*> Store;
+    /** Store, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
+        TArray<FPlayFabJsonView> StoreView;
     /** How the store was last updated (Admin or a third party). */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         EPfSourceType Source;
@@ -842,6 +900,9 @@ public:
     /** Additional data about the store. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         UPlayFabJsonObject* MarketingData = nullptr;
+    /** MarketingData, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
+        FPlayFabJsonView MarketingDataView;
 };
 
 USTRUCT(BlueprintType)
@@ -862,6 +923,9 @@ public:
     /** a dictionary object of key / value pairs */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         UPlayFabJsonObject* Data;
+    /** Data, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
+        FPlayFabJsonView DataView;
 };
 
 USTRUCT(BlueprintType)
@@ -879,6 +943,9 @@ public:
     /** List of virtual currency names defined for this title */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
         TArray<UPlayFabJsonObject*> VirtualCurrencies;
+    /** VirtualCurrencies, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Title-Wide Data Management Models")
+        TArray<FPlayFabJsonView> VirtualCurrenciesView;
 };
 
 USTRUCT(BlueprintType)
@@ -1073,12 +1140,21 @@ public:
     /** Array of inventory items belonging to the user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Item Management Models")
         TArray<UPlayFabJsonObject*> Inventory;
+    /** Inventory, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Item Management Models")
+        TArray<FPlayFabJsonView> InventoryView;
     /** Array of virtual currency balance(s) belonging to the user. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrency;
+    /** VirtualCurrency, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyView;
     /** Array of remaining times and timestamps for virtual currencies. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Item Management Models")
         UPlayFabJsonObject* VirtualCurrencyRechargeTimes = nullptr;
+    /** VirtualCurrencyRechargeTimes, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Item Management Models")
+        FPlayFabJsonView VirtualCurrencyRechargeTimesView;
 };
 
 USTRUCT(BlueprintType)
@@ -1102,6 +1178,9 @@ public:
     /** Array of items granted to users. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Item Management Models")
         TArray<UPlayFabJsonObject*> ItemGrantResults;
+    /** ItemGrantResults, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Player Item Management Models")
+        TArray<FPlayFabJsonView> ItemGrantResultsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1213,6 +1292,9 @@ public:
     /** array of game modes available for the specified build */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Matchmaking Models")
         TArray<UPlayFabJsonObject*> GameModes;
+    /** GameModes, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Matchmaking Models")
+        TArray<FPlayFabJsonView> GameModesView;
 };
 
 USTRUCT(BlueprintType)
@@ -1384,6 +1466,9 @@ public:
     /** array of uploaded game server builds */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Custom Server Management Models")
         TArray<UPlayFabJsonObject*> Builds;
+    /** Builds, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Custom Server Management Models")
+        TArray<FPlayFabJsonView> BuildsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1531,6 +1616,9 @@ public:
     /** List of Cloud Script files in this revision. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Server-Side Cloud Script Models")
         TArray<UPlayFabJsonObject*> Files;
+    /** Files, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Server-Side Cloud Script Models")
+        TArray<FPlayFabJsonView> FilesView;
     /** True if this is the currently published revision */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Server-Side Cloud Script Models")
         bool IsPublished;
@@ -1551,6 +1639,9 @@ public:
     /** List of versions */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Server-Side Cloud Script Models")
         TArray<UPlayFabJsonObject*> Versions;
+    /** Versions, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Server-Side Cloud Script Models")
+        TArray<FPlayFabJsonView> VersionsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1641,6 +1732,9 @@ public:
     /** List of content items. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Content Models")
         TArray<UPlayFabJsonObject*> Contents;
+    /** Contents, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | Content Models")
+        TArray<FPlayFabJsonView> ContentsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1731,6 +1825,9 @@ public:
     /** List of Action Groups. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | PlayStream Models")
         TArray<UPlayFabJsonObject*> ActionGroups;
+    /** ActionGroups, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | PlayStream Models")
+        TArray<FPlayFabJsonView> ActionGroupsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1748,6 +1845,9 @@ public:
     /** Array of segments for this title. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | PlayStream Models")
         TArray<UPlayFabJsonObject*> Segments;
+    /** Segments, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | PlayStream Models")
+        TArray<FPlayFabJsonView> SegmentsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1758,6 +1858,9 @@ public:
     /** Array of segments the requested player currently belongs to. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | PlayStream Models")
         TArray<UPlayFabJsonObject*> Segments;
+    /** Segments, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | PlayStream Models")
+        TArray<FPlayFabJsonView> SegmentsView;
 };
 
 USTRUCT(BlueprintType)
@@ -1803,6 +1906,9 @@ public:
     /** Array of player profiles in this segment. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | PlayStream Models")
         TArray<UPlayFabJsonObject*> PlayerProfiles;
+    /** PlayerProfiles, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | PlayStream Models")
+        TArray<FPlayFabJsonView> PlayerProfilesView;
 };
 
 USTRUCT(BlueprintType)
@@ -1945,9 +2051,15 @@ public:
     /** Status summary of the actions-on-players-in-segment task instance */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | ScheduledTask Models")
         UPlayFabJsonObject* Summary = nullptr;
+    /** Summary, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | ScheduledTask Models")
+        FPlayFabJsonView SummaryView;
     /** Parameter of this task instance */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | ScheduledTask Models")
         UPlayFabJsonObject* Parameter = nullptr;
+    /** Parameter, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | ScheduledTask Models")
+        FPlayFabJsonView ParameterView;
 };
 
 USTRUCT(BlueprintType)
@@ -1968,9 +2080,15 @@ public:
     /** Status summary of the CloudScript task instance */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | ScheduledTask Models")
         UPlayFabJsonObject* Summary = nullptr;
+    /** Summary, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | ScheduledTask Models")
+        FPlayFabJsonView SummaryView;
     /** Parameter of this task instance */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | ScheduledTask Models")
         UPlayFabJsonObject* Parameter = nullptr;
+    /** Parameter, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | ScheduledTask Models")
+        FPlayFabJsonView ParameterView;
 };
 
 USTRUCT(BlueprintType)
@@ -2000,6 +2118,9 @@ public:
     /** Basic status summaries of the queried task instances. Empty If no task instances meets the filter criteria. To get detailed status summary, use Get*TaskInstance API according to task type (e.g. GetActionsOnPlayersInSegmentTaskInstance). */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | ScheduledTask Models")
         TArray<UPlayFabJsonObject*> Summaries;
+    /** Summaries, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | ScheduledTask Models")
+        TArray<FPlayFabJsonView> SummariesView;
 };
 
 USTRUCT(BlueprintType)
@@ -2020,6 +2141,9 @@ public:
     /** Result tasks. Empty if there is no task found. */
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | ScheduledTask Models")
         TArray<UPlayFabJsonObject*> Tasks;
+    /** Tasks, read in place without making a Json Object. */
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "PlayFab | Admin | ScheduledTask Models")
+        TArray<FPlayFabJsonView> TasksView;
 };
 
 USTRUCT(BlueprintType)
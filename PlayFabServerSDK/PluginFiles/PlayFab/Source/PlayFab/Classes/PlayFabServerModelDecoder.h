@@ -9,6 +9,7 @@
 
 #include "Kismet/BlueprintFunctionLibrary.h"
 #include "PlayFabEnums.h"
+#include "PlayFabBaseModel.h"
 #include "PlayFabServerModels.h"
 #include "PlayFabServerModelDecoder.generated.h"
 
@@ -34,10 +35,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Authentication Models")
         static FServerAuthenticateSessionTicketResult decodeAuthenticateSessionTicketResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AuthenticateSessionTicketResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerAuthenticateSessionTicketResult readAuthenticateSessionTicketResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a AuthenticateSessionTicketResult from its views, for a Blueprint that reads them */
+    static void fillAuthenticateSessionTicketResultJsonObjects(FServerAuthenticateSessionTicketResult& result);
+
     /** Decode the SetPlayerSecretResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Authentication Models")
         static FServerSetPlayerSecretResult decodeSetPlayerSecretResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetPlayerSecretResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerSetPlayerSecretResult readSetPlayerSecretResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -48,46 +60,117 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Account Management Models")
         static FServerBanUsersResult decodeBanUsersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the BanUsersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerBanUsersResult readBanUsersResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a BanUsersResult from its views, for a Blueprint that reads them */
+    static void fillBanUsersResultJsonObjects(FServerBanUsersResult& result);
+
     /** Decode the GetPlayerProfileResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Account Management Models")
         static FServerGetPlayerProfileResult decodeGetPlayerProfileResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerProfileResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetPlayerProfileResult readGetPlayerProfileResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerProfileResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerProfileResultJsonObjects(FServerGetPlayerProfileResult& result);
+
     /** Decode the GetPlayFabIDsFromFacebookIDsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Account Management Models")
         static FServerGetPlayFabIDsFromFacebookIDsResult decodeGetPlayFabIDsFromFacebookIDsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayFabIDsFromFacebookIDsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetPlayFabIDsFromFacebookIDsResult readGetPlayFabIDsFromFacebookIDsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayFabIDsFromFacebookIDsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayFabIDsFromFacebookIDsResultJsonObjects(FServerGetPlayFabIDsFromFacebookIDsResult& result);
+
     /** Decode the GetPlayFabIDsFromSteamIDsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Account Management Models")
         static FServerGetPlayFabIDsFromSteamIDsResult decodeGetPlayFabIDsFromSteamIDsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayFabIDsFromSteamIDsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetPlayFabIDsFromSteamIDsResult readGetPlayFabIDsFromSteamIDsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayFabIDsFromSteamIDsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayFabIDsFromSteamIDsResultJsonObjects(FServerGetPlayFabIDsFromSteamIDsResult& result);
+
     /** Decode the GetUserAccountInfoResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Account Management Models")
         static FServerGetUserAccountInfoResult decodeGetUserAccountInfoResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetUserAccountInfoResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetUserAccountInfoResult readGetUserAccountInfoResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetUserAccountInfoResult from its views, for a Blueprint that reads them */
+    static void fillGetUserAccountInfoResultJsonObjects(FServerGetUserAccountInfoResult& result);
+
     /** Decode the GetUserBansResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Account Management Models")
         static FServerGetUserBansResult decodeGetUserBansResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetUserBansResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetUserBansResult readGetUserBansResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetUserBansResult from its views, for a Blueprint that reads them */
+    static void fillGetUserBansResultJsonObjects(FServerGetUserBansResult& result);
+
     /** Decode the RevokeAllBansForUserResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Account Management Models")
         static FServerRevokeAllBansForUserResult decodeRevokeAllBansForUserResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RevokeAllBansForUserResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerRevokeAllBansForUserResult readRevokeAllBansForUserResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a RevokeAllBansForUserResult from its views, for a Blueprint that reads them */
+    static void fillRevokeAllBansForUserResultJsonObjects(FServerRevokeAllBansForUserResult& result);
+
     /** Decode the RevokeBansResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Account Management Models")
         static FServerRevokeBansResult decodeRevokeBansResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RevokeBansResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerRevokeBansResult readRevokeBansResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a RevokeBansResult from its views, for a Blueprint that reads them */
+    static void fillRevokeBansResultJsonObjects(FServerRevokeBansResult& result);
+
     /** Decode the SendPushNotificationResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Account Management Models")
         static FServerSendPushNotificationResult decodeSendPushNotificationResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SendPushNotificationResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerSendPushNotificationResult readSendPushNotificationResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the EmptyResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Account Management Models")
         static FServerEmptyResult decodeEmptyResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the EmptyResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerEmptyResult readEmptyResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdateBansResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Account Management Models")
         static FServerUpdateBansResult decodeUpdateBansResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateBansResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerUpdateBansResult readUpdateBansResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a UpdateBansResult from its views, for a Blueprint that reads them */
+    static void fillUpdateBansResultJsonObjects(FServerUpdateBansResult& result);
+
 
 
     ///////////////////////////////////////////////////////
@@ -98,38 +181,92 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Data Management Models")
         static FServerDeleteUsersResult decodeDeleteUsersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the DeleteUsersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerDeleteUsersResult readDeleteUsersResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetLeaderboardResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Data Management Models")
         static FServerGetLeaderboardResult decodeGetLeaderboardResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetLeaderboardResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetLeaderboardResult readGetLeaderboardResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetLeaderboardResult from its views, for a Blueprint that reads them */
+    static void fillGetLeaderboardResultJsonObjects(FServerGetLeaderboardResult& result);
+
     /** Decode the GetLeaderboardAroundUserResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Data Management Models")
         static FServerGetLeaderboardAroundUserResult decodeGetLeaderboardAroundUserResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetLeaderboardAroundUserResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetLeaderboardAroundUserResult readGetLeaderboardAroundUserResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetLeaderboardAroundUserResult from its views, for a Blueprint that reads them */
+    static void fillGetLeaderboardAroundUserResultJsonObjects(FServerGetLeaderboardAroundUserResult& result);
+
     /** Decode the GetPlayerCombinedInfoResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Data Management Models")
         static FServerGetPlayerCombinedInfoResult decodeGetPlayerCombinedInfoResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerCombinedInfoResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetPlayerCombinedInfoResult readGetPlayerCombinedInfoResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerCombinedInfoResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerCombinedInfoResultJsonObjects(FServerGetPlayerCombinedInfoResult& result);
+
     /** Decode the GetPlayerStatisticsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Data Management Models")
         static FServerGetPlayerStatisticsResult decodeGetPlayerStatisticsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerStatisticsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetPlayerStatisticsResult readGetPlayerStatisticsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerStatisticsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerStatisticsResultJsonObjects(FServerGetPlayerStatisticsResult& result);
+
     /** Decode the GetPlayerStatisticVersionsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Data Management Models")
         static FServerGetPlayerStatisticVersionsResult decodeGetPlayerStatisticVersionsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerStatisticVersionsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetPlayerStatisticVersionsResult readGetPlayerStatisticVersionsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerStatisticVersionsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerStatisticVersionsResultJsonObjects(FServerGetPlayerStatisticVersionsResult& result);
+
     /** Decode the GetUserDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Data Management Models")
         static FServerGetUserDataResult decodeGetUserDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetUserDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetUserDataResult readGetUserDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetUserDataResult from its views, for a Blueprint that reads them */
+    static void fillGetUserDataResultJsonObjects(FServerGetUserDataResult& result);
+
     /** Decode the UpdatePlayerStatisticsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Data Management Models")
         static FServerUpdatePlayerStatisticsResult decodeUpdatePlayerStatisticsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdatePlayerStatisticsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerUpdatePlayerStatisticsResult readUpdatePlayerStatisticsResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdateUserDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Data Management Models")
         static FServerUpdateUserDataResult decodeUpdateUserDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateUserDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerUpdateUserDataResult readUpdateUserDataResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -140,30 +277,70 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Title-Wide Data Management Models")
         static FServerGetCatalogItemsResult decodeGetCatalogItemsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCatalogItemsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetCatalogItemsResult readGetCatalogItemsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCatalogItemsResult from its views, for a Blueprint that reads them */
+    static void fillGetCatalogItemsResultJsonObjects(FServerGetCatalogItemsResult& result);
+
     /** Decode the GetPublisherDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Title-Wide Data Management Models")
         static FServerGetPublisherDataResult decodeGetPublisherDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPublisherDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetPublisherDataResult readGetPublisherDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPublisherDataResult from its views, for a Blueprint that reads them */
+    static void fillGetPublisherDataResultJsonObjects(FServerGetPublisherDataResult& result);
+
     /** Decode the GetTimeResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Title-Wide Data Management Models")
         static FServerGetTimeResult decodeGetTimeResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetTimeResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetTimeResult readGetTimeResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetTitleDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Title-Wide Data Management Models")
         static FServerGetTitleDataResult decodeGetTitleDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetTitleDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetTitleDataResult readGetTitleDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetTitleDataResult from its views, for a Blueprint that reads them */
+    static void fillGetTitleDataResultJsonObjects(FServerGetTitleDataResult& result);
+
     /** Decode the GetTitleNewsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Title-Wide Data Management Models")
         static FServerGetTitleNewsResult decodeGetTitleNewsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetTitleNewsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetTitleNewsResult readGetTitleNewsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetTitleNewsResult from its views, for a Blueprint that reads them */
+    static void fillGetTitleNewsResultJsonObjects(FServerGetTitleNewsResult& result);
+
     /** Decode the SetPublisherDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Title-Wide Data Management Models")
         static FServerSetPublisherDataResult decodeSetPublisherDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetPublisherDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerSetPublisherDataResult readSetPublisherDataResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the SetTitleDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Title-Wide Data Management Models")
         static FServerSetTitleDataResult decodeSetTitleDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetTitleDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerSetTitleDataResult readSetTitleDataResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -174,74 +351,170 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerModifyCharacterVirtualCurrencyResult decodeModifyCharacterVirtualCurrencyResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ModifyCharacterVirtualCurrencyResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerModifyCharacterVirtualCurrencyResult readModifyCharacterVirtualCurrencyResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the ModifyUserVirtualCurrencyResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerModifyUserVirtualCurrencyResult decodeModifyUserVirtualCurrencyResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ModifyUserVirtualCurrencyResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerModifyUserVirtualCurrencyResult readModifyUserVirtualCurrencyResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the ConsumeItemResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerConsumeItemResult decodeConsumeItemResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ConsumeItemResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerConsumeItemResult readConsumeItemResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the EvaluateRandomResultTableResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerEvaluateRandomResultTableResult decodeEvaluateRandomResultTableResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the EvaluateRandomResultTableResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerEvaluateRandomResultTableResult readEvaluateRandomResultTableResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetCharacterInventoryResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerGetCharacterInventoryResult decodeGetCharacterInventoryResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCharacterInventoryResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetCharacterInventoryResult readGetCharacterInventoryResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCharacterInventoryResult from its views, for a Blueprint that reads them */
+    static void fillGetCharacterInventoryResultJsonObjects(FServerGetCharacterInventoryResult& result);
+
     /** Decode the GetRandomResultTablesResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerGetRandomResultTablesResult decodeGetRandomResultTablesResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetRandomResultTablesResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetRandomResultTablesResult readGetRandomResultTablesResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetRandomResultTablesResult from its views, for a Blueprint that reads them */
+    static void fillGetRandomResultTablesResultJsonObjects(FServerGetRandomResultTablesResult& result);
+
     /** Decode the GetUserInventoryResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerGetUserInventoryResult decodeGetUserInventoryResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetUserInventoryResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetUserInventoryResult readGetUserInventoryResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetUserInventoryResult from its views, for a Blueprint that reads them */
+    static void fillGetUserInventoryResultJsonObjects(FServerGetUserInventoryResult& result);
+
     /** Decode the GrantItemsToCharacterResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerGrantItemsToCharacterResult decodeGrantItemsToCharacterResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GrantItemsToCharacterResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGrantItemsToCharacterResult readGrantItemsToCharacterResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GrantItemsToCharacterResult from its views, for a Blueprint that reads them */
+    static void fillGrantItemsToCharacterResultJsonObjects(FServerGrantItemsToCharacterResult& result);
+
     /** Decode the GrantItemsToUserResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerGrantItemsToUserResult decodeGrantItemsToUserResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GrantItemsToUserResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGrantItemsToUserResult readGrantItemsToUserResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GrantItemsToUserResult from its views, for a Blueprint that reads them */
+    static void fillGrantItemsToUserResultJsonObjects(FServerGrantItemsToUserResult& result);
+
     /** Decode the GrantItemsToUsersResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerGrantItemsToUsersResult decodeGrantItemsToUsersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GrantItemsToUsersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGrantItemsToUsersResult readGrantItemsToUsersResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GrantItemsToUsersResult from its views, for a Blueprint that reads them */
+    static void fillGrantItemsToUsersResultJsonObjects(FServerGrantItemsToUsersResult& result);
+
     /** Decode the ModifyItemUsesResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerModifyItemUsesResult decodeModifyItemUsesResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ModifyItemUsesResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerModifyItemUsesResult readModifyItemUsesResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the MoveItemToCharacterFromCharacterResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerMoveItemToCharacterFromCharacterResult decodeMoveItemToCharacterFromCharacterResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the MoveItemToCharacterFromCharacterResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerMoveItemToCharacterFromCharacterResult readMoveItemToCharacterFromCharacterResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the MoveItemToCharacterFromUserResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerMoveItemToCharacterFromUserResult decodeMoveItemToCharacterFromUserResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the MoveItemToCharacterFromUserResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerMoveItemToCharacterFromUserResult readMoveItemToCharacterFromUserResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the MoveItemToUserFromCharacterResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerMoveItemToUserFromCharacterResult decodeMoveItemToUserFromCharacterResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the MoveItemToUserFromCharacterResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerMoveItemToUserFromCharacterResult readMoveItemToUserFromCharacterResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the RedeemCouponResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerRedeemCouponResult decodeRedeemCouponResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RedeemCouponResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerRedeemCouponResult readRedeemCouponResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a RedeemCouponResult from its views, for a Blueprint that reads them */
+    static void fillRedeemCouponResultJsonObjects(FServerRedeemCouponResult& result);
+
     /** Decode the ReportPlayerServerResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerReportPlayerServerResult decodeReportPlayerServerResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ReportPlayerServerResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerReportPlayerServerResult readReportPlayerServerResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the RevokeInventoryResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerRevokeInventoryResult decodeRevokeInventoryResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RevokeInventoryResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerRevokeInventoryResult readRevokeInventoryResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UnlockContainerItemResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Player Item Management Models")
         static FServerUnlockContainerItemResult decodeUnlockContainerItemResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UnlockContainerItemResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerUnlockContainerItemResult readUnlockContainerItemResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a UnlockContainerItemResult from its views, for a Blueprint that reads them */
+    static void fillUnlockContainerItemResultJsonObjects(FServerUnlockContainerItemResult& result);
+
 
 
     ///////////////////////////////////////////////////////
@@ -252,6 +525,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Friend List Management Models")
         static FServerGetFriendsListResult decodeGetFriendsListResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetFriendsListResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetFriendsListResult readGetFriendsListResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetFriendsListResult from its views, for a Blueprint that reads them */
+    static void fillGetFriendsListResultJsonObjects(FServerGetFriendsListResult& result);
+
 
 
     ///////////////////////////////////////////////////////
@@ -262,34 +542,69 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Matchmaking Models")
         static FServerDeregisterGameResponse decodeDeregisterGameResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the DeregisterGameResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerDeregisterGameResponse readDeregisterGameResponseResponse(const FPlayFabBaseModel& response);
+
     /** Decode the NotifyMatchmakerPlayerLeftResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Matchmaking Models")
         static FServerNotifyMatchmakerPlayerLeftResult decodeNotifyMatchmakerPlayerLeftResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the NotifyMatchmakerPlayerLeftResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerNotifyMatchmakerPlayerLeftResult readNotifyMatchmakerPlayerLeftResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the RedeemMatchmakerTicketResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Matchmaking Models")
         static FServerRedeemMatchmakerTicketResult decodeRedeemMatchmakerTicketResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RedeemMatchmakerTicketResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerRedeemMatchmakerTicketResult readRedeemMatchmakerTicketResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a RedeemMatchmakerTicketResult from its views, for a Blueprint that reads them */
+    static void fillRedeemMatchmakerTicketResultJsonObjects(FServerRedeemMatchmakerTicketResult& result);
+
     /** Decode the RefreshGameServerInstanceHeartbeatResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Matchmaking Models")
         static FServerRefreshGameServerInstanceHeartbeatResult decodeRefreshGameServerInstanceHeartbeatResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RefreshGameServerInstanceHeartbeatResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerRefreshGameServerInstanceHeartbeatResult readRefreshGameServerInstanceHeartbeatResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the RegisterGameResponse response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Matchmaking Models")
         static FServerRegisterGameResponse decodeRegisterGameResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the RegisterGameResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerRegisterGameResponse readRegisterGameResponseResponse(const FPlayFabBaseModel& response);
+
     /** Decode the SetGameServerInstanceDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Matchmaking Models")
         static FServerSetGameServerInstanceDataResult decodeSetGameServerInstanceDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetGameServerInstanceDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerSetGameServerInstanceDataResult readSetGameServerInstanceDataResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the SetGameServerInstanceStateResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Matchmaking Models")
         static FServerSetGameServerInstanceStateResult decodeSetGameServerInstanceStateResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetGameServerInstanceStateResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerSetGameServerInstanceStateResult readSetGameServerInstanceStateResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the SetGameServerInstanceTagsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Matchmaking Models")
         static FServerSetGameServerInstanceTagsResult decodeSetGameServerInstanceTagsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the SetGameServerInstanceTagsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerSetGameServerInstanceTagsResult readSetGameServerInstanceTagsResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -300,6 +615,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Analytics Models")
         static FServerWriteEventResponse decodeWriteEventResponseResponse(UPlayFabJsonObject* response);
 
+    /** Read the WriteEventResponse response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerWriteEventResponse readWriteEventResponseResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -310,22 +629,45 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Shared Group Data Models")
         static FServerAddSharedGroupMembersResult decodeAddSharedGroupMembersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AddSharedGroupMembersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerAddSharedGroupMembersResult readAddSharedGroupMembersResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the CreateSharedGroupResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Shared Group Data Models")
         static FServerCreateSharedGroupResult decodeCreateSharedGroupResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the CreateSharedGroupResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerCreateSharedGroupResult readCreateSharedGroupResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetSharedGroupDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Shared Group Data Models")
         static FServerGetSharedGroupDataResult decodeGetSharedGroupDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetSharedGroupDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetSharedGroupDataResult readGetSharedGroupDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetSharedGroupDataResult from its views, for a Blueprint that reads them */
+    static void fillGetSharedGroupDataResultJsonObjects(FServerGetSharedGroupDataResult& result);
+
     /** Decode the RemoveSharedGroupMembersResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Shared Group Data Models")
         static FServerRemoveSharedGroupMembersResult decodeRemoveSharedGroupMembersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RemoveSharedGroupMembersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerRemoveSharedGroupMembersResult readRemoveSharedGroupMembersResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdateSharedGroupDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Shared Group Data Models")
         static FServerUpdateSharedGroupDataResult decodeUpdateSharedGroupDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateSharedGroupDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerUpdateSharedGroupDataResult readUpdateSharedGroupDataResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -336,6 +678,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Server-Side Cloud Script Models")
         static FServerExecuteCloudScriptResult decodeExecuteCloudScriptResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ExecuteCloudScriptResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerExecuteCloudScriptResult readExecuteCloudScriptResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a ExecuteCloudScriptResult from its views, for a Blueprint that reads them */
+    static void fillExecuteCloudScriptResultJsonObjects(FServerExecuteCloudScriptResult& result);
+
 
 
     ///////////////////////////////////////////////////////
@@ -346,6 +695,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Content Models")
         static FServerGetContentDownloadUrlResult decodeGetContentDownloadUrlResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetContentDownloadUrlResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetContentDownloadUrlResult readGetContentDownloadUrlResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -356,34 +709,81 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Characters Models")
         static FServerDeleteCharacterFromUserResult decodeDeleteCharacterFromUserResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the DeleteCharacterFromUserResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerDeleteCharacterFromUserResult readDeleteCharacterFromUserResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the ListUsersCharactersResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Characters Models")
         static FServerListUsersCharactersResult decodeListUsersCharactersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the ListUsersCharactersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerListUsersCharactersResult readListUsersCharactersResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a ListUsersCharactersResult from its views, for a Blueprint that reads them */
+    static void fillListUsersCharactersResultJsonObjects(FServerListUsersCharactersResult& result);
+
     /** Decode the GetCharacterLeaderboardResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Characters Models")
         static FServerGetCharacterLeaderboardResult decodeGetCharacterLeaderboardResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCharacterLeaderboardResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetCharacterLeaderboardResult readGetCharacterLeaderboardResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCharacterLeaderboardResult from its views, for a Blueprint that reads them */
+    static void fillGetCharacterLeaderboardResultJsonObjects(FServerGetCharacterLeaderboardResult& result);
+
     /** Decode the GetCharacterStatisticsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Characters Models")
         static FServerGetCharacterStatisticsResult decodeGetCharacterStatisticsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCharacterStatisticsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetCharacterStatisticsResult readGetCharacterStatisticsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCharacterStatisticsResult from its views, for a Blueprint that reads them */
+    static void fillGetCharacterStatisticsResultJsonObjects(FServerGetCharacterStatisticsResult& result);
+
     /** Decode the GetLeaderboardAroundCharacterResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Characters Models")
         static FServerGetLeaderboardAroundCharacterResult decodeGetLeaderboardAroundCharacterResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetLeaderboardAroundCharacterResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetLeaderboardAroundCharacterResult readGetLeaderboardAroundCharacterResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetLeaderboardAroundCharacterResult from its views, for a Blueprint that reads them */
+    static void fillGetLeaderboardAroundCharacterResultJsonObjects(FServerGetLeaderboardAroundCharacterResult& result);
+
     /** Decode the GetLeaderboardForUsersCharactersResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Characters Models")
         static FServerGetLeaderboardForUsersCharactersResult decodeGetLeaderboardForUsersCharactersResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetLeaderboardForUsersCharactersResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetLeaderboardForUsersCharactersResult readGetLeaderboardForUsersCharactersResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetLeaderboardForUsersCharactersResult from its views, for a Blueprint that reads them */
+    static void fillGetLeaderboardForUsersCharactersResultJsonObjects(FServerGetLeaderboardForUsersCharactersResult& result);
+
     /** Decode the GrantCharacterToUserResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Characters Models")
         static FServerGrantCharacterToUserResult decodeGrantCharacterToUserResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GrantCharacterToUserResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGrantCharacterToUserResult readGrantCharacterToUserResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the UpdateCharacterStatisticsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Characters Models")
         static FServerUpdateCharacterStatisticsResult decodeUpdateCharacterStatisticsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateCharacterStatisticsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerUpdateCharacterStatisticsResult readUpdateCharacterStatisticsResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -394,10 +794,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Character Data Models")
         static FServerGetCharacterDataResult decodeGetCharacterDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetCharacterDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetCharacterDataResult readGetCharacterDataResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetCharacterDataResult from its views, for a Blueprint that reads them */
+    static void fillGetCharacterDataResultJsonObjects(FServerGetCharacterDataResult& result);
+
     /** Decode the UpdateCharacterDataResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Character Data Models")
         static FServerUpdateCharacterDataResult decodeUpdateCharacterDataResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the UpdateCharacterDataResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerUpdateCharacterDataResult readUpdateCharacterDataResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -414,30 +825,70 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | PlayStream Models")
         static FServerAddPlayerTagResult decodeAddPlayerTagResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AddPlayerTagResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerAddPlayerTagResult readAddPlayerTagResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the GetAllActionGroupsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | PlayStream Models")
         static FServerGetAllActionGroupsResult decodeGetAllActionGroupsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetAllActionGroupsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetAllActionGroupsResult readGetAllActionGroupsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetAllActionGroupsResult from its views, for a Blueprint that reads them */
+    static void fillGetAllActionGroupsResultJsonObjects(FServerGetAllActionGroupsResult& result);
+
     /** Decode the GetAllSegmentsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | PlayStream Models")
         static FServerGetAllSegmentsResult decodeGetAllSegmentsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetAllSegmentsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetAllSegmentsResult readGetAllSegmentsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetAllSegmentsResult from its views, for a Blueprint that reads them */
+    static void fillGetAllSegmentsResultJsonObjects(FServerGetAllSegmentsResult& result);
+
     /** Decode the GetPlayerSegmentsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | PlayStream Models")
         static FServerGetPlayerSegmentsResult decodeGetPlayerSegmentsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerSegmentsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetPlayerSegmentsResult readGetPlayerSegmentsResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayerSegmentsResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayerSegmentsResultJsonObjects(FServerGetPlayerSegmentsResult& result);
+
     /** Decode the GetPlayersInSegmentResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | PlayStream Models")
         static FServerGetPlayersInSegmentResult decodeGetPlayersInSegmentResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayersInSegmentResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetPlayersInSegmentResult readGetPlayersInSegmentResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a GetPlayersInSegmentResult from its views, for a Blueprint that reads them */
+    static void fillGetPlayersInSegmentResultJsonObjects(FServerGetPlayersInSegmentResult& result);
+
     /** Decode the GetPlayerTagsResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | PlayStream Models")
         static FServerGetPlayerTagsResult decodeGetPlayerTagsResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the GetPlayerTagsResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerGetPlayerTagsResult readGetPlayerTagsResultResponse(const FPlayFabBaseModel& response);
+
     /** Decode the RemovePlayerTagResult response object*/
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | PlayStream Models")
         static FServerRemovePlayerTagResult decodeRemovePlayerTagResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the RemovePlayerTagResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerRemovePlayerTagResult readRemovePlayerTagResultResponse(const FPlayFabBaseModel& response);
+
 
 
     ///////////////////////////////////////////////////////
@@ -448,6 +899,13 @@ public:
     UFUNCTION(BlueprintCallable, Category = "PlayFab | Server | Platform Specific Methods Models")
         static FServerAwardSteamAchievementResult decodeAwardSteamAchievementResultResponse(UPlayFabJsonObject* response);
 
+    /** Read the AwardSteamAchievementResult response straight from its body, in one pass */
+    UFUNCTION()
+        static FServerAwardSteamAchievementResult readAwardSteamAchievementResultResponse(const FPlayFabBaseModel& response);
+
+    /** Make the Json Object fields of a AwardSteamAchievementResult from its views, for a Blueprint that reads them */
+    static void fillAwardSteamAchievementResultJsonObjects(FServerAwardSteamAchievementResult& result);
+
 
 
 };
@@ -6,6 +6,7 @@
 
 #include "PlayFabPrivatePCH.h"
 #include "PlayFabAdminModelDecoder.h"
+#include "PlayFabJsonReader.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Admin API Functions
@@ -20,13 +21,44 @@ FAdminCreatePlayerSharedSecretResult UPlayFabAdminModelDecoder::decodeCreatePlay
 {
     // Temp ustruct
     FAdminCreatePlayerSharedSecretResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.SecretKey = !(dataObj->HasField("SecretKey")) ? TEXT("") : dataObj->GetStringField("SecretKey");
+    tempStruct.SecretKey = !(dataObj.HasField("SecretKey")) ? TEXT("") : dataObj.GetStringField("SecretKey");
 
     return tempStruct;
 }
 
+FAdminCreatePlayerSharedSecretResult UPlayFabAdminModelDecoder::readCreatePlayerSharedSecretResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeCreatePlayerSharedSecretResultResponse(Reader.GetFallbackTree(TEXT("CreatePlayerSharedSecretResult"), response));
+    }
+
+    FAdminCreatePlayerSharedSecretResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("SecretKey"):
+            Reader.ReadString(tempStruct.SecretKey);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeCreatePlayerSharedSecretResultResponse(Reader.GetFallbackTree(TEXT("CreatePlayerSharedSecretResult"), response));
+    }
+    return tempStruct;
+}
+
 FAdminDeletePlayerSharedSecretResult UPlayFabAdminModelDecoder::decodeDeletePlayerSharedSecretResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -36,29 +68,110 @@ FAdminDeletePlayerSharedSecretResult UPlayFabAdminModelDecoder::decodeDeletePlay
     return tempStruct;
 }
 
+FAdminDeletePlayerSharedSecretResult UPlayFabAdminModelDecoder::readDeletePlayerSharedSecretResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminDeletePlayerSharedSecretResult();
+}
+
 FAdminGetPlayerSharedSecretsResult UPlayFabAdminModelDecoder::decodeGetPlayerSharedSecretsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetPlayerSharedSecretsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.SharedSecrets = !(dataObj->HasField("SharedSecrets")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("SharedSecrets");
+    tempStruct.SharedSecretsView = !(dataObj.HasField("SharedSecrets")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("SharedSecrets");
 
     return tempStruct;
 }
 
+FAdminGetPlayerSharedSecretsResult UPlayFabAdminModelDecoder::readGetPlayerSharedSecretsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerSharedSecretsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerSharedSecretsResult"), response));
+    }
+
+    FAdminGetPlayerSharedSecretsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("SharedSecrets"):
+            Reader.ReadObjectArray(tempStruct.SharedSecretsView, TEXT("SharedSecrets"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerSharedSecretsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerSharedSecretsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillGetPlayerSharedSecretsResultJsonObjects(FAdminGetPlayerSharedSecretsResult& result)
+{
+    result.SharedSecrets = FPlayFabJsonView::WrapJsonObjects(result.SharedSecretsView);
+}
+
 FAdminGetPolicyResponse UPlayFabAdminModelDecoder::decodeGetPolicyResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetPolicyResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.PolicyName = !(dataObj.HasField("PolicyName")) ? TEXT("") : dataObj.GetStringField("PolicyName");
+    tempStruct.StatementsView = !(dataObj.HasField("Statements")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Statements");
 
-    tempStruct.PolicyName = !(dataObj->HasField("PolicyName")) ? TEXT("") : dataObj->GetStringField("PolicyName");
-    tempStruct.Statements = !(dataObj->HasField("Statements")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Statements");
+    return tempStruct;
+}
+
+FAdminGetPolicyResponse UPlayFabAdminModelDecoder::readGetPolicyResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPolicyResponseResponse(Reader.GetFallbackTree(TEXT("GetPolicyResponse"), response));
+    }
+
+    FAdminGetPolicyResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PolicyName"):
+            Reader.ReadString(tempStruct.PolicyName);
+            break;
+        case FPlayFabJsonReader::Hash("Statements"):
+            Reader.ReadObjectArray(tempStruct.StatementsView, TEXT("Statements"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetPolicyResponseResponse(Reader.GetFallbackTree(TEXT("GetPolicyResponse"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillGetPolicyResponseJsonObjects(FAdminGetPolicyResponse& result)
+{
+    result.Statements = FPlayFabJsonView::WrapJsonObjects(result.StatementsView);
+}
+
 FAdminSetPlayerSecretResult UPlayFabAdminModelDecoder::decodeSetPlayerSecretResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -68,6 +181,12 @@ FAdminSetPlayerSecretResult UPlayFabAdminModelDecoder::decodeSetPlayerSecretResu
     return tempStruct;
 }
 
+FAdminSetPlayerSecretResult UPlayFabAdminModelDecoder::readSetPlayerSecretResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminSetPlayerSecretResult();
+}
+
 FAdminUpdatePlayerSharedSecretResult UPlayFabAdminModelDecoder::decodeUpdatePlayerSharedSecretResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -77,18 +196,63 @@ FAdminUpdatePlayerSharedSecretResult UPlayFabAdminModelDecoder::decodeUpdatePlay
     return tempStruct;
 }
 
+FAdminUpdatePlayerSharedSecretResult UPlayFabAdminModelDecoder::readUpdatePlayerSharedSecretResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminUpdatePlayerSharedSecretResult();
+}
+
 FAdminUpdatePolicyResponse UPlayFabAdminModelDecoder::decodeUpdatePolicyResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminUpdatePolicyResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PolicyName = !(dataObj->HasField("PolicyName")) ? TEXT("") : dataObj->GetStringField("PolicyName");
-    tempStruct.Statements = !(dataObj->HasField("Statements")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Statements");
+    tempStruct.PolicyName = !(dataObj.HasField("PolicyName")) ? TEXT("") : dataObj.GetStringField("PolicyName");
+    tempStruct.StatementsView = !(dataObj.HasField("Statements")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Statements");
 
     return tempStruct;
 }
 
+FAdminUpdatePolicyResponse UPlayFabAdminModelDecoder::readUpdatePolicyResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUpdatePolicyResponseResponse(Reader.GetFallbackTree(TEXT("UpdatePolicyResponse"), response));
+    }
+
+    FAdminUpdatePolicyResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PolicyName"):
+            Reader.ReadString(tempStruct.PolicyName);
+            break;
+        case FPlayFabJsonReader::Hash("Statements"):
+            Reader.ReadObjectArray(tempStruct.StatementsView, TEXT("Statements"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeUpdatePolicyResponseResponse(Reader.GetFallbackTree(TEXT("UpdatePolicyResponse"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillUpdatePolicyResponseJsonObjects(FAdminUpdatePolicyResponse& result)
+{
+    result.Statements = FPlayFabJsonView::WrapJsonObjects(result.StatementsView);
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -99,13 +263,49 @@ FAdminBanUsersResult UPlayFabAdminModelDecoder::decodeBanUsersResultResponse(UPl
 {
     // Temp ustruct
     FAdminBanUsersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.BanDataView = !(dataObj.HasField("BanData")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("BanData");
+
+    return tempStruct;
+}
+
+FAdminBanUsersResult UPlayFabAdminModelDecoder::readBanUsersResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeBanUsersResultResponse(Reader.GetFallbackTree(TEXT("BanUsersResult"), response));
+    }
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    FAdminBanUsersResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BanData"):
+            Reader.ReadObjectArray(tempStruct.BanDataView, TEXT("BanData"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeBanUsersResultResponse(Reader.GetFallbackTree(TEXT("BanUsersResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillBanUsersResultJsonObjects(FAdminBanUsersResult& result)
+{
+    result.BanData = FPlayFabJsonView::WrapJsonObjects(result.BanDataView);
+}
+
 FAdminDeletePlayerResult UPlayFabAdminModelDecoder::decodeDeletePlayerResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -115,28 +315,106 @@ FAdminDeletePlayerResult UPlayFabAdminModelDecoder::decodeDeletePlayerResultResp
     return tempStruct;
 }
 
+FAdminDeletePlayerResult UPlayFabAdminModelDecoder::readDeletePlayerResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminDeletePlayerResult();
+}
+
 FAdminLookupUserAccountInfoResult UPlayFabAdminModelDecoder::decodeLookupUserAccountInfoResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminLookupUserAccountInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.UserInfo = !(dataObj->HasField("UserInfo")) ? nullptr : dataObj->GetObjectField("UserInfo");
+    tempStruct.UserInfoView = !(dataObj.HasField("UserInfo")) ? FPlayFabJsonView() : dataObj.GetObjectField("UserInfo");
 
     return tempStruct;
 }
 
+FAdminLookupUserAccountInfoResult UPlayFabAdminModelDecoder::readLookupUserAccountInfoResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeLookupUserAccountInfoResultResponse(Reader.GetFallbackTree(TEXT("LookupUserAccountInfoResult"), response));
+    }
+
+    FAdminLookupUserAccountInfoResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("UserInfo"):
+            Reader.ReadObject(tempStruct.UserInfoView, TEXT("UserInfo"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeLookupUserAccountInfoResultResponse(Reader.GetFallbackTree(TEXT("LookupUserAccountInfoResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillLookupUserAccountInfoResultJsonObjects(FAdminLookupUserAccountInfoResult& result)
+{
+    result.UserInfo = result.UserInfoView.WrapJsonObject();
+}
+
 FAdminGetUserBansResult UPlayFabAdminModelDecoder::decodeGetUserBansResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetUserBansResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanDataView = !(dataObj.HasField("BanData")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("BanData");
 
     return tempStruct;
 }
 
+FAdminGetUserBansResult UPlayFabAdminModelDecoder::readGetUserBansResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetUserBansResultResponse(Reader.GetFallbackTree(TEXT("GetUserBansResult"), response));
+    }
+
+    FAdminGetUserBansResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BanData"):
+            Reader.ReadObjectArray(tempStruct.BanDataView, TEXT("BanData"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetUserBansResultResponse(Reader.GetFallbackTree(TEXT("GetUserBansResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillGetUserBansResultJsonObjects(FAdminGetUserBansResult& result)
+{
+    result.BanData = FPlayFabJsonView::WrapJsonObjects(result.BanDataView);
+}
+
 FAdminBlankResult UPlayFabAdminModelDecoder::decodeBlankResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -146,28 +424,106 @@ FAdminBlankResult UPlayFabAdminModelDecoder::decodeBlankResultResponse(UPlayFabJ
     return tempStruct;
 }
 
+FAdminBlankResult UPlayFabAdminModelDecoder::readBlankResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminBlankResult();
+}
+
 FAdminRevokeAllBansForUserResult UPlayFabAdminModelDecoder::decodeRevokeAllBansForUserResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminRevokeAllBansForUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.BanDataView = !(dataObj.HasField("BanData")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("BanData");
+
+    return tempStruct;
+}
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+FAdminRevokeAllBansForUserResult UPlayFabAdminModelDecoder::readRevokeAllBansForUserResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeRevokeAllBansForUserResultResponse(Reader.GetFallbackTree(TEXT("RevokeAllBansForUserResult"), response));
+    }
+
+    FAdminRevokeAllBansForUserResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BanData"):
+            Reader.ReadObjectArray(tempStruct.BanDataView, TEXT("BanData"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeRevokeAllBansForUserResultResponse(Reader.GetFallbackTree(TEXT("RevokeAllBansForUserResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillRevokeAllBansForUserResultJsonObjects(FAdminRevokeAllBansForUserResult& result)
+{
+    result.BanData = FPlayFabJsonView::WrapJsonObjects(result.BanDataView);
+}
+
 FAdminRevokeBansResult UPlayFabAdminModelDecoder::decodeRevokeBansResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminRevokeBansResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanDataView = !(dataObj.HasField("BanData")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("BanData");
 
     return tempStruct;
 }
 
+FAdminRevokeBansResult UPlayFabAdminModelDecoder::readRevokeBansResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeRevokeBansResultResponse(Reader.GetFallbackTree(TEXT("RevokeBansResult"), response));
+    }
+
+    FAdminRevokeBansResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BanData"):
+            Reader.ReadObjectArray(tempStruct.BanDataView, TEXT("BanData"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeRevokeBansResultResponse(Reader.GetFallbackTree(TEXT("RevokeBansResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillRevokeBansResultJsonObjects(FAdminRevokeBansResult& result)
+{
+    result.BanData = FPlayFabJsonView::WrapJsonObjects(result.BanDataView);
+}
+
 FAdminSendAccountRecoveryEmailResult UPlayFabAdminModelDecoder::decodeSendAccountRecoveryEmailResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -177,28 +533,101 @@ FAdminSendAccountRecoveryEmailResult UPlayFabAdminModelDecoder::decodeSendAccoun
     return tempStruct;
 }
 
+FAdminSendAccountRecoveryEmailResult UPlayFabAdminModelDecoder::readSendAccountRecoveryEmailResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminSendAccountRecoveryEmailResult();
+}
+
 FAdminUpdateBansResult UPlayFabAdminModelDecoder::decodeUpdateBansResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminUpdateBansResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.BanDataView = !(dataObj.HasField("BanData")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("BanData");
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    return tempStruct;
+}
+
+FAdminUpdateBansResult UPlayFabAdminModelDecoder::readUpdateBansResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUpdateBansResultResponse(Reader.GetFallbackTree(TEXT("UpdateBansResult"), response));
+    }
+
+    FAdminUpdateBansResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BanData"):
+            Reader.ReadObjectArray(tempStruct.BanDataView, TEXT("BanData"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeUpdateBansResultResponse(Reader.GetFallbackTree(TEXT("UpdateBansResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillUpdateBansResultJsonObjects(FAdminUpdateBansResult& result)
+{
+    result.BanData = FPlayFabJsonView::WrapJsonObjects(result.BanDataView);
+}
+
 FAdminUpdateUserTitleDisplayNameResult UPlayFabAdminModelDecoder::decodeUpdateUserTitleDisplayNameResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminUpdateUserTitleDisplayNameResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.DisplayName = !(dataObj->HasField("DisplayName")) ? TEXT("") : dataObj->GetStringField("DisplayName");
+    tempStruct.DisplayName = !(dataObj.HasField("DisplayName")) ? TEXT("") : dataObj.GetStringField("DisplayName");
 
     return tempStruct;
 }
 
+FAdminUpdateUserTitleDisplayNameResult UPlayFabAdminModelDecoder::readUpdateUserTitleDisplayNameResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUpdateUserTitleDisplayNameResultResponse(Reader.GetFallbackTree(TEXT("UpdateUserTitleDisplayNameResult"), response));
+    }
+
+    FAdminUpdateUserTitleDisplayNameResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("DisplayName"):
+            Reader.ReadString(tempStruct.DisplayName);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeUpdateUserTitleDisplayNameResultResponse(Reader.GetFallbackTree(TEXT("UpdateUserTitleDisplayNameResult"), response));
+    }
+    return tempStruct;
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -209,13 +638,49 @@ FAdminCreatePlayerStatisticDefinitionResult UPlayFabAdminModelDecoder::decodeCre
 {
     // Temp ustruct
     FAdminCreatePlayerStatisticDefinitionResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.StatisticView = !(dataObj.HasField("Statistic")) ? FPlayFabJsonView() : dataObj.GetObjectField("Statistic");
+
+    return tempStruct;
+}
+
+FAdminCreatePlayerStatisticDefinitionResult UPlayFabAdminModelDecoder::readCreatePlayerStatisticDefinitionResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeCreatePlayerStatisticDefinitionResultResponse(Reader.GetFallbackTree(TEXT("CreatePlayerStatisticDefinitionResult"), response));
+    }
 
-    tempStruct.Statistic = !(dataObj->HasField("Statistic")) ? nullptr : dataObj->GetObjectField("Statistic");
+    FAdminCreatePlayerStatisticDefinitionResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Statistic"):
+            Reader.ReadObject(tempStruct.StatisticView, TEXT("Statistic"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeCreatePlayerStatisticDefinitionResultResponse(Reader.GetFallbackTree(TEXT("CreatePlayerStatisticDefinitionResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillCreatePlayerStatisticDefinitionResultJsonObjects(FAdminCreatePlayerStatisticDefinitionResult& result)
+{
+    result.Statistic = result.StatisticView.WrapJsonObject();
+}
+
 FAdminDeleteUsersResult UPlayFabAdminModelDecoder::decodeDeleteUsersResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -225,14 +690,51 @@ FAdminDeleteUsersResult UPlayFabAdminModelDecoder::decodeDeleteUsersResultRespon
     return tempStruct;
 }
 
+FAdminDeleteUsersResult UPlayFabAdminModelDecoder::readDeleteUsersResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminDeleteUsersResult();
+}
+
 FAdminGetDataReportResult UPlayFabAdminModelDecoder::decodeGetDataReportResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetDataReportResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.DownloadUrl = !(dataObj.HasField("DownloadUrl")) ? TEXT("") : dataObj.GetStringField("DownloadUrl");
 
-    tempStruct.DownloadUrl = !(dataObj->HasField("DownloadUrl")) ? TEXT("") : dataObj->GetStringField("DownloadUrl");
+    return tempStruct;
+}
 
+FAdminGetDataReportResult UPlayFabAdminModelDecoder::readGetDataReportResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetDataReportResultResponse(Reader.GetFallbackTree(TEXT("GetDataReportResult"), response));
+    }
+
+    FAdminGetDataReportResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("DownloadUrl"):
+            Reader.ReadString(tempStruct.DownloadUrl);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetDataReportResultResponse(Reader.GetFallbackTree(TEXT("GetDataReportResult"), response));
+    }
     return tempStruct;
 }
 
@@ -240,59 +742,240 @@ FAdminGetPlayerStatisticDefinitionsResult UPlayFabAdminModelDecoder::decodeGetPl
 {
     // Temp ustruct
     FAdminGetPlayerStatisticDefinitionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Statistics = !(dataObj->HasField("Statistics")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Statistics");
+    tempStruct.StatisticsView = !(dataObj.HasField("Statistics")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Statistics");
 
     return tempStruct;
 }
 
+FAdminGetPlayerStatisticDefinitionsResult UPlayFabAdminModelDecoder::readGetPlayerStatisticDefinitionsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerStatisticDefinitionsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerStatisticDefinitionsResult"), response));
+    }
+
+    FAdminGetPlayerStatisticDefinitionsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Statistics"):
+            Reader.ReadObjectArray(tempStruct.StatisticsView, TEXT("Statistics"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerStatisticDefinitionsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerStatisticDefinitionsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillGetPlayerStatisticDefinitionsResultJsonObjects(FAdminGetPlayerStatisticDefinitionsResult& result)
+{
+    result.Statistics = FPlayFabJsonView::WrapJsonObjects(result.StatisticsView);
+}
+
 FAdminGetPlayerStatisticVersionsResult UPlayFabAdminModelDecoder::decodeGetPlayerStatisticVersionsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetPlayerStatisticVersionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.StatisticVersionsView = !(dataObj.HasField("StatisticVersions")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("StatisticVersions");
+
+    return tempStruct;
+}
 
-    tempStruct.StatisticVersions = !(dataObj->HasField("StatisticVersions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("StatisticVersions");
+FAdminGetPlayerStatisticVersionsResult UPlayFabAdminModelDecoder::readGetPlayerStatisticVersionsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerStatisticVersionsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerStatisticVersionsResult"), response));
+    }
+
+    FAdminGetPlayerStatisticVersionsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("StatisticVersions"):
+            Reader.ReadObjectArray(tempStruct.StatisticVersionsView, TEXT("StatisticVersions"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerStatisticVersionsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerStatisticVersionsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillGetPlayerStatisticVersionsResultJsonObjects(FAdminGetPlayerStatisticVersionsResult& result)
+{
+    result.StatisticVersions = FPlayFabJsonView::WrapJsonObjects(result.StatisticVersionsView);
+}
+
 FAdminGetUserDataResult UPlayFabAdminModelDecoder::decodeGetUserDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetUserDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.DataVersion = !(dataObj.HasField("DataVersion")) ? 0 : int(dataObj.GetNumberField("DataVersion"));
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
 
     return tempStruct;
 }
 
+FAdminGetUserDataResult UPlayFabAdminModelDecoder::readGetUserDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetUserDataResultResponse(Reader.GetFallbackTree(TEXT("GetUserDataResult"), response));
+    }
+
+    FAdminGetUserDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("DataVersion"):
+            Reader.ReadInt(tempStruct.DataVersion);
+            break;
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetUserDataResultResponse(Reader.GetFallbackTree(TEXT("GetUserDataResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillGetUserDataResultJsonObjects(FAdminGetUserDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
+}
+
 FAdminIncrementPlayerStatisticVersionResult UPlayFabAdminModelDecoder::decodeIncrementPlayerStatisticVersionResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminIncrementPlayerStatisticVersionResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.StatisticVersionView = !(dataObj.HasField("StatisticVersion")) ? FPlayFabJsonView() : dataObj.GetObjectField("StatisticVersion");
+
+    return tempStruct;
+}
 
-    tempStruct.StatisticVersion = !(dataObj->HasField("StatisticVersion")) ? nullptr : dataObj->GetObjectField("StatisticVersion");
+FAdminIncrementPlayerStatisticVersionResult UPlayFabAdminModelDecoder::readIncrementPlayerStatisticVersionResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeIncrementPlayerStatisticVersionResultResponse(Reader.GetFallbackTree(TEXT("IncrementPlayerStatisticVersionResult"), response));
+    }
+
+    FAdminIncrementPlayerStatisticVersionResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("StatisticVersion"):
+            Reader.ReadObject(tempStruct.StatisticVersionView, TEXT("StatisticVersion"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeIncrementPlayerStatisticVersionResultResponse(Reader.GetFallbackTree(TEXT("IncrementPlayerStatisticVersionResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillIncrementPlayerStatisticVersionResultJsonObjects(FAdminIncrementPlayerStatisticVersionResult& result)
+{
+    result.StatisticVersion = result.StatisticVersionView.WrapJsonObject();
+}
+
 FAdminRefundPurchaseResponse UPlayFabAdminModelDecoder::decodeRefundPurchaseResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminRefundPurchaseResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PurchaseStatus = !(dataObj->HasField("PurchaseStatus")) ? TEXT("") : dataObj->GetStringField("PurchaseStatus");
+    tempStruct.PurchaseStatus = !(dataObj.HasField("PurchaseStatus")) ? TEXT("") : dataObj.GetStringField("PurchaseStatus");
 
     return tempStruct;
 }
 
+FAdminRefundPurchaseResponse UPlayFabAdminModelDecoder::readRefundPurchaseResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeRefundPurchaseResponseResponse(Reader.GetFallbackTree(TEXT("RefundPurchaseResponse"), response));
+    }
+
+    FAdminRefundPurchaseResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PurchaseStatus"):
+            Reader.ReadString(tempStruct.PurchaseStatus);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeRefundPurchaseResponseResponse(Reader.GetFallbackTree(TEXT("RefundPurchaseResponse"), response));
+    }
+    return tempStruct;
+}
+
 FAdminResetUserStatisticsResult UPlayFabAdminModelDecoder::decodeResetUserStatisticsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -302,14 +985,51 @@ FAdminResetUserStatisticsResult UPlayFabAdminModelDecoder::decodeResetUserStatis
     return tempStruct;
 }
 
+FAdminResetUserStatisticsResult UPlayFabAdminModelDecoder::readResetUserStatisticsResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminResetUserStatisticsResult();
+}
+
 FAdminResolvePurchaseDisputeResponse UPlayFabAdminModelDecoder::decodeResolvePurchaseDisputeResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminResolvePurchaseDisputeResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.PurchaseStatus = !(dataObj.HasField("PurchaseStatus")) ? TEXT("") : dataObj.GetStringField("PurchaseStatus");
+
+    return tempStruct;
+}
 
-    tempStruct.PurchaseStatus = !(dataObj->HasField("PurchaseStatus")) ? TEXT("") : dataObj->GetStringField("PurchaseStatus");
+FAdminResolvePurchaseDisputeResponse UPlayFabAdminModelDecoder::readResolvePurchaseDisputeResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeResolvePurchaseDisputeResponseResponse(Reader.GetFallbackTree(TEXT("ResolvePurchaseDisputeResponse"), response));
+    }
 
+    FAdminResolvePurchaseDisputeResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PurchaseStatus"):
+            Reader.ReadString(tempStruct.PurchaseStatus);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeResolvePurchaseDisputeResponseResponse(Reader.GetFallbackTree(TEXT("ResolvePurchaseDisputeResponse"), response));
+    }
     return tempStruct;
 }
 
@@ -317,24 +1037,91 @@ FAdminUpdatePlayerStatisticDefinitionResult UPlayFabAdminModelDecoder::decodeUpd
 {
     // Temp ustruct
     FAdminUpdatePlayerStatisticDefinitionResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Statistic = !(dataObj->HasField("Statistic")) ? nullptr : dataObj->GetObjectField("Statistic");
+    tempStruct.StatisticView = !(dataObj.HasField("Statistic")) ? FPlayFabJsonView() : dataObj.GetObjectField("Statistic");
 
     return tempStruct;
 }
 
+FAdminUpdatePlayerStatisticDefinitionResult UPlayFabAdminModelDecoder::readUpdatePlayerStatisticDefinitionResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUpdatePlayerStatisticDefinitionResultResponse(Reader.GetFallbackTree(TEXT("UpdatePlayerStatisticDefinitionResult"), response));
+    }
+
+    FAdminUpdatePlayerStatisticDefinitionResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Statistic"):
+            Reader.ReadObject(tempStruct.StatisticView, TEXT("Statistic"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeUpdatePlayerStatisticDefinitionResultResponse(Reader.GetFallbackTree(TEXT("UpdatePlayerStatisticDefinitionResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillUpdatePlayerStatisticDefinitionResultJsonObjects(FAdminUpdatePlayerStatisticDefinitionResult& result)
+{
+    result.Statistic = result.StatisticView.WrapJsonObject();
+}
+
 FAdminUpdateUserDataResult UPlayFabAdminModelDecoder::decodeUpdateUserDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminUpdateUserDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+    tempStruct.DataVersion = !(dataObj.HasField("DataVersion")) ? 0 : int(dataObj.GetNumberField("DataVersion"));
 
     return tempStruct;
 }
 
+FAdminUpdateUserDataResult UPlayFabAdminModelDecoder::readUpdateUserDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUpdateUserDataResultResponse(Reader.GetFallbackTree(TEXT("UpdateUserDataResult"), response));
+    }
+
+    FAdminUpdateUserDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("DataVersion"):
+            Reader.ReadInt(tempStruct.DataVersion);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeUpdateUserDataResultResponse(Reader.GetFallbackTree(TEXT("UpdateUserDataResult"), response));
+    }
+    return tempStruct;
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -345,13 +1132,44 @@ FAdminAddNewsResult UPlayFabAdminModelDecoder::decodeAddNewsResultResponse(UPlay
 {
     // Temp ustruct
     FAdminAddNewsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.NewsId = !(dataObj->HasField("NewsId")) ? TEXT("") : dataObj->GetStringField("NewsId");
+    tempStruct.NewsId = !(dataObj.HasField("NewsId")) ? TEXT("") : dataObj.GetStringField("NewsId");
 
     return tempStruct;
 }
 
+FAdminAddNewsResult UPlayFabAdminModelDecoder::readAddNewsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeAddNewsResultResponse(Reader.GetFallbackTree(TEXT("AddNewsResult"), response));
+    }
+
+    FAdminAddNewsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("NewsId"):
+            Reader.ReadString(tempStruct.NewsId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeAddNewsResultResponse(Reader.GetFallbackTree(TEXT("AddNewsResult"), response));
+    }
+    return tempStruct;
+}
+
 FAdminDeleteStoreResult UPlayFabAdminModelDecoder::decodeDeleteStoreResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -361,76 +1179,311 @@ FAdminDeleteStoreResult UPlayFabAdminModelDecoder::decodeDeleteStoreResultRespon
     return tempStruct;
 }
 
+FAdminDeleteStoreResult UPlayFabAdminModelDecoder::readDeleteStoreResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminDeleteStoreResult();
+}
+
 FAdminGetCatalogItemsResult UPlayFabAdminModelDecoder::decodeGetCatalogItemsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetCatalogItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.CatalogView = !(dataObj.HasField("Catalog")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Catalog");
+
+    return tempStruct;
+}
 
-    tempStruct.Catalog = !(dataObj->HasField("Catalog")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Catalog");
+FAdminGetCatalogItemsResult UPlayFabAdminModelDecoder::readGetCatalogItemsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCatalogItemsResultResponse(Reader.GetFallbackTree(TEXT("GetCatalogItemsResult"), response));
+    }
+
+    FAdminGetCatalogItemsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Catalog"):
+            Reader.ReadObjectArray(tempStruct.CatalogView, TEXT("Catalog"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetCatalogItemsResultResponse(Reader.GetFallbackTree(TEXT("GetCatalogItemsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillGetCatalogItemsResultJsonObjects(FAdminGetCatalogItemsResult& result)
+{
+    result.Catalog = FPlayFabJsonView::WrapJsonObjects(result.CatalogView);
+}
+
 FAdminGetPublisherDataResult UPlayFabAdminModelDecoder::decodeGetPublisherDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetPublisherDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
 
     return tempStruct;
 }
 
+FAdminGetPublisherDataResult UPlayFabAdminModelDecoder::readGetPublisherDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPublisherDataResultResponse(Reader.GetFallbackTree(TEXT("GetPublisherDataResult"), response));
+    }
+
+    FAdminGetPublisherDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPublisherDataResultResponse(Reader.GetFallbackTree(TEXT("GetPublisherDataResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillGetPublisherDataResultJsonObjects(FAdminGetPublisherDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
+}
+
 FAdminGetRandomResultTablesResult UPlayFabAdminModelDecoder::decodeGetRandomResultTablesResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetRandomResultTablesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Tables = !(dataObj->HasField("Tables")) ? nullptr : dataObj->GetObjectField("Tables");
+    tempStruct.TablesView = !(dataObj.HasField("Tables")) ? FPlayFabJsonView() : dataObj.GetObjectField("Tables");
 
     return tempStruct;
 }
 
+FAdminGetRandomResultTablesResult UPlayFabAdminModelDecoder::readGetRandomResultTablesResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetRandomResultTablesResultResponse(Reader.GetFallbackTree(TEXT("GetRandomResultTablesResult"), response));
+    }
+
+    FAdminGetRandomResultTablesResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Tables"):
+            Reader.ReadObject(tempStruct.TablesView, TEXT("Tables"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetRandomResultTablesResultResponse(Reader.GetFallbackTree(TEXT("GetRandomResultTablesResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillGetRandomResultTablesResultJsonObjects(FAdminGetRandomResultTablesResult& result)
+{
+    result.Tables = result.TablesView.WrapJsonObject();
+}
+
 FAdminGetStoreItemsResult UPlayFabAdminModelDecoder::decodeGetStoreItemsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetStoreItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Store = !(dataObj->HasField("Store")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Store");
-    GetEnumValueFromString<EPfSourceType>(TEXT("EPfSourceType"), dataObj->GetStringField("Source"), tempStruct.Source);
-    tempStruct.CatalogVersion = !(dataObj->HasField("CatalogVersion")) ? TEXT("") : dataObj->GetStringField("CatalogVersion");
-    tempStruct.StoreId = !(dataObj->HasField("StoreId")) ? TEXT("") : dataObj->GetStringField("StoreId");
-    tempStruct.MarketingData = !(dataObj->HasField("MarketingData")) ? nullptr : dataObj->GetObjectField("MarketingData");
+    tempStruct.StoreView = !(dataObj.HasField("Store")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Store");
+    GetEnumValueFromString<EPfSourceType>(TEXT("EPfSourceType"), dataObj.GetStringField("Source"), tempStruct.Source);
+    tempStruct.CatalogVersion = !(dataObj.HasField("CatalogVersion")) ? TEXT("") : dataObj.GetStringField("CatalogVersion");
+    tempStruct.StoreId = !(dataObj.HasField("StoreId")) ? TEXT("") : dataObj.GetStringField("StoreId");
+    tempStruct.MarketingDataView = !(dataObj.HasField("MarketingData")) ? FPlayFabJsonView() : dataObj.GetObjectField("MarketingData");
+
+    return tempStruct;
+}
+
+FAdminGetStoreItemsResult UPlayFabAdminModelDecoder::readGetStoreItemsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetStoreItemsResultResponse(Reader.GetFallbackTree(TEXT("GetStoreItemsResult"), response));
+    }
+
+    FAdminGetStoreItemsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Store"):
+            Reader.ReadObjectArray(tempStruct.StoreView, TEXT("Store"));
+            break;
+        case FPlayFabJsonReader::Hash("Source"):
+            Reader.ReadEnum(tempStruct.Source);
+            break;
+        case FPlayFabJsonReader::Hash("CatalogVersion"):
+            Reader.ReadString(tempStruct.CatalogVersion);
+            break;
+        case FPlayFabJsonReader::Hash("StoreId"):
+            Reader.ReadString(tempStruct.StoreId);
+            break;
+        case FPlayFabJsonReader::Hash("MarketingData"):
+            Reader.ReadObject(tempStruct.MarketingDataView, TEXT("MarketingData"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetStoreItemsResultResponse(Reader.GetFallbackTree(TEXT("GetStoreItemsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillGetStoreItemsResultJsonObjects(FAdminGetStoreItemsResult& result)
+{
+    result.Store = FPlayFabJsonView::WrapJsonObjects(result.StoreView);
+    result.MarketingData = result.MarketingDataView.WrapJsonObject();
+}
+
+FAdminGetTitleDataResult UPlayFabAdminModelDecoder::decodeGetTitleDataResultResponse(UPlayFabJsonObject* response)
+{
+    // Temp ustruct
+    FAdminGetTitleDataResult tempStruct;
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
+
+    return tempStruct;
+}
+
+FAdminGetTitleDataResult UPlayFabAdminModelDecoder::readGetTitleDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetTitleDataResultResponse(Reader.GetFallbackTree(TEXT("GetTitleDataResult"), response));
+    }
+
+    FAdminGetTitleDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetTitleDataResultResponse(Reader.GetFallbackTree(TEXT("GetTitleDataResult"), response));
+    }
+    return tempStruct;
+}
 
-    return tempStruct;
+void UPlayFabAdminModelDecoder::fillGetTitleDataResultJsonObjects(FAdminGetTitleDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
 }
 
-FAdminGetTitleDataResult UPlayFabAdminModelDecoder::decodeGetTitleDataResultResponse(UPlayFabJsonObject* response)
+FAdminListVirtualCurrencyTypesResult UPlayFabAdminModelDecoder::decodeListVirtualCurrencyTypesResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
-    FAdminGetTitleDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    FAdminListVirtualCurrencyTypesResult tempStruct;
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.VirtualCurrenciesView = !(dataObj.HasField("VirtualCurrencies")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("VirtualCurrencies");
 
     return tempStruct;
 }
 
-FAdminListVirtualCurrencyTypesResult UPlayFabAdminModelDecoder::decodeListVirtualCurrencyTypesResultResponse(UPlayFabJsonObject* response)
+FAdminListVirtualCurrencyTypesResult UPlayFabAdminModelDecoder::readListVirtualCurrencyTypesResultResponse(const FPlayFabBaseModel& response)
 {
-    // Temp ustruct
-    FAdminListVirtualCurrencyTypesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeListVirtualCurrencyTypesResultResponse(Reader.GetFallbackTree(TEXT("ListVirtualCurrencyTypesResult"), response));
+    }
 
-    tempStruct.VirtualCurrencies = !(dataObj->HasField("VirtualCurrencies")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("VirtualCurrencies");
+    FAdminListVirtualCurrencyTypesResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("VirtualCurrencies"):
+            Reader.ReadObjectArray(tempStruct.VirtualCurrenciesView, TEXT("VirtualCurrencies"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeListVirtualCurrencyTypesResultResponse(Reader.GetFallbackTree(TEXT("ListVirtualCurrencyTypesResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillListVirtualCurrencyTypesResultJsonObjects(FAdminListVirtualCurrencyTypesResult& result)
+{
+    result.VirtualCurrencies = FPlayFabJsonView::WrapJsonObjects(result.VirtualCurrenciesView);
+}
+
 FAdminUpdateCatalogItemsResult UPlayFabAdminModelDecoder::decodeUpdateCatalogItemsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -440,6 +1493,12 @@ FAdminUpdateCatalogItemsResult UPlayFabAdminModelDecoder::decodeUpdateCatalogIte
     return tempStruct;
 }
 
+FAdminUpdateCatalogItemsResult UPlayFabAdminModelDecoder::readUpdateCatalogItemsResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminUpdateCatalogItemsResult();
+}
+
 FAdminUpdateStoreItemsResult UPlayFabAdminModelDecoder::decodeUpdateStoreItemsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -449,6 +1508,12 @@ FAdminUpdateStoreItemsResult UPlayFabAdminModelDecoder::decodeUpdateStoreItemsRe
     return tempStruct;
 }
 
+FAdminUpdateStoreItemsResult UPlayFabAdminModelDecoder::readUpdateStoreItemsResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminUpdateStoreItemsResult();
+}
+
 FAdminSetTitleDataResult UPlayFabAdminModelDecoder::decodeSetTitleDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -458,14 +1523,51 @@ FAdminSetTitleDataResult UPlayFabAdminModelDecoder::decodeSetTitleDataResultResp
     return tempStruct;
 }
 
+FAdminSetTitleDataResult UPlayFabAdminModelDecoder::readSetTitleDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminSetTitleDataResult();
+}
+
 FAdminSetupPushNotificationResult UPlayFabAdminModelDecoder::decodeSetupPushNotificationResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminSetupPushNotificationResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.ARN = !(dataObj.HasField("ARN")) ? TEXT("") : dataObj.GetStringField("ARN");
+
+    return tempStruct;
+}
 
-    tempStruct.ARN = !(dataObj->HasField("ARN")) ? TEXT("") : dataObj->GetStringField("ARN");
+FAdminSetupPushNotificationResult UPlayFabAdminModelDecoder::readSetupPushNotificationResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeSetupPushNotificationResultResponse(Reader.GetFallbackTree(TEXT("SetupPushNotificationResult"), response));
+    }
 
+    FAdminSetupPushNotificationResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ARN"):
+            Reader.ReadString(tempStruct.ARN);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeSetupPushNotificationResultResponse(Reader.GetFallbackTree(TEXT("SetupPushNotificationResult"), response));
+    }
     return tempStruct;
 }
 
@@ -478,6 +1580,12 @@ FAdminUpdateRandomResultTablesResult UPlayFabAdminModelDecoder::decodeUpdateRand
     return tempStruct;
 }
 
+FAdminUpdateRandomResultTablesResult UPlayFabAdminModelDecoder::readUpdateRandomResultTablesResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminUpdateRandomResultTablesResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -488,13 +1596,53 @@ FAdminModifyUserVirtualCurrencyResult UPlayFabAdminModelDecoder::decodeModifyUse
 {
     // Temp ustruct
     FAdminModifyUserVirtualCurrencyResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.VirtualCurrency = !(dataObj.HasField("VirtualCurrency")) ? TEXT("") : dataObj.GetStringField("VirtualCurrency");
+    tempStruct.BalanceChange = !(dataObj.HasField("BalanceChange")) ? 0 : int(dataObj.GetNumberField("BalanceChange"));
+    tempStruct.Balance = !(dataObj.HasField("Balance")) ? 0 : int(dataObj.GetNumberField("Balance"));
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? TEXT("") : dataObj->GetStringField("VirtualCurrency");
-    tempStruct.BalanceChange = !(dataObj->HasField("BalanceChange")) ? 0 : int(dataObj->GetNumberField("BalanceChange"));
-    tempStruct.Balance = !(dataObj->HasField("Balance")) ? 0 : int(dataObj->GetNumberField("Balance"));
+    return tempStruct;
+}
+
+FAdminModifyUserVirtualCurrencyResult UPlayFabAdminModelDecoder::readModifyUserVirtualCurrencyResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeModifyUserVirtualCurrencyResultResponse(Reader.GetFallbackTree(TEXT("ModifyUserVirtualCurrencyResult"), response));
+    }
 
+    FAdminModifyUserVirtualCurrencyResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadString(tempStruct.VirtualCurrency);
+            break;
+        case FPlayFabJsonReader::Hash("BalanceChange"):
+            Reader.ReadInt(tempStruct.BalanceChange);
+            break;
+        case FPlayFabJsonReader::Hash("Balance"):
+            Reader.ReadInt(tempStruct.Balance);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeModifyUserVirtualCurrencyResultResponse(Reader.GetFallbackTree(TEXT("ModifyUserVirtualCurrencyResult"), response));
+    }
     return tempStruct;
 }
 
@@ -502,27 +1650,110 @@ FAdminGetUserInventoryResult UPlayFabAdminModelDecoder::decodeGetUserInventoryRe
 {
     // Temp ustruct
     FAdminGetUserInventoryResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.Inventory = !(dataObj->HasField("Inventory")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Inventory");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.VirtualCurrencyRechargeTimes = !(dataObj->HasField("VirtualCurrencyRechargeTimes")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyRechargeTimes");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.InventoryView = !(dataObj.HasField("Inventory")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Inventory");
+    tempStruct.VirtualCurrencyView = !(dataObj.HasField("VirtualCurrency")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrency");
+    tempStruct.VirtualCurrencyRechargeTimesView = !(dataObj.HasField("VirtualCurrencyRechargeTimes")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrencyRechargeTimes");
 
     return tempStruct;
 }
 
+FAdminGetUserInventoryResult UPlayFabAdminModelDecoder::readGetUserInventoryResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetUserInventoryResultResponse(Reader.GetFallbackTree(TEXT("GetUserInventoryResult"), response));
+    }
+
+    FAdminGetUserInventoryResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("Inventory"):
+            Reader.ReadObjectArray(tempStruct.InventoryView, TEXT("Inventory"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyView, TEXT("VirtualCurrency"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrencyRechargeTimes"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyRechargeTimesView, TEXT("VirtualCurrencyRechargeTimes"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetUserInventoryResultResponse(Reader.GetFallbackTree(TEXT("GetUserInventoryResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillGetUserInventoryResultJsonObjects(FAdminGetUserInventoryResult& result)
+{
+    result.Inventory = FPlayFabJsonView::WrapJsonObjects(result.InventoryView);
+    result.VirtualCurrency = result.VirtualCurrencyView.WrapJsonObject();
+    result.VirtualCurrencyRechargeTimes = result.VirtualCurrencyRechargeTimesView.WrapJsonObject();
+}
+
 FAdminGrantItemsToUsersResult UPlayFabAdminModelDecoder::decodeGrantItemsToUsersResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGrantItemsToUsersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.ItemGrantResultsView = !(dataObj.HasField("ItemGrantResults")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("ItemGrantResults");
+
+    return tempStruct;
+}
+
+FAdminGrantItemsToUsersResult UPlayFabAdminModelDecoder::readGrantItemsToUsersResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGrantItemsToUsersResultResponse(Reader.GetFallbackTree(TEXT("GrantItemsToUsersResult"), response));
+    }
 
-    tempStruct.ItemGrantResults = !(dataObj->HasField("ItemGrantResults")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ItemGrantResults");
+    FAdminGrantItemsToUsersResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ItemGrantResults"):
+            Reader.ReadObjectArray(tempStruct.ItemGrantResultsView, TEXT("ItemGrantResults"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGrantItemsToUsersResultResponse(Reader.GetFallbackTree(TEXT("GrantItemsToUsersResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillGrantItemsToUsersResultJsonObjects(FAdminGrantItemsToUsersResult& result)
+{
+    result.ItemGrantResults = FPlayFabJsonView::WrapJsonObjects(result.ItemGrantResultsView);
+}
+
 FAdminRevokeInventoryResult UPlayFabAdminModelDecoder::decodeRevokeInventoryResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -532,6 +1763,12 @@ FAdminRevokeInventoryResult UPlayFabAdminModelDecoder::decodeRevokeInventoryResu
     return tempStruct;
 }
 
+FAdminRevokeInventoryResult UPlayFabAdminModelDecoder::readRevokeInventoryResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminRevokeInventoryResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -542,19 +1779,77 @@ FAdminGetMatchmakerGameInfoResult UPlayFabAdminModelDecoder::decodeGetMatchmaker
 {
     // Temp ustruct
     FAdminGetMatchmakerGameInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.LobbyId = !(dataObj.HasField("LobbyId")) ? TEXT("") : dataObj.GetStringField("LobbyId");
+    tempStruct.TitleId = !(dataObj.HasField("TitleId")) ? TEXT("") : dataObj.GetStringField("TitleId");
+    tempStruct.StartTime = !(dataObj.HasField("StartTime")) ? TEXT("") : dataObj.GetStringField("StartTime");
+    tempStruct.EndTime = !(dataObj.HasField("EndTime")) ? TEXT("") : dataObj.GetStringField("EndTime");
+    tempStruct.Mode = !(dataObj.HasField("Mode")) ? TEXT("") : dataObj.GetStringField("Mode");
+    tempStruct.BuildVersion = !(dataObj.HasField("BuildVersion")) ? TEXT("") : dataObj.GetStringField("BuildVersion");
+    GetEnumValueFromString<ERegion>(TEXT("ERegion"), dataObj.GetStringField("Region"), tempStruct.Region);
+    tempStruct.Players = !(dataObj.HasField("Players")) ? TEXT("") : FString::Join(dataObj.GetStringArrayField("Players"), TEXT(","));
+    tempStruct.ServerAddress = !(dataObj.HasField("ServerAddress")) ? TEXT("") : dataObj.GetStringField("ServerAddress");
+    tempStruct.ServerPort = !(dataObj.HasField("ServerPort")) ? 0 : int(dataObj.GetNumberField("ServerPort"));
 
-    tempStruct.LobbyId = !(dataObj->HasField("LobbyId")) ? TEXT("") : dataObj->GetStringField("LobbyId");
-    tempStruct.TitleId = !(dataObj->HasField("TitleId")) ? TEXT("") : dataObj->GetStringField("TitleId");
-    tempStruct.StartTime = !(dataObj->HasField("StartTime")) ? TEXT("") : dataObj->GetStringField("StartTime");
-    tempStruct.EndTime = !(dataObj->HasField("EndTime")) ? TEXT("") : dataObj->GetStringField("EndTime");
-    tempStruct.Mode = !(dataObj->HasField("Mode")) ? TEXT("") : dataObj->GetStringField("Mode");
-    tempStruct.BuildVersion = !(dataObj->HasField("BuildVersion")) ? TEXT("") : dataObj->GetStringField("BuildVersion");
-    GetEnumValueFromString<ERegion>(TEXT("ERegion"), dataObj->GetStringField("Region"), tempStruct.Region);
-    tempStruct.Players = !(dataObj->HasField("Players")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Players"), TEXT(","));
-    tempStruct.ServerAddress = !(dataObj->HasField("ServerAddress")) ? TEXT("") : dataObj->GetStringField("ServerAddress");
-    tempStruct.ServerPort = !(dataObj->HasField("ServerPort")) ? 0 : int(dataObj->GetNumberField("ServerPort"));
+    return tempStruct;
+}
+
+FAdminGetMatchmakerGameInfoResult UPlayFabAdminModelDecoder::readGetMatchmakerGameInfoResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetMatchmakerGameInfoResultResponse(Reader.GetFallbackTree(TEXT("GetMatchmakerGameInfoResult"), response));
+    }
 
+    FAdminGetMatchmakerGameInfoResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("LobbyId"):
+            Reader.ReadString(tempStruct.LobbyId);
+            break;
+        case FPlayFabJsonReader::Hash("TitleId"):
+            Reader.ReadString(tempStruct.TitleId);
+            break;
+        case FPlayFabJsonReader::Hash("StartTime"):
+            Reader.ReadString(tempStruct.StartTime);
+            break;
+        case FPlayFabJsonReader::Hash("EndTime"):
+            Reader.ReadString(tempStruct.EndTime);
+            break;
+        case FPlayFabJsonReader::Hash("Mode"):
+            Reader.ReadString(tempStruct.Mode);
+            break;
+        case FPlayFabJsonReader::Hash("BuildVersion"):
+            Reader.ReadString(tempStruct.BuildVersion);
+            break;
+        case FPlayFabJsonReader::Hash("Region"):
+            Reader.ReadEnum(tempStruct.Region);
+            break;
+        case FPlayFabJsonReader::Hash("Players"):
+            Reader.ReadStringList(tempStruct.Players);
+            break;
+        case FPlayFabJsonReader::Hash("ServerAddress"):
+            Reader.ReadString(tempStruct.ServerAddress);
+            break;
+        case FPlayFabJsonReader::Hash("ServerPort"):
+            Reader.ReadInt(tempStruct.ServerPort);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetMatchmakerGameInfoResultResponse(Reader.GetFallbackTree(TEXT("GetMatchmakerGameInfoResult"), response));
+    }
     return tempStruct;
 }
 
@@ -562,13 +1857,49 @@ FAdminGetMatchmakerGameModesResult UPlayFabAdminModelDecoder::decodeGetMatchmake
 {
     // Temp ustruct
     FAdminGetMatchmakerGameModesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.GameModesView = !(dataObj.HasField("GameModes")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("GameModes");
+
+    return tempStruct;
+}
+
+FAdminGetMatchmakerGameModesResult UPlayFabAdminModelDecoder::readGetMatchmakerGameModesResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetMatchmakerGameModesResultResponse(Reader.GetFallbackTree(TEXT("GetMatchmakerGameModesResult"), response));
+    }
 
-    tempStruct.GameModes = !(dataObj->HasField("GameModes")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GameModes");
+    FAdminGetMatchmakerGameModesResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("GameModes"):
+            Reader.ReadObjectArray(tempStruct.GameModesView, TEXT("GameModes"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetMatchmakerGameModesResultResponse(Reader.GetFallbackTree(TEXT("GetMatchmakerGameModesResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillGetMatchmakerGameModesResultJsonObjects(FAdminGetMatchmakerGameModesResult& result)
+{
+    result.GameModes = FPlayFabJsonView::WrapJsonObjects(result.GameModesView);
+}
+
 FAdminModifyMatchmakerGameModesResult UPlayFabAdminModelDecoder::decodeModifyMatchmakerGameModesResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -578,6 +1909,12 @@ FAdminModifyMatchmakerGameModesResult UPlayFabAdminModelDecoder::decodeModifyMat
     return tempStruct;
 }
 
+FAdminModifyMatchmakerGameModesResult UPlayFabAdminModelDecoder::readModifyMatchmakerGameModesResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminModifyMatchmakerGameModesResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -588,19 +1925,77 @@ FAdminAddServerBuildResult UPlayFabAdminModelDecoder::decodeAddServerBuildResult
 {
     // Temp ustruct
     FAdminAddServerBuildResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.BuildId = !(dataObj.HasField("BuildId")) ? TEXT("") : dataObj.GetStringField("BuildId");
+    tempStruct.ActiveRegions = !(dataObj.HasField("ActiveRegions")) ? TEXT("") : FString::Join(dataObj.GetStringArrayField("ActiveRegions"), TEXT(","));
+    tempStruct.MaxGamesPerHost = !(dataObj.HasField("MaxGamesPerHost")) ? 0 : int(dataObj.GetNumberField("MaxGamesPerHost"));
+    tempStruct.MinFreeGameSlots = !(dataObj.HasField("MinFreeGameSlots")) ? 0 : int(dataObj.GetNumberField("MinFreeGameSlots"));
+    tempStruct.CommandLineTemplate = !(dataObj.HasField("CommandLineTemplate")) ? TEXT("") : dataObj.GetStringField("CommandLineTemplate");
+    tempStruct.ExecutablePath = !(dataObj.HasField("ExecutablePath")) ? TEXT("") : dataObj.GetStringField("ExecutablePath");
+    tempStruct.Comment = !(dataObj.HasField("Comment")) ? TEXT("") : dataObj.GetStringField("Comment");
+    tempStruct.Timestamp = !(dataObj.HasField("Timestamp")) ? TEXT("") : dataObj.GetStringField("Timestamp");
+    tempStruct.TitleId = !(dataObj.HasField("TitleId")) ? TEXT("") : dataObj.GetStringField("TitleId");
+    GetEnumValueFromString<EGameBuildStatus>(TEXT("EGameBuildStatus"), dataObj.GetStringField("Status"), tempStruct.Status);
+
+    return tempStruct;
+}
 
-    tempStruct.BuildId = !(dataObj->HasField("BuildId")) ? TEXT("") : dataObj->GetStringField("BuildId");
-    tempStruct.ActiveRegions = !(dataObj->HasField("ActiveRegions")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("ActiveRegions"), TEXT(","));
-    tempStruct.MaxGamesPerHost = !(dataObj->HasField("MaxGamesPerHost")) ? 0 : int(dataObj->GetNumberField("MaxGamesPerHost"));
-    tempStruct.MinFreeGameSlots = !(dataObj->HasField("MinFreeGameSlots")) ? 0 : int(dataObj->GetNumberField("MinFreeGameSlots"));
-    tempStruct.CommandLineTemplate = !(dataObj->HasField("CommandLineTemplate")) ? TEXT("") : dataObj->GetStringField("CommandLineTemplate");
-    tempStruct.ExecutablePath = !(dataObj->HasField("ExecutablePath")) ? TEXT("") : dataObj->GetStringField("ExecutablePath");
-    tempStruct.Comment = !(dataObj->HasField("Comment")) ? TEXT("") : dataObj->GetStringField("Comment");
-    tempStruct.Timestamp = !(dataObj->HasField("Timestamp")) ? TEXT("") : dataObj->GetStringField("Timestamp");
-    tempStruct.TitleId = !(dataObj->HasField("TitleId")) ? TEXT("") : dataObj->GetStringField("TitleId");
-    GetEnumValueFromString<EGameBuildStatus>(TEXT("EGameBuildStatus"), dataObj->GetStringField("Status"), tempStruct.Status);
+FAdminAddServerBuildResult UPlayFabAdminModelDecoder::readAddServerBuildResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeAddServerBuildResultResponse(Reader.GetFallbackTree(TEXT("AddServerBuildResult"), response));
+    }
 
+    FAdminAddServerBuildResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BuildId"):
+            Reader.ReadString(tempStruct.BuildId);
+            break;
+        case FPlayFabJsonReader::Hash("ActiveRegions"):
+            Reader.ReadStringList(tempStruct.ActiveRegions);
+            break;
+        case FPlayFabJsonReader::Hash("MaxGamesPerHost"):
+            Reader.ReadInt(tempStruct.MaxGamesPerHost);
+            break;
+        case FPlayFabJsonReader::Hash("MinFreeGameSlots"):
+            Reader.ReadInt(tempStruct.MinFreeGameSlots);
+            break;
+        case FPlayFabJsonReader::Hash("CommandLineTemplate"):
+            Reader.ReadString(tempStruct.CommandLineTemplate);
+            break;
+        case FPlayFabJsonReader::Hash("ExecutablePath"):
+            Reader.ReadString(tempStruct.ExecutablePath);
+            break;
+        case FPlayFabJsonReader::Hash("Comment"):
+            Reader.ReadString(tempStruct.Comment);
+            break;
+        case FPlayFabJsonReader::Hash("Timestamp"):
+            Reader.ReadString(tempStruct.Timestamp);
+            break;
+        case FPlayFabJsonReader::Hash("TitleId"):
+            Reader.ReadString(tempStruct.TitleId);
+            break;
+        case FPlayFabJsonReader::Hash("Status"):
+            Reader.ReadEnum(tempStruct.Status);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeAddServerBuildResultResponse(Reader.GetFallbackTree(TEXT("AddServerBuildResult"), response));
+    }
     return tempStruct;
 }
 
@@ -608,29 +2003,115 @@ FAdminGetServerBuildInfoResult UPlayFabAdminModelDecoder::decodeGetServerBuildIn
 {
     // Temp ustruct
     FAdminGetServerBuildInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.BuildId = !(dataObj->HasField("BuildId")) ? TEXT("") : dataObj->GetStringField("BuildId");
-    tempStruct.ActiveRegions = !(dataObj->HasField("ActiveRegions")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("ActiveRegions"), TEXT(","));
-    tempStruct.MaxGamesPerHost = !(dataObj->HasField("MaxGamesPerHost")) ? 0 : int(dataObj->GetNumberField("MaxGamesPerHost"));
-    tempStruct.MinFreeGameSlots = !(dataObj->HasField("MinFreeGameSlots")) ? 0 : int(dataObj->GetNumberField("MinFreeGameSlots"));
-    tempStruct.Comment = !(dataObj->HasField("Comment")) ? TEXT("") : dataObj->GetStringField("Comment");
-    tempStruct.Timestamp = !(dataObj->HasField("Timestamp")) ? TEXT("") : dataObj->GetStringField("Timestamp");
-    tempStruct.TitleId = !(dataObj->HasField("TitleId")) ? TEXT("") : dataObj->GetStringField("TitleId");
-    GetEnumValueFromString<EGameBuildStatus>(TEXT("EGameBuildStatus"), dataObj->GetStringField("Status"), tempStruct.Status);
-    tempStruct.ErrorMessage = !(dataObj->HasField("ErrorMessage")) ? TEXT("") : dataObj->GetStringField("ErrorMessage");
+    tempStruct.BuildId = !(dataObj.HasField("BuildId")) ? TEXT("") : dataObj.GetStringField("BuildId");
+    tempStruct.ActiveRegions = !(dataObj.HasField("ActiveRegions")) ? TEXT("") : FString::Join(dataObj.GetStringArrayField("ActiveRegions"), TEXT(","));
+    tempStruct.MaxGamesPerHost = !(dataObj.HasField("MaxGamesPerHost")) ? 0 : int(dataObj.GetNumberField("MaxGamesPerHost"));
+    tempStruct.MinFreeGameSlots = !(dataObj.HasField("MinFreeGameSlots")) ? 0 : int(dataObj.GetNumberField("MinFreeGameSlots"));
+    tempStruct.Comment = !(dataObj.HasField("Comment")) ? TEXT("") : dataObj.GetStringField("Comment");
+    tempStruct.Timestamp = !(dataObj.HasField("Timestamp")) ? TEXT("") : dataObj.GetStringField("Timestamp");
+    tempStruct.TitleId = !(dataObj.HasField("TitleId")) ? TEXT("") : dataObj.GetStringField("TitleId");
+    GetEnumValueFromString<EGameBuildStatus>(TEXT("EGameBuildStatus"), dataObj.GetStringField("Status"), tempStruct.Status);
+    tempStruct.ErrorMessage = !(dataObj.HasField("ErrorMessage")) ? TEXT("") : dataObj.GetStringField("ErrorMessage");
 
     return tempStruct;
 }
 
+FAdminGetServerBuildInfoResult UPlayFabAdminModelDecoder::readGetServerBuildInfoResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetServerBuildInfoResultResponse(Reader.GetFallbackTree(TEXT("GetServerBuildInfoResult"), response));
+    }
+
+    FAdminGetServerBuildInfoResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BuildId"):
+            Reader.ReadString(tempStruct.BuildId);
+            break;
+        case FPlayFabJsonReader::Hash("ActiveRegions"):
+            Reader.ReadStringList(tempStruct.ActiveRegions);
+            break;
+        case FPlayFabJsonReader::Hash("MaxGamesPerHost"):
+            Reader.ReadInt(tempStruct.MaxGamesPerHost);
+            break;
+        case FPlayFabJsonReader::Hash("MinFreeGameSlots"):
+            Reader.ReadInt(tempStruct.MinFreeGameSlots);
+            break;
+        case FPlayFabJsonReader::Hash("Comment"):
+            Reader.ReadString(tempStruct.Comment);
+            break;
+        case FPlayFabJsonReader::Hash("Timestamp"):
+            Reader.ReadString(tempStruct.Timestamp);
+            break;
+        case FPlayFabJsonReader::Hash("TitleId"):
+            Reader.ReadString(tempStruct.TitleId);
+            break;
+        case FPlayFabJsonReader::Hash("Status"):
+            Reader.ReadEnum(tempStruct.Status);
+            break;
+        case FPlayFabJsonReader::Hash("ErrorMessage"):
+            Reader.ReadString(tempStruct.ErrorMessage);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetServerBuildInfoResultResponse(Reader.GetFallbackTree(TEXT("GetServerBuildInfoResult"), response));
+    }
+    return tempStruct;
+}
+
 FAdminGetServerBuildUploadURLResult UPlayFabAdminModelDecoder::decodeGetServerBuildUploadURLResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetServerBuildUploadURLResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.URL = !(dataObj.HasField("URL")) ? TEXT("") : dataObj.GetStringField("URL");
+
+    return tempStruct;
+}
 
-    tempStruct.URL = !(dataObj->HasField("URL")) ? TEXT("") : dataObj->GetStringField("URL");
+FAdminGetServerBuildUploadURLResult UPlayFabAdminModelDecoder::readGetServerBuildUploadURLResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetServerBuildUploadURLResultResponse(Reader.GetFallbackTree(TEXT("GetServerBuildUploadURLResult"), response));
+    }
 
+    FAdminGetServerBuildUploadURLResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("URL"):
+            Reader.ReadString(tempStruct.URL);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetServerBuildUploadURLResultResponse(Reader.GetFallbackTree(TEXT("GetServerBuildUploadURLResult"), response));
+    }
     return tempStruct;
 }
 
@@ -638,30 +2119,124 @@ FAdminListBuildsResult UPlayFabAdminModelDecoder::decodeListBuildsResultResponse
 {
     // Temp ustruct
     FAdminListBuildsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.BuildsView = !(dataObj.HasField("Builds")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Builds");
+
+    return tempStruct;
+}
 
-    tempStruct.Builds = !(dataObj->HasField("Builds")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Builds");
+FAdminListBuildsResult UPlayFabAdminModelDecoder::readListBuildsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeListBuildsResultResponse(Reader.GetFallbackTree(TEXT("ListBuildsResult"), response));
+    }
+
+    FAdminListBuildsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Builds"):
+            Reader.ReadObjectArray(tempStruct.BuildsView, TEXT("Builds"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeListBuildsResultResponse(Reader.GetFallbackTree(TEXT("ListBuildsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillListBuildsResultJsonObjects(FAdminListBuildsResult& result)
+{
+    result.Builds = FPlayFabJsonView::WrapJsonObjects(result.BuildsView);
+}
+
 FAdminModifyServerBuildResult UPlayFabAdminModelDecoder::decodeModifyServerBuildResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminModifyServerBuildResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.BuildId = !(dataObj.HasField("BuildId")) ? TEXT("") : dataObj.GetStringField("BuildId");
+    tempStruct.ActiveRegions = !(dataObj.HasField("ActiveRegions")) ? TEXT("") : FString::Join(dataObj.GetStringArrayField("ActiveRegions"), TEXT(","));
+    tempStruct.MaxGamesPerHost = !(dataObj.HasField("MaxGamesPerHost")) ? 0 : int(dataObj.GetNumberField("MaxGamesPerHost"));
+    tempStruct.MinFreeGameSlots = !(dataObj.HasField("MinFreeGameSlots")) ? 0 : int(dataObj.GetNumberField("MinFreeGameSlots"));
+    tempStruct.CommandLineTemplate = !(dataObj.HasField("CommandLineTemplate")) ? TEXT("") : dataObj.GetStringField("CommandLineTemplate");
+    tempStruct.ExecutablePath = !(dataObj.HasField("ExecutablePath")) ? TEXT("") : dataObj.GetStringField("ExecutablePath");
+    tempStruct.Comment = !(dataObj.HasField("Comment")) ? TEXT("") : dataObj.GetStringField("Comment");
+    tempStruct.Timestamp = !(dataObj.HasField("Timestamp")) ? TEXT("") : dataObj.GetStringField("Timestamp");
+    tempStruct.TitleId = !(dataObj.HasField("TitleId")) ? TEXT("") : dataObj.GetStringField("TitleId");
+    GetEnumValueFromString<EGameBuildStatus>(TEXT("EGameBuildStatus"), dataObj.GetStringField("Status"), tempStruct.Status);
+
+    return tempStruct;
+}
 
-    tempStruct.BuildId = !(dataObj->HasField("BuildId")) ? TEXT("") : dataObj->GetStringField("BuildId");
-    tempStruct.ActiveRegions = !(dataObj->HasField("ActiveRegions")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("ActiveRegions"), TEXT(","));
-    tempStruct.MaxGamesPerHost = !(dataObj->HasField("MaxGamesPerHost")) ? 0 : int(dataObj->GetNumberField("MaxGamesPerHost"));
-    tempStruct.MinFreeGameSlots = !(dataObj->HasField("MinFreeGameSlots")) ? 0 : int(dataObj->GetNumberField("MinFreeGameSlots"));
-    tempStruct.CommandLineTemplate = !(dataObj->HasField("CommandLineTemplate")) ? TEXT("") : dataObj->GetStringField("CommandLineTemplate");
-    tempStruct.ExecutablePath = !(dataObj->HasField("ExecutablePath")) ? TEXT("") : dataObj->GetStringField("ExecutablePath");
-    tempStruct.Comment = !(dataObj->HasField("Comment")) ? TEXT("") : dataObj->GetStringField("Comment");
-    tempStruct.Timestamp = !(dataObj->HasField("Timestamp")) ? TEXT("") : dataObj->GetStringField("Timestamp");
-    tempStruct.TitleId = !(dataObj->HasField("TitleId")) ? TEXT("") : dataObj->GetStringField("TitleId");
-    GetEnumValueFromString<EGameBuildStatus>(TEXT("EGameBuildStatus"), dataObj->GetStringField("Status"), tempStruct.Status);
+FAdminModifyServerBuildResult UPlayFabAdminModelDecoder::readModifyServerBuildResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeModifyServerBuildResultResponse(Reader.GetFallbackTree(TEXT("ModifyServerBuildResult"), response));
+    }
 
+    FAdminModifyServerBuildResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BuildId"):
+            Reader.ReadString(tempStruct.BuildId);
+            break;
+        case FPlayFabJsonReader::Hash("ActiveRegions"):
+            Reader.ReadStringList(tempStruct.ActiveRegions);
+            break;
+        case FPlayFabJsonReader::Hash("MaxGamesPerHost"):
+            Reader.ReadInt(tempStruct.MaxGamesPerHost);
+            break;
+        case FPlayFabJsonReader::Hash("MinFreeGameSlots"):
+            Reader.ReadInt(tempStruct.MinFreeGameSlots);
+            break;
+        case FPlayFabJsonReader::Hash("CommandLineTemplate"):
+            Reader.ReadString(tempStruct.CommandLineTemplate);
+            break;
+        case FPlayFabJsonReader::Hash("ExecutablePath"):
+            Reader.ReadString(tempStruct.ExecutablePath);
+            break;
+        case FPlayFabJsonReader::Hash("Comment"):
+            Reader.ReadString(tempStruct.Comment);
+            break;
+        case FPlayFabJsonReader::Hash("Timestamp"):
+            Reader.ReadString(tempStruct.Timestamp);
+            break;
+        case FPlayFabJsonReader::Hash("TitleId"):
+            Reader.ReadString(tempStruct.TitleId);
+            break;
+        case FPlayFabJsonReader::Hash("Status"):
+            Reader.ReadEnum(tempStruct.Status);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeModifyServerBuildResultResponse(Reader.GetFallbackTree(TEXT("ModifyServerBuildResult"), response));
+    }
     return tempStruct;
 }
 
@@ -674,6 +2249,12 @@ FAdminRemoveServerBuildResult UPlayFabAdminModelDecoder::decodeRemoveServerBuild
     return tempStruct;
 }
 
+FAdminRemoveServerBuildResult UPlayFabAdminModelDecoder::readRemoveServerBuildResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminRemoveServerBuildResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -689,6 +2270,12 @@ FAdminSetPublisherDataResult UPlayFabAdminModelDecoder::decodeSetPublisherDataRe
     return tempStruct;
 }
 
+FAdminSetPublisherDataResult UPlayFabAdminModelDecoder::readSetPublisherDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminSetPublisherDataResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -699,28 +2286,112 @@ FAdminGetCloudScriptRevisionResult UPlayFabAdminModelDecoder::decodeGetCloudScri
 {
     // Temp ustruct
     FAdminGetCloudScriptRevisionResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
-    tempStruct.Revision = !(dataObj->HasField("Revision")) ? 0 : int(dataObj->GetNumberField("Revision"));
-    tempStruct.CreatedAt = !(dataObj->HasField("CreatedAt")) ? TEXT("") : dataObj->GetStringField("CreatedAt");
-    tempStruct.Files = !(dataObj->HasField("Files")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Files");
-    tempStruct.IsPublished = !(dataObj->HasField("IsPublished")) ? false : dataObj->GetBoolField("IsPublished");
+    tempStruct.Version = !(dataObj.HasField("Version")) ? 0 : int(dataObj.GetNumberField("Version"));
+    tempStruct.Revision = !(dataObj.HasField("Revision")) ? 0 : int(dataObj.GetNumberField("Revision"));
+    tempStruct.CreatedAt = !(dataObj.HasField("CreatedAt")) ? TEXT("") : dataObj.GetStringField("CreatedAt");
+    tempStruct.FilesView = !(dataObj.HasField("Files")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Files");
+    tempStruct.IsPublished = !(dataObj.HasField("IsPublished")) ? false : dataObj.GetBoolField("IsPublished");
 
     return tempStruct;
 }
 
+FAdminGetCloudScriptRevisionResult UPlayFabAdminModelDecoder::readGetCloudScriptRevisionResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCloudScriptRevisionResultResponse(Reader.GetFallbackTree(TEXT("GetCloudScriptRevisionResult"), response));
+    }
+
+    FAdminGetCloudScriptRevisionResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Version"):
+            Reader.ReadInt(tempStruct.Version);
+            break;
+        case FPlayFabJsonReader::Hash("Revision"):
+            Reader.ReadInt(tempStruct.Revision);
+            break;
+        case FPlayFabJsonReader::Hash("CreatedAt"):
+            Reader.ReadString(tempStruct.CreatedAt);
+            break;
+        case FPlayFabJsonReader::Hash("Files"):
+            Reader.ReadObjectArray(tempStruct.FilesView, TEXT("Files"));
+            break;
+        case FPlayFabJsonReader::Hash("IsPublished"):
+            Reader.ReadBool(tempStruct.IsPublished);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetCloudScriptRevisionResultResponse(Reader.GetFallbackTree(TEXT("GetCloudScriptRevisionResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillGetCloudScriptRevisionResultJsonObjects(FAdminGetCloudScriptRevisionResult& result)
+{
+    result.Files = FPlayFabJsonView::WrapJsonObjects(result.FilesView);
+}
+
 FAdminGetCloudScriptVersionsResult UPlayFabAdminModelDecoder::decodeGetCloudScriptVersionsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetCloudScriptVersionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.VersionsView = !(dataObj.HasField("Versions")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Versions");
 
-    tempStruct.Versions = !(dataObj->HasField("Versions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Versions");
+    return tempStruct;
+}
+
+FAdminGetCloudScriptVersionsResult UPlayFabAdminModelDecoder::readGetCloudScriptVersionsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCloudScriptVersionsResultResponse(Reader.GetFallbackTree(TEXT("GetCloudScriptVersionsResult"), response));
+    }
 
+    FAdminGetCloudScriptVersionsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Versions"):
+            Reader.ReadObjectArray(tempStruct.VersionsView, TEXT("Versions"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetCloudScriptVersionsResultResponse(Reader.GetFallbackTree(TEXT("GetCloudScriptVersionsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillGetCloudScriptVersionsResultJsonObjects(FAdminGetCloudScriptVersionsResult& result)
+{
+    result.Versions = FPlayFabJsonView::WrapJsonObjects(result.VersionsView);
+}
+
 FAdminSetPublishedRevisionResult UPlayFabAdminModelDecoder::decodeSetPublishedRevisionResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -730,15 +2401,55 @@ FAdminSetPublishedRevisionResult UPlayFabAdminModelDecoder::decodeSetPublishedRe
     return tempStruct;
 }
 
+FAdminSetPublishedRevisionResult UPlayFabAdminModelDecoder::readSetPublishedRevisionResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminSetPublishedRevisionResult();
+}
+
 FAdminUpdateCloudScriptResult UPlayFabAdminModelDecoder::decodeUpdateCloudScriptResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminUpdateCloudScriptResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.Version = !(dataObj.HasField("Version")) ? 0 : int(dataObj.GetNumberField("Version"));
+    tempStruct.Revision = !(dataObj.HasField("Revision")) ? 0 : int(dataObj.GetNumberField("Revision"));
+
+    return tempStruct;
+}
 
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
-    tempStruct.Revision = !(dataObj->HasField("Revision")) ? 0 : int(dataObj->GetNumberField("Revision"));
+FAdminUpdateCloudScriptResult UPlayFabAdminModelDecoder::readUpdateCloudScriptResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUpdateCloudScriptResultResponse(Reader.GetFallbackTree(TEXT("UpdateCloudScriptResult"), response));
+    }
+
+    FAdminUpdateCloudScriptResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Version"):
+            Reader.ReadInt(tempStruct.Version);
+            break;
+        case FPlayFabJsonReader::Hash("Revision"):
+            Reader.ReadInt(tempStruct.Revision);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeUpdateCloudScriptResultResponse(Reader.GetFallbackTree(TEXT("UpdateCloudScriptResult"), response));
+    }
     return tempStruct;
 }
 
@@ -752,26 +2463,99 @@ FAdminGetContentListResult UPlayFabAdminModelDecoder::decodeGetContentListResult
 {
     // Temp ustruct
     FAdminGetContentListResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.ItemCount = !(dataObj->HasField("ItemCount")) ? 0 : int(dataObj->GetNumberField("ItemCount"));
-    tempStruct.TotalSize = !(dataObj->HasField("TotalSize")) ? 0 : int(dataObj->GetNumberField("TotalSize"));
-    tempStruct.Contents = !(dataObj->HasField("Contents")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Contents");
+    tempStruct.ItemCount = !(dataObj.HasField("ItemCount")) ? 0 : int(dataObj.GetNumberField("ItemCount"));
+    tempStruct.TotalSize = !(dataObj.HasField("TotalSize")) ? 0 : int(dataObj.GetNumberField("TotalSize"));
+    tempStruct.ContentsView = !(dataObj.HasField("Contents")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Contents");
 
     return tempStruct;
 }
 
+FAdminGetContentListResult UPlayFabAdminModelDecoder::readGetContentListResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetContentListResultResponse(Reader.GetFallbackTree(TEXT("GetContentListResult"), response));
+    }
+
+    FAdminGetContentListResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ItemCount"):
+            Reader.ReadInt(tempStruct.ItemCount);
+            break;
+        case FPlayFabJsonReader::Hash("TotalSize"):
+            Reader.ReadInt(tempStruct.TotalSize);
+            break;
+        case FPlayFabJsonReader::Hash("Contents"):
+            Reader.ReadObjectArray(tempStruct.ContentsView, TEXT("Contents"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetContentListResultResponse(Reader.GetFallbackTree(TEXT("GetContentListResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillGetContentListResultJsonObjects(FAdminGetContentListResult& result)
+{
+    result.Contents = FPlayFabJsonView::WrapJsonObjects(result.ContentsView);
+}
+
 FAdminGetContentUploadUrlResult UPlayFabAdminModelDecoder::decodeGetContentUploadUrlResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetContentUploadUrlResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.URL = !(dataObj->HasField("URL")) ? TEXT("") : dataObj->GetStringField("URL");
+    tempStruct.URL = !(dataObj.HasField("URL")) ? TEXT("") : dataObj.GetStringField("URL");
 
     return tempStruct;
 }
 
+FAdminGetContentUploadUrlResult UPlayFabAdminModelDecoder::readGetContentUploadUrlResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetContentUploadUrlResultResponse(Reader.GetFallbackTree(TEXT("GetContentUploadUrlResult"), response));
+    }
+
+    FAdminGetContentUploadUrlResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("URL"):
+            Reader.ReadString(tempStruct.URL);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetContentUploadUrlResultResponse(Reader.GetFallbackTree(TEXT("GetContentUploadUrlResult"), response));
+    }
+    return tempStruct;
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -787,6 +2571,12 @@ FAdminResetCharacterStatisticsResult UPlayFabAdminModelDecoder::decodeResetChara
     return tempStruct;
 }
 
+FAdminResetCharacterStatisticsResult UPlayFabAdminModelDecoder::readResetCharacterStatisticsResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminResetCharacterStatisticsResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -802,64 +2592,254 @@ FAdminAddPlayerTagResult UPlayFabAdminModelDecoder::decodeAddPlayerTagResultResp
     return tempStruct;
 }
 
+FAdminAddPlayerTagResult UPlayFabAdminModelDecoder::readAddPlayerTagResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminAddPlayerTagResult();
+}
+
 FAdminGetAllActionGroupsResult UPlayFabAdminModelDecoder::decodeGetAllActionGroupsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetAllActionGroupsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.ActionGroupsView = !(dataObj.HasField("ActionGroups")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("ActionGroups");
+
+    return tempStruct;
+}
+
+FAdminGetAllActionGroupsResult UPlayFabAdminModelDecoder::readGetAllActionGroupsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetAllActionGroupsResultResponse(Reader.GetFallbackTree(TEXT("GetAllActionGroupsResult"), response));
+    }
 
-    tempStruct.ActionGroups = !(dataObj->HasField("ActionGroups")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ActionGroups");
+    FAdminGetAllActionGroupsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ActionGroups"):
+            Reader.ReadObjectArray(tempStruct.ActionGroupsView, TEXT("ActionGroups"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetAllActionGroupsResultResponse(Reader.GetFallbackTree(TEXT("GetAllActionGroupsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillGetAllActionGroupsResultJsonObjects(FAdminGetAllActionGroupsResult& result)
+{
+    result.ActionGroups = FPlayFabJsonView::WrapJsonObjects(result.ActionGroupsView);
+}
+
 FAdminGetAllSegmentsResult UPlayFabAdminModelDecoder::decodeGetAllSegmentsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetAllSegmentsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.SegmentsView = !(dataObj.HasField("Segments")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Segments");
 
-    tempStruct.Segments = !(dataObj->HasField("Segments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Segments");
+    return tempStruct;
+}
+
+FAdminGetAllSegmentsResult UPlayFabAdminModelDecoder::readGetAllSegmentsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetAllSegmentsResultResponse(Reader.GetFallbackTree(TEXT("GetAllSegmentsResult"), response));
+    }
 
+    FAdminGetAllSegmentsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Segments"):
+            Reader.ReadObjectArray(tempStruct.SegmentsView, TEXT("Segments"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetAllSegmentsResultResponse(Reader.GetFallbackTree(TEXT("GetAllSegmentsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillGetAllSegmentsResultJsonObjects(FAdminGetAllSegmentsResult& result)
+{
+    result.Segments = FPlayFabJsonView::WrapJsonObjects(result.SegmentsView);
+}
+
 FAdminGetPlayerSegmentsResult UPlayFabAdminModelDecoder::decodeGetPlayerSegmentsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetPlayerSegmentsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.SegmentsView = !(dataObj.HasField("Segments")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Segments");
+
+    return tempStruct;
+}
+
+FAdminGetPlayerSegmentsResult UPlayFabAdminModelDecoder::readGetPlayerSegmentsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerSegmentsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerSegmentsResult"), response));
+    }
 
-    tempStruct.Segments = !(dataObj->HasField("Segments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Segments");
+    FAdminGetPlayerSegmentsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Segments"):
+            Reader.ReadObjectArray(tempStruct.SegmentsView, TEXT("Segments"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerSegmentsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerSegmentsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillGetPlayerSegmentsResultJsonObjects(FAdminGetPlayerSegmentsResult& result)
+{
+    result.Segments = FPlayFabJsonView::WrapJsonObjects(result.SegmentsView);
+}
+
 FAdminGetPlayersInSegmentResult UPlayFabAdminModelDecoder::decodeGetPlayersInSegmentResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetPlayersInSegmentResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.ProfilesInSegment = !(dataObj->HasField("ProfilesInSegment")) ? 0 : int(dataObj->GetNumberField("ProfilesInSegment"));
-    tempStruct.ContinuationToken = !(dataObj->HasField("ContinuationToken")) ? TEXT("") : dataObj->GetStringField("ContinuationToken");
-    tempStruct.PlayerProfiles = !(dataObj->HasField("PlayerProfiles")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("PlayerProfiles");
+    tempStruct.ProfilesInSegment = !(dataObj.HasField("ProfilesInSegment")) ? 0 : int(dataObj.GetNumberField("ProfilesInSegment"));
+    tempStruct.ContinuationToken = !(dataObj.HasField("ContinuationToken")) ? TEXT("") : dataObj.GetStringField("ContinuationToken");
+    tempStruct.PlayerProfilesView = !(dataObj.HasField("PlayerProfiles")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("PlayerProfiles");
 
     return tempStruct;
 }
 
+FAdminGetPlayersInSegmentResult UPlayFabAdminModelDecoder::readGetPlayersInSegmentResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayersInSegmentResultResponse(Reader.GetFallbackTree(TEXT("GetPlayersInSegmentResult"), response));
+    }
+
+    FAdminGetPlayersInSegmentResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ProfilesInSegment"):
+            Reader.ReadInt(tempStruct.ProfilesInSegment);
+            break;
+        case FPlayFabJsonReader::Hash("ContinuationToken"):
+            Reader.ReadString(tempStruct.ContinuationToken);
+            break;
+        case FPlayFabJsonReader::Hash("PlayerProfiles"):
+            Reader.ReadObjectArray(tempStruct.PlayerProfilesView, TEXT("PlayerProfiles"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayersInSegmentResultResponse(Reader.GetFallbackTree(TEXT("GetPlayersInSegmentResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillGetPlayersInSegmentResultJsonObjects(FAdminGetPlayersInSegmentResult& result)
+{
+    result.PlayerProfiles = FPlayFabJsonView::WrapJsonObjects(result.PlayerProfilesView);
+}
+
 FAdminGetPlayerTagsResult UPlayFabAdminModelDecoder::decodeGetPlayerTagsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetPlayerTagsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.Tags = !(dataObj->HasField("Tags")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Tags"), TEXT(","));
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.Tags = !(dataObj.HasField("Tags")) ? TEXT("") : FString::Join(dataObj.GetStringArrayField("Tags"), TEXT(","));
 
     return tempStruct;
 }
 
+FAdminGetPlayerTagsResult UPlayFabAdminModelDecoder::readGetPlayerTagsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerTagsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerTagsResult"), response));
+    }
+
+    FAdminGetPlayerTagsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("Tags"):
+            Reader.ReadStringList(tempStruct.Tags);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerTagsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerTagsResult"), response));
+    }
+    return tempStruct;
+}
+
 FAdminRemovePlayerTagResult UPlayFabAdminModelDecoder::decodeRemovePlayerTagResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -869,6 +2849,12 @@ FAdminRemovePlayerTagResult UPlayFabAdminModelDecoder::decodeRemovePlayerTagResu
     return tempStruct;
 }
 
+FAdminRemovePlayerTagResult UPlayFabAdminModelDecoder::readRemovePlayerTagResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminRemovePlayerTagResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -884,14 +2870,51 @@ FAdminEmptyResult UPlayFabAdminModelDecoder::decodeEmptyResultResponse(UPlayFabJ
     return tempStruct;
 }
 
+FAdminEmptyResult UPlayFabAdminModelDecoder::readEmptyResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FAdminEmptyResult();
+}
+
 FAdminCreateTaskResult UPlayFabAdminModelDecoder::decodeCreateTaskResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminCreateTaskResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.TaskId = !(dataObj.HasField("TaskId")) ? TEXT("") : dataObj.GetStringField("TaskId");
+
+    return tempStruct;
+}
 
-    tempStruct.TaskId = !(dataObj->HasField("TaskId")) ? TEXT("") : dataObj->GetStringField("TaskId");
+FAdminCreateTaskResult UPlayFabAdminModelDecoder::readCreateTaskResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeCreateTaskResultResponse(Reader.GetFallbackTree(TEXT("CreateTaskResult"), response));
+    }
 
+    FAdminCreateTaskResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("TaskId"):
+            Reader.ReadString(tempStruct.TaskId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeCreateTaskResultResponse(Reader.GetFallbackTree(TEXT("CreateTaskResult"), response));
+    }
     return tempStruct;
 }
 
@@ -899,56 +2922,239 @@ FAdminGetActionsOnPlayersInSegmentTaskInstanceResult UPlayFabAdminModelDecoder::
 {
     // Temp ustruct
     FAdminGetActionsOnPlayersInSegmentTaskInstanceResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.SummaryView = !(dataObj.HasField("Summary")) ? FPlayFabJsonView() : dataObj.GetObjectField("Summary");
+    tempStruct.ParameterView = !(dataObj.HasField("Parameter")) ? FPlayFabJsonView() : dataObj.GetObjectField("Parameter");
+
+    return tempStruct;
+}
+
+FAdminGetActionsOnPlayersInSegmentTaskInstanceResult UPlayFabAdminModelDecoder::readGetActionsOnPlayersInSegmentTaskInstanceResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetActionsOnPlayersInSegmentTaskInstanceResultResponse(Reader.GetFallbackTree(TEXT("GetActionsOnPlayersInSegmentTaskInstanceResult"), response));
+    }
 
-    tempStruct.Summary = !(dataObj->HasField("Summary")) ? nullptr : dataObj->GetObjectField("Summary");
-    tempStruct.Parameter = !(dataObj->HasField("Parameter")) ? nullptr : dataObj->GetObjectField("Parameter");
+    FAdminGetActionsOnPlayersInSegmentTaskInstanceResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Summary"):
+            Reader.ReadObject(tempStruct.SummaryView, TEXT("Summary"));
+            break;
+        case FPlayFabJsonReader::Hash("Parameter"):
+            Reader.ReadObject(tempStruct.ParameterView, TEXT("Parameter"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetActionsOnPlayersInSegmentTaskInstanceResultResponse(Reader.GetFallbackTree(TEXT("GetActionsOnPlayersInSegmentTaskInstanceResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillGetActionsOnPlayersInSegmentTaskInstanceResultJsonObjects(FAdminGetActionsOnPlayersInSegmentTaskInstanceResult& result)
+{
+    result.Summary = result.SummaryView.WrapJsonObject();
+    result.Parameter = result.ParameterView.WrapJsonObject();
+}
+
 FAdminGetCloudScriptTaskInstanceResult UPlayFabAdminModelDecoder::decodeGetCloudScriptTaskInstanceResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetCloudScriptTaskInstanceResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.SummaryView = !(dataObj.HasField("Summary")) ? FPlayFabJsonView() : dataObj.GetObjectField("Summary");
+    tempStruct.ParameterView = !(dataObj.HasField("Parameter")) ? FPlayFabJsonView() : dataObj.GetObjectField("Parameter");
+
+    return tempStruct;
+}
 
-    tempStruct.Summary = !(dataObj->HasField("Summary")) ? nullptr : dataObj->GetObjectField("Summary");
-    tempStruct.Parameter = !(dataObj->HasField("Parameter")) ? nullptr : dataObj->GetObjectField("Parameter");
+FAdminGetCloudScriptTaskInstanceResult UPlayFabAdminModelDecoder::readGetCloudScriptTaskInstanceResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCloudScriptTaskInstanceResultResponse(Reader.GetFallbackTree(TEXT("GetCloudScriptTaskInstanceResult"), response));
+    }
+
+    FAdminGetCloudScriptTaskInstanceResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Summary"):
+            Reader.ReadObject(tempStruct.SummaryView, TEXT("Summary"));
+            break;
+        case FPlayFabJsonReader::Hash("Parameter"):
+            Reader.ReadObject(tempStruct.ParameterView, TEXT("Parameter"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetCloudScriptTaskInstanceResultResponse(Reader.GetFallbackTree(TEXT("GetCloudScriptTaskInstanceResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillGetCloudScriptTaskInstanceResultJsonObjects(FAdminGetCloudScriptTaskInstanceResult& result)
+{
+    result.Summary = result.SummaryView.WrapJsonObject();
+    result.Parameter = result.ParameterView.WrapJsonObject();
+}
+
 FAdminGetTaskInstancesResult UPlayFabAdminModelDecoder::decodeGetTaskInstancesResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetTaskInstancesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.SummariesView = !(dataObj.HasField("Summaries")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Summaries");
+
+    return tempStruct;
+}
+
+FAdminGetTaskInstancesResult UPlayFabAdminModelDecoder::readGetTaskInstancesResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetTaskInstancesResultResponse(Reader.GetFallbackTree(TEXT("GetTaskInstancesResult"), response));
+    }
 
-    tempStruct.Summaries = !(dataObj->HasField("Summaries")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Summaries");
+    FAdminGetTaskInstancesResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Summaries"):
+            Reader.ReadObjectArray(tempStruct.SummariesView, TEXT("Summaries"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetTaskInstancesResultResponse(Reader.GetFallbackTree(TEXT("GetTaskInstancesResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabAdminModelDecoder::fillGetTaskInstancesResultJsonObjects(FAdminGetTaskInstancesResult& result)
+{
+    result.Summaries = FPlayFabJsonView::WrapJsonObjects(result.SummariesView);
+}
+
 FAdminGetTasksResult UPlayFabAdminModelDecoder::decodeGetTasksResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminGetTasksResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Tasks = !(dataObj->HasField("Tasks")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Tasks");
+    tempStruct.TasksView = !(dataObj.HasField("Tasks")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Tasks");
 
     return tempStruct;
 }
 
+FAdminGetTasksResult UPlayFabAdminModelDecoder::readGetTasksResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetTasksResultResponse(Reader.GetFallbackTree(TEXT("GetTasksResult"), response));
+    }
+
+    FAdminGetTasksResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Tasks"):
+            Reader.ReadObjectArray(tempStruct.TasksView, TEXT("Tasks"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetTasksResultResponse(Reader.GetFallbackTree(TEXT("GetTasksResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabAdminModelDecoder::fillGetTasksResultJsonObjects(FAdminGetTasksResult& result)
+{
+    result.Tasks = FPlayFabJsonView::WrapJsonObjects(result.TasksView);
+}
+
 FAdminRunTaskResult UPlayFabAdminModelDecoder::decodeRunTaskResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FAdminRunTaskResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.TaskInstanceId = !(dataObj.HasField("TaskInstanceId")) ? TEXT("") : dataObj.GetStringField("TaskInstanceId");
+
+    return tempStruct;
+}
 
-    tempStruct.TaskInstanceId = !(dataObj->HasField("TaskInstanceId")) ? TEXT("") : dataObj->GetStringField("TaskInstanceId");
+FAdminRunTaskResult UPlayFabAdminModelDecoder::readRunTaskResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeRunTaskResultResponse(Reader.GetFallbackTree(TEXT("RunTaskResult"), response));
+    }
 
+    FAdminRunTaskResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("TaskInstanceId"):
+            Reader.ReadString(tempStruct.TaskInstanceId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeRunTaskResultResponse(Reader.GetFallbackTree(TEXT("RunTaskResult"), response));
+    }
     return tempStruct;
 }
 
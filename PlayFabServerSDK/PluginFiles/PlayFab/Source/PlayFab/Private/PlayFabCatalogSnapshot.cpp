@@ -0,0 +1,359 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab catalog snapshot.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabCatalogSnapshot.h"
+#include "PlayFabCatalogIndex.h"
+#include "PlayFabResponseReader.h"
+#include "Async/Async.h"
+
+static const uint32 SnapshotMagic = 0x4E534650; // "PFSN"
+
+bool FPlayFabCatalogSnapshot::bCaptureEnabled = true;
+
+/** Collects the tables of a snapshot while it is being built */
+class FPlayFabSnapshotWriter
+{
+public:
+    TArray<FPlayFabSnapshotItem> Items;
+    TArray<FPlayFabSnapshotString> Tags;
+    TArray<FPlayFabSnapshotPrice> Prices;
+    TArray<uint8> Strings;
+
+    /** Append a string to the string table. Short repeated strings like classes, tags and currencies are stored once */
+    FPlayFabSnapshotString Add(const FString& Value, bool bIntern = false)
+    {
+        if (bIntern)
+        {
+            const FPlayFabSnapshotString* Existing = Interned.Find(Value);
+            if (Existing != nullptr)
+            {
+                return *Existing;
+            }
+        }
+
+        FTCHARToUTF8 Utf8(*Value, Value.Len());
+        FPlayFabSnapshotString Result;
+        Result.Offset = Strings.Num();
+        Result.Length = Utf8.Length();
+        Strings.Append((const uint8*)Utf8.Get(), Utf8.Length());
+
+        if (bIntern)
+        {
+            Interned.Add(Value, Result);
+        }
+        return Result;
+    }
+
+    /** Append an optional string field of Source, empty if it is missing */
+    FPlayFabSnapshotString Add(const FJsonObject& Source, const TCHAR* FieldName, bool bIntern = false)
+    {
+        FString Value;
+        Source.TryGetStringField(FieldName, Value);
+        return Add(Value, bIntern);
+    }
+
+    /** Append a table to the output, keeping it 4 byte aligned, and return its offset */
+    template<typename T>
+    static uint32 AppendTable(TArray<uint8>& Out, const T* Rows, int32 Count)
+    {
+        Out.AddZeroed(Align(Out.Num(), 4) - Out.Num());
+        const uint32 Offset = Out.Num();
+        Out.Append((const uint8*)Rows, Count * sizeof(T));
+        return Offset;
+    }
+
+private:
+    TMap<FString, FPlayFabSnapshotString> Interned;
+};
+
+bool FPlayFabCatalogSnapshot::Build(EKind Kind, const FString& CatalogVersion, const FString& StoreId, const TArray<uint8>& ResponseContent, TArray<uint8>& OutSnapshot)
+{
+    TSharedPtr<FJsonObject> Root;
+    const TSharedPtr<FJsonObject>* DataObj = nullptr;
+    const TArray<TSharedPtr<FJsonValue>>* ItemValues = nullptr;
+    if (!FPlayFabResponseReader::Deserialize(ResponseContent, Root)
+        || !Root->TryGetObjectField(TEXT("data"), DataObj)
+        || !(*DataObj)->TryGetArrayField(Kind == EKind::Catalog ? TEXT("Catalog") : TEXT("Store"), ItemValues))
+    {
+        return false;
+    }
+
+    FPlayFabSnapshotWriter Writer;
+    FPlayFabSnapshotHeader Header;
+    FMemory::Memzero(Header);
+    Header.CatalogVersion = Writer.Add(CatalogVersion);
+    Header.StoreId = Writer.Add(StoreId);
+
+    FString Json;
+    Writer.Items.Reserve(ItemValues->Num());
+    for (const TSharedPtr<FJsonValue>& Value : *ItemValues)
+    {
+        const TSharedPtr<FJsonObject>* ItemObj = nullptr;
+        if (!Value.IsValid() || !Value->TryGetObject(ItemObj))
+        {
+            continue;
+        }
+        const FJsonObject& Source = **ItemObj;
+
+        Writer.Items.AddZeroed();
+        FPlayFabSnapshotItem& Item = Writer.Items.Last();
+        Item.ItemId = Writer.Add(Source, TEXT("ItemId"));
+        Item.ItemClass = Writer.Add(Source, TEXT("ItemClass"), true);
+        Item.DisplayName = Writer.Add(Source, TEXT("DisplayName"));
+        Item.Description = Writer.Add(Source, TEXT("Description"));
+        Item.ItemImageUrl = Writer.Add(Source, TEXT("ItemImageUrl"));
+        Item.CustomData = Writer.Add(Source, TEXT("CustomData"));
+
+        Json.Reset();
+        TSharedRef<TJsonWriter<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>> JsonWriter = TJsonWriterFactory<TCHAR, TCondensedJsonPrintPolicy<TCHAR>>::Create(&Json);
+        FJsonSerializer::Serialize(ItemObj->ToSharedRef(), JsonWriter);
+        Item.Json = Writer.Add(Json);
+
+        Item.FirstTag = Writer.Tags.Num();
+        const TArray<TSharedPtr<FJsonValue>>* TagValues = nullptr;
+        if (Source.TryGetArrayField(TEXT("Tags"), TagValues))
+        {
+            for (const TSharedPtr<FJsonValue>& Tag : *TagValues)
+            {
+                Writer.Tags.Add(Writer.Add(Tag->AsString(), true));
+            }
+        }
+        Item.TagCount = Writer.Tags.Num() - Item.FirstTag;
+
+        Item.FirstPrice = Writer.Prices.Num();
+        const TSharedPtr<FJsonObject>* PriceObj = nullptr;
+        if (Source.TryGetObjectField(TEXT("VirtualCurrencyPrices"), PriceObj))
+        {
+            for (const TPair<FString, TSharedPtr<FJsonValue>>& Price : (*PriceObj)->Values)
+            {
+                FPlayFabSnapshotPrice Entry;
+                Entry.Currency = Writer.Add(Price.Key, true);
+                Entry.Amount = (uint32)Price.Value->AsNumber();
+                Writer.Prices.Add(Entry);
+            }
+        }
+        Item.PriceCount = Writer.Prices.Num() - Item.FirstPrice;
+    }
+
+    Header.Magic = SnapshotMagic;
+    Header.Version = FormatVersion;
+    Header.Kind = (uint32)Kind;
+    Header.WrittenAt = FDateTime::UtcNow().ToUnixTimestamp();
+    Header.ItemCount = Writer.Items.Num();
+    Header.TagCount = Writer.Tags.Num();
+    Header.PriceCount = Writer.Prices.Num();
+    Header.StringsSize = Writer.Strings.Num();
+
+    OutSnapshot.Reset();
+    OutSnapshot.AddZeroed(sizeof(FPlayFabSnapshotHeader));
+    Header.ItemsOffset = FPlayFabSnapshotWriter::AppendTable(OutSnapshot, Writer.Items.GetData(), Writer.Items.Num());
+    Header.TagsOffset = FPlayFabSnapshotWriter::AppendTable(OutSnapshot, Writer.Tags.GetData(), Writer.Tags.Num());
+    Header.PricesOffset = FPlayFabSnapshotWriter::AppendTable(OutSnapshot, Writer.Prices.GetData(), Writer.Prices.Num());
+    Header.StringsOffset = FPlayFabSnapshotWriter::AppendTable(OutSnapshot, Writer.Strings.GetData(), Writer.Strings.Num());
+    Header.Size = OutSnapshot.Num();
+    FMemory::Memcpy(OutSnapshot.GetData(), &Header, sizeof(Header));
+    return true;
+}
+
+FString FPlayFabCatalogSnapshot::GetPath(EKind Kind, const FString& CatalogVersion, const FString& StoreId)
+{
+    // Versions and store ids can hold any character, so name the file by hash. The header holds the real key
+    const FString Key = CatalogVersion + TEXT("|") + StoreId;
+    const FString FileName = FString::Printf(TEXT("%s_%08X.pfsnap"), Kind == EKind::Catalog ? TEXT("Catalog") : TEXT("Store"), FCrc::StrCrc32(*Key));
+    return FPaths::GameSavedDir() / TEXT("PlayFab") / IPlayFab::Get().GetSettings().GameTitleId / FileName;
+}
+
+void FPlayFabCatalogSnapshot::Capture(const FString& Endpoint, FHttpRequestPtr Request, const FJsonObject* RequestBody, FHttpResponsePtr Response)
+{
+    if (!bCaptureEnabled || !Response.IsValid())
+    {
+        return;
+    }
+
+    EKind Kind;
+    if (Endpoint.EndsWith(TEXT("/GetCatalogItems")))
+    {
+        Kind = EKind::Catalog;
+    }
+    else if (Endpoint.EndsWith(TEXT("/GetStoreItems")))
+    {
+        Kind = EKind::Store;
+    }
+    else
+    {
+        return;
+    }
+
+    // Keyed by what was asked for, so the next launch finds it with the same arguments
+    FString CatalogVersion, StoreId;
+    TSharedPtr<FJsonObject> WrittenBody;
+    if (RequestBody == nullptr && Request.IsValid() && FPlayFabResponseReader::Deserialize(Request->GetContent(), WrittenBody))
+    {
+        RequestBody = WrittenBody.Get();
+    }
+    if (RequestBody != nullptr)
+    {
+        RequestBody->TryGetStringField(TEXT("CatalogVersion"), CatalogVersion);
+        RequestBody->TryGetStringField(TEXT("StoreId"), StoreId);
+    }
+    const FString Path = GetPath(Kind, CatalogVersion, StoreId);
+
+    // The response is thread safe and its bytes never change, so the worker parses them again rather than
+    // touching the json the game thread owns. A catalog is indexed there as well
+    Async<void>(EAsyncExecution::ThreadPool, [Kind, CatalogVersion, StoreId, Path, Response]()
+    {
+        TArray<uint8> Snapshot;
+        if (!Build(Kind, CatalogVersion, StoreId, Response->GetContent(), Snapshot))
+        {
+            return;
+        }
+
+        // Write next to the old file and swap, so a reader never sees half a snapshot
+        const FString TempPath = Path + TEXT(".") + FGuid::NewGuid().ToString() + TEXT(".tmp");
+        if (!FFileHelper::SaveArrayToFile(Snapshot, *TempPath) || !IFileManager::Get().Move(*Path, *TempPath, true))
+        {
+            IFileManager::Get().Delete(*TempPath);
+            UE_LOG(LogPlayFab, Warning, TEXT("Failed to write catalog snapshot %s"), *Path);
+        }
+
+        // Index a fresh catalog here too, so the game thread only has to swap it in
+        if (Kind != EKind::Catalog)
+        {
+            return;
+        }
+        TSharedPtr<FPlayFabCatalogIndex, ESPMode::ThreadSafe> Index = FPlayFabCatalogIndex::Create(MoveTemp(Snapshot));
+        if (Index.IsValid())
+        {
+            FFunctionGraphTask::CreateAndDispatchWhenReady([Index]()
+            {
+                FPlayFabCatalogIndex::Register(Index.ToSharedRef());
+            }, TStatId(), nullptr, ENamedThreads::GameThread);
+        }
+    });
+}
+
+bool FPlayFabCatalogSnapshot::Load(EKind Kind, const FString& CatalogVersion, const FString& StoreId)
+{
+    TArray<uint8> Snapshot;
+    if (!FFileHelper::LoadFileToArray(Snapshot, *GetPath(Kind, CatalogVersion, StoreId), FILEREAD_Silent) || !Load(MoveTemp(Snapshot)))
+    {
+        return false;
+    }
+
+    // A different key that happened to hash to the same file name
+    if (GetKind() != Kind || GetCatalogVersion() != CatalogVersion || GetStoreId() != StoreId)
+    {
+        Reset();
+        return false;
+    }
+    return true;
+}
+
+bool FPlayFabCatalogSnapshot::Load(TArray<uint8>&& Snapshot)
+{
+    Reset();
+    Data = MoveTemp(Snapshot);
+    if (!Validate())
+    {
+        Reset();
+        return false;
+    }
+    return true;
+}
+
+void FPlayFabCatalogSnapshot::Reset()
+{
+    Data.Empty();
+    Header = nullptr;
+    Items = nullptr;
+    Tags = nullptr;
+    Prices = nullptr;
+    Strings = nullptr;
+}
+
+bool FPlayFabCatalogSnapshot::Validate()
+{
+    const uint64 Size = Data.Num();
+    if (Size < sizeof(FPlayFabSnapshotHeader))
+    {
+        return false;
+    }
+
+    const FPlayFabSnapshotHeader* Candidate = (const FPlayFabSnapshotHeader*)Data.GetData();
+    if (Candidate->Magic != SnapshotMagic || Candidate->Version != FormatVersion || Candidate->Size != Size || Candidate->Kind > (uint32)EKind::Store)
+    {
+        return false;
+    }
+
+    auto TableFits = [Size](uint32 Offset, uint64 Count, uint64 RowSize)
+    {
+        return Offset % 4 == 0 && Offset <= Size && Count * RowSize <= Size - Offset;
+    };
+    if (!TableFits(Candidate->ItemsOffset, Candidate->ItemCount, sizeof(FPlayFabSnapshotItem))
+        || !TableFits(Candidate->TagsOffset, Candidate->TagCount, sizeof(FPlayFabSnapshotString))
+        || !TableFits(Candidate->PricesOffset, Candidate->PriceCount, sizeof(FPlayFabSnapshotPrice))
+        || !TableFits(Candidate->StringsOffset, Candidate->StringsSize, 1))
+    {
+        return false;
+    }
+
+    const FPlayFabSnapshotItem* CandidateItems = (const FPlayFabSnapshotItem*)(Data.GetData() + Candidate->ItemsOffset);
+    const FPlayFabSnapshotString* CandidateTags = (const FPlayFabSnapshotString*)(Data.GetData() + Candidate->TagsOffset);
+    const FPlayFabSnapshotPrice* CandidatePrices = (const FPlayFabSnapshotPrice*)(Data.GetData() + Candidate->PricesOffset);
+
+    // One pass over the fixed-size tables, so accessors never need to check bounds
+    const uint64 StringsSize = Candidate->StringsSize;
+    auto StringFits = [StringsSize](const FPlayFabSnapshotString& String)
+    {
+        return (uint64)String.Offset + String.Length <= StringsSize;
+    };
+    if (!StringFits(Candidate->CatalogVersion) || !StringFits(Candidate->StoreId))
+    {
+        return false;
+    }
+    for (uint32 Index = 0; Index < Candidate->ItemCount; ++Index)
+    {
+        const FPlayFabSnapshotItem& Item = CandidateItems[Index];
+        if (!StringFits(Item.ItemId) || !StringFits(Item.ItemClass) || !StringFits(Item.DisplayName) || !StringFits(Item.Description)
+            || !StringFits(Item.ItemImageUrl) || !StringFits(Item.CustomData) || !StringFits(Item.Json)
+            || (uint64)Item.FirstTag + Item.TagCount > Candidate->TagCount
+            || (uint64)Item.FirstPrice + Item.PriceCount > Candidate->PriceCount)
+        {
+            return false;
+        }
+    }
+    for (uint32 Index = 0; Index < Candidate->TagCount; ++Index)
+    {
+        if (!StringFits(CandidateTags[Index]))
+        {
+            return false;
+        }
+    }
+    for (uint32 Index = 0; Index < Candidate->PriceCount; ++Index)
+    {
+        if (!StringFits(CandidatePrices[Index].Currency))
+        {
+            return false;
+        }
+    }
+
+    Header = Candidate;
+    Items = CandidateItems;
+    Tags = CandidateTags;
+    Prices = CandidatePrices;
+    Strings = (const ANSICHAR*)(Data.GetData() + Candidate->StringsOffset);
+    return true;
+}
+
+bool FPlayFabCatalogSnapshot::Equals(const FPlayFabSnapshotString& String, const ANSICHAR* Other, int32 OtherLength) const
+{
+    return (int32)String.Length == OtherLength && FMemory::Memcmp(GetChars(String), Other, OtherLength) == 0;
+}
+
+FString FPlayFabCatalogSnapshot::ToString(const FPlayFabSnapshotString& String) const
+{
+    FUTF8ToTCHAR Converter(GetChars(String), String.Length);
+    return FString(Converter.Length(), Converter.Get());
+}
@@ -0,0 +1,388 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab error code table.
+//
+// The table is generated from the PlayFab API error list, along with the category of each code.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabErrorCodes.h"
+
+const FPlayFabErrorCodes::FEntry FPlayFabErrorCodes::Entries[] =
+{
+    { TEXT("InvalidParams"), EPlayFabErrorCategory::ClientBug }, // 1000
+    { TEXT("AccountNotFound"), EPlayFabErrorCategory::Permanent }, // 1001
+    { TEXT("AccountBanned"), EPlayFabErrorCategory::Permanent }, // 1002
+    { TEXT("InvalidUsernameOrPassword"), EPlayFabErrorCategory::Permanent }, // 1003
+    { TEXT("InvalidTitleId"), EPlayFabErrorCategory::ClientBug }, // 1004
+    { TEXT("InvalidEmailAddress"), EPlayFabErrorCategory::Permanent }, // 1005
+    { TEXT("EmailAddressNotAvailable"), EPlayFabErrorCategory::Permanent }, // 1006
+    { TEXT("InvalidUsername"), EPlayFabErrorCategory::Permanent }, // 1007
+    { TEXT("InvalidPassword"), EPlayFabErrorCategory::Permanent }, // 1008
+    { TEXT("UsernameNotAvailable"), EPlayFabErrorCategory::Permanent }, // 1009
+    { TEXT("InvalidSteamTicket"), EPlayFabErrorCategory::Permanent }, // 1010
+    { TEXT("AccountAlreadyLinked"), EPlayFabErrorCategory::Permanent }, // 1011
+    { TEXT("LinkedAccountAlreadyClaimed"), EPlayFabErrorCategory::Permanent }, // 1012
+    { TEXT("InvalidFacebookToken"), EPlayFabErrorCategory::Permanent }, // 1013
+    { TEXT("AccountNotLinked"), EPlayFabErrorCategory::Permanent }, // 1014
+    { TEXT("FailedByPaymentProvider"), EPlayFabErrorCategory::Permanent }, // 1015
+    { TEXT("CouponCodeNotFound"), EPlayFabErrorCategory::Permanent }, // 1016
+    { TEXT("InvalidContainerItem"), EPlayFabErrorCategory::Permanent }, // 1017
+    { TEXT("ContainerNotOwned"), EPlayFabErrorCategory::Permanent }, // 1018
+    { TEXT("KeyNotOwned"), EPlayFabErrorCategory::Permanent }, // 1019
+    { TEXT("InvalidItemIdInTable"), EPlayFabErrorCategory::Permanent }, // 1020
+    { TEXT("InvalidReceipt"), EPlayFabErrorCategory::Permanent }, // 1021
+    { TEXT("ReceiptAlreadyUsed"), EPlayFabErrorCategory::Permanent }, // 1022
+    { TEXT("ReceiptCancelled"), EPlayFabErrorCategory::Permanent }, // 1023
+    { TEXT("GameNotFound"), EPlayFabErrorCategory::Permanent }, // 1024
+    { TEXT("GameModeNotFound"), EPlayFabErrorCategory::Permanent }, // 1025
+    { TEXT("InvalidGoogleToken"), EPlayFabErrorCategory::Permanent }, // 1026
+    { TEXT("UserIsNotPartOfDeveloper"), EPlayFabErrorCategory::Permanent }, // 1027
+    { TEXT("InvalidTitleForDeveloper"), EPlayFabErrorCategory::Permanent }, // 1028
+    { TEXT("TitleNameConflicts"), EPlayFabErrorCategory::Permanent }, // 1029
+    { TEXT("UserisNotValid"), EPlayFabErrorCategory::Permanent }, // 1030
+    { TEXT("ValueAlreadyExists"), EPlayFabErrorCategory::Permanent }, // 1031
+    { TEXT("BuildNotFound"), EPlayFabErrorCategory::Permanent }, // 1032
+    { TEXT("PlayerNotInGame"), EPlayFabErrorCategory::Permanent }, // 1033
+    { TEXT("InvalidTicket"), EPlayFabErrorCategory::Permanent }, // 1034
+    { TEXT("InvalidDeveloper"), EPlayFabErrorCategory::Permanent }, // 1035
+    { TEXT("InvalidOrderInfo"), EPlayFabErrorCategory::Permanent }, // 1036
+    { TEXT("RegistrationIncomplete"), EPlayFabErrorCategory::Permanent }, // 1037
+    { TEXT("InvalidPlatform"), EPlayFabErrorCategory::Permanent }, // 1038
+    { TEXT("UnknownError"), EPlayFabErrorCategory::Permanent }, // 1039
+    { TEXT("SteamApplicationNotOwned"), EPlayFabErrorCategory::Permanent }, // 1040
+    { TEXT("WrongSteamAccount"), EPlayFabErrorCategory::Permanent }, // 1041
+    { TEXT("TitleNotActivated"), EPlayFabErrorCategory::Permanent }, // 1042
+    { TEXT("RegistrationSessionNotFound"), EPlayFabErrorCategory::Permanent }, // 1043
+    { TEXT("NoSuchMod"), EPlayFabErrorCategory::Permanent }, // 1044
+    { TEXT("FileNotFound"), EPlayFabErrorCategory::Permanent }, // 1045
+    { TEXT("DuplicateEmail"), EPlayFabErrorCategory::Permanent }, // 1046
+    { TEXT("ItemNotFound"), EPlayFabErrorCategory::Permanent }, // 1047
+    { TEXT("ItemNotOwned"), EPlayFabErrorCategory::Permanent }, // 1048
+    { TEXT("ItemNotRecycleable"), EPlayFabErrorCategory::Permanent }, // 1049
+    { TEXT("ItemNotAffordable"), EPlayFabErrorCategory::Permanent }, // 1050
+    { TEXT("InvalidVirtualCurrency"), EPlayFabErrorCategory::Permanent }, // 1051
+    { TEXT("WrongVirtualCurrency"), EPlayFabErrorCategory::Permanent }, // 1052
+    { TEXT("WrongPrice"), EPlayFabErrorCategory::Permanent }, // 1053
+    { TEXT("NonPositiveValue"), EPlayFabErrorCategory::Permanent }, // 1054
+    { TEXT("InvalidRegion"), EPlayFabErrorCategory::Permanent }, // 1055
+    { TEXT("RegionAtCapacity"), EPlayFabErrorCategory::Retryable }, // 1056
+    { TEXT("ServerFailedToStart"), EPlayFabErrorCategory::Retryable }, // 1057
+    { TEXT("NameNotAvailable"), EPlayFabErrorCategory::Permanent }, // 1058
+    { TEXT("InsufficientFunds"), EPlayFabErrorCategory::Permanent }, // 1059
+    { TEXT("InvalidDeviceID"), EPlayFabErrorCategory::Permanent }, // 1060
+    { TEXT("InvalidPushNotificationToken"), EPlayFabErrorCategory::Permanent }, // 1061
+    { TEXT("NoRemainingUses"), EPlayFabErrorCategory::Permanent }, // 1062
+    { TEXT("InvalidPaymentProvider"), EPlayFabErrorCategory::Permanent }, // 1063
+    { TEXT("PurchaseInitializationFailure"), EPlayFabErrorCategory::Permanent }, // 1064
+    { TEXT("DuplicateUsername"), EPlayFabErrorCategory::Permanent }, // 1065
+    { TEXT("InvalidBuyerInfo"), EPlayFabErrorCategory::Permanent }, // 1066
+    { TEXT("NoGameModeParamsSet"), EPlayFabErrorCategory::Permanent }, // 1067
+    { TEXT("BodyTooLarge"), EPlayFabErrorCategory::ClientBug }, // 1068
+    { TEXT("ReservedWordInBody"), EPlayFabErrorCategory::ClientBug }, // 1069
+    { TEXT("InvalidTypeInBody"), EPlayFabErrorCategory::ClientBug }, // 1070
+    { TEXT("InvalidRequest"), EPlayFabErrorCategory::ClientBug }, // 1071
+    { TEXT("ReservedEventName"), EPlayFabErrorCategory::ClientBug }, // 1072
+    { TEXT("InvalidUserStatistics"), EPlayFabErrorCategory::Permanent }, // 1073
+    { TEXT("NotAuthenticated"), EPlayFabErrorCategory::AuthExpired }, // 1074
+    { TEXT("StreamAlreadyExists"), EPlayFabErrorCategory::Permanent }, // 1075
+    { TEXT("ErrorCreatingStream"), EPlayFabErrorCategory::Permanent }, // 1076
+    { TEXT("StreamNotFound"), EPlayFabErrorCategory::Permanent }, // 1077
+    { TEXT("InvalidAccount"), EPlayFabErrorCategory::Permanent }, // 1078
+    { TEXT(""), EPlayFabErrorCategory::Permanent }, // 1079, unassigned
+    { TEXT("PurchaseDoesNotExist"), EPlayFabErrorCategory::Permanent }, // 1080
+    { TEXT("InvalidPurchaseTransactionStatus"), EPlayFabErrorCategory::Permanent }, // 1081
+    { TEXT("APINotEnabledForGameClientAccess"), EPlayFabErrorCategory::ClientBug }, // 1082
+    { TEXT("NoPushNotificationARNForTitle"), EPlayFabErrorCategory::Permanent }, // 1083
+    { TEXT("BuildAlreadyExists"), EPlayFabErrorCategory::Permanent }, // 1084
+    { TEXT("BuildPackageDoesNotExist"), EPlayFabErrorCategory::Permanent }, // 1085
+    { TEXT(""), EPlayFabErrorCategory::Permanent }, // 1086, unassigned
+    { TEXT("CustomAnalyticsEventsNotEnabledForTitle"), EPlayFabErrorCategory::Permanent }, // 1087
+    { TEXT("InvalidSharedGroupId"), EPlayFabErrorCategory::Permanent }, // 1088
+    { TEXT("NotAuthorized"), EPlayFabErrorCategory::Permanent }, // 1089
+    { TEXT("MissingTitleGoogleProperties"), EPlayFabErrorCategory::Permanent }, // 1090
+    { TEXT("InvalidItemProperties"), EPlayFabErrorCategory::Permanent }, // 1091
+    { TEXT("InvalidPSNAuthCode"), EPlayFabErrorCategory::Permanent }, // 1092
+    { TEXT("InvalidItemId"), EPlayFabErrorCategory::Permanent }, // 1093
+    { TEXT("PushNotEnabledForAccount"), EPlayFabErrorCategory::Permanent }, // 1094
+    { TEXT("PushServiceError"), EPlayFabErrorCategory::Permanent }, // 1095
+    { TEXT("ReceiptDoesNotContainInAppItems"), EPlayFabErrorCategory::Permanent }, // 1096
+    { TEXT("ReceiptContainsMultipleInAppItems"), EPlayFabErrorCategory::Permanent }, // 1097
+    { TEXT("InvalidBundleID"), EPlayFabErrorCategory::Permanent }, // 1098
+    { TEXT("JavascriptException"), EPlayFabErrorCategory::Permanent }, // 1099
+    { TEXT("InvalidSessionTicket"), EPlayFabErrorCategory::AuthExpired }, // 1100
+    { TEXT("UnableToConnectToDatabase"), EPlayFabErrorCategory::Retryable }, // 1101
+    { TEXT(""), EPlayFabErrorCategory::Permanent }, // 1102, unassigned
+    { TEXT(""), EPlayFabErrorCategory::Permanent }, // 1103, unassigned
+    { TEXT(""), EPlayFabErrorCategory::Permanent }, // 1104, unassigned
+    { TEXT(""), EPlayFabErrorCategory::Permanent }, // 1105, unassigned
+    { TEXT(""), EPlayFabErrorCategory::Permanent }, // 1106, unassigned
+    { TEXT(""), EPlayFabErrorCategory::Permanent }, // 1107, unassigned
+    { TEXT(""), EPlayFabErrorCategory::Permanent }, // 1108, unassigned
+    { TEXT(""), EPlayFabErrorCategory::Permanent }, // 1109, unassigned
+    { TEXT("InternalServerError"), EPlayFabErrorCategory::Retryable }, // 1110
+    { TEXT("InvalidReportDate"), EPlayFabErrorCategory::Permanent }, // 1111
+    { TEXT("ReportNotAvailable"), EPlayFabErrorCategory::Permanent }, // 1112
+    { TEXT("DatabaseThroughputExceeded"), EPlayFabErrorCategory::Throttled }, // 1113
+    { TEXT(""), EPlayFabErrorCategory::Permanent }, // 1114, unassigned
+    { TEXT("InvalidGameTicket"), EPlayFabErrorCategory::Permanent }, // 1115
+    { TEXT("ExpiredGameTicket"), EPlayFabErrorCategory::AuthExpired }, // 1116
+    { TEXT("GameTicketDoesNotMatchLobby"), EPlayFabErrorCategory::Permanent }, // 1117
+    { TEXT("LinkedDeviceAlreadyClaimed"), EPlayFabErrorCategory::Permanent }, // 1118
+    { TEXT("DeviceAlreadyLinked"), EPlayFabErrorCategory::Permanent }, // 1119
+    { TEXT("DeviceNotLinked"), EPlayFabErrorCategory::Permanent }, // 1120
+    { TEXT("PartialFailure"), EPlayFabErrorCategory::Permanent }, // 1121
+    { TEXT("PublisherNotSet"), EPlayFabErrorCategory::Permanent }, // 1122
+    { TEXT("ServiceUnavailable"), EPlayFabErrorCategory::Retryable }, // 1123
+    { TEXT("VersionNotFound"), EPlayFabErrorCategory::Permanent }, // 1124
+    { TEXT("RevisionNotFound"), EPlayFabErrorCategory::Permanent }, // 1125
+    { TEXT("InvalidPublisherId"), EPlayFabErrorCategory::Permanent }, // 1126
+    { TEXT("DownstreamServiceUnavailable"), EPlayFabErrorCategory::Retryable }, // 1127
+    { TEXT("APINotIncludedInTitleUsageTier"), EPlayFabErrorCategory::Permanent }, // 1128
+    { TEXT("DAULimitExceeded"), EPlayFabErrorCategory::Permanent }, // 1129
+    { TEXT("APIRequestLimitExceeded"), EPlayFabErrorCategory::Throttled }, // 1130
+    { TEXT("InvalidAPIEndpoint"), EPlayFabErrorCategory::ClientBug }, // 1131
+    { TEXT("BuildNotAvailable"), EPlayFabErrorCategory::Permanent }, // 1132
+    { TEXT("ConcurrentEditError"), EPlayFabErrorCategory::Retryable }, // 1133
+    { TEXT("ContentNotFound"), EPlayFabErrorCategory::Permanent }, // 1134
+    { TEXT("CharacterNotFound"), EPlayFabErrorCategory::Permanent }, // 1135
+    { TEXT("CloudScriptNotFound"), EPlayFabErrorCategory::Permanent }, // 1136
+    { TEXT("ContentQuotaExceeded"), EPlayFabErrorCategory::Permanent }, // 1137
+    { TEXT("InvalidCharacterStatistics"), EPlayFabErrorCategory::Permanent }, // 1138
+    { TEXT("PhotonNotEnabledForTitle"), EPlayFabErrorCategory::Permanent }, // 1139
+    { TEXT("PhotonApplicationNotFound"), EPlayFabErrorCategory::Permanent }, // 1140
+    { TEXT("PhotonApplicationNotAssociatedWithTitle"), EPlayFabErrorCategory::Permanent }, // 1141
+    { TEXT("InvalidEmailOrPassword"), EPlayFabErrorCategory::Permanent }, // 1142
+    { TEXT("FacebookAPIError"), EPlayFabErrorCategory::Permanent }, // 1143
+    { TEXT("InvalidContentType"), EPlayFabErrorCategory::ClientBug }, // 1144
+    { TEXT("KeyLengthExceeded"), EPlayFabErrorCategory::ClientBug }, // 1145
+    { TEXT("DataLengthExceeded"), EPlayFabErrorCategory::ClientBug }, // 1146
+    { TEXT("TooManyKeys"), EPlayFabErrorCategory::ClientBug }, // 1147
+    { TEXT("FreeTierCannotHaveVirtualCurrency"), EPlayFabErrorCategory::Permanent }, // 1148
+    { TEXT("MissingAmazonSharedKey"), EPlayFabErrorCategory::Permanent }, // 1149
+    { TEXT("AmazonValidationError"), EPlayFabErrorCategory::Permanent }, // 1150
+    { TEXT("InvalidPSNIssuerId"), EPlayFabErrorCategory::Permanent }, // 1151
+    { TEXT("PSNInaccessible"), EPlayFabErrorCategory::Retryable }, // 1152
+    { TEXT("ExpiredAuthToken"), EPlayFabErrorCategory::AuthExpired }, // 1153
+    { TEXT("FailedToGetEntitlements"), EPlayFabErrorCategory::Permanent }, // 1154
+    { TEXT("FailedToConsumeEntitlement"), EPlayFabErrorCategory::Permanent }, // 1155
+    { TEXT("TradeAcceptingUserNotAllowed"), EPlayFabErrorCategory::Permanent }, // 1156
+    { TEXT("TradeInventoryItemIsAssignedToCharacter"), EPlayFabErrorCategory::Permanent }, // 1157
+    { TEXT("TradeInventoryItemIsBundle"), EPlayFabErrorCategory::Permanent }, // 1158
+    { TEXT("TradeStatusNotValidForCancelling"), EPlayFabErrorCategory::Permanent }, // 1159
+    { TEXT("TradeStatusNotValidForAccepting"), EPlayFabErrorCategory::Permanent }, // 1160
+    { TEXT("TradeDoesNotExist"), EPlayFabErrorCategory::Permanent }, // 1161
+    { TEXT("TradeCancelled"), EPlayFabErrorCategory::Permanent }, // 1162
+    { TEXT("TradeAlreadyFilled"), EPlayFabErrorCategory::Permanent }, // 1163
+    { TEXT("TradeWaitForStatusTimeout"), EPlayFabErrorCategory::Retryable }, // 1164
+    { TEXT("TradeInventoryItemExpired"), EPlayFabErrorCategory::Permanent }, // 1165
+    { TEXT("TradeMissingOfferedAndAcceptedItems"), EPlayFabErrorCategory::Permanent }, // 1166
+    { TEXT("TradeAcceptedItemIsBundle"), EPlayFabErrorCategory::Permanent }, // 1167
+    { TEXT("TradeAcceptedItemIsStackable"), EPlayFabErrorCategory::Permanent }, // 1168
+    { TEXT("TradeInventoryItemInvalidStatus"), EPlayFabErrorCategory::Permanent }, // 1169
+    { TEXT("TradeAcceptedCatalogItemInvalid"), EPlayFabErrorCategory::Permanent }, // 1170
+    { TEXT("TradeAllowedUsersInvalid"), EPlayFabErrorCategory::Permanent }, // 1171
+    { TEXT("TradeInventoryItemDoesNotExist"), EPlayFabErrorCategory::Permanent }, // 1172
+    { TEXT("TradeInventoryItemIsConsumed"), EPlayFabErrorCategory::Permanent }, // 1173
+    { TEXT("TradeInventoryItemIsStackable"), EPlayFabErrorCategory::Permanent }, // 1174
+    { TEXT("TradeAcceptedItemsMismatch"), EPlayFabErrorCategory::Permanent }, // 1175
+    { TEXT("InvalidKongregateToken"), EPlayFabErrorCategory::Permanent }, // 1176
+    { TEXT("FeatureNotConfiguredForTitle"), EPlayFabErrorCategory::Permanent }, // 1177
+    { TEXT("NoMatchingCatalogItemForReceipt"), EPlayFabErrorCategory::Permanent }, // 1178
+    { TEXT("InvalidCurrencyCode"), EPlayFabErrorCategory::Permanent }, // 1179
+    { TEXT("NoRealMoneyPriceForCatalogItem"), EPlayFabErrorCategory::Permanent }, // 1180
+    { TEXT("TradeInventoryItemIsNotTradable"), EPlayFabErrorCategory::Permanent }, // 1181
+    { TEXT("TradeAcceptedCatalogItemIsNotTradable"), EPlayFabErrorCategory::Permanent }, // 1182
+    { TEXT("UsersAlreadyFriends"), EPlayFabErrorCategory::Permanent }, // 1183
+    { TEXT("LinkedIdentifierAlreadyClaimed"), EPlayFabErrorCategory::Permanent }, // 1184
+    { TEXT("CustomIdNotLinked"), EPlayFabErrorCategory::Permanent }, // 1185
+    { TEXT("TotalDataSizeExceeded"), EPlayFabErrorCategory::Permanent }, // 1186
+    { TEXT("DeleteKeyConflict"), EPlayFabErrorCategory::Permanent }, // 1187
+    { TEXT("InvalidXboxLiveToken"), EPlayFabErrorCategory::Permanent }, // 1188
+    { TEXT("ExpiredXboxLiveToken"), EPlayFabErrorCategory::AuthExpired }, // 1189
+    { TEXT("ResettableStatisticVersionRequired"), EPlayFabErrorCategory::Permanent }, // 1190
+    { TEXT("NotAuthorizedByTitle"), EPlayFabErrorCategory::Permanent }, // 1191
+    { TEXT("NoPartnerEnabled"), EPlayFabErrorCategory::Permanent }, // 1192
+    { TEXT("InvalidPartnerResponse"), EPlayFabErrorCategory::Permanent }, // 1193
+    { TEXT("APINotEnabledForGameServerAccess"), EPlayFabErrorCategory::ClientBug }, // 1194
+    { TEXT("StatisticNotFound"), EPlayFabErrorCategory::Permanent }, // 1195
+    { TEXT("StatisticNameConflict"), EPlayFabErrorCategory::Permanent }, // 1196
+    { TEXT("StatisticVersionClosedForWrites"), EPlayFabErrorCategory::Permanent }, // 1197
+    { TEXT("StatisticVersionInvalid"), EPlayFabErrorCategory::Permanent }, // 1198
+    { TEXT("APIClientRequestRateLimitExceeded"), EPlayFabErrorCategory::Throttled }, // 1199
+    { TEXT("InvalidJSONContent"), EPlayFabErrorCategory::ClientBug }, // 1200
+    { TEXT("InvalidDropTable"), EPlayFabErrorCategory::Permanent }, // 1201
+    { TEXT("StatisticVersionAlreadyIncrementedForScheduledInterval"), EPlayFabErrorCategory::Permanent }, // 1202
+    { TEXT("StatisticCountLimitExceeded"), EPlayFabErrorCategory::Permanent }, // 1203
+    { TEXT("StatisticVersionIncrementRateExceeded"), EPlayFabErrorCategory::Throttled }, // 1204
+    { TEXT("ContainerKeyInvalid"), EPlayFabErrorCategory::Permanent }, // 1205
+    { TEXT("CloudScriptExecutionTimeLimitExceeded"), EPlayFabErrorCategory::Permanent }, // 1206
+    { TEXT("NoWritePermissionsForEvent"), EPlayFabErrorCategory::Permanent }, // 1207
+    { TEXT("CloudScriptFunctionArgumentSizeExceeded"), EPlayFabErrorCategory::ClientBug }, // 1208
+    { TEXT("CloudScriptAPIRequestCountExceeded"), EPlayFabErrorCategory::Permanent }, // 1209
+    { TEXT("CloudScriptAPIRequestError"), EPlayFabErrorCategory::Permanent }, // 1210
+    { TEXT("CloudScriptHTTPRequestError"), EPlayFabErrorCategory::Permanent }, // 1211
+    { TEXT("InsufficientGuildRole"), EPlayFabErrorCategory::Permanent }, // 1212
+    { TEXT("GuildNotFound"), EPlayFabErrorCategory::Permanent }, // 1213
+    { TEXT("OverLimit"), EPlayFabErrorCategory::Throttled }, // 1214
+    { TEXT("EventNotFound"), EPlayFabErrorCategory::Permanent }, // 1215
+    { TEXT("InvalidEventField"), EPlayFabErrorCategory::Permanent }, // 1216
+    { TEXT("InvalidEventName"), EPlayFabErrorCategory::Permanent }, // 1217
+    { TEXT("CatalogNotConfigured"), EPlayFabErrorCategory::Permanent }, // 1218
+    { TEXT("OperationNotSupportedForPlatform"), EPlayFabErrorCategory::Permanent }, // 1219
+    { TEXT("SegmentNotFound"), EPlayFabErrorCategory::Permanent }, // 1220
+    { TEXT("StoreNotFound"), EPlayFabErrorCategory::Permanent }, // 1221
+    { TEXT("InvalidStatisticName"), EPlayFabErrorCategory::Permanent }, // 1222
+    { TEXT("TitleNotQualifiedForLimit"), EPlayFabErrorCategory::Permanent }, // 1223
+    { TEXT("InvalidServiceLimitLevel"), EPlayFabErrorCategory::Permanent }, // 1224
+    { TEXT("ServiceLimitLevelInTransition"), EPlayFabErrorCategory::Permanent }, // 1225
+    { TEXT("CouponAlreadyRedeemed"), EPlayFabErrorCategory::Permanent }, // 1226
+    { TEXT("GameServerBuildSizeLimitExceeded"), EPlayFabErrorCategory::Permanent }, // 1227
+    { TEXT("GameServerBuildCountLimitExceeded"), EPlayFabErrorCategory::Permanent }, // 1228
+    { TEXT("VirtualCurrencyCountLimitExceeded"), EPlayFabErrorCategory::Permanent }, // 1229
+    { TEXT("VirtualCurrencyCodeExists"), EPlayFabErrorCategory::Permanent }, // 1230
+    { TEXT("TitleNewsItemCountLimitExceeded"), EPlayFabErrorCategory::Permanent }, // 1231
+    { TEXT("InvalidTwitchToken"), EPlayFabErrorCategory::Permanent }, // 1232
+    { TEXT("TwitchResponseError"), EPlayFabErrorCategory::Permanent }, // 1233
+    { TEXT("ProfaneDisplayName"), EPlayFabErrorCategory::Permanent }, // 1234
+    { TEXT("UserAlreadyAdded"), EPlayFabErrorCategory::Permanent }, // 1235
+    { TEXT("InvalidVirtualCurrencyCode"), EPlayFabErrorCategory::Permanent }, // 1236
+    { TEXT("VirtualCurrencyCannotBeDeleted"), EPlayFabErrorCategory::Permanent }, // 1237
+    { TEXT("IdentifierAlreadyClaimed"), EPlayFabErrorCategory::Permanent }, // 1238
+    { TEXT("IdentifierNotLinked"), EPlayFabErrorCategory::Permanent }, // 1239
+    { TEXT("InvalidContinuationToken"), EPlayFabErrorCategory::ClientBug }, // 1240
+    { TEXT("ExpiredContinuationToken"), EPlayFabErrorCategory::Permanent }, // 1241
+    { TEXT("InvalidSegment"), EPlayFabErrorCategory::Permanent }, // 1242
+    { TEXT("InvalidSessionId"), EPlayFabErrorCategory::Permanent }, // 1243
+    { TEXT("SessionLogNotFound"), EPlayFabErrorCategory::Permanent }, // 1244
+    { TEXT("InvalidSearchTerm"), EPlayFabErrorCategory::Permanent }, // 1245
+    { TEXT("TwoFactorAuthenticationTokenRequired"), EPlayFabErrorCategory::Permanent }, // 1246
+    { TEXT("GameServerHostCountLimitExceeded"), EPlayFabErrorCategory::Permanent }, // 1247
+    { TEXT("PlayerTagCountLimitExceeded"), EPlayFabErrorCategory::Permanent }, // 1248
+    { TEXT("RequestAlreadyRunning"), EPlayFabErrorCategory::Permanent }, // 1249
+    { TEXT("ActionGroupNotFound"), EPlayFabErrorCategory::Permanent }, // 1250
+    { TEXT("MaximumSegmentBulkActionJobsRunning"), EPlayFabErrorCategory::Permanent }, // 1251
+    { TEXT("NoActionsOnPlayersInSegmentJob"), EPlayFabErrorCategory::Permanent }, // 1252
+    { TEXT("DuplicateStatisticName"), EPlayFabErrorCategory::Permanent }, // 1253
+    { TEXT("ScheduledTaskNameConflict"), EPlayFabErrorCategory::Permanent }, // 1254
+    { TEXT("ScheduledTaskCreateConflict"), EPlayFabErrorCategory::Permanent }, // 1255
+    { TEXT("InvalidScheduledTaskName"), EPlayFabErrorCategory::Permanent }, // 1256
+    { TEXT("InvalidTaskSchedule"), EPlayFabErrorCategory::Permanent }, // 1257
+    { TEXT("SteamNotEnabledForTitle"), EPlayFabErrorCategory::Permanent }, // 1258
+    { TEXT("LimitNotAnUpgradeOption"), EPlayFabErrorCategory::Permanent }, // 1259
+    { TEXT("NoSecretKeyEnabledForCloudScript"), EPlayFabErrorCategory::Permanent }, // 1260
+    { TEXT("TaskNotFound"), EPlayFabErrorCategory::Permanent }, // 1261
+    { TEXT("TaskInstanceNotFound"), EPlayFabErrorCategory::Permanent }, // 1262
+    { TEXT("InvalidIdentityProviderId"), EPlayFabErrorCategory::Permanent }, // 1263
+    { TEXT("MisconfiguredIdentityProvider"), EPlayFabErrorCategory::Permanent }, // 1264
+    { TEXT("InvalidScheduledTaskType"), EPlayFabErrorCategory::Permanent }, // 1265
+    { TEXT("BillingInformationRequired"), EPlayFabErrorCategory::Permanent }, // 1266
+    { TEXT("LimitedEditionItemUnavailable"), EPlayFabErrorCategory::Permanent }, // 1267
+    { TEXT("InvalidAdPlacementAndReward"), EPlayFabErrorCategory::Permanent }, // 1268
+    { TEXT("AllAdPlacementViewsAlreadyConsumed"), EPlayFabErrorCategory::Permanent }, // 1269
+    { TEXT("GoogleOAuthNotConfiguredForTitle"), EPlayFabErrorCategory::Permanent }, // 1270
+    { TEXT("GoogleOAuthError"), EPlayFabErrorCategory::Permanent }, // 1271
+    { TEXT("UserNotFriend"), EPlayFabErrorCategory::Permanent }, // 1272
+    { TEXT("InvalidSignature"), EPlayFabErrorCategory::Permanent }, // 1273
+    { TEXT("InvalidPublicKey"), EPlayFabErrorCategory::Permanent }, // 1274
+    { TEXT("GoogleOAuthNoIdTokenIncludedInResponse"), EPlayFabErrorCategory::Permanent }, // 1275
+    { TEXT("StatisticUpdateInProgress"), EPlayFabErrorCategory::Retryable }, // 1276
+    { TEXT("LeaderboardVersionNotAvailable"), EPlayFabErrorCategory::Permanent }, // 1277
+    { TEXT(""), EPlayFabErrorCategory::Permanent }, // 1278, unassigned
+    { TEXT("StatisticAlreadyHasPrizeTable"), EPlayFabErrorCategory::Permanent }, // 1279
+    { TEXT("PrizeTableHasOverlappingRanks"), EPlayFabErrorCategory::Permanent }, // 1280
+    { TEXT("PrizeTableHasMissingRanks"), EPlayFabErrorCategory::Permanent }, // 1281
+    { TEXT("PrizeTableRankStartsAtZero"), EPlayFabErrorCategory::Permanent }, // 1282
+    { TEXT("InvalidStatistic"), EPlayFabErrorCategory::Permanent }, // 1283
+    { TEXT("ExpressionParseFailure"), EPlayFabErrorCategory::Permanent }, // 1284
+    { TEXT("ExpressionInvokeFailure"), EPlayFabErrorCategory::Permanent }, // 1285
+    { TEXT("ExpressionTooLong"), EPlayFabErrorCategory::Permanent }, // 1286
+    { TEXT("DataUpdateRateExceeded"), EPlayFabErrorCategory::Throttled }, // 1287
+    { TEXT("RestrictedEmailDomain"), EPlayFabErrorCategory::Permanent }, // 1288
+    { TEXT("EncryptionKeyDisabled"), EPlayFabErrorCategory::Permanent }, // 1289
+    { TEXT("EncryptionKeyMissing"), EPlayFabErrorCategory::Permanent }, // 1290
+    { TEXT("EncryptionKeyBroken"), EPlayFabErrorCategory::Permanent }, // 1291
+    { TEXT("NoSharedSecretKeyConfigured"), EPlayFabErrorCategory::Permanent }, // 1292
+    { TEXT("SecretKeyNotFound"), EPlayFabErrorCategory::Permanent }, // 1293
+    { TEXT("PlayerSecretAlreadyConfigured"), EPlayFabErrorCategory::Permanent }, // 1294
+    { TEXT("APIRequestsDisabledForTitle"), EPlayFabErrorCategory::Permanent }, // 1295
+    { TEXT("InvalidSharedSecretKey"), EPlayFabErrorCategory::Permanent }, // 1296
+    { TEXT("PrizeTableHasNoRanks"), EPlayFabErrorCategory::Permanent }, // 1297
+    { TEXT("ProfileDoesNotExist"), EPlayFabErrorCategory::Permanent }, // 1298
+    { TEXT("ContentS3OriginBucketNotConfigured"), EPlayFabErrorCategory::Permanent }, // 1299
+    { TEXT("InvalidEnvironmentForReceipt"), EPlayFabErrorCategory::Permanent }, // 1300
+    { TEXT("EncryptedRequestNotAllowed"), EPlayFabErrorCategory::ClientBug }, // 1301
+    { TEXT("SignedRequestNotAllowed"), EPlayFabErrorCategory::ClientBug }, // 1302
+    { TEXT("RequestViewConstraintParamsNotAllowed"), EPlayFabErrorCategory::ClientBug }, // 1303
+    { TEXT("BadPartnerConfiguration"), EPlayFabErrorCategory::Permanent }, // 1304
+    { TEXT("XboxBPCertificateFailure"), EPlayFabErrorCategory::Permanent }, // 1305
+    { TEXT("XboxXASSExchangeFailure"), EPlayFabErrorCategory::Permanent }, // 1306
+    { TEXT("InvalidEntityId"), EPlayFabErrorCategory::ClientBug }, // 1307
+    { TEXT("StatisticValueAggregationOverflow"), EPlayFabErrorCategory::Permanent }, // 1308
+    { TEXT("EmailMessageFromAddressIsMissing"), EPlayFabErrorCategory::Permanent }, // 1309
+    { TEXT("EmailMessageToAddressIsMissing"), EPlayFabErrorCategory::Permanent }, // 1310
+    { TEXT("SmtpServerAuthenticationError"), EPlayFabErrorCategory::Permanent }, // 1311
+    { TEXT("SmtpServerLimitExceeded"), EPlayFabErrorCategory::Permanent }, // 1312
+    { TEXT("SmtpServerInsufficientStorage"), EPlayFabErrorCategory::Permanent }, // 1313
+    { TEXT("SmtpServerCommunicationError"), EPlayFabErrorCategory::Retryable }, // 1314
+    { TEXT("SmtpServerGeneralFailure"), EPlayFabErrorCategory::Permanent }, // 1315
+    { TEXT("EmailClientTimeout"), EPlayFabErrorCategory::Retryable }, // 1316
+    { TEXT("EmailClientCanceledTask"), EPlayFabErrorCategory::Permanent }, // 1317
+    { TEXT("EmailTemplateMissing"), EPlayFabErrorCategory::Permanent }, // 1318
+    { TEXT("InvalidHostForTitleId"), EPlayFabErrorCategory::ClientBug }, // 1319
+    { TEXT("EmailConfirmationTokenDoesNotExist"), EPlayFabErrorCategory::Permanent }, // 1320
+    { TEXT("EmailConfirmationTokenExpired"), EPlayFabErrorCategory::Permanent }, // 1321
+    { TEXT("AccountDeleted"), EPlayFabErrorCategory::Permanent }, // 1322
+    { TEXT("PlayerSecretNotConfigured"), EPlayFabErrorCategory::Permanent }, // 1323
+    { TEXT("InvalidSignatureTime"), EPlayFabErrorCategory::Permanent }, // 1324
+    { TEXT("NoContactEmailAddressFound"), EPlayFabErrorCategory::Permanent }, // 1325
+};
+
+const FPlayFabErrorCodes::FEntry* FPlayFabErrorCodes::Find(int32 ErrorCode)
+{
+    static_assert(ARRAY_COUNT(Entries) == LastCode - FirstCode + 1, "The error code table must have a row per code");
+
+    if (ErrorCode < FirstCode || ErrorCode > LastCode)
+    {
+        return nullptr;
+    }
+    return &Entries[ErrorCode - FirstCode];
+}
+
+const TCHAR* FPlayFabErrorCodes::GetName(int32 ErrorCode)
+{
+    if (ErrorCode == 0)
+    {
+        return TEXT("Success");
+    }
+    const FEntry* Entry = Find(ErrorCode);
+    return Entry != nullptr ? Entry->Name : TEXT("");
+}
+
+EPlayFabErrorCategory FPlayFabErrorCodes::GetCategory(int32 ErrorCode)
+{
+    if (ErrorCode == 0)
+    {
+        return EPlayFabErrorCategory::None;
+    }
+    const FEntry* Entry = Find(ErrorCode);
+    return Entry != nullptr ? Entry->Category : EPlayFabErrorCategory::Permanent;
+}
+
+bool FPlayFabErrorCodes::IsKnown(int32 ErrorCode)
+{
+    return *GetName(ErrorCode) != 0;
+}
+
+const TCHAR* FPlayFabErrorCodes::GetCategoryName(EPlayFabErrorCategory Category)
+{
+    switch (Category)
+    {
+    case EPlayFabErrorCategory::None: return TEXT("None");
+    case EPlayFabErrorCategory::Retryable: return TEXT("Retryable");
+    case EPlayFabErrorCategory::Throttled: return TEXT("Throttled");
+    case EPlayFabErrorCategory::AuthExpired: return TEXT("AuthExpired");
+    case EPlayFabErrorCategory::Permanent: return TEXT("Permanent");
+    case EPlayFabErrorCategory::ClientBug: return TEXT("ClientBug");
+    default: return TEXT("");
+    }
+}
@@ -221,8 +221,10 @@ TArray<UPlayFabJsonValue*> UPlayFabJsonObject::GetArrayField(const FString& Fiel
         return OutArray;
     }
 
-    TArray< TSharedPtr<FJsonValue> > ValArray = JsonObj->GetArrayField(FieldName);
-    for (auto Value : ValArray)
+    // Read the array in place rather than copying it
+    const FPlayFabJsonArrayView ValArray = GetView().GetArrayField(FieldName);
+    OutArray.Reserve(ValArray.Num());
+    for (const TSharedPtr<FJsonValue>& Value : ValArray)
     {
         UPlayFabJsonValue* NewValue = NewObject<UPlayFabJsonValue>();
         NewValue->SetRootValue(Value);
@@ -337,10 +339,10 @@ TArray<float> UPlayFabJsonObject::GetNumberArrayField(const FString& FieldName)
         return NumberArray;
     }
 
-    TArray<TSharedPtr<FJsonValue> > JsonArrayValues = JsonObj->GetArrayField(FieldName);
-    for (TArray<TSharedPtr<FJsonValue> >::TConstIterator It(JsonArrayValues); It; ++It)
+    const FPlayFabJsonArrayView JsonArrayValues = GetView().GetArrayField(FieldName);
+    for (const TSharedPtr<FJsonValue>& Value : JsonArrayValues)
     {
-        NumberArray.Add((*It)->AsNumber());
+        NumberArray.Add(Value->AsNumber());
     }
 
     return NumberArray;
@@ -372,10 +374,10 @@ TArray<FString> UPlayFabJsonObject::GetStringArrayField(const FString& FieldName
         return StringArray;
     }
 
-    TArray<TSharedPtr<FJsonValue> > JsonArrayValues = JsonObj->GetArrayField(FieldName);
-    for (TArray<TSharedPtr<FJsonValue> >::TConstIterator It(JsonArrayValues); It; ++It)
+    const FPlayFabJsonArrayView JsonArrayValues = GetView().GetArrayField(FieldName);
+    for (const TSharedPtr<FJsonValue>& Value : JsonArrayValues)
     {
-        StringArray.Add((*It)->AsString());
+        StringArray.Add(Value->AsString());
     }
 
     return StringArray;
@@ -407,10 +409,10 @@ TArray<bool> UPlayFabJsonObject::GetBoolArrayField(const FString& FieldName)
         return BoolArray;
     }
 
-    TArray<TSharedPtr<FJsonValue> > JsonArrayValues = JsonObj->GetArrayField(FieldName);
-    for (TArray<TSharedPtr<FJsonValue> >::TConstIterator It(JsonArrayValues); It; ++It)
+    const FPlayFabJsonArrayView JsonArrayValues = GetView().GetArrayField(FieldName);
+    for (const TSharedPtr<FJsonValue>& Value : JsonArrayValues)
     {
-        BoolArray.Add((*It)->AsBool());
+        BoolArray.Add(Value->AsBool());
     }
 
     return BoolArray;
@@ -442,8 +444,9 @@ TArray<UPlayFabJsonObject*> UPlayFabJsonObject::GetObjectArrayField(const FStrin
         return OutArray;
     }
 
-    TArray< TSharedPtr<FJsonValue> > ValArray = JsonObj->GetArrayField(FieldName);
-    for (auto Value : ValArray)
+    const FPlayFabJsonArrayView ValArray = GetView().GetArrayField(FieldName);
+    OutArray.Reserve(ValArray.Num());
+    for (const TSharedPtr<FJsonValue>& Value : ValArray)
     {
         TSharedPtr<FJsonObject> NewObj = Value->AsObject();
 
@@ -0,0 +1,169 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab manager pool.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabManagerPool.h"
+#include "Engine/BlueprintGeneratedClass.h"
+
+/** A manager that hasn't been activated after this long probably never will be */
+static const double UnactivatedTimeoutSeconds = 300.0;
+
+FPlayFabManagerPool* FPlayFabManagerPool::Instance = nullptr;
+
+void FPlayFabManagerPool::Startup()
+{
+    if (Instance == nullptr)
+    {
+        Instance = new FPlayFabManagerPool();
+    }
+}
+
+void FPlayFabManagerPool::Shutdown()
+{
+    delete Instance;
+    Instance = nullptr;
+}
+
+FPlayFabManagerPool& FPlayFabManagerPool::Get()
+{
+    check(Instance != nullptr);
+    return *Instance;
+}
+
+FPlayFabManagerPool::FPlayFabManagerPool()
+    : bEnabled(false)
+    , MaxFreePerClass(256)
+    , CreatedCount(0)
+    , ReusedCount(0)
+{
+    TickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FPlayFabManagerPool::Tick), 10.0f);
+}
+
+FPlayFabManagerPool::~FPlayFabManagerPool()
+{
+    FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+}
+
+UObject* FPlayFabManagerPool::Acquire(UClass* Class)
+{
+    check(IsInGameThread());
+
+    UObject* Manager = nullptr;
+    TArray<UObject*>* FreeManagers = Free.Find(Class);
+    if (FreeManagers != nullptr && FreeManagers->Num() > 0)
+    {
+        Manager = FreeManagers->Pop(false);
+        ++ReusedCount;
+    }
+    else
+    {
+        Manager = NewObject<UObject>(GetTransientPackage(), Class);
+        ++CreatedCount;
+    }
+
+    Active.Add(Manager, FPlatformTime::Seconds());
+    return Manager;
+}
+
+void FPlayFabManagerPool::MarkActivated(UObject* Manager)
+{
+    if (double* AcquireTime = Active.Find(Manager))
+    {
+        *AcquireTime = 0.0;
+    }
+}
+
+void FPlayFabManagerPool::Release(UObject* Manager)
+{
+    if (Active.Remove(Manager) == 0 || !bEnabled)
+    {
+        return;
+    }
+
+    TArray<UObject*>& FreeManagers = Free.FindOrAdd(Manager->GetClass());
+    if (FreeManagers.Num() < MaxFreePerClass)
+    {
+        FreeManagers.Add(Manager);
+    }
+}
+
+void FPlayFabManagerPool::Discard(UObject* Manager)
+{
+    Active.Remove(Manager);
+}
+
+bool FPlayFabManagerPool::IsBlueprintObject(const UObject* Object)
+{
+    return Object != nullptr && Cast<UBlueprintGeneratedClass>(Object->GetClass()) != nullptr;
+}
+
+bool FPlayFabManagerPool::IsHeldOutside(const UObject* Manager, const FMulticastScriptDelegate& OnResponse, const FScriptDelegate& OnSuccess, const FScriptDelegate& OnFailure)
+{
+    // A Blueprint keeps the call it made in its frame, and a listener on the response event was handed responseData
+    for (const UObject* Listener : OnResponse.GetAllObjects())
+    {
+        if (Listener != Manager)
+        {
+            return true;
+        }
+    }
+    return IsBlueprintObject(OnSuccess.GetUObject()) || IsBlueprintObject(OnFailure.GetUObject());
+}
+
+void FPlayFabManagerPool::SetEnabled(bool bInEnabled)
+{
+    bEnabled = bInEnabled;
+    if (!bEnabled)
+    {
+        Free.Empty();
+    }
+}
+
+void FPlayFabManagerPool::SetMaxFreePerClass(int32 InMaxFreePerClass)
+{
+    MaxFreePerClass = FMath::Max(InMaxFreePerClass, 0);
+    for (auto& Entry : Free)
+    {
+        if (Entry.Value.Num() > MaxFreePerClass)
+        {
+            Entry.Value.SetNum(MaxFreePerClass);
+        }
+    }
+}
+
+int32 FPlayFabManagerPool::GetFreeCount() const
+{
+    int32 Count = 0;
+    for (const auto& Entry : Free)
+    {
+        Count += Entry.Value.Num();
+    }
+    return Count;
+}
+
+bool FPlayFabManagerPool::Tick(float DeltaTime)
+{
+    const double Cutoff = FPlatformTime::Seconds() - UnactivatedTimeoutSeconds;
+    for (auto It = Active.CreateIterator(); It; ++It)
+    {
+        if (It.Value() > 0.0 && It.Value() < Cutoff)
+        {
+            It.RemoveCurrent();
+        }
+    }
+    return true;
+}
+
+void FPlayFabManagerPool::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    for (auto& Entry : Active)
+    {
+        UObject* Manager = Entry.Key;
+        Collector.AddReferencedObject(Manager);
+    }
+    for (auto& Entry : Free)
+    {
+        Collector.AddReferencedObjects(Entry.Value);
+    }
+}
@@ -0,0 +1,894 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab request dispatcher.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabRequestDispatcher.h"
+#include "PlayFabCatalogSnapshot.h"
+#include "PlayFabCompression.h"
+#include "PlayFabErrorCodes.h"
+#include "PlayFabMetrics.h"
+#include "PlayFabRequestWriter.h"
+#include "PlayFabTracer.h"
+#include "Async/Async.h"
+#include "HAL/Event.h"
+
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Queued Calls"), STAT_PlayFabQueued, STATGROUP_PlayFab);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("In Flight Calls"), STAT_PlayFabInFlight, STATGROUP_PlayFab);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Retry Waiting Calls"), STAT_PlayFabRetryWaiting, STATGROUP_PlayFab);
+DECLARE_DWORD_ACCUMULATOR_STAT(TEXT("Paused Endpoints"), STAT_PlayFabPausedEndpoints, STATGROUP_PlayFab);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attempts Finished"), STAT_PlayFabAttempts, STATGROUP_PlayFab);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Attempts Failed"), STAT_PlayFabFailures, STATGROUP_PlayFab);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Bytes Sent"), STAT_PlayFabBytesSent, STATGROUP_PlayFab);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Bytes Received"), STAT_PlayFabBytesReceived, STATGROUP_PlayFab);
+DECLARE_CYCLE_STAT(TEXT("Callbacks"), STAT_PlayFabCallback, STATGROUP_PlayFab);
+
+static void RecordFixtures(const TArray<FString>& Args)
+{
+    const FString Directory = Args.Num() > 0 ? Args[0] : FPaths::GameSavedDir() / TEXT("PlayFab/Fixtures");
+    FPlayFabRequestDispatcher::Get().SetFixtureDirectory(Directory == TEXT("off") ? FString() : Directory);
+}
+
+static FAutoConsoleCommand RecordFixturesCommand(
+    TEXT("PlayFab.RecordFixtures"),
+    TEXT("Save every successful PlayFab response body under the given directory, Saved/PlayFab/Fixtures by default, for the benchmark commandlet. 'off' stops recording"),
+    FConsoleCommandWithArgsDelegate::CreateStatic(&RecordFixtures));
+
+FPlayFabRequestDispatcher* FPlayFabRequestDispatcher::Instance = nullptr;
+
+void FPlayFabRequestDispatcher::Startup()
+{
+    if (Instance == nullptr)
+    {
+        Instance = new FPlayFabRequestDispatcher();
+    }
+}
+
+void FPlayFabRequestDispatcher::Shutdown()
+{
+    delete Instance;
+    Instance = nullptr;
+}
+
+FPlayFabRequestDispatcher& FPlayFabRequestDispatcher::Get()
+{
+    check(Instance != nullptr);
+    return *Instance;
+}
+
+FPlayFabRequestDispatcher::FPlayFabRequestDispatcher()
+    : MaxInFlight(8)
+    , ThrottlePauseBaseSeconds(1.0f)
+    , ThrottlePauseMaxSeconds(30.0f)
+    , ThrottlePauseCount(0)
+    , NextJobId(0)
+    , PrepareJobs(MakeShareable(new FPrepareJobs()))
+    , NextCoalesceKey(0)
+    , bDeduplicateReads(true)
+    , DeduplicatedCount(0)
+    , StartupTime(FPlatformTime::Seconds())
+    , StartupReleaseTime(0.0)
+    , bOmitNullFields(false)
+    , bCompressRequests(false)
+    , CompressionThreshold(1024)
+    , CompressedRequestCount(0)
+    , CompressionBytesSaved(0)
+{
+    // Never throw away critical or high priority calls unless the caller opts in
+    QueuePolicies[(int32)EPlayFabRequestPriority::Critical] = { 128, EPlayFabQueueOverflowPolicy::Reject };
+    QueuePolicies[(int32)EPlayFabRequestPriority::High] = { 128, EPlayFabQueueOverflowPolicy::Reject };
+    QueuePolicies[(int32)EPlayFabRequestPriority::Normal] = { 256, EPlayFabQueueOverflowPolicy::DropOldest };
+    QueuePolicies[(int32)EPlayFabRequestPriority::Low] = { 256, EPlayFabQueueOverflowPolicy::Coalesce };
+
+    // Whole server fleets tend to be restarted together
+    SetStartupSpreadWindow(IsRunningDedicatedServer() ? 10.0f : 0.0f);
+
+    TickHandle = FTicker::GetCoreTicker().AddTicker(FTickerDelegate::CreateRaw(this, &FPlayFabRequestDispatcher::Tick), 0.1f);
+}
+
+FPlayFabRequestDispatcher::~FPlayFabRequestDispatcher()
+{
+    FTicker::GetCoreTicker().RemoveTicker(TickHandle);
+
+    // Unbind before cancelling, since a cancelled request may complete straight away
+    for (const TSharedPtr<IHttpRequest>& HttpRequest : InFlightRequests)
+    {
+        HttpRequest->OnProcessRequestComplete().Unbind();
+        HttpRequest->CancelRequest();
+    }
+    if (InFlightRequests.Num() > 0)
+    {
+        IPlayFab::Get().ModifyPendingCallCount(0, -InFlightRequests.Num());
+        UE_LOG(LogPlayFab, Warning, TEXT("Cancelled %d in flight PlayFab requests on shutdown."), InFlightRequests.Num());
+    }
+
+    // The prepare jobs read the json of calls in Preparing without owning it
+    while (PrepareJobs->Reading.GetValue() > 0)
+    {
+        PrepareJobs->Done->Wait();
+    }
+
+    int32 Discarded = GetQueuedCount() + RetryWaiting.Num() + Preparing.Num();
+    for (const TPair<uint32, TArray<FDispatchedRequest>>& Pair : Coalesced)
+    {
+        Discarded += Pair.Value.Num();
+    }
+    if (Discarded > 0)
+    {
+        UE_LOG(LogPlayFab, Warning, TEXT("Discarding %d queued PlayFab requests on shutdown."), Discarded);
+    }
+}
+
+void FPlayFabRequestDispatcher::SetMaxInFlight(int32 InMaxInFlight)
+{
+    MaxInFlight = FMath::Max(InMaxInFlight, 1);
+    Pump();
+}
+
+void FPlayFabRequestDispatcher::SetQueuePolicy(EPlayFabRequestPriority Priority, int32 Capacity, EPlayFabQueueOverflowPolicy Overflow)
+{
+    FQueuePolicy& Policy = QueuePolicies[(int32)Priority];
+    Policy.Capacity = FMath::Max(Capacity, 1);
+    Policy.Overflow = Overflow;
+}
+
+void FPlayFabRequestDispatcher::SetEndpointPriority(const FString& Endpoint, EPlayFabRequestPriority Priority)
+{
+    EndpointPriorities.Add(Endpoint, Priority);
+}
+
+void FPlayFabRequestDispatcher::ClearEndpointPriority(const FString& Endpoint)
+{
+    EndpointPriorities.Remove(Endpoint);
+}
+
+void FPlayFabRequestDispatcher::SetStartupSpreadWindow(float WindowSeconds)
+{
+    StartupReleaseTime = StartupTime + FMath::FRandRange(0.0f, FMath::Max(WindowSeconds, 0.0f));
+    Pump();
+}
+
+void FPlayFabRequestDispatcher::SetThrottlePause(float BaseSeconds, float MaxSeconds)
+{
+    ThrottlePauseBaseSeconds = FMath::Max(BaseSeconds, 0.0f);
+    ThrottlePauseMaxSeconds = FMath::Max(MaxSeconds, ThrottlePauseBaseSeconds);
+}
+
+float FPlayFabRequestDispatcher::GetEndpointPauseRemaining(const FString& Endpoint) const
+{
+    return FMath::Max((float)(GetResumeTime(Endpoint) - FPlatformTime::Seconds()), 0.0f);
+}
+
+int32 FPlayFabRequestDispatcher::GetPausedEndpointCount() const
+{
+    const double Now = FPlatformTime::Seconds();
+    int32 Count = 0;
+    for (const TPair<FString, FEndpointThrottle>& Pair : ThrottledEndpoints)
+    {
+        if (Pair.Value.ResumeTime > Now)
+        {
+            Count++;
+        }
+    }
+    return Count;
+}
+
+void FPlayFabRequestDispatcher::SetRequestCompression(bool bEnabled, int32 ThresholdBytes)
+{
+    bCompressRequests = bEnabled;
+    CompressionThreshold = FMath::Max(ThresholdBytes, 0);
+}
+
+int32 FPlayFabRequestDispatcher::GetQueuedCount() const
+{
+    int32 Count = 0;
+    for (const TArray<FDispatchedRequest>& Queue : Queues)
+    {
+        Count += Queue.Num();
+    }
+    return Count;
+}
+
+void FPlayFabRequestDispatcher::Submit(UObject* Owner, TSharedRef<IHttpRequest> HttpRequest, const FPlayFabDispatchInfo& Info)
+{
+    // Let the http backend keep the connection open for the next call to the same host
+    HttpRequest->SetHeader(TEXT("Connection"), TEXT("keep-alive"));
+
+    FDispatchedRequest Request;
+    Request.Owner = Owner;
+    Request.HttpRequest = HttpRequest;
+    Request.Info = Info;
+    Request.SubmitTime = FPlatformTime::Seconds();
+    Request.bSampled = FPlayFabTracer::Get().ShouldSample();
+
+    const EPlayFabRequestPriority* PriorityOverride = EndpointPriorities.Find(Info.Endpoint);
+    if (PriorityOverride != nullptr)
+    {
+        Request.Info.Priority = *PriorityOverride;
+    }
+
+    const int32 ContentSize = HttpRequest->GetContent().Num();
+    if (Request.Info.Body.IsValid() || (ContentSize > 0 && IsFingerprinted(Request.Info)) || (bCompressRequests && ContentSize >= CompressionThreshold))
+    {
+        Prepare(Request);
+        return;
+    }
+
+    Route(Request);
+}
+
+bool FPlayFabRequestDispatcher::IsFingerprinted(const FPlayFabDispatchInfo& Info) const
+{
+    return Info.bReadOnly && (bDeduplicateReads || ResponseCache.IsCacheable(Info.Endpoint));
+}
+
+void FPlayFabRequestDispatcher::Prepare(const FDispatchedRequest& Request)
+{
+    // The request and its json stay owned by the game thread. The worker only reads the json, which callers
+    // promise not to touch once submitted, and hands back plain bytes. Shutdown waits until it's done reading
+    const uint32 JobId = NextJobId++;
+    Preparing.Add(JobId, Request);
+    IPlayFab::Get().ModifyPendingCallCount(1, 0);
+
+    const FJsonObject* Body = Request.Info.Body.Get();
+    if (Body != nullptr && PrepareJobs->Reading.Increment() == 1)
+    {
+        PrepareJobs->Done->Reset();
+    }
+    const int32 GzipThreshold = bCompressRequests ? CompressionThreshold : MAX_int32;
+    TArray<uint8> Existing;
+    if (Body == nullptr)
+    {
+        Existing = Request.HttpRequest->GetContent();
+    }
+
+    // Reads are told apart by who is asking as well as what they ask for
+    FString Identity;
+    const bool bFingerprint = (Body != nullptr || Existing.Num() > 0) && IsFingerprinted(Request.Info);
+    if (bFingerprint)
+    {
+        Identity = Request.Info.Endpoint + TEXT("|") + Request.HttpRequest->GetHeader(TEXT("X-Authentication")) + TEXT("|") + Request.HttpRequest->GetHeader(TEXT("X-SecretKey"));
+    }
+
+    TSharedRef<FPrepareJobs, ESPMode::ThreadSafe> Jobs = PrepareJobs;
+    Async<void>(EAsyncExecution::ThreadPool, [JobId, Body, GzipThreshold, Existing, bFingerprint, Identity, Jobs]()
+    {
+        FPreparedBody Prepared;
+        if (Body != nullptr)
+        {
+            FPlayFabRequestWriter::WriteBody(*Body, Prepared.Content);
+        }
+        else
+        {
+            Prepared.Content = Existing;
+        }
+
+        if (bFingerprint)
+        {
+            Prepared.Canonical.Append((const uint8*)*Identity, Identity.Len() * sizeof(TCHAR));
+            if (Body != nullptr)
+            {
+                FPlayFabRequestWriter::WriteCanonical(*Body, Prepared.Canonical);
+            }
+            else
+            {
+                // A generated factory always writes its fields in the same order, so its body is already canonical
+                Prepared.Canonical.Append(Existing);
+            }
+            Prepared.Fingerprint = FMath::Max(FCrc::MemCrc32(Prepared.Canonical.GetData(), Prepared.Canonical.Num()), 1u);
+        }
+        if (Body != nullptr && Jobs->Reading.Decrement() == 0)
+        {
+            Jobs->Done->Trigger();
+        }
+
+        Prepared.UncompressedSize = Prepared.Content.Num();
+        if (Prepared.UncompressedSize >= GzipThreshold)
+        {
+            // Keep the original body if zlib failed or the data didn't shrink
+            TArray<uint8> Compressed;
+            if (FPlayFabCompression::GzipCompress(Prepared.Content, Compressed) && Compressed.Num() < Prepared.UncompressedSize)
+            {
+                Prepared.Content = MoveTemp(Compressed);
+                Prepared.bGzipped = true;
+            }
+        }
+
+        FFunctionGraphTask::CreateAndDispatchWhenReady([JobId, Prepared = MoveTemp(Prepared)]() mutable
+        {
+            if (Instance != nullptr)
+            {
+                Instance->OnRequestPrepared(JobId, Prepared);
+            }
+        }, TStatId(), nullptr, ENamedThreads::GameThread);
+    });
+}
+
+void FPlayFabRequestDispatcher::OnRequestPrepared(uint32 JobId, FPreparedBody& Prepared)
+{
+    FDispatchedRequest Request;
+    if (!Preparing.RemoveAndCopyValue(JobId, Request))
+    {
+        return;
+    }
+    IPlayFab::Get().ModifyPendingCallCount(-1, 0);
+
+    Request.HttpRequest->SetContent(Prepared.Content);
+    if (Prepared.bGzipped)
+    {
+        Request.HttpRequest->SetHeader(TEXT("Content-Encoding"), TEXT("gzip"));
+        CompressedRequestCount++;
+        CompressionBytesSaved += Prepared.UncompressedSize - Prepared.Content.Num();
+    }
+
+    if (Prepared.Fingerprint != 0)
+    {
+        Request.Fingerprint = Prepared.Fingerprint;
+        Request.Canonical = MakeShareable(new TArray<uint8>(MoveTemp(Prepared.Canonical)));
+
+        if (DeliverFromCache(Request) || (bDeduplicateReads && AttachToSharedRead(Request)))
+        {
+            return;
+        }
+    }
+
+    Route(Request);
+}
+
+bool FPlayFabRequestDispatcher::DeliverFromCache(const FDispatchedRequest& Request)
+{
+    FPlayFabParsedResponse Cached;
+    FHttpResponsePtr Response;
+    if (!ResponseCache.Find(Request.Info.Endpoint, Request.Fingerprint, *Request.Canonical, Response, Cached.Json, Cached.Body))
+    {
+        return false;
+    }
+
+    // Only successes are cached, so the owner sees the original response and shares its parsed json
+    Cached.bValidJson = true;
+    Cached.bShared = true;
+    Request.Info.OnResponse.ExecuteIfBound(Request.HttpRequest, Response, true, Cached);
+    return true;
+}
+
+bool FPlayFabRequestDispatcher::AttachToSharedRead(FDispatchedRequest& Request)
+{
+    FSharedRead* Shared = SharedReads.Find(Request.Fingerprint);
+    if (Shared == nullptr)
+    {
+        // First of its kind, later identical reads wait for this one
+        FSharedRead& NewShared = SharedReads.Add(Request.Fingerprint);
+        NewShared.Canonical = Request.Canonical;
+        Request.bLeadsSharedRead = true;
+        return false;
+    }
+
+    // A hash collision between different reads, send this one on its own
+    if (*Shared->Canonical != *Request.Canonical)
+    {
+        return false;
+    }
+
+    Shared->Followers.Add(Request);
+    IPlayFab::Get().ModifyPendingCallCount(1, 0);
+    DeduplicatedCount++;
+    return true;
+}
+
+void FPlayFabRequestDispatcher::Route(const FDispatchedRequest& Request)
+{
+    const double ResumeTime = GetResumeTime(Request.Info.Endpoint);
+    if (ResumeTime > 0.0)
+    {
+        Hold(Request, ResumeTime);
+        return;
+    }
+
+    if (InFlight.Num() < MaxInFlight && GetQueuedCount() == 0 && !IsHeldForStartup())
+    {
+        Send(Request);
+        return;
+    }
+
+    Enqueue(Request);
+}
+
+void FPlayFabRequestDispatcher::Enqueue(const FDispatchedRequest& Request)
+{
+    TArray<FDispatchedRequest>& Queue = Queues[(int32)Request.Info.Priority];
+    const FQueuePolicy& Policy = QueuePolicies[(int32)Request.Info.Priority];
+    if (Queue.Num() >= Policy.Capacity && Policy.Overflow == EPlayFabQueueOverflowPolicy::Coalesce && CoalesceWithQueued(Request))
+    {
+        return;
+    }
+
+    // Failures are delivered once the queues are consistent again, since callbacks may submit new requests
+    TArray<FDispatchedRequest> Dropped;
+    if (Queue.Num() < Policy.Capacity || ApplyOverflowPolicy(Request, Dropped))
+    {
+        Queue.Add(Request);
+        IPlayFab::Get().ModifyPendingCallCount(1, 0);
+    }
+    else
+    {
+        Dropped.Add(Request);
+    }
+
+    for (const FDispatchedRequest& DroppedRequest : Dropped)
+    {
+        Fail(DroppedRequest);
+    }
+}
+
+void FPlayFabRequestDispatcher::Hold(const FDispatchedRequest& Request, double ResumeTime)
+{
+    FDispatchedRequest Held = Request;
+    Held.NotBefore = ResumeTime;
+    RetryWaiting.Add(Held);
+    IPlayFab::Get().ModifyPendingCallCount(1, 0);
+}
+
+double FPlayFabRequestDispatcher::GetResumeTime(const FString& Endpoint) const
+{
+    if (ThrottledEndpoints.Num() == 0)
+    {
+        return 0.0;
+    }
+
+    const FEndpointThrottle* Throttle = ThrottledEndpoints.Find(Endpoint);
+    return Throttle != nullptr && Throttle->ResumeTime > FPlatformTime::Seconds() ? Throttle->ResumeTime : 0.0;
+}
+
+void FPlayFabRequestDispatcher::PauseEndpoint(const FString& Endpoint, FHttpResponsePtr Response, const FPlayFabParsedResponse& Parsed)
+{
+    if (ThrottlePauseBaseSeconds <= 0.0f)
+    {
+        return;
+    }
+
+    const double Now = FPlatformTime::Seconds();
+    FEndpointThrottle& Throttle = ThrottledEndpoints.FindOrAdd(Endpoint);
+    if (Throttle.ResumeTime > Now)
+    {
+        // Calls sent before the pause began are still coming back, they don't make it any longer
+        return;
+    }
+
+    Throttle.Strikes++;
+    float PauseSeconds = FMath::Min(ThrottlePauseMaxSeconds, ThrottlePauseBaseSeconds * FMath::Pow(2.0f, (float)(Throttle.Strikes - 1)));
+
+    // The service may say how long to stay away, in a Retry-After header or the error body
+    double RetryAfter = Response.IsValid() ? FCString::Atod(*Response->GetHeader(TEXT("Retry-After"))) : 0.0;
+    if (Parsed.Json.IsValid())
+    {
+        Parsed.Json->TryGetNumberField(TEXT("retryAfterSeconds"), RetryAfter);
+    }
+    if (RetryAfter > 0.0)
+    {
+        PauseSeconds = FMath::Min((float)RetryAfter, ThrottlePauseMaxSeconds);
+    }
+
+    Throttle.ResumeTime = Now + PauseSeconds;
+    ThrottlePauseCount++;
+    UE_LOG(LogPlayFab, Warning, TEXT("%s is throttled (%s), holding its calls for %.1fs"), *Endpoint,
+        Parsed.Error.hasError ? FPlayFabErrorCodes::GetName(Parsed.Error.ErrorCode) : TEXT("HTTP 429"), PauseSeconds);
+}
+
+void FPlayFabRequestDispatcher::ResumeEndpoint(const FString& Endpoint)
+{
+    if (ThrottledEndpoints.Num() == 0)
+    {
+        return;
+    }
+
+    // A call sent before the pause began may still succeed, only a success after it clears the throttling
+    const FEndpointThrottle* Throttle = ThrottledEndpoints.Find(Endpoint);
+    if (Throttle != nullptr && Throttle->ResumeTime <= FPlatformTime::Seconds())
+    {
+        ThrottledEndpoints.Remove(Endpoint);
+        UE_LOG(LogPlayFab, Log, TEXT("%s is no longer throttled"), *Endpoint);
+    }
+}
+
+bool FPlayFabRequestDispatcher::CoalesceWithQueued(const FDispatchedRequest& Request)
+{
+    // A write merged into another would report success for a write that only happened once
+    if (!Request.Info.bReadOnly)
+    {
+        return false;
+    }
+
+    for (FDispatchedRequest& Queued : Queues[(int32)Request.Info.Priority])
+    {
+        if (IsSameCall(Queued, Request))
+        {
+            if (Queued.CoalesceKey == 0)
+            {
+                // 0 means no merged calls, so skip it when the key wraps
+                if (++NextCoalesceKey == 0)
+                {
+                    ++NextCoalesceKey;
+                }
+                Queued.CoalesceKey = NextCoalesceKey;
+            }
+            Coalesced.FindOrAdd(Queued.CoalesceKey).Add(Request);
+            IPlayFab::Get().ModifyPendingCallCount(1, 0);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool FPlayFabRequestDispatcher::IsSameCall(const FDispatchedRequest& A, const FDispatchedRequest& B)
+{
+    return A.Info.Endpoint == B.Info.Endpoint
+        && A.HttpRequest->GetHeader(TEXT("X-Authentication")) == B.HttpRequest->GetHeader(TEXT("X-Authentication"))
+        && A.HttpRequest->GetHeader(TEXT("X-SecretKey")) == B.HttpRequest->GetHeader(TEXT("X-SecretKey"))
+        && A.HttpRequest->GetContent() == B.HttpRequest->GetContent();
+}
+
+bool FPlayFabRequestDispatcher::ApplyOverflowPolicy(const FDispatchedRequest& Request, TArray<FDispatchedRequest>& OutDropped)
+{
+    TArray<FDispatchedRequest>& Queue = Queues[(int32)Request.Info.Priority];
+    const int32 DropIndex = 0;
+
+    // Coalesce gets here when there is no identical call to merge with, and drops the oldest like DropOldest
+    if (QueuePolicies[(int32)Request.Info.Priority].Overflow == EPlayFabQueueOverflowPolicy::Reject)
+    {
+        UE_LOG(LogPlayFab, Warning, TEXT("Request queue full, rejecting %s"), *Request.Info.Endpoint);
+        return false;
+    }
+
+    UE_LOG(LogPlayFab, Warning, TEXT("Request queue full, dropping %s"), *Queue[DropIndex].Info.Endpoint);
+    OutDropped.Add(Queue[DropIndex]);
+    Queue.RemoveAt(DropIndex, 1, false);
+    IPlayFab::Get().ModifyPendingCallCount(-1, 0);
+    return true;
+}
+
+void FPlayFabRequestDispatcher::Pump()
+{
+    if (IsHeldForStartup())
+    {
+        return;
+    }
+
+    for (int32 PriorityIndex = 0; PriorityIndex < PriorityCount && InFlight.Num() < MaxInFlight; ++PriorityIndex)
+    {
+        TArray<FDispatchedRequest>& Queue = Queues[PriorityIndex];
+        while (InFlight.Num() < MaxInFlight && Queue.Num() > 0)
+        {
+            FDispatchedRequest Request = Queue[0];
+            Queue.RemoveAt(0, 1, false);
+            IPlayFab::Get().ModifyPendingCallCount(-1, 0);
+
+            // Calls to an endpoint paused while they were queued wait for it to resume, without taking a slot
+            const double ResumeTime = GetResumeTime(Request.Info.Endpoint);
+            if (ResumeTime > 0.0)
+            {
+                Hold(Request, ResumeTime);
+                continue;
+            }
+            Send(Request);
+        }
+    }
+}
+
+void FPlayFabRequestDispatcher::Send(const FDispatchedRequest& Request)
+{
+    FDispatchedRequest Sent = Request;
+    Sent.Attempts++;
+    Sent.SendTime = FPlatformTime::Seconds();
+
+    // Route the response through the dispatcher so the slot is released, and the call possibly retried, before the owner sees it
+    Sent.HttpRequest->OnProcessRequestComplete().BindRaw(this, &FPlayFabRequestDispatcher::OnRequestComplete, Sent);
+
+    InFlight.Add(Sent.Owner);
+    InFlightRequests.Add(Sent.HttpRequest);
+    IPlayFab::Get().ModifyPendingCallCount(0, 1);
+    Sent.HttpRequest->ProcessRequest();
+}
+
+void FPlayFabRequestDispatcher::Fail(const FDispatchedRequest& Request)
+{
+    RecordAttempt(Request, nullptr, FPlayFabParsedResponse(), true);
+
+    // The request was never started, which is how the owner tells a dropped call from a transport failure
+    Deliver(Request, nullptr, false, FPlayFabParsedResponse());
+}
+
+void FPlayFabRequestDispatcher::OnRequestComplete(FHttpRequestPtr Request, FHttpResponsePtr Response, bool bWasSuccessful, FDispatchedRequest Dispatched)
+{
+    // The connection is free as soon as the bytes are in, the call stays in flight until it is delivered
+    InFlight.RemoveSingleSwap(Dispatched.Owner);
+    InFlightRequests.RemoveSingleSwap(Dispatched.HttpRequest);
+    Dispatched.ReceiveTime = FPlatformTime::Seconds();
+    Pump();
+
+    if (!bWasSuccessful || !Response.IsValid())
+    {
+        Complete(Dispatched, Response, bWasSuccessful, FPlayFabParsedResponse(), FPlayFabRetryPolicy::Classify(Response, bWasSuccessful, nullptr));
+        return;
+    }
+
+    const uint32 JobId = NextJobId++;
+    Decoding.Add(JobId, Dispatched);
+
+    // A response that may be cached or handed to other callers is read through its tree, as is an unsuccessful one
+    const bool bBuildJson = Dispatched.Info.bNeedsJsonTree || Dispatched.Fingerprint != 0 || Dispatched.CoalesceKey != 0 || Response->GetResponseCode() != 200;
+
+    // The response pointer is thread safe. The parsed json is moved, never copied, so its counts are only ever
+    // touched by one thread at a time
+    Async<void>(EAsyncExecution::ThreadPool, [JobId, Response, bBuildJson]()
+    {
+        TSharedPtr<FPlayFabParsedResponse, ESPMode::ThreadSafe> Parsed = MakeShareable(new FPlayFabParsedResponse());
+        // The body shares the response's own count, so the content is read where the http module left it
+        const TSharedRef<const TArray<uint8>, ESPMode::ThreadSafe> Content(Response.ToSharedRef(), &Response->GetContent());
+        FPlayFabResponseReader::Decode(Content, *Parsed, bBuildJson);
+
+        // Only a well formed body reporting success, over http 200, is left without a tree
+        const FPlayFabRetryPolicy::EOutcome Outcome = Parsed->bValidJson && !Parsed->Json.IsValid()
+            ? FPlayFabRetryPolicy::EOutcome::Success
+            : FPlayFabRetryPolicy::Classify(Response, true, Parsed->Json.Get());
+
+        FFunctionGraphTask::CreateAndDispatchWhenReady([JobId, Response, Parsed, Outcome]()
+        {
+            if (Instance != nullptr)
+            {
+                Instance->OnResponseDecoded(JobId, Response, *Parsed, Outcome);
+            }
+        }, TStatId(), nullptr, ENamedThreads::GameThread);
+    });
+}
+
+void FPlayFabRequestDispatcher::OnResponseDecoded(uint32 JobId, FHttpResponsePtr Response, FPlayFabParsedResponse& Parsed, FPlayFabRetryPolicy::EOutcome Outcome)
+{
+    FDispatchedRequest Request;
+    if (!Decoding.RemoveAndCopyValue(JobId, Request))
+    {
+        return;
+    }
+
+    FPlayFabParsedResponse Result = MoveTemp(Parsed);
+    Complete(Request, Response, true, Result, Outcome);
+}
+
+void FPlayFabRequestDispatcher::Complete(const FDispatchedRequest& Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed, FPlayFabRetryPolicy::EOutcome Outcome)
+{
+    IPlayFab::Get().ModifyPendingCallCount(0, -1);
+    RecordAttempt(Request, Response, Parsed, !bWasSuccessful || Parsed.Error.hasError || Outcome != FPlayFabRetryPolicy::EOutcome::Success);
+
+    if (Outcome == FPlayFabRetryPolicy::EOutcome::Throttled)
+    {
+        PauseEndpoint(Request.Info.Endpoint, Response, Parsed);
+    }
+    else if (Outcome == FPlayFabRetryPolicy::EOutcome::Success)
+    {
+        ResumeEndpoint(Request.Info.Endpoint);
+    }
+
+    if (RetryPolicy.ShouldRetry(Outcome, Request.Info.bIdempotent, Request.Attempts))
+    {
+        // A retry to a paused endpoint waits for the pause as well as its own backoff
+        const double Now = FPlatformTime::Seconds();
+        const double NotBefore = FMath::Max(Now + RetryPolicy.GetBackoffDelay(Request.Attempts), GetResumeTime(Request.Info.Endpoint));
+        UE_LOG(LogPlayFab, Log, TEXT("Retrying %s in %.2fs (attempt %d of %d)"), *Request.Info.Endpoint, NotBefore - Now, Request.Attempts + 1, RetryPolicy.MaxAttempts);
+
+        FDispatchedRequest Retry = Request;
+        Retry.HttpRequest = CloneRequest(Request.HttpRequest);
+        Retry.NotBefore = NotBefore;
+        RetryWaiting.Add(Retry);
+        IPlayFab::Get().ModifyPendingCallCount(1, 0);
+        return;
+    }
+
+    Deliver(Request, Response, bWasSuccessful, Parsed);
+}
+
+void FPlayFabRequestDispatcher::Deliver(const FDispatchedRequest& Request, FHttpResponsePtr Response, bool bWasSuccessful, const FPlayFabParsedResponse& Parsed)
+{
+    // Detach the followers and fill the cache first, since callbacks may submit the same read again
+    FSharedRead Shared;
+    if (Request.bLeadsSharedRead && SharedReads.RemoveAndCopyValue(Request.Fingerprint, Shared))
+    {
+        IPlayFab::Get().ModifyPendingCallCount(-Shared.Followers.Num(), 0);
+    }
+    TArray<FDispatchedRequest> Merged;
+    if (Request.CoalesceKey != 0 && Coalesced.RemoveAndCopyValue(Request.CoalesceKey, Merged))
+    {
+        IPlayFab::Get().ModifyPendingCallCount(-Merged.Num(), 0);
+        Shared.Followers.Append(Merged);
+    }
+    if (Request.Fingerprint != 0 && bWasSuccessful && !Parsed.Error.hasError && Parsed.Json.IsValid())
+    {
+        ResponseCache.Add(Request.Info.Endpoint, Request.Fingerprint, *Request.Canonical, Response, Parsed.Json, Parsed.Body);
+    }
+    if (bWasSuccessful && !Parsed.Error.hasError && Parsed.bValidJson)
+    {
+        FPlayFabCatalogSnapshot::Capture(Request.Info.Endpoint, Request.HttpRequest, Request.Info.Body.Get(), Response);
+        if (!FixtureDirectory.IsEmpty())
+        {
+            RecordFixture(Request.Info.Endpoint, Response);
+        }
+    }
+
+    SCOPE_CYCLE_COUNTER(STAT_PlayFabCallback);
+    const double StartTime = FPlatformTime::Seconds();
+
+    // Followers see the request that actually ran, and share its parsed json
+    FPlayFabParsedResponse SharedParsed;
+    const FPlayFabParsedResponse* Delivered = &Parsed;
+    if (Parsed.Json.IsValid() && (Shared.Followers.Num() > 0 || (Request.Fingerprint != 0 && ResponseCache.IsCacheable(Request.Info.Endpoint))))
+    {
+        SharedParsed = Parsed;
+        SharedParsed.bShared = true;
+        Delivered = &SharedParsed;
+    }
+    Request.Info.OnResponse.ExecuteIfBound(Request.HttpRequest, Response, bWasSuccessful, *Delivered);
+    for (const FDispatchedRequest& Follower : Shared.Followers)
+    {
+        Follower.Info.OnResponse.ExecuteIfBound(Request.HttpRequest, Response, bWasSuccessful, *Delivered);
+    }
+
+    const int32 CallbackCount = 1 + Shared.Followers.Num();
+    FPlayFabMetrics::Get().RecordStage(Request.Info.Endpoint, EPlayFabCallStage::Callback, (int64)((FPlatformTime::Seconds() - StartTime) * 1000000.0 / CallbackCount));
+}
+
+void FPlayFabRequestDispatcher::RecordFixture(const FString& Endpoint, FHttpResponsePtr Response) const
+{
+    const FString Path = FixtureDirectory / Endpoint.Mid(1) + TEXT(".json");
+    Async<void>(EAsyncExecution::ThreadPool, [Path, Response]()
+    {
+        int32 BodySize = 0;
+        const uint8* Body = FPlayFabResponseReader::GetBody(Response->GetContent(), BodySize);
+        if (Body != nullptr)
+        {
+            TUniquePtr<FArchive> Writer(IFileManager::Get().CreateFileWriter(*Path));
+            if (Writer.IsValid())
+            {
+                Writer->Serialize(const_cast<uint8*>(Body), BodySize);
+            }
+        }
+    });
+}
+
+void FPlayFabRequestDispatcher::RecordAttempt(const FDispatchedRequest& Request, FHttpResponsePtr Response, const FPlayFabParsedResponse& Parsed, bool bFailed)
+{
+    const double Now = FPlatformTime::Seconds();
+
+    FPlayFabAttemptSample Sample;
+    Sample.RequestBytes = Request.HttpRequest->GetContentLength();
+    Sample.ResponseBytes = Response.IsValid() ? Response->GetContentLength() : 0;
+    Sample.bFailed = bFailed;
+    Sample.ErrorCode = Parsed.Error.hasError ? Parsed.Error.ErrorCode : 0;
+    if (Request.SendTime > 0.0)
+    {
+        Sample.StageMicros[(int32)EPlayFabCallStage::QueueWait] = (int64)((Request.SendTime - Request.SubmitTime) * 1000000.0);
+        Sample.StageMicros[(int32)EPlayFabCallStage::Network] = (int64)((Request.ReceiveTime - Request.SendTime) * 1000000.0);
+    }
+    else
+    {
+        Sample.StageMicros[(int32)EPlayFabCallStage::QueueWait] = (int64)((Now - Request.SubmitTime) * 1000000.0);
+    }
+    if (Response.IsValid() && Parsed.bValidJson)
+    {
+        Sample.StageMicros[(int32)EPlayFabCallStage::Decode] = Parsed.DecodeMicros;
+        Sample.StageMicros[(int32)EPlayFabCallStage::Parse] = Parsed.ParseMicros;
+    }
+    FPlayFabMetrics::Get().RecordAttempt(Request.Info.Endpoint, Sample);
+
+    INC_DWORD_STAT(STAT_PlayFabAttempts);
+    INC_DWORD_STAT_BY(STAT_PlayFabBytesSent, Sample.RequestBytes);
+    INC_DWORD_STAT_BY(STAT_PlayFabBytesReceived, Sample.ResponseBytes);
+    if (bFailed)
+    {
+        INC_DWORD_STAT(STAT_PlayFabFailures);
+    }
+
+    FPlayFabTraceRecord Record;
+    FCStringAnsi::Strncpy(Record.Endpoint, TCHAR_TO_ANSI(*Request.Info.Endpoint), ARRAY_COUNT(Record.Endpoint));
+    Record.RequestBytes = Request.HttpRequest->GetContentLength();
+    Record.ResponseBytes = Response.IsValid() ? Response->GetContentLength() : 0;
+    Record.HttpCode = Response.IsValid() ? Response->GetResponseCode() : 0;
+    Record.ErrorCode = Parsed.Error.hasError ? Parsed.Error.ErrorCode : 0;
+    Record.Attempt = Request.Attempts;
+    Record.SubmitTime = Request.SubmitTime;
+    if (Request.SendTime > 0.0)
+    {
+        Record.QueueMs = (Request.SendTime - Request.SubmitTime) * 1000.0;
+        Record.NetworkMs = (Request.ReceiveTime - Request.SendTime) * 1000.0;
+        Record.DecodeMs = (Now - Request.ReceiveTime) * 1000.0;
+    }
+    else
+    {
+        Record.QueueMs = (Now - Request.SubmitTime) * 1000.0;
+    }
+
+    // Only keep bodies worth looking at, they are stored as raw bytes and never formatted here
+    const bool bCaptureBodies = bFailed || Request.bSampled;
+    FPlayFabTracer::Get().Record(Record,
+        bCaptureBodies ? &Request.HttpRequest->GetContent() : nullptr,
+        bCaptureBodies && Response.IsValid() ? &Response->GetContent() : nullptr);
+}
+
+TSharedRef<IHttpRequest> FPlayFabRequestDispatcher::CloneRequest(const TSharedPtr<IHttpRequest>& Source)
+{
+    TSharedRef<IHttpRequest> Clone = FHttpModule::Get().CreateRequest();
+    Clone->SetURL(Source->GetURL());
+    Clone->SetVerb(Source->GetVerb());
+    for (const FString& Header : Source->GetAllHeaders())
+    {
+        FString Key, Value;
+        if (Header.Split(TEXT(": "), &Key, &Value))
+        {
+            Clone->SetHeader(Key, Value);
+        }
+    }
+    Clone->SetContent(Source->GetContent());
+    return Clone;
+}
+
+bool FPlayFabRequestDispatcher::Tick(float DeltaTime)
+{
+    const double Now = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < RetryWaiting.Num(); )
+    {
+        if (RetryWaiting[Index].NotBefore <= Now)
+        {
+            FDispatchedRequest Request = RetryWaiting[Index];
+            RetryWaiting.RemoveAt(Index, 1, false);
+            IPlayFab::Get().ModifyPendingCallCount(-1, 0);
+            Enqueue(Request);
+        }
+        else
+        {
+            ++Index;
+        }
+    }
+
+    Pump();
+
+    SET_DWORD_STAT(STAT_PlayFabQueued, GetQueuedCount());
+    SET_DWORD_STAT(STAT_PlayFabInFlight, InFlight.Num());
+    SET_DWORD_STAT(STAT_PlayFabRetryWaiting, RetryWaiting.Num());
+    SET_DWORD_STAT(STAT_PlayFabPausedEndpoints, GetPausedEndpointCount());
+    return true;
+}
+
+void FPlayFabRequestDispatcher::AddReferencedObjects(FReferenceCollector& Collector)
+{
+    for (TArray<FDispatchedRequest>& Queue : Queues)
+    {
+        for (FDispatchedRequest& Request : Queue)
+        {
+            Collector.AddReferencedObject(Request.Owner);
+        }
+    }
+    for (FDispatchedRequest& Request : RetryWaiting)
+    {
+        Collector.AddReferencedObject(Request.Owner);
+    }
+    for (TPair<uint32, FDispatchedRequest>& Pair : Preparing)
+    {
+        Collector.AddReferencedObject(Pair.Value.Owner);
+    }
+    for (TPair<uint32, FDispatchedRequest>& Pair : Decoding)
+    {
+        Collector.AddReferencedObject(Pair.Value.Owner);
+    }
+    for (TPair<uint32, FSharedRead>& Pair : SharedReads)
+    {
+        for (FDispatchedRequest& Follower : Pair.Value.Followers)
+        {
+            Collector.AddReferencedObject(Follower.Owner);
+        }
+    }
+    for (TPair<uint32, TArray<FDispatchedRequest>>& Pair : Coalesced)
+    {
+        for (FDispatchedRequest& Follower : Pair.Value)
+        {
+            Collector.AddReferencedObject(Follower.Owner);
+        }
+    }
+    Collector.AddReferencedObjects(InFlight);
+}
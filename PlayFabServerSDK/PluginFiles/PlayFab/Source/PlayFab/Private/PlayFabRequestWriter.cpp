@@ -0,0 +1,395 @@
+//////////////////////////////////////////////////////////////////////////////////////////////
+// This file holds the code for the PlayFab request writer.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabPrivatePCH.h"
+#include "PlayFabRequestWriter.h"
+
+#include "PlayFabJsonObject.h"
+
+void FPlayFabJsonWriter::WriteObjectStart()
+{
+    BeginValue();
+    Out.Add('{');
+    bNeedComma = false;
+}
+
+void FPlayFabJsonWriter::WriteObjectEnd()
+{
+    Out.Add('}');
+    bNeedComma = true;
+}
+
+void FPlayFabJsonWriter::BeginValue()
+{
+    if (bNeedComma)
+    {
+        Out.Add(',');
+    }
+    bNeedComma = true;
+}
+
+void FPlayFabJsonWriter::WriteKey(const ANSICHAR* Key, int32 KeyLength)
+{
+    BeginValue();
+
+    // Generated keys are plain ascii identifiers, so they need no escaping
+    const int32 Start = Out.AddUninitialized(KeyLength + 3);
+    uint8* Dest = Out.GetData() + Start;
+    Dest[0] = '"';
+    FMemory::Memcpy(Dest + 1, Key, KeyLength);
+    Dest[KeyLength + 1] = '"';
+    Dest[KeyLength + 2] = ':';
+}
+
+void FPlayFabJsonWriter::WriteLiteral(const ANSICHAR* Text, int32 Length)
+{
+    Out.Append((const uint8*)Text, Length);
+}
+
+void FPlayFabJsonWriter::WriteInteger(int64 Value)
+{
+    ANSICHAR Digits[24];
+    int32 Count = 0;
+    uint64 Magnitude = Value < 0 ? (uint64)(-(Value + 1)) + 1 : (uint64)Value;
+    do
+    {
+        Digits[Count++] = '0' + (ANSICHAR)(Magnitude % 10);
+        Magnitude /= 10;
+    } while (Magnitude > 0);
+    if (Value < 0)
+    {
+        Digits[Count++] = '-';
+    }
+
+    const int32 Start = Out.AddUninitialized(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        Out[Start + Index] = Digits[Count - 1 - Index];
+    }
+}
+
+void FPlayFabJsonWriter::WriteDouble(double Value)
+{
+    // Numbers set through UPlayFabJsonObject are whole more often than not
+    if (FMath::Abs(Value) < 9007199254740992.0 && Value == FMath::FloorToDouble(Value))
+    {
+        WriteInteger((int64)Value);
+        return;
+    }
+    if (!FMath::IsFinite(Value))
+    {
+        WriteLiteral("null", 4);
+        return;
+    }
+
+    ANSICHAR Text[32];
+    const int32 Length = FCStringAnsi::Snprintf(Text, ARRAY_COUNT(Text), "%.17g", Value);
+    WriteLiteral(Text, FMath::Clamp(Length, 0, (int32)ARRAY_COUNT(Text) - 1));
+}
+
+void FPlayFabJsonWriter::WriteQuoted(const TCHAR* Text, int32 Length)
+{
+    static const ANSICHAR Hex[] = "0123456789abcdef";
+
+    Out.Add('"');
+    for (int32 Index = 0; Index < Length; ++Index)
+    {
+        uint32 Code = (uint32)Text[Index];
+        if (Code < 0x80)
+        {
+            switch (Code)
+            {
+            case '"': WriteLiteral("\\\"", 2); break;
+            case '\\': WriteLiteral("\\\\", 2); break;
+            case '\n': WriteLiteral("\\n", 2); break;
+            case '\r': WriteLiteral("\\r", 2); break;
+            case '\t': WriteLiteral("\\t", 2); break;
+            case '\b': WriteLiteral("\\b", 2); break;
+            case '\f': WriteLiteral("\\f", 2); break;
+            default:
+                if (Code < 0x20)
+                {
+                    const ANSICHAR Escaped[] = { '\\', 'u', '0', '0', Hex[Code >> 4], Hex[Code & 0xF] };
+                    WriteLiteral(Escaped, 6);
+                }
+                else
+                {
+                    Out.Add((uint8)Code);
+                }
+                break;
+            }
+            continue;
+        }
+
+        // Join utf-16 surrogate pairs. A lone surrogate is written as the replacement character
+        if (Code >= 0xD800 && Code <= 0xDBFF && Index + 1 < Length && (uint32)Text[Index + 1] >= 0xDC00 && (uint32)Text[Index + 1] <= 0xDFFF)
+        {
+            Code = 0x10000 + ((Code - 0xD800) << 10) + ((uint32)Text[++Index] - 0xDC00);
+        }
+        else if ((Code >= 0xD800 && Code <= 0xDFFF) || Code > 0x10FFFF)
+        {
+            Code = 0xFFFD;
+        }
+
+        if (Code < 0x800)
+        {
+            const uint8 Bytes[] = { (uint8)(0xC0 | (Code >> 6)), (uint8)(0x80 | (Code & 0x3F)) };
+            Out.Append(Bytes, 2);
+        }
+        else if (Code < 0x10000)
+        {
+            const uint8 Bytes[] = { (uint8)(0xE0 | (Code >> 12)), (uint8)(0x80 | ((Code >> 6) & 0x3F)), (uint8)(0x80 | (Code & 0x3F)) };
+            Out.Append(Bytes, 3);
+        }
+        else
+        {
+            const uint8 Bytes[] = { (uint8)(0xF0 | (Code >> 18)), (uint8)(0x80 | ((Code >> 12) & 0x3F)), (uint8)(0x80 | ((Code >> 6) & 0x3F)), (uint8)(0x80 | (Code & 0x3F)) };
+            Out.Append(Bytes, 4);
+        }
+    }
+    Out.Add('"');
+}
+
+void FPlayFabJsonWriter::WriteNullField(const ANSICHAR* Key, int32 KeyLength)
+{
+    if (!bOmitNulls)
+    {
+        WriteKey(Key, KeyLength);
+        WriteLiteral("null", 4);
+    }
+}
+
+void FPlayFabJsonWriter::WriteEnumField(const ANSICHAR* Key, int32 KeyLength, const ANSICHAR* Name)
+{
+    if (Name == nullptr)
+    {
+        return;
+    }
+
+    // Enum names are plain ascii identifiers, so they need no escaping
+    WriteKey(Key, KeyLength);
+    const int32 Length = FCStringAnsi::Strlen(Name);
+    Out.Add('"');
+    Out.Append((const uint8*)Name, Length);
+    Out.Add('"');
+}
+
+void FPlayFabJsonWriter::WriteStringField(const ANSICHAR* Key, int32 KeyLength, const FString& Value)
+{
+    if (Value.IsEmpty())
+    {
+        WriteNullField(Key, KeyLength);
+        return;
+    }
+
+    WriteKey(Key, KeyLength);
+    WriteQuoted(*Value, Value.Len());
+}
+
+void FPlayFabJsonWriter::WriteObjectField(const ANSICHAR* Key, int32 KeyLength, UPlayFabJsonObject* Value)
+{
+    if (Value == nullptr || !Value->GetRootObject().IsValid())
+    {
+        return;
+    }
+
+    WriteKey(Key, KeyLength);
+    WriteObjectBody(*Value->GetRootObject());
+}
+
+void FPlayFabJsonWriter::WriteObjectArrayField(const ANSICHAR* Key, int32 KeyLength, const TArray<UPlayFabJsonObject*>& Values)
+{
+    if (Values.Num() == 0)
+    {
+        WriteNullField(Key, KeyLength);
+        return;
+    }
+
+    WriteKey(Key, KeyLength);
+    Out.Add('[');
+    bNeedComma = false;
+    for (UPlayFabJsonObject* Value : Values)
+    {
+        BeginValue();
+        if (Value != nullptr && Value->GetRootObject().IsValid())
+        {
+            WriteObjectBody(*Value->GetRootObject());
+        }
+        else
+        {
+            WriteLiteral("null", 4);
+        }
+    }
+    Out.Add(']');
+    bNeedComma = true;
+}
+
+void FPlayFabJsonWriter::WriteStringListField(const ANSICHAR* Key, int32 KeyLength, const FString& CommaSeparated)
+{
+    if (CommaSeparated.IsEmpty())
+    {
+        WriteNullField(Key, KeyLength);
+        return;
+    }
+
+    // Same elements as ParseIntoArray(..., TEXT(","), false), without building the array
+    WriteKey(Key, KeyLength);
+    Out.Add('[');
+    bNeedComma = false;
+    const TCHAR* Text = *CommaSeparated;
+    const int32 Length = CommaSeparated.Len();
+    int32 Start = 0;
+    for (int32 Index = 0; Index <= Length; ++Index)
+    {
+        if (Index == Length || Text[Index] == TEXT(','))
+        {
+            BeginValue();
+            WriteQuoted(Text + Start, Index - Start);
+            Start = Index + 1;
+        }
+    }
+    Out.Add(']');
+    bNeedComma = true;
+}
+
+void FPlayFabJsonWriter::WriteJsonObject(const FJsonObject& Object)
+{
+    BeginValue();
+    WriteObjectBody(Object);
+}
+
+void FPlayFabJsonWriter::WriteObjectBody(const FJsonObject& Object)
+{
+    Out.Add('{');
+    bNeedComma = false;
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object.Values)
+    {
+        BeginValue();
+        WriteQuoted(*Field.Key, Field.Key.Len());
+        Out.Add(':');
+        WriteValue(*Field.Value);
+    }
+    Out.Add('}');
+    bNeedComma = true;
+}
+
+void FPlayFabJsonWriter::WriteValue(const FJsonValue& Value)
+{
+    switch (Value.Type)
+    {
+    case EJson::String:
+    {
+        const FString String = Value.AsString();
+        WriteQuoted(*String, String.Len());
+        break;
+    }
+    case EJson::Number:
+        WriteDouble(Value.AsNumber());
+        break;
+    case EJson::Boolean:
+        Value.AsBool() ? WriteLiteral("true", 4) : WriteLiteral("false", 5);
+        break;
+    case EJson::Array:
+        Out.Add('[');
+        bNeedComma = false;
+        for (const TSharedPtr<FJsonValue>& Element : Value.AsArray())
+        {
+            BeginValue();
+            WriteValue(*Element);
+        }
+        Out.Add(']');
+        break;
+    case EJson::Object:
+        WriteObjectBody(*Value.AsObject());
+        break;
+    case EJson::Null:
+    case EJson::None:
+    default:
+        WriteLiteral("null", 4);
+        break;
+    }
+    bNeedComma = true;
+}
+
+static void AppendCanonical(TArray<uint8>& Out, const void* Data, int32 Size)
+{
+    Out.Append((const uint8*)Data, Size);
+}
+
+static void AppendCanonicalString(TArray<uint8>& Out, const FString& String)
+{
+    // Length prefixed, so no content can be mistaken for a delimiter
+    const int32 Length = String.Len();
+    AppendCanonical(Out, &Length, sizeof(Length));
+    AppendCanonical(Out, *String, Length * sizeof(TCHAR));
+}
+
+static void AppendCanonicalValue(TArray<uint8>& Out, const FJsonValue& Value)
+{
+    const uint8 Type = (uint8)Value.Type;
+    AppendCanonical(Out, &Type, sizeof(Type));
+
+    switch (Value.Type)
+    {
+    case EJson::String:
+        AppendCanonicalString(Out, Value.AsString());
+        break;
+    case EJson::Number:
+    {
+        const double Number = Value.AsNumber();
+        AppendCanonical(Out, &Number, sizeof(Number));
+        break;
+    }
+    case EJson::Boolean:
+    {
+        const uint8 Bool = Value.AsBool() ? 1 : 0;
+        AppendCanonical(Out, &Bool, sizeof(Bool));
+        break;
+    }
+    case EJson::Array:
+    {
+        const TArray<TSharedPtr<FJsonValue>>& Elements = Value.AsArray();
+        const int32 Count = Elements.Num();
+        AppendCanonical(Out, &Count, sizeof(Count));
+        for (const TSharedPtr<FJsonValue>& Element : Elements)
+        {
+            AppendCanonicalValue(Out, *Element);
+        }
+        break;
+    }
+    case EJson::Object:
+        FPlayFabRequestWriter::WriteCanonical(*Value.AsObject(), Out);
+        break;
+    default:
+        break;
+    }
+}
+
+void FPlayFabRequestWriter::WriteCanonical(const FJsonObject& Object, TArray<uint8>& Out)
+{
+    TArray<const TPair<FString, TSharedPtr<FJsonValue>>*, TInlineAllocator<16>> Fields;
+    for (const TPair<FString, TSharedPtr<FJsonValue>>& Field : Object.Values)
+    {
+        Fields.Add(&Field);
+    }
+    Fields.Sort([](const TPair<FString, TSharedPtr<FJsonValue>>& A, const TPair<FString, TSharedPtr<FJsonValue>>& B)
+    {
+        return A.Key.Compare(B.Key, ESearchCase::CaseSensitive) < 0;
+    });
+
+    const int32 Count = Fields.Num();
+    AppendCanonical(Out, &Count, sizeof(Count));
+    for (const TPair<FString, TSharedPtr<FJsonValue>>* Field : Fields)
+    {
+        AppendCanonicalString(Out, Field->Key);
+        AppendCanonicalValue(Out, *Field->Value);
+    }
+}
+
+void FPlayFabRequestWriter::WriteBody(const FJsonObject& Object, TArray<uint8>& OutBody)
+{
+    OutBody.Reset();
+    FPlayFabJsonWriter Writer(OutBody);
+    Writer.WriteJsonObject(Object);
+}
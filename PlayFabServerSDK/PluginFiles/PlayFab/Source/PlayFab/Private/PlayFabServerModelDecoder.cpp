@@ -6,6 +6,7 @@
 
 #include "PlayFabPrivatePCH.h"
 #include "PlayFabServerModelDecoder.h"
+#include "PlayFabJsonReader.h"
 
 //////////////////////////////////////////////////////////////////////////
 // Generated PlayFab Server API Functions
@@ -20,13 +21,49 @@ FServerAuthenticateSessionTicketResult UPlayFabServerModelDecoder::decodeAuthent
 {
     // Temp ustruct
     FServerAuthenticateSessionTicketResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.UserInfo = !(dataObj->HasField("UserInfo")) ? nullptr : dataObj->GetObjectField("UserInfo");
+    tempStruct.UserInfoView = !(dataObj.HasField("UserInfo")) ? FPlayFabJsonView() : dataObj.GetObjectField("UserInfo");
 
     return tempStruct;
 }
 
+FServerAuthenticateSessionTicketResult UPlayFabServerModelDecoder::readAuthenticateSessionTicketResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeAuthenticateSessionTicketResultResponse(Reader.GetFallbackTree(TEXT("AuthenticateSessionTicketResult"), response));
+    }
+
+    FServerAuthenticateSessionTicketResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("UserInfo"):
+            Reader.ReadObject(tempStruct.UserInfoView, TEXT("UserInfo"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeAuthenticateSessionTicketResultResponse(Reader.GetFallbackTree(TEXT("AuthenticateSessionTicketResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillAuthenticateSessionTicketResultJsonObjects(FServerAuthenticateSessionTicketResult& result)
+{
+    result.UserInfo = result.UserInfoView.WrapJsonObject();
+}
+
 FServerSetPlayerSecretResult UPlayFabServerModelDecoder::decodeSetPlayerSecretResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -36,6 +73,12 @@ FServerSetPlayerSecretResult UPlayFabServerModelDecoder::decodeSetPlayerSecretRe
     return tempStruct;
 }
 
+FServerSetPlayerSecretResult UPlayFabServerModelDecoder::readSetPlayerSecretResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerSetPlayerSecretResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -46,90 +89,378 @@ FServerBanUsersResult UPlayFabServerModelDecoder::decodeBanUsersResultResponse(U
 {
     // Temp ustruct
     FServerBanUsersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.BanDataView = !(dataObj.HasField("BanData")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("BanData");
+
+    return tempStruct;
+}
+
+FServerBanUsersResult UPlayFabServerModelDecoder::readBanUsersResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeBanUsersResultResponse(Reader.GetFallbackTree(TEXT("BanUsersResult"), response));
+    }
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    FServerBanUsersResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BanData"):
+            Reader.ReadObjectArray(tempStruct.BanDataView, TEXT("BanData"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeBanUsersResultResponse(Reader.GetFallbackTree(TEXT("BanUsersResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillBanUsersResultJsonObjects(FServerBanUsersResult& result)
+{
+    result.BanData = FPlayFabJsonView::WrapJsonObjects(result.BanDataView);
+}
+
 FServerGetPlayerProfileResult UPlayFabServerModelDecoder::decodeGetPlayerProfileResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetPlayerProfileResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayerProfile = !(dataObj->HasField("PlayerProfile")) ? nullptr : dataObj->GetObjectField("PlayerProfile");
+    tempStruct.PlayerProfileView = !(dataObj.HasField("PlayerProfile")) ? FPlayFabJsonView() : dataObj.GetObjectField("PlayerProfile");
 
     return tempStruct;
 }
 
+FServerGetPlayerProfileResult UPlayFabServerModelDecoder::readGetPlayerProfileResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerProfileResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerProfileResult"), response));
+    }
+
+    FServerGetPlayerProfileResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayerProfile"):
+            Reader.ReadObject(tempStruct.PlayerProfileView, TEXT("PlayerProfile"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerProfileResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerProfileResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetPlayerProfileResultJsonObjects(FServerGetPlayerProfileResult& result)
+{
+    result.PlayerProfile = result.PlayerProfileView.WrapJsonObject();
+}
+
 FServerGetPlayFabIDsFromFacebookIDsResult UPlayFabServerModelDecoder::decodeGetPlayFabIDsFromFacebookIDsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetPlayFabIDsFromFacebookIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Data");
+
+    return tempStruct;
+}
+
+FServerGetPlayFabIDsFromFacebookIDsResult UPlayFabServerModelDecoder::readGetPlayFabIDsFromFacebookIDsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayFabIDsFromFacebookIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromFacebookIDsResult"), response));
+    }
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    FServerGetPlayFabIDsFromFacebookIDsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObjectArray(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetPlayFabIDsFromFacebookIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromFacebookIDsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetPlayFabIDsFromFacebookIDsResultJsonObjects(FServerGetPlayFabIDsFromFacebookIDsResult& result)
+{
+    result.Data = FPlayFabJsonView::WrapJsonObjects(result.DataView);
+}
+
 FServerGetPlayFabIDsFromSteamIDsResult UPlayFabServerModelDecoder::decodeGetPlayFabIDsFromSteamIDsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetPlayFabIDsFromSteamIDsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Data");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Data");
 
     return tempStruct;
 }
 
+FServerGetPlayFabIDsFromSteamIDsResult UPlayFabServerModelDecoder::readGetPlayFabIDsFromSteamIDsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayFabIDsFromSteamIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromSteamIDsResult"), response));
+    }
+
+    FServerGetPlayFabIDsFromSteamIDsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObjectArray(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayFabIDsFromSteamIDsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayFabIDsFromSteamIDsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetPlayFabIDsFromSteamIDsResultJsonObjects(FServerGetPlayFabIDsFromSteamIDsResult& result)
+{
+    result.Data = FPlayFabJsonView::WrapJsonObjects(result.DataView);
+}
+
 FServerGetUserAccountInfoResult UPlayFabServerModelDecoder::decodeGetUserAccountInfoResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetUserAccountInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.UserInfoView = !(dataObj.HasField("UserInfo")) ? FPlayFabJsonView() : dataObj.GetObjectField("UserInfo");
+
+    return tempStruct;
+}
 
-    tempStruct.UserInfo = !(dataObj->HasField("UserInfo")) ? nullptr : dataObj->GetObjectField("UserInfo");
+FServerGetUserAccountInfoResult UPlayFabServerModelDecoder::readGetUserAccountInfoResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetUserAccountInfoResultResponse(Reader.GetFallbackTree(TEXT("GetUserAccountInfoResult"), response));
+    }
+
+    FServerGetUserAccountInfoResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("UserInfo"):
+            Reader.ReadObject(tempStruct.UserInfoView, TEXT("UserInfo"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetUserAccountInfoResultResponse(Reader.GetFallbackTree(TEXT("GetUserAccountInfoResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetUserAccountInfoResultJsonObjects(FServerGetUserAccountInfoResult& result)
+{
+    result.UserInfo = result.UserInfoView.WrapJsonObject();
+}
+
 FServerGetUserBansResult UPlayFabServerModelDecoder::decodeGetUserBansResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetUserBansResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanDataView = !(dataObj.HasField("BanData")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("BanData");
 
     return tempStruct;
 }
 
+FServerGetUserBansResult UPlayFabServerModelDecoder::readGetUserBansResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetUserBansResultResponse(Reader.GetFallbackTree(TEXT("GetUserBansResult"), response));
+    }
+
+    FServerGetUserBansResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BanData"):
+            Reader.ReadObjectArray(tempStruct.BanDataView, TEXT("BanData"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetUserBansResultResponse(Reader.GetFallbackTree(TEXT("GetUserBansResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetUserBansResultJsonObjects(FServerGetUserBansResult& result)
+{
+    result.BanData = FPlayFabJsonView::WrapJsonObjects(result.BanDataView);
+}
+
 FServerRevokeAllBansForUserResult UPlayFabServerModelDecoder::decodeRevokeAllBansForUserResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerRevokeAllBansForUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanDataView = !(dataObj.HasField("BanData")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("BanData");
 
     return tempStruct;
 }
 
+FServerRevokeAllBansForUserResult UPlayFabServerModelDecoder::readRevokeAllBansForUserResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeRevokeAllBansForUserResultResponse(Reader.GetFallbackTree(TEXT("RevokeAllBansForUserResult"), response));
+    }
+
+    FServerRevokeAllBansForUserResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BanData"):
+            Reader.ReadObjectArray(tempStruct.BanDataView, TEXT("BanData"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeRevokeAllBansForUserResultResponse(Reader.GetFallbackTree(TEXT("RevokeAllBansForUserResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillRevokeAllBansForUserResultJsonObjects(FServerRevokeAllBansForUserResult& result)
+{
+    result.BanData = FPlayFabJsonView::WrapJsonObjects(result.BanDataView);
+}
+
 FServerRevokeBansResult UPlayFabServerModelDecoder::decodeRevokeBansResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerRevokeBansResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanDataView = !(dataObj.HasField("BanData")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("BanData");
 
     return tempStruct;
 }
 
+FServerRevokeBansResult UPlayFabServerModelDecoder::readRevokeBansResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeRevokeBansResultResponse(Reader.GetFallbackTree(TEXT("RevokeBansResult"), response));
+    }
+
+    FServerRevokeBansResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BanData"):
+            Reader.ReadObjectArray(tempStruct.BanDataView, TEXT("BanData"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeRevokeBansResultResponse(Reader.GetFallbackTree(TEXT("RevokeBansResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillRevokeBansResultJsonObjects(FServerRevokeBansResult& result)
+{
+    result.BanData = FPlayFabJsonView::WrapJsonObjects(result.BanDataView);
+}
+
 FServerSendPushNotificationResult UPlayFabServerModelDecoder::decodeSendPushNotificationResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -139,6 +470,12 @@ FServerSendPushNotificationResult UPlayFabServerModelDecoder::decodeSendPushNoti
     return tempStruct;
 }
 
+FServerSendPushNotificationResult UPlayFabServerModelDecoder::readSendPushNotificationResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerSendPushNotificationResult();
+}
+
 FServerEmptyResult UPlayFabServerModelDecoder::decodeEmptyResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -148,17 +485,59 @@ FServerEmptyResult UPlayFabServerModelDecoder::decodeEmptyResultResponse(UPlayFa
     return tempStruct;
 }
 
+FServerEmptyResult UPlayFabServerModelDecoder::readEmptyResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerEmptyResult();
+}
+
 FServerUpdateBansResult UPlayFabServerModelDecoder::decodeUpdateBansResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerUpdateBansResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.BanData = !(dataObj->HasField("BanData")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("BanData");
+    tempStruct.BanDataView = !(dataObj.HasField("BanData")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("BanData");
 
     return tempStruct;
 }
 
+FServerUpdateBansResult UPlayFabServerModelDecoder::readUpdateBansResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUpdateBansResultResponse(Reader.GetFallbackTree(TEXT("UpdateBansResult"), response));
+    }
+
+    FServerUpdateBansResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("BanData"):
+            Reader.ReadObjectArray(tempStruct.BanDataView, TEXT("BanData"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeUpdateBansResultResponse(Reader.GetFallbackTree(TEXT("UpdateBansResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillUpdateBansResultJsonObjects(FServerUpdateBansResult& result)
+{
+    result.BanData = FPlayFabJsonView::WrapJsonObjects(result.BanDataView);
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -174,80 +553,326 @@ FServerDeleteUsersResult UPlayFabServerModelDecoder::decodeDeleteUsersResultResp
     return tempStruct;
 }
 
+FServerDeleteUsersResult UPlayFabServerModelDecoder::readDeleteUsersResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerDeleteUsersResult();
+}
+
 FServerGetLeaderboardResult UPlayFabServerModelDecoder::decodeGetLeaderboardResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetLeaderboardResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
-    tempStruct.NextReset = !(dataObj->HasField("NextReset")) ? TEXT("") : dataObj->GetStringField("NextReset");
+    tempStruct.LeaderboardView = !(dataObj.HasField("Leaderboard")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Leaderboard");
+    tempStruct.Version = !(dataObj.HasField("Version")) ? 0 : int(dataObj.GetNumberField("Version"));
+    tempStruct.NextReset = !(dataObj.HasField("NextReset")) ? TEXT("") : dataObj.GetStringField("NextReset");
 
     return tempStruct;
 }
 
+FServerGetLeaderboardResult UPlayFabServerModelDecoder::readGetLeaderboardResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetLeaderboardResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardResult"), response));
+    }
+
+    FServerGetLeaderboardResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Leaderboard"):
+            Reader.ReadObjectArray(tempStruct.LeaderboardView, TEXT("Leaderboard"));
+            break;
+        case FPlayFabJsonReader::Hash("Version"):
+            Reader.ReadInt(tempStruct.Version);
+            break;
+        case FPlayFabJsonReader::Hash("NextReset"):
+            Reader.ReadString(tempStruct.NextReset);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetLeaderboardResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetLeaderboardResultJsonObjects(FServerGetLeaderboardResult& result)
+{
+    result.Leaderboard = FPlayFabJsonView::WrapJsonObjects(result.LeaderboardView);
+}
+
 FServerGetLeaderboardAroundUserResult UPlayFabServerModelDecoder::decodeGetLeaderboardAroundUserResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetLeaderboardAroundUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
-    tempStruct.Version = !(dataObj->HasField("Version")) ? 0 : int(dataObj->GetNumberField("Version"));
-    tempStruct.NextReset = !(dataObj->HasField("NextReset")) ? TEXT("") : dataObj->GetStringField("NextReset");
+    tempStruct.LeaderboardView = !(dataObj.HasField("Leaderboard")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Leaderboard");
+    tempStruct.Version = !(dataObj.HasField("Version")) ? 0 : int(dataObj.GetNumberField("Version"));
+    tempStruct.NextReset = !(dataObj.HasField("NextReset")) ? TEXT("") : dataObj.GetStringField("NextReset");
 
     return tempStruct;
 }
 
+FServerGetLeaderboardAroundUserResult UPlayFabServerModelDecoder::readGetLeaderboardAroundUserResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetLeaderboardAroundUserResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardAroundUserResult"), response));
+    }
+
+    FServerGetLeaderboardAroundUserResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Leaderboard"):
+            Reader.ReadObjectArray(tempStruct.LeaderboardView, TEXT("Leaderboard"));
+            break;
+        case FPlayFabJsonReader::Hash("Version"):
+            Reader.ReadInt(tempStruct.Version);
+            break;
+        case FPlayFabJsonReader::Hash("NextReset"):
+            Reader.ReadString(tempStruct.NextReset);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetLeaderboardAroundUserResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardAroundUserResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetLeaderboardAroundUserResultJsonObjects(FServerGetLeaderboardAroundUserResult& result)
+{
+    result.Leaderboard = FPlayFabJsonView::WrapJsonObjects(result.LeaderboardView);
+}
+
 FServerGetPlayerCombinedInfoResult UPlayFabServerModelDecoder::decodeGetPlayerCombinedInfoResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetPlayerCombinedInfoResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.InfoResultPayload = !(dataObj->HasField("InfoResultPayload")) ? nullptr : dataObj->GetObjectField("InfoResultPayload");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.InfoResultPayloadView = !(dataObj.HasField("InfoResultPayload")) ? FPlayFabJsonView() : dataObj.GetObjectField("InfoResultPayload");
 
     return tempStruct;
 }
 
+FServerGetPlayerCombinedInfoResult UPlayFabServerModelDecoder::readGetPlayerCombinedInfoResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerCombinedInfoResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerCombinedInfoResult"), response));
+    }
+
+    FServerGetPlayerCombinedInfoResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("InfoResultPayload"):
+            Reader.ReadObject(tempStruct.InfoResultPayloadView, TEXT("InfoResultPayload"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerCombinedInfoResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerCombinedInfoResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetPlayerCombinedInfoResultJsonObjects(FServerGetPlayerCombinedInfoResult& result)
+{
+    result.InfoResultPayload = result.InfoResultPayloadView.WrapJsonObject();
+}
+
 FServerGetPlayerStatisticsResult UPlayFabServerModelDecoder::decodeGetPlayerStatisticsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetPlayerStatisticsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.Statistics = !(dataObj->HasField("Statistics")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Statistics");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.StatisticsView = !(dataObj.HasField("Statistics")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Statistics");
 
     return tempStruct;
 }
 
+FServerGetPlayerStatisticsResult UPlayFabServerModelDecoder::readGetPlayerStatisticsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerStatisticsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerStatisticsResult"), response));
+    }
+
+    FServerGetPlayerStatisticsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("Statistics"):
+            Reader.ReadObjectArray(tempStruct.StatisticsView, TEXT("Statistics"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerStatisticsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerStatisticsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetPlayerStatisticsResultJsonObjects(FServerGetPlayerStatisticsResult& result)
+{
+    result.Statistics = FPlayFabJsonView::WrapJsonObjects(result.StatisticsView);
+}
+
 FServerGetPlayerStatisticVersionsResult UPlayFabServerModelDecoder::decodeGetPlayerStatisticVersionsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetPlayerStatisticVersionsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.StatisticVersions = !(dataObj->HasField("StatisticVersions")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("StatisticVersions");
+    tempStruct.StatisticVersionsView = !(dataObj.HasField("StatisticVersions")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("StatisticVersions");
 
     return tempStruct;
 }
 
+FServerGetPlayerStatisticVersionsResult UPlayFabServerModelDecoder::readGetPlayerStatisticVersionsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerStatisticVersionsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerStatisticVersionsResult"), response));
+    }
+
+    FServerGetPlayerStatisticVersionsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("StatisticVersions"):
+            Reader.ReadObjectArray(tempStruct.StatisticVersionsView, TEXT("StatisticVersions"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerStatisticVersionsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerStatisticVersionsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetPlayerStatisticVersionsResultJsonObjects(FServerGetPlayerStatisticVersionsResult& result)
+{
+    result.StatisticVersions = FPlayFabJsonView::WrapJsonObjects(result.StatisticVersionsView);
+}
+
 FServerGetUserDataResult UPlayFabServerModelDecoder::decodeGetUserDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetUserDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.DataVersion = !(dataObj.HasField("DataVersion")) ? 0 : int(dataObj.GetNumberField("DataVersion"));
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
 
     return tempStruct;
 }
 
+FServerGetUserDataResult UPlayFabServerModelDecoder::readGetUserDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetUserDataResultResponse(Reader.GetFallbackTree(TEXT("GetUserDataResult"), response));
+    }
+
+    FServerGetUserDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("DataVersion"):
+            Reader.ReadInt(tempStruct.DataVersion);
+            break;
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetUserDataResultResponse(Reader.GetFallbackTree(TEXT("GetUserDataResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetUserDataResultJsonObjects(FServerGetUserDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
+}
+
 FServerUpdatePlayerStatisticsResult UPlayFabServerModelDecoder::decodeUpdatePlayerStatisticsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -257,17 +882,54 @@ FServerUpdatePlayerStatisticsResult UPlayFabServerModelDecoder::decodeUpdatePlay
     return tempStruct;
 }
 
+FServerUpdatePlayerStatisticsResult UPlayFabServerModelDecoder::readUpdatePlayerStatisticsResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerUpdatePlayerStatisticsResult();
+}
+
 FServerUpdateUserDataResult UPlayFabServerModelDecoder::decodeUpdateUserDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerUpdateUserDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+    tempStruct.DataVersion = !(dataObj.HasField("DataVersion")) ? 0 : int(dataObj.GetNumberField("DataVersion"));
 
     return tempStruct;
 }
 
+FServerUpdateUserDataResult UPlayFabServerModelDecoder::readUpdateUserDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUpdateUserDataResultResponse(Reader.GetFallbackTree(TEXT("UpdateUserDataResult"), response));
+    }
+
+    FServerUpdateUserDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("DataVersion"):
+            Reader.ReadInt(tempStruct.DataVersion);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeUpdateUserDataResultResponse(Reader.GetFallbackTree(TEXT("UpdateUserDataResult"), response));
+    }
+    return tempStruct;
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -278,32 +940,135 @@ FServerGetCatalogItemsResult UPlayFabServerModelDecoder::decodeGetCatalogItemsRe
 {
     // Temp ustruct
     FServerGetCatalogItemsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.CatalogView = !(dataObj.HasField("Catalog")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Catalog");
+
+    return tempStruct;
+}
 
-    tempStruct.Catalog = !(dataObj->HasField("Catalog")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Catalog");
+FServerGetCatalogItemsResult UPlayFabServerModelDecoder::readGetCatalogItemsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCatalogItemsResultResponse(Reader.GetFallbackTree(TEXT("GetCatalogItemsResult"), response));
+    }
 
+    FServerGetCatalogItemsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Catalog"):
+            Reader.ReadObjectArray(tempStruct.CatalogView, TEXT("Catalog"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetCatalogItemsResultResponse(Reader.GetFallbackTree(TEXT("GetCatalogItemsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetCatalogItemsResultJsonObjects(FServerGetCatalogItemsResult& result)
+{
+    result.Catalog = FPlayFabJsonView::WrapJsonObjects(result.CatalogView);
+}
+
 FServerGetPublisherDataResult UPlayFabServerModelDecoder::decodeGetPublisherDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetPublisherDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
 
     return tempStruct;
 }
 
+FServerGetPublisherDataResult UPlayFabServerModelDecoder::readGetPublisherDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPublisherDataResultResponse(Reader.GetFallbackTree(TEXT("GetPublisherDataResult"), response));
+    }
+
+    FServerGetPublisherDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPublisherDataResultResponse(Reader.GetFallbackTree(TEXT("GetPublisherDataResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetPublisherDataResultJsonObjects(FServerGetPublisherDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
+}
+
 FServerGetTimeResult UPlayFabServerModelDecoder::decodeGetTimeResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetTimeResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.Time = !(dataObj.HasField("Time")) ? TEXT("") : dataObj.GetStringField("Time");
+
+    return tempStruct;
+}
 
-    tempStruct.Time = !(dataObj->HasField("Time")) ? TEXT("") : dataObj->GetStringField("Time");
+FServerGetTimeResult UPlayFabServerModelDecoder::readGetTimeResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetTimeResultResponse(Reader.GetFallbackTree(TEXT("GetTimeResult"), response));
+    }
 
+    FServerGetTimeResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Time"):
+            Reader.ReadString(tempStruct.Time);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetTimeResultResponse(Reader.GetFallbackTree(TEXT("GetTimeResult"), response));
+    }
     return tempStruct;
 }
 
@@ -311,24 +1076,96 @@ FServerGetTitleDataResult UPlayFabServerModelDecoder::decodeGetTitleDataResultRe
 {
     // Temp ustruct
     FServerGetTitleDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
 
     return tempStruct;
 }
 
+FServerGetTitleDataResult UPlayFabServerModelDecoder::readGetTitleDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetTitleDataResultResponse(Reader.GetFallbackTree(TEXT("GetTitleDataResult"), response));
+    }
+
+    FServerGetTitleDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetTitleDataResultResponse(Reader.GetFallbackTree(TEXT("GetTitleDataResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetTitleDataResultJsonObjects(FServerGetTitleDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
+}
+
 FServerGetTitleNewsResult UPlayFabServerModelDecoder::decodeGetTitleNewsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetTitleNewsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.NewsView = !(dataObj.HasField("News")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("News");
+
+    return tempStruct;
+}
+
+FServerGetTitleNewsResult UPlayFabServerModelDecoder::readGetTitleNewsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetTitleNewsResultResponse(Reader.GetFallbackTree(TEXT("GetTitleNewsResult"), response));
+    }
 
-    tempStruct.News = !(dataObj->HasField("News")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("News");
+    FServerGetTitleNewsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("News"):
+            Reader.ReadObjectArray(tempStruct.NewsView, TEXT("News"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetTitleNewsResultResponse(Reader.GetFallbackTree(TEXT("GetTitleNewsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetTitleNewsResultJsonObjects(FServerGetTitleNewsResult& result)
+{
+    result.News = FPlayFabJsonView::WrapJsonObjects(result.NewsView);
+}
+
 FServerSetPublisherDataResult UPlayFabServerModelDecoder::decodeSetPublisherDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -338,6 +1175,12 @@ FServerSetPublisherDataResult UPlayFabServerModelDecoder::decodeSetPublisherData
     return tempStruct;
 }
 
+FServerSetPublisherDataResult UPlayFabServerModelDecoder::readSetPublisherDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerSetPublisherDataResult();
+}
+
 FServerSetTitleDataResult UPlayFabServerModelDecoder::decodeSetTitleDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -347,6 +1190,12 @@ FServerSetTitleDataResult UPlayFabServerModelDecoder::decodeSetTitleDataResultRe
     return tempStruct;
 }
 
+FServerSetTitleDataResult UPlayFabServerModelDecoder::readSetTitleDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerSetTitleDataResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -357,37 +1206,145 @@ FServerModifyCharacterVirtualCurrencyResult UPlayFabServerModelDecoder::decodeMo
 {
     // Temp ustruct
     FServerModifyCharacterVirtualCurrencyResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? TEXT("") : dataObj->GetStringField("VirtualCurrency");
-    tempStruct.Balance = !(dataObj->HasField("Balance")) ? 0 : int(dataObj->GetNumberField("Balance"));
+    tempStruct.VirtualCurrency = !(dataObj.HasField("VirtualCurrency")) ? TEXT("") : dataObj.GetStringField("VirtualCurrency");
+    tempStruct.Balance = !(dataObj.HasField("Balance")) ? 0 : int(dataObj.GetNumberField("Balance"));
 
     return tempStruct;
 }
 
+FServerModifyCharacterVirtualCurrencyResult UPlayFabServerModelDecoder::readModifyCharacterVirtualCurrencyResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeModifyCharacterVirtualCurrencyResultResponse(Reader.GetFallbackTree(TEXT("ModifyCharacterVirtualCurrencyResult"), response));
+    }
+
+    FServerModifyCharacterVirtualCurrencyResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadString(tempStruct.VirtualCurrency);
+            break;
+        case FPlayFabJsonReader::Hash("Balance"):
+            Reader.ReadInt(tempStruct.Balance);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeModifyCharacterVirtualCurrencyResultResponse(Reader.GetFallbackTree(TEXT("ModifyCharacterVirtualCurrencyResult"), response));
+    }
+    return tempStruct;
+}
+
 FServerModifyUserVirtualCurrencyResult UPlayFabServerModelDecoder::decodeModifyUserVirtualCurrencyResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerModifyUserVirtualCurrencyResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? TEXT("") : dataObj->GetStringField("VirtualCurrency");
-    tempStruct.BalanceChange = !(dataObj->HasField("BalanceChange")) ? 0 : int(dataObj->GetNumberField("BalanceChange"));
-    tempStruct.Balance = !(dataObj->HasField("Balance")) ? 0 : int(dataObj->GetNumberField("Balance"));
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.VirtualCurrency = !(dataObj.HasField("VirtualCurrency")) ? TEXT("") : dataObj.GetStringField("VirtualCurrency");
+    tempStruct.BalanceChange = !(dataObj.HasField("BalanceChange")) ? 0 : int(dataObj.GetNumberField("BalanceChange"));
+    tempStruct.Balance = !(dataObj.HasField("Balance")) ? 0 : int(dataObj.GetNumberField("Balance"));
 
     return tempStruct;
 }
 
+FServerModifyUserVirtualCurrencyResult UPlayFabServerModelDecoder::readModifyUserVirtualCurrencyResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeModifyUserVirtualCurrencyResultResponse(Reader.GetFallbackTree(TEXT("ModifyUserVirtualCurrencyResult"), response));
+    }
+
+    FServerModifyUserVirtualCurrencyResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadString(tempStruct.VirtualCurrency);
+            break;
+        case FPlayFabJsonReader::Hash("BalanceChange"):
+            Reader.ReadInt(tempStruct.BalanceChange);
+            break;
+        case FPlayFabJsonReader::Hash("Balance"):
+            Reader.ReadInt(tempStruct.Balance);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeModifyUserVirtualCurrencyResultResponse(Reader.GetFallbackTree(TEXT("ModifyUserVirtualCurrencyResult"), response));
+    }
+    return tempStruct;
+}
+
 FServerConsumeItemResult UPlayFabServerModelDecoder::decodeConsumeItemResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerConsumeItemResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.ItemInstanceId = !(dataObj.HasField("ItemInstanceId")) ? TEXT("") : dataObj.GetStringField("ItemInstanceId");
+    tempStruct.RemainingUses = !(dataObj.HasField("RemainingUses")) ? 0 : int(dataObj.GetNumberField("RemainingUses"));
 
-    tempStruct.ItemInstanceId = !(dataObj->HasField("ItemInstanceId")) ? TEXT("") : dataObj->GetStringField("ItemInstanceId");
-    tempStruct.RemainingUses = !(dataObj->HasField("RemainingUses")) ? 0 : int(dataObj->GetNumberField("RemainingUses"));
+    return tempStruct;
+}
 
+FServerConsumeItemResult UPlayFabServerModelDecoder::readConsumeItemResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeConsumeItemResultResponse(Reader.GetFallbackTree(TEXT("ConsumeItemResult"), response));
+    }
+
+    FServerConsumeItemResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ItemInstanceId"):
+            Reader.ReadString(tempStruct.ItemInstanceId);
+            break;
+        case FPlayFabJsonReader::Hash("RemainingUses"):
+            Reader.ReadInt(tempStruct.RemainingUses);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeConsumeItemResultResponse(Reader.GetFallbackTree(TEXT("ConsumeItemResult"), response));
+    }
     return tempStruct;
 }
 
@@ -395,95 +1352,401 @@ FServerEvaluateRandomResultTableResult UPlayFabServerModelDecoder::decodeEvaluat
 {
     // Temp ustruct
     FServerEvaluateRandomResultTableResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.ResultItemId = !(dataObj->HasField("ResultItemId")) ? TEXT("") : dataObj->GetStringField("ResultItemId");
+    tempStruct.ResultItemId = !(dataObj.HasField("ResultItemId")) ? TEXT("") : dataObj.GetStringField("ResultItemId");
 
     return tempStruct;
 }
 
+FServerEvaluateRandomResultTableResult UPlayFabServerModelDecoder::readEvaluateRandomResultTableResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeEvaluateRandomResultTableResultResponse(Reader.GetFallbackTree(TEXT("EvaluateRandomResultTableResult"), response));
+    }
+
+    FServerEvaluateRandomResultTableResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ResultItemId"):
+            Reader.ReadString(tempStruct.ResultItemId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeEvaluateRandomResultTableResultResponse(Reader.GetFallbackTree(TEXT("EvaluateRandomResultTableResult"), response));
+    }
+    return tempStruct;
+}
+
 FServerGetCharacterInventoryResult UPlayFabServerModelDecoder::decodeGetCharacterInventoryResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetCharacterInventoryResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
-    tempStruct.Inventory = !(dataObj->HasField("Inventory")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Inventory");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.VirtualCurrencyRechargeTimes = !(dataObj->HasField("VirtualCurrencyRechargeTimes")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyRechargeTimes");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.CharacterId = !(dataObj.HasField("CharacterId")) ? TEXT("") : dataObj.GetStringField("CharacterId");
+    tempStruct.InventoryView = !(dataObj.HasField("Inventory")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Inventory");
+    tempStruct.VirtualCurrencyView = !(dataObj.HasField("VirtualCurrency")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrency");
+    tempStruct.VirtualCurrencyRechargeTimesView = !(dataObj.HasField("VirtualCurrencyRechargeTimes")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrencyRechargeTimes");
 
     return tempStruct;
 }
 
+FServerGetCharacterInventoryResult UPlayFabServerModelDecoder::readGetCharacterInventoryResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCharacterInventoryResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterInventoryResult"), response));
+    }
+
+    FServerGetCharacterInventoryResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("CharacterId"):
+            Reader.ReadString(tempStruct.CharacterId);
+            break;
+        case FPlayFabJsonReader::Hash("Inventory"):
+            Reader.ReadObjectArray(tempStruct.InventoryView, TEXT("Inventory"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyView, TEXT("VirtualCurrency"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrencyRechargeTimes"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyRechargeTimesView, TEXT("VirtualCurrencyRechargeTimes"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetCharacterInventoryResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterInventoryResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetCharacterInventoryResultJsonObjects(FServerGetCharacterInventoryResult& result)
+{
+    result.Inventory = FPlayFabJsonView::WrapJsonObjects(result.InventoryView);
+    result.VirtualCurrency = result.VirtualCurrencyView.WrapJsonObject();
+    result.VirtualCurrencyRechargeTimes = result.VirtualCurrencyRechargeTimesView.WrapJsonObject();
+}
+
 FServerGetRandomResultTablesResult UPlayFabServerModelDecoder::decodeGetRandomResultTablesResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetRandomResultTablesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.TablesView = !(dataObj.HasField("Tables")) ? FPlayFabJsonView() : dataObj.GetObjectField("Tables");
+
+    return tempStruct;
+}
 
-    tempStruct.Tables = !(dataObj->HasField("Tables")) ? nullptr : dataObj->GetObjectField("Tables");
+FServerGetRandomResultTablesResult UPlayFabServerModelDecoder::readGetRandomResultTablesResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetRandomResultTablesResultResponse(Reader.GetFallbackTree(TEXT("GetRandomResultTablesResult"), response));
+    }
 
+    FServerGetRandomResultTablesResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Tables"):
+            Reader.ReadObject(tempStruct.TablesView, TEXT("Tables"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetRandomResultTablesResultResponse(Reader.GetFallbackTree(TEXT("GetRandomResultTablesResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetRandomResultTablesResultJsonObjects(FServerGetRandomResultTablesResult& result)
+{
+    result.Tables = result.TablesView.WrapJsonObject();
+}
+
 FServerGetUserInventoryResult UPlayFabServerModelDecoder::decodeGetUserInventoryResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetUserInventoryResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.Inventory = !(dataObj->HasField("Inventory")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Inventory");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
-    tempStruct.VirtualCurrencyRechargeTimes = !(dataObj->HasField("VirtualCurrencyRechargeTimes")) ? nullptr : dataObj->GetObjectField("VirtualCurrencyRechargeTimes");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.InventoryView = !(dataObj.HasField("Inventory")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Inventory");
+    tempStruct.VirtualCurrencyView = !(dataObj.HasField("VirtualCurrency")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrency");
+    tempStruct.VirtualCurrencyRechargeTimesView = !(dataObj.HasField("VirtualCurrencyRechargeTimes")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrencyRechargeTimes");
 
     return tempStruct;
 }
 
+FServerGetUserInventoryResult UPlayFabServerModelDecoder::readGetUserInventoryResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetUserInventoryResultResponse(Reader.GetFallbackTree(TEXT("GetUserInventoryResult"), response));
+    }
+
+    FServerGetUserInventoryResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("Inventory"):
+            Reader.ReadObjectArray(tempStruct.InventoryView, TEXT("Inventory"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyView, TEXT("VirtualCurrency"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrencyRechargeTimes"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyRechargeTimesView, TEXT("VirtualCurrencyRechargeTimes"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetUserInventoryResultResponse(Reader.GetFallbackTree(TEXT("GetUserInventoryResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetUserInventoryResultJsonObjects(FServerGetUserInventoryResult& result)
+{
+    result.Inventory = FPlayFabJsonView::WrapJsonObjects(result.InventoryView);
+    result.VirtualCurrency = result.VirtualCurrencyView.WrapJsonObject();
+    result.VirtualCurrencyRechargeTimes = result.VirtualCurrencyRechargeTimesView.WrapJsonObject();
+}
+
 FServerGrantItemsToCharacterResult UPlayFabServerModelDecoder::decodeGrantItemsToCharacterResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGrantItemsToCharacterResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.ItemGrantResults = !(dataObj->HasField("ItemGrantResults")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ItemGrantResults");
+    tempStruct.ItemGrantResultsView = !(dataObj.HasField("ItemGrantResults")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("ItemGrantResults");
 
     return tempStruct;
 }
 
+FServerGrantItemsToCharacterResult UPlayFabServerModelDecoder::readGrantItemsToCharacterResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGrantItemsToCharacterResultResponse(Reader.GetFallbackTree(TEXT("GrantItemsToCharacterResult"), response));
+    }
+
+    FServerGrantItemsToCharacterResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ItemGrantResults"):
+            Reader.ReadObjectArray(tempStruct.ItemGrantResultsView, TEXT("ItemGrantResults"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGrantItemsToCharacterResultResponse(Reader.GetFallbackTree(TEXT("GrantItemsToCharacterResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGrantItemsToCharacterResultJsonObjects(FServerGrantItemsToCharacterResult& result)
+{
+    result.ItemGrantResults = FPlayFabJsonView::WrapJsonObjects(result.ItemGrantResultsView);
+}
+
 FServerGrantItemsToUserResult UPlayFabServerModelDecoder::decodeGrantItemsToUserResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGrantItemsToUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.ItemGrantResultsView = !(dataObj.HasField("ItemGrantResults")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("ItemGrantResults");
+
+    return tempStruct;
+}
+
+FServerGrantItemsToUserResult UPlayFabServerModelDecoder::readGrantItemsToUserResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGrantItemsToUserResultResponse(Reader.GetFallbackTree(TEXT("GrantItemsToUserResult"), response));
+    }
+
+    FServerGrantItemsToUserResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ItemGrantResults"):
+            Reader.ReadObjectArray(tempStruct.ItemGrantResultsView, TEXT("ItemGrantResults"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGrantItemsToUserResultResponse(Reader.GetFallbackTree(TEXT("GrantItemsToUserResult"), response));
+    }
+    return tempStruct;
+}
 
-    tempStruct.ItemGrantResults = !(dataObj->HasField("ItemGrantResults")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ItemGrantResults");
+void UPlayFabServerModelDecoder::fillGrantItemsToUserResultJsonObjects(FServerGrantItemsToUserResult& result)
+{
+    result.ItemGrantResults = FPlayFabJsonView::WrapJsonObjects(result.ItemGrantResultsView);
+}
+
+FServerGrantItemsToUsersResult UPlayFabServerModelDecoder::decodeGrantItemsToUsersResultResponse(UPlayFabJsonObject* response)
+{
+    // Temp ustruct
+    FServerGrantItemsToUsersResult tempStruct;
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.ItemGrantResultsView = !(dataObj.HasField("ItemGrantResults")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("ItemGrantResults");
+
+    return tempStruct;
+}
+
+FServerGrantItemsToUsersResult UPlayFabServerModelDecoder::readGrantItemsToUsersResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGrantItemsToUsersResultResponse(Reader.GetFallbackTree(TEXT("GrantItemsToUsersResult"), response));
+    }
+
+    FServerGrantItemsToUsersResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ItemGrantResults"):
+            Reader.ReadObjectArray(tempStruct.ItemGrantResultsView, TEXT("ItemGrantResults"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGrantItemsToUsersResultResponse(Reader.GetFallbackTree(TEXT("GrantItemsToUsersResult"), response));
+    }
+    return tempStruct;
+}
 
-    return tempStruct;
+void UPlayFabServerModelDecoder::fillGrantItemsToUsersResultJsonObjects(FServerGrantItemsToUsersResult& result)
+{
+    result.ItemGrantResults = FPlayFabJsonView::WrapJsonObjects(result.ItemGrantResultsView);
 }
 
-FServerGrantItemsToUsersResult UPlayFabServerModelDecoder::decodeGrantItemsToUsersResultResponse(UPlayFabJsonObject* response)
+FServerModifyItemUsesResult UPlayFabServerModelDecoder::decodeModifyItemUsesResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
-    FServerGrantItemsToUsersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    FServerModifyItemUsesResult tempStruct;
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.ItemGrantResults = !(dataObj->HasField("ItemGrantResults")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ItemGrantResults");
+    tempStruct.ItemInstanceId = !(dataObj.HasField("ItemInstanceId")) ? TEXT("") : dataObj.GetStringField("ItemInstanceId");
+    tempStruct.RemainingUses = !(dataObj.HasField("RemainingUses")) ? 0 : int(dataObj.GetNumberField("RemainingUses"));
 
     return tempStruct;
 }
 
-FServerModifyItemUsesResult UPlayFabServerModelDecoder::decodeModifyItemUsesResultResponse(UPlayFabJsonObject* response)
+FServerModifyItemUsesResult UPlayFabServerModelDecoder::readModifyItemUsesResultResponse(const FPlayFabBaseModel& response)
 {
-    // Temp ustruct
-    FServerModifyItemUsesResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
-
-    tempStruct.ItemInstanceId = !(dataObj->HasField("ItemInstanceId")) ? TEXT("") : dataObj->GetStringField("ItemInstanceId");
-    tempStruct.RemainingUses = !(dataObj->HasField("RemainingUses")) ? 0 : int(dataObj->GetNumberField("RemainingUses"));
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeModifyItemUsesResultResponse(Reader.GetFallbackTree(TEXT("ModifyItemUsesResult"), response));
+    }
 
+    FServerModifyItemUsesResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ItemInstanceId"):
+            Reader.ReadString(tempStruct.ItemInstanceId);
+            break;
+        case FPlayFabJsonReader::Hash("RemainingUses"):
+            Reader.ReadInt(tempStruct.RemainingUses);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeModifyItemUsesResultResponse(Reader.GetFallbackTree(TEXT("ModifyItemUsesResult"), response));
+    }
     return tempStruct;
 }
 
@@ -496,6 +1759,12 @@ FServerMoveItemToCharacterFromCharacterResult UPlayFabServerModelDecoder::decode
     return tempStruct;
 }
 
+FServerMoveItemToCharacterFromCharacterResult UPlayFabServerModelDecoder::readMoveItemToCharacterFromCharacterResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerMoveItemToCharacterFromCharacterResult();
+}
+
 FServerMoveItemToCharacterFromUserResult UPlayFabServerModelDecoder::decodeMoveItemToCharacterFromUserResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -505,6 +1774,12 @@ FServerMoveItemToCharacterFromUserResult UPlayFabServerModelDecoder::decodeMoveI
     return tempStruct;
 }
 
+FServerMoveItemToCharacterFromUserResult UPlayFabServerModelDecoder::readMoveItemToCharacterFromUserResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerMoveItemToCharacterFromUserResult();
+}
+
 FServerMoveItemToUserFromCharacterResult UPlayFabServerModelDecoder::decodeMoveItemToUserFromCharacterResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -514,26 +1789,102 @@ FServerMoveItemToUserFromCharacterResult UPlayFabServerModelDecoder::decodeMoveI
     return tempStruct;
 }
 
+FServerMoveItemToUserFromCharacterResult UPlayFabServerModelDecoder::readMoveItemToUserFromCharacterResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerMoveItemToUserFromCharacterResult();
+}
+
 FServerRedeemCouponResult UPlayFabServerModelDecoder::decodeRedeemCouponResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerRedeemCouponResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.GrantedItemsView = !(dataObj.HasField("GrantedItems")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("GrantedItems");
+
+    return tempStruct;
+}
 
-    tempStruct.GrantedItems = !(dataObj->HasField("GrantedItems")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GrantedItems");
+FServerRedeemCouponResult UPlayFabServerModelDecoder::readRedeemCouponResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeRedeemCouponResultResponse(Reader.GetFallbackTree(TEXT("RedeemCouponResult"), response));
+    }
+
+    FServerRedeemCouponResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("GrantedItems"):
+            Reader.ReadObjectArray(tempStruct.GrantedItemsView, TEXT("GrantedItems"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeRedeemCouponResultResponse(Reader.GetFallbackTree(TEXT("RedeemCouponResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillRedeemCouponResultJsonObjects(FServerRedeemCouponResult& result)
+{
+    result.GrantedItems = FPlayFabJsonView::WrapJsonObjects(result.GrantedItemsView);
+}
+
 FServerReportPlayerServerResult UPlayFabServerModelDecoder::decodeReportPlayerServerResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerReportPlayerServerResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.Updated = !(dataObj.HasField("Updated")) ? false : dataObj.GetBoolField("Updated");
+    tempStruct.SubmissionsRemaining = !(dataObj.HasField("SubmissionsRemaining")) ? 0 : int(dataObj.GetNumberField("SubmissionsRemaining"));
+
+    return tempStruct;
+}
 
-    tempStruct.Updated = !(dataObj->HasField("Updated")) ? false : dataObj->GetBoolField("Updated");
-    tempStruct.SubmissionsRemaining = !(dataObj->HasField("SubmissionsRemaining")) ? 0 : int(dataObj->GetNumberField("SubmissionsRemaining"));
+FServerReportPlayerServerResult UPlayFabServerModelDecoder::readReportPlayerServerResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeReportPlayerServerResultResponse(Reader.GetFallbackTree(TEXT("ReportPlayerServerResult"), response));
+    }
 
+    FServerReportPlayerServerResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Updated"):
+            Reader.ReadBool(tempStruct.Updated);
+            break;
+        case FPlayFabJsonReader::Hash("SubmissionsRemaining"):
+            Reader.ReadInt(tempStruct.SubmissionsRemaining);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeReportPlayerServerResultResponse(Reader.GetFallbackTree(TEXT("ReportPlayerServerResult"), response));
+    }
     return tempStruct;
 }
 
@@ -546,20 +1897,72 @@ FServerRevokeInventoryResult UPlayFabServerModelDecoder::decodeRevokeInventoryRe
     return tempStruct;
 }
 
+FServerRevokeInventoryResult UPlayFabServerModelDecoder::readRevokeInventoryResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerRevokeInventoryResult();
+}
+
 FServerUnlockContainerItemResult UPlayFabServerModelDecoder::decodeUnlockContainerItemResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerUnlockContainerItemResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.UnlockedItemInstanceId = !(dataObj.HasField("UnlockedItemInstanceId")) ? TEXT("") : dataObj.GetStringField("UnlockedItemInstanceId");
+    tempStruct.UnlockedWithItemInstanceId = !(dataObj.HasField("UnlockedWithItemInstanceId")) ? TEXT("") : dataObj.GetStringField("UnlockedWithItemInstanceId");
+    tempStruct.GrantedItemsView = !(dataObj.HasField("GrantedItems")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("GrantedItems");
+    tempStruct.VirtualCurrencyView = !(dataObj.HasField("VirtualCurrency")) ? FPlayFabJsonView() : dataObj.GetObjectField("VirtualCurrency");
 
-    tempStruct.UnlockedItemInstanceId = !(dataObj->HasField("UnlockedItemInstanceId")) ? TEXT("") : dataObj->GetStringField("UnlockedItemInstanceId");
-    tempStruct.UnlockedWithItemInstanceId = !(dataObj->HasField("UnlockedWithItemInstanceId")) ? TEXT("") : dataObj->GetStringField("UnlockedWithItemInstanceId");
-    tempStruct.GrantedItems = !(dataObj->HasField("GrantedItems")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("GrantedItems");
-    tempStruct.VirtualCurrency = !(dataObj->HasField("VirtualCurrency")) ? nullptr : dataObj->GetObjectField("VirtualCurrency");
+    return tempStruct;
+}
+
+FServerUnlockContainerItemResult UPlayFabServerModelDecoder::readUnlockContainerItemResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUnlockContainerItemResultResponse(Reader.GetFallbackTree(TEXT("UnlockContainerItemResult"), response));
+    }
 
+    FServerUnlockContainerItemResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("UnlockedItemInstanceId"):
+            Reader.ReadString(tempStruct.UnlockedItemInstanceId);
+            break;
+        case FPlayFabJsonReader::Hash("UnlockedWithItemInstanceId"):
+            Reader.ReadString(tempStruct.UnlockedWithItemInstanceId);
+            break;
+        case FPlayFabJsonReader::Hash("GrantedItems"):
+            Reader.ReadObjectArray(tempStruct.GrantedItemsView, TEXT("GrantedItems"));
+            break;
+        case FPlayFabJsonReader::Hash("VirtualCurrency"):
+            Reader.ReadObject(tempStruct.VirtualCurrencyView, TEXT("VirtualCurrency"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeUnlockContainerItemResultResponse(Reader.GetFallbackTree(TEXT("UnlockContainerItemResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillUnlockContainerItemResultJsonObjects(FServerUnlockContainerItemResult& result)
+{
+    result.GrantedItems = FPlayFabJsonView::WrapJsonObjects(result.GrantedItemsView);
+    result.VirtualCurrency = result.VirtualCurrencyView.WrapJsonObject();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -570,13 +1973,49 @@ FServerGetFriendsListResult UPlayFabServerModelDecoder::decodeGetFriendsListResu
 {
     // Temp ustruct
     FServerGetFriendsListResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.FriendsView = !(dataObj.HasField("Friends")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Friends");
+
+    return tempStruct;
+}
+
+FServerGetFriendsListResult UPlayFabServerModelDecoder::readGetFriendsListResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetFriendsListResultResponse(Reader.GetFallbackTree(TEXT("GetFriendsListResult"), response));
+    }
 
-    tempStruct.Friends = !(dataObj->HasField("Friends")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Friends");
+    FServerGetFriendsListResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Friends"):
+            Reader.ReadObjectArray(tempStruct.FriendsView, TEXT("Friends"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetFriendsListResultResponse(Reader.GetFallbackTree(TEXT("GetFriendsListResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetFriendsListResultJsonObjects(FServerGetFriendsListResult& result)
+{
+    result.Friends = FPlayFabJsonView::WrapJsonObjects(result.FriendsView);
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -592,14 +2031,51 @@ FServerDeregisterGameResponse UPlayFabServerModelDecoder::decodeDeregisterGameRe
     return tempStruct;
 }
 
+FServerDeregisterGameResponse UPlayFabServerModelDecoder::readDeregisterGameResponseResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerDeregisterGameResponse();
+}
+
 FServerNotifyMatchmakerPlayerLeftResult UPlayFabServerModelDecoder::decodeNotifyMatchmakerPlayerLeftResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerNotifyMatchmakerPlayerLeftResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    GetEnumValueFromString<EPlayerConnectionState>(TEXT("EPlayerConnectionState"), dataObj.GetStringField("PlayerState"), tempStruct.PlayerState);
+
+    return tempStruct;
+}
 
-    GetEnumValueFromString<EPlayerConnectionState>(TEXT("EPlayerConnectionState"), dataObj->GetStringField("PlayerState"), tempStruct.PlayerState);
+FServerNotifyMatchmakerPlayerLeftResult UPlayFabServerModelDecoder::readNotifyMatchmakerPlayerLeftResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeNotifyMatchmakerPlayerLeftResultResponse(Reader.GetFallbackTree(TEXT("NotifyMatchmakerPlayerLeftResult"), response));
+    }
 
+    FServerNotifyMatchmakerPlayerLeftResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayerState"):
+            Reader.ReadEnum(tempStruct.PlayerState);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeNotifyMatchmakerPlayerLeftResultResponse(Reader.GetFallbackTree(TEXT("NotifyMatchmakerPlayerLeftResult"), response));
+    }
     return tempStruct;
 }
 
@@ -607,15 +2083,57 @@ FServerRedeemMatchmakerTicketResult UPlayFabServerModelDecoder::decodeRedeemMatc
 {
     // Temp ustruct
     FServerRedeemMatchmakerTicketResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.TicketIsValid = !(dataObj->HasField("TicketIsValid")) ? false : dataObj->GetBoolField("TicketIsValid");
-    tempStruct.Error = !(dataObj->HasField("Error")) ? TEXT("") : dataObj->GetStringField("Error");
-    tempStruct.UserInfo = !(dataObj->HasField("UserInfo")) ? nullptr : dataObj->GetObjectField("UserInfo");
+    tempStruct.TicketIsValid = !(dataObj.HasField("TicketIsValid")) ? false : dataObj.GetBoolField("TicketIsValid");
+    tempStruct.Error = !(dataObj.HasField("Error")) ? TEXT("") : dataObj.GetStringField("Error");
+    tempStruct.UserInfoView = !(dataObj.HasField("UserInfo")) ? FPlayFabJsonView() : dataObj.GetObjectField("UserInfo");
 
     return tempStruct;
 }
 
+FServerRedeemMatchmakerTicketResult UPlayFabServerModelDecoder::readRedeemMatchmakerTicketResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeRedeemMatchmakerTicketResultResponse(Reader.GetFallbackTree(TEXT("RedeemMatchmakerTicketResult"), response));
+    }
+
+    FServerRedeemMatchmakerTicketResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("TicketIsValid"):
+            Reader.ReadBool(tempStruct.TicketIsValid);
+            break;
+        case FPlayFabJsonReader::Hash("Error"):
+            Reader.ReadString(tempStruct.Error);
+            break;
+        case FPlayFabJsonReader::Hash("UserInfo"):
+            Reader.ReadObject(tempStruct.UserInfoView, TEXT("UserInfo"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeRedeemMatchmakerTicketResultResponse(Reader.GetFallbackTree(TEXT("RedeemMatchmakerTicketResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillRedeemMatchmakerTicketResultJsonObjects(FServerRedeemMatchmakerTicketResult& result)
+{
+    result.UserInfo = result.UserInfoView.WrapJsonObject();
+}
+
 FServerRefreshGameServerInstanceHeartbeatResult UPlayFabServerModelDecoder::decodeRefreshGameServerInstanceHeartbeatResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -625,14 +2143,51 @@ FServerRefreshGameServerInstanceHeartbeatResult UPlayFabServerModelDecoder::deco
     return tempStruct;
 }
 
+FServerRefreshGameServerInstanceHeartbeatResult UPlayFabServerModelDecoder::readRefreshGameServerInstanceHeartbeatResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerRefreshGameServerInstanceHeartbeatResult();
+}
+
 FServerRegisterGameResponse UPlayFabServerModelDecoder::decodeRegisterGameResponseResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerRegisterGameResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.LobbyId = !(dataObj.HasField("LobbyId")) ? TEXT("") : dataObj.GetStringField("LobbyId");
+
+    return tempStruct;
+}
 
-    tempStruct.LobbyId = !(dataObj->HasField("LobbyId")) ? TEXT("") : dataObj->GetStringField("LobbyId");
+FServerRegisterGameResponse UPlayFabServerModelDecoder::readRegisterGameResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeRegisterGameResponseResponse(Reader.GetFallbackTree(TEXT("RegisterGameResponse"), response));
+    }
 
+    FServerRegisterGameResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("LobbyId"):
+            Reader.ReadString(tempStruct.LobbyId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeRegisterGameResponseResponse(Reader.GetFallbackTree(TEXT("RegisterGameResponse"), response));
+    }
     return tempStruct;
 }
 
@@ -645,6 +2200,12 @@ FServerSetGameServerInstanceDataResult UPlayFabServerModelDecoder::decodeSetGame
     return tempStruct;
 }
 
+FServerSetGameServerInstanceDataResult UPlayFabServerModelDecoder::readSetGameServerInstanceDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerSetGameServerInstanceDataResult();
+}
+
 FServerSetGameServerInstanceStateResult UPlayFabServerModelDecoder::decodeSetGameServerInstanceStateResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -654,6 +2215,12 @@ FServerSetGameServerInstanceStateResult UPlayFabServerModelDecoder::decodeSetGam
     return tempStruct;
 }
 
+FServerSetGameServerInstanceStateResult UPlayFabServerModelDecoder::readSetGameServerInstanceStateResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerSetGameServerInstanceStateResult();
+}
+
 FServerSetGameServerInstanceTagsResult UPlayFabServerModelDecoder::decodeSetGameServerInstanceTagsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -663,6 +2230,12 @@ FServerSetGameServerInstanceTagsResult UPlayFabServerModelDecoder::decodeSetGame
     return tempStruct;
 }
 
+FServerSetGameServerInstanceTagsResult UPlayFabServerModelDecoder::readSetGameServerInstanceTagsResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerSetGameServerInstanceTagsResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -673,10 +2246,41 @@ FServerWriteEventResponse UPlayFabServerModelDecoder::decodeWriteEventResponseRe
 {
     // Temp ustruct
     FServerWriteEventResponse tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.EventId = !(dataObj.HasField("EventId")) ? TEXT("") : dataObj.GetStringField("EventId");
+
+    return tempStruct;
+}
+
+FServerWriteEventResponse UPlayFabServerModelDecoder::readWriteEventResponseResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeWriteEventResponseResponse(Reader.GetFallbackTree(TEXT("WriteEventResponse"), response));
+    }
 
-    tempStruct.EventId = !(dataObj->HasField("EventId")) ? TEXT("") : dataObj->GetStringField("EventId");
+    FServerWriteEventResponse tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("EventId"):
+            Reader.ReadString(tempStruct.EventId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeWriteEventResponseResponse(Reader.GetFallbackTree(TEXT("WriteEventResponse"), response));
+    }
     return tempStruct;
 }
 
@@ -695,14 +2299,51 @@ FServerAddSharedGroupMembersResult UPlayFabServerModelDecoder::decodeAddSharedGr
     return tempStruct;
 }
 
+FServerAddSharedGroupMembersResult UPlayFabServerModelDecoder::readAddSharedGroupMembersResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerAddSharedGroupMembersResult();
+}
+
 FServerCreateSharedGroupResult UPlayFabServerModelDecoder::decodeCreateSharedGroupResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerCreateSharedGroupResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.SharedGroupId = !(dataObj.HasField("SharedGroupId")) ? TEXT("") : dataObj.GetStringField("SharedGroupId");
+
+    return tempStruct;
+}
 
-    tempStruct.SharedGroupId = !(dataObj->HasField("SharedGroupId")) ? TEXT("") : dataObj->GetStringField("SharedGroupId");
+FServerCreateSharedGroupResult UPlayFabServerModelDecoder::readCreateSharedGroupResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeCreateSharedGroupResultResponse(Reader.GetFallbackTree(TEXT("CreateSharedGroupResult"), response));
+    }
 
+    FServerCreateSharedGroupResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("SharedGroupId"):
+            Reader.ReadString(tempStruct.SharedGroupId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeCreateSharedGroupResultResponse(Reader.GetFallbackTree(TEXT("CreateSharedGroupResult"), response));
+    }
     return tempStruct;
 }
 
@@ -710,14 +2351,53 @@ FServerGetSharedGroupDataResult UPlayFabServerModelDecoder::decodeGetSharedGroup
 {
     // Temp ustruct
     FServerGetSharedGroupDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
+    tempStruct.Members = !(dataObj.HasField("Members")) ? TEXT("") : FString::Join(dataObj.GetStringArrayField("Members"), TEXT(","));
+
+    return tempStruct;
+}
+
+FServerGetSharedGroupDataResult UPlayFabServerModelDecoder::readGetSharedGroupDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetSharedGroupDataResultResponse(Reader.GetFallbackTree(TEXT("GetSharedGroupDataResult"), response));
+    }
 
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
-    tempStruct.Members = !(dataObj->HasField("Members")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Members"), TEXT(","));
+    FServerGetSharedGroupDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        case FPlayFabJsonReader::Hash("Members"):
+            Reader.ReadStringList(tempStruct.Members);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetSharedGroupDataResultResponse(Reader.GetFallbackTree(TEXT("GetSharedGroupDataResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetSharedGroupDataResultJsonObjects(FServerGetSharedGroupDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
+}
+
 FServerRemoveSharedGroupMembersResult UPlayFabServerModelDecoder::decodeRemoveSharedGroupMembersResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -727,6 +2407,12 @@ FServerRemoveSharedGroupMembersResult UPlayFabServerModelDecoder::decodeRemoveSh
     return tempStruct;
 }
 
+FServerRemoveSharedGroupMembersResult UPlayFabServerModelDecoder::readRemoveSharedGroupMembersResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerRemoveSharedGroupMembersResult();
+}
+
 FServerUpdateSharedGroupDataResult UPlayFabServerModelDecoder::decodeUpdateSharedGroupDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
@@ -736,6 +2422,12 @@ FServerUpdateSharedGroupDataResult UPlayFabServerModelDecoder::decodeUpdateShare
     return tempStruct;
 }
 
+FServerUpdateSharedGroupDataResult UPlayFabServerModelDecoder::readUpdateSharedGroupDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerUpdateSharedGroupDataResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -746,24 +2438,95 @@ FServerExecuteCloudScriptResult UPlayFabServerModelDecoder::decodeExecuteCloudSc
 {
     // Temp ustruct
     FServerExecuteCloudScriptResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.FunctionName = !(dataObj->HasField("FunctionName")) ? TEXT("") : dataObj->GetStringField("FunctionName");
-    tempStruct.Revision = !(dataObj->HasField("Revision")) ? 0 : int(dataObj->GetNumberField("Revision"));
-    tempStruct.FunctionResult = !(dataObj->HasField("FunctionResult")) ? nullptr : dataObj->GetObjectField("FunctionResult");
-    tempStruct.FunctionResultTooLarge = !(dataObj->HasField("FunctionResultTooLarge")) ? false : dataObj->GetBoolField("FunctionResultTooLarge");
-    tempStruct.Logs = !(dataObj->HasField("Logs")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Logs");
-    tempStruct.LogsTooLarge = !(dataObj->HasField("LogsTooLarge")) ? false : dataObj->GetBoolField("LogsTooLarge");
-    tempStruct.ExecutionTimeSeconds = !(dataObj->HasField("ExecutionTimeSeconds")) ? 0 : int(dataObj->GetNumberField("ExecutionTimeSeconds"));
-    tempStruct.ProcessorTimeSeconds = !(dataObj->HasField("ProcessorTimeSeconds")) ? 0 : int(dataObj->GetNumberField("ProcessorTimeSeconds"));
-    tempStruct.MemoryConsumedBytes = !(dataObj->HasField("MemoryConsumedBytes")) ? 0 : int(dataObj->GetNumberField("MemoryConsumedBytes"));
-    tempStruct.APIRequestsIssued = !(dataObj->HasField("APIRequestsIssued")) ? 0 : int(dataObj->GetNumberField("APIRequestsIssued"));
-    tempStruct.HttpRequestsIssued = !(dataObj->HasField("HttpRequestsIssued")) ? 0 : int(dataObj->GetNumberField("HttpRequestsIssued"));
-    tempStruct.Error = !(dataObj->HasField("Error")) ? nullptr : dataObj->GetObjectField("Error");
+    tempStruct.FunctionName = !(dataObj.HasField("FunctionName")) ? TEXT("") : dataObj.GetStringField("FunctionName");
+    tempStruct.Revision = !(dataObj.HasField("Revision")) ? 0 : int(dataObj.GetNumberField("Revision"));
+    tempStruct.FunctionResultView = !(dataObj.HasField("FunctionResult")) ? FPlayFabJsonView() : dataObj.GetObjectField("FunctionResult");
+    tempStruct.FunctionResultTooLarge = !(dataObj.HasField("FunctionResultTooLarge")) ? false : dataObj.GetBoolField("FunctionResultTooLarge");
+    tempStruct.LogsView = !(dataObj.HasField("Logs")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Logs");
+    tempStruct.LogsTooLarge = !(dataObj.HasField("LogsTooLarge")) ? false : dataObj.GetBoolField("LogsTooLarge");
+    tempStruct.ExecutionTimeSeconds = !(dataObj.HasField("ExecutionTimeSeconds")) ? 0 : int(dataObj.GetNumberField("ExecutionTimeSeconds"));
+    tempStruct.ProcessorTimeSeconds = !(dataObj.HasField("ProcessorTimeSeconds")) ? 0 : int(dataObj.GetNumberField("ProcessorTimeSeconds"));
+    tempStruct.MemoryConsumedBytes = !(dataObj.HasField("MemoryConsumedBytes")) ? 0 : int(dataObj.GetNumberField("MemoryConsumedBytes"));
+    tempStruct.APIRequestsIssued = !(dataObj.HasField("APIRequestsIssued")) ? 0 : int(dataObj.GetNumberField("APIRequestsIssued"));
+    tempStruct.HttpRequestsIssued = !(dataObj.HasField("HttpRequestsIssued")) ? 0 : int(dataObj.GetNumberField("HttpRequestsIssued"));
+    tempStruct.ErrorView = !(dataObj.HasField("Error")) ? FPlayFabJsonView() : dataObj.GetObjectField("Error");
 
     return tempStruct;
 }
 
+FServerExecuteCloudScriptResult UPlayFabServerModelDecoder::readExecuteCloudScriptResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeExecuteCloudScriptResultResponse(Reader.GetFallbackTree(TEXT("ExecuteCloudScriptResult"), response));
+    }
+
+    FServerExecuteCloudScriptResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("FunctionName"):
+            Reader.ReadString(tempStruct.FunctionName);
+            break;
+        case FPlayFabJsonReader::Hash("Revision"):
+            Reader.ReadInt(tempStruct.Revision);
+            break;
+        case FPlayFabJsonReader::Hash("FunctionResult"):
+            Reader.ReadObject(tempStruct.FunctionResultView, TEXT("FunctionResult"));
+            break;
+        case FPlayFabJsonReader::Hash("FunctionResultTooLarge"):
+            Reader.ReadBool(tempStruct.FunctionResultTooLarge);
+            break;
+        case FPlayFabJsonReader::Hash("Logs"):
+            Reader.ReadObjectArray(tempStruct.LogsView, TEXT("Logs"));
+            break;
+        case FPlayFabJsonReader::Hash("LogsTooLarge"):
+            Reader.ReadBool(tempStruct.LogsTooLarge);
+            break;
+        case FPlayFabJsonReader::Hash("ExecutionTimeSeconds"):
+            Reader.ReadInt(tempStruct.ExecutionTimeSeconds);
+            break;
+        case FPlayFabJsonReader::Hash("ProcessorTimeSeconds"):
+            Reader.ReadInt(tempStruct.ProcessorTimeSeconds);
+            break;
+        case FPlayFabJsonReader::Hash("MemoryConsumedBytes"):
+            Reader.ReadInt(tempStruct.MemoryConsumedBytes);
+            break;
+        case FPlayFabJsonReader::Hash("APIRequestsIssued"):
+            Reader.ReadInt(tempStruct.APIRequestsIssued);
+            break;
+        case FPlayFabJsonReader::Hash("HttpRequestsIssued"):
+            Reader.ReadInt(tempStruct.HttpRequestsIssued);
+            break;
+        case FPlayFabJsonReader::Hash("Error"):
+            Reader.ReadObject(tempStruct.ErrorView, TEXT("Error"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeExecuteCloudScriptResultResponse(Reader.GetFallbackTree(TEXT("ExecuteCloudScriptResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillExecuteCloudScriptResultJsonObjects(FServerExecuteCloudScriptResult& result)
+{
+    result.FunctionResult = result.FunctionResultView.WrapJsonObject();
+    result.Logs = FPlayFabJsonView::WrapJsonObjects(result.LogsView);
+    result.Error = result.ErrorView.WrapJsonObject();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -774,13 +2537,44 @@ FServerGetContentDownloadUrlResult UPlayFabServerModelDecoder::decodeGetContentD
 {
     // Temp ustruct
     FServerGetContentDownloadUrlResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.URL = !(dataObj->HasField("URL")) ? TEXT("") : dataObj->GetStringField("URL");
+    tempStruct.URL = !(dataObj.HasField("URL")) ? TEXT("") : dataObj.GetStringField("URL");
 
     return tempStruct;
 }
 
+FServerGetContentDownloadUrlResult UPlayFabServerModelDecoder::readGetContentDownloadUrlResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetContentDownloadUrlResultResponse(Reader.GetFallbackTree(TEXT("GetContentDownloadUrlResult"), response));
+    }
+
+    FServerGetContentDownloadUrlResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("URL"):
+            Reader.ReadString(tempStruct.URL);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetContentDownloadUrlResultResponse(Reader.GetFallbackTree(TEXT("GetContentDownloadUrlResult"), response));
+    }
+    return tempStruct;
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -796,71 +2590,294 @@ FServerDeleteCharacterFromUserResult UPlayFabServerModelDecoder::decodeDeleteCha
     return tempStruct;
 }
 
+FServerDeleteCharacterFromUserResult UPlayFabServerModelDecoder::readDeleteCharacterFromUserResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerDeleteCharacterFromUserResult();
+}
+
 FServerListUsersCharactersResult UPlayFabServerModelDecoder::decodeListUsersCharactersResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerListUsersCharactersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.CharactersView = !(dataObj.HasField("Characters")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Characters");
+
+    return tempStruct;
+}
+
+FServerListUsersCharactersResult UPlayFabServerModelDecoder::readListUsersCharactersResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeListUsersCharactersResultResponse(Reader.GetFallbackTree(TEXT("ListUsersCharactersResult"), response));
+    }
 
-    tempStruct.Characters = !(dataObj->HasField("Characters")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Characters");
+    FServerListUsersCharactersResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Characters"):
+            Reader.ReadObjectArray(tempStruct.CharactersView, TEXT("Characters"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeListUsersCharactersResultResponse(Reader.GetFallbackTree(TEXT("ListUsersCharactersResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillListUsersCharactersResultJsonObjects(FServerListUsersCharactersResult& result)
+{
+    result.Characters = FPlayFabJsonView::WrapJsonObjects(result.CharactersView);
+}
+
 FServerGetCharacterLeaderboardResult UPlayFabServerModelDecoder::decodeGetCharacterLeaderboardResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetCharacterLeaderboardResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.LeaderboardView = !(dataObj.HasField("Leaderboard")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Leaderboard");
+
+    return tempStruct;
+}
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
+FServerGetCharacterLeaderboardResult UPlayFabServerModelDecoder::readGetCharacterLeaderboardResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCharacterLeaderboardResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterLeaderboardResult"), response));
+    }
+
+    FServerGetCharacterLeaderboardResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Leaderboard"):
+            Reader.ReadObjectArray(tempStruct.LeaderboardView, TEXT("Leaderboard"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetCharacterLeaderboardResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterLeaderboardResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetCharacterLeaderboardResultJsonObjects(FServerGetCharacterLeaderboardResult& result)
+{
+    result.Leaderboard = FPlayFabJsonView::WrapJsonObjects(result.LeaderboardView);
+}
+
 FServerGetCharacterStatisticsResult UPlayFabServerModelDecoder::decodeGetCharacterStatisticsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetCharacterStatisticsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
-    tempStruct.CharacterStatistics = !(dataObj->HasField("CharacterStatistics")) ? nullptr : dataObj->GetObjectField("CharacterStatistics");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.CharacterId = !(dataObj.HasField("CharacterId")) ? TEXT("") : dataObj.GetStringField("CharacterId");
+    tempStruct.CharacterStatisticsView = !(dataObj.HasField("CharacterStatistics")) ? FPlayFabJsonView() : dataObj.GetObjectField("CharacterStatistics");
 
     return tempStruct;
 }
 
+FServerGetCharacterStatisticsResult UPlayFabServerModelDecoder::readGetCharacterStatisticsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCharacterStatisticsResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterStatisticsResult"), response));
+    }
+
+    FServerGetCharacterStatisticsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("CharacterId"):
+            Reader.ReadString(tempStruct.CharacterId);
+            break;
+        case FPlayFabJsonReader::Hash("CharacterStatistics"):
+            Reader.ReadObject(tempStruct.CharacterStatisticsView, TEXT("CharacterStatistics"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetCharacterStatisticsResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterStatisticsResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetCharacterStatisticsResultJsonObjects(FServerGetCharacterStatisticsResult& result)
+{
+    result.CharacterStatistics = result.CharacterStatisticsView.WrapJsonObject();
+}
+
 FServerGetLeaderboardAroundCharacterResult UPlayFabServerModelDecoder::decodeGetLeaderboardAroundCharacterResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetLeaderboardAroundCharacterResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.LeaderboardView = !(dataObj.HasField("Leaderboard")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Leaderboard");
+
+    return tempStruct;
+}
+
+FServerGetLeaderboardAroundCharacterResult UPlayFabServerModelDecoder::readGetLeaderboardAroundCharacterResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetLeaderboardAroundCharacterResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardAroundCharacterResult"), response));
+    }
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
+    FServerGetLeaderboardAroundCharacterResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Leaderboard"):
+            Reader.ReadObjectArray(tempStruct.LeaderboardView, TEXT("Leaderboard"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetLeaderboardAroundCharacterResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardAroundCharacterResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetLeaderboardAroundCharacterResultJsonObjects(FServerGetLeaderboardAroundCharacterResult& result)
+{
+    result.Leaderboard = FPlayFabJsonView::WrapJsonObjects(result.LeaderboardView);
+}
+
 FServerGetLeaderboardForUsersCharactersResult UPlayFabServerModelDecoder::decodeGetLeaderboardForUsersCharactersResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetLeaderboardForUsersCharactersResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.LeaderboardView = !(dataObj.HasField("Leaderboard")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Leaderboard");
+
+    return tempStruct;
+}
+
+FServerGetLeaderboardForUsersCharactersResult UPlayFabServerModelDecoder::readGetLeaderboardForUsersCharactersResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetLeaderboardForUsersCharactersResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardForUsersCharactersResult"), response));
+    }
 
-    tempStruct.Leaderboard = !(dataObj->HasField("Leaderboard")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Leaderboard");
+    FServerGetLeaderboardForUsersCharactersResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Leaderboard"):
+            Reader.ReadObjectArray(tempStruct.LeaderboardView, TEXT("Leaderboard"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetLeaderboardForUsersCharactersResultResponse(Reader.GetFallbackTree(TEXT("GetLeaderboardForUsersCharactersResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetLeaderboardForUsersCharactersResultJsonObjects(FServerGetLeaderboardForUsersCharactersResult& result)
+{
+    result.Leaderboard = FPlayFabJsonView::WrapJsonObjects(result.LeaderboardView);
+}
+
 FServerGrantCharacterToUserResult UPlayFabServerModelDecoder::decodeGrantCharacterToUserResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGrantCharacterToUserResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.CharacterId = !(dataObj.HasField("CharacterId")) ? TEXT("") : dataObj.GetStringField("CharacterId");
 
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
+    return tempStruct;
+}
+
+FServerGrantCharacterToUserResult UPlayFabServerModelDecoder::readGrantCharacterToUserResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGrantCharacterToUserResultResponse(Reader.GetFallbackTree(TEXT("GrantCharacterToUserResult"), response));
+    }
 
+    FServerGrantCharacterToUserResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("CharacterId"):
+            Reader.ReadString(tempStruct.CharacterId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGrantCharacterToUserResultResponse(Reader.GetFallbackTree(TEXT("GrantCharacterToUserResult"), response));
+    }
     return tempStruct;
 }
 
@@ -873,6 +2890,12 @@ FServerUpdateCharacterStatisticsResult UPlayFabServerModelDecoder::decodeUpdateC
     return tempStruct;
 }
 
+FServerUpdateCharacterStatisticsResult UPlayFabServerModelDecoder::readUpdateCharacterStatisticsResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerUpdateCharacterStatisticsResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -883,24 +2906,100 @@ FServerGetCharacterDataResult UPlayFabServerModelDecoder::decodeGetCharacterData
 {
     // Temp ustruct
     FServerGetCharacterDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
-    tempStruct.Data = !(dataObj->HasField("Data")) ? nullptr : dataObj->GetObjectField("Data");
-    tempStruct.CharacterId = !(dataObj->HasField("CharacterId")) ? TEXT("") : dataObj->GetStringField("CharacterId");
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.DataVersion = !(dataObj.HasField("DataVersion")) ? 0 : int(dataObj.GetNumberField("DataVersion"));
+    tempStruct.DataView = !(dataObj.HasField("Data")) ? FPlayFabJsonView() : dataObj.GetObjectField("Data");
+    tempStruct.CharacterId = !(dataObj.HasField("CharacterId")) ? TEXT("") : dataObj.GetStringField("CharacterId");
 
     return tempStruct;
 }
 
+FServerGetCharacterDataResult UPlayFabServerModelDecoder::readGetCharacterDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetCharacterDataResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterDataResult"), response));
+    }
+
+    FServerGetCharacterDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("DataVersion"):
+            Reader.ReadInt(tempStruct.DataVersion);
+            break;
+        case FPlayFabJsonReader::Hash("Data"):
+            Reader.ReadObject(tempStruct.DataView, TEXT("Data"));
+            break;
+        case FPlayFabJsonReader::Hash("CharacterId"):
+            Reader.ReadString(tempStruct.CharacterId);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetCharacterDataResultResponse(Reader.GetFallbackTree(TEXT("GetCharacterDataResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetCharacterDataResultJsonObjects(FServerGetCharacterDataResult& result)
+{
+    result.Data = result.DataView.WrapJsonObject();
+}
+
 FServerUpdateCharacterDataResult UPlayFabServerModelDecoder::decodeUpdateCharacterDataResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerUpdateCharacterDataResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.DataVersion = !(dataObj.HasField("DataVersion")) ? 0 : int(dataObj.GetNumberField("DataVersion"));
+
+    return tempStruct;
+}
+
+FServerUpdateCharacterDataResult UPlayFabServerModelDecoder::readUpdateCharacterDataResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeUpdateCharacterDataResultResponse(Reader.GetFallbackTree(TEXT("UpdateCharacterDataResult"), response));
+    }
 
-    tempStruct.DataVersion = !(dataObj->HasField("DataVersion")) ? 0 : int(dataObj->GetNumberField("DataVersion"));
+    FServerUpdateCharacterDataResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("DataVersion"):
+            Reader.ReadInt(tempStruct.DataVersion);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeUpdateCharacterDataResultResponse(Reader.GetFallbackTree(TEXT("UpdateCharacterDataResult"), response));
+    }
     return tempStruct;
 }
 
@@ -925,61 +3024,251 @@ FServerAddPlayerTagResult UPlayFabServerModelDecoder::decodeAddPlayerTagResultRe
     return tempStruct;
 }
 
+FServerAddPlayerTagResult UPlayFabServerModelDecoder::readAddPlayerTagResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerAddPlayerTagResult();
+}
+
 FServerGetAllActionGroupsResult UPlayFabServerModelDecoder::decodeGetAllActionGroupsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetAllActionGroupsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.ActionGroupsView = !(dataObj.HasField("ActionGroups")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("ActionGroups");
 
-    tempStruct.ActionGroups = !(dataObj->HasField("ActionGroups")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("ActionGroups");
+    return tempStruct;
+}
+
+FServerGetAllActionGroupsResult UPlayFabServerModelDecoder::readGetAllActionGroupsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetAllActionGroupsResultResponse(Reader.GetFallbackTree(TEXT("GetAllActionGroupsResult"), response));
+    }
 
+    FServerGetAllActionGroupsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ActionGroups"):
+            Reader.ReadObjectArray(tempStruct.ActionGroupsView, TEXT("ActionGroups"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetAllActionGroupsResultResponse(Reader.GetFallbackTree(TEXT("GetAllActionGroupsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetAllActionGroupsResultJsonObjects(FServerGetAllActionGroupsResult& result)
+{
+    result.ActionGroups = FPlayFabJsonView::WrapJsonObjects(result.ActionGroupsView);
+}
+
 FServerGetAllSegmentsResult UPlayFabServerModelDecoder::decodeGetAllSegmentsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetAllSegmentsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.SegmentsView = !(dataObj.HasField("Segments")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Segments");
+
+    return tempStruct;
+}
+
+FServerGetAllSegmentsResult UPlayFabServerModelDecoder::readGetAllSegmentsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetAllSegmentsResultResponse(Reader.GetFallbackTree(TEXT("GetAllSegmentsResult"), response));
+    }
 
-    tempStruct.Segments = !(dataObj->HasField("Segments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Segments");
+    FServerGetAllSegmentsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Segments"):
+            Reader.ReadObjectArray(tempStruct.SegmentsView, TEXT("Segments"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetAllSegmentsResultResponse(Reader.GetFallbackTree(TEXT("GetAllSegmentsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetAllSegmentsResultJsonObjects(FServerGetAllSegmentsResult& result)
+{
+    result.Segments = FPlayFabJsonView::WrapJsonObjects(result.SegmentsView);
+}
+
 FServerGetPlayerSegmentsResult UPlayFabServerModelDecoder::decodeGetPlayerSegmentsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetPlayerSegmentsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.SegmentsView = !(dataObj.HasField("Segments")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("Segments");
+
+    return tempStruct;
+}
+
+FServerGetPlayerSegmentsResult UPlayFabServerModelDecoder::readGetPlayerSegmentsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerSegmentsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerSegmentsResult"), response));
+    }
 
-    tempStruct.Segments = !(dataObj->HasField("Segments")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("Segments");
+    FServerGetPlayerSegmentsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("Segments"):
+            Reader.ReadObjectArray(tempStruct.SegmentsView, TEXT("Segments"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
 
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerSegmentsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerSegmentsResult"), response));
+    }
     return tempStruct;
 }
 
+void UPlayFabServerModelDecoder::fillGetPlayerSegmentsResultJsonObjects(FServerGetPlayerSegmentsResult& result)
+{
+    result.Segments = FPlayFabJsonView::WrapJsonObjects(result.SegmentsView);
+}
+
 FServerGetPlayersInSegmentResult UPlayFabServerModelDecoder::decodeGetPlayersInSegmentResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetPlayersInSegmentResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.ProfilesInSegment = !(dataObj->HasField("ProfilesInSegment")) ? 0 : int(dataObj->GetNumberField("ProfilesInSegment"));
-    tempStruct.ContinuationToken = !(dataObj->HasField("ContinuationToken")) ? TEXT("") : dataObj->GetStringField("ContinuationToken");
-    tempStruct.PlayerProfiles = !(dataObj->HasField("PlayerProfiles")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("PlayerProfiles");
+    tempStruct.ProfilesInSegment = !(dataObj.HasField("ProfilesInSegment")) ? 0 : int(dataObj.GetNumberField("ProfilesInSegment"));
+    tempStruct.ContinuationToken = !(dataObj.HasField("ContinuationToken")) ? TEXT("") : dataObj.GetStringField("ContinuationToken");
+    tempStruct.PlayerProfilesView = !(dataObj.HasField("PlayerProfiles")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("PlayerProfiles");
 
     return tempStruct;
 }
 
+FServerGetPlayersInSegmentResult UPlayFabServerModelDecoder::readGetPlayersInSegmentResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayersInSegmentResultResponse(Reader.GetFallbackTree(TEXT("GetPlayersInSegmentResult"), response));
+    }
+
+    FServerGetPlayersInSegmentResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("ProfilesInSegment"):
+            Reader.ReadInt(tempStruct.ProfilesInSegment);
+            break;
+        case FPlayFabJsonReader::Hash("ContinuationToken"):
+            Reader.ReadString(tempStruct.ContinuationToken);
+            break;
+        case FPlayFabJsonReader::Hash("PlayerProfiles"):
+            Reader.ReadObjectArray(tempStruct.PlayerProfilesView, TEXT("PlayerProfiles"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayersInSegmentResultResponse(Reader.GetFallbackTree(TEXT("GetPlayersInSegmentResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillGetPlayersInSegmentResultJsonObjects(FServerGetPlayersInSegmentResult& result)
+{
+    result.PlayerProfiles = FPlayFabJsonView::WrapJsonObjects(result.PlayerProfilesView);
+}
+
 FServerGetPlayerTagsResult UPlayFabServerModelDecoder::decodeGetPlayerTagsResultResponse(UPlayFabJsonObject* response)
 {
     // Temp ustruct
     FServerGetPlayerTagsResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
+
+    tempStruct.PlayFabId = !(dataObj.HasField("PlayFabId")) ? TEXT("") : dataObj.GetStringField("PlayFabId");
+    tempStruct.Tags = !(dataObj.HasField("Tags")) ? TEXT("") : FString::Join(dataObj.GetStringArrayField("Tags"), TEXT(","));
+
+    return tempStruct;
+}
 
-    tempStruct.PlayFabId = !(dataObj->HasField("PlayFabId")) ? TEXT("") : dataObj->GetStringField("PlayFabId");
-    tempStruct.Tags = !(dataObj->HasField("Tags")) ? TEXT("") : FString::Join(dataObj->GetStringArrayField("Tags"), TEXT(","));
+FServerGetPlayerTagsResult UPlayFabServerModelDecoder::readGetPlayerTagsResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeGetPlayerTagsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerTagsResult"), response));
+    }
 
+    FServerGetPlayerTagsResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("PlayFabId"):
+            Reader.ReadString(tempStruct.PlayFabId);
+            break;
+        case FPlayFabJsonReader::Hash("Tags"):
+            Reader.ReadStringList(tempStruct.Tags);
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeGetPlayerTagsResultResponse(Reader.GetFallbackTree(TEXT("GetPlayerTagsResult"), response));
+    }
     return tempStruct;
 }
 
@@ -992,6 +3281,12 @@ FServerRemovePlayerTagResult UPlayFabServerModelDecoder::decodeRemovePlayerTagRe
     return tempStruct;
 }
 
+FServerRemovePlayerTagResult UPlayFabServerModelDecoder::readRemovePlayerTagResultResponse(const FPlayFabBaseModel& response)
+{
+    // No fields to read
+    return FServerRemovePlayerTagResult();
+}
+
 
 
 ///////////////////////////////////////////////////////
@@ -1002,11 +3297,47 @@ FServerAwardSteamAchievementResult UPlayFabServerModelDecoder::decodeAwardSteamA
 {
     // Temp ustruct
     FServerAwardSteamAchievementResult tempStruct;
-    UPlayFabJsonObject* dataObj = !(response->HasField("data")) ? nullptr : response->GetObjectField("data");
+    const FPlayFabJsonView dataObj = response->GetView().GetObjectField("data");
 
-    tempStruct.AchievementResults = !(dataObj->HasField("AchievementResults")) ? TArray<UPlayFabJsonObject*>() : dataObj->GetObjectArrayField("AchievementResults");
+    tempStruct.AchievementResultsView = !(dataObj.HasField("AchievementResults")) ? TArray<FPlayFabJsonView>() : dataObj.GetObjectArrayField("AchievementResults");
 
     return tempStruct;
 }
 
+FServerAwardSteamAchievementResult UPlayFabServerModelDecoder::readAwardSteamAchievementResultResponse(const FPlayFabBaseModel& response)
+{
+    // Read the body in one pass, or decode the json tree if there is no body or it is malformed
+    FPlayFabJsonReader Reader(response.responseBody.Get());
+    if (!Reader.EnterData(response.responseData))
+    {
+        return decodeAwardSteamAchievementResultResponse(Reader.GetFallbackTree(TEXT("AwardSteamAchievementResult"), response));
+    }
+
+    FServerAwardSteamAchievementResult tempStruct;
+    uint64 Field;
+    while (Reader.NextField(Field))
+    {
+        switch (Field)
+        {
+        case FPlayFabJsonReader::Hash("AchievementResults"):
+            Reader.ReadObjectArray(tempStruct.AchievementResultsView, TEXT("AchievementResults"));
+            break;
+        default:
+            Reader.Skip();
+            break;
+        }
+    }
+
+    if (Reader.HasError())
+    {
+        return decodeAwardSteamAchievementResultResponse(Reader.GetFallbackTree(TEXT("AwardSteamAchievementResult"), response));
+    }
+    return tempStruct;
+}
+
+void UPlayFabServerModelDecoder::fillAwardSteamAchievementResultJsonObjects(FServerAwardSteamAchievementResult& result)
+{
+    result.AchievementResults = FPlayFabJsonView::WrapJsonObjects(result.AchievementResultsView);
+}
+
 
@@ -2,6 +2,32 @@
 
 #include "ModuleManager.h"
 
+/**
+* The title and credentials requests are built from. A snapshot is never modified once published, so any thread may
+* read it without locking, and a request reads everything it needs from one snapshot.
+*/
+struct FPlayFabSettings
+{
+    FString GameTitleId; // PlayFab TitleId
+    FString SessionTicket; // PlayFab client session ticket
+    FString SecretApiKey; // PlayFab DeveloperSecretKey
+    FString ServerUrl; // Replaces https://<TitleId>.playfabapi.com when set, e.g. http://127.0.0.1:7780 for a stand-in server
+
+    /** The full url of an API path, e.g. /Client/LoginWithCustomID */
+    inline FString GetUrl(const FString& Path) const;
+};
+
+/**
+* The session of one player, for a process that plays as many players at once, such as a load generator. A client call
+* given a context authenticates with the context's ticket instead of the global one, and a login fills in the context
+* instead of the global settings. Only the game thread touches it.
+*/
+struct FPlayFabSessionContext
+{
+    FString PlayFabId;
+    FString SessionTicket;
+};
+
 /**
 * The public interface to this module.  In most cases, this interface is only public to sibling modules
 * within this plugin.
@@ -35,12 +61,14 @@ public:
     const FString AD_TYPE_IDFA = TEXT("Idfa");
     const FString AD_TYPE_ANDROID_ID = TEXT("Adid");
 
-    /** PlayFab URL */
+    /** Domain of the production endpoints, under the title's own subdomain. Used unless a server url is set */
     static const FString PlayFabURL;
 
     static inline IPlayFab& Get()
     {
-        return FModuleManager::LoadModuleChecked< IPlayFab >("PlayFab");
+        // Skip the module manager's locked lookup once the module has started
+        IPlayFab* Module = LoadedModule;
+        return Module != nullptr ? *Module : FModuleManager::LoadModuleChecked< IPlayFab >("PlayFab");
     }
 
     /**
@@ -53,56 +81,148 @@ public:
         return FModuleManager::Get().IsModuleLoaded("PlayFab");
     }
 
+    /**
+    * The current settings snapshot. Safe to call from any thread, and never waits: it is a single pointer read. A
+    * replaced snapshot is kept for RetiredSettingsSeconds, so read what is needed from it right away rather than
+    * holding on to the reference.
+    */
+    inline const FPlayFabSettings& GetSettings() const
+    {
+        return *CurrentSettings;
+    }
+
     inline FString getGameTitleId()
     {
-        return GameTitleId;
+        return GetSettings().GameTitleId;
     }
     inline void setGameTitleId(FString NewGameTitleId)
     {
-        GameTitleId = NewGameTitleId;
+        ChangeSettings([&](FPlayFabSettings& Settings) { Settings.GameTitleId = NewGameTitleId; });
+    }
+
+    /** Send every call to this base url instead of the title's production endpoint. Empty restores the default */
+    inline FString getServerUrl()
+    {
+        return GetSettings().ServerUrl;
+    }
+    inline void setServerUrl(FString NewServerUrl)
+    {
+        NewServerUrl.RemoveFromEnd(TEXT("/"));
+        ChangeSettings([&](FPlayFabSettings& Settings) { Settings.ServerUrl = NewServerUrl; });
     }
 
     inline bool IsClientLoggedIn()
     {
-        return SessionTicket.Len() > 0;
+        return GetSettings().SessionTicket.Len() > 0;
     }
     inline FString getSessionTicket()
     {
-        return SessionTicket;
+        return GetSettings().SessionTicket;
     }
     inline void setSessionTicket(FString NewSessionTicket)
     {
-        SessionTicket = NewSessionTicket;
+        ChangeSettings([&](FPlayFabSettings& Settings) { Settings.SessionTicket = NewSessionTicket; });
     }
 
     inline FString getSecretApiKey()
     {
-        return PlayFabApiSecretKey;
+        return GetSettings().SecretApiKey;
     }
     inline void setApiSecretKey(FString NewSecretApiKey)
     {
-        PlayFabApiSecretKey = NewSecretApiKey;
+        ChangeSettings([&](FPlayFabSettings& Settings) { Settings.SecretApiKey = NewSecretApiKey; });
     }
 
+    /** Calls that have been made but not answered yet, whether queued or in flight */
     inline int32 GetPendingCallCount()
     {
-        int32 output;
-        pendingCallLock.Lock();
-        output = pendingCalls;
-        pendingCallLock.Unlock();
-        return output;
+        return queuedCalls + inFlightCalls;
+    }
+    /** Calls waiting in the request dispatcher for a free connection */
+    inline int32 GetQueuedCallCount()
+    {
+        return queuedCalls;
+    }
+    /** Calls currently on the wire */
+    inline int32 GetInFlightCallCount()
+    {
+        return inFlightCalls;
+    }
+    inline void ModifyPendingCallCount(int32 queuedDelta, int32 inFlightDelta)
+    {
+        if (queuedDelta != 0)
+        {
+            FPlatformAtomics::InterlockedAdd(&queuedCalls, queuedDelta);
+        }
+        if (inFlightDelta != 0)
+        {
+            FPlatformAtomics::InterlockedAdd(&inFlightCalls, inFlightDelta);
+        }
+    }
+
+protected:
+    IPlayFab()
+        : CurrentSettings(new FPlayFabSettings())
+    {
     }
-    inline void ModifyPendingCallCount(int32 delta)
+
+    virtual ~IPlayFab()
     {
-        pendingCallLock.Lock();
-        pendingCalls += delta;
-        pendingCallLock.Unlock();
+        delete CurrentSettings;
+        for (const FRetiredSettings& Retired : RetiredSettings)
+        {
+            delete Retired.Settings;
+        }
     }
 
+    /** Set by the module while it is started, so Get() doesn't go through the module manager */
+    static PLAYFAB_API IPlayFab* LoadedModule;
+
 private:
-    FString GameTitleId; // PlayFab TitleId
-    FString SessionTicket; // PlayFab client session ticket
-    FString PlayFabApiSecretKey; // PlayFab DeveloperSecretKey
-    FCriticalSection pendingCallLock;
-    int32 pendingCalls;
+    /** How long a replaced snapshot outlives its replacement. Far longer than any reader keeps one */
+    static constexpr double RetiredSettingsSeconds = 10.0;
+
+    struct FRetiredSettings
+    {
+        const FPlayFabSettings* Settings;
+        double RetireTime;
+    };
+
+    /**
+    * Publish a modified copy of the current settings. Only writers take the lock. The replaced snapshot is retired
+    * rather than freed, since a reader on another thread may still be using it, and snapshots retired long enough ago
+    * are freed by the next change. Settings only change a few times per session, so few are ever waiting.
+    */
+    template<typename ChangeType>
+    inline void ChangeSettings(ChangeType Change)
+    {
+        FScopeLock WriteLock(&settingsWriteLock);
+        FPlayFabSettings* Settings = new FPlayFabSettings(GetSettings());
+        Change(*Settings);
+        const FPlayFabSettings* Replaced = (const FPlayFabSettings*)FPlatformAtomics::InterlockedExchangePtr((void**)&CurrentSettings, Settings);
+
+        const double Now = FPlatformTime::Seconds();
+        RetiredSettings.RemoveAll([Now](const FRetiredSettings& Retired)
+        {
+            if (Now - Retired.RetireTime < RetiredSettingsSeconds)
+            {
+                return false;
+            }
+            delete Retired.Settings;
+            return true;
+        });
+        RetiredSettings.Add({ Replaced, Now });
+    }
+
+    const FPlayFabSettings* volatile CurrentSettings;
+    TArray<FRetiredSettings> RetiredSettings;
+    FCriticalSection settingsWriteLock;
+
+    volatile int32 queuedCalls = 0;
+    volatile int32 inFlightCalls = 0;
 };
+
+inline FString FPlayFabSettings::GetUrl(const FString& Path) const
+{
+    return ServerUrl.IsEmpty() ? TEXT("https://") + GameTitleId + IPlayFab::PlayFabURL + Path : ServerUrl + Path;
+}
@@ -0,0 +1,86 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Catalog Index. Hash lookups over a catalog snapshot: ItemId to item, ItemClass and
+// Tag to the items that have them, and the price of every item in each virtual currency.
+// An index is built once per CatalogVersion, on a worker thread after each catalog fetch or
+// from the snapshot on disk, and queries never allocate. Items are referred to by their
+// position in the snapshot.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "PlayFabCatalogSnapshot.h"
+
+class PLAYFAB_API FPlayFabCatalogIndex : public FNoncopyable
+{
+public:
+    /** Price of an item that isn't sold for a currency */
+    static const uint32 NoPrice = MAX_uint32;
+
+    /** Index a catalog snapshot, taking it over. Returns null if it isn't a valid catalog snapshot. Safe to call from any thread */
+    static TSharedPtr<FPlayFabCatalogIndex, ESPMode::ThreadSafe> Create(TArray<uint8>&& Snapshot);
+
+    /** Make an index the current one for its CatalogVersion. Game thread only */
+    static void Register(const TSharedRef<FPlayFabCatalogIndex, ESPMode::ThreadSafe>& Index);
+
+    /** The current index of a catalog version, "" for the primary catalog, or null if there is none yet. Game thread only */
+    static TSharedPtr<const FPlayFabCatalogIndex, ESPMode::ThreadSafe> Find(const FString& CatalogVersion);
+
+    /** Index the snapshot left by an earlier run, so the catalog can be used before it is fetched again */
+    static bool LoadSnapshot(const FString& CatalogVersion);
+
+    /** Drop every index, called by the module */
+    static void Shutdown();
+
+    const FPlayFabCatalogSnapshot& GetSnapshot() const { return Snapshot; }
+    int32 Num() const { return Snapshot.Num(); }
+
+    /** Position of the item with this ItemId, or INDEX_NONE */
+    int32 FindItem(const FString& ItemId) const;
+    int32 FindItem(const ANSICHAR* ItemId, int32 Length) const;
+
+    /** Positions of the items of an ItemClass, or with a Tag, in catalog order. Returns null and 0 if there are none */
+    const int32* GetItemsOfClass(const FString& ItemClass, int32& OutCount) const;
+    const int32* GetItemsWithTag(const FString& Tag, int32& OutCount) const;
+
+    /** The price of every item in Currency, by position, NoPrice where it isn't sold for it. Null if no item is */
+    const uint32* GetPrices(const FString& Currency) const;
+
+    /** The price of one item in Currency. Returns false if it isn't sold for it */
+    bool GetPrice(int32 ItemIndex, const FString& Currency, uint32& OutPrice) const;
+
+private:
+    FPlayFabCatalogIndex() {}
+
+    /** The items sharing one class or tag, a range of GroupMembers */
+    struct FGroup
+    {
+        FPlayFabSnapshotString Key;
+        int32 First;
+        int32 Count;
+    };
+
+    struct FCurrency
+    {
+        FString Code;
+        TArray<uint32> Prices;
+    };
+
+    /** Find the group for a key in an open addressed table of group positions */
+    const FGroup* FindGroup(const TArray<FGroup>& Groups, const TArray<int32>& Slots, const FString& Key) const;
+
+    /** Build an open addressed table over strings. Slots hold positions into the caller's rows */
+    template<typename KeyOfRow>
+    static void BuildSlots(TArray<int32>& OutSlots, int32 RowCount, const FPlayFabCatalogSnapshot& Snapshot, KeyOfRow GetKey);
+
+    FPlayFabCatalogSnapshot Snapshot;
+
+    TArray<int32> ItemSlots;
+
+    TArray<FGroup> ClassGroups;
+    TArray<int32> ClassSlots;
+    TArray<FGroup> TagGroups;
+    TArray<int32> TagSlots;
+    TArray<int32> GroupMembers;
+
+    TArray<FCurrency> Currencies;
+};
@@ -0,0 +1,180 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Stand-In Server. A local HTTP server that answers the /Client, /Server, /Admin and
+// /Matchmaker routes, so a build can be load tested without touching a live title. Logins
+// hand out session tickets and every other call gets a canned response: a recorded fixture
+// if there is one (see PlayFab.RecordFixtures), otherwise an empty success. A script adds
+// per-route responses, latency distributions, error codes, throttling and dropped connections.
+// Runs on its own thread, and points the SDK's server url at itself while it is running.
+//
+// Scripts are json, every field optional, routes override the "Default" rule field by field:
+//
+//   { "Seed": 1, "Fixtures": "<dir>",
+//     "Default": { "Latency": { "Shape": "Normal", "Mean": 40, "Spread": 10 } },
+//     "Routes": { "/Client/PurchaseItem": { "ErrorRate": 0.05, "ErrorCode": 1123,
+//                                           "ThrottlePerSecond": 200, "DropRate": 0.01,
+//                                           "Responses": [ { "Items": [] } ] } } }
+//
+// Latency shapes are Constant, Uniform (Mean +- Spread), Normal (Spread is the standard
+// deviation) and Exponential, in milliseconds. Responses are the "data" of successive calls,
+// the last one repeating. Only plain http is served.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+#include "HAL/Runnable.h"
+#include "Dom/JsonObject.h"
+
+class FSocket;
+
+/** Delay added before a route answers */
+struct FPlayFabStandInLatency
+{
+    enum class EShape : uint8
+    {
+        Constant,
+        Uniform,
+        Normal,
+        Exponential,
+    };
+
+    EShape Shape = EShape::Constant;
+    float MeanMs = 0.0f;
+    float SpreadMs = 0.0f;
+
+    /** Draw a delay in seconds, never negative */
+    float Sample(FRandomStream& Random) const;
+};
+
+/** How one route, or every route by default, behaves */
+struct FPlayFabStandInRoute
+{
+    FPlayFabStandInLatency Latency;
+
+    /** Fraction of calls answered with ErrorCode instead of a response */
+    float ErrorRate = 0.0f;
+    int32 ErrorCode = 1123; // ServiceUnavailable
+    int32 ErrorHttpStatus = 503;
+
+    /** Fraction of calls whose connection is closed without an answer */
+    float DropRate = 0.0f;
+
+    /** Calls per second allowed before answering 429 APIClientRequestRateLimitExceeded, 0 for no limit */
+    float ThrottlePerSecond = 0.0f;
+
+    /** The data of successive successful calls as condensed json, the last one repeating. Empty for the built-in response */
+    TArray<FString> Responses;
+};
+
+/** Counts of what the server has done since it started */
+struct FPlayFabStandInStats
+{
+    int32 Connections = 0;
+    int32 Requests = 0;
+    int32 Succeeded = 0;
+    int32 Errors = 0;
+    int32 Throttled = 0;
+    int32 Dropped = 0;
+};
+
+class PLAYFAB_API FPlayFabStandInServer : public FRunnable
+{
+public:
+    /**
+     * Start serving on 127.0.0.1:Port with the rules in ScriptFile, or the defaults if it is empty, and point the SDK at it.
+     * Replaces a server that is already running. Returns false if the script can't be read or the port can't be bound
+     */
+    static bool Start(int32 Port, const FString& ScriptFile = FString());
+
+    /** Stop the server and point the SDK back at the server url it had before. Also called by the module */
+    static void Shutdown();
+
+    static bool IsRunning() { return Instance != nullptr; }
+
+    /** The running server's counters, all zero if there is none. Safe to call from any thread */
+    static FPlayFabStandInStats GetStats();
+
+    /** FRunnable interface */
+    virtual uint32 Run() override;
+    virtual void Stop() override { bStopping = true; }
+
+private:
+    /** An accepted connection and the state of the request it is receiving or answering */
+    struct FConnection
+    {
+        FSocket* Socket = nullptr;
+        TArray<uint8> Received;
+
+        /** The answer to the last complete request, sent once ReadyTime has passed. Empty while none is pending */
+        TArray<uint8> Answer;
+        double ReadyTime = 0.0;
+        bool bCloseWhenReady = false;
+    };
+
+    /** A received request, its headers folded into what the routes need */
+    struct FRequest
+    {
+        FString Path;
+        FString Authentication;
+        FString SecretKey;
+        TSharedPtr<FJsonObject> Body;
+    };
+
+    struct FThrottle
+    {
+        double WindowStart = 0.0;
+        int32 Count = 0;
+    };
+
+    FPlayFabStandInServer(FSocket* InListener, FPlayFabStandInRoute&& InDefaultRule, TMap<FString, FPlayFabStandInRoute>&& InRules, const FString& InFixtureDirectory, int32 Seed);
+    virtual ~FPlayFabStandInServer();
+
+    /** Read a script into the default rule and per-route rules */
+    static bool LoadScript(const FString& ScriptFile, FPlayFabStandInRoute& OutDefaultRule, TMap<FString, FPlayFabStandInRoute>& OutRules, FString& OutFixtureDirectory, int32& OutSeed);
+    static void ReadRule(const FJsonObject& Json, FPlayFabStandInRoute& OutRule);
+
+    /** Accept, read and answer until stopped. Everything below runs on the server thread */
+    void AcceptConnections();
+    bool ReceiveRequests(FConnection& Connection, bool& bOutReceived);
+    bool SendAnswer(FConnection& Connection);
+
+    /** Parse one complete request off the front of Received. Returns false if it hasn't all arrived yet */
+    static bool ParseRequest(TArray<uint8>& Received, FRequest& OutRequest, bool& bOutMalformed);
+
+    /** Decide the fate of a request and queue its answer on the connection */
+    void Answer(FConnection& Connection, const FRequest& Request);
+
+    /** The body of a successful call, from the script, a fixture or the built-in responses */
+    FString GetResponseBody(const FRequest& Request, const FPlayFabStandInRoute& Rule);
+
+    /** The data of a login: a session ticket for a player id derived from the credentials */
+    FString MakeLoginData(const FRequest& Request);
+
+    /** True if the route is over its rate limit this second */
+    bool IsThrottled(const FString& Path, const FPlayFabStandInRoute& Rule, double Now);
+
+    static void WriteAnswer(int32 HttpStatus, const FString& Json, TArray<uint8>& OutAnswer);
+    static FString MakeError(int32 HttpStatus, int32 ErrorCode, const TCHAR* ErrorName, const TCHAR* Message);
+
+    static FPlayFabStandInServer* Instance;
+    static FCriticalSection StatsLock;
+
+    FSocket* Listener;
+    FRunnableThread* Thread;
+    FThreadSafeBool bStopping;
+
+    FPlayFabStandInRoute DefaultRule;
+    TMap<FString, FPlayFabStandInRoute> Rules;
+    FString FixtureDirectory;
+    FRandomStream Random;
+
+    TArray<FConnection> Connections;
+    TMap<FString, int32> ResponseIndex;
+    TMap<FString, FThrottle> Throttles;
+    TMap<FString, FString> FixtureCache;
+    int32 NextPlayerId;
+
+    FPlayFabStandInStats Stats;
+
+    /** The server url the SDK used before it was pointed here */
+    FString PreviousServerUrl;
+};
@@ -0,0 +1,108 @@
+#pragma once
+
+//////////////////////////////////////////////////////////////////////////////////////////////
+// PlayFab Tracer. Records metadata for every finished call into a fixed-size lock-free
+// ring buffer. Request and response bodies are only kept for sampled or failed calls, as
+// raw bytes, and are only turned into text when the trace is dumped: on demand, through
+// the PlayFab.DumpTrace console command, or when the process crashes.
+//////////////////////////////////////////////////////////////////////////////////////////////
+
+/** Metadata for one attempt of one call. Plain data, so it can be copied into the ring without locking */
+struct FPlayFabTraceRecord
+{
+    /** Position in the trace, filled in by the tracer */
+    int64 Sequence = 0;
+
+    ANSICHAR Endpoint[64];
+
+    /** Bytes on the wire, after any compression */
+    int32 RequestBytes = 0;
+    int32 ResponseBytes = 0;
+
+    /** Http status, 0 if the call never got a response */
+    int32 HttpCode = 0;
+
+    /** PlayFab error code, 0 on success */
+    int32 ErrorCode = 0;
+
+    int32 Attempt = 0;
+
+    /** Time waiting to be sent (including serialization), on the wire, and being parsed */
+    float QueueMs = 0.0f;
+    float NetworkMs = 0.0f;
+    float DecodeMs = 0.0f;
+
+    /** FPlatformTime::Seconds() when the call was submitted */
+    double SubmitTime = 0.0;
+
+    bool bBodiesCaptured = false;
+
+    FPlayFabTraceRecord()
+    {
+        Endpoint[0] = '\0';
+    }
+};
+
+class PLAYFAB_API FPlayFabTracer
+{
+public:
+    /** Number of records kept, must be a power of two */
+    static const int32 RingCapacity = 1024;
+
+    /** Number of sampled or failed calls whose bodies are kept */
+    static const int32 BodyCapacity = 32;
+
+    /** Create and destroy the tracer, called by the module */
+    static void Startup();
+    static void Shutdown();
+
+    /** Returns the tracer, only valid between Startup() and Shutdown() */
+    static FPlayFabTracer& Get();
+    static bool IsAvailable() { return Instance != nullptr; }
+
+    /** Fraction of calls, 0 to 1, whose bodies are captured even when they succeed. Failed calls are always captured */
+    void SetSampleRate(float InSampleRate) { SampleRate = FMath::Clamp(InSampleRate, 0.0f, 1.0f); }
+    float GetSampleRate() const { return SampleRate; }
+
+    /** Decide whether a new call is sampled */
+    bool ShouldSample() const { return SampleRate > 0.0f && FMath::FRand() < SampleRate; }
+
+    /** Add a record from any thread. Bodies are stored as given, pass nullptr unless the call was sampled or failed */
+    void Record(const FPlayFabTraceRecord& InRecord, const TArray<uint8>* RequestBody, const TArray<uint8>* ResponseBody);
+
+    /** Write the trace, oldest first, including any captured bodies */
+    void Dump(FOutputDevice& Ar) const;
+
+private:
+    FPlayFabTracer();
+    ~FPlayFabTracer();
+
+    struct FSlot
+    {
+        /** Sequence of the record held, or -1 while it is being written */
+        volatile int64 Sequence;
+        FPlayFabTraceRecord Record;
+    };
+
+    struct FCapturedBodies
+    {
+        int64 Sequence;
+        TArray<uint8> Request;
+        TArray<uint8> Response;
+    };
+
+    void OnSystemError();
+
+    static FPlayFabTracer* Instance;
+
+    FSlot Slots[RingCapacity];
+    volatile int64 NextSequence;
+
+    /** Bodies are rare, so a lock keeps this simple */
+    mutable FCriticalSection BodyLock;
+    TArray<FCapturedBodies> Bodies;
+    int32 NextBodySlot;
+
+    float SampleRate;
+    FDelegateHandle SystemErrorHandle;
+};